@@ -20,16 +20,53 @@
 #include <sstream>
 
 #include "datasystem/common/util/version.h"
+#include "compare/compare_args.h"
 #include "datasystem/utils/status.h"
 #include "kv/kv_args.h"
+#include "object/object_args.h"
+#include "stream/stream_args.h"
+#include "utils.h"
 
 namespace datasystem {
 namespace bench {
 ArgsBase::ArgsBase(const std::string &command)
-    : command(command), action(""), workerAddress(""), clientNum(1), threadNum(1), perfPath("./perf.log")
+    : command(command),
+      action(""),
+      workerAddress(""),
+      clientNum(1),
+      threadNum(1),
+      perfPath("./perf.log"),
+      expectedIntervalUs(0)
 {
 }
 
+Status ArgsBase::ParseCommonOption(int option, const char *value)
+{
+    switch (option) {
+        case RESULT_FILE_OPTION:
+            resultFile = value;
+            return Status::OK();
+        case HDR_FILE_OPTION:
+            hdrFile = value;
+            return Status::OK();
+        case EXPECTED_INTERVAL_OPTION:
+            return StrToInt(value, expectedIntervalUs);
+        default:
+            return Status(K_INVALID, "unknown option " + std::to_string(option));
+    }
+}
+
+std::string ArgsBase::CommonUsage()
+{
+    std::stringstream ss;
+    ss << "  --result_file        Write the result with the mergeable latency histogram as json, the input of "
+          "compare\n";
+    ss << "  --hdr_file           Write the latency percentile distribution in HdrHistogram .hgrm format\n";
+    ss << "  --expected_interval_us Expected interval between requests of a closed loop thread, back-fills the "
+          "samples a stall kept from being issued (default: 0, no correction). Not allowed with open loop runs\n";
+    return ss.str();
+}
+
 Status ArgsBase::Create(int argc, char *argv[], std::unique_ptr<ArgsBase> &args, bool &shouldExit)
 {
     if (argc <= 1) {
@@ -41,6 +78,15 @@ Status ArgsBase::Create(int argc, char *argv[], std::unique_ptr<ArgsBase> &args,
     if (command == "kv") {
         args = std::make_unique<KVArgs>(command);
         return args->Parse(argc, argv);
+    } else if (command == "object") {
+        args = std::make_unique<ObjectArgs>(command);
+        return args->Parse(argc, argv);
+    } else if (command == "stream") {
+        args = std::make_unique<StreamArgs>(command);
+        return args->Parse(argc, argv);
+    } else if (command == "compare") {
+        args = std::make_unique<CompareArgs>(command);
+        return args->Parse(argc, argv);
     } else if (command == "-h") {
         shouldExit = true;
         PrintUsage(argv[0]);
@@ -66,6 +112,9 @@ void ArgsBase::PrintUsage(const std::string &argv0)
     ss << "Usage:" << argv0 << " <command> [options]\n";
     ss << "Command:\n";
     ss << "  kv     Run benchmark for KVClient.\n";
+    ss << "  object Run benchmark for ObjectClient and global references.\n";
+    ss << "  stream Run benchmark for StreamClient.\n";
+    ss << "  compare Compare result files written by --result_file.\n";
     ss << "Options:\n";
     ss << "  -v     Show version\n";
     ss << "  -h     Show help\n";
@@ -28,6 +28,9 @@ struct ArgsBase {
     static void PrintUsage(const std::string &argv0);
     virtual Status Parse(int argc, char *argv[]) = 0;
     bool ShouldExit();
+    // Handle the long options shared by every command, see COMMON_LONG_OPTIONS.
+    Status ParseCommonOption(int option, const char *value);
+    static std::string CommonUsage();
 
     std::string command;
     std::string action;
@@ -38,7 +41,19 @@ struct ArgsBase {
     std::string perfWorkers;
     std::string accessKey;
     std::string secretKey;
+    std::string resultFile;
+    std::string hdrFile;
+    uint64_t expectedIntervalUs;
 };
+
+// Ids of the shared long options, beyond the range of single character options.
+constexpr int RESULT_FILE_OPTION = 256;
+constexpr int HDR_FILE_OPTION = 257;
+constexpr int EXPECTED_INTERVAL_OPTION = 258;
+#define COMMON_LONG_OPTIONS                                                          \
+    { "result_file", required_argument, nullptr, RESULT_FILE_OPTION },               \
+    { "hdr_file", required_argument, nullptr, HDR_FILE_OPTION },                     \
+    { "expected_interval_us", required_argument, nullptr, EXPECTED_INTERVAL_OPTION }
 }  // namespace bench
 }  // namespace datasystem
 #endif
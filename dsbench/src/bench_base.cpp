@@ -16,13 +16,21 @@
 
 #include "bench_base.h"
 
+#include <algorithm>
+#include <fstream>
 #include <limits>
 #include <thread>
 
+#include "bench_result.h"
 #include "datasystem/common/util/status_helper.h"
+#include "datasystem/common/util/version.h"
 #include "datasystem/utils/status.h"
 #include "kv/kv_args.h"
 #include "kv/kv_bench.h"
+#include "object/object_args.h"
+#include "object/object_bench.h"
+#include "stream/stream_args.h"
+#include "stream/stream_bench.h"
 
 namespace datasystem {
 namespace bench {
@@ -36,6 +44,22 @@ Status BenchBase::Create(std::unique_ptr<ArgsBase> &args, std::unique_ptr<BenchB
         bench = std::make_unique<KVBench>(*kvArgs);
         return Status::OK();
     }
+    if (args->command == "object") {
+        auto objectArgs = dynamic_cast<ObjectArgs*>(args.get());
+        if (!objectArgs) {
+            return Status(K_INVALID, "Invalid ObjectArgs");
+        }
+        bench = std::make_unique<ObjectBench>(*objectArgs);
+        return Status::OK();
+    }
+    if (args->command == "stream") {
+        auto streamArgs = dynamic_cast<StreamArgs*>(args.get());
+        if (!streamArgs) {
+            return Status(K_INVALID, "Invalid StreamArgs");
+        }
+        bench = std::make_unique<StreamBench>(*streamArgs);
+        return Status::OK();
+    }
     return Status(K_INVALID, "Unknown command " + args->command);
 }
 
@@ -46,8 +70,43 @@ Status BenchBase::Start()
     RETURN_IF_NOT_OK(perf_.ResetPerfLog());
     RETURN_IF_NOT_OK(ParallelRun());
     RETURN_IF_NOT_OK(perf_.SaveAllPerfLog());
+    RETURN_IF_NOT_OK(CollectServerPerf());
     RETURN_IF_NOT_OK(perf_.ResetPerfLog());
     RETURN_IF_NOT_OK(PrintBenchmarkInfo());
+    return SaveResult();
+}
+
+Status BenchBase::SaveResult()
+{
+    if (argsBase_.resultFile.empty() && argsBase_.hdrFile.empty()) {
+        return Status::OK();
+    }
+    BenchResult result;
+    result.command = argsBase_.command;
+    result.action = argsBase_.action;
+    result.gitHash = GetGitHash();
+    result.clientNum = argsBase_.clientNum;
+    result.threadNum = argsBase_.threadNum;
+    result.expectedIntervalUs = argsBase_.expectedIntervalUs;
+    uint64_t maxThreadCostUs = 0;
+    for (size_t i = 0; i < perThreadHistogram_.size(); i++) {
+        result.latency.Merge(perThreadHistogram_[i]);
+        result.opCount += LatencySamples(i).size();
+        maxThreadCostUs = std::max(maxThreadCostUs, perThreadCost_[i]);
+    }
+    const double MICROSECONDS_TO_SECONDS = 1000.0 * 1000.0;
+    result.durationSec = maxThreadCostUs / MICROSECONDS_TO_SECONDS;
+    result.opsPerSec = result.durationSec > 0 ? result.opCount / result.durationSec : 0;
+    if (!argsBase_.resultFile.empty()) {
+        RETURN_IF_NOT_OK(WriteBenchResult(argsBase_.resultFile, result));
+    }
+    if (!argsBase_.hdrFile.empty()) {
+        const double MICROSECONDS_TO_MILLISECONDS = 1000.0;
+        std::ofstream out(argsBase_.hdrFile, std::ios::trunc);
+        CHECK_FAIL_RETURN_STATUS(out.is_open(), K_IO_ERROR, "Failed to open hdr file " + argsBase_.hdrFile);
+        out << result.latency.PercentileDistribution(MICROSECONDS_TO_MILLISECONDS);
+        CHECK_FAIL_RETURN_STATUS(out.good(), K_IO_ERROR, "Failed to write hdr file " + argsBase_.hdrFile);
+    }
     return Status::OK();
 }
 
@@ -71,13 +130,24 @@ Status BenchBase::ParallelRun()
     perThreadCostDetail_.resize(totalThreadNum);
     perThreadCost_.clear();
     perThreadCost_.resize(totalThreadNum);
+    perThreadHistogram_.clear();
+    bool keepHistogram = !argsBase_.resultFile.empty() || !argsBase_.hdrFile.empty();
+    perThreadHistogram_.resize(keepHistogram ? totalThreadNum : 0);
 
     std::vector<std::thread> threads;
     threads.reserve(totalThreadNum);
     Barrier barrier(totalThreadNum);
     RETURN_IF_NOT_OK(Prepare());
     for (size_t t = 0; t < totalThreadNum; ++t) {
-        threads.emplace_back([this, t, &barrier] { perThreadStatus_[t] = Run(t, barrier); });
+        threads.emplace_back([this, t, keepHistogram, &barrier] {
+            perThreadStatus_[t] = Run(t, barrier);
+            if (!keepHistogram) {
+                return;
+            }
+            for (auto sample : LatencySamples(t)) {
+                perThreadHistogram_[t].RecordCorrected(sample, argsBase_.expectedIntervalUs);
+            }
+        });
     }
 
     for (auto &t : threads) {
@@ -21,6 +21,7 @@
 #include "bench_perf.h"
 #include "datasystem/common/util/wait_post.h"
 #include "datasystem/utils/status.h"
+#include "latency_histogram.h"
 namespace datasystem {
 
 namespace bench {
@@ -41,11 +42,24 @@ protected:
     virtual Status Prepare() = 0;
     virtual Status Run(uint64_t threadIndex, Barrier &barrier) = 0;
     virtual Status PrintBenchmarkInfo() = 0;
+    // Called after the measured run and before the perf log is reset, to pick up server side perf points.
+    virtual Status CollectServerPerf()
+    {
+        return Status::OK();
+    }
+    // The latency samples (in microseconds) of a thread that go into the result histogram.
+    virtual const std::vector<uint64_t> &LatencySamples(uint64_t threadIndex) const
+    {
+        return perThreadCostDetail_[threadIndex];
+    }
     Status ParallelRun();
+    Status SaveResult();
 
     std::vector<Status> perThreadStatus_;
     std::vector<std::vector<uint64_t>> perThreadCostDetail_;
     std::vector<uint64_t> perThreadCost_;
+    // Filled by each thread from its own samples when its Run returns, merged when the result is saved.
+    std::vector<LatencyHistogram> perThreadHistogram_;
     ArgsBase &argsBase_;
     PerfManager perf_;
 };
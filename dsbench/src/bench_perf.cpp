@@ -155,6 +155,28 @@ Status PerfManager::SaveAllPerfLog()
     return Status::OK();
 }
 
+Status PerfManager::SumWorkerPerfTime(const std::vector<std::string> &names, uint64_t &count,
+                                      uint64_t &totalTimeNs)
+{
+    count = 0;
+    totalTimeNs = 0;
+    if (!supportPerf_) {
+        return Status::OK();
+    }
+    for (auto &item : perfClients_) {
+        std::unordered_map<std::string, std::unordered_map<std::string, uint64_t>> perfLog;
+        RETURN_IF_NOT_OK(item.second->GetPerfLog("worker", perfLog));
+        for (const auto &name : names) {
+            auto point = perfLog.find(name);
+            if (point != perfLog.end()) {
+                count += point->second["count"];
+                totalTimeNs += point->second["total_time"];
+            }
+        }
+    }
+    return Status::OK();
+}
+
 Status PerfManager::ResetPerfLog()
 {
     if (!supportPerf_ || perfClients_.empty()) {
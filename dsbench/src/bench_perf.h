@@ -19,6 +19,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "datasystem/perf_client.h"
 #include "datasystem/utils/status.h"
@@ -38,6 +39,15 @@ public:
 
     Status ResetPerfLog();
 
+    /**
+     * @brief Sum the given worker side perf points over all perf workers.
+     * @param[in] names The perf point names, e.g. MASTER_GINCREASE_REF.
+     * @param[out] count The total hit count of the matched perf points.
+     * @param[out] totalTimeNs The total time of the matched perf points in nanoseconds.
+     * @return Status of the call.
+     */
+    Status SumWorkerPerfTime(const std::vector<std::string> &names, uint64_t &count, uint64_t &totalTimeNs);
+
 private:
     Status SavePerfLog(const std::string &command, const std::string &workerAddr);
 
@@ -70,6 +80,13 @@ public:
     {
         return Status::OK();
     }
+
+    Status SumWorkerPerfTime(const std::vector<std::string> &, uint64_t &count, uint64_t &totalTimeNs)
+    {
+        count = 0;
+        totalTimeNs = 0;
+        return Status::OK();
+    }
 };
 #endif
 
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Machine readable benchmark result and the comparison of two results.
+ */
+#include "bench_result.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "datasystem/common/util/status_helper.h"
+
+namespace datasystem {
+namespace bench {
+namespace {
+const double MICROSECONDS_TO_MILLISECONDS = 1000.0;
+
+Status LoadBenchResult(const std::string &path, BenchResult &result)
+{
+    std::ifstream in(path);
+    CHECK_FAIL_RETURN_STATUS(in.is_open(), K_INVALID, "Failed to open result file " + path);
+    try {
+        auto json = nlohmann::json::parse(in);
+        result.command = json.at("command").get<std::string>();
+        result.action = json.at("action").get<std::string>();
+        result.gitHash = json.value("git_hash", "");
+        result.clientNum = json.at("client_num").get<uint64_t>();
+        result.threadNum = json.at("thread_num").get<uint64_t>();
+        result.expectedIntervalUs = json.value("expected_interval_us", uint64_t{ 0 });
+        result.opCount = json.at("op_count").get<uint64_t>();
+        result.durationSec = json.at("duration_sec").get<double>();
+        result.opsPerSec = json.at("ops_per_sec").get<double>();
+        RETURN_IF_NOT_OK_APPEND_MSG(LatencyHistogram::FromJson(json.at("latency_histogram"), result.latency),
+                                    " in " + path);
+    } catch (const nlohmann::json::exception &e) {
+        RETURN_STATUS(K_INVALID, "Malformed result file " + path + ": " + e.what());
+    }
+    return Status::OK();
+}
+
+struct CompareRow {
+    std::string name;
+    double baseValue;
+    double newValue;
+    bool higherIsBetter;
+    bool gated;
+};
+}  // namespace
+
+Status WriteBenchResult(const std::string &path, const BenchResult &result)
+{
+    const auto &latency = result.latency;
+    nlohmann::json json = {
+        { "command", result.command },
+        { "action", result.action },
+        { "git_hash", result.gitHash },
+        { "client_num", result.clientNum },
+        { "thread_num", result.threadNum },
+        { "expected_interval_us", result.expectedIntervalUs },
+        { "op_count", result.opCount },
+        { "duration_sec", result.durationSec },
+        { "ops_per_sec", result.opsPerSec },
+        { "latency_ms",
+          { { "mean", latency.Mean() / MICROSECONDS_TO_MILLISECONDS },
+            { "min", latency.Min() / MICROSECONDS_TO_MILLISECONDS },
+            { "p50", latency.ValueAtPercentile(50) / MICROSECONDS_TO_MILLISECONDS },
+            { "p90", latency.ValueAtPercentile(90) / MICROSECONDS_TO_MILLISECONDS },
+            { "p99", latency.ValueAtPercentile(99) / MICROSECONDS_TO_MILLISECONDS },
+            { "p999", latency.ValueAtPercentile(99.9) / MICROSECONDS_TO_MILLISECONDS },
+            { "p9999", latency.ValueAtPercentile(99.99) / MICROSECONDS_TO_MILLISECONDS },
+            { "max", latency.Max() / MICROSECONDS_TO_MILLISECONDS } } },
+        { "latency_histogram", latency.ToJson() },
+    };
+    std::ofstream out(path, std::ios::trunc);
+    CHECK_FAIL_RETURN_STATUS(out.is_open(), K_IO_ERROR, "Failed to open result file " + path);
+    out << json.dump() << "\n";
+    CHECK_FAIL_RETURN_STATUS(out.good(), K_IO_ERROR, "Failed to write result file " + path);
+    return Status::OK();
+}
+
+Status LoadBenchResults(const std::string &paths, BenchResult &result)
+{
+    std::stringstream ss(paths);
+    std::string path;
+    bool first = true;
+    while (std::getline(ss, path, ',')) {
+        if (path.empty()) {
+            continue;
+        }
+        BenchResult one;
+        RETURN_IF_NOT_OK(LoadBenchResult(path, one));
+        if (first) {
+            result = std::move(one);
+            first = false;
+            continue;
+        }
+        CHECK_FAIL_RETURN_STATUS(one.command == result.command && one.action == result.action, K_INVALID,
+                                 "Cannot merge results of different benchmarks: " + path);
+        result.clientNum += one.clientNum;
+        result.threadNum += one.threadNum;
+        result.opCount += one.opCount;
+        result.durationSec = std::max(result.durationSec, one.durationSec);
+        result.opsPerSec += one.opsPerSec;
+        result.latency.Merge(one.latency);
+    }
+    CHECK_FAIL_RETURN_STATUS(!first, K_INVALID, "No result file in " + paths);
+    return Status::OK();
+}
+
+Status CompareBenchResults(const BenchResult &baseResult, const BenchResult &newResult, double thresholdPercent)
+{
+    if (baseResult.command != newResult.command || baseResult.action != newResult.action) {
+        std::cout << "WARNING: comparing " << baseResult.command << " " << baseResult.action << " with "
+                  << newResult.command << " " << newResult.action << "\n";
+    }
+    auto percentileMs = [](const BenchResult &result, double percentile) {
+        return result.latency.ValueAtPercentile(percentile) / MICROSECONDS_TO_MILLISECONDS;
+    };
+    std::vector<CompareRow> rows = {
+        { "ops_per_sec", baseResult.opsPerSec, newResult.opsPerSec, true, true },
+        { "mean_ms", baseResult.latency.Mean() / MICROSECONDS_TO_MILLISECONDS,
+          newResult.latency.Mean() / MICROSECONDS_TO_MILLISECONDS, false, true },
+        { "p50_ms", percentileMs(baseResult, 50), percentileMs(newResult, 50), false, true },
+        { "p90_ms", percentileMs(baseResult, 90), percentileMs(newResult, 90), false, false },
+        { "p99_ms", percentileMs(baseResult, 99), percentileMs(newResult, 99), false, true },
+        { "p99.9_ms", percentileMs(baseResult, 99.9), percentileMs(newResult, 99.9), false, true },
+        { "p99.99_ms", percentileMs(baseResult, 99.99), percentileMs(newResult, 99.99), false, false },
+        { "max_ms", baseResult.latency.Max() / MICROSECONDS_TO_MILLISECONDS,
+          newResult.latency.Max() / MICROSECONDS_TO_MILLISECONDS, false, false },
+    };
+    const size_t lineSize = 128;
+    char line[lineSize];
+    (void)snprintf(line, lineSize, "%-12s %14s %14s %10s\n", "metric", "base", "new", "diff");
+    std::cout << line;
+    const double percent = 100.0;
+    bool regressed = false;
+    for (const auto &row : rows) {
+        double diff = row.baseValue == 0 ? 0 : (row.newValue - row.baseValue) / row.baseValue * percent;
+        bool worse = row.higherIsBetter ? -diff > thresholdPercent : diff > thresholdPercent;
+        bool flagged = thresholdPercent > 0 && row.gated && worse;
+        regressed = regressed || flagged;
+        (void)snprintf(line, lineSize, "%-12s %14.3f %14.3f %+9.2f%%%s\n", row.name.c_str(), row.baseValue,
+                       row.newValue, diff, flagged ? "  REGRESSION" : "");
+        std::cout << line;
+    }
+    CHECK_FAIL_RETURN_STATUS(!regressed, K_RUNTIME_ERROR,
+                             "Performance regression beyond " + std::to_string(thresholdPercent) + "%");
+    return Status::OK();
+}
+}  // namespace bench
+}  // namespace datasystem
@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Machine readable benchmark result and the comparison of two results.
+ */
+#ifndef BENCH_RESULT_H
+#define BENCH_RESULT_H
+
+#include <string>
+
+#include "datasystem/utils/status.h"
+#include "latency_histogram.h"
+
+namespace datasystem {
+namespace bench {
+struct BenchResult {
+    std::string command;
+    std::string action;
+    std::string gitHash;
+    uint64_t clientNum = 0;
+    uint64_t threadNum = 0;
+    uint64_t expectedIntervalUs = 0;
+    uint64_t opCount = 0;       // Measured requests, without the samples back-filled by the correction.
+    double durationSec = 0;     // Wall time of the slowest thread.
+    double opsPerSec = 0;
+    LatencyHistogram latency;   // Microseconds.
+};
+
+/**
+ * @brief Write the result as json.
+ * @param[in] path The output path.
+ * @param[in] result The result.
+ * @return K_OK on success; K_IO_ERROR if the file cannot be written.
+ */
+Status WriteBenchResult(const std::string &path, const BenchResult &result);
+
+/**
+ * @brief Load results and merge them, e.g. the results of several dsbench processes of one run.
+ * @param[in] paths The comma separated result paths.
+ * @param[out] result The merged result, throughput adds up and the histograms merge.
+ * @return K_OK on success; the error code otherwise.
+ */
+Status LoadBenchResults(const std::string &paths, BenchResult &result);
+
+/**
+ * @brief Print the throughput and latency percentiles of two results side by side.
+ * @param[in] baseResult The baseline result.
+ * @param[in] newResult The result to check.
+ * @param[in] thresholdPercent Flag a regression when throughput drops or mean/p50/p99/p99.9 latency grows by more
+ *            than this percent, 0 to only print the difference.
+ * @return K_OK if no regression is flagged; K_RUNTIME_ERROR otherwise.
+ */
+Status CompareBenchResults(const BenchResult &baseResult, const BenchResult &newResult, double thresholdPercent);
+}  // namespace bench
+}  // namespace datasystem
+#endif
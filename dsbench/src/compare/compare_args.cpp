@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compare/compare_args.h"
+
+#include <getopt.h>
+#include <iostream>
+#include <sstream>
+
+#include "datasystem/utils/status.h"
+#include "utils.h"
+
+namespace datasystem {
+namespace bench {
+CompareArgs::CompareArgs(const std::string &command) : ArgsBase(command), thresholdPercent(0)
+{
+}
+
+std::string CompareArgs::Usage(const std::string &argv0)
+{
+    std::stringstream ss;
+    ss << "Usage:" << argv0 << " compare -b <base.json> -n <new.json> [options]\n";
+    ss << "Options:\n";
+    ss << "  -b --base            Baseline result files written by --result_file, comma separated files are merged\n";
+    ss << "  -n --new             Result files to check, comma separated files are merged\n";
+    ss << "  -t --threshold       Fail when throughput drops or mean/p50/p99/p99.9 latency grows by more than this "
+          "percent (default: 0, only print the difference)\n";
+    ss << "  -h                   Show help\n";
+    return ss.str();
+}
+
+Status CompareArgs::Parse(int argc, char *argv[])
+{
+    // clang-format off
+    static const struct option longOptions[] = {
+        { "base", required_argument, nullptr, 'b' },         { "new", required_argument, nullptr, 'n' },
+        { "threshold", required_argument, nullptr, 't' },    { "help", no_argument, nullptr, 'h' }
+    };
+    // clang-format on
+    while (true) {
+        auto c = getopt_long(argc - 1, argv + 1, "hb:n:t:", longOptions, nullptr);
+        if (c == -1) {
+            break;
+        }
+        Status rc = Status::OK();
+        switch (c) {
+            case 'b':
+                baseFiles = optarg;
+                break;
+            case 'n':
+                newFiles = optarg;
+                break;
+            case 't':
+                rc = StrToDouble(optarg, thresholdPercent);
+                break;
+            default:
+                std::cout << Usage(argv[0]);
+                return Status(K_INVALID, "");
+        }
+        if (rc.IsError()) {
+            std::cerr << "Error: Invalid argument value - " << rc.GetMsg() << "\n";
+            std::cerr << "Please refer to the usage below:\n";
+            std::cerr << Usage(argv[0]);
+            return Status(K_INVALID, "");
+        }
+    }
+    if (baseFiles.empty() || newFiles.empty() || thresholdPercent < 0) {
+        std::cerr << "Error: base and new are required and threshold must not be negative\n";
+        std::cerr << "Please refer to the usage below:\n";
+        std::cerr << Usage(argv[0]);
+        return Status(K_INVALID, "");
+    }
+    return Status::OK();
+}
+}  // namespace bench
+}  // namespace datasystem
@@ -37,7 +37,15 @@ KVArgs::KVArgs(const std::string &command)
       workerIndex(0),
       skipLocal(false),
       enableLocalCache(true),
-      dataPlacementPolicy("PREFERRED_SAME_NODE")
+      dataPlacementPolicy("PREFERRED_SAME_NODE"),
+      distribution("sequential"),
+      zipfTheta(0.99),
+      hotKeyRatio(0.2),
+      hotOpRatio(0.8),
+      opNum(0),
+      readRatio(0.5),
+      rate(0),
+      replaySpeed(1.0)
 {
 }
 
@@ -46,13 +54,13 @@ std::string KVArgs::Usage(const std::string &argv0)
     std::stringstream ss;
     ss << "Usage:" << argv0 << " kv [options]\n";
     ss << "Options:\n";
-    ss << "  -a --action          action set/get/del/prefill\n";
+    ss << "  -a --action          action set/get/del/prefill/mixed/replay\n";
     ss << "  -w --worker_address  worker address\n";
     ss << "  -o --owner_worker    meta owner worker address\n";
     ss << "  -p --prefix          the key prefix\n";
     ss << "  -c --client_num      Client number per benchmark process, default 1\n";
     ss << "  -n --num             Key number, default 1\n";
-    ss << "  -s --size            default key size 1024, support n/nB/nKB/nMB/nGB\n";
+    ss << "  -s --size            default key size 1024, support n/nB/nKB/nMB/nGB or a range like 1KB-64KB\n";
     ss << "  -t --thread_num      Thread number per client, default 1\n";
     ss << "  -b --batch_num       Batch number per request, default 1\n";
     ss << "  -f --perf_path       The perf point path\n";
@@ -66,6 +74,18 @@ std::string KVArgs::Usage(const std::string &argv0)
           "(default: true)\n";
     ss << "  --data_placement_policy SDK write placement policy: PREFERRED_SAME_NODE, REQUIRED_SAME_NODE, "
           "or PREFERRED_META_OWNER (default: PREFERRED_SAME_NODE)\n";
+    ss << "  --distribution       Key distribution: sequential, uniform, zipfian, hotspot or latest (default: "
+          "sequential, every key is accessed once)\n";
+    ss << "  --zipf_theta         Skew of zipfian and latest distributions, in (0, 1) (default: 0.99)\n";
+    ss << "  --hot_key_ratio      Fraction of keys in the hot set of hotspot distribution (default: 0.2)\n";
+    ss << "  --hot_op_ratio       Fraction of operations to the hot set of hotspot distribution (default: 0.8)\n";
+    ss << "  --op_num             Operations per thread for non sequential distributions (default: key number)\n";
+    ss << "  --read_ratio         Fraction of get operations of mixed action (default: 0.5)\n";
+    ss << "  --rate               Open loop arrival rate in operations per second per thread, latency is measured "
+          "from the intended start time (default: 0, closed loop)\n";
+    ss << "  --trace_file         Access log to reissue with its original timing for replay action\n";
+    ss << "  --replay_speed       Speedup factor of replay timing (default: 1.0)\n";
+    ss << CommonUsage();
     ss << "  -h                   Show help\n";
     return ss.str();
 }
@@ -91,7 +111,16 @@ std::string KVArgs::ToString()
     ss << "  --skip_local:     " << (skipLocal ? "true" : "false") << "\n";
     ss << "  --enable_local_cache: " << (enableLocalCache ? "true" : "false") << "\n";
     ss << "  --data_placement_policy: "
-       << dataPlacementPolicy;
+       << dataPlacementPolicy << "\n";
+    ss << "  --distribution:      " << distribution << "\n";
+    ss << "  --zipf_theta:        " << zipfTheta << "\n";
+    ss << "  --hot_key_ratio:     " << hotKeyRatio << "\n";
+    ss << "  --hot_op_ratio:      " << hotOpRatio << "\n";
+    ss << "  --op_num:            " << opNum << "\n";
+    ss << "  --read_ratio:        " << readRatio << "\n";
+    ss << "  --rate:              " << rate << "\n";
+    ss << "  --trace_file:        " << traceFile << "\n";
+    ss << "  --replay_speed:      " << replaySpeed;
     return ss.str();
 }
 
@@ -100,6 +129,15 @@ Status KVArgs::Parse(int argc, char *argv[])
     const int skipLocalOption = 1;
     const int enableLocalCacheOption = 2;
     const int dataPlacementPolicyOption = 3;
+    const int distributionOption = 4;
+    const int zipfThetaOption = 5;
+    const int hotKeyRatioOption = 6;
+    const int hotOpRatioOption = 7;
+    const int opNumOption = 8;
+    const int readRatioOption = 9;
+    const int rateOption = 10;
+    const int traceFileOption = 11;
+    const int replaySpeedOption = 12;
     // clang-format off
     static const struct option longOptions[] = {
         { "action", required_argument, nullptr, 'a' },       { "worker_address", required_argument, nullptr, 'w' },
@@ -114,6 +152,16 @@ Status KVArgs::Parse(int argc, char *argv[])
         { "skip_local", no_argument, nullptr, skipLocalOption },
         { "enable_local_cache", required_argument, nullptr, enableLocalCacheOption },
         { "data_placement_policy", required_argument, nullptr, dataPlacementPolicyOption },
+        { "distribution", required_argument, nullptr, distributionOption },
+        { "zipf_theta", required_argument, nullptr, zipfThetaOption },
+        { "hot_key_ratio", required_argument, nullptr, hotKeyRatioOption },
+        { "hot_op_ratio", required_argument, nullptr, hotOpRatioOption },
+        { "op_num", required_argument, nullptr, opNumOption },
+        { "read_ratio", required_argument, nullptr, readRatioOption },
+        { "rate", required_argument, nullptr, rateOption },
+        { "trace_file", required_argument, nullptr, traceFileOption },
+        { "replay_speed", required_argument, nullptr, replaySpeedOption },
+        COMMON_LONG_OPTIONS,
         { "help", no_argument, nullptr, 'h' }
     };
     // clang-format on
@@ -189,6 +237,42 @@ Status KVArgs::Parse(int argc, char *argv[])
                     rc = Status(K_INVALID, "unsupported data_placement_policy");
                 }
                 break;
+            case distributionOption:
+                distribution = optarg;
+                if (distribution != "sequential" && distribution != "uniform" && distribution != "zipfian"
+                    && distribution != "hotspot" && distribution != "latest") {
+                    rc = Status(K_INVALID, "unsupported distribution");
+                }
+                break;
+            case zipfThetaOption:
+                rc = StrToDouble(optarg, zipfTheta);
+                break;
+            case hotKeyRatioOption:
+                rc = StrToDouble(optarg, hotKeyRatio);
+                break;
+            case hotOpRatioOption:
+                rc = StrToDouble(optarg, hotOpRatio);
+                break;
+            case opNumOption:
+                rc = StrToInt(optarg, opNum);
+                break;
+            case readRatioOption:
+                rc = StrToDouble(optarg, readRatio);
+                break;
+            case rateOption:
+                rc = StrToInt(optarg, rate);
+                break;
+            case traceFileOption:
+                traceFile = optarg;
+                break;
+            case replaySpeedOption:
+                rc = StrToDouble(optarg, replaySpeed);
+                break;
+            case RESULT_FILE_OPTION:
+            case HDR_FILE_OPTION:
+            case EXPECTED_INTERVAL_OPTION:
+                rc = ParseCommonOption(c, optarg);
+                break;
             default:
                 std::cout << Usage(argv[0]);
                 return Status(K_INVALID, "");
@@ -229,6 +313,32 @@ Status KVArgs::Parse(int argc, char *argv[])
         return Status(K_INVALID, "");
     }
 
+    std::string argError;
+    uint64_t minSize;
+    uint64_t maxSize;
+    if (StringToBytesRange(keySize, minSize, maxSize).IsError()) {
+        argError = "invalid size " + keySize;
+    } else if (action == "mixed" && distribution == "sequential") {
+        argError = "mixed action requires a non sequential distribution";
+    } else if (rate > 0 && distribution == "sequential" && action != "replay") {
+        argError = "rate requires a non sequential distribution";
+    } else if (readRatio < 0 || readRatio > 1) {
+        argError = "read_ratio must be in [0, 1]";
+    } else if (action == "replay" && traceFile.empty()) {
+        argError = "replay action requires trace_file";
+    } else if (replaySpeed <= 0) {
+        argError = "replay_speed must be greater than 0";
+    } else if (expectedIntervalUs > 0 && (rate > 0 || action == "replay")) {
+        // Open loop latencies are already measured from the scheduled start, correcting them again double counts.
+        argError = "expected_interval_us only applies to closed loop runs, not to rate or replay";
+    }
+    if (!argError.empty()) {
+        std::cerr << "Error: " << argError << "\n";
+        std::cerr << "Please refer to the usage below:\n";
+        std::cerr << Usage(argv[0]);
+        return Status(K_INVALID, "");
+    }
+
     constexpr uint64_t kMaxTotalThreadNum = 128;
     if (clientNum > kMaxTotalThreadNum / threadNum) {
         std::cerr << "Error: client_num * thread_num must be <= " << kMaxTotalThreadNum << "\n";
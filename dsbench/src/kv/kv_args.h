@@ -39,6 +39,15 @@ struct KVArgs : public ArgsBase {
     bool skipLocal;
     bool enableLocalCache;
     std::string dataPlacementPolicy;
+    std::string distribution;
+    double zipfTheta;
+    double hotKeyRatio;
+    double hotOpRatio;
+    uint64_t opNum;
+    double readRatio;
+    uint64_t rate;
+    std::string traceFile;
+    double replaySpeed;
 };
 }  // namespace bench
 }  // namespace datasystem
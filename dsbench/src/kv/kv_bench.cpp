@@ -17,8 +17,10 @@
 #include "kv_bench.h"
 
 #include <algorithm>
+#include <chrono>
 #include <numeric>
 #include <random>
+#include <thread>
 
 #include "datasystem/common/util/net_util.h"
 #include "datasystem/common/util/status_helper.h"
@@ -34,9 +36,18 @@ Status KVBench::WarmUp()
 {
     std::string originalKeyPrefix = args_.keyPrefix;
     uint64_t originalKeyNum = args_.keyNum;
+    std::string originalAction = args_.action;
+    std::string originalDistribution = args_.distribution;
+    uint64_t originalRate = args_.rate;
 
     args_.keyPrefix += "-pre-run";
     args_.keyNum = args_.batchNum;
+    if (UseWorkload()) {
+        // Warm up generated and replayed workloads with one batch of sets instead of running them twice.
+        args_.action = "set";
+        args_.distribution = "sequential";
+        args_.rate = 0;
+    }
 
     auto rc = ParallelRun();
     if (rc.IsError()) {
@@ -46,6 +57,9 @@ Status KVBench::WarmUp()
 
     args_.keyPrefix = originalKeyPrefix;
     args_.keyNum = originalKeyNum;
+    args_.action = originalAction;
+    args_.distribution = originalDistribution;
+    args_.rate = originalRate;
 
     return Status::OK();
 }
@@ -93,6 +107,10 @@ Status KVBench::Prepare()
     CHECK_FAIL_RETURN_STATUS(args_.clientNum > 0, K_INVALID, "client_num must > 0");
     CHECK_FAIL_RETURN_STATUS(args_.threadNum > 0, K_INVALID, "thread_num must > 0");
     auto totalThreadNum = args_.clientNum * args_.threadNum;
+    if (UseWorkload()) {
+        RETURN_IF_NOT_OK(PrepareWorkload(totalThreadNum));
+        return InitClients();
+    }
     std::vector<std::string> keys;
     if (args_.action == "set" || args_.action == "prefill") {
         args_.skipLocal = false;
@@ -125,18 +143,106 @@ Status KVBench::Prepare()
     return InitClients();
 }
 
+bool KVBench::UseWorkload() const
+{
+    return args_.action == "mixed" || args_.action == "replay"
+           || (args_.action != "prefill" && args_.distribution != "sequential");
+}
+
+Status KVBench::PrepareWorkload(uint64_t totalThreadNum)
+{
+    perThreadOps_.clear();
+    perThreadOps_.resize(totalThreadNum);
+    perThreadOpKeyNum_.assign(totalThreadNum, 0);
+    perThreadOpBytes_.assign(totalThreadNum, 0);
+    uint64_t minSize;
+    uint64_t maxSize;
+    RETURN_IF_NOT_OK(StringToBytesRange(args_.keySize, minSize, maxSize));
+    if (args_.action == "replay") {
+        std::vector<TraceOp> ops;
+        uint64_t truncatedNum = 0;
+        RETURN_IF_NOT_OK(LoadAccessTrace(args_.traceFile, ops, truncatedNum));
+        if (truncatedNum > 0) {
+            std::cerr << "WARNING: skipped " << truncatedNum << " of " << ops.size() + truncatedNum
+                      << " requests whose key list was truncated by the access recorder" << std::endl;
+        }
+        maxSize = 0;
+        std::hash<std::string> hasher;
+        for (auto &op : ops) {
+            op.offsetUs = static_cast<uint64_t>(op.offsetUs / args_.replaySpeed);
+            maxSize = std::max(maxSize, op.valueSize);
+            // Requests of the same key stay on one thread so that their order is kept.
+            perThreadOps_[hasher(op.keys.front()) % totalThreadNum].emplace_back(std::move(op));
+        }
+        workloadData_.assign(maxSize, 'a');
+        return Status::OK();
+    }
+
+    CHECK_FAIL_RETURN_STATUS(args_.batchNum > 0, K_INVALID, "batch_num must > 0");
+    TraceOpType writeType;
+    double readRatio;
+    if (args_.action == "get") {
+        writeType = TraceOpType::SET;
+        readRatio = 1;
+    } else if (args_.action == "set" || args_.action == "mixed") {
+        writeType = TraceOpType::SET;
+        readRatio = args_.action == "mixed" ? args_.readRatio : 0;
+    } else if (args_.action == "del") {
+        writeType = TraceOpType::DEL;
+        readRatio = 0;
+    } else {
+        RETURN_STATUS(K_INVALID, "unknown action" + args_.action);
+    }
+    std::vector<std::string> keys;
+    GenerateWorkloadKeys(keys);
+    std::unique_ptr<KeyChooser> chooser;
+    RETURN_IF_NOT_OK(KeyChooser::Create(args_.distribution, keys.size(), args_.zipfTheta, args_.hotKeyRatio,
+                                        args_.hotOpRatio, chooser));
+
+    // Operations are generated up front so that picking keys does not count as latency.
+    const double secToUs = 1'000'000.0;
+    uint64_t opNum = args_.opNum > 0 ? args_.opNum : args_.keyNum;
+    std::random_device rd;
+    for (auto &ops : perThreadOps_) {
+        std::mt19937_64 rng(rd());
+        std::uniform_real_distribution<double> opDist(0.0, 1.0);
+        std::uniform_int_distribution<uint64_t> sizeDist(minSize, maxSize);
+        ops.resize(opNum);
+        for (uint64_t i = 0; i < opNum; i++) {
+            auto &op = ops[i];
+            op.offsetUs = args_.rate > 0 ? static_cast<uint64_t>(i * secToUs / args_.rate) : 0;
+            op.type = opDist(rng) < readRatio ? TraceOpType::GET : writeType;
+            op.valueSize = sizeDist(rng);
+            op.keys.reserve(args_.batchNum);
+            for (uint64_t k = 0; k < args_.batchNum; k++) {
+                op.keys.emplace_back(keys[chooser->Next(rng)]);
+            }
+            // Skewed distributions pick hot keys repeatedly, a batch carries each key once.
+            std::sort(op.keys.begin(), op.keys.end());
+            op.keys.erase(std::unique(op.keys.begin(), op.keys.end()), op.keys.end());
+        }
+    }
+    workloadData_.assign(maxSize, 'a');
+    return Status::OK();
+}
+
+std::string KVBench::MakeKey(int workerIndex, uint64_t index) const
+{
+    std::stringstream ss;
+    ss << args_.keyPrefix;
+    ss << "_s" << workerIndex;
+    ss << "_n" << index;
+    if (!args_.ownerId.empty()) {
+        ss << ";" << args_.ownerId;
+    }
+    return ss.str();
+}
+
 void KVBench::GenerateSetKeys(std::vector<std::string> &keys) const
 {
     keys.reserve(args_.keyNum);
     for (size_t index = 0; index < args_.keyNum; index++) {
-        std::stringstream ss;
-        ss << args_.keyPrefix;
-        ss << "_s" << args_.workerIndex;
-        ss << "_n" << index;
-        if (!args_.ownerId.empty()) {
-            ss << ";" << args_.ownerId;
-        }
-        keys.emplace_back(ss.str());
+        keys.emplace_back(MakeKey(args_.workerIndex, index));
     }
 }
 
@@ -148,14 +254,25 @@ void KVBench::GenerateGetOrDelKeys(std::vector<std::string> &keys) const
             continue;
         }
         for (size_t index = 0; index < args_.keyNum; index++) {
-            std::stringstream ss;
-            ss << args_.keyPrefix;
-            ss << "_s" << sid;
-            ss << "_n" << index;
-            if (!args_.ownerId.empty()) {
-                ss << ";" << args_.ownerId;
+            keys.emplace_back(MakeKey(sid, index));
+        }
+    }
+}
+
+void KVBench::GenerateWorkloadKeys(std::vector<std::string> &keys) const
+{
+    if (args_.workerNum <= 0) {
+        GenerateSetKeys(keys);
+        return;
+    }
+    // Interleave the workers so that the hot head of a skewed distribution spreads over all of them.
+    keys.reserve(args_.keyNum * args_.workerNum);
+    for (size_t index = 0; index < args_.keyNum; index++) {
+        for (int sid = 0; sid < args_.workerNum; sid++) {
+            if (args_.skipLocal && sid == args_.workerIndex) {
+                continue;
             }
-            keys.emplace_back(ss.str());
+            keys.emplace_back(MakeKey(sid, index));
         }
     }
 }
@@ -176,7 +293,9 @@ std::string KVBench::GetBenchCost()
         }
     }
     uint64_t totalKeyNum;
-    if (args_.action == "set" || args_.action == "prefill") {
+    if (UseWorkload()) {
+        totalKeyNum = std::accumulate(perThreadOpKeyNum_.begin(), perThreadOpKeyNum_.end(), uint64_t{ 0 });
+    } else if (args_.action == "set" || args_.action == "prefill") {
         // For set operations, total keys = keyNum (distributed across threads)
         totalKeyNum = args_.keyNum;
     } else if (args_.action == "get") {
@@ -193,12 +312,14 @@ std::string KVBench::GetBenchCost()
         ss << ":empty cost";
         return ss.str();
     }
-    uint64_t valueSize = 1;
-    auto rc = StringToBytes(args_.keySize, valueSize);
+    uint64_t minSize = 1;
+    uint64_t maxSize = 1;
+    auto rc = StringToBytesRange(args_.keySize, minSize, maxSize);
     if (rc.IsError()) {
         ss << "invalid keySize:" << args_.keySize;
         return ss.str();
     }
+    uint64_t valueSize = (minSize + maxSize) / 2;
 
     const uint64_t BYTES_TO_MEGABYTES = 1024 * 1024;
     const double MICROSECONDS_TO_MILLISECONDS = 1000.0;
@@ -207,7 +328,9 @@ std::string KVBench::GetBenchCost()
     const size_t PERCENTILE_100 = 100;
 
     double totalTimeCost = std::accumulate(costVec.begin(), costVec.end(), 0.0);  // MicroSecond
-    uint64_t totalValueSize = totalKeyNum * valueSize;                            // bytes
+    uint64_t totalValueSize = UseWorkload() ? std::accumulate(perThreadOpBytes_.begin(), perThreadOpBytes_.end(),
+                                                              uint64_t{ 0 })
+                                            : totalKeyNum * valueSize;  // bytes
 
     double threadCostSum = std::accumulate(perThreadCost_.begin(), perThreadCost_.end(), 0.0);
     double timeCostPerThread =
@@ -234,7 +357,9 @@ Status KVBench::Run(uint64_t threadIndex, Barrier &barrier)
     CHECK_FAIL_RETURN_STATUS(clientIndex < clients_.size(), K_RUNTIME_ERROR, "client index out of range");
     auto &client = *clients_[clientIndex];
 
-    if (args_.action == "set" || args_.action == "prefill") {
+    if (UseWorkload()) {
+        RETURN_IF_NOT_OK(RunOps(client, threadIndex));
+    } else if (args_.action == "set" || args_.action == "prefill") {
         RETURN_IF_NOT_OK(Set(client, threadIndex));
     } else if (args_.action == "get") {
         RETURN_IF_NOT_OK(Get(client, threadIndex));
@@ -280,15 +405,19 @@ Status KVBench::Set(KVClient &client, uint64_t threadIndex)
         return Status(K_INVALID, "batchNum must be >= 1");
     }
 
-    uint64_t valueSize = 1;
-    RETURN_IF_NOT_OK(StringToBytes(args_.keySize, valueSize));
-    std::string data(valueSize, 'a');
+    uint64_t minSize = 1;
+    uint64_t maxSize = 1;
+    RETURN_IF_NOT_OK(StringToBytesRange(args_.keySize, minSize, maxSize));
+    std::string data(maxSize, 'a');
+    std::mt19937_64 rng{ std::random_device{}() };
+    std::uniform_int_distribution<uint64_t> sizeDist(minSize, maxSize);
     Timer totalTimer;
 
     if (args_.batchNum == 1) {
         for (const auto &key : allKeys) {
+            StringView value(data.data(), sizeDist(rng));
             Timer timer;
-            RETURN_IF_NOT_OK(client.Set(key, data));
+            RETURN_IF_NOT_OK(client.Set(key, value));
             costs.emplace_back(timer.ElapsedMicroSecond());
         }
         perThreadCost_[threadIndex] = totalTimer.ElapsedMicroSecond();
@@ -302,7 +431,7 @@ Status KVBench::Set(KVClient &client, uint64_t threadIndex)
 
     for (const auto &key : allKeys) {
         keys.emplace_back(key);
-        valuesView.emplace_back(data);
+        valuesView.emplace_back(data.data(), sizeDist(rng));
 
         if (keys.size() == args_.batchNum) {
             Timer timer;
@@ -390,5 +519,65 @@ Status KVBench::Del(KVClient &client, uint64_t threadIndex)
     return Status::OK();
 }
 
+Status KVBench::IssueOp(KVClient &client, const TraceOp &op)
+{
+    Status rc;
+    std::vector<std::string> failedKeys;
+    switch (op.type) {
+        case TraceOpType::SET: {
+            std::vector<StringView> values(op.keys.size(), StringView(workloadData_.data(), op.valueSize));
+            rc = op.keys.size() == 1 ? client.Set(op.keys[0], values[0]) : client.MSet(op.keys, values, failedKeys);
+            break;
+        }
+        case TraceOpType::GET: {
+            std::vector<Optional<ReadOnlyBuffer>> readOnlyBuffers;
+            rc = client.Get(op.keys, readOnlyBuffers);
+            break;
+        }
+        case TraceOpType::DEL:
+            rc = client.Del(op.keys, failedKeys);
+            break;
+        case TraceOpType::EXIST: {
+            std::vector<bool> exists;
+            rc = client.Exist(op.keys, exists);
+            break;
+        }
+        default:
+            RETURN_STATUS(K_INVALID, "unknown operation type");
+    }
+    // Misses are part of skewed and replayed workloads, e.g. reading a key that has not been written yet.
+    return rc.GetCode() == K_NOT_FOUND ? Status::OK() : rc;
+}
+
+Status KVBench::RunOps(KVClient &client, uint64_t threadIndex)
+{
+    auto &costs = perThreadCostDetail_[threadIndex];
+    const auto &ops = perThreadOps_[threadIndex];
+    // In open loop mode latency counts from the intended start time, so a stalled request also charges the queueing
+    // delay of the requests scheduled behind it.
+    bool openLoop = args_.rate > 0 || args_.action == "replay";
+    uint64_t keyNum = 0;
+    uint64_t bytes = 0;
+    costs.reserve(ops.size());
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &op : ops) {
+        auto intended = std::chrono::steady_clock::now();
+        if (openLoop) {
+            intended = start + std::chrono::microseconds(op.offsetUs);
+            std::this_thread::sleep_until(intended);
+        }
+        RETURN_IF_NOT_OK(IssueOp(client, op));
+        auto end = std::chrono::steady_clock::now();
+        costs.emplace_back(std::chrono::duration_cast<std::chrono::microseconds>(end - intended).count());
+        keyNum += op.keys.size();
+        bytes += op.type == TraceOpType::SET || op.type == TraceOpType::GET ? op.valueSize * op.keys.size() : 0;
+    }
+    perThreadCost_[threadIndex] =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    perThreadOpKeyNum_[threadIndex] = keyNum;
+    perThreadOpBytes_[threadIndex] = bytes;
+    return Status::OK();
+}
+
 }  // namespace bench
 }  // namespace datasystem
@@ -24,6 +24,7 @@
 #include "datasystem/kv_client.h"
 #include "datasystem/utils/status.h"
 #include "kv_args.h"
+#include "kv_workload.h"
 
 namespace datasystem {
 
@@ -50,10 +51,21 @@ protected:
     Status Set(KVClient &client, uint64_t threadIndex);
     Status Get(KVClient &client, uint64_t threadIndex);
     Status Del(KVClient &client, uint64_t threadIndex);
+    Status RunOps(KVClient &client, uint64_t threadIndex);
+    Status IssueOp(KVClient &client, const TraceOp &op);
 
 private:
+    // Whether the run issues generated or replayed operations instead of touching every key once.
+    bool UseWorkload() const;
+    Status PrepareWorkload(uint64_t totalThreadNum);
+    std::string MakeKey(int workerIndex, uint64_t index) const;
     void GenerateSetKeys(std::vector<std::string> &keys) const;
     void GenerateGetOrDelKeys(std::vector<std::string> &keys) const;
+    void GenerateWorkloadKeys(std::vector<std::string> &keys) const;
+    std::vector<std::vector<TraceOp>> perThreadOps_;
+    std::vector<uint64_t> perThreadOpKeyNum_;
+    std::vector<uint64_t> perThreadOpBytes_;
+    std::string workloadData_;
     std::vector<std::vector<std::string>> perThreadKeys_;
     std::vector<std::unique_ptr<KVClient>> clients_;
     KVArgs &args_;
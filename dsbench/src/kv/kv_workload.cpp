@@ -0,0 +1,279 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Key popularity distributions and access trace loading for the kv benchmark.
+ */
+#include "kv_workload.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#include "datasystem/common/util/status_helper.h"
+#include "utils.h"
+
+namespace datasystem {
+namespace bench {
+namespace {
+class UniformKeyChooser : public KeyChooser {
+public:
+    explicit UniformKeyChooser(uint64_t keyNum) : keyNum_(keyNum)
+    {
+    }
+
+    uint64_t Next(std::mt19937_64 &rng) const override
+    {
+        std::uniform_int_distribution<uint64_t> dist(0, keyNum_ - 1);
+        return dist(rng);
+    }
+
+private:
+    uint64_t keyNum_;
+};
+
+// Gray et al. "Quickly generating billion-record synthetic databases", as used by YCSB.
+class ZipfianKeyChooser : public KeyChooser {
+public:
+    ZipfianKeyChooser(uint64_t keyNum, double theta, bool reverse)
+        : keyNum_(keyNum), theta_(theta), reverse_(reverse)
+    {
+        for (uint64_t i = 1; i <= keyNum_; i++) {
+            zetaN_ += 1.0 / std::pow(static_cast<double>(i), theta_);
+        }
+        double zeta2 = 1.0 + 1.0 / std::pow(2.0, theta_);
+        alpha_ = 1.0 / (1.0 - theta_);
+        eta_ = (1.0 - std::pow(2.0 / keyNum_, 1.0 - theta_)) / (1.0 - zeta2 / zetaN_);
+        secondThreshold_ = 1.0 + std::pow(0.5, theta_);
+    }
+
+    uint64_t Next(std::mt19937_64 &rng) const override
+    {
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        double u = dist(rng);
+        double uz = u * zetaN_;
+        uint64_t index;
+        if (uz < 1.0) {
+            index = 0;
+        } else if (uz < secondThreshold_) {
+            index = 1;
+        } else {
+            index = static_cast<uint64_t>(keyNum_ * std::pow(eta_ * u - eta_ + 1.0, alpha_));
+        }
+        index = std::min(index, keyNum_ - 1);
+        return reverse_ ? keyNum_ - 1 - index : index;
+    }
+
+private:
+    uint64_t keyNum_;
+    double theta_;
+    bool reverse_;
+    double zetaN_ = 0;
+    double alpha_ = 0;
+    double eta_ = 0;
+    double secondThreshold_ = 0;
+};
+
+class HotspotKeyChooser : public KeyChooser {
+public:
+    HotspotKeyChooser(uint64_t keyNum, double hotKeyRatio, double hotOpRatio) : hotOpRatio_(hotOpRatio)
+    {
+        hotKeyNum_ = std::max<uint64_t>(1, std::min<uint64_t>(keyNum, keyNum * hotKeyRatio));
+        coldKeyNum_ = keyNum - hotKeyNum_;
+    }
+
+    uint64_t Next(std::mt19937_64 &rng) const override
+    {
+        std::uniform_real_distribution<double> opDist(0.0, 1.0);
+        if (coldKeyNum_ == 0 || opDist(rng) < hotOpRatio_) {
+            std::uniform_int_distribution<uint64_t> hotDist(0, hotKeyNum_ - 1);
+            return hotDist(rng);
+        }
+        std::uniform_int_distribution<uint64_t> coldDist(0, coldKeyNum_ - 1);
+        return hotKeyNum_ + coldDist(rng);
+    }
+
+private:
+    double hotOpRatio_;
+    uint64_t hotKeyNum_;
+    uint64_t coldKeyNum_;
+};
+
+const std::string FIELD_SEPARATOR = " | ";
+const std::string OBJECT_KEY_PARAM = "Object_key:";
+
+const std::unordered_map<std::string, TraceOpType> TRACE_HANDLES = {
+    { "DS_KV_CLIENT_SET", TraceOpType::SET },      { "DS_KV_CLIENT_MSET", TraceOpType::SET },
+    { "DS_KV_CLIENT_MSETNX", TraceOpType::SET },   { "DS_KV_CLIENT_GET", TraceOpType::GET },
+    { "DS_KV_CLIENT_DELETE", TraceOpType::DEL },   { "DS_KV_CLIENT_EXIST", TraceOpType::EXIST },
+};
+
+std::vector<std::string> SplitFields(const std::string &line)
+{
+    std::vector<std::string> fields;
+    size_t start = 0;
+    while (true) {
+        auto pos = line.find(FIELD_SEPARATOR, start);
+        if (pos == std::string::npos) {
+            fields.emplace_back(line.substr(start));
+            return fields;
+        }
+        fields.emplace_back(line.substr(start, pos - start));
+        start = pos + FIELD_SEPARATOR.size();
+    }
+}
+
+// Parse "YYYY-MM-DDTHH:MM:SS.uuuuuu" into microseconds since epoch, only deltas between lines matter.
+bool ParseTimestampUs(const std::string &str, uint64_t &timestampUs)
+{
+    std::tm tm{};
+    int micro = 0;
+    const int fieldNum = 7;
+    const int yearBase = 1900;
+    if (sscanf(str.c_str(), "%d-%d-%dT%d:%d:%d.%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &tm.tm_hour, &tm.tm_min,
+               &tm.tm_sec, &micro)
+        != fieldNum) {
+        return false;
+    }
+    tm.tm_year -= yearBase;
+    tm.tm_mon -= 1;
+    const uint64_t secToUs = 1'000'000;
+    timestampUs = static_cast<uint64_t>(timegm(&tm)) * secToUs + micro;
+    return true;
+}
+
+// Keys are logged as "Object_key:key" or "Object_key:[k1,k2,***,total:N]"; a truncated list has fewer keys than N.
+bool ParseKeys(const std::string &req, std::vector<std::string> &keys, uint64_t &totalKeyNum)
+{
+    auto pos = req.find(OBJECT_KEY_PARAM);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    pos += OBJECT_KEY_PARAM.size();
+    if (pos < req.size() && req[pos] == '[') {
+        auto end = req.find(']', pos);
+        if (end == std::string::npos) {
+            return false;
+        }
+        std::stringstream ss(req.substr(pos + 1, end - pos - 1));
+        std::string key;
+        const std::string totalPrefix = "total:";
+        while (std::getline(ss, key, ',')) {
+            if (key.rfind(totalPrefix, 0) == 0) {
+                (void)StrToInt(key.substr(totalPrefix.size()), totalKeyNum);
+            } else if (!key.empty() && key != "***") {
+                keys.emplace_back(key);
+            }
+        }
+    } else {
+        auto end = req.find_first_of(",}", pos);
+        keys.emplace_back(req.substr(pos, end == std::string::npos ? std::string::npos : end - pos));
+    }
+    totalKeyNum = std::max<uint64_t>(totalKeyNum, keys.size());
+    return !keys.empty() && !keys.front().empty();
+}
+
+bool ParseTraceLine(const std::string &line, uint64_t &issueUs, TraceOp &op, bool &truncated)
+{
+    truncated = false;
+    auto fields = SplitFields(line);
+    // The handle name is followed by elapsed time, data size and request params.
+    const size_t tailFieldNum = 3;
+    for (size_t i = 1; i + tailFieldNum < fields.size(); i++) {
+        auto iter = TRACE_HANDLES.find(fields[i]);
+        if (iter == TRACE_HANDLES.end()) {
+            continue;
+        }
+        uint64_t completeUs;
+        uint64_t elapsedUs;
+        uint64_t dataSize = 0;
+        uint64_t totalKeyNum = 0;
+        if (!ParseTimestampUs(fields[0], completeUs) || StrToInt(fields[i + 1], elapsedUs).IsError()
+            || !ParseKeys(fields[i + 3], op.keys, totalKeyNum)) {
+            return false;
+        }
+        // Replaying a subset of the keys would change the request, so the caller skips and counts it instead.
+        if (op.keys.size() < totalKeyNum) {
+            truncated = true;
+            return false;
+        }
+        (void)StrToInt(fields[i + 2], dataSize);
+        op.type = iter->second;
+        op.valueSize = std::max<uint64_t>(1, dataSize / totalKeyNum);
+        issueUs = completeUs > elapsedUs ? completeUs - elapsedUs : 0;
+        return true;
+    }
+    return false;
+}
+}  // namespace
+
+Status KeyChooser::Create(const std::string &distribution, uint64_t keyNum, double zipfTheta, double hotKeyRatio,
+                          double hotOpRatio, std::unique_ptr<KeyChooser> &chooser)
+{
+    CHECK_FAIL_RETURN_STATUS(keyNum > 0, K_INVALID, "key number must > 0");
+    if (distribution == "uniform") {
+        chooser = std::make_unique<UniformKeyChooser>(keyNum);
+    } else if (distribution == "zipfian" || distribution == "latest") {
+        CHECK_FAIL_RETURN_STATUS(zipfTheta > 0 && zipfTheta < 1, K_INVALID, "zipf_theta must be in (0, 1)");
+        chooser = std::make_unique<ZipfianKeyChooser>(keyNum, zipfTheta, distribution == "latest");
+    } else if (distribution == "hotspot") {
+        CHECK_FAIL_RETURN_STATUS(hotKeyRatio > 0 && hotKeyRatio <= 1, K_INVALID, "hot_key_ratio must be in (0, 1]");
+        CHECK_FAIL_RETURN_STATUS(hotOpRatio >= 0 && hotOpRatio <= 1, K_INVALID, "hot_op_ratio must be in [0, 1]");
+        chooser = std::make_unique<HotspotKeyChooser>(keyNum, hotKeyRatio, hotOpRatio);
+    } else {
+        RETURN_STATUS(K_INVALID, "unknown distribution " + distribution);
+    }
+    return Status::OK();
+}
+
+Status LoadAccessTrace(const std::string &path, std::vector<TraceOp> &ops, uint64_t &truncatedNum)
+{
+    truncatedNum = 0;
+    std::ifstream in(path);
+    CHECK_FAIL_RETURN_STATUS(in.is_open(), K_INVALID, "Failed to open trace file " + path);
+    std::vector<std::pair<uint64_t, TraceOp>> timedOps;
+    std::string line;
+    while (std::getline(in, line)) {
+        uint64_t issueUs;
+        TraceOp op;
+        bool truncated = false;
+        if (ParseTraceLine(line, issueUs, op, truncated)) {
+            timedOps.emplace_back(issueUs, std::move(op));
+        } else if (truncated) {
+            truncatedNum++;
+        }
+    }
+    CHECK_FAIL_RETURN_STATUS(!timedOps.empty(), K_INVALID,
+                             FormatString("No replayable kv client request found in trace file %s, %lu requests have "
+                                          "a truncated key list",
+                                          path, truncatedNum));
+    std::stable_sort(timedOps.begin(), timedOps.end(),
+                     [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+    auto firstUs = timedOps.front().first;
+    ops.clear();
+    ops.reserve(timedOps.size());
+    for (auto &timedOp : timedOps) {
+        timedOp.second.offsetUs = timedOp.first - firstUs;
+        ops.emplace_back(std::move(timedOp.second));
+    }
+    return Status::OK();
+}
+}  // namespace bench
+}  // namespace datasystem
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Key popularity distributions and access trace loading for the kv benchmark.
+ */
+#ifndef KV_WORKLOAD_H
+#define KV_WORKLOAD_H
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "datasystem/utils/status.h"
+
+namespace datasystem {
+namespace bench {
+/*
+ * Picks key indexes in [0, keyNum) following a popularity distribution:
+ *   uniform: every key is equally likely.
+ *   zipfian: index i is picked with probability proportional to 1 / (i + 1)^theta.
+ *   hotspot: hotOpRatio of the operations go to the first hotKeyRatio of the keys.
+ *   latest:  zipfian over the keys counted backwards, so the most recently written keys are the hottest.
+ */
+class KeyChooser {
+public:
+    static Status Create(const std::string &distribution, uint64_t keyNum, double zipfTheta, double hotKeyRatio,
+                         double hotOpRatio, std::unique_ptr<KeyChooser> &chooser);
+
+    virtual ~KeyChooser() = default;
+
+    /**
+     * @brief Pick the next key index.
+     * @param[in] rng The random engine of the calling thread.
+     * @return The key index in [0, keyNum).
+     */
+    virtual uint64_t Next(std::mt19937_64 &rng) const = 0;
+};
+
+enum class TraceOpType : int {
+    SET = 0,
+    GET = 1,
+    DEL = 2,
+    EXIST = 3,
+};
+
+struct TraceOp {
+    uint64_t offsetUs = 0;  // Issue time relative to the first request of the trace.
+    TraceOpType type = TraceOpType::GET;
+    std::vector<std::string> keys;
+    uint64_t valueSize = 0;  // Per key value size of set requests.
+};
+
+/**
+ * @brief Load the kv client requests from access recorder logs. A request is issued at its completion timestamp
+ *        minus its elapsed time; lines of other handles and unparsable lines are skipped.
+ * @param[in] path The access log path.
+ * @param[out] ops The requests sorted by issue time.
+ * @param[out] truncatedNum The number of requests skipped because the recorder truncated their key list.
+ * @return K_OK on success; the error code otherwise.
+ */
+Status LoadAccessTrace(const std::string &path, std::vector<TraceOp> &ops, uint64_t &truncatedNum);
+}  // namespace bench
+}  // namespace datasystem
+#endif
@@ -0,0 +1,263 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: HDR style latency histogram of the benchmark.
+ */
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace datasystem {
+namespace bench {
+namespace {
+constexpr int SIGNIFICANT_DIGITS = 3;
+// 2 * 10^3 values need 11 bits to keep single unit resolution.
+constexpr int SUB_BUCKET_COUNT_MAGNITUDE = 11;
+constexpr int SUB_BUCKET_HALF_COUNT_MAGNITUDE = SUB_BUCKET_COUNT_MAGNITUDE - 1;
+constexpr uint64_t SUB_BUCKET_COUNT = 1ul << SUB_BUCKET_COUNT_MAGNITUDE;
+constexpr uint64_t SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+constexpr uint64_t SUB_BUCKET_MASK = SUB_BUCKET_COUNT - 1;
+constexpr uint64_t HIGHEST_TRACKABLE_VALUE = 3600ul * 1000 * 1000;
+constexpr int TICKS_PER_HALF_DISTANCE = 5;
+constexpr double PERCENT = 100.0;
+
+size_t CountsLength()
+{
+    uint64_t smallestUntrackableValue = SUB_BUCKET_COUNT;
+    size_t bucketCount = 1;
+    while (smallestUntrackableValue <= HIGHEST_TRACKABLE_VALUE) {
+        smallestUntrackableValue <<= 1;
+        bucketCount++;
+    }
+    return (bucketCount + 1) * SUB_BUCKET_HALF_COUNT;
+}
+
+int BucketIndex(uint64_t value)
+{
+    const int bitsOfUint64 = 64;
+    int pow2Ceiling = bitsOfUint64 - __builtin_clzll(value | SUB_BUCKET_MASK);
+    return pow2Ceiling - SUB_BUCKET_COUNT_MAGNITUDE;
+}
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() : counts_(CountsLength(), 0)
+{
+}
+
+size_t LatencyHistogram::CountsIndex(uint64_t value) const
+{
+    auto bucketIndex = BucketIndex(value);
+    auto subBucketIndex = value >> bucketIndex;
+    return (static_cast<size_t>(bucketIndex + 1) << SUB_BUCKET_HALF_COUNT_MAGNITUDE) + subBucketIndex
+           - SUB_BUCKET_HALF_COUNT;
+}
+
+uint64_t LatencyHistogram::ValueFromIndex(size_t index) const
+{
+    int bucketIndex = static_cast<int>(index >> SUB_BUCKET_HALF_COUNT_MAGNITUDE) - 1;
+    uint64_t subBucketIndex = (index & (SUB_BUCKET_HALF_COUNT - 1)) + SUB_BUCKET_HALF_COUNT;
+    if (bucketIndex < 0) {
+        subBucketIndex -= SUB_BUCKET_HALF_COUNT;
+        bucketIndex = 0;
+    }
+    return subBucketIndex << bucketIndex;
+}
+
+uint64_t LatencyHistogram::HighestEquivalentValue(uint64_t value) const
+{
+    auto bucketIndex = BucketIndex(value);
+    return ((value >> bucketIndex) << bucketIndex) + (1ul << bucketIndex) - 1;
+}
+
+void LatencyHistogram::Record(uint64_t value, uint64_t count)
+{
+    counts_[CountsIndex(std::min(value, HIGHEST_TRACKABLE_VALUE))] += count;
+    totalCount_ += count;
+}
+
+void LatencyHistogram::RecordCorrected(uint64_t value, uint64_t expectedIntervalUs)
+{
+    Record(value);
+    if (expectedIntervalUs == 0 || value <= expectedIntervalUs) {
+        return;
+    }
+    for (uint64_t missingValue = value - expectedIntervalUs; missingValue >= expectedIntervalUs;
+         missingValue -= expectedIntervalUs) {
+        Record(missingValue);
+    }
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram &other)
+{
+    for (size_t i = 0; i < counts_.size(); i++) {
+        counts_[i] += other.counts_[i];
+    }
+    totalCount_ += other.totalCount_;
+}
+
+uint64_t LatencyHistogram::ValueAtPercentile(double percentile) const
+{
+    if (totalCount_ == 0) {
+        return 0;
+    }
+    percentile = std::min(std::max(percentile, 0.0), PERCENT);
+    auto countAtPercentile =
+        std::max<uint64_t>(1, static_cast<uint64_t>(percentile / PERCENT * totalCount_ + 0.5));  // round half up
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < counts_.size(); i++) {
+        cumulative += counts_[i];
+        if (cumulative >= countAtPercentile) {
+            return HighestEquivalentValue(ValueFromIndex(i));
+        }
+    }
+    return 0;
+}
+
+uint64_t LatencyHistogram::Min() const
+{
+    for (size_t i = 0; i < counts_.size(); i++) {
+        if (counts_[i] > 0) {
+            return ValueFromIndex(i);
+        }
+    }
+    return 0;
+}
+
+uint64_t LatencyHistogram::Max() const
+{
+    for (size_t i = counts_.size(); i > 0; i--) {
+        if (counts_[i - 1] > 0) {
+            return HighestEquivalentValue(ValueFromIndex(i - 1));
+        }
+    }
+    return 0;
+}
+
+double LatencyHistogram::Mean() const
+{
+    if (totalCount_ == 0) {
+        return 0;
+    }
+    double total = 0;
+    for (size_t i = 0; i < counts_.size(); i++) {
+        if (counts_[i] > 0) {
+            auto lowest = ValueFromIndex(i);
+            total += (lowest + HighestEquivalentValue(lowest)) / 2.0 * counts_[i];
+        }
+    }
+    return total / totalCount_;
+}
+
+double LatencyHistogram::StdDeviation() const
+{
+    if (totalCount_ == 0) {
+        return 0;
+    }
+    double mean = Mean();
+    double geometricDeviationTotal = 0;
+    for (size_t i = 0; i < counts_.size(); i++) {
+        if (counts_[i] > 0) {
+            auto lowest = ValueFromIndex(i);
+            double deviation = (lowest + HighestEquivalentValue(lowest)) / 2.0 - mean;
+            geometricDeviationTotal += deviation * deviation * counts_[i];
+        }
+    }
+    return std::sqrt(geometricDeviationTotal / totalCount_);
+}
+
+std::string LatencyHistogram::PercentileDistribution(double outputScale) const
+{
+    std::string out;
+    const size_t lineSize = 128;
+    char line[lineSize];
+    (void)snprintf(line, lineSize, "%12s %14s %10s %14s\n\n", "Value", "Percentile", "TotalCount",
+                   "1/(1-Percentile)");
+    out.append(line);
+    // Report ticksPerHalfDistance percentile levels each time the distance to 100% halves, like HdrHistogram.
+    double level = 0;
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < counts_.size() && totalCount_ > 0; i++) {
+        if (counts_[i] == 0) {
+            continue;
+        }
+        cumulative += counts_[i];
+        double value = HighestEquivalentValue(ValueFromIndex(i)) / outputScale;
+        if (cumulative == totalCount_) {
+            (void)snprintf(line, lineSize, "%12.3f %1.12f %10lu\n", value, 1.0, cumulative);
+            out.append(line);
+            break;
+        }
+        double current = PERCENT * cumulative / totalCount_;
+        while (level <= current) {
+            (void)snprintf(line, lineSize, "%12.3f %1.12f %10lu %14.2f\n", value, level / PERCENT, cumulative,
+                           1.0 / (1.0 - level / PERCENT));
+            out.append(line);
+            double halfDistance = std::floor(std::log2(PERCENT / (PERCENT - level))) + 1;
+            level += PERCENT / (TICKS_PER_HALF_DISTANCE * std::pow(2.0, halfDistance));
+        }
+    }
+    (void)snprintf(line, lineSize, "#[Mean    = %12.3f, StdDeviation   = %12.3f]\n", Mean() / outputScale,
+                   StdDeviation() / outputScale);
+    out.append(line);
+    (void)snprintf(line, lineSize, "#[Max     = %12.3f, Total count    = %12lu]\n", Max() / outputScale, totalCount_);
+    out.append(line);
+    (void)snprintf(line, lineSize, "#[Buckets = %12zu, SubBuckets     = %12lu]\n",
+                   counts_.size() / SUB_BUCKET_HALF_COUNT - 1, SUB_BUCKET_COUNT);
+    out.append(line);
+    return out;
+}
+
+nlohmann::json LatencyHistogram::ToJson() const
+{
+    nlohmann::json counts = nlohmann::json::array();
+    for (size_t i = 0; i < counts_.size(); i++) {
+        if (counts_[i] > 0) {
+            counts.push_back({ i, counts_[i] });
+        }
+    }
+    return { { "unit", "us" },
+             { "significant_digits", SIGNIFICANT_DIGITS },
+             { "highest_trackable_value", HIGHEST_TRACKABLE_VALUE },
+             { "counts", std::move(counts) } };
+}
+
+Status LatencyHistogram::FromJson(const nlohmann::json &json, LatencyHistogram &histogram)
+{
+    try {
+        if (json.at("significant_digits").get<int>() != SIGNIFICANT_DIGITS
+            || json.at("highest_trackable_value").get<uint64_t>() != HIGHEST_TRACKABLE_VALUE) {
+            return Status(K_INVALID, "Histogram layout mismatch");
+        }
+        histogram = LatencyHistogram();
+        for (const auto &entry : json.at("counts")) {
+            auto index = entry.at(0).get<size_t>();
+            if (index >= histogram.counts_.size()) {
+                return Status(K_INVALID, "Histogram index out of range: " + std::to_string(index));
+            }
+            auto count = entry.at(1).get<uint64_t>();
+            histogram.counts_[index] += count;
+            histogram.totalCount_ += count;
+        }
+    } catch (const nlohmann::json::exception &e) {
+        return Status(K_INVALID, std::string("Malformed histogram: ") + e.what());
+    }
+    return Status::OK();
+}
+}  // namespace bench
+}  // namespace datasystem
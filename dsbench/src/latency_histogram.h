@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: HDR style latency histogram of the benchmark.
+ */
+#ifndef BENCH_LATENCY_HISTOGRAM_H
+#define BENCH_LATENCY_HISTOGRAM_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "datasystem/utils/status.h"
+
+namespace datasystem {
+namespace bench {
+/*
+ * Log-linear histogram with the bucket layout of HdrHistogram: values are kept with 3 significant decimal digits
+ * from 1 up to one hour in microseconds, so memory is fixed no matter how many samples are recorded. Histograms of
+ * different threads or runs have the same layout and merge by adding the counts.
+ */
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    ~LatencyHistogram() = default;
+
+    /**
+     * @brief Record a value, values above the trackable range are clamped.
+     * @param[in] value The value in microseconds.
+     * @param[in] count The number of times the value is recorded.
+     */
+    void Record(uint64_t value, uint64_t count = 1);
+
+    /**
+     * @brief Record a value of a closed loop run and back-fill the samples that a stall kept from being issued, as
+     *        HdrHistogram's recordValueWithExpectedInterval does, to correct coordinated omission.
+     * @param[in] value The value in microseconds.
+     * @param[in] expectedIntervalUs The expected interval between two requests, 0 to disable the correction.
+     */
+    void RecordCorrected(uint64_t value, uint64_t expectedIntervalUs);
+
+    /**
+     * @brief Add the counts of another histogram.
+     * @param[in] other The histogram to merge.
+     */
+    void Merge(const LatencyHistogram &other);
+
+    /**
+     * @brief Get the value at a percentile.
+     * @param[in] percentile The percentile in [0, 100].
+     * @return The highest value equivalent to the percentile, 0 if the histogram is empty.
+     */
+    uint64_t ValueAtPercentile(double percentile) const;
+
+    uint64_t Count() const
+    {
+        return totalCount_;
+    }
+
+    uint64_t Min() const;
+
+    uint64_t Max() const;
+
+    double Mean() const;
+
+    double StdDeviation() const;
+
+    /**
+     * @brief Format the percentile distribution in the .hgrm text format of HdrHistogram.
+     * @param[in] outputScale The divisor applied to the values, e.g. 1000 to print milliseconds.
+     * @return The percentile distribution.
+     */
+    std::string PercentileDistribution(double outputScale) const;
+
+    /**
+     * @brief Serialize the non-zero counts with the layout so that the histogram can be merged later.
+     * @return The json object.
+     */
+    nlohmann::json ToJson() const;
+
+    /**
+     * @brief Load a histogram serialized by ToJson.
+     * @param[in] json The json object.
+     * @param[out] histogram The histogram.
+     * @return K_OK on success; K_INVALID if the json is malformed or has another layout.
+     */
+    static Status FromJson(const nlohmann::json &json, LatencyHistogram &histogram);
+
+private:
+    size_t CountsIndex(uint64_t value) const;
+    uint64_t ValueFromIndex(size_t index) const;
+    uint64_t HighestEquivalentValue(uint64_t value) const;
+
+    std::vector<uint64_t> counts_;
+    uint64_t totalCount_ = 0;
+};
+}  // namespace bench
+}  // namespace datasystem
+#endif
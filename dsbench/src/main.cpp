@@ -19,6 +19,8 @@
 
 #include "args_base.h"
 #include "bench_base.h"
+#include "bench_result.h"
+#include "compare/compare_args.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/utils/status.h"
 
@@ -35,6 +37,14 @@ Status BenchMain(int argc, char **argv)
     if (shouldExit) {
         return Status::OK();
     }
+    if (args->command == "compare") {
+        auto &compareArgs = static_cast<CompareArgs &>(*args);
+        BenchResult baseResult;
+        BenchResult newResult;
+        RETURN_IF_NOT_OK(LoadBenchResults(compareArgs.baseFiles, baseResult));
+        RETURN_IF_NOT_OK(LoadBenchResults(compareArgs.newFiles, newResult));
+        return CompareBenchResults(baseResult, newResult, compareArgs.thresholdPercent);
+    }
     RETURN_IF_NOT_OK(BenchBase::Create(args, bench));
     return bench->Start();
 }
@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "object/object_args.h"
+
+#include <getopt.h>
+#include <iostream>
+#include <sstream>
+
+#include "datasystem/utils/status.h"
+#include "utils.h"
+
+namespace datasystem {
+namespace bench {
+ObjectArgs::ObjectArgs(const std::string &command)
+    : ArgsBase(command),
+      keyPrefix("BenchObj"),
+      keyNum(1),
+      keySize("1KB"),
+      minKeySize(0),
+      maxKeySize(0),
+      batchNum(1),
+      nestedNum(1),
+      loopNum(100)
+{
+}
+
+std::string ObjectArgs::Usage(const std::string &argv0)
+{
+    std::stringstream ss;
+    ss << "Usage:" << argv0 << " object [options]\n";
+    ss << "Options:\n";
+    ss << "  -a --action          action put/get/nested/ref\n";
+    ss << "                         put:    Put objects\n";
+    ss << "                         get:    Get objects put before the timed run\n";
+    ss << "                         nested: Put objects that each reference nested_num nested objects\n";
+    ss << "                         ref:    GIncreaseRef/GDecreaseRef storm on num objects shared by all threads\n";
+    ss << "  -w --worker_address  worker address\n";
+    ss << "  -p --prefix          the object key prefix\n";
+    ss << "  -c --client_num      Client number per benchmark process, default 1\n";
+    ss << "  -n --num             Object number per thread (shared by all threads for ref), default 1\n";
+    ss << "  -s --size            Object size, n/nB/nKB/nMB/nGB or a uniform range like 1KB-1MB, default 1KB\n";
+    ss << "  -t --thread_num      Thread number per client, default 1\n";
+    ss << "  -b --batch_num       Batch number per Get/GIncreaseRef/GDecreaseRef, default 1\n";
+    ss << "  -N --nested_num      Nested object number per object for nested, default 1\n";
+    ss << "  -l --loop_num        GIncreaseRef/GDecreaseRef rounds per thread for ref, default 100\n";
+    ss << "  -f --perf_path       The perf point path\n";
+    ss << "  -P --perf_workers    Get or reset perf point for those workers, also the source of the master busy\n";
+    ss << "                       time (handler time summed from perf points, not process CPU time)\n";
+    ss << "  -k --access_key      Access key for authentication\n";
+    ss << "  -K --secret_key      Secret key for authentication\n";
+    ss << CommonUsage();
+    ss << "  -h                   Show help\n";
+    return ss.str();
+}
+
+std::string ObjectArgs::ToString()
+{
+    std::stringstream ss;
+    ss << "  -a --action:         " << action << "\n";
+    ss << "  -w --worker_address: " << workerAddress << "\n";
+    ss << "  -p --prefix:         " << keyPrefix << "\n";
+    ss << "  -c --client_num:     " << clientNum << "\n";
+    ss << "  -n --num:            " << keyNum << "\n";
+    ss << "  -s --size:           " << keySize << "\n";
+    ss << "  -t --thread_num:     " << threadNum << "\n";
+    ss << "  -b --batch_num:      " << batchNum << "\n";
+    ss << "  -N --nested_num:     " << nestedNum << "\n";
+    ss << "  -l --loop_num:       " << loopNum << "\n";
+    ss << "  -f --perf_path:      " << perfPath << "\n";
+    ss << "  -P --perf_workers:   " << perfWorkers;
+    return ss.str();
+}
+
+Status ObjectArgs::Parse(int argc, char *argv[])
+{
+    // clang-format off
+    static const struct option longOptions[] = {
+        { "action", required_argument, nullptr, 'a' },       { "worker_address", required_argument, nullptr, 'w' },
+        { "prefix", required_argument, nullptr, 'p' },       { "client_num", required_argument, nullptr, 'c' },
+        { "num", required_argument, nullptr, 'n' },          { "size", required_argument, nullptr, 's' },
+        { "thread_num", required_argument, nullptr, 't' },   { "batch_num", required_argument, nullptr, 'b' },
+        { "nested_num", required_argument, nullptr, 'N' },   { "loop_num", required_argument, nullptr, 'l' },
+        { "perf_path", required_argument, nullptr, 'f' },    { "perf_workers", required_argument, nullptr, 'P' },
+        { "access_key", required_argument, nullptr, 'k' },   { "secret_key", required_argument, nullptr, 'K' },
+        COMMON_LONG_OPTIONS,
+        { "help", no_argument, nullptr, 'h' }
+    };
+    // clang-format on
+    while (true) {
+        auto c = getopt_long(argc - 1, argv + 1, "ha:w:p:c:n:s:t:b:N:l:f:P:k:K:", longOptions, nullptr);
+        if (c == -1) {
+            break;
+        }
+        Status rc = Status::OK();
+        switch (c) {
+            case 'a':
+                action = optarg;
+                if (action != "put" && action != "get" && action != "nested" && action != "ref") {
+                    rc = Status(K_INVALID, "action must be put, get, nested or ref");
+                }
+                break;
+            case 'w':
+                workerAddress = optarg;
+                break;
+            case 'p':
+                keyPrefix = optarg;
+                break;
+            case 'c':
+                rc = StrToInt(optarg, clientNum);
+                break;
+            case 'n':
+                rc = StrToInt(optarg, keyNum);
+                break;
+            case 's':
+                keySize = optarg;
+                break;
+            case 't':
+                rc = StrToInt(optarg, threadNum);
+                break;
+            case 'b':
+                rc = StrToInt(optarg, batchNum);
+                break;
+            case 'N':
+                rc = StrToInt(optarg, nestedNum);
+                break;
+            case 'l':
+                rc = StrToInt(optarg, loopNum);
+                break;
+            case 'f':
+                perfPath = optarg;
+                break;
+            case 'P':
+                perfWorkers = optarg;
+                break;
+            case 'k':
+                accessKey = optarg;
+                break;
+            case 'K':
+                secretKey = optarg;
+                break;
+            case RESULT_FILE_OPTION:
+            case HDR_FILE_OPTION:
+            case EXPECTED_INTERVAL_OPTION:
+                rc = ParseCommonOption(c, optarg);
+                break;
+            default:
+                std::cout << Usage(argv[0]);
+                return Status(K_INVALID, "");
+        }
+        if (rc.IsError()) {
+            std::cerr << "Error: Invalid argument value - " << rc.GetMsg() << "\n";
+            std::cerr << "Please refer to the usage below:\n";
+            std::cerr << Usage(argv[0]);
+            return Status(K_INVALID, "");
+        }
+    }
+
+    auto invalid = [this, &argv](const std::string &msg) {
+        std::cerr << "Error: " << msg << "\n";
+        std::cerr << "Please refer to the usage below:\n";
+        std::cerr << Usage(argv[0]);
+        return Status(K_INVALID, "");
+    };
+    if (action.empty()) {
+        return invalid("action cannot be empty");
+    }
+    if (workerAddress.empty()) {
+        return invalid("workerAddress cannot be empty");
+    }
+    if (clientNum == 0 || threadNum == 0 || keyNum == 0 || batchNum == 0 || loopNum == 0) {
+        return invalid("client_num, thread_num, num, batch_num and loop_num must be greater than 0");
+    }
+    constexpr uint64_t kMaxTotalThreadNum = 128;
+    if (clientNum > kMaxTotalThreadNum / threadNum) {
+        return invalid("client_num * thread_num must be <= " + std::to_string(kMaxTotalThreadNum));
+    }
+    Status rc = StringToBytesRange(keySize, minKeySize, maxKeySize);
+    if (rc.IsError() || minKeySize == 0) {
+        return invalid("invalid size " + keySize);
+    }
+    return Status::OK();
+}
+}  // namespace bench
+}  // namespace datasystem
@@ -0,0 +1,327 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "object/object_bench.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include "datasystem/common/util/status_helper.h"
+#include "datasystem/common/util/timer.h"
+#include "datasystem/utils/status.h"
+#include "utils.h"
+
+namespace datasystem {
+namespace bench {
+namespace {
+// Max object keys of one GIncreaseRef/GDecreaseRef request issued outside the timed run.
+constexpr size_t kRefBatchLimit = 10000;
+}  // namespace
+
+ObjectBench::~ObjectBench()
+{
+    ReleaseRefs();
+}
+
+ObjectClient &ObjectBench::ThreadClient(uint64_t threadIndex)
+{
+    return *clients_[threadIndex / args_.threadNum];
+}
+
+Status ObjectBench::WarmUp()
+{
+    std::string originalKeyPrefix = args_.keyPrefix;
+    uint64_t originalKeyNum = args_.keyNum;
+    uint64_t originalLoopNum = args_.loopNum;
+
+    args_.keyPrefix += "-pre-run";
+    args_.keyNum = std::min(args_.keyNum, args_.batchNum);
+    args_.loopNum = 1;
+
+    auto rc = ParallelRun();
+    ReleaseRefs();
+    if (rc.IsError()) {
+        std::cerr << "ERROR: WarmUp phase failed - " << rc.GetMsg() << std::endl;
+        return rc;
+    }
+
+    args_.keyPrefix = originalKeyPrefix;
+    args_.keyNum = originalKeyNum;
+    args_.loopNum = originalLoopNum;
+    return Status::OK();
+}
+
+Status ObjectBench::InitClients()
+{
+    if (!clients_.empty()) {
+        return Status::OK();
+    }
+    ConnectOptions connectOptions;
+    RETURN_IF_NOT_OK(StrToHostPort(args_.workerAddress, connectOptions.host, connectOptions.port));
+    connectOptions.accessKey = args_.accessKey;
+    connectOptions.secretKey = args_.secretKey;
+    clients_.reserve(args_.clientNum);
+    for (size_t i = 0; i < args_.clientNum; ++i) {
+        auto client = std::make_unique<ObjectClient>(connectOptions);
+        RETURN_IF_NOT_OK(client->Init());
+        clients_.emplace_back(std::move(client));
+    }
+    return Status::OK();
+}
+
+Status ObjectBench::IncreaseRef(ObjectClient &client, const std::vector<std::string> &keys)
+{
+    for (size_t begin = 0; begin < keys.size(); begin += kRefBatchLimit) {
+        auto end = std::min(keys.size(), begin + kRefBatchLimit);
+        std::vector<std::string> batch(keys.begin() + begin, keys.begin() + end);
+        std::vector<std::string> failedKeys;
+        RETURN_IF_NOT_OK(client.GIncreaseRef(batch, failedKeys));
+        CHECK_FAIL_RETURN_STATUS(failedKeys.empty(), K_RUNTIME_ERROR,
+                                 "GIncreaseRef failed for " + std::to_string(failedKeys.size()) + " objects");
+    }
+    auto clientIndex =
+        std::find_if(clients_.begin(), clients_.end(), [&client](const auto &c) { return c.get() == &client; })
+        - clients_.begin();
+    heldRefs_.emplace_back(clientIndex, keys);
+    return Status::OK();
+}
+
+void ObjectBench::ReleaseRefs()
+{
+    // Release the outer objects before the nested ones they reference.
+    for (auto it = heldRefs_.rbegin(); it != heldRefs_.rend(); ++it) {
+        auto &keys = it->second;
+        for (size_t begin = 0; begin < keys.size(); begin += kRefBatchLimit) {
+            auto end = std::min(keys.size(), begin + kRefBatchLimit);
+            std::vector<std::string> batch(keys.begin() + begin, keys.begin() + end);
+            std::vector<std::string> failedKeys;
+            auto rc = clients_[it->first]->GDecreaseRef(batch, failedKeys);
+            if (rc.IsError()) {
+                std::cerr << "WARNING: GDecreaseRef failed - " << rc.GetMsg() << std::endl;
+            }
+        }
+    }
+    heldRefs_.clear();
+}
+
+Status ObjectBench::PutObjects(ObjectClient &client, const std::vector<std::string> &keys,
+                               const std::vector<uint64_t> &sizes)
+{
+    std::string data(*std::max_element(sizes.begin(), sizes.end()), 'a');
+    for (size_t i = 0; i < keys.size(); i++) {
+        RETURN_IF_NOT_OK(client.Put(keys[i], reinterpret_cast<const uint8_t *>(data.data()), sizes[i], {}));
+    }
+    return Status::OK();
+}
+
+Status ObjectBench::Prepare()
+{
+    RETURN_IF_NOT_OK(InitClients());
+    auto totalThreadNum = args_.clientNum * args_.threadNum;
+    perThreadKeys_.assign(totalThreadNum, {});
+    perThreadSizes_.assign(totalThreadNum, {});
+    perThreadNestedKeys_.assign(totalThreadNum, {});
+    perThreadOps_.assign(totalThreadNum, 0);
+    perThreadBytes_.assign(totalThreadNum, 0);
+
+    for (size_t t = 0; t < totalThreadNum; t++) {
+        // For ref all threads hammer the same objects, which is the hot path of task fan-out.
+        auto owner = args_.action == "ref" ? std::string("_hot") : "_t" + std::to_string(t);
+        std::mt19937_64 gen(args_.action == "ref" ? 0 : t);
+        std::uniform_int_distribution<uint64_t> sizeDist(args_.minKeySize, args_.maxKeySize);
+        for (size_t i = 0; i < args_.keyNum; i++) {
+            perThreadKeys_[t].emplace_back(args_.keyPrefix + owner + "_n" + std::to_string(i));
+            perThreadSizes_[t].emplace_back(sizeDist(gen));
+        }
+    }
+
+    if (args_.action == "ref") {
+        auto &client = *clients_[0];
+        RETURN_IF_NOT_OK(IncreaseRef(client, perThreadKeys_[0]));
+        return PutObjects(client, perThreadKeys_[0], perThreadSizes_[0]);
+    }
+    for (size_t t = 0; t < totalThreadNum; t++) {
+        auto &client = ThreadClient(t);
+        if (args_.action == "nested") {
+            std::vector<std::string> nestedKeys;
+            for (size_t j = 0; j < args_.nestedNum; j++) {
+                nestedKeys.emplace_back(args_.keyPrefix + "_t" + std::to_string(t) + "_c" + std::to_string(j));
+            }
+            RETURN_IF_NOT_OK(IncreaseRef(client, nestedKeys));
+            RETURN_IF_NOT_OK(PutObjects(client, nestedKeys, std::vector<uint64_t>(nestedKeys.size(), 1)));
+            perThreadNestedKeys_[t].insert(nestedKeys.begin(), nestedKeys.end());
+        }
+        RETURN_IF_NOT_OK(IncreaseRef(client, perThreadKeys_[t]));
+        if (args_.action == "get") {
+            RETURN_IF_NOT_OK(PutObjects(client, perThreadKeys_[t], perThreadSizes_[t]));
+        }
+    }
+    return Status::OK();
+}
+
+Status ObjectBench::Run(uint64_t threadIndex, Barrier &barrier)
+{
+    barrier.Wait();
+    CHECK_FAIL_RETURN_STATUS(!clients_.empty(), K_RUNTIME_ERROR, "Object client is not initialized");
+    auto &client = ThreadClient(threadIndex);
+    if (args_.action == "put" || args_.action == "nested") {
+        return Put(client, threadIndex);
+    } else if (args_.action == "get") {
+        return Get(client, threadIndex);
+    } else if (args_.action == "ref") {
+        return RefStorm(client, threadIndex);
+    }
+    RETURN_STATUS(K_INVALID, "unknown action" + args_.action);
+}
+
+Status ObjectBench::Put(ObjectClient &client, uint64_t threadIndex)
+{
+    auto &costs = perThreadCostDetail_[threadIndex];
+    auto &keys = perThreadKeys_[threadIndex];
+    auto &sizes = perThreadSizes_[threadIndex];
+    auto &nestedKeys = perThreadNestedKeys_[threadIndex];
+    std::string data(args_.maxKeySize, 'a');
+    auto *ptr = reinterpret_cast<const uint8_t *>(data.data());
+
+    Timer totalTimer;
+    for (size_t i = 0; i < keys.size(); i++) {
+        Timer timer;
+        RETURN_IF_NOT_OK(client.Put(keys[i], ptr, sizes[i], {}, nestedKeys));
+        costs.emplace_back(timer.ElapsedMicroSecond());
+        perThreadBytes_[threadIndex] += sizes[i];
+    }
+    perThreadCost_[threadIndex] = totalTimer.ElapsedMicroSecond();
+    perThreadOps_[threadIndex] = keys.size();
+    return Status::OK();
+}
+
+Status ObjectBench::Get(ObjectClient &client, uint64_t threadIndex)
+{
+    auto &costs = perThreadCostDetail_[threadIndex];
+    auto &allKeys = perThreadKeys_[threadIndex];
+
+    Timer totalTimer;
+    std::vector<std::string> keys;
+    keys.reserve(args_.batchNum);
+    for (size_t i = 0; i < allKeys.size(); i++) {
+        keys.emplace_back(allKeys[i]);
+        if (keys.size() < args_.batchNum && i + 1 < allKeys.size()) {
+            continue;
+        }
+        std::vector<Optional<Buffer>> buffers;
+        Timer timer;
+        RETURN_IF_NOT_OK(client.Get(keys, 0, buffers));
+        costs.emplace_back(timer.ElapsedMicroSecond());
+        for (const auto &buffer : buffers) {
+            perThreadBytes_[threadIndex] += buffer ? buffer->GetSize() : 0;
+        }
+        keys.clear();
+    }
+    perThreadCost_[threadIndex] = totalTimer.ElapsedMicroSecond();
+    perThreadOps_[threadIndex] = allKeys.size();
+    return Status::OK();
+}
+
+Status ObjectBench::RefStorm(ObjectClient &client, uint64_t threadIndex)
+{
+    auto &costs = perThreadCostDetail_[threadIndex];
+    auto &allKeys = perThreadKeys_[threadIndex];
+
+    Timer totalTimer;
+    uint64_t ops = 0;
+    for (uint64_t loop = 0; loop < args_.loopNum; loop++) {
+        for (size_t begin = 0; begin < allKeys.size(); begin += args_.batchNum) {
+            auto end = std::min<size_t>(allKeys.size(), begin + args_.batchNum);
+            std::vector<std::string> keys(allKeys.begin() + begin, allKeys.begin() + end);
+            std::vector<std::string> failedKeys;
+            Timer timer;
+            RETURN_IF_NOT_OK(client.GIncreaseRef(keys, failedKeys));
+            costs.emplace_back(timer.ElapsedMicroSecond());
+            CHECK_FAIL_RETURN_STATUS(failedKeys.empty(), K_RUNTIME_ERROR,
+                                     "GIncreaseRef failed for " + std::to_string(failedKeys.size()) + " objects");
+            timer.Reset();
+            RETURN_IF_NOT_OK(client.GDecreaseRef(keys, failedKeys));
+            costs.emplace_back(timer.ElapsedMicroSecond());
+            CHECK_FAIL_RETURN_STATUS(failedKeys.empty(), K_RUNTIME_ERROR,
+                                     "GDecreaseRef failed for " + std::to_string(failedKeys.size()) + " objects");
+            ops += 2 * keys.size();
+        }
+    }
+    perThreadCost_[threadIndex] = totalTimer.ElapsedMicroSecond();
+    perThreadOps_[threadIndex] = ops;
+    return Status::OK();
+}
+
+Status ObjectBench::CollectServerPerf()
+{
+    // Only the outermost master handler of each action is summed, sub phases are already included in it.
+    std::vector<std::string> perfNames;
+    if (args_.action == "ref") {
+        perfNames = { "MASTER_GINCREASE_REF", "MASTER_GDECREASE_REF" };
+    } else if (args_.action == "get") {
+        perfNames = { "MASTER_QUERY_META" };
+    } else {
+        perfNames = { "MASTER_CREATE_META", "MASTER_CREATE_MULTI_META" };
+    }
+    return perf_.SumWorkerPerfTime(perfNames, masterPerfCount_, masterPerfTimeNs_);
+}
+
+Status ObjectBench::PrintBenchmarkInfo()
+{
+    std::cout << "BENCHMARK-RESULT:" << GetBenchCost() << "\n";
+    ReleaseRefs();
+    return Status::OK();
+}
+
+std::string ObjectBench::GetBenchCost()
+{
+    auto totalThreadNum = args_.clientNum * args_.threadNum;
+    std::vector<uint64_t> costVec;
+    for (const auto &costs : perThreadCostDetail_) {
+        costVec.insert(costVec.end(), costs.begin(), costs.end());
+    }
+    std::stringstream ss;
+    ss << args_.action << "-" << args_.clientNum << "-" << args_.threadNum << "-" << args_.keyNum;
+    ss << "-" << args_.keySize << "-" << args_.batchNum;
+    if (args_.action == "nested") {
+        ss << "-" << args_.nestedNum;
+    } else if (args_.action == "ref") {
+        ss << "-" << args_.loopNum;
+    }
+    if (costVec.empty()) {
+        ss << ":empty cost";
+        return ss.str();
+    }
+    const uint64_t BYTES_TO_MEGABYTES = 1024 * 1024;
+    const double MICROSECONDS_TO_SECONDS = 1000.0 * 1000.0;
+    const double NANOSECONDS_TO_MILLISECONDS = 1000.0 * 1000.0;
+    double threadCostSum = std::accumulate(perThreadCost_.begin(), perThreadCost_.end(), 0.0);
+    double timeCostPerThread = threadCostSum / totalThreadNum / MICROSECONDS_TO_SECONDS;  // Second
+    uint64_t totalOps = std::accumulate(perThreadOps_.begin(), perThreadOps_.end(), 0ul);
+    uint64_t totalBytes = std::accumulate(perThreadBytes_.begin(), perThreadBytes_.end(), 0ul);
+
+    ss << FormatLatency(costVec);                                            // avg/min/p50/p90/p99/max ms
+    ss << "," << totalOps / timeCostPerThread;                               // tps: object or ref count/sec
+    ss << "," << totalBytes / timeCostPerThread / BYTES_TO_MEGABYTES;        // throughput MB
+    ss << "," << masterPerfTimeNs_ / NANOSECONDS_TO_MILLISECONDS;            // master busy time ms
+    ss << "," << (totalOps == 0 ? 0 : masterPerfTimeNs_ / 1000.0 / totalOps);  // master busy us per op
+    return ss.str();
+}
+}  // namespace bench
+}  // namespace datasystem
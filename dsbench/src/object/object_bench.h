@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BENCH_OBJECT_BENCH_H
+#define BENCH_OBJECT_BENCH_H
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "bench_base.h"
+#include "datasystem/common/util/wait_post.h"
+#include "datasystem/object_client.h"
+#include "datasystem/utils/status.h"
+#include "object/object_args.h"
+
+namespace datasystem {
+
+namespace bench {
+class ObjectBench final : public BenchBase {
+public:
+    ObjectBench(ObjectArgs &args) : BenchBase(args), args_(args)
+    {
+    }
+    virtual ~ObjectBench();
+
+protected:
+    Status WarmUp() override;
+    Status Prepare() override;
+    Status Run(uint64_t threadIndex, Barrier &barrier) override;
+    Status PrintBenchmarkInfo() override;
+    Status CollectServerPerf() override;
+
+    std::string GetBenchCost();
+    Status InitClients();
+
+    Status Put(ObjectClient &client, uint64_t threadIndex);
+    Status Get(ObjectClient &client, uint64_t threadIndex);
+    Status RefStorm(ObjectClient &client, uint64_t threadIndex);
+
+private:
+    ObjectClient &ThreadClient(uint64_t threadIndex);
+    Status PutObjects(ObjectClient &client, const std::vector<std::string> &keys, const std::vector<uint64_t> &sizes);
+    Status IncreaseRef(ObjectClient &client, const std::vector<std::string> &keys);
+    void ReleaseRefs();
+
+    std::vector<std::unique_ptr<ObjectClient>> clients_;
+    std::vector<std::vector<std::string>> perThreadKeys_;
+    std::vector<std::vector<uint64_t>> perThreadSizes_;
+    std::vector<uint64_t> perThreadOps_;
+    std::vector<uint64_t> perThreadBytes_;
+    // Nested objects referenced by the objects of each thread for nested.
+    std::vector<std::unordered_set<std::string>> perThreadNestedKeys_;
+    // Global references held by the bench, released in order (outer objects first) after each run.
+    std::vector<std::pair<size_t, std::vector<std::string>>> heldRefs_;
+    // Master busy time: the handler time of the action summed from perf points, not the master process CPU time.
+    uint64_t masterPerfCount_ = 0;
+    uint64_t masterPerfTimeNs_ = 0;
+    ObjectArgs &args_;
+};
+}  // namespace bench
+}  // namespace datasystem
+#endif
@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stream/stream_args.h"
+
+#include <getopt.h>
+#include <iostream>
+#include <sstream>
+
+#include "datasystem/utils/status.h"
+#include "utils.h"
+
+namespace datasystem {
+namespace bench {
+namespace {
+// Every element carries its send timestamp so that consumers can compute the end-to-end latency.
+constexpr uint64_t kMinElementSize = sizeof(uint64_t);
+constexpr uint64_t kMaxTotalThreadNum = 128;
+}  // namespace
+
+StreamArgs::StreamArgs(const std::string &command)
+    : ArgsBase(command),
+      streamPrefix("BenchStream"),
+      streamNum(1),
+      producerNum(1),
+      consumerNum(1),
+      elementNum(1),
+      elementSize("1KB"),
+      minElementSize(0),
+      maxElementSize(0),
+      streamMode("MPMC"),
+      pageSize("1MB"),
+      maxStreamSize("100MB"),
+      sendBatch(1),
+      receiveBatch(1),
+      receiveTimeoutMs(1000)
+{
+    action = "pubsub";
+}
+
+std::string StreamArgs::Usage(const std::string &argv0)
+{
+    std::stringstream ss;
+    ss << "Usage:" << argv0 << " stream [options]\n";
+    ss << "Options:\n";
+    ss << "  -w --worker_address           producer worker address\n";
+    ss << "  -r --consumer_worker_address  consumer worker address, default the producer worker (local)\n";
+    ss << "  -p --prefix                   the stream name prefix\n";
+    ss << "  -S --stream_num               Stream number, default 1\n";
+    ss << "  -x --producer_num             Producer number per stream, default 1\n";
+    ss << "  -y --consumer_num             Consumer number per stream, default 1\n";
+    ss << "  -n --num                      Element number per producer, default 1\n";
+    ss << "  -s --size                     Element size, n/nB/nKB/nMB or a uniform range like 64B-4KB, "
+          "default 1KB\n";
+    ss << "  -m --stream_mode              MPMC/MPSC/SPSC, default MPMC\n";
+    ss << "  -g --page_size                Stream page size, default 1MB\n";
+    ss << "  -M --max_stream_size          Max stream size, default 100MB\n";
+    ss << "  -B --send_batch               Elements per SendBatch, default 1 to call Send for each element\n";
+    ss << "  -b --batch_num                Max elements per Receive, default 1\n";
+    ss << "  -T --timeout                  Receive timeout in ms, default 1000\n";
+    ss << "  -f --perf_path                The perf point path\n";
+    ss << "  -P --perf_workers             Get or reset perf point for those workers\n";
+    ss << "  -k --access_key               Access key for authentication\n";
+    ss << "  -K --secret_key               Secret key for authentication\n";
+    ss << CommonUsage();
+    ss << "  -h                            Show help\n";
+    return ss.str();
+}
+
+std::string StreamArgs::ToString()
+{
+    std::stringstream ss;
+    ss << "  -w --worker_address:          " << workerAddress << "\n";
+    ss << "  -r --consumer_worker_address: " << consumerWorkerAddress << "\n";
+    ss << "  -p --prefix:                  " << streamPrefix << "\n";
+    ss << "  -S --stream_num:              " << streamNum << "\n";
+    ss << "  -x --producer_num:            " << producerNum << "\n";
+    ss << "  -y --consumer_num:            " << consumerNum << "\n";
+    ss << "  -n --num:                     " << elementNum << "\n";
+    ss << "  -s --size:                    " << elementSize << "\n";
+    ss << "  -m --stream_mode:             " << streamMode << "\n";
+    ss << "  -g --page_size:               " << pageSize << "\n";
+    ss << "  -M --max_stream_size:         " << maxStreamSize << "\n";
+    ss << "  -B --send_batch:              " << sendBatch << "\n";
+    ss << "  -b --batch_num:               " << receiveBatch << "\n";
+    ss << "  -T --timeout:                 " << receiveTimeoutMs << "\n";
+    ss << "  -f --perf_path:               " << perfPath << "\n";
+    ss << "  -P --perf_workers:            " << perfWorkers;
+    return ss.str();
+}
+
+Status StreamArgs::Parse(int argc, char *argv[])
+{
+    // clang-format off
+    static const struct option longOptions[] = {
+        { "worker_address", required_argument, nullptr, 'w' },
+        { "consumer_worker_address", required_argument, nullptr, 'r' },
+        { "prefix", required_argument, nullptr, 'p' },       { "stream_num", required_argument, nullptr, 'S' },
+        { "producer_num", required_argument, nullptr, 'x' }, { "consumer_num", required_argument, nullptr, 'y' },
+        { "num", required_argument, nullptr, 'n' },          { "size", required_argument, nullptr, 's' },
+        { "stream_mode", required_argument, nullptr, 'm' },  { "page_size", required_argument, nullptr, 'g' },
+        { "max_stream_size", required_argument, nullptr, 'M' }, { "send_batch", required_argument, nullptr, 'B' },
+        { "batch_num", required_argument, nullptr, 'b' },    { "timeout", required_argument, nullptr, 'T' },
+        { "perf_path", required_argument, nullptr, 'f' },    { "perf_workers", required_argument, nullptr, 'P' },
+        { "access_key", required_argument, nullptr, 'k' },   { "secret_key", required_argument, nullptr, 'K' },
+        COMMON_LONG_OPTIONS,
+        { "help", no_argument, nullptr, 'h' }
+    };
+    // clang-format on
+    while (true) {
+        auto c = getopt_long(argc - 1, argv + 1, "hw:r:p:S:x:y:n:s:m:g:M:B:b:T:f:P:k:K:", longOptions, nullptr);
+        if (c == -1) {
+            break;
+        }
+        Status rc = Status::OK();
+        int32_t timeoutMs = 0;
+        switch (c) {
+            case 'w':
+                workerAddress = optarg;
+                break;
+            case 'r':
+                consumerWorkerAddress = optarg;
+                break;
+            case 'p':
+                streamPrefix = optarg;
+                break;
+            case 'S':
+                rc = StrToInt(optarg, streamNum);
+                break;
+            case 'x':
+                rc = StrToInt(optarg, producerNum);
+                break;
+            case 'y':
+                rc = StrToInt(optarg, consumerNum);
+                break;
+            case 'n':
+                rc = StrToInt(optarg, elementNum);
+                break;
+            case 's':
+                elementSize = optarg;
+                break;
+            case 'm':
+                streamMode = optarg;
+                if (streamMode != "MPMC" && streamMode != "MPSC" && streamMode != "SPSC") {
+                    rc = Status(K_INVALID, "stream_mode must be MPMC, MPSC or SPSC");
+                }
+                break;
+            case 'g':
+                pageSize = optarg;
+                break;
+            case 'M':
+                maxStreamSize = optarg;
+                break;
+            case 'B':
+                rc = StrToInt(optarg, sendBatch);
+                break;
+            case 'b':
+                rc = StrToInt(optarg, receiveBatch);
+                break;
+            case 'T':
+                rc = StrToInt(optarg, timeoutMs);
+                receiveTimeoutMs = static_cast<uint32_t>(timeoutMs);
+                if (rc.IsOk() && timeoutMs <= 0) {
+                    rc = Status(K_INVALID, "timeout must be greater than 0");
+                }
+                break;
+            case 'f':
+                perfPath = optarg;
+                break;
+            case 'P':
+                perfWorkers = optarg;
+                break;
+            case 'k':
+                accessKey = optarg;
+                break;
+            case 'K':
+                secretKey = optarg;
+                break;
+            case RESULT_FILE_OPTION:
+            case HDR_FILE_OPTION:
+            case EXPECTED_INTERVAL_OPTION:
+                rc = ParseCommonOption(c, optarg);
+                break;
+            default:
+                std::cout << Usage(argv[0]);
+                return Status(K_INVALID, "");
+        }
+        if (rc.IsError()) {
+            std::cerr << "Error: Invalid argument value - " << rc.GetMsg() << "\n";
+            std::cerr << "Please refer to the usage below:\n";
+            std::cerr << Usage(argv[0]);
+            return Status(K_INVALID, "");
+        }
+    }
+
+    auto invalid = [this, &argv](const std::string &msg) {
+        std::cerr << "Error: " << msg << "\n";
+        std::cerr << "Please refer to the usage below:\n";
+        std::cerr << Usage(argv[0]);
+        return Status(K_INVALID, "");
+    };
+    if (workerAddress.empty()) {
+        return invalid("workerAddress cannot be empty");
+    }
+    if (consumerWorkerAddress.empty()) {
+        consumerWorkerAddress = workerAddress;
+    }
+    if (streamNum == 0 || producerNum == 0 || consumerNum == 0 || elementNum == 0 || sendBatch == 0
+        || receiveBatch == 0) {
+        return invalid("stream_num, producer_num, consumer_num, num, send_batch and batch_num must be greater than 0");
+    }
+    if ((streamMode == "MPSC" || streamMode == "SPSC") && consumerNum != 1) {
+        return invalid(streamMode + " requires consumer_num to be 1");
+    }
+    if (streamMode == "SPSC" && producerNum != 1) {
+        return invalid("SPSC requires producer_num to be 1");
+    }
+    if (producerNum + consumerNum > kMaxTotalThreadNum / streamNum) {
+        return invalid("stream_num * (producer_num + consumer_num) must be <= " + std::to_string(kMaxTotalThreadNum));
+    }
+    Status rc = StringToBytesRange(elementSize, minElementSize, maxElementSize);
+    if (rc.IsError()) {
+        return invalid("invalid size " + elementSize + ": " + rc.GetMsg());
+    }
+    if (minElementSize < kMinElementSize) {
+        return invalid("size must be at least " + std::to_string(kMinElementSize) + " bytes");
+    }
+    // Each producer and each consumer runs in its own thread with its own client.
+    threadNum = streamNum * (producerNum + consumerNum);
+    clientNum = 1;
+    return Status::OK();
+}
+}  // namespace bench
+}  // namespace datasystem
@@ -0,0 +1,295 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stream/stream_bench.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include "datasystem/common/util/status_helper.h"
+#include "datasystem/common/util/timer.h"
+#include "datasystem/utils/status.h"
+#include "utils.h"
+
+namespace datasystem {
+namespace bench {
+namespace {
+constexpr uint64_t kWarmUpElementNum = 100;
+
+uint64_t NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+}  // namespace
+
+StreamBench::~StreamBench()
+{
+    DeleteStreams();
+}
+
+bool StreamBench::IsProducerThread(uint64_t threadIndex) const
+{
+    return threadIndex % (args_.producerNum + args_.consumerNum) < args_.producerNum;
+}
+
+const std::vector<uint64_t> &StreamBench::LatencySamples(uint64_t threadIndex) const
+{
+    static const std::vector<uint64_t> noSamples;
+    return IsProducerThread(threadIndex) ? noSamples : perThreadE2eLatency_[threadIndex];
+}
+
+std::string StreamBench::StreamName(uint64_t threadIndex) const
+{
+    return args_.streamPrefix + "_" + std::to_string(threadIndex / (args_.producerNum + args_.consumerNum));
+}
+
+Status StreamBench::WarmUp()
+{
+    std::string originalPrefix = args_.streamPrefix;
+    uint64_t originalElementNum = args_.elementNum;
+
+    args_.streamPrefix += "-pre-run";
+    args_.elementNum = std::min(args_.elementNum, kWarmUpElementNum);
+
+    auto rc = ParallelRun();
+    if (rc.IsError()) {
+        std::cerr << "ERROR: WarmUp phase failed - " << rc.GetMsg() << std::endl;
+        return rc;
+    }
+    DeleteStreams();
+
+    args_.streamPrefix = originalPrefix;
+    args_.elementNum = originalElementNum;
+    return Status::OK();
+}
+
+Status StreamBench::InitClients()
+{
+    ConnectOptions producerOptions;
+    RETURN_IF_NOT_OK(StrToHostPort(args_.workerAddress, producerOptions.host, producerOptions.port));
+    producerOptions.accessKey = args_.accessKey;
+    producerOptions.secretKey = args_.secretKey;
+    ConnectOptions consumerOptions = producerOptions;
+    RETURN_IF_NOT_OK(StrToHostPort(args_.consumerWorkerAddress, consumerOptions.host, consumerOptions.port));
+
+    auto totalThreadNum = args_.clientNum * args_.threadNum;
+    clients_.clear();
+    clients_.reserve(totalThreadNum);
+    for (size_t i = 0; i < totalThreadNum; ++i) {
+        auto client = std::make_unique<StreamClient>(IsProducerThread(i) ? producerOptions : consumerOptions);
+        RETURN_IF_NOT_OK(client->Init());
+        clients_.emplace_back(std::move(client));
+    }
+    return Status::OK();
+}
+
+Status StreamBench::InitStreams()
+{
+    ProducerConf conf;
+    uint64_t pageSize = 0;
+    RETURN_IF_NOT_OK(StringToBytes(args_.pageSize, pageSize));
+    conf.pageSize = static_cast<int64_t>(pageSize);
+    RETURN_IF_NOT_OK(StringToBytes(args_.maxStreamSize, conf.maxStreamSize));
+    if (args_.streamMode == "MPSC") {
+        conf.streamMode = StreamMode::MPSC;
+    } else if (args_.streamMode == "SPSC") {
+        conf.streamMode = StreamMode::SPSC;
+    } else {
+        conf.streamMode = StreamMode::MPMC;
+    }
+
+    auto totalThreadNum = clients_.size();
+    producers_.assign(totalThreadNum, nullptr);
+    consumers_.assign(totalThreadNum, nullptr);
+    // Subscribe before any producer exists so that consumers see every element.
+    for (size_t i = 0; i < totalThreadNum; ++i) {
+        if (!IsProducerThread(i)) {
+            SubscriptionConfig config("sub" + std::to_string(i), SubscriptionType::STREAM);
+            RETURN_IF_NOT_OK_APPEND_MSG(clients_[i]->Subscribe(StreamName(i), config, consumers_[i]),
+                                        "Subscribe " + StreamName(i) + " failed");
+        }
+    }
+    for (size_t i = 0; i < totalThreadNum; ++i) {
+        if (IsProducerThread(i)) {
+            RETURN_IF_NOT_OK_APPEND_MSG(clients_[i]->CreateProducer(StreamName(i), producers_[i], conf),
+                                        "CreateProducer " + StreamName(i) + " failed");
+        }
+    }
+    return Status::OK();
+}
+
+void StreamBench::DeleteStreams()
+{
+    for (size_t i = 0; i < clients_.size(); ++i) {
+        if (producers_.size() > i && producers_[i] != nullptr) {
+            (void)producers_[i]->Close();
+        }
+        if (consumers_.size() > i && consumers_[i] != nullptr) {
+            (void)consumers_[i]->Close();
+        }
+    }
+    producers_.clear();
+    consumers_.clear();
+    auto step = args_.producerNum + args_.consumerNum;
+    for (size_t i = 0; i < clients_.size(); i += step) {
+        auto rc = clients_[i]->DeleteStream(StreamName(i));
+        if (rc.IsError()) {
+            std::cerr << "WARNING: DeleteStream " << StreamName(i) << " failed - " << rc.GetMsg() << std::endl;
+        }
+    }
+    clients_.clear();
+}
+
+Status StreamBench::Prepare()
+{
+    auto totalThreadNum = args_.clientNum * args_.threadNum;
+    perThreadE2eLatency_.clear();
+    perThreadE2eLatency_.resize(totalThreadNum);
+    perThreadBytes_.assign(totalThreadNum, 0);
+    RETURN_IF_NOT_OK(InitClients());
+    return InitStreams();
+}
+
+Status StreamBench::Run(uint64_t threadIndex, Barrier &barrier)
+{
+    barrier.Wait();
+    CHECK_FAIL_RETURN_STATUS(threadIndex < clients_.size(), K_RUNTIME_ERROR, "stream client is not initialized");
+    if (IsProducerThread(threadIndex)) {
+        return Produce(threadIndex);
+    }
+    return Consume(threadIndex);
+}
+
+Status StreamBench::Produce(uint64_t threadIndex)
+{
+    auto &costs = perThreadCostDetail_[threadIndex];
+    auto &producer = producers_[threadIndex];
+    CHECK_FAIL_RETURN_STATUS(producer != nullptr, K_RUNTIME_ERROR, "producer is not initialized");
+    costs.reserve(args_.elementNum);
+
+    std::mt19937_64 gen(threadIndex);
+    std::uniform_int_distribution<uint64_t> sizeDist(args_.minElementSize, args_.maxElementSize);
+    // Each element of a batch has its own buffer to carry its own send time.
+    std::string data(args_.maxElementSize * args_.sendBatch, 'a');
+    std::vector<Element> batch;
+    batch.reserve(args_.sendBatch);
+    Timer totalTimer;
+    for (uint64_t i = 0; i < args_.elementNum; i += batch.size()) {
+        batch.clear();
+        auto sendNs = NowNs();
+        for (uint64_t j = 0; j < args_.sendBatch && i + j < args_.elementNum; j++) {
+            auto *ptr = reinterpret_cast<uint8_t *>(&data[j * args_.maxElementSize]);
+            (void)memcpy(ptr, &sendNs, sizeof(sendNs));
+            batch.emplace_back(ptr, sizeDist(gen));
+            perThreadBytes_[threadIndex] += batch.back().size;
+        }
+        Timer timer;
+        if (args_.sendBatch == 1) {
+            RETURN_IF_NOT_OK(producer->Send(batch.front(), args_.receiveTimeoutMs));
+        } else {
+            RETURN_IF_NOT_OK(producer->SendBatch(batch, args_.receiveTimeoutMs));
+        }
+        costs.emplace_back(timer.ElapsedMicroSecond());
+    }
+    perThreadCost_[threadIndex] = totalTimer.ElapsedMicroSecond();
+    return producer->Close();
+}
+
+Status StreamBench::Consume(uint64_t threadIndex)
+{
+    auto &latency = perThreadE2eLatency_[threadIndex];
+    auto &consumer = consumers_[threadIndex];
+    CHECK_FAIL_RETURN_STATUS(consumer != nullptr, K_RUNTIME_ERROR, "consumer is not initialized");
+    // Every consumer of a STREAM subscription receives the elements of all producers.
+    uint64_t expectNum = args_.elementNum * args_.producerNum;
+    latency.reserve(expectNum);
+
+    Timer totalTimer;
+    uint64_t received = 0;
+    while (received < expectNum) {
+        std::vector<Element> elements;
+        auto batch = static_cast<uint32_t>(std::min(args_.receiveBatch, expectNum - received));
+        RETURN_IF_NOT_OK(consumer->Receive(batch, args_.receiveTimeoutMs, elements));
+        CHECK_FAIL_RETURN_STATUS(!elements.empty(), K_RUNTIME_ERROR,
+                                 "Receive timeout on " + StreamName(threadIndex) + ", received "
+                                     + std::to_string(received) + "/" + std::to_string(expectNum));
+        auto recvNs = NowNs();
+        for (const auto &element : elements) {
+            uint64_t sendNs = 0;
+            CHECK_FAIL_RETURN_STATUS(element.size >= sizeof(sendNs), K_RUNTIME_ERROR, "unexpected element size");
+            (void)memcpy(&sendNs, element.ptr, sizeof(sendNs));
+            latency.emplace_back(recvNs > sendNs ? (recvNs - sendNs) / 1000 : 0);
+            perThreadBytes_[threadIndex] += element.size;
+        }
+        received += elements.size();
+        RETURN_IF_NOT_OK(consumer->Ack(elements.back().id));
+    }
+    perThreadCost_[threadIndex] = totalTimer.ElapsedMicroSecond();
+    return consumer->Close();
+}
+
+Status StreamBench::PrintBenchmarkInfo()
+{
+    std::cout << "BENCHMARK-RESULT:" << GetBenchCost() << "\n";
+    DeleteStreams();
+    return Status::OK();
+}
+
+std::string StreamBench::GetBenchCost()
+{
+    std::vector<uint64_t> sendCosts;
+    std::vector<uint64_t> e2eLatency;
+    uint64_t consumeCost = 0;
+    uint64_t consumedBytes = 0;
+    for (size_t i = 0; i < perThreadCost_.size(); i++) {
+        if (IsProducerThread(i)) {
+            sendCosts.insert(sendCosts.end(), perThreadCostDetail_[i].begin(), perThreadCostDetail_[i].end());
+            continue;
+        }
+        e2eLatency.insert(e2eLatency.end(), perThreadE2eLatency_[i].begin(), perThreadE2eLatency_[i].end());
+        consumeCost = std::max(consumeCost, perThreadCost_[i]);
+        consumedBytes += perThreadBytes_[i];
+    }
+
+    std::stringstream ss;
+    ss << args_.action << "-" << args_.streamNum << "-" << args_.producerNum << "-" << args_.consumerNum;
+    ss << "-" << args_.elementNum << "-" << args_.elementSize << "-" << args_.streamMode << "-" << args_.pageSize;
+    ss << "-" << (args_.consumerWorkerAddress == args_.workerAddress ? "local" : "remote");
+    if (args_.sendBatch > 1) {
+        ss << "-batch" << args_.sendBatch;
+    }
+    if (e2eLatency.empty() || consumeCost == 0) {
+        ss << ":empty cost";
+        return ss.str();
+    }
+    const uint64_t BYTES_TO_MEGABYTES = 1024 * 1024;
+    const double MICROSECONDS_TO_SECONDS = 1000.0 * 1000.0;
+    double seconds = consumeCost / MICROSECONDS_TO_SECONDS;
+    ss << FormatLatency(sendCosts);                                // send (batch) avg/min/p50/p90/p99/max ms
+    ss << FormatLatency(e2eLatency);                               // produce-to-consume avg/min/p50/p90/p99/max ms
+    ss << "," << e2eLatency.size() / seconds;                      // consumed elements/sec
+    ss << "," << consumedBytes / seconds / BYTES_TO_MEGABYTES;     // consumed MB/sec
+    return ss.str();
+}
+}  // namespace bench
+}  // namespace datasystem
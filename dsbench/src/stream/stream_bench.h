@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BENCH_STREAM_BENCH_H
+#define BENCH_STREAM_BENCH_H
+
+#include <memory>
+#include <vector>
+
+#include "bench_base.h"
+#include "datasystem/common/util/wait_post.h"
+#include "datasystem/stream_client.h"
+#include "datasystem/utils/status.h"
+#include "stream/stream_args.h"
+
+namespace datasystem {
+
+namespace bench {
+class StreamBench final : public BenchBase {
+public:
+    StreamBench(StreamArgs &args) : BenchBase(args), args_(args)
+    {
+    }
+    virtual ~StreamBench();
+
+protected:
+    Status WarmUp() override;
+    Status Prepare() override;
+    Status Run(uint64_t threadIndex, Barrier &barrier) override;
+    Status PrintBenchmarkInfo() override;
+    // The result histogram holds the produce-to-consume latency of the consumers.
+    const std::vector<uint64_t> &LatencySamples(uint64_t threadIndex) const override;
+
+    std::string GetBenchCost();
+    Status InitClients();
+    Status InitStreams();
+
+    /**
+     * @brief Send elementNum elements, each stamped with its send time, and record the Send cost, or the SendBatch
+     *        cost of sendBatch elements.
+     */
+    Status Produce(uint64_t threadIndex);
+
+    /**
+     * @brief Receive all elements of the stream and record the produce-to-consume latency of each one.
+     */
+    Status Consume(uint64_t threadIndex);
+
+private:
+    bool IsProducerThread(uint64_t threadIndex) const;
+    std::string StreamName(uint64_t threadIndex) const;
+    void DeleteStreams();
+
+    std::vector<std::unique_ptr<StreamClient>> clients_;
+    std::vector<std::shared_ptr<Producer>> producers_;
+    std::vector<std::shared_ptr<Consumer>> consumers_;
+    // Per consumer thread produce-to-consume latency in microseconds, and received bytes.
+    std::vector<std::vector<uint64_t>> perThreadE2eLatency_;
+    std::vector<uint64_t> perThreadBytes_;
+    StreamArgs &args_;
+};
+}  // namespace bench
+}  // namespace datasystem
+#endif
@@ -16,6 +16,7 @@
 
 #include "utils.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <libgen.h>
@@ -25,6 +26,8 @@
 #include <sstream>
 #include <thread>
 
+#include "datasystem/common/util/status_helper.h"
+
 namespace datasystem {
 namespace bench {
 
@@ -62,6 +65,23 @@ Status StrToInt(const std::string &str, int32_t &num)
     return Status::OK();
 }
 
+Status StrToDouble(const std::string &str, double &num)
+{
+    try {
+        size_t pos = 0;
+        num = std::stod(str, &pos);
+        if (pos != str.size()) {
+            return Status(StatusCode::K_INVALID,
+                          "Failed to parse '" + str + "' as number: unexpected trailing characters");
+        }
+    } catch (std::invalid_argument &invalidArgument) {
+        return Status(StatusCode::K_INVALID, "Failed to parse '" + str + "' as number: invalid argument");
+    } catch (std::out_of_range &outOfRange) {
+        return Status(StatusCode::K_INVALID, "Failed to parse '" + str + "' as number: value out of range");
+    }
+    return Status::OK();
+}
+
 Status StrToHostPort(const std::string &str, std::string &host, int32_t &port)
 {
     auto index = str.find(":");
@@ -119,5 +139,45 @@ Status StringToBytes(const std::string &sizeStr, uint64_t &byteSize)
     byteSize = number * factor;
     return Status::OK();
 }
+
+std::string FormatLatency(std::vector<uint64_t> &costs)
+{
+    const double MICROSECONDS_TO_MILLISECONDS = 1000.0;
+    const size_t PERCENTILE_50 = 50;
+    const size_t PERCENTILE_90 = 90;
+    const size_t PERCENTILE_99 = 99;
+    const size_t PERCENTILE_100 = 100;
+    std::stringstream ss;
+    if (costs.empty()) {
+        ss << ",0,0,0,0,0,0";
+        return ss.str();
+    }
+    std::sort(costs.begin(), costs.end());
+    auto count = costs.size();
+    double avg = std::accumulate(costs.begin(), costs.end(), 0.0) / count;
+    ss << "," << avg / MICROSECONDS_TO_MILLISECONDS;                                            // avg ms
+    ss << "," << costs[0] / MICROSECONDS_TO_MILLISECONDS;                                       // min ms
+    ss << "," << costs[count * PERCENTILE_50 / PERCENTILE_100] / MICROSECONDS_TO_MILLISECONDS;  // p50 ms
+    ss << "," << costs[count * PERCENTILE_90 / PERCENTILE_100] / MICROSECONDS_TO_MILLISECONDS;  // p90 ms
+    ss << "," << costs[count * PERCENTILE_99 / PERCENTILE_100] / MICROSECONDS_TO_MILLISECONDS;  // p99 ms
+    ss << "," << costs[count - 1] / MICROSECONDS_TO_MILLISECONDS;                               // max ms
+    return ss.str();
+}
+
+Status StringToBytesRange(const std::string &sizeStr, uint64_t &minSize, uint64_t &maxSize)
+{
+    auto rangePos = sizeStr.find('-');
+    if (rangePos == std::string::npos) {
+        RETURN_IF_NOT_OK(StringToBytes(sizeStr, minSize));
+        maxSize = minSize;
+        return Status::OK();
+    }
+    RETURN_IF_NOT_OK(StringToBytes(sizeStr.substr(0, rangePos), minSize));
+    RETURN_IF_NOT_OK(StringToBytes(sizeStr.substr(rangePos + 1), maxSize));
+    if (minSize > maxSize) {
+        return Status(K_INVALID, "Invalid size range: '" + sizeStr + "'");
+    }
+    return Status::OK();
+}
 }  // namespace bench
 }  // namespace datasystem
@@ -16,14 +16,21 @@
 
 #ifndef BENCH_UTILS_H
 #define BENCH_UTILS_H
+#include <string>
+#include <vector>
+
 #include "datasystem/utils/status.h"
 
 namespace datasystem {
 namespace bench {
 Status StrToInt(const std::string &str, uint64_t &num);
 Status StrToInt(const std::string &str, int32_t &num);
+Status StrToDouble(const std::string &str, double &num);
 Status StrToHostPort(const std::string &str, std::string &host, int32_t &port);
 Status StringToBytes(const std::string &sizeStr, uint64_t &byteSize);
+Status StringToBytesRange(const std::string &sizeStr, uint64_t &minSize, uint64_t &maxSize);
+// Sort costs (in microseconds) and format them as ",avg,min,p50,p90,p99,max" in milliseconds.
+std::string FormatLatency(std::vector<uint64_t> &costs);
 }  // namespace bench
 }  // namespace datasystem
 #endif
@@ -518,6 +518,54 @@ func (t *StreamProducer) Send(element Element) common.Status {
 	return common.CreateStatus(common.Ok, "")
 }
 
+// SendBatch Send elements of the stream in order with one call, the page space is reserved once for as many elements
+// as it can hold. If it fails, the elements before the failed one have been sent.
+func (t *StreamProducer) SendBatch(elements []Element, timeoutMs ...int64) common.Status {
+	rc := checkNullProducerPtr(t)
+	if int(rc.Code) != common.Ok {
+		return rc
+	}
+	count := len(elements)
+	if count == 0 {
+		return common.CreateStatus(common.InvalidParam, "The elements to send are empty")
+	}
+	var totalSize uint64
+	for _, element := range elements {
+		if element.Ptr == nil || element.Size == 0 {
+			return common.CreateStatus(common.InvalidParam, "The element to send is empty")
+		}
+		totalSize += element.Size
+	}
+	// C may not keep Go pointers, so the payloads are copied into one C buffer and the element pointers point into it.
+	cData := C.malloc(C.size_t(totalSize))
+	defer C.free(cData)
+	cPtrArray := (**C.uint8_t)(C.malloc(C.size_t(count) * C.size_t(unsafe.Sizeof(uintptr(0)))))
+	defer C.free(unsafe.Pointer(cPtrArray))
+	cPtrs := unsafe.Slice(cPtrArray, count)
+	cSizes := make([]C.uint64_t, count)
+	data := unsafe.Slice((*uint8)(cData), totalSize)
+	var offset uint64
+	for i, element := range elements {
+		copy(data[offset:offset+element.Size], unsafe.Slice(element.Ptr, element.Size))
+		cPtrs[i] = (*C.uint8_t)(unsafe.Pointer(&data[offset]))
+		cSizes[i] = C.uint64_t(element.Size)
+		offset += element.Size
+	}
+	cTimeoutMs := C.int64_t(-1)
+	if len(timeoutMs) > 0 {
+		cTimeoutMs = C.int64_t(timeoutMs[0])
+	}
+
+	t.mutex.Lock()
+	defer t.mutex.Unlock()
+	statusC := C.StreamProducerSendBatch(t.producer, cPtrArray, &cSizes[0], C.uint64_t(count), cTimeoutMs)
+	if int(statusC.code) != common.Ok {
+		return common.CreateStatus(int(statusC.code),
+			fmt.Sprintf("Stream cache producer failed to send batch. msg: %s", C.GoString(&statusC.errMsg[0])))
+	}
+	return common.CreateStatus(common.Ok, "")
+}
+
 // DeleteStream  Delete one stream.
 func (t *StreamClient) DeleteStream(streamName string) common.Status {
 	rc := checkNullClientPtr(t)
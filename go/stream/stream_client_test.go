@@ -271,6 +271,52 @@ func TestReceiveSomething1(t *testing.T) {
 	receiveAndCheckElements(t, consumer, slices)
 }
 
+func TestSendBatch(t *testing.T) {
+	var theClient *StreamClient
+	var s common.Status
+	var consumer *StreamConsumer
+	var producer *StreamProducer
+
+	if theClient, s = CreateClientForTest(); theClient == nil {
+		t.Fatalf(s.ToString())
+	}
+	defer theClient.DestroyClient()
+
+	var streamName string = "TestSendBatchStr"
+	var subConfig SubscriptionConfig
+	subConfig.SubName = "TestSendBatch"
+	subConfig.SubType = Stream
+
+	consumer, s = theClient.Subscribe(streamName, subConfig, false)
+	if s.IsError() {
+		t.Fatalf(s.ToString())
+	}
+
+	var delayFlushTime int64 = 5
+	var pageSize int64 = 4096
+	var maxStreamSize uint64 = 1024 * 1024 * 1024
+	producer, s = theClient.CreateProducer(streamName, delayFlushTime, pageSize,
+									maxStreamSize, false)
+	if s.IsError() {
+		t.Fatalf(s.ToString())
+	}
+	// More elements than one page holds, so the batch spills into the next page.
+	var numEle uint = 64
+	var sz uint = 100
+	slices := get2DSlice(numEle, sz)
+	elements := make([]Element, len(slices))
+	for i := range slices {
+		elements[i].Ptr = &slices[i][0]
+		elements[i].Size = uint64(len(slices[i]))
+	}
+	var timeoutMs int64 = 1000
+	s = producer.SendBatch(elements, timeoutMs)
+	if s.IsError() {
+		t.Fatalf(s.ToString())
+	}
+	receiveAndCheckElements(t, consumer, slices)
+}
+
 func TestReceiveSomething2(t *testing.T) {
 	fmt.Printf("TestReceiveSomething2 \n")
 	var theClient *StreamClient
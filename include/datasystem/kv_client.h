@@ -22,6 +22,7 @@
 
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 #include <future>
 
@@ -156,6 +157,28 @@ public:
     ///         K_RUNTIME_ERROR: client fd mmap failed
     Status Create(const std::string &key, uint64_t size, const SetParam &param, std::shared_ptr<Buffer> &buffer);
 
+    /// \brief Get the buffer of a key, or create it when the key is missing.
+    ///
+    /// Concurrent callers that miss the same key are coordinated by the metadata owner: exactly one of them is
+    /// granted a fill lease and gets a newly created buffer (created == true), which it must fill and then store
+    /// with Set(buffer). The others, including other calls on this client, wait up to subTimeoutMs for the value to
+    /// be set. The lease is held by this call only and is not renewed: if the holder does not set the key within
+    /// leaseMs, or its worker fails, the lease is handed to the next caller.
+    ///
+    /// \param[in] key The key.
+    /// \param[in] size The size in bytes of the buffer to create on miss.
+    /// \param[in] param The create parameters.
+    /// \param[out] buffer The existing value, or the new buffer to fill if created is true.
+    /// \param[out] created True if the caller holds the fill lease and must fill and set the buffer.
+    /// \param[in] subTimeoutMs timeoutMs of waiting for another caller to fill the key. 0 means no waiting.
+    /// \param[in] leaseMs How long the fill lease stays valid, in (0, 600000] ms.
+    ///
+    /// \return K_OK on success; the error code otherwise.
+    ///         K_INVALID: the key is empty or the params are invalid.
+    ///         K_TRY_AGAIN: another caller is still filling the key when subTimeoutMs elapses.
+    Status GetOrCreate(const std::string &key, uint64_t size, const SetParam &param, std::shared_ptr<Buffer> &buffer,
+                       bool &created, int32_t subTimeoutMs = 0, uint32_t leaseMs = 60000);
+
     /// \brief Store the shared memory buffer created by the Create interface to the data system.
     ///
     /// \param[in] buffer The buffer to set.
@@ -462,6 +485,22 @@ public:
     /// key; the error code otherwise.
     Status Exist(const std::vector<std::string> &keys, std::vector<bool> &exists);
 
+    /// \brief Match the longest cached prefix of a chain of keys, such as the block hashes of a KV cache.
+    ///
+    /// The keys are resolved in order and the lookup stops at the first key that no worker holds, so only the
+    /// leading keys up to the first miss are ever queried.
+    ///
+    /// \param[in] keys The chain of keys, in chain order. Each key must have a valid object-key format, and the
+    /// number of keys cannot exceed 100000.
+    /// \param[out] matchedCount The number of leading keys cached somewhere in the data system.
+    /// \param[out] workerPrefixes The address of each worker holding a prefix of the chain, with the length of the
+    /// prefix it holds, longest first. The worker prefixes are at most matchedCount long.
+    ///
+    /// \return K_OK on success; the error code otherwise.
+    ///         K_INVALID: the keys are empty, too many, or contain an invalid key.
+    Status MatchPrefix(const std::vector<std::string> &keys, size_t &matchedCount,
+                       std::vector<std::pair<std::string, size_t>> &workerPrefixes);
+
     /// \brief Sets expiration time for key list (in seconds)
     ///
     /// \param[in] key The keys to set expiration for.
@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "datasystem/stream/element.h"
 #include "datasystem/utils/status.h"
@@ -80,6 +81,35 @@ public:
      */
     Status Send(const Element &element, int64_t timeoutMs);
 
+    /**
+     * @brief Send elements of the stream in order. Compared to calling Send for each element, the space on a page is
+     * reserved once for as many elements as it can hold and consumers are woken up once per page.
+     * @param[in] elements The elements that to be written.
+     * @return K_OK on success; the error code otherwise, and the elements before the failed one have been sent.
+     *         K_UNKNOWN_ERROR: it's up to return message.
+     *         K_RUNTIME_ERROR: producer not init.
+     *         K_OUT_OF_MEMORY: out of memory, or unable to secure enough memory for the elements.
+     *         K_RUNTIME_ERROR: element copy failed, it's up to return message.
+     *         K_NOT_FOUND: the id of stream is not found.
+     *         K_RUNTIME_ERROR: can not find mmap file or mmap fd failed.
+     *         K_INVALID: invalid parameter, e.g. elements is empty.
+     *         K_SC_STREAM_IN_RESET_STATE: stream currently in reset state.
+     *         K_SC_ALREADY_CLOSED: producer is already closed/inactive.
+     *         K_SC_STREAM_IN_USE: another thread is calling API from the same producer at the same time.
+     */
+    Status SendBatch(const std::vector<Element> &elements);
+
+    /**
+     * @brief Send elements of the stream in order, blocking version.
+     * @param[in] elements The elements that to be written.
+     * @param[in] timeoutMs The amount of time in milliseconds to wait for the whole batch to be sent in the range of
+     * [0, INT32_MAX], with the same meaning as in Send.
+     * @return K_OK on success; the error code otherwise, and the elements before the failed one have been sent.
+     *         K_OUT_OF_MEMORY: out of memory, or unable to secure enough memory for the elements within timeoutMs.
+     *         The other error codes are the same as SendBatch without timeout.
+     */
+    Status SendBatch(const std::vector<Element> &elements, int64_t timeoutMs);
+
     /**
      * @brief Close the producer, after close it will not allow Send new Elements, and it will trigger flush operations
      *  when the local buffer had not flushed elements. Calling Close() on an already closed producer will return K_OK.
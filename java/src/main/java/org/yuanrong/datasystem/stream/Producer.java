@@ -17,6 +17,7 @@
 package org.yuanrong.datasystem.stream;
 
 import java.nio.ByteBuffer;
+import java.util.List;
 
 /**
  * The producer interface of stream in client.
@@ -39,6 +40,22 @@ public interface Producer {
      */
     void send(ByteBuffer buffer, int timeoutMs);
 
+    /**
+     * Send the buffers in order with one call, which reserves the page space once for as many buffers as fit.
+     * If it fails, the buffers before the failed one have been sent.
+     *
+     * @param buffers The buffers to be send.
+     */
+    void sendBatch(List<ByteBuffer> buffers);
+
+    /**
+     * Send the buffers in order with one call, blocking version.
+     *
+     * @param buffers The buffers to be send.
+     * @param timeoutMs The timeout millisecond of all the buffers to be sent.
+     */
+    void sendBatch(List<ByteBuffer> buffers, int timeoutMs);
+
     /**
      * Close a producer, register a publisher to a stream.
      */
@@ -19,6 +19,7 @@ package org.yuanrong.datasystem.stream;
 import org.yuanrong.datasystem.DataSystemException;
 
 import java.nio.ByteBuffer;
+import java.util.List;
 import java.util.Objects;
 import java.util.concurrent.locks.Lock;
 import java.util.concurrent.locks.ReentrantReadWriteLock;
@@ -71,6 +72,39 @@ class ProducerImpl implements Producer {
         }
     }
 
+    @Override
+    public void sendBatch(List<ByteBuffer> buffers) {
+        sendBatchImpl(buffers, -1);
+    }
+
+    @Override
+    public void sendBatch(List<ByteBuffer> buffers, int timeoutMs) {
+        if (timeoutMs < 0) {
+            throw new DataSystemException("The send timeout must be greater than or equal to 0");
+        }
+        sendBatchImpl(buffers, timeoutMs);
+    }
+
+    private void sendBatchImpl(List<ByteBuffer> buffers, int timeoutMs) {
+        if (buffers == null || buffers.isEmpty()) {
+            throw new DataSystemException("The buffers to send are empty");
+        }
+        // A direct buffer is passed as is, a heap buffer as its backing array.
+        Object[] elements = new Object[buffers.size()];
+        long[] lens = new long[buffers.size()];
+        for (int i = 0; i < buffers.size(); i++) {
+            ByteBuffer buffer = buffers.get(i);
+            elements[i] = buffer.isDirect() ? buffer : buffer.array();
+            lens[i] = buffer.limit();
+        }
+        rLock.lock();
+        try {
+            ensureOpen();
+            sendBatch(producerPtr, elements, lens, timeoutMs);
+        } finally {
+            rLock.unlock();
+        }
+    }
 
     /**
      * Checks to make sure that producer has not been closed.
@@ -132,6 +166,8 @@ class ProducerImpl implements Producer {
 
     private static native void sendDirectBuffer(long producerPtr, ByteBuffer buffers, int timeoutMs);
 
+    private static native void sendBatch(long producerPtr, Object[] elements, long[] lens, int timeoutMs);
+
     private static native void close(long producerPtr);
 
     private static native void freeJNIPtrNative(long producerPtr);
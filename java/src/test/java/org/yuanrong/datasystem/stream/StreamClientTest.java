@@ -349,6 +349,31 @@ public class StreamClientTest {
         }
     }
 
+    @Test
+    public void testSendBatch() {
+        logger.info("******************** testSendBatch **********************");
+        String streamName = "testSendBatch";
+        StreamClient client = getStreamClient(1).get(0);
+        Producer producer = client.createProducer(streamName);
+        Consumer consumer = client.subscribe(streamName, "sub", SubscriptionType.STREAM);
+        try {
+            byte[] bytes = "10101010".getBytes(StandardCharsets.UTF_8);
+            ByteBuffer heapBuffer = ByteBuffer.wrap(bytes);
+            ByteBuffer directBuffer = ByteBuffer.allocateDirect(bytes.length);
+            directBuffer.put(bytes);
+            producer.sendBatch(Arrays.asList(heapBuffer, directBuffer), 1000);
+
+            List<Element> elements = consumer.receive(2, 500);
+            Assert.assertEquals(elements.size(), 2);
+            Assert.assertEquals(elements.get(0).getBuffer(), heapBuffer);
+            Assert.assertEquals(elements.get(1).getBuffer(), directBuffer.flip());
+        } finally {
+            producer.close();
+            consumer.close();
+            client.close();
+        }
+    }
+
     @Test
     public void testStreamSametimeSendDemo() throws InterruptedException {
         logger.info("******************** testStreamSametimeSendDemo **********************");
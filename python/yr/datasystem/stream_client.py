@@ -235,6 +235,35 @@ class Producer:
             if status.is_error():
                 raise RuntimeError(status.to_string())
 
+    def send_batch(self, elements, timeout_ms=None):
+        """ Produce send elements of the stream in order with one call. The page space is reserved once for as many
+        elements as the page can hold, which is cheaper than calling send for each small element.
+
+        Args:
+            elements: The list of elements that to be written, each is memoryview or bytes or bytearray.
+            timeout_ms: The amount of time in milliseconds to wait for the whole batch to be sent in the range of
+                [0, INT32_MAX], with the same meaning as in send.
+
+        Raise:
+            TypeError: Raise a type error if the input parameter is invalid.
+            RutimeError: Raise a runtime error if sending the elements fails, the elements before the failed one
+                have been sent.
+        """
+        if not isinstance(elements, list) or not elements:
+            raise TypeError("The input of elements should be a non-empty list.")
+        for element_bytes in elements:
+            if not isinstance(element_bytes, (memoryview, bytes, bytearray)):
+                raise TypeError("The element of elements should be memoryview or bytes or bytearray.")
+        if timeout_ms is None:
+            timeout_ms = -1
+        else:
+            if not isinstance(timeout_ms, int):
+                raise TypeError("The input of timeout_ms should be int.")
+            validator.check_param_range("timeout_ms", timeout_ms, 0, validator.INT32_MAX_SIZE)
+        status = self._producer.SendBatch(elements, timeout_ms)
+        if status.is_error():
+            raise RuntimeError(status.to_string())
+
     def close(self):
         """ Close a producer, register a publisher to a stream.
 
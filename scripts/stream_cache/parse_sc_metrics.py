@@ -38,6 +38,10 @@ stream_headers = [
     "NumLocalProducersBlocked",
     "NumRemoteProducersBlocked",
     "NumRemoteConsumersBlocking",
+    "NumPagesSpilled",
+    "NumPagesReadBack",
+    "SpillWriteBandwidth",
+    "SpillReadBandwidth",
     "RetainDataState",
     "StreamState",
 ]
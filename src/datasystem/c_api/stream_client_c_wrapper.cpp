@@ -288,6 +288,31 @@ struct StatusC StreamProducerSend(Producer_p producerPtr, uint8_t *ptr, uint64_t
     return StatusC{ datasystem::K_OK, {} };
 }
 
+struct StatusC StreamProducerSendBatch(Producer_p producerPtr, uint8_t **ptrs, uint64_t *sizes, uint64_t count,
+                                       int64_t timeoutMs)
+{
+    std::string errorMsg;
+    CheckNullptr(producerPtr, "producer", errorMsg);
+    CheckNullptr(ptrs, "ptrs", errorMsg);
+    CheckNullptr(sizes, "sizes", errorMsg);
+    if (!errorMsg.empty()) {
+        return MakeStatusC(datasystem::K_INVALID, errorMsg);
+    }
+
+    std::vector<datasystem::Element> elements;
+    elements.reserve(count);
+    for (uint64_t i = 0; i < count; i++) {
+        elements.emplace_back(ptrs[i], sizes[i]);
+    }
+    auto producer = *reinterpret_cast<std::shared_ptr<datasystem::Producer> *>(producerPtr);
+    datasystem::Status rc = timeoutMs < 0 ? producer->SendBatch(elements) : producer->SendBatch(elements, timeoutMs);
+    if (rc.IsError()) {
+        return ToStatusC(rc);
+    }
+
+    return StatusC{ datasystem::K_OK, {} };
+}
+
 struct StatusC QueryGlobalProducersNum(StreamClient_p clientPtr, const char *streamName, size_t streamNameLen,
                                        uint64_t *gProducerNum)
 {
@@ -195,6 +195,18 @@ struct StatusC StreamCreateProducerWithConfig(StreamClient_p clientPtr, const ch
  */
 struct StatusC StreamProducerSend(Producer_p producerPtr, uint8_t *ptr, uint64_t size, uint64_t id);
 
+/**
+ * @brief Producer sends elements in one batch
+ * @param[in] producerPtr The pointer to the producer
+ * @param[in] ptrs The pointers to the elements to send
+ * @param[in] sizes The sizes of the elements
+ * @param[in] count The number of elements
+ * @param[in] timeoutMs The timeout in milliseconds, a negative value to use the default timeout
+ * @return status of the call
+ */
+struct StatusC StreamProducerSendBatch(Producer_p producerPtr, uint8_t **ptrs, uint64_t *sizes, uint64_t count,
+                                       int64_t timeoutMs);
+
 /**
  * @brief QueryGlobalProducersNum
  * @param[in] clientPtr clientPtr The instance of the stream cache client to connect with
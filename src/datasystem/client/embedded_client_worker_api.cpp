@@ -68,6 +68,8 @@ Status EmbeddedClientWorkerApi::LoadPlugin()
     DLSYM_FUNC_OBJ(WorkerOCHealthCheck, handle);
     DLSYM_FUNC_OBJ(WorkerOCExist, handle);
     DLSYM_FUNC_OBJ(WorkerOCExpire, handle);
+    DLSYM_FUNC_OBJ(WorkerOCAcquireFillLease, handle);
+    DLSYM_FUNC_OBJ(WorkerOCMatchPrefix, handle);
     DLSYM_FUNC_OBJ(WorkerOCGetMetaInfo, handle);
     return Status::OK();
 }
@@ -282,6 +284,19 @@ Status EmbeddedClientWorkerApi::WorkerOCExpire(void *obj, const ExpireReqPb &req
     return WorkerOCExpireFunc_(obj, req, resp);
 }
 
+Status EmbeddedClientWorkerApi::WorkerOCAcquireFillLease(void *obj, const AcquireFillLeaseReqPb &req,
+                                                         AcquireFillLeaseRspPb &resp)
+{
+    RETURN_RUNTIME_ERROR_IF_NULL(WorkerOCAcquireFillLeaseFunc_);
+    return WorkerOCAcquireFillLeaseFunc_(obj, req, resp);
+}
+
+Status EmbeddedClientWorkerApi::WorkerOCMatchPrefix(void *obj, const MatchPrefixReqPb &req, MatchPrefixRspPb &resp)
+{
+    RETURN_RUNTIME_ERROR_IF_NULL(WorkerOCMatchPrefixFunc_);
+    return WorkerOCMatchPrefixFunc_(obj, req, resp);
+}
+
 Status EmbeddedClientWorkerApi::WorkerOCGetMetaInfo(void *obj, const GetMetaInfoReqPb &req, GetMetaInfoRspPb &resp)
 {
     RETURN_RUNTIME_ERROR_IF_NULL(WorkerOCGetMetaInfoFunc_);
@@ -74,6 +74,8 @@ public:
     Status WorkerOCHealthCheck(void *obj, const HealthCheckRequestPb &req, HealthCheckReplyPb &resp);
     Status WorkerOCExist(void *obj, const ExistReqPb &req, ExistRspPb &resp);
     Status WorkerOCExpire(void *obj, const ExpireReqPb &req, ExpireRspPb &resp);
+    Status WorkerOCAcquireFillLease(void *obj, const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &resp);
+    Status WorkerOCMatchPrefix(void *obj, const MatchPrefixReqPb &req, MatchPrefixRspPb &resp);
     Status WorkerOCGetMetaInfo(void *obj, const GetMetaInfoReqPb &req, GetMetaInfoRspPb &resp);
 
 private:
@@ -115,6 +117,8 @@ private:
     REG_METHOD(WorkerOCHealthCheck, Status, void *, const HealthCheckRequestPb &, HealthCheckReplyPb &);
     REG_METHOD(WorkerOCExist, Status, void *, const ExistReqPb &, ExistRspPb &);
     REG_METHOD(WorkerOCExpire, Status, void *, const ExpireReqPb &, ExpireRspPb &);
+    REG_METHOD(WorkerOCAcquireFillLease, Status, void *, const AcquireFillLeaseReqPb &, AcquireFillLeaseRspPb &);
+    REG_METHOD(WorkerOCMatchPrefix, Status, void *, const MatchPrefixReqPb &, MatchPrefixRspPb &);
     REG_METHOD(WorkerOCGetMetaInfo, Status, void *, const GetMetaInfoReqPb &, GetMetaInfoRspPb &);
 };
 }  // namespace client
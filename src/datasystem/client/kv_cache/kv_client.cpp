@@ -139,6 +139,33 @@ Status KVClient::Create(const std::string &key, uint64_t size, const SetParam &p
     return rc;
 }
 
+Status KVClient::GetOrCreate(const std::string &key, uint64_t size, const SetParam &param,
+                             std::shared_ptr<Buffer> &buffer, bool &created, int32_t subTimeoutMs, uint32_t leaseMs)
+{
+    ScopedClientRequestContext requestContext;
+    TraceGuard traceGuard = Trace::Instance().SetRequestTraceUUID();
+    PerfPoint point(PerfKey::KV_CLIENT_GET_OR_CREATE_BUFFER);
+    auto access = AccessRecorder::Object(AccessRecorderKey::DS_KV_CLIENT_GET_OR_CREATE);
+    object_cache::FullParam creatParam;
+    creatParam.writeMode = param.writeMode;
+    creatParam.ttlSecond = param.ttlSecond;
+    creatParam.consistencyType = ConsistencyType::CAUSAL;
+    creatParam.cacheType = param.cacheType;
+    creatParam.existence = param.existence;
+    created = false;
+    Status rc = impl_->GetOrCreate(key, size, creatParam, subTimeoutMs, leaseMs, buffer, created);
+    if (rc.IsOk() && created) {
+        rc = buffer->UsePageableMemoryIfCudaHostMemoryPinPending();
+        if (rc.IsError()) {
+            buffer.reset();
+        }
+    }
+    size_t dataSize = rc.IsOk() ? buffer->GetSize() : 0;
+    access.ObjectKeyRef(key).TimeoutMs(subTimeoutMs).WriteMode(static_cast<int>(param.writeMode))
+        .TtlSecond(param.ttlSecond).DataSize(dataSize).Result(rc).Record();
+    return rc;
+}
+
 Status KVClient::MCreate(const std::vector<std::string> &keys, const std::vector<uint64_t> &sizes,
 const SetParam &param, std::vector<std::shared_ptr<Buffer>> &buffers)
 {
@@ -607,6 +634,19 @@ Status KVClient::Exist(const std::vector<std::string> &keys, std::vector<bool> &
     return rc;
 }
 
+Status KVClient::MatchPrefix(const std::vector<std::string> &keys, size_t &matchedCount,
+                             std::vector<std::pair<std::string, size_t>> &workerPrefixes)
+{
+    ScopedClientRequestContext requestContext;
+    TraceGuard traceGuard = Trace::Instance().SetRequestTraceUUID();
+    PerfPoint point(PerfKey::KV_CLIENT_MATCH_PREFIX);
+    auto access = AccessRecorder::Object(AccessRecorderKey::DS_KV_CLIENT_MATCH_PREFIX);
+    matchedCount = 0;
+    Status rc = impl_->MatchPrefix(keys, matchedCount, workerPrefixes);
+    access.ObjectKeysRef(keys).Result(rc).Record();
+    return rc;
+}
+
 Status KVClient::Expire(const std::vector<std::string> &keys, uint32_t ttlSeconds, std::vector<std::string> &failedKeys)
 {
     ScopedClientRequestContext requestContext;
@@ -19,6 +19,7 @@
  */
 #include "datasystem/client/mmap/shm_mmap_table_entry.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <exception>
@@ -28,6 +29,7 @@
 
 #include "datasystem/common/device/nvidia/cuda_host_memory.h"
 #include "datasystem/common/inject/inject_point.h"
+#include "datasystem/common/util/huge_page_util.h"
 #include "datasystem/common/util/strings_util.h"
 
 namespace datasystem {
@@ -42,12 +44,20 @@ Status ShmMmapTableEntry::Init(bool enableHugeTlb, const std::string &tenantId)
         RETURN_STATUS(StatusCode::K_INVALID, err.str());
     }
     INJECT_POINT("IMmapTableEntry.mmap");
-    // mmap fd
+    // mmap fd. The worker falls back to regular pages when its huge page pool is short, so the page size comes from
+    // the fd itself: MAP_HUGETLB on a regular shmem fd fails with EINVAL.
     uint32_t mFlag = MAP_SHARED;
-    if (enableHugeTlb) {
+    uint64_t hugeTlbPageSize = GetHugeTlbPageSize(fd_);
+    if (hugeTlbPageSize != 0) {
         mFlag |= MAP_HUGETLB;
+        // munmap of a hugetlb mapping requires a length aligned to its page size.
+        size_ = AlignUp(size_, hugeTlbPageSize);
+    } else if (enableHugeTlb) {
+        LOG(INFO) << FormatString("Worker fd %d is not backed by huge tlb, map it with regular pages", fd_);
     }
-    pointer_ = reinterpret_cast<uint8_t *>(mmap(nullptr, size_, PROT_READ | PROT_WRITE, mFlag, fd_, 0));
+    // Align the address to a huge page so huge pages of the worker are also mapped with one entry each here.
+    pointer_ = reinterpret_cast<uint8_t *>(MmapAligned(size_, PROT_READ | PROT_WRITE, mFlag, fd_,
+                                                       std::max<uint64_t>(hugeTlbPageSize, PMD_HUGE_PAGE_SIZE)));
     if (pointer_ == MAP_FAILED) {
         RETURN_STATUS_LOG_ERROR(
             StatusCode::K_RUNTIME_ERROR,
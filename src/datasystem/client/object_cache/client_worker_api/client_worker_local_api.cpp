@@ -680,6 +680,35 @@ Status ClientWorkerLocalApi::Expire(const std::vector<std::string> &keys, uint32
     return Status::OK();
 }
 
+Status ClientWorkerLocalApi::AcquireFillLease(const std::string &key, const std::string &token, uint32_t leaseMs,
+                                              FillLeaseStatePb &state, uint32_t &remainingMs)
+{
+    GetRequestContext()->reqTimeoutDuration.Init(ClientGetRequestTimeout(requestTimeoutMs_));
+    AcquireFillLeaseReqPb req;
+    req.set_client_id(clientId_);
+    req.set_object_key(key);
+    req.set_lease_token(token);
+    req.set_lease_ms(leaseMs);
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(SetTokenAndTenantId(req), "Fail to set token to AcquireFillLeaseReqPb.");
+    RETURN_IF_NOT_OK(signature_->GenerateSignature(req));
+    AcquireFillLeaseRspPb rsp;
+    RETURN_IF_NOT_OK(api_->WorkerOCAcquireFillLease(workerOCService_, req, rsp));
+    state = rsp.state();
+    remainingMs = rsp.remaining_ms();
+    return Status::OK();
+}
+
+Status ClientWorkerLocalApi::MatchPrefix(const std::vector<std::string> &keys, MatchPrefixRspPb &rsp)
+{
+    GetRequestContext()->reqTimeoutDuration.Init(ClientGetRequestTimeout(requestTimeoutMs_));
+    MatchPrefixReqPb req;
+    req.set_client_id(clientId_);
+    *req.mutable_object_keys() = { keys.begin(), keys.end() };
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(SetTokenAndTenantId(req), "Fail to set token to MatchPrefixReqPb.");
+    RETURN_IF_NOT_OK(signature_->GenerateSignature(req));
+    return api_->WorkerOCMatchPrefix(workerOCService_, req, rsp);
+}
+
 Status ClientWorkerLocalApi::GetMetaInfo(const std::vector<std::string> &keys, const bool isDevKey,
                                          GetMetaInfoRspPb &rsp)
 {
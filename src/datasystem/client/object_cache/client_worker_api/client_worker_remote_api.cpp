@@ -1592,6 +1592,56 @@ Status ClientWorkerRemoteApi::Expire(const std::vector<std::string> &keys, uint3
     return Status::OK();
 }
 
+Status ClientWorkerRemoteApi::AcquireFillLease(const std::string &key, const std::string &token, uint32_t leaseMs,
+                                               FillLeaseStatePb &state, uint32_t &remainingMs)
+{
+    AcquireFillLeaseReqPb req;
+    req.set_client_id(clientId_);
+    req.set_object_key(key);
+    req.set_lease_token(token);
+    req.set_lease_ms(leaseMs);
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(SetTokenAndTenantId(req), "Fail to set token to AcquireFillLeaseReqPb.");
+    AcquireFillLeaseRspPb rsp;
+    auto status = RetryOnError(
+        requestTimeoutMs_,
+        [this, &req, &rsp](int32_t realRpcTimeout) {
+            RpcOptions opts;
+            opts.SetTimeout(realRpcTimeout);
+            GetRequestContext()->reqTimeoutDuration.Init(ClientGetRequestTimeout(realRpcTimeout));
+            RETURN_IF_NOT_OK(signature_->GenerateSignature(req));
+            return DS_OC_DISPATCH(AcquireFillLease, opts, req, rsp);
+        },
+        []() { return Status::OK(); }, RETRY_ERROR_CODE, rpcTimeoutMs_);
+    if (status.IsError()) {
+        return WithRpcDiag(status, "AcquireFillLease", hostPort_);
+    }
+    state = rsp.state();
+    remainingMs = rsp.remaining_ms();
+    return Status::OK();
+}
+
+Status ClientWorkerRemoteApi::MatchPrefix(const std::vector<std::string> &keys, MatchPrefixRspPb &rsp)
+{
+    MatchPrefixReqPb req;
+    req.set_client_id(clientId_);
+    *req.mutable_object_keys() = { keys.begin(), keys.end() };
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(SetTokenAndTenantId(req), "Fail to set token to MatchPrefixReqPb.");
+    auto status = RetryOnError(
+        requestTimeoutMs_,
+        [this, &req, &rsp](int32_t realRpcTimeout) {
+            RpcOptions opts;
+            opts.SetTimeout(realRpcTimeout);
+            GetRequestContext()->reqTimeoutDuration.Init(ClientGetRequestTimeout(realRpcTimeout));
+            RETURN_IF_NOT_OK(signature_->GenerateSignature(req));
+            return DS_OC_DISPATCH(MatchPrefix, opts, req, rsp);
+        },
+        []() { return Status::OK(); }, RETRY_ERROR_CODE, rpcTimeoutMs_);
+    if (status.IsError()) {
+        return WithRpcDiag(status, "MatchPrefix", hostPort_);
+    }
+    return Status::OK();
+}
+
 Status ClientWorkerRemoteApi::GetMetaInfo(const std::vector<std::string> &keys, const bool isDevKey,
                                           GetMetaInfoRspPb &rsp)
 {
@@ -138,6 +138,9 @@ public:
                  const bool isLocal) override;
     Status Expire(const std::vector<std::string> &keys, uint32_t ttlSeconds,
                   std::vector<std::string> &failedKeys) override;
+    Status AcquireFillLease(const std::string &key, const std::string &token, uint32_t leaseMs,
+                            FillLeaseStatePb &state, uint32_t &remainingMs) override;
+    Status MatchPrefix(const std::vector<std::string> &keys, MatchPrefixRspPb &rsp) override;
     Status GetMetaInfo(const std::vector<std::string> &keys, const bool isDevKey, GetMetaInfoRspPb &metaInfos) override;
     Status ReconnectWorker(const std::vector<std::string> &gRefIds) override;
     void RecreateOCStub();
@@ -416,6 +416,26 @@ public:
     virtual Status Expire(const std::vector<std::string> &keys, uint32_t ttlSeconds,
                           std::vector<std::string> &failedKeys) = 0;
 
+    /**
+     * @brief Acquire the GetOrCreate fill lease of a missing object.
+     * @param[in] key The object key.
+     * @param[in] token The token of the GetOrCreate call, unique per call.
+     * @param[in] leaseMs How long the lease stays valid if the caller never publishes the object.
+     * @param[out] state Whether the object exists, the lease is granted, or another caller is filling it.
+     * @param[out] remainingMs The remaining lease time of the current holder.
+     * @return K_OK on success; the error code otherwise.
+     */
+    virtual Status AcquireFillLease(const std::string &key, const std::string &token, uint32_t leaseMs,
+                                    FillLeaseStatePb &state, uint32_t &remainingMs) = 0;
+
+    /**
+     * @brief Match the longest cached prefix of a chain of keys.
+     * @param[in] keys The chain of keys, in chain order.
+     * @param[out] rsp The matched prefix length and the prefix length held by each worker.
+     * @return K_OK on success; the error code otherwise.
+     */
+    virtual Status MatchPrefix(const std::vector<std::string> &keys, MatchPrefixRspPb &rsp) = 0;
+
     /**
      * @brief Get device meta info of the keys.
      * @param[in] keys The keys to be queried. Constraint: The number of keys cannot exceed 10000.
@@ -73,6 +73,7 @@
 #include "datasystem/common/log/logging.h"
 #include "datasystem/common/log/operation_logger.h"
 #include "datasystem/common/log/trace.h"
+#include "datasystem/common/log/trace_timeline.h"
 #include "datasystem/common/log/spdlog/provider.h"
 #include "datasystem/common/parallel/parallel_for.h"
 #include "datasystem/common/rdma/fast_transport_manager_wrapper.h"
@@ -712,6 +713,7 @@ Status ObjectClientImpl::ShutDown(bool &needRollbackState, bool isDestruct)
     if (!needRollbackState) {
         return rc;
     }
+    LOG_IF_ERROR(TraceTimeline::Instance().ExportToConfiguredDir(), "Failed to export the trace timeline");
     // When invoked from ~ObjectClientImpl (isDestruct=true), this runs during process
     // teardown if the client is process-static (e.g. a static shared_ptr<ObjectClient>
     // in a test, or a global in an embedding host). C++ destroys thread_local objects
@@ -3225,8 +3227,8 @@ Status ObjectClientImpl::MultiCreateRouted(const std::vector<std::string> &objec
     exists.assign(sz, false);
     auto routing = std::atomic_load(&routing_);
     RETURN_RUNTIME_ERROR_IF_NULL(routing);
-    std::unordered_map<HostPort, std::vector<std::string>> groupedKeys;
-    RETURN_IF_NOT_OK(routing->SelectWorkers(objectKeyList, dataPlacementPolicy_, groupedKeys));
+    std::unordered_map<HostPort, std::vector<size_t>> groupedIndexes;
+    RETURN_IF_NOT_OK(routing->SelectWorkerIndexes(objectKeyList, dataPlacementPolicy_, groupedIndexes));
     // Map each key back to its original position so results land in the caller's order.
     std::unordered_map<std::string, size_t> keyIndex;
     keyIndex.reserve(sz);
@@ -3244,13 +3246,16 @@ Status ObjectClientImpl::MultiCreateRouted(const std::vector<std::string> &objec
             }
         }
     };
-    for (auto &entry : groupedKeys) {
+    for (const auto &entry : groupedIndexes) {
+        std::vector<std::string> keys;
         std::vector<uint64_t> sizes;
+        keys.reserve(entry.second.size());
         sizes.reserve(entry.second.size());
-        for (const auto &key : entry.second) {
-            sizes.emplace_back(dataSizeList[keyIndex[key]]);  // key from SelectWorkers(input) is in keyIndex
+        for (auto index : entry.second) {
+            keys.emplace_back(objectKeyList[index]);
+            sizes.emplace_back(dataSizeList[index]);
         }
-        auto rc = ProcessRoutedMCreateGroup(entry.first, entry.second, sizes, param, keyIndex, bufferList);
+        auto rc = ProcessRoutedMCreateGroup(entry.first, keys, sizes, param, keyIndex, bufferList);
         if (rc.IsError()) {
             releaseAllocated();
             bufferList.clear();
@@ -5292,25 +5297,24 @@ void ObjectClientImpl::BuildTransportReadRequest(const std::vector<std::string>
             << "[TransportGet][Route] Route is not ready, key count: " << objectKeys.size();
         return;
     }
-    std::unordered_map<HostPort, std::vector<std::string>> groupedKeys;
+    std::unordered_map<HostPort, std::vector<size_t>> groupedIndexes;
     Status routeStatus =
-        routing->SelectWorkers(objectKeys, client::DataPlacementPolicy::PREFERRED_META_OWNER, groupedKeys);
+        routing->SelectWorkerIndexes(objectKeys, client::DataPlacementPolicy::PREFERRED_META_OWNER, groupedIndexes);
     if (routeStatus.IsError()) {
         std::fill(itemStatuses.begin(), itemStatuses.end(), routeStatus);
         LOG(ERROR) << "[TransportGet][Route] Route selection failed, key count: " << objectKeys.size()
                    << ", status: " << routeStatus.ToString();
         return;
     }
-    std::unordered_map<std::string, HostPort> metaOwners;
-    metaOwners.reserve(objectKeys.size());
-    for (const auto &group : groupedKeys) {
-        for (const auto &key : group.second) {
-            metaOwners.emplace(key, group.first);
+    std::vector<const HostPort *> metaOwners(objectKeys.size(), nullptr);
+    for (const auto &group : groupedIndexes) {
+        for (auto index : group.second) {
+            metaOwners[index] = &group.first;
         }
     }
     for (size_t i = 0; i < objectKeys.size(); ++i) {
-        auto owner = metaOwners.find(objectKeys[i]);
-        if (owner == metaOwners.end()) {
+        const HostPort *owner = metaOwners[i];
+        if (owner == nullptr) {
             itemStatuses[i] = Status(K_RUNTIME_ERROR, "Batch route result is incomplete");
             LOG_EVERY_N(ERROR, TRANSPORT_DIAG_LOG_RATE)
                 << "[TransportGet][Route] Route result is incomplete, key: " << objectKeys[i]
@@ -5318,12 +5322,12 @@ void ObjectClientImpl::BuildTransportReadRequest(const std::vector<std::string>
             continue;
         }
         itemStatuses[i] = Status::OK();
-        request.items.push_back({ i, objectKeys[i], owner->second });
+        request.items.push_back({ i, objectKeys[i], *owner });
     }
     const size_t routed = request.items.size();
     const size_t failed = objectKeys.size() >= routed ? objectKeys.size() - routed : 0;
     VLOG(1) << "[TransportGet][Route] Route selection completed, key count: " << objectKeys.size()
-            << ", routed: " << routed << ", failed: " << failed << ", meta owner count: " << groupedKeys.size();
+            << ", routed: " << routed << ", failed: " << failed << ", meta owner count: " << groupedIndexes.size();
 }
 
 void ObjectClientImpl::BuildClientDirectRH2DReadRequest(const std::vector<std::string> &objectKeys,
@@ -7098,25 +7102,19 @@ Status ObjectClientImpl::BuildMSetRouteGroups(const std::vector<std::string> &ke
 {
     auto routing = std::atomic_load(&routing_);
     RETURN_RUNTIME_ERROR_IF_NULL(routing);
-    std::unordered_map<HostPort, std::vector<std::string>> groupedKeys;
-    RETURN_IF_NOT_OK(routing->SelectWorkers(keys, dataPlacementPolicy_, groupedKeys,
-                                            MergeWriteTargetExclusions({})));
-    std::unordered_map<std::string, size_t> valueIndexes;
-    valueIndexes.reserve(keys.size());
-    for (size_t i = 0; i < keys.size(); ++i) {
-        valueIndexes.emplace(keys[i], i);
-    }
-    groups.reserve(groupedKeys.size());
+    std::unordered_map<HostPort, std::vector<size_t>> groupedIndexes;
+    RETURN_IF_NOT_OK(routing->SelectWorkerIndexes(keys, dataPlacementPolicy_, groupedIndexes,
+                                                  MergeWriteTargetExclusions({})));
+    groups.reserve(groupedIndexes.size());
     size_t groupedKeyCount = 0;
-    for (auto &entry : groupedKeys) {
+    for (const auto &entry : groupedIndexes) {
         MSetRouteGroup group;
         group.worker = entry.first;
-        group.keys = std::move(entry.second);
-        group.values.reserve(group.keys.size());
-        for (const auto &key : group.keys) {
-            auto iter = valueIndexes.find(key);
-            CHECK_FAIL_RETURN_STATUS(iter != valueIndexes.end(), K_RUNTIME_ERROR, "MSet route contains unknown key");
-            group.values.emplace_back(values[iter->second]);
+        group.keys.reserve(entry.second.size());
+        group.values.reserve(entry.second.size());
+        for (auto index : entry.second) {
+            group.keys.emplace_back(keys[index]);
+            group.values.emplace_back(values[index]);
         }
         groupedKeyCount += group.keys.size();
         groups.emplace_back(std::move(group));
@@ -7217,25 +7215,18 @@ Status ObjectClientImpl::BuildMSetRetryRouteGroups(const MSetRouteGroup &group,
 {
     auto routing = std::atomic_load(&routing_);
     RETURN_RUNTIME_ERROR_IF_NULL(routing);
-    std::unordered_map<HostPort, std::vector<std::string>> groupedKeys;
-    RETURN_IF_NOT_OK(routing->SelectWorkers(group.keys, dataPlacementPolicy_, groupedKeys,
-                                            MergeWriteTargetExclusions(excludedWorkers)));
-    std::unordered_map<std::string, size_t> valueIndexes;
-    valueIndexes.reserve(group.keys.size());
-    for (size_t i = 0; i < group.keys.size(); ++i) {
-        valueIndexes.emplace(group.keys[i], i);
-    }
-    groups.reserve(groupedKeys.size());
-    for (auto &entry : groupedKeys) {
+    std::unordered_map<HostPort, std::vector<size_t>> groupedIndexes;
+    RETURN_IF_NOT_OK(routing->SelectWorkerIndexes(group.keys, dataPlacementPolicy_, groupedIndexes,
+                                                  MergeWriteTargetExclusions(excludedWorkers)));
+    groups.reserve(groupedIndexes.size());
+    for (const auto &entry : groupedIndexes) {
         MSetRouteGroup retryGroup;
         retryGroup.worker = entry.first;
-        retryGroup.keys = std::move(entry.second);
-        retryGroup.values.reserve(retryGroup.keys.size());
-        for (const auto &key : retryGroup.keys) {
-            auto value = valueIndexes.find(key);
-            CHECK_FAIL_RETURN_STATUS(value != valueIndexes.end(), K_RUNTIME_ERROR,
-                                     "MSet retry route contains unknown key");
-            retryGroup.values.emplace_back(group.values[value->second]);
+        retryGroup.keys.reserve(entry.second.size());
+        retryGroup.values.reserve(entry.second.size());
+        for (auto index : entry.second) {
+            retryGroup.keys.emplace_back(group.keys[index]);
+            retryGroup.values.emplace_back(group.values[index]);
         }
         groups.emplace_back(std::move(retryGroup));
     }
@@ -8226,6 +8217,82 @@ Status ObjectClientImpl::Expire(const std::vector<std::string> &keys, uint32_t t
     return Status::OK();
 }
 
+Status ObjectClientImpl::GetOrCreate(const std::string &objectKey, uint64_t dataSize, const FullParam &param,
+                                     int32_t subTimeoutMs, uint32_t leaseMs, std::shared_ptr<Buffer> &buffer,
+                                     bool &created)
+{
+    PerfPoint perfPoint(PerfKey::CLIENT_GET_OR_CREATE_OBJECT);
+    RETURN_IF_NOT_OK(IsClientReady());
+    RETURN_IF_NOT_OK(CheckValidObjectKey(objectKey));
+    CHECK_FAIL_RETURN_STATUS(subTimeoutMs >= 0, K_INVALID, "The subTimeoutMs should not be negative");
+    created = false;
+    // Identifies this call as the lease holder; other calls of the same client must not be granted its lease.
+    const std::string leaseToken = GetStringUuid();
+    Timer timer;
+    int64_t waitMs = 0;
+    while (true) {
+        std::vector<Optional<Buffer>> buffers;
+        Status rc = Get({ objectKey }, waitMs, buffers);
+        if (rc.IsOk()) {
+            buffer = std::make_shared<Buffer>(std::move(*buffers[0]));
+            return rc;
+        }
+        if (rc.GetCode() != K_NOT_FOUND) {
+            return rc;
+        }
+        FillLeaseStatePb state;
+        uint32_t remainingMs = 0;
+        {
+            ApiDeadlineGuard deadlineGuard(requestTimeoutMs_);
+            std::shared_ptr<IClientWorkerApi> workerApi;
+            std::unique_ptr<Raii> raii;
+            RETURN_IF_NOT_OK(GetAvailableWorkerApi(workerApi, raii));
+            RETURN_IF_NOT_OK(workerApi->AcquireFillLease(objectKey, leaseToken, leaseMs, state, remainingMs));
+        }
+        if (state == FillLeaseStatePb::FILL_LEASE_GRANTED) {
+            // The master re-checks the meta after granting, so the object did not exist when the lease was granted.
+            RETURN_IF_NOT_OK(Create(objectKey, dataSize, param, buffer));
+            created = true;
+            perfPoint.Record();
+            return Status::OK();
+        }
+        if (state == FillLeaseStatePb::FILL_LEASE_EXISTS) {
+            waitMs = 0;
+            continue;
+        }
+        // Being filled by another caller: subscribe to the key until it is published or the holder's lease ends, then
+        // try to take the lease over.
+        int64_t leftMs = static_cast<int64_t>(subTimeoutMs) - static_cast<int64_t>(timer.ElapsedMilliSecond());
+        CHECK_FAIL_RETURN_STATUS(leftMs > 0, K_TRY_AGAIN,
+                                 FormatString("The object %s is being filled by another client", objectKey));
+        waitMs = std::min<int64_t>(leftMs, std::max<uint32_t>(remainingMs, 1));
+    }
+}
+
+Status ObjectClientImpl::MatchPrefix(const std::vector<std::string> &keys, size_t &matchedCount,
+                                     std::vector<std::pair<std::string, size_t>> &workerPrefixes)
+{
+    PerfPoint perfPoint(PerfKey::CLIENT_MATCH_PREFIX);
+    RETURN_IF_NOT_OK(IsClientReady());
+    ApiDeadlineGuard deadlineGuard(requestTimeoutMs_);
+    RETURN_IF_NOT_OK(CheckValidObjectKeyVector(keys));
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(Validator::IsExistBatchSizeUnderLimit(keys.size()), K_INVALID,
+                                         FormatString("The objectKeys size exceed %d.", EXIST_KEYS_MAX_SIZE_LIMIT));
+    std::shared_ptr<IClientWorkerApi> workerApi;
+    std::unique_ptr<Raii> raii;
+    RETURN_IF_NOT_OK(GetAvailableWorkerApi(workerApi, raii));
+    MatchPrefixRspPb rsp;
+    RETURN_IF_NOT_OK(workerApi->MatchPrefix(keys, rsp));
+    matchedCount = rsp.matched_count();
+    workerPrefixes.clear();
+    workerPrefixes.reserve(rsp.holders_size());
+    for (const auto &holder : rsp.holders()) {
+        workerPrefixes.emplace_back(holder.address(), holder.length());
+    }
+    perfPoint.Record();
+    return Status::OK();
+}
+
 Status ObjectClientImpl::GetMetaInfo(const std::vector<std::string> &keys, const bool isDevKey,
                                      std::vector<MetaInfo> &metaInfos, std::vector<std::string> &failKeys)
 {
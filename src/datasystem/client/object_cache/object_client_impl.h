@@ -716,6 +716,31 @@ public:
      */
     Status Expire(const std::vector<std::string> &keys, uint32_t ttlSeconds, std::vector<std::string> &failedKeys);
 
+    /**
+     * @brief Get an object, or create it if it is missing and no other caller is filling it.
+     * @param[in] objectKey The object key.
+     * @param[in] dataSize The size of the object to create on miss.
+     * @param[in] param The param for create operation.
+     * @param[in] subTimeoutMs How long to wait for another caller to fill the object.
+     * @param[in] leaseMs How long the fill lease stays valid if the caller never publishes the object.
+     * @param[out] buffer The existing object, or the newly created buffer to fill when created is true.
+     * @param[out] created True if the caller got the fill lease and must fill and set the buffer.
+     * @return K_OK on success; the error code otherwise.
+     *         K_TRY_AGAIN: another caller is still filling the object after subTimeoutMs.
+     */
+    Status GetOrCreate(const std::string &objectKey, uint64_t dataSize, const FullParam &param, int32_t subTimeoutMs,
+                       uint32_t leaseMs, std::shared_ptr<Buffer> &buffer, bool &created);
+
+    /**
+     * @brief Match the longest cached prefix of a chain of keys.
+     * @param[in] keys The chain of keys, in chain order. Constraint: The number of keys cannot exceed 100000.
+     * @param[out] matchedCount The number of leading keys cached somewhere in the cluster.
+     * @param[out] workerPrefixes The workers holding a prefix of the chain and its length, longest first.
+     * @return K_OK on success; the error code otherwise.
+     */
+    Status MatchPrefix(const std::vector<std::string> &keys, size_t &matchedCount,
+                       std::vector<std::pair<std::string, size_t>> &workerPrefixes);
+
     /**
      * @brief Get device meta info of the keys.
      * @param[in] keys The keys to be queried. Constraint: The number of keys cannot exceed 10000.
@@ -70,4 +70,15 @@ Status PerfClientWorkerApi::ResetPerfLog()
     RETURN_IF_NOT_OK(rpcSession_->ResetPerfLog(req, rsp));
     return Status::OK();
 }
+
+Status PerfClientWorkerApi::GetTraceTimeline(const std::string &traceID, std::string &json)
+{
+    GetTraceTimelineReqPb req;
+    GetTraceTimelineRspPb rsp;
+    req.set_trace_id(traceID);
+    RETURN_IF_NOT_OK(signature_->GenerateSignature(req));
+    RETURN_IF_NOT_OK(rpcSession_->GetTraceTimeline(req, rsp));
+    json = std::move(*rsp.mutable_chrome_trace_json());
+    return Status::OK();
+}
 }  // namespace datasystem
\ No newline at end of file
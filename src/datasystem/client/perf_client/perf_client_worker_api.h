@@ -58,6 +58,14 @@ public:
     */
    Status ResetPerfLog();
 
+   /**
+    * @brief Get the sampled request timeline of the worker.
+    * @param[in] traceID Only the ticks of this request, all the sampled requests if empty.
+    * @param[out] json The timeline in the Chrome trace event format.
+    * @return Status of the call.
+    */
+   Status GetTraceTimeline(const std::string &traceID, std::string &json);
+
 private:
     HostPort hostPort_;
     std::unique_ptr<Signature> signature_{ nullptr };
@@ -146,6 +146,14 @@ Status Routing::SelectWorkers(const std::vector<std::string> &keys, DataPlacemen
     return router_->SelectWorkers(keys, policy, groups, exclude);
 }
 
+Status Routing::SelectWorkerIndexes(const std::vector<std::string> &keys, DataPlacementPolicy policy,
+                                    std::unordered_map<HostPort, std::vector<size_t>> &groups,
+                                    const std::vector<HostPort> &exclude)
+{
+    CHECK_FAIL_RETURN_STATUS(initialized_.load(), K_NOT_READY, "Routing is not initialized");
+    return router_->SelectWorkerIndexes(keys, policy, groups, exclude);
+}
+
 void Routing::UpdateState(const HostPort &addr, StatusCode status)
 {
     if (initialized_.load()) {
@@ -62,6 +62,10 @@ public:
                          std::unordered_map<HostPort, std::vector<std::string>> &groups,
                          const std::vector<HostPort> &exclude = {});
 
+    Status SelectWorkerIndexes(const std::vector<std::string> &keys, DataPlacementPolicy policy,
+                               std::unordered_map<HostPort, std::vector<size_t>> &groups,
+                               const std::vector<HostPort> &exclude = {});
+
     void UpdateState(const HostPort &addr, StatusCode status);
 
     bool ForceRefresh();
@@ -29,6 +29,10 @@ namespace datasystem {
 namespace client {
 namespace {
 constexpr size_t DEFAULT_FILTER_COUNT = 2;
+// The lookup table has about one bucket per token, within [2^8, 2^16] buckets.
+constexpr uint32_t MIN_BUCKET_BITS = 8;
+constexpr uint32_t MAX_BUCKET_BITS = 16;
+constexpr uint32_t TOKEN_BITS = 32;
 }  // namespace
 
 WorkerRouter::WorkerRouter(std::string myHostId, std::vector<std::shared_ptr<IWorkerFilter>> additionalFilters)
@@ -77,9 +81,45 @@ std::shared_ptr<const WorkerRouter::RingView::TokenIndex> WorkerRouter::BuildTok
               [](const std::pair<uint32_t, int> &a, const std::pair<uint32_t, int> &b) {
                   return a.first < b.first;
               });
+    if (idx->tokenToWorker.empty()) {
+        return idx;
+    }
+    uint32_t bits = MIN_BUCKET_BITS;
+    while (bits < MAX_BUCKET_BITS && (size_t{ 1 } << bits) < idx->tokenToWorker.size()) {
+        ++bits;
+    }
+    idx->bucketShift = TOKEN_BITS - bits;
+    const size_t bucketCount = size_t{ 1 } << bits;
+    idx->bucketStart.resize(bucketCount + 1);
+    size_t slot = 0;
+    for (size_t bucket = 0; bucket <= bucketCount; ++bucket) {
+        const uint64_t bucketBegin = static_cast<uint64_t>(bucket) << idx->bucketShift;
+        while (slot < idx->tokenToWorker.size() && idx->tokenToWorker[slot].first < bucketBegin) {
+            ++slot;
+        }
+        idx->bucketStart[bucket] = static_cast<uint32_t>(slot);
+    }
     return idx;
 }
 
+size_t WorkerRouter::FindSlot(const RingView::TokenIndex &idx, uint32_t keyHash)
+{
+    // RoutingSnapshot owns closed token ranges, so an exact token hash belongs to that token's worker.
+    const size_t bucket = keyHash >> idx.bucketShift;
+    auto first = idx.tokenToWorker.begin() + idx.bucketStart[bucket];
+    auto last = idx.tokenToWorker.begin() + idx.bucketStart[bucket + 1];
+    auto iter = std::lower_bound(first, last, keyHash,
+        [](const std::pair<uint32_t, int> &token, uint32_t val) { return token.first < val; });
+    return iter == idx.tokenToWorker.end() ? 0 : static_cast<size_t>(iter - idx.tokenToWorker.begin());
+}
+
+const HostPort &WorkerRouter::DestWorker(const RingView &view, size_t dest)
+{
+    const auto &sameNodeWorkers = *view.sameNodeWorkers;
+    return dest < sameNodeWorkers.size() ? sameNodeWorkers[dest]
+                                         : view.tokenIndex->workers[dest - sameNodeWorkers.size()];
+}
+
 bool WorkerRouter::IsWorkerAvailable(const HostPort &addr) const
 {
     return std::all_of(filters_.begin(), filters_.end(),
@@ -92,6 +132,18 @@ bool WorkerRouter::IsExcluded(const HostPort &addr, const std::vector<HostPort>
         [&](const HostPort &e) { return e == addr; });
 }
 
+bool WorkerRouter::IsCandidate(const HostPort &addr, const std::vector<HostPort> &exclude, Availability *cached) const
+{
+    if (cached != nullptr && *cached != Availability::UNKNOWN) {
+        return *cached == Availability::AVAILABLE;
+    }
+    const bool available = !IsExcluded(addr, exclude) && IsWorkerAvailable(addr);
+    if (cached != nullptr) {
+        *cached = available ? Availability::AVAILABLE : Availability::UNAVAILABLE;
+    }
+    return available;
+}
+
 Status WorkerRouter::SelectWorker(const std::string &key, DataPlacementPolicy policy, HostPort &worker,
                                   const std::vector<HostPort> &exclude) const
 {
@@ -103,20 +155,26 @@ Status WorkerRouter::SelectWorkerFromView(const std::string &key, DataPlacementP
                                           const std::vector<HostPort> &exclude,
                                           const std::shared_ptr<const RingView> &view) const
 {
-    const auto &idx = view->tokenIndex;
-    uint32_t keyHash = MurmurHash3_32(key);
+    size_t dest = 0;
+    Status s = LocateFromView(MurmurHash3_32(key), policy, exclude, *view, nullptr, dest);
+    if (s.IsError()) {
+        return s;
+    }
+    worker = DestWorker(*view, dest);
+    return Status::OK();
+}
 
+Status WorkerRouter::LocateFromView(uint32_t keyHash, DataPlacementPolicy policy, const std::vector<HostPort> &exclude,
+                                    const RingView &view, Availability *cache, size_t &dest) const
+{
+    const auto &sameNodeWorkers = *view.sameNodeWorkers;
+    const size_t sameNodeCount = sameNodeWorkers.size();
     if (policy != DataPlacementPolicy::PREFERRED_META_OWNER) {
-        const auto &sameNodeWorkers = *view->sameNodeWorkers;
-        const size_t sameNodeCount = sameNodeWorkers.size();
         const size_t start = sameNodeCount == 0 ? 0 : keyHash % sameNodeCount;
         for (size_t i = 0; i < sameNodeCount; ++i) {
-            const auto &w = sameNodeWorkers[(start + i) % sameNodeCount];
-            if (IsExcluded(w, exclude)) {
-                continue;
-            }
-            if (IsWorkerAvailable(w)) {
-                worker = w;
+            const size_t index = (start + i) % sameNodeCount;
+            if (IsCandidate(sameNodeWorkers[index], exclude, cache == nullptr ? nullptr : cache + index)) {
+                dest = index;
                 return Status::OK();
             }
         }
@@ -126,25 +184,18 @@ Status WorkerRouter::SelectWorkerFromView(const std::string &key, DataPlacementP
     }
 
     // PREFERRED_META_OWNER, or the fallback for PREFERRED_SAME_NODE.
-    if (idx->tokenToWorker.empty()) {
+    const auto &idx = *view.tokenIndex;
+    if (idx.tokenToWorker.empty()) {
         return Status(K_NOT_FOUND, "Hash ring is empty, no routable workers");
     }
 
-    // RoutingSnapshot owns closed token ranges, so an exact token hash belongs to that token's worker.
-    auto iter = std::lower_bound(idx->tokenToWorker.begin(), idx->tokenToWorker.end(), keyHash,
-        [](const std::pair<uint32_t, int> &token, uint32_t val) { return token.first < val; });
-    int start = (iter == idx->tokenToWorker.end()) ? 0 : static_cast<int>(iter - idx->tokenToWorker.begin());
-
-    int total = static_cast<int>(idx->tokenToWorker.size());
-    for (int i = 0; i < total; ++i) {
-        int slot = (start + i) % total;
-        int workerIdx = idx->tokenToWorker[slot].second;
-        const HostPort &candidate = idx->workers[workerIdx];
-        if (IsExcluded(candidate, exclude)) {
-            continue;
-        }
-        if (IsWorkerAvailable(candidate)) {
-            worker = candidate;
+    const size_t start = FindSlot(idx, keyHash);
+    const size_t total = idx.tokenToWorker.size();
+    for (size_t i = 0; i < total; ++i) {
+        const size_t slot = (start + i) % total;
+        const size_t index = sameNodeCount + static_cast<size_t>(idx.tokenToWorker[slot].second);
+        if (IsCandidate(DestWorker(view, index), exclude, cache == nullptr ? nullptr : cache + index)) {
+            dest = index;
             return Status::OK();
         }
     }
@@ -155,20 +206,58 @@ Status WorkerRouter::SelectWorkerFromView(const std::string &key, DataPlacementP
 Status WorkerRouter::SelectWorkers(const std::vector<std::string> &keys, DataPlacementPolicy policy,
                                    std::unordered_map<HostPort, std::vector<std::string>> &groups,
                                    const std::vector<HostPort> &exclude) const
+{
+    std::unordered_map<HostPort, std::vector<size_t>> indexGroups;
+    RETURN_IF_NOT_OK(SelectWorkerIndexes(keys, policy, indexGroups, exclude));
+    std::unordered_map<HostPort, std::vector<std::string>> newGroups;
+    newGroups.reserve(indexGroups.size());
+    for (const auto &entry : indexGroups) {
+        auto &group = newGroups[entry.first];
+        group.reserve(entry.second.size());
+        for (auto index : entry.second) {
+            group.push_back(keys[index]);
+        }
+    }
+    groups = std::move(newGroups);
+    return Status::OK();
+}
+
+Status WorkerRouter::SelectWorkerIndexes(const std::vector<std::string> &keys, DataPlacementPolicy policy,
+                                         std::unordered_map<HostPort, std::vector<size_t>> &groups,
+                                         const std::vector<HostPort> &exclude) const
 {
     auto view = std::atomic_load(&ringView_);
     if (keys.empty()) {
         groups.clear();
         return Status::OK();
     }
-    std::unordered_map<HostPort, std::vector<std::string>> newGroups;
-    for (const auto &key : keys) {
-        HostPort owner;
-        Status s = SelectWorkerFromView(key, policy, owner, exclude, view);
+    std::vector<uint32_t> hashes(keys.size());
+    MurmurHash3_32Batch(keys.data(), keys.size(), hashes.data());
+    const size_t destCount = view->sameNodeWorkers->size() + view->tokenIndex->workers.size();
+    std::vector<Availability> cache(destCount, Availability::UNKNOWN);
+    std::vector<size_t> destOf(keys.size());
+    std::vector<size_t> destKeyCount(destCount, 0);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        Status s = LocateFromView(hashes[i], policy, exclude, *view, cache.data(), destOf[i]);
         if (s.IsError()) {
             return s;
         }
-        newGroups[owner].push_back(key);
+        ++destKeyCount[destOf[i]];
+    }
+
+    // Size every group before filling it. A same-node worker that also owns tokens shares one group.
+    std::unordered_map<HostPort, std::vector<size_t>> newGroups;
+    std::vector<std::vector<size_t> *> destGroups(destCount, nullptr);
+    for (size_t dest = 0; dest < destCount; ++dest) {
+        if (destKeyCount[dest] == 0) {
+            continue;
+        }
+        auto &group = newGroups[DestWorker(*view, dest)];
+        group.reserve(group.capacity() + destKeyCount[dest]);
+        destGroups[dest] = &group;
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+        destGroups[destOf[i]]->push_back(i);
     }
     groups = std::move(newGroups);
     return Status::OK();
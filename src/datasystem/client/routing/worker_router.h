@@ -61,11 +61,17 @@ public:
     Status SelectWorker(const std::string &key, DataPlacementPolicy policy, HostPort &worker,
                         const std::vector<HostPort> &exclude = {}) const;
 
-    // Batch selection: group keys by owner, return map<worker, keys>.
+    // Batch selection: group keys by owner, return map<worker, keys>. Keys are hashed side by side and every
+    // worker goes through the filters at most once per batch.
     Status SelectWorkers(const std::vector<std::string> &keys, DataPlacementPolicy policy,
                          std::unordered_map<HostPort, std::vector<std::string>> &groups,
                          const std::vector<HostPort> &exclude = {}) const;
 
+    // Same as SelectWorkers, but each group holds positions into keys in ascending order instead of key copies.
+    Status SelectWorkerIndexes(const std::vector<std::string> &keys, DataPlacementPolicy policy,
+                               std::unordered_map<HostPort, std::vector<size_t>> &groups,
+                               const std::vector<HostPort> &exclude = {}) const;
+
     std::vector<HostPort> GetAvailableWorkers() const;
 
     // Called by Refresher to update hash ring data.
@@ -89,16 +95,29 @@ private:
         struct TokenIndex {
             std::vector<std::pair<uint32_t, int>> tokenToWorker;
             std::vector<HostPort> workers;
+            // bucketStart[b] is the first slot whose token is >= b << bucketShift, so a lookup only searches the
+            // few slots of one bucket. It has one more entry than the buckets.
+            std::vector<uint32_t> bucketStart;
+            uint32_t bucketShift{ 32 };
         };
         std::shared_ptr<const TokenIndex> tokenIndex;
     };
     std::shared_ptr<const RingView> ringView_;
 
+    // Filter result of a worker, cached for the duration of one batch.
+    enum class Availability : uint8_t { UNKNOWN, AVAILABLE, UNAVAILABLE };
+
     bool IsWorkerAvailable(const HostPort &addr) const;
     bool IsExcluded(const HostPort &addr, const std::vector<HostPort> &exclude) const;
+    bool IsCandidate(const HostPort &addr, const std::vector<HostPort> &exclude, Availability *cached) const;
     Status SelectWorkerFromView(const std::string &key, DataPlacementPolicy policy, HostPort &worker,
                                 const std::vector<HostPort> &exclude,
                                 const std::shared_ptr<const RingView> &view) const;
+    // Locate the worker of a key hash. dest indexes the same-node workers followed by the ring workers of the view.
+    Status LocateFromView(uint32_t keyHash, DataPlacementPolicy policy, const std::vector<HostPort> &exclude,
+                          const RingView &view, Availability *cache, size_t &dest) const;
+    static const HostPort &DestWorker(const RingView &view, size_t dest);
+    static size_t FindSlot(const RingView::TokenIndex &idx, uint32_t keyHash);
     static std::shared_ptr<const RingView::TokenIndex> BuildTokenIndex(const ::datasystem::ClusterTopologyPb &ring);
 };
 
@@ -58,7 +58,7 @@ Status ClientBaseImpl::Init()
     // If the worker is not down level, write something into the eye catcher area so that the worker
     // can also know our compatibility
     if (WorkAreaIsV2()) {
-        cursor_->SetClientVersion(Cursor::K_CURSOR_SIZE_V2);
+        cursor_->SetClientVersion(Cursor::K_CLIENT_EYECATCHER_V3);
         workerVersion_ = cursor_->GetWorkerVersion();
     }
     return Status::OK();
@@ -57,6 +57,20 @@ Status Producer::Send(const Element &element, int64_t timeoutMs)
     return impl_->Send(element, Optional<int64_t>(timeoutMs));
 }
 
+Status Producer::SendBatch(const std::vector<Element> &elements)
+{
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(impl_->CheckAndSetInUse(), "SendBatch");
+    Raii unsetRaii([this]() { impl_->UnsetInUse(); });
+    return impl_->SendBatch(elements, Optional<int64_t>());
+}
+
+Status Producer::SendBatch(const std::vector<Element> &elements, int64_t timeoutMs)
+{
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(impl_->CheckAndSetInUse(), "SendBatch");
+    Raii unsetRaii([this]() { impl_->UnsetInUse(); });
+    return impl_->SendBatch(elements, Optional<int64_t>(timeoutMs));
+}
+
 Status Producer::Close()
 {
     RETURN_IF_NOT_OK_PRINT_ERROR_MSG(impl_->CheckAndSetInUse(), "Close");
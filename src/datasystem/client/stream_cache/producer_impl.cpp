@@ -301,6 +301,135 @@ Status ProducerImpl::SendImpl(const HeaderAndData &element, InsertFlags &flag, O
                                LogPrefix(), timeoutMs));
 }
 
+Status ProducerImpl::SendBatchImpl(const std::vector<HeaderAndData> &elements, size_t begin, size_t end,
+                                   Optional<int64_t> userTimeoutMs, size_t &numSent)
+{
+    PerfPoint point(PerfKey::CLIENT_SEND_BATCH_ALL);
+    numSent = 0;
+    UnsetUnfixPageTimer();
+    Raii unfixPage([this]() { LOG_IF_ERROR(SetUnfixPageTimer(), ""); });
+    int64_t timeoutMs = userTimeoutMs ? userTimeoutMs.value() : RPC_TIMEOUT;
+    Timer t(timeoutMs);
+    RETURN_IF_NOT_OK(FixPage(userTimeoutMs ? Optional<int64_t>(t.GetRemainingTimeMs()) : Optional<int64_t>(), false));
+    auto flag = (delayFlushTime_ > 0) ? InsertFlags::DELAY_WAKE : InsertFlags::NONE;
+    // Same loop as SendImpl, except that each insert takes as many of the remaining elements as the page holds.
+    while (begin + numSent < end) {
+        size_t numInserted = 0;
+        Status rc = writePage_->Insert(elements, begin + numSent, end, t.GetRemainingTimeMs(), flag, numInserted,
+                                       LogPrefix());
+        if (rc.IsOk()) {
+            cursor_->IncrementElementCount(numInserted);
+            lastSendElementSeqNo_ += numInserted;
+            numSent += numInserted;
+            pageDirty_ = true;
+            continue;
+        }
+        Status status = HandleNoSpaceFromInsert(timeoutMs, rc);
+        auto rcCode = status.GetCode();
+        if (rcCode == K_SC_END_OF_PAGE || rcCode == K_NO_SPACE) {
+            RETURN_IF_NOT_OK(DelayFlush(pageDirty_));  // Ensure we wake up reader before we move to a new page
+            auto nextPage = writePage_->GetNextPage();
+            if (nextPage.fd > 0) {
+                RETURN_IF_NOT_OK(CreatePagePostProcessing(nextPage, fixPageFromNextPage_));
+            } else {
+                RETURN_IF_NOT_OK(
+                    CreateWritePage(userTimeoutMs ? Optional<int64_t>(t.GetRemainingTimeMs()) : Optional<int64_t>()));
+            }
+            continue;
+        } else if (rcCode == K_TRY_AGAIN) {
+            if (t.GetRemainingTimeMs() == 0) {
+                RETURN_STATUS(K_OUT_OF_MEMORY,
+                              FormatString("[%s] Producer unable to secure enough memory for %zu elements within %zu ms",
+                                           LogPrefix(), end - begin - numSent, timeoutMs));
+            }
+            RETURN_IF_NOT_OK(
+                FixPage(userTimeoutMs ? Optional<int64_t>(t.GetRemainingTimeMs()) : Optional<int64_t>(), true));
+            continue;
+        }
+        return rc;
+    }
+    // One flush decision for the whole batch.
+    return DelayFlush();
+}
+
+Status ProducerImpl::SendBatch(const std::vector<Element> &elements, Optional<int64_t> userTimeoutMs)
+{
+    TraceGuard traceGuard = Trace::Instance().SetTraceUUID();
+    cursor_->IncrementRequestCount();
+    RETURN_IF_NOT_OK(CheckNormalState());
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
+        !userTimeoutMs || *userTimeoutMs >= 0, K_INVALID,
+        FormatString("[%s] The send timeout must be greater than or equal to 0", LogPrefix()));
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(!elements.empty(), K_INVALID,
+                                         FormatString("[%s] The elements to send are empty", LogPrefix()));
+    // The elements only point to their verification headers, which have to live until the batch is sent.
+    std::vector<DataVerificationHeader> dataVerificationHeaders(enableStreamDataVerification_ ? elements.size() : 0);
+    std::vector<HeaderAndData> batch;
+    batch.reserve(elements.size());
+    for (size_t i = 0; i < elements.size(); ++i) {
+        ElementHeader elementHeader;
+        if (enableStreamDataVerification_) {
+            auto &dataVerificationHeader = dataVerificationHeaders[i];
+            dataVerificationHeader.Set(lastSendElementSeqNo_ + 1 + i, senderProducerNo_, address_, port_);
+            elementHeader.Set(reinterpret_cast<ElementHeader::Ptr>(&dataVerificationHeader),
+                              dataVerificationHeader.HeaderSize(), DATA_VERIFICATION_HEADER);
+        }
+        batch.emplace_back(elements[i], elementHeader, streamNo_);
+        CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
+            batch.back().TotalSize() < maxStreamSize_, K_INVALID,
+            FormatString("[%s] Element size must be smaller than Stream size. [element size, stream size] : [%zu, %zu]",
+                         LogPrefix(), batch.back().TotalSize(), maxStreamSize_));
+    }
+    int64_t timeoutMs = userTimeoutMs ? userTimeoutMs.value() : RPC_TIMEOUT;
+    Timer t(timeoutMs);
+    auto isBigElement = [this](const HeaderAndData &element) {
+        return element.TotalSize() > static_cast<uint64_t>(maxElementSize_);
+    };
+    Status rc;
+    size_t begin = 0;
+    // Runs of elements that fit in a data page are sent together, big elements in between one by one.
+    while (rc.IsOk() && begin < batch.size()) {
+        size_t end = begin + 1;
+        while (!isBigElement(batch[begin]) && end < batch.size() && !isBigElement(batch[end])) {
+            ++end;
+        }
+        uint64_t runSize = 0;
+        for (size_t i = begin; i < end; ++i) {
+            runSize += batch[i].TotalSize();
+        }
+        if (enableSharedPage_) {
+            rc = streamMetaShm_->TryIncUsage(runSize);
+            if (rc.IsError()) {
+                LOG(ERROR) << "Failed to increase the usage of shared memory for stream: " << streamName_;
+                break;
+            }
+        }
+        auto remainingTimeMs = userTimeoutMs ? Optional<int64_t>(t.GetRemainingTimeMs()) : Optional<int64_t>();
+        size_t numSent = 0;
+        if (isBigElement(batch[begin])) {
+            rc = InsertBigElement(batch[begin], remainingTimeMs);
+            numSent = rc.IsOk() ? 1 : 0;
+        } else {
+            rc = SendBatchImpl(batch, begin, end, remainingTimeMs, numSent);
+        }
+        if (enableSharedPage_ && numSent < end - begin) {
+            for (size_t i = begin; i < begin + numSent; ++i) {
+                runSize -= batch[i].TotalSize();
+            }
+            LOG_IF_ERROR(streamMetaShm_->TryDecUsage(runSize),
+                         "Failed to decrease the usage of shared memory for stream: " + streamName_);
+        }
+        begin += numSent;
+    }
+    if (sendTracer_.NeedWriteLog(rc.IsOk())) {
+        LOG(INFO) << FormatString("[%s] Producer first send batch with status %s", LogPrefix(), rc.ToString());
+    }
+    if (rc.GetCode() == K_OUT_OF_RANGE) {
+        RETURN_IF_NOT_OK(CheckNormalState());
+    }
+    return rc;
+}
+
 Status ProducerImpl::Send(const Element &element, Optional<int64_t> userTimeoutMs)
 {
     TraceGuard traceGuard = Trace::Instance().SetTraceUUID();
@@ -487,6 +616,8 @@ Status ProducerImpl::CreatePagePostProcessing(const ShmView &lastPageView, std::
         // We may (or may not) lock this page. But let's track it in the work area
         if (WorkAreaIsV2()) {
             RETURN_IF_NOT_OK(cursor_->SetLastLockedPage(curView_, DEFAULT_TIMEOUT_MS));
+            // Appends to this page are tracked in the work area, the worker may let us skip the page lock.
+            writePage_->SetAppendCursor(cursor_.get());
         }
     }
     VLOG(SC_INTERNAL_LOG_LEVEL) << FormatString("[%s] Acquire page id: %s, isSharedPage: %d, lastPageView: %s",
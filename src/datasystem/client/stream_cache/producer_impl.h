@@ -76,6 +76,16 @@ public:
      */
     Status Send(const Element &element, Optional<int64_t> timeoutMs);
 
+    /**
+     * @brief Send elements in order, reserving the page space for as many elements as fit at once.
+     * @param[in] elements The elements to be written.
+     * @param[in] timeoutMs The timeout for the call
+     * @return K_OK on success; the error code otherwise, in which case the elements before the failed one are sent.
+     *         K_RUNTIME_ERROR: depends on the error message.
+     *         K_SC_ALREADY_CLOSED: producer is already closed/inactive.
+     */
+    Status SendBatch(const std::vector<Element> &elements, Optional<int64_t> timeoutMs);
+
     /**
      * @brief If flush elements are not flushed, the local buffer may keep some elements.
      * And the flush operation will ensure that all elements are written to the stream.
@@ -174,6 +184,18 @@ private:
      */
     Status SendImpl(const HeaderAndData &element, InsertFlags &flags, Optional<int64_t> timeoutMs);
 
+    /**
+     * @brief Send elements that fit in a data page, filling each page with one insert.
+     * @param[in] elements The elements that to be written (header + data)
+     * @param[in] begin The index of the first element to send.
+     * @param[in] end The index past the last element to send.
+     * @param[in] timeoutMs The timeout for the call
+     * @param[out] numSent The number of elements sent, from begin.
+     * @return Status of the call.
+     */
+    Status SendBatchImpl(const std::vector<HeaderAndData> &elements, size_t begin, size_t end,
+                         Optional<int64_t> timeoutMs, size_t &numSent);
+
     /**
      * @brief Locate page to insert, likely the last page.
      * @param[in] timeoutMs The timeout for the call.
@@ -12,17 +12,30 @@
 
 namespace datasystem::cluster {
 
+const HashAlgorithm *AlgorithmCatalog::Find(const TopologyAlgorithmId &id) const
+{
+    if (id == hash_.GetId()) {
+        return &hash_;
+    }
+    if (id == weightedHash_.GetId()) {
+        return &weightedHash_;
+    }
+    return nullptr;
+}
+
 Status AlgorithmCatalog::GetRouting(const TopologyAlgorithmId &id, const IRoutingAlgorithm *&algorithm) const
 {
-    CHECK_FAIL_RETURN_STATUS(id == hash_.GetId(), K_NOT_FOUND, "cluster routing algorithm not found");
-    algorithm = &hash_;
+    const auto *found = Find(id);
+    CHECK_FAIL_RETURN_STATUS(found != nullptr, K_NOT_FOUND, "cluster routing algorithm not found");
+    algorithm = found;
     return Status::OK();
 }
 
 Status AlgorithmCatalog::GetPlanning(const TopologyAlgorithmId &id, const IPlanningAlgorithm *&algorithm) const
 {
-    CHECK_FAIL_RETURN_STATUS(id == hash_.GetId(), K_NOT_FOUND, "cluster planning algorithm not found");
-    algorithm = &hash_;
+    const auto *found = Find(id);
+    CHECK_FAIL_RETURN_STATUS(found != nullptr, K_NOT_FOUND, "cluster planning algorithm not found");
+    algorithm = found;
     return Status::OK();
 }
 
@@ -10,6 +10,7 @@
 #define DATASYSTEM_CLUSTER_ALGORITHM_ALGORITHM_CATALOG_H
 
 #include "datasystem/cluster/algorithm/hash_algorithm.h"
+#include "datasystem/cluster/algorithm/weighted_hash_algorithm.h"
 
 namespace datasystem::cluster {
 
@@ -44,7 +45,15 @@ public:
     Status GetPlanning(const TopologyAlgorithmId &id, const IPlanningAlgorithm *&algorithm) const;
 
 private:
+    /**
+     * @brief Find a built-in algorithm.
+     * @param[in] id Algorithm id.
+     * @return Catalog-owned algorithm, or nullptr.
+     */
+    const HashAlgorithm *Find(const TopologyAlgorithmId &id) const;
+
     HashAlgorithm hash_;
+    WeightedHashAlgorithm weightedHash_;
 };
 
 }  // namespace datasystem::cluster
@@ -62,36 +62,6 @@ Status ValidateSelectedMembers(const TopologyState &current, const std::vector<M
     return Status::OK();
 }
 
-uint32_t MakeToken(const std::string &address, uint32_t index, uint32_t probe)
-{
-    std::string seed = address + TOKEN_SEPARATOR + std::to_string(index);
-    if (probe > 0) {
-        seed += TOKEN_SEPARATOR + std::to_string(probe);
-    }
-    return MurmurHash3_32(seed);
-}
-
-Status GenerateTokens(const MemberIdentity &identity, uint32_t count, std::unordered_set<uint32_t> &occupied,
-                      std::vector<uint32_t> &tokens)
-{
-    tokens.clear();
-    tokens.reserve(count);
-    for (uint32_t index = 0; index < count; ++index) {
-        bool allocated = false;
-        for (uint32_t probe = 0; probe < MAX_TOKEN_PROBES; ++probe) {
-            auto token = MakeToken(identity.address, index, probe);
-            if (occupied.insert(token).second) {
-                tokens.emplace_back(token);
-                allocated = true;
-                break;
-            }
-        }
-        CHECK_FAIL_RETURN_STATUS(allocated, K_INVALID, "unique cluster token probe budget exhausted");
-    }
-    std::sort(tokens.begin(), tokens.end());
-    return Status::OK();
-}
-
 Status BuildOwners(const std::vector<Member> &members, bool includeJoining, const std::set<std::string> &excluded,
                    std::vector<TokenOwner> &owners, bool activeOnly = false)
 {
@@ -205,19 +175,49 @@ Status HashAlgorithm::LocateProspectiveOwner(const TopologySnapshot &snapshot, u
     return LocateIndexedOwner(owners, token, owner);
 }
 
-Status HashAlgorithm::AllocateTokens(const std::vector<MemberIdentity> &members, uint32_t tokensPerMember,
+uint32_t HashAlgorithm::MakeToken(const std::string &address, uint32_t index, uint32_t probe)
+{
+    std::string seed = address + TOKEN_SEPARATOR + std::to_string(index);
+    if (probe > 0) {
+        seed += TOKEN_SEPARATOR + std::to_string(probe);
+    }
+    return MurmurHash3_32(seed);
+}
+
+Status HashAlgorithm::GenerateMemberTokens(const MemberIdentity &identity, const ScaleOutPlanInput &input,
+                                           std::set<uint32_t> &occupied, std::vector<uint32_t> &tokens) const
+{
+    tokens.clear();
+    tokens.reserve(input.tokensPerMember);
+    for (uint32_t index = 0; index < input.tokensPerMember; ++index) {
+        bool allocated = false;
+        for (uint32_t probe = 0; probe < MAX_TOKEN_PROBES; ++probe) {
+            auto token = MakeToken(identity.address, index, probe);
+            if (occupied.insert(token).second) {
+                tokens.emplace_back(token);
+                allocated = true;
+                break;
+            }
+        }
+        CHECK_FAIL_RETURN_STATUS(allocated, K_INVALID, "unique cluster token probe budget exhausted");
+    }
+    std::sort(tokens.begin(), tokens.end());
+    return Status::OK();
+}
+
+Status HashAlgorithm::AllocateTokens(const ScaleOutPlanInput &input,
                                      std::unordered_map<std::string, std::vector<uint32_t>> &tokens) const
 {
-    CHECK_FAIL_RETURN_STATUS(tokensPerMember > 0 && tokensPerMember <= MAX_TOKENS_PER_MEMBER, K_INVALID,
+    CHECK_FAIL_RETURN_STATUS(input.tokensPerMember > 0 && input.tokensPerMember <= MAX_TOKENS_PER_MEMBER, K_INVALID,
                              "tokens per member is outside the supported range");
-    RETURN_IF_NOT_OK(ValidateIdentities(members));
-    auto ordered = members;
+    RETURN_IF_NOT_OK(ValidateIdentities(input.joining));
+    auto ordered = input.joining;
     std::sort(ordered.begin(), ordered.end(),
               [](const auto &left, const auto &right) { return left.address < right.address; });
-    std::unordered_set<uint32_t> occupied;
+    std::set<uint32_t> occupied;
     std::unordered_map<std::string, std::vector<uint32_t>> allocated;
     for (const auto &identity : ordered) {
-        RETURN_IF_NOT_OK(GenerateTokens(identity, tokensPerMember, occupied, allocated[identity.address]));
+        RETURN_IF_NOT_OK(GenerateMemberTokens(identity, input, occupied, allocated[identity.address]));
     }
     tokens = std::move(allocated);
     return Status::OK();
@@ -228,7 +228,7 @@ Status HashAlgorithm::BuildInitialPlacement(const ScaleOutPlanInput &input, Topo
     CHECK_FAIL_RETURN_STATUS(input.current.members.empty() && !input.joining.empty(), K_INVALID,
                              "bootstrap requires an empty topology and members");
     std::unordered_map<std::string, std::vector<uint32_t>> tokens;
-    RETURN_IF_NOT_OK(AllocateTokens(input.joining, input.tokensPerMember, tokens));
+    RETURN_IF_NOT_OK(AllocateTokens(input, tokens));
     TopologyPlan built;
     built.next = input.current;
     built.next.clusterHasInit = true;
@@ -273,7 +273,7 @@ Status HashAlgorithm::PlanScaleOut(const ScaleOutPlanInput &input, TopologyPlan
         K_INVALID, "ScaleOut requires joining members and tokens");
     TopologyPlan built;
     built.next = input.current;
-    std::unordered_set<uint32_t> occupied;
+    std::set<uint32_t> occupied;
     for (const auto &member : built.next.members) {
         occupied.insert(member.tokens.begin(), member.tokens.end());
     }
@@ -292,7 +292,7 @@ Status HashAlgorithm::PlanScaleOut(const ScaleOutPlanInput &input, TopologyPlan
         CHECK_FAIL_RETURN_STATUS(std::none_of(built.next.members.begin(), built.next.members.end(), idCollision),
                                  K_INVALID, "new ScaleOut member id collides with current topology");
         std::vector<uint32_t> memberTokens;
-        RETURN_IF_NOT_OK(GenerateTokens(identity, input.tokensPerMember, occupied, memberTokens));
+        RETURN_IF_NOT_OK(GenerateMemberTokens(identity, input, occupied, memberTokens));
         built.next.members.push_back({ identity, MemberState::JOINING, std::move(memberTokens) });
     }
     std::vector<TokenOwner> fromOwners;
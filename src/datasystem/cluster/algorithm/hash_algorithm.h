@@ -9,13 +9,14 @@
 #ifndef DATASYSTEM_CLUSTER_ALGORITHM_HASH_ALGORITHM_H
 #define DATASYSTEM_CLUSTER_ALGORITHM_HASH_ALGORITHM_H
 
+#include <set>
 #include <unordered_map>
 
 #include "datasystem/cluster/algorithm/topology_algorithm.h"
 
 namespace datasystem::cluster {
 
-class HashAlgorithm final : public IRoutingAlgorithm, public IPlanningAlgorithm {
+class HashAlgorithm : public IRoutingAlgorithm, public IPlanningAlgorithm {
 public:
     /**
      * @brief Construct the stateless built-in algorithm.
@@ -98,15 +99,35 @@ public:
      */
     Status Validate(const TopologyState &state) const override;
 
+protected:
+    /**
+     * @brief Allocate the unique deterministic tokens of one new member.
+     * @param[in] identity New member.
+     * @param[in] input Planning input.
+     * @param[in,out] occupied Tokens already on the ring; the new tokens are added.
+     * @param[out] tokens Sorted tokens of the member.
+     * @return K_OK or K_INVALID.
+     */
+    virtual Status GenerateMemberTokens(const MemberIdentity &identity, const ScaleOutPlanInput &input,
+                                        std::set<uint32_t> &occupied, std::vector<uint32_t> &tokens) const;
+
+    /**
+     * @brief Derive one candidate token of a member.
+     * @param[in] address Member address.
+     * @param[in] index Token index of the member.
+     * @param[in] probe Collision probe.
+     * @return Candidate token.
+     */
+    static uint32_t MakeToken(const std::string &address, uint32_t index, uint32_t probe);
+
 private:
     /**
      * @brief Allocate unique deterministic tokens.
-     * @param[in] members Members.
-     * @param[in] tokensPerMember Count.
+     * @param[in] input Bootstrap input.
      * @param[out] tokens Tokens.
      * @return Status.
      */
-    Status AllocateTokens(const std::vector<MemberIdentity> &members, uint32_t tokensPerMember,
+    Status AllocateTokens(const ScaleOutPlanInput &input,
                           std::unordered_map<std::string, std::vector<uint32_t>> &tokens) const;
 };
 
@@ -9,6 +9,7 @@
 #ifndef DATASYSTEM_CLUSTER_ALGORITHM_TOPOLOGY_ALGORITHM_H
 #define DATASYSTEM_CLUSTER_ALGORITHM_TOPOLOGY_ALGORITHM_H
 
+#include <map>
 #include <string>
 #include <string_view>
 
@@ -21,6 +22,10 @@ struct ScaleOutPlanInput {
     TopologyState current;
     std::vector<MemberIdentity> joining;
     uint32_t tokensPerMember{ 4 };
+    // Advertised capacity by member address, only consumed by capacity-aware algorithms.
+    std::map<std::string, uint64_t> capacities;
+    // Capacity that earns tokensPerMember tokens; 0 places every member with tokensPerMember tokens.
+    uint64_t referenceCapacity{ 0 };
 };
 struct ScaleInPlanInput {
     TopologyState current;
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ */
+
+/**
+ * Description: Capacity-weighted MurmurHash3 cluster topology algorithm.
+ */
+#include "datasystem/cluster/algorithm/weighted_hash_algorithm.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "datasystem/common/util/status_helper.h"
+
+namespace datasystem::cluster {
+namespace {
+constexpr char ALGORITHM_ID[] = "weighted_hash";
+constexpr uint32_t MAX_TOKEN_PROBES = 1'024;
+constexpr uint32_t MAX_TOKENS_PER_MEMBER = 4'096;
+// Candidates per token; splitting the widest of a few random arcs keeps the largest arc close to the fair share.
+constexpr uint32_t BALANCE_CHOICES = 4;
+constexpr uint64_t RING_SIZE = uint64_t{ std::numeric_limits<uint32_t>::max() } + 1;
+
+// Length of the arc between the ring points around the token, which a new point at the token would split.
+uint64_t EnclosingArc(const std::set<uint32_t> &occupied, uint32_t token)
+{
+    if (occupied.size() < 2) {
+        return RING_SIZE;
+    }
+    auto iter = occupied.lower_bound(token);
+    const uint32_t successor = iter == occupied.end() ? *occupied.begin() : *iter;
+    const uint32_t predecessor = iter == occupied.begin() ? *occupied.rbegin() : *std::prev(iter);
+    const uint32_t arc = successor - predecessor;
+    return arc == 0 ? RING_SIZE : arc;
+}
+}  // namespace
+
+TopologyAlgorithmId WeightedHashAlgorithm::GetId() const
+{
+    return ALGORITHM_ID;
+}
+
+uint32_t WeightedHashAlgorithm::WeightedTokenCount(const MemberIdentity &identity, const ScaleOutPlanInput &input)
+{
+    auto iter = input.capacities.find(identity.address);
+    if (input.referenceCapacity == 0 || iter == input.capacities.end() || iter->second == 0) {
+        return input.tokensPerMember;
+    }
+    const double scaled =
+        std::round(static_cast<double>(input.tokensPerMember) * iter->second / input.referenceCapacity);
+    return static_cast<uint32_t>(std::min(std::max(scaled, 1.0), static_cast<double>(MAX_TOKENS_PER_MEMBER)));
+}
+
+Status WeightedHashAlgorithm::GenerateMemberTokens(const MemberIdentity &identity, const ScaleOutPlanInput &input,
+                                                   std::set<uint32_t> &occupied, std::vector<uint32_t> &tokens) const
+{
+    const uint32_t count = WeightedTokenCount(identity, input);
+    tokens.clear();
+    tokens.reserve(count);
+    for (uint32_t index = 0; index < count; ++index) {
+        bool allocated = false;
+        uint32_t best = 0;
+        uint64_t bestArc = 0;
+        uint32_t choices = 0;
+        for (uint32_t probe = 0; probe < MAX_TOKEN_PROBES && choices < BALANCE_CHOICES; ++probe) {
+            auto token = MakeToken(identity.address, index, probe);
+            if (occupied.count(token) > 0) {
+                continue;
+            }
+            ++choices;
+            const auto arc = EnclosingArc(occupied, token);
+            if (!allocated || arc > bestArc) {
+                best = token;
+                bestArc = arc;
+                allocated = true;
+            }
+        }
+        CHECK_FAIL_RETURN_STATUS(allocated, K_INVALID, "unique cluster token probe budget exhausted");
+        occupied.insert(best);
+        tokens.emplace_back(best);
+    }
+    std::sort(tokens.begin(), tokens.end());
+    return Status::OK();
+}
+
+}  // namespace datasystem::cluster
@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ */
+
+/**
+ * Description: Capacity-weighted MurmurHash3 cluster topology algorithm.
+ */
+#ifndef DATASYSTEM_CLUSTER_ALGORITHM_WEIGHTED_HASH_ALGORITHM_H
+#define DATASYSTEM_CLUSTER_ALGORITHM_WEIGHTED_HASH_ALGORITHM_H
+
+#include "datasystem/cluster/algorithm/hash_algorithm.h"
+
+namespace datasystem::cluster {
+
+/**
+ * Places each new member with tokens in proportion to its advertised capacity, and picks every token among a few
+ * candidates as the one splitting the widest ring arc, which bounds the largest share. Routing, ScaleIn and Failure
+ * are those of the hash ring, so committed tokens never move and a ScaleOut only moves the ranges taken by the new
+ * tokens.
+ */
+class WeightedHashAlgorithm final : public HashAlgorithm {
+public:
+    /**
+     * @brief Construct the stateless built-in algorithm.
+     */
+    WeightedHashAlgorithm() = default;
+
+    /**
+     * @brief Destroy the built-in algorithm.
+     */
+    ~WeightedHashAlgorithm() override = default;
+
+    /**
+     * @brief Return the built-in id.
+     * @return Stable algorithm id.
+     */
+    TopologyAlgorithmId GetId() const override;
+
+    /**
+     * @brief Return the token count of a new member.
+     * @param[in] identity New member.
+     * @param[in] input Planning input.
+     * @return tokensPerMember scaled by capacity / referenceCapacity, within [1, 4096].
+     */
+    static uint32_t WeightedTokenCount(const MemberIdentity &identity, const ScaleOutPlanInput &input);
+
+protected:
+    /**
+     * @brief Allocate the capacity-weighted, load-bounded tokens of one new member.
+     * @param[in] identity New member.
+     * @param[in] input Planning input.
+     * @param[in,out] occupied Tokens already on the ring; the new tokens are added.
+     * @param[out] tokens Sorted tokens of the member.
+     * @return K_OK or K_INVALID.
+     */
+    Status GenerateMemberTokens(const MemberIdentity &identity, const ScaleOutPlanInput &input,
+                                std::set<uint32_t> &occupied, std::vector<uint32_t> &tokens) const override;
+};
+
+}  // namespace datasystem::cluster
+
+#endif  // DATASYSTEM_CLUSTER_ALGORITHM_WEIGHTED_HASH_ALGORITHM_H
@@ -16,6 +16,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "datasystem/cluster/algorithm/hash_algorithm.h"
 #include "datasystem/cluster/membership/membership_value_codec.h"
 #include "datasystem/cluster/model/topology_diagnostics.h"
 #include "datasystem/cluster/repository/topology_repository_codec.h"
@@ -73,6 +74,18 @@ void CollectTopologyMemberships(const std::vector<MembershipRecord> &memberships
     }
 }
 
+// Capacity each member advertises in its membership value, read by capacity-aware placement.
+std::map<std::string, uint64_t> AdvertisedCapacities(const std::vector<MembershipRecord> &memberships)
+{
+    std::map<std::string, uint64_t> capacities;
+    for (const auto &record : memberships) {
+        if (record.capacityMb > 0) {
+            capacities.emplace(record.address, record.capacityMb);
+        }
+    }
+    return capacities;
+}
+
 std::string MembershipDigest(const std::vector<MembershipRecord> &memberships,
                              const TopologySnapshot *topologyScope = nullptr)
 {
@@ -567,7 +580,7 @@ Status TopologyController::ApplyExternalEvent(const CoordinationEvent &event)
         MembershipValue value;
         RETURN_IF_NOT_OK(MembershipValueCodec::Decode(event.value, value));
         externalMemberships_[address] =
-            MembershipRecord{ address, value.lifecycleState, value.timestamp, value.hostId };
+            MembershipRecord{ address, value.lifecycleState, value.timestamp, value.hostId, value.capacityMb };
         membershipEventRevisionByAddress_[address] = event.revision;
         membershipDirty_ = true;
         return Status::OK();
@@ -849,6 +862,11 @@ Status TopologyController::RecoverFromLatestTopology()
         diagnostics_.topologyRevision = latest->AuthorityRevision();
         diagnostics_.activeBatch = latest->GetActiveBatch();
     }
+    auto algorithmStatus = CheckPlacementAlgorithm(*latest);
+    if (algorithmStatus.IsError()) {
+        failureClassifier_.Pause(options_.now());
+        return algorithmStatus;
+    }
     if (membershipDirty_ || lastMembershipObservationDigest_.empty()) {
         const auto membershipDigest = MembershipDigest(memberships);
         if (membershipDigest != lastMembershipObservationDigest_) {
@@ -923,6 +941,22 @@ Status TopologyController::EnsureTopologyAuthority()
     return Status::OK();
 }
 
+Status TopologyController::CheckPlacementAlgorithm(const TopologySnapshot &latest) const
+{
+    // Topologies written before the algorithm was recorded were all placed by the plain hash.
+    auto placed = latest.PlacementAlgorithm();
+    if (placed.empty() && latest.ClusterHasInit()) {
+        placed = HashAlgorithm().GetId();
+    }
+    if (placed.empty() || placed == algorithm_.GetId()) {
+        return Status::OK();
+    }
+    LOG(ERROR) << "CLUSTER_PLACEMENT cluster=" << keys_.ClusterName() << " placed_by=" << placed
+               << " planner=" << algorithm_.GetId() << " decision=frozen";
+    RETURN_STATUS(K_INVALID,
+                  "cluster topology was placed by " + placed + " but this planner runs " + algorithm_.GetId());
+}
+
 Status TopologyController::ReconcileDerivedState(const TopologySnapshot &latest,
                                                  const std::vector<MembershipRecord> &memberships)
 {
@@ -1731,7 +1765,7 @@ Status TopologyController::BootstrapCollectiveReplacement(const TopologySnapshot
     size_t changed = 0;
     RETURN_IF_NOT_OK(ApplyReadyMembershipFacts(empty, ready, known, admitted, changed));
     TopologyState next;
-    RETURN_IF_NOT_OK(planBuilder_.BuildBootstrap(empty, admitted, next));
+    RETURN_IF_NOT_OK(planBuilder_.BuildBootstrap(empty, admitted, next, AdvertisedCapacities(ready)));
     std::shared_ptr<const TopologySnapshot> committed;
     const auto commit = [&] { return CommitAndReadBack(latest.Version(), next, committed); };
     if (options_.collectiveReplacementFence) {
@@ -2545,11 +2579,13 @@ Status TopologyController::TryStartNextBatch(const TopologySnapshot &latest,
     TopologyState state{ latest.ClusterHasInit(), latest.Version(), latest.Members(), latest.GetActiveBatch() };
     if (latest.CommittedMembers().empty() && !joining.empty()) {
         ClearBatchCollectState(TopologyChangeType::SCALE_IN, "bootstrap_candidate");
-        return TryStartBatchAfterCollection(latest, state, joining, TopologyChangeType::SCALE_OUT, true);
+        return TryStartBatchAfterCollection(latest, state, joining, TopologyChangeType::SCALE_OUT, true,
+                                            AdvertisedCapacities(memberships));
     }
     if (!joining.empty()) {
         ClearBatchCollectState(TopologyChangeType::SCALE_IN, "scale_out_candidate");
-        return TryStartBatchAfterCollection(latest, state, joining, TopologyChangeType::SCALE_OUT, false);
+        return TryStartBatchAfterCollection(latest, state, joining, TopologyChangeType::SCALE_OUT, false,
+                                            AdvertisedCapacities(memberships));
     }
     if (!leaving.empty()) {
         ClearBatchCollectState(TopologyChangeType::SCALE_OUT, "scale_in_candidate");
@@ -2562,7 +2598,8 @@ Status TopologyController::TryStartNextBatch(const TopologySnapshot &latest,
 
 Status TopologyController::TryStartBatchAfterCollection(const TopologySnapshot &latest, const TopologyState &state,
                                                         const std::vector<MemberIdentity> &participants,
-                                                        TopologyChangeType type, bool bootstrap)
+                                                        TopologyChangeType type, bool bootstrap,
+                                                        const std::map<std::string, uint64_t> &capacities)
 {
     CHECK_FAIL_RETURN_STATUS(type == TopologyChangeType::SCALE_IN || type == TopologyChangeType::SCALE_OUT, K_INVALID,
                              "unsupported collected batch type");
@@ -2571,7 +2608,7 @@ Status TopologyController::TryStartBatchAfterCollection(const TopologySnapshot &
     auto &collect = type == TopologyChangeType::SCALE_IN ? scaleInCollect_ : scaleOutCollect_;
     const auto window =
         type == TopologyChangeType::SCALE_IN ? options_.scaleInCollectWindow : options_.scaleOutCollectWindow;
-    const auto start = [&]() { return CommitBatchStart(latest, state, participants, type, bootstrap); };
+    const auto start = [&]() { return CommitBatchStart(latest, state, participants, type, bootstrap, capacities); };
     if (window.count() == 0) {
         return start();
     }
@@ -2639,15 +2676,15 @@ void TopologyController::CollectNextBatchCandidates(const TopologySnapshot &late
 
 Status TopologyController::CommitBatchStart(const TopologySnapshot &latest, const TopologyState &state,
                                             const std::vector<MemberIdentity> &participants, TopologyChangeType type,
-                                            bool bootstrap)
+                                            bool bootstrap, const std::map<std::string, uint64_t> &capacities)
 {
     TopologyState next;
     if (bootstrap) {
-        RETURN_IF_NOT_OK(planBuilder_.BuildBootstrap(state, participants, next));
+        RETURN_IF_NOT_OK(planBuilder_.BuildBootstrap(state, participants, next, capacities));
     } else {
         TopologyPlan plan;
         if (type == TopologyChangeType::SCALE_OUT) {
-            RETURN_IF_NOT_OK(planBuilder_.BuildScaleOutStart(state, participants, plan));
+            RETURN_IF_NOT_OK(planBuilder_.BuildScaleOutStart(state, participants, plan, capacities));
         } else {
             CHECK_FAIL_RETURN_STATUS(type == TopologyChangeType::SCALE_IN, K_INVALID, "unsupported batch start type");
             RETURN_IF_NOT_OK(planBuilder_.BuildScaleInStart(state, participants, plan));
@@ -2679,9 +2716,12 @@ Status TopologyController::CommitAndReadBack(uint64_t expectedVersion, const Top
                                              std::shared_ptr<const TopologySnapshot> &committed,
                                              int64_t expectedAuthorityRevision)
 {
+    // Record the planner so that a planner configured with another algorithm refuses to change the topology.
+    TopologyState recorded = desired;
+    recorded.placementAlgorithm = algorithm_.GetId();
     TopologyCasResult result;
     RETURN_IF_NOT_OK(
-        repository_.CompareAndSwapTopology(expectedVersion, desired, result, expectedAuthorityRevision));
+        repository_.CompareAndSwapTopology(expectedVersion, recorded, result, expectedAuthorityRevision));
     CHECK_FAIL_RETURN_STATUS(result.outcome == TopologyCasOutcome::COMMITTED, K_TRY_AGAIN,
                              "topology CAS lost to another Controller");
     TopologyReader reader(repository_);
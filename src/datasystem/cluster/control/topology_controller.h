@@ -267,6 +267,13 @@ private:
 
     Status EnsureTopologyAuthority();
 
+    /**
+     * @brief Check the topology was placed by the planning algorithm of this Controller.
+     * @param[in] latest Latest topology.
+     * @return K_OK, or K_INVALID when another algorithm placed it.
+     */
+    Status CheckPlacementAlgorithm(const TopologySnapshot &latest) const;
+
     Status ReconcileDerivedState(const TopologySnapshot &latest,
                                  const std::vector<MembershipRecord> &memberships);
 
@@ -386,7 +393,7 @@ private:
 
     Status TryStartBatchAfterCollection(const TopologySnapshot &latest, const TopologyState &state,
                                         const std::vector<MemberIdentity> &participants, TopologyChangeType type,
-                                        bool bootstrap);
+                                        bool bootstrap, const std::map<std::string, uint64_t> &capacities = {});
 
     void ClearBatchCollectState(TopologyChangeType type, const char *reason);
 
@@ -395,7 +402,8 @@ private:
                                     std::vector<MemberIdentity> &joining) const;
 
     Status CommitBatchStart(const TopologySnapshot &latest, const TopologyState &state,
-                            const std::vector<MemberIdentity> &participants, TopologyChangeType type, bool bootstrap);
+                            const std::vector<MemberIdentity> &participants, TopologyChangeType type, bool bootstrap,
+                            const std::map<std::string, uint64_t> &capacities);
 
     void LogBatchStart(const TopologySnapshot &latest, const TopologySnapshot &committed,
                        const std::vector<MemberIdentity> &participants, const char *action) const;
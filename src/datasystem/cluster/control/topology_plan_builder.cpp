@@ -61,6 +61,15 @@ void RemoveMembers(TopologyState &state, const std::unordered_set<std::string> &
         state.members.end());
 }
 
+ScaleOutPlanInput MakeScaleOutInput(TopologyState current, std::vector<MemberIdentity> joining,
+                                    const std::map<std::string, uint64_t> &capacities)
+{
+    ScaleOutPlanInput input{ std::move(current), std::move(joining), FLAGS_hash_ring_tokens_per_member };
+    input.capacities = capacities;
+    input.referenceCapacity = FLAGS_hash_ring_reference_capacity_mb;
+    return input;
+}
+
 Status ValidateBatch(const TopologyState &latest, TopologyChangeType type)
 {
     CHECK_FAIL_RETURN_STATUS(latest.activeBatch.has_value() && latest.activeBatch->type == type, K_INVALID,
@@ -74,7 +83,7 @@ TopologyPlanBuilder::TopologyPlanBuilder(const IPlanningAlgorithm &algorithm) :
 }
 
 Status TopologyPlanBuilder::BuildBootstrap(const TopologyState &latest, const std::vector<MemberIdentity> &ready,
-                                           TopologyState &next) const
+                                           TopologyState &next, const std::map<std::string, uint64_t> &capacities) const
 {
     const bool hasCommitted = std::any_of(latest.members.begin(), latest.members.end(),
                                           [](const auto &member) { return IsCommittedMemberState(member.state); });
@@ -82,8 +91,7 @@ Status TopologyPlanBuilder::BuildBootstrap(const TopologyState &latest, const st
                              "bootstrap requires a stable topology without a committed owner");
     RETURN_IF_NOT_OK(ValidateSelected(latest, ready, MemberState::INITIAL));
     TopologyPlan built;
-    RETURN_IF_NOT_OK(
-        algorithm_.BuildInitialPlacement({ TopologyState{}, ready, FLAGS_hash_ring_tokens_per_member }, built));
+    RETURN_IF_NOT_OK(algorithm_.BuildInitialPlacement(MakeScaleOutInput(TopologyState{}, ready, capacities), built));
     std::unordered_set<std::string> readyAddresses;
     for (const auto &identity : ready) {
         readyAddresses.insert(identity.address);
@@ -100,7 +108,8 @@ Status TopologyPlanBuilder::BuildBootstrap(const TopologyState &latest, const st
 }
 
 Status TopologyPlanBuilder::BuildScaleOutStart(const TopologyState &latest, const std::vector<MemberIdentity> &selected,
-                                               TopologyPlan &plan) const
+                                               TopologyPlan &plan,
+                                               const std::map<std::string, uint64_t> &capacities) const
 {
     CHECK_FAIL_RETURN_STATUS(latest.clusterHasInit && !latest.activeBatch.has_value(), K_INVALID,
                              "ScaleOut start requires a stable initialized topology");
@@ -112,7 +121,7 @@ Status TopologyPlanBuilder::BuildScaleOutStart(const TopologyState &latest, cons
     }
     RemoveMembers(current, selectedAddresses);
     TopologyPlan built;
-    RETURN_IF_NOT_OK(algorithm_.PlanScaleOut({ current, selected, FLAGS_hash_ring_tokens_per_member }, built));
+    RETURN_IF_NOT_OK(algorithm_.PlanScaleOut(MakeScaleOutInput(std::move(current), selected, capacities), built));
     AdvanceEpoch(latest, TopologyChangeType::SCALE_OUT, built);
     RETURN_IF_NOT_OK(algorithm_.Validate(built.next));
     plan = std::move(built);
@@ -34,20 +34,22 @@ public:
      * @param[in] latest Latest topology.
      * @param[in] ready Ready identities.
      * @param[out] next Next topology.
+     * @param[in] capacities Advertised capacity by address for capacity-aware algorithms.
      * @return Operation status.
      */
-    Status BuildBootstrap(const TopologyState &latest, const std::vector<MemberIdentity> &ready,
-                          TopologyState &next) const;
+    Status BuildBootstrap(const TopologyState &latest, const std::vector<MemberIdentity> &ready, TopologyState &next,
+                          const std::map<std::string, uint64_t> &capacities = {}) const;
 
     /**
      * @brief Start one ScaleOut batch.
      * @param[in] latest Latest topology.
      * @param[in] selected INITIAL identities.
      * @param[out] plan Next plan.
+     * @param[in] capacities Advertised capacity by address for capacity-aware algorithms.
      * @return Operation status.
      */
     Status BuildScaleOutStart(const TopologyState &latest, const std::vector<MemberIdentity> &selected,
-                              TopologyPlan &plan) const;
+                              TopologyPlan &plan, const std::map<std::string, uint64_t> &capacities = {}) const;
 
     /**
      * @brief Remove failed JOINING members and replan.
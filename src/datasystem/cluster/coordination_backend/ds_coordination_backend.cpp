@@ -1133,6 +1133,12 @@ void DsCoordinationBackend::SetMembershipRecreateGate(MembershipRecreateGate gat
     membershipRecreateGate_ = std::move(gate);
 }
 
+void DsCoordinationBackend::SetAdvertisedCapacityMb(uint64_t capacityMb)
+{
+    std::lock_guard<std::mutex> lock(keepAliveMutex_);
+    keepAliveValue_.capacityMb = capacityMb;
+}
+
 Status DsCoordinationBackend::PrepareMembershipRecreate()
 {
     MembershipRecreateGate recreateGate;
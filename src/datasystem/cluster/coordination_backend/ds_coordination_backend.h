@@ -266,6 +266,12 @@ public:
      */
     void SetMembershipRecreateGate(MembershipRecreateGate gate);
 
+    /**
+     * @brief Set the shared memory size advertised in the membership lease value.
+     * @param[in] capacityMb Capacity in MB, read by capacity-aware placement.
+     */
+    void SetAdvertisedCapacityMb(uint64_t capacityMb);
+
     /**
      * @brief Run the local cleanup gate before accepting a recreated membership.
      */
@@ -44,6 +44,7 @@ struct MembershipValue {
     MemberLifecycleState lifecycleState = MemberLifecycleState::UNKNOWN;
     std::string hostId;
     std::string compatibilityVersion;
+    uint64_t capacityMb = 0;  // Advertised shared memory size, 0 when the backend value cannot carry it.
 };
 
 /**
@@ -54,6 +55,7 @@ struct MembershipRecord {
     MemberLifecycleState state{ MemberLifecycleState::STARTING };
     int64_t timestamp{ 0 };
     std::string hostId;
+    uint64_t capacityMb{ 0 };
 };
 
 /**
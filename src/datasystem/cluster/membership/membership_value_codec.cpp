@@ -163,6 +163,7 @@ Status MembershipValueCodec::Encode(const MembershipValue &value, std::string &b
     pb.set_state(statePb);
     pb.set_host_id(value.hostId);
     pb.set_compatibility_version(value.compatibilityVersion);
+    pb.set_capacity_mb(value.capacityMb);
     std::string encoded;
     CHECK_FAIL_RETURN_STATUS(pb.SerializeToString(&encoded), K_RUNTIME_ERROR,
                              "serialize membership value proto failed");
@@ -200,6 +201,7 @@ Status MembershipValueCodec::Decode(const std::string &bytes, MembershipValue &v
     decoded.timestamp = pb.timestamp();
     decoded.hostId = pb.host_id();
     decoded.compatibilityVersion = pb.compatibility_version();
+    decoded.capacityMb = pb.capacity_mb();
     value = std::move(decoded);
     return Status::OK();
 }
@@ -244,6 +244,11 @@ bool TopologySnapshot::ClusterHasInit() const noexcept
     return state_.clusterHasInit;
 }
 
+const std::string &TopologySnapshot::PlacementAlgorithm() const noexcept
+{
+    return state_.placementAlgorithm;
+}
+
 const std::optional<ActiveBatch> &TopologySnapshot::GetActiveBatch() const noexcept
 {
     return state_.activeBatch;
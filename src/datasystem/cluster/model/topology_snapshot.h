@@ -60,6 +60,12 @@ public:
     const std::string &CanonicalDigest() const noexcept;
     bool ClusterHasInit() const noexcept;
 
+    /**
+     * @brief Return the planning algorithm recorded in the topology.
+     * @return Algorithm id, empty if the topology predates the record.
+     */
+    const std::string &PlacementAlgorithm() const noexcept;
+
     /**
      * @brief Return the minimal active batch.
      * @return Stable snapshot-lifetime optional reference.
@@ -107,6 +107,8 @@ struct TopologyState {
     uint64_t version{ 0 };
     std::vector<Member> members;
     std::optional<ActiveBatch> activeBatch;
+    // Planning algorithm that placed the tokens. Empty on topologies written before it was recorded.
+    std::string placementAlgorithm;
 };
 
 struct TopologyTaskRange {
@@ -189,6 +189,7 @@ Status TopologyRepositoryCodec::EncodeTopology(const TopologyState &state, std::
     pb.set_cluster_has_init(canonical.clusterHasInit);
     pb.set_version(canonical.version);
     pb.set_schema_version(SCHEMA_VERSION);
+    pb.set_placement_algorithm(canonical.placementAlgorithm);
     for (const auto &member : canonical.members) {
         auto &memberPb = (*pb.mutable_members())[member.identity.address];
         memberPb.set_id(member.identity.id);
@@ -223,6 +224,7 @@ Status TopologyRepositoryCodec::DecodeTopology(const std::string &value, Topolog
     TopologyState decoded;
     decoded.clusterHasInit = pb.cluster_has_init();
     decoded.version = pb.version();
+    decoded.placementAlgorithm = pb.placement_algorithm();
     decoded.members.reserve(static_cast<size_t>(pb.members_size()));
     for (const auto &[address, memberPb] : pb.members()) {
         const int stateValue = static_cast<int>(memberPb.state());
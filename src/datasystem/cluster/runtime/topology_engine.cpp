@@ -16,7 +16,7 @@
 #include <unordered_set>
 #include <utility>
 
-#include "datasystem/cluster/algorithm/hash_algorithm.h"
+#include "datasystem/cluster/algorithm/algorithm_catalog.h"
 #include "datasystem/cluster/control/topology_controller_runtime.h"
 #include "datasystem/cluster/coordination_backend/ds_coordination_backend.h"
 #include "datasystem/cluster/coordination_backend/etcd_coordination_backend.h"
@@ -25,6 +25,7 @@
 #include "datasystem/cluster/membership/membership_value_codec.h"
 #include "datasystem/cluster/model/topology_diagnostics.h"
 #include "datasystem/cluster/repository/topology_repository_codec.h"
+#include "datasystem/common/flags/common_flags.h"
 #include "datasystem/common/kvstore/etcd/etcd_store.h"
 #include "datasystem/common/log/log.h"
 #include "datasystem/common/log/spdlog/provider.h"
@@ -173,6 +174,7 @@ struct TopologyEngine::Builder::Config {
     std::function<Status(WorkerProbeRequest)> workerProbeHandler;
     std::function<void(TopologyAvailabilityLevel)> availabilityHandler;
     std::function<Status()> membershipRecreateGate;
+    uint64_t advertisedCapacityMb{ 0 };
     std::function<Status(const std::map<std::string, int64_t> &, RestartEffectMode)> membershipRestartHandler;
     std::function<void(std::shared_ptr<const TopologySnapshot>)> snapshotPublishedHandler;
     std::chrono::seconds nodeDeadTimeout{ TopologyControllerOptions{}.nodeDeadTimeout };
@@ -185,7 +187,9 @@ struct TopologyEngine::Builder::Config {
     std::unique_ptr<TopologyKeyHelper> keys;
     std::unique_ptr<ICoordinationBackend> memberBackend;
     std::unique_ptr<ICoordinationBackend> controllerBackend;
-    std::unique_ptr<HashAlgorithm> algorithm;
+    std::unique_ptr<AlgorithmCatalog> algorithms;
+    const IRoutingAlgorithm *routing{ nullptr };
+    const IPlanningAlgorithm *planning{ nullptr };
 };
 
 TopologyEngine::Builder::Builder() : config_(std::make_unique<Config>())
@@ -287,6 +291,14 @@ TopologyEngine::Builder &TopologyEngine::Builder::SetMembershipRecreateGate(std:
     return *this;
 }
 
+TopologyEngine::Builder &TopologyEngine::Builder::SetAdvertisedCapacity(uint64_t capacityMb)
+{
+    if (config_ != nullptr) {
+        config_->advertisedCapacityMb = capacityMb;
+    }
+    return *this;
+}
+
 TopologyEngine::Builder &TopologyEngine::Builder::SetMembershipRestartHandler(
     std::function<Status(const std::map<std::string, int64_t> &, RestartEffectMode)> handler)
 {
@@ -367,15 +379,18 @@ Status TopologyEngine::Builder::CreateOwnedDependencies()
     if (config_->backendKind == Config::BackendKind::ETCD) {
         RETURN_IF_NOT_OK(RegisterEtcdTopologyTables(*config_->memberStore, *config_->keys));
     }
-    config_->algorithm = std::make_unique<HashAlgorithm>();
+    config_->algorithms = std::make_unique<AlgorithmCatalog>();
+    RETURN_IF_NOT_OK(config_->algorithms->GetRouting(FLAGS_cluster_placement_algorithm, config_->routing));
+    RETURN_IF_NOT_OK(config_->algorithms->GetPlanning(FLAGS_cluster_placement_algorithm, config_->planning));
     if (config_->backendKind == Config::BackendKind::ETCD) {
         config_->memberBackend = std::make_unique<EtcdCoordinationBackend>(config_->memberStore);
         config_->controllerBackend = std::make_unique<EtcdCoordinationBackend>(config_->memberStore);
     } else {
         config_->memberBackend =
             std::make_unique<DsCoordinationBackend>(config_->coordinatorProxy, config_->localAddress);
-        static_cast<DsCoordinationBackend *>(config_->memberBackend.get())
-            ->SetMembershipRecreateGate(std::move(config_->membershipRecreateGate));
+        auto *backend = static_cast<DsCoordinationBackend *>(config_->memberBackend.get());
+        backend->SetMembershipRecreateGate(std::move(config_->membershipRecreateGate));
+        backend->SetAdvertisedCapacityMb(config_->advertisedCapacityMb);
     }
     return Status::OK();
 }
@@ -447,7 +462,9 @@ TopologyEngine::TopologyEngine(std::unique_ptr<Builder::Config> config)
     : options_(ConsumeRuntimeOptions(*config)),
       memberBackend_(std::move(config->memberBackend)),
       controllerBackend_(std::move(config->controllerBackend)),
-      algorithm_(std::move(config->algorithm)),
+      algorithms_(std::move(config->algorithms)),
+      routing_(config->routing),
+      planning_(config->planning),
       coordinatorProxy_(config->coordinatorProxy),
       coordinatorIngress_(std::move(config->ingress)),
       membershipRestartHandler_(std::move(config->membershipRestartHandler)),
@@ -456,7 +473,7 @@ TopologyEngine::TopologyEngine(std::unique_ptr<Builder::Config> config)
       reader_(repository_),
       dispatcher_(options_.eventQueueCapacity),
       membershipView_(snapshots_),
-      placement_(snapshots_, *algorithm_, options_.localAddress),
+      placement_(snapshots_, *routing_, options_.localAddress),
       executor_(options_.localAddress, repository_, snapshots_, *config->callbacks, dispatcher_,
                 membershipRestartHandler_, options_.executor)
 {
@@ -508,7 +525,7 @@ Status TopologyEngine::InitializeOwnedComponents(std::chrono::seconds nodeDeadTi
         runtimeOptions.controller.eventSourceMode = TopologyEventSourceMode::EXTERNAL_ETCD;
         runtimeOptions.janitor = TopologyTaskJanitorOptions{};
         RETURN_IF_NOT_OK(TopologyControllerRuntime::Create(
-            std::move(runtimeOptions), *controllerBackend_, *algorithm_, controllerRuntime_));
+            std::move(runtimeOptions), *controllerBackend_, *planning_, controllerRuntime_));
     }
     InitializeCoordinatorComponents();
     return Status::OK();
@@ -942,7 +959,7 @@ Status TopologyEngine::CheckLocalServingReady(std::string_view placementKey) con
     CHECK_FAIL_RETURN_STATUS(IsCommittedMemberState(local->state), K_NOT_READY,
                              "local topology member is not committed");
     const Member *owner = nullptr;
-    RETURN_IF_NOT_OK(algorithm_->LocateOwner(*snapshot, algorithm_->Hash(placementKey), owner));
+    RETURN_IF_NOT_OK(routing_->LocateOwner(*snapshot, routing_->Hash(placementKey), owner));
     CHECK_FAIL_RETURN_STATUS(owner != nullptr, K_RUNTIME_ERROR, "routing algorithm returned a null owner");
     CHECK_FAIL_RETURN_STATUS(AllowsBusinessTraffic(GetAvailability()), K_NOT_READY,
                              "cluster topology availability changed while checking serving readiness");
@@ -1127,7 +1144,7 @@ Status TopologyEngine::GetRecoveryTopology(uint64_t &topologyVersion, std::strin
     }
     RETURN_IF_NOT_OK(rc);
     TopologyState state{ snapshot->ClusterHasInit(), snapshot->Version(), snapshot->Members(),
-                         snapshot->GetActiveBatch() };
+                         snapshot->GetActiveBatch(), snapshot->PlacementAlgorithm() };
     std::string encoded;
     RETURN_IF_NOT_OK(TopologyRepositoryCodec::EncodeTopology(state, encoded));
     topologyVersion = snapshot->Version();
@@ -40,7 +40,9 @@ class ICoordinatorServiceProxy;
 
 namespace datasystem::cluster {
 
-class HashAlgorithm;
+class AlgorithmCatalog;
+class IPlanningAlgorithm;
+class IRoutingAlgorithm;
 class ITopologyPhaseCallbacks;
 class TopologyControllerRuntime;
 class TopologyRecoveryReporter;
@@ -160,6 +162,13 @@ public:
          */
         Builder &SetMembershipRecreateGate(std::function<Status()> gate);
 
+        /**
+         * @brief Set the shared memory size this member advertises to capacity-aware placement.
+         * @param[in] capacityMb Capacity in MB; only the Coordinator-backed membership value carries it.
+         * @return This Builder.
+         */
+        Builder &SetAdvertisedCapacity(uint64_t capacityMb);
+
         /**
          * @brief Register the existing member-restart cleanup sink.
          * @param[in] handler Batched restart sink and its named completion contract.
@@ -618,7 +627,9 @@ private:
     RuntimeOptions options_;
     std::unique_ptr<ICoordinationBackend> memberBackend_;
     std::unique_ptr<ICoordinationBackend> controllerBackend_;
-    std::unique_ptr<HashAlgorithm> algorithm_;
+    std::unique_ptr<AlgorithmCatalog> algorithms_;
+    const IRoutingAlgorithm *routing_{ nullptr };    // Owned by algorithms_.
+    const IPlanningAlgorithm *planning_{ nullptr };  // Owned by algorithms_.
     ICoordinatorServiceProxy *coordinatorProxy_{ nullptr };  // Non-owning; outlives the Engine.
     CoordinatorWatchIngress coordinatorIngress_;
     std::function<Status(const std::map<std::string, int64_t> &, RestartEffectMode)> membershipRestartHandler_;
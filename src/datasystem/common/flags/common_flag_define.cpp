@@ -122,12 +122,23 @@ DS_DEFINE_uint32(hash_ring_tokens_per_member, 4,
                  "Token count allocated to each Worker for new hash-ring bootstrap and scale-out plans. "
                  "Valid range is 1-4096. This startup-only setting must be identical on every topology planner "
                  "process in a cluster.");
+DS_DEFINE_string(cluster_placement_algorithm, "hash",
+                 "Topology planning algorithm of the cluster, 'hash' gives every Worker hash_ring_tokens_per_member "
+                 "tokens, 'weighted_hash' scales the token count by the shared memory size each Worker advertises. "
+                 "This startup-only setting must be identical on every topology planner process in a cluster.");
+DS_DEFINE_uint64(hash_ring_reference_capacity_mb, 1024,
+                 "Advertised shared memory size in MB that earns hash_ring_tokens_per_member tokens under the "
+                 "'weighted_hash' placement algorithm. It must be identical on every topology planner process and "
+                 "stay unchanged for the life of the cluster.");
 DS_DEFINE_uint32(scale_in_collect_window_ms, DEFAULT_SCALE_IN_COLLECT_WINDOW_MS,
                  "ordinary SCALE_IN batch coalescing window in milliseconds. When non-zero, the first PRE_LEAVING "
                  "candidate opens a short collect window so members exiting within it land in the same epoch; "
                  "0 disables coalescing (legacy immediate-batch behavior). Hard upper bound 5000ms.");
 DS_DEFINE_uint64(stream_idle_time_s, 5 * 60, "stream idle time. default 300s (5 minutes)");
 DS_DEFINE_int64(payload_nocopy_threshold, 1048576L * 100L, "minimum payload size to trigger no memory copy");
+DS_DEFINE_int64(zerocopy_send_threshold, 0,
+                "Frames of at least this size are sent with MSG_ZEROCOPY over tcp, so the kernel reads them straight "
+                "from the sender memory. 0 to disable.");
 DS_DEFINE_bool(enable_multi_stubs, false, "deprecated");
 DS_DEFINE_bool(enable_tcp_direct_for_multi_stubs, false, "deprecated");
 DS_DEFINE_bool_dynamic(log_monitor, true, "Indicates whether to enable log monitoring, default is true.");
@@ -137,6 +148,10 @@ DS_DEFINE_bool_dynamic(auto_del_dead_node, true, "Remove dead node from hash rin
 DS_DEFINE_bool(enable_huge_tlb, false,
                "enable_huge_tlb can improve memory access and reducing the overhead of page table,"
                "default is disable.");
+DS_DEFINE_uint32(huge_tlb_page_size_mb, 0,
+                 "Huge page size in MB of the shared memory when enable_huge_tlb is set, e.g. 2 or 1024. 0 uses the "
+                 "default huge page size of the system. The pool of this size in /sys/kernel/mm/hugepages must be "
+                 "large enough, otherwise the shared memory falls back to regular pages.");
 DS_DEFINE_bool(enable_data_replication, true,
                "Allow data replica cache locally; mainly for performance validation, keep enabled unless needed.");
 
@@ -151,6 +166,15 @@ DS_DEFINE_uint32(rebalance_source_usage_percent, 80,
 DS_DEFINE_uint32(rebalance_usage_gap_percent, 20,
                  "Minimum memory usage percent gap between source and target for memory rebalance.");
 DS_DEFINE_uint32(rebalance_task_report_grace_ms, 30000, "rebalance task report grace ms.");
+DS_DEFINE_string(rebalance_candidate_policy, "oldest",
+                 "How a memory rebalance source picks the objects of a batch. 'oldest' takes objects in eviction "
+                 "order. 'cost_aware' scores the objects near the eviction hand by bytes per metadata update, recent "
+                 "reads and live references, and reaches the batch size with the fewest cold objects.");
+DS_DEFINE_bool(rebalance_global_plan, false,
+               "Plan memory rebalance for the whole cluster at once. The master moves every worker toward the "
+               "cluster mean usage, pairs many sources with many targets within the per-worker migration rate of "
+               "one resource report cycle, and chains a source's planned targets without waiting for its next "
+               "report. When disabled, each reporting source gets the single best target.");
 DS_DEFINE_uint32(node_timeout_s, 60, "maximum time interval before a node is considered lost");
 DS_DEFINE_int32(io_thread_nice, 0,
                 "Nice value for selected IO threads. Valid range is [-20, 19]. 0 skips nice adjustment and preserves "
@@ -26,12 +26,16 @@ DS_DECLARE_bool(enable_sched_runtime);
 DS_DECLARE_int32(zmq_chunk_sz);
 DS_DECLARE_uint32(node_timeout_s);
 DS_DECLARE_uint32(hash_ring_tokens_per_member);
+DS_DECLARE_string(cluster_placement_algorithm);
+DS_DECLARE_uint64(hash_ring_reference_capacity_mb);
 DS_DECLARE_uint64(stream_idle_time_s);
 DS_DECLARE_int64(payload_nocopy_threshold);
+DS_DECLARE_int64(zerocopy_send_threshold);
 DS_DECLARE_bool(enable_multi_stubs);
 DS_DECLARE_bool(enable_tcp_direct_for_multi_stubs);
 DS_DECLARE_bool(log_monitor);
 DS_DECLARE_bool(json_log_monitor);
+DS_DECLARE_uint32(huge_tlb_page_size_mb);
 DS_DECLARE_bool(enable_data_replication);
 DS_DECLARE_bool(enable_worker_worker_batch_get);
 DS_DECLARE_bool(enable_urma);
@@ -77,6 +81,8 @@ DS_DECLARE_bool(enable_memory_rebalance);
 DS_DECLARE_uint32(rebalance_source_usage_percent);
 DS_DECLARE_uint32(rebalance_usage_gap_percent);
 DS_DECLARE_uint32(rebalance_task_report_grace_ms);
+DS_DECLARE_bool(rebalance_global_plan);
+DS_DECLARE_string(rebalance_candidate_policy);
 DS_DECLARE_string(etcd_address);
 DS_DECLARE_string(kv_events_config);
 DS_DECLARE_int32(oc_worker_worker_direct_port);
@@ -53,6 +53,26 @@ bool ValidateSharedMemoryDistributionPolicy(const char *flagName, const std::str
     return false;
 }
 
+bool ValidateRebalanceCandidatePolicy(const char *flagName, const std::string &value)
+{
+    if (value == "oldest" || value == "cost_aware") {
+        return true;
+    }
+    LOG(ERROR) << FormatString("Invalid %s value: %s. Optional values are 'oldest', 'cost_aware'.", flagName, value);
+    return false;
+}
+
+bool ValidateHugeTlbPageSize(const char *flagName, uint32_t value)
+{
+    constexpr uint32_t maxPageSizeMb = 1024;
+    if (value == 0 || (value <= maxPageSizeMb && (value & (value - 1)) == 0)) {
+        return true;
+    }
+    LOG(ERROR) << FormatString("The %s flag is %u, which must be 0 or a power of two no larger than %u.", flagName,
+                               value, maxPageSizeMb);
+    return false;
+}
+
 bool ValidateUbTransportArenaNum(const char *flagName, uint32_t value)
 {
     constexpr uint32_t kMinArenaNum = 1;
@@ -261,6 +281,8 @@ DS_DEFINE_validator(enable_rdma, &ValidateEnableRdma);
 DS_DEFINE_validator(rebalance_source_usage_percent, &ValidatePercent);
 DS_DEFINE_validator(rebalance_usage_gap_percent, &ValidatePercent);
 DS_DEFINE_validator(rebalance_task_report_grace_ms, &Validator::ValidateUint32);
+DS_DEFINE_validator(rebalance_candidate_policy, &ValidateRebalanceCandidatePolicy);
+DS_DEFINE_validator(huge_tlb_page_size_mb, &ValidateHugeTlbPageSize);
 DS_DEFINE_validator(monitor_config_file, &Validator::ValidatePathString);
 DS_DEFINE_validator(unix_domain_socket_dir, &Validator::ValidateUnixDomainSocketDir);
 DS_DEFINE_validator(log_filename, &ValidateOptionalLogName);
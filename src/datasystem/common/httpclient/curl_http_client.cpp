@@ -22,6 +22,8 @@
 #include <atomic>
 #include <climits>
 #include <condition_variable>
+#include <cstdlib>
+#include <cstring>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -293,6 +295,15 @@ size_t CurlHttpClient::RecvHeadersCallBack(char *buffer, size_t size, size_t nme
         return RECV_ERR;
     }
     std::string header(buffer, totalSize);
+    if (header.compare(0, strlen("HTTP/"), "HTTP/") == 0) {
+        // The status line, recorded before the body arrives so that a body stream can tell a partial content from
+        // an error reply. The last one wins after an interim reply such as 100 Continue.
+        std::size_t spacePos = header.find(' ');
+        if (spacePos != std::string::npos) {
+            resp->SetStatus(static_cast<int>(std::strtol(header.c_str() + spacePos + 1, nullptr, 10)));
+        }
+        return totalSize;
+    }
     std::size_t colonPos = header.find(':');
     if (colonPos == std::string::npos) {
         return totalSize;
@@ -452,16 +463,10 @@ Status CurlHttpClient::TslSend(const std::shared_ptr<HttpRequest> &request, std:
     return SendRequest(request, response, curlHandle);
 }
 
-Status CurlHttpClient::SendRequest(const std::shared_ptr<HttpRequest> &request, std::shared_ptr<HttpResponse> &response,
-                                   CURL *curlHandle)
+Status CurlHttpClient::PrepareTransfer(CURL *curlHandle, const std::shared_ptr<HttpRequest> &request,
+                                       std::shared_ptr<HttpResponse> &response, curl_slist *&list)
 {
-    bool cleanUp = false;
-    Raii curlResourceGiveBack([&]() { curlHandlePool_->Release(curlHandle, cleanUp); });
-    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(curlHandle != nullptr, K_RUNTIME_ERROR,
-                                         "The curlHandle pool has been shutdown, send request failed");
-    curl_slist *list = nullptr;
     request->BuildRequest();
-    Raii raii([&request] { request->ClearSensitiveInfo(); });
     AddContentLengthHeader(request);
     HandleHeader(request, list);
 
@@ -474,8 +479,6 @@ Status CurlHttpClient::SendRequest(const std::shared_ptr<HttpRequest> &request,
     CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(list != nullptr, K_RUNTIME_ERROR,
                                          "curl list point is nullptr, send http message failed");
 
-    Raii freeCurlList([&]() { curl_slist_free_all(list); });
-
     ConfigCurlDefaultOption(curlHandle);
     curl_easy_setopt(curlHandle, CURLOPT_TIMEOUT_MS, request->GetRequestTimeoutMs());
     curl_easy_setopt(curlHandle, CURLOPT_CONNECTTIMEOUT_MS, request->GetConnectTimeoutMs());
@@ -487,6 +490,20 @@ Status CurlHttpClient::SendRequest(const std::shared_ptr<HttpRequest> &request,
     curl_easy_setopt(curlHandle, CURLOPT_HTTPHEADER, list);
 
     SetCallBackFunc(curlHandle, request, response);
+    return Status::OK();
+}
+
+Status CurlHttpClient::SendRequest(const std::shared_ptr<HttpRequest> &request, std::shared_ptr<HttpResponse> &response,
+                                   CURL *curlHandle)
+{
+    bool cleanUp = false;
+    Raii curlResourceGiveBack([&]() { curlHandlePool_->Release(curlHandle, cleanUp); });
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(curlHandle != nullptr, K_RUNTIME_ERROR,
+                                         "The curlHandle pool has been shutdown, send request failed");
+    curl_slist *list = nullptr;
+    Raii raii([&request] { request->ClearSensitiveInfo(); });
+    Raii freeCurlList([&]() { curl_slist_free_all(list); });
+    RETURN_IF_NOT_OK(PrepareTransfer(curlHandle, request, response, list));
 
     char errBuf[CURL_ERROR_SIZE] = { 0 };
     curl_easy_setopt(curlHandle, CURLOPT_ERRORBUFFER, errBuf);
@@ -218,6 +218,18 @@ public:
 
     Status Send(const std::shared_ptr<HttpRequest> &request, std::shared_ptr<HttpResponse> &response) override;
 
+protected:
+    /**
+     * @brief Build the request and set all the options of one transfer on a curl handle.
+     * @param[in] curlHandle curl handle
+     * @param[in] request http request, the caller clears its sensitive info after the transfer
+     * @param[in] response http response receiving the headers and the body
+     * @param[out] list the header list set on the handle, the caller frees it after the transfer
+     * @return Status of the call
+     */
+    Status PrepareTransfer(CURL *curlHandle, const std::shared_ptr<HttpRequest> &request,
+                           std::shared_ptr<HttpResponse> &response, curl_slist *&list);
+
 private:
     /**
      * @brief Obtains the action corresponding to the HTTP request, for example, "POST /v1/api/token"
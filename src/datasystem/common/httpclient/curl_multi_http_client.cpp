@@ -0,0 +1,336 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Event driven http client on curl_multi, many requests in flight on one thread.
+ */
+#include "datasystem/common/httpclient/curl_multi_http_client.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "datasystem/common/log/log.h"
+#include "datasystem/common/util/format.h"
+#include "datasystem/common/util/status_helper.h"
+#include "datasystem/common/util/strings_util.h"
+#include "datasystem/common/util/wait_post.h"
+
+namespace datasystem {
+namespace {
+constexpr int MAX_EPOLL_EVENTS = 256;
+// Bounds the wait when libcurl has no timer, Shutdown() also wakes the loop at once.
+constexpr int IDLE_WAIT_MS = 1000;
+}  // namespace
+
+CurlMultiHttpClient::CurlMultiHttpClient(bool verifyServer, long maxHostConnections, long maxTotalConnections)
+    : CurlHttpClient(verifyServer), maxHostConnections_(maxHostConnections), maxTotalConnections_(maxTotalConnections)
+{
+}
+
+CurlMultiHttpClient::~CurlMultiHttpClient()
+{
+    Shutdown();
+}
+
+Status CurlMultiHttpClient::Init()
+{
+    RETURN_OK_IF_TRUE(loopThread_ != nullptr);
+    multi_ = curl_multi_init();
+    CHECK_FAIL_RETURN_STATUS(multi_ != nullptr, K_RUNTIME_ERROR, "curl_multi_init failed");
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    CHECK_FAIL_RETURN_STATUS(epollFd_ >= 0, K_RUNTIME_ERROR, FormatString("epoll_create1 failed: %s", StrErr(errno)));
+    wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    CHECK_FAIL_RETURN_STATUS(wakeFd_ >= 0, K_RUNTIME_ERROR, FormatString("eventfd failed: %s", StrErr(errno)));
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = wakeFd_;
+    CHECK_FAIL_RETURN_STATUS(epoll_ctl(epollFd_, EPOLL_CTL_ADD, wakeFd_, &event) == 0, K_RUNTIME_ERROR,
+                             FormatString("epoll_ctl failed: %s", StrErr(errno)));
+
+    curl_multi_setopt(multi_, CURLMOPT_SOCKETFUNCTION, SocketCallback);
+    curl_multi_setopt(multi_, CURLMOPT_SOCKETDATA, this);
+    curl_multi_setopt(multi_, CURLMOPT_TIMERFUNCTION, TimerCallback);
+    curl_multi_setopt(multi_, CURLMOPT_TIMERDATA, this);
+    curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, maxHostConnections_);
+    curl_multi_setopt(multi_, CURLMOPT_MAX_TOTAL_CONNECTIONS, maxTotalConnections_);
+    if (maxTotalConnections_ > 0) {
+        curl_multi_setopt(multi_, CURLMOPT_MAXCONNECTS, maxTotalConnections_);
+    }
+    loopThread_ = std::make_unique<Thread>([this]() { Loop(); });
+    loopThread_->set_name("CurlMultiLoop");
+    LOG(INFO) << FormatString("Curl multi http client started, max host connections %ld, max total connections %ld",
+                              maxHostConnections_, maxTotalConnections_);
+    return Status::OK();
+}
+
+void CurlMultiHttpClient::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(submitMutex_);
+        stop_ = true;
+    }
+    if (loopThread_ != nullptr) {
+        uint64_t one = 1;
+        (void)write(wakeFd_, &one, sizeof(one));
+        loopThread_->join();
+        loopThread_.reset();
+    }
+    std::deque<std::unique_ptr<Transfer>> submitted;
+    {
+        std::lock_guard<std::mutex> lock(submitMutex_);
+        submitted.swap(submitted_);
+    }
+    for (auto &transfer : submitted) {
+        Complete(std::move(transfer), CURLE_ABORTED_BY_CALLBACK);
+    }
+    for (auto &entry : running_) {
+        curl_multi_remove_handle(multi_, entry.first);
+        Complete(std::move(entry.second), CURLE_ABORTED_BY_CALLBACK);
+    }
+    running_.clear();
+    if (multi_ != nullptr) {
+        curl_multi_cleanup(multi_);
+        multi_ = nullptr;
+    }
+    for (CURL *handle : idleHandles_) {
+        curl_easy_cleanup(handle);
+    }
+    idleHandles_.clear();
+    for (int *fd : { &epollFd_, &wakeFd_ }) {
+        if (*fd >= 0) {
+            RETRY_ON_EINTR(close(*fd));
+            *fd = -1;
+        }
+    }
+}
+
+Status CurlMultiHttpClient::SendAsync(const std::shared_ptr<HttpRequest> &request,
+                                      const std::shared_ptr<HttpResponse> &response, Callback callback)
+{
+    CHECK_FAIL_RETURN_STATUS(request != nullptr && response != nullptr, K_INVALID, "Null http request or response");
+    CHECK_FAIL_RETURN_STATUS(loopThread_ != nullptr, K_RUNTIME_ERROR, "The curl multi client is not initialized");
+    auto transfer = std::make_unique<Transfer>();
+    transfer->handle = AcquireHandle();
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(transfer->handle != nullptr, K_RUNTIME_ERROR, "curl_easy_init failed");
+    transfer->request = request;
+    transfer->response = response;
+    transfer->callback = std::move(callback);
+    Status rc = PrepareTransfer(transfer->handle, request, transfer->response, transfer->headers);
+    if (rc.IsOk()) {
+        curl_easy_setopt(transfer->handle, CURLOPT_ERRORBUFFER, transfer->errBuf);
+        curl_easy_setopt(transfer->handle, CURLOPT_PRIVATE, transfer.get());
+        curl_easy_setopt(transfer->handle, CURLOPT_TCP_KEEPALIVE, 1L);
+        std::lock_guard<std::mutex> lock(submitMutex_);
+        if (stop_) {
+            rc = Status(K_RUNTIME_ERROR, "The curl multi client has been shutdown");
+        } else {
+            submitted_.emplace_back(std::move(transfer));
+            inflight_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (rc.IsError()) {
+        request->ClearSensitiveInfo();
+        curl_slist_free_all(transfer->headers);
+        ReleaseHandle(transfer->handle, false);
+        return rc;
+    }
+    uint64_t one = 1;
+    (void)write(wakeFd_, &one, sizeof(one));
+    return Status::OK();
+}
+
+Status CurlMultiHttpClient::Send(const std::shared_ptr<HttpRequest> &request, std::shared_ptr<HttpResponse> &response)
+{
+    if (response == nullptr) {
+        response = std::make_shared<HttpResponse>();
+        response->SetBody(std::make_shared<std::stringstream>());
+    }
+    WaitPost done;
+    RETURN_IF_NOT_OK(SendAsync(request, response, [&done](const Status &rc, const std::shared_ptr<HttpResponse> &) {
+        done.SetWithStatus(rc);
+    }));
+    return done.WaitAndGetStatus();
+}
+
+int CurlMultiHttpClient::SocketCallback(CURL *easy, curl_socket_t sock, int what, void *userp, void *socketp)
+{
+    (void)easy;
+    (void)socketp;
+    auto *client = static_cast<CurlMultiHttpClient *>(userp);
+    if (what == CURL_POLL_REMOVE) {
+        (void)epoll_ctl(client->epollFd_, EPOLL_CTL_DEL, sock, nullptr);
+        return 0;
+    }
+    epoll_event event{};
+    event.data.fd = sock;
+    event.events = ((what & CURL_POLL_IN) ? EPOLLIN : 0u) | ((what & CURL_POLL_OUT) ? EPOLLOUT : 0u);
+    if (epoll_ctl(client->epollFd_, EPOLL_CTL_MOD, sock, &event) == 0) {
+        return 0;
+    }
+    if (errno == ENOENT && epoll_ctl(client->epollFd_, EPOLL_CTL_ADD, sock, &event) == 0) {
+        return 0;
+    }
+    // A socket left in the set with stale events would spin the loop, drop it and let libcurl fail the transfer.
+    LOG(ERROR) << FormatString("Watch curl socket %d failed: %s", sock, StrErr(errno));
+    (void)epoll_ctl(client->epollFd_, EPOLL_CTL_DEL, sock, nullptr);
+    return -1;
+}
+
+int CurlMultiHttpClient::TimerCallback(CURLM *multi, long timeoutMs, void *userp)
+{
+    (void)multi;
+    auto *client = static_cast<CurlMultiHttpClient *>(userp);
+    client->timerSet_ = timeoutMs >= 0;
+    if (client->timerSet_) {
+        client->timerDeadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    }
+    return 0;
+}
+
+int CurlMultiHttpClient::NextWaitMs() const
+{
+    if (!timerSet_) {
+        return IDLE_WAIT_MS;
+    }
+    auto waitMs = std::chrono::duration_cast<std::chrono::milliseconds>(timerDeadline_
+                                                                        - std::chrono::steady_clock::now())
+                      .count();
+    return static_cast<int>(std::clamp<int64_t>(waitMs, 0, IDLE_WAIT_MS));
+}
+
+void CurlMultiHttpClient::Loop()
+{
+    epoll_event events[MAX_EPOLL_EVENTS];
+    int running = 0;
+    while (!stop_) {
+        int num = epoll_wait(epollFd_, events, MAX_EPOLL_EVENTS, NextWaitMs());
+        if (num < 0 && errno != EINTR) {
+            LOG(ERROR) << "epoll_wait of curl multi loop failed: " << StrErr(errno);
+        }
+        for (int i = 0; i < num; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == wakeFd_) {
+                uint64_t count = 0;
+                (void)read(wakeFd_, &count, sizeof(count));
+                AddSubmitted();
+                continue;
+            }
+            int flags = ((events[i].events & EPOLLIN) ? CURL_CSELECT_IN : 0)
+                        | ((events[i].events & EPOLLOUT) ? CURL_CSELECT_OUT : 0)
+                        | ((events[i].events & (EPOLLERR | EPOLLHUP)) ? CURL_CSELECT_ERR : 0);
+            curl_multi_socket_action(multi_, fd, flags, &running);
+        }
+        if (timerSet_ && std::chrono::steady_clock::now() >= timerDeadline_) {
+            timerSet_ = false;
+            curl_multi_socket_action(multi_, CURL_SOCKET_TIMEOUT, 0, &running);
+        }
+        CompleteFinished();
+    }
+}
+
+void CurlMultiHttpClient::AddSubmitted()
+{
+    std::deque<std::unique_ptr<Transfer>> submitted;
+    {
+        std::lock_guard<std::mutex> lock(submitMutex_);
+        submitted.swap(submitted_);
+    }
+    for (auto &transfer : submitted) {
+        CURL *handle = transfer->handle;
+        CURLMcode code = curl_multi_add_handle(multi_, handle);
+        if (code != CURLM_OK) {
+            LOG(ERROR) << "curl_multi_add_handle failed: " << curl_multi_strerror(code);
+            Complete(std::move(transfer), CURLE_FAILED_INIT);
+            continue;
+        }
+        running_.emplace(handle, std::move(transfer));
+    }
+}
+
+void CurlMultiHttpClient::CompleteFinished()
+{
+    CURLMsg *msg = nullptr;
+    int left = 0;
+    while ((msg = curl_multi_info_read(multi_, &left)) != nullptr) {
+        if (msg->msg != CURLMSG_DONE) {
+            continue;
+        }
+        CURL *handle = msg->easy_handle;
+        CURLcode res = msg->data.result;
+        curl_multi_remove_handle(multi_, handle);
+        auto iter = running_.find(handle);
+        if (iter == running_.end()) {
+            continue;
+        }
+        auto transfer = std::move(iter->second);
+        running_.erase(iter);
+        Complete(std::move(transfer), res);
+    }
+}
+
+void CurlMultiHttpClient::Complete(std::unique_ptr<Transfer> transfer, CURLcode res)
+{
+    Status rc;
+    if (res != CURLE_OK) {
+        rc = Status(K_RUNTIME_ERROR, __LINE__, __FILE__,
+                    FormatString("Fail to send http request, error reason is:%s, error info is:%s",
+                                 curl_easy_strerror(res), transfer->errBuf));
+    } else {
+        long statusCode = HttpResponse::STATUS_CLIENT_ERR;
+        curl_easy_getinfo(transfer->handle, CURLINFO_RESPONSE_CODE, &statusCode);
+        transfer->response->SetStatus(static_cast<int>(statusCode));
+    }
+    transfer->point.Record();
+    transfer->request->ClearSensitiveInfo();
+    curl_slist_free_all(transfer->headers);
+    ReleaseHandle(transfer->handle, res != CURLE_OK);
+    inflight_.fetch_sub(1, std::memory_order_relaxed);
+    if (transfer->callback) {
+        transfer->callback(rc, transfer->response);
+    }
+}
+
+CURL *CurlMultiHttpClient::AcquireHandle()
+{
+    {
+        std::lock_guard<std::mutex> lock(handleMutex_);
+        if (!idleHandles_.empty()) {
+            CURL *handle = idleHandles_.back();
+            idleHandles_.pop_back();
+            return handle;
+        }
+    }
+    return curl_easy_init();
+}
+
+void CurlMultiHttpClient::ReleaseHandle(CURL *handle, bool cleanUp)
+{
+    if (handle == nullptr) {
+        return;
+    }
+    if (cleanUp) {
+        curl_easy_cleanup(handle);
+        return;
+    }
+    // The connections live in the multi handle, so an idle easy handle keeps no socket.
+    curl_easy_reset(handle);
+    std::lock_guard<std::mutex> lock(handleMutex_);
+    idleHandles_.push_back(handle);
+}
+}  // namespace datasystem
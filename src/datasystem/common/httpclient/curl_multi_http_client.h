@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Event driven http client on curl_multi, many requests in flight on one thread.
+ */
+#ifndef DATASYSTEM_COMMON_HTTPCLIENT_CURL_MULTI_HTTP_CLIENT_H
+#define DATASYSTEM_COMMON_HTTPCLIENT_CURL_MULTI_HTTP_CLIENT_H
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <curl/curl.h>
+
+#include "datasystem/common/httpclient/curl_http_client.h"
+#include "datasystem/common/perf/perf_manager.h"
+#include "datasystem/common/util/thread.h"
+
+namespace datasystem {
+/**
+ * The transfers are prepared on the calling thread and handed to one event loop thread, which drives all of them
+ * with curl_multi_socket_action() on an epoll set. A caller is never blocked by a busy connection: libcurl queues the
+ * transfers above the per host and the total connection limits and starts them when a kept-alive connection frees.
+ */
+class CurlMultiHttpClient : public CurlHttpClient {
+public:
+    /**
+     * @brief Called once when a transfer ends, on the event loop thread, so it must not block.
+     * @param[in] rc K_OK if the http exchange completed, whatever the http status; the transport error otherwise.
+     * @param[in] response The response given to SendAsync().
+     */
+    using Callback = std::function<void(const Status &rc, const std::shared_ptr<HttpResponse> &response)>;
+
+    /**
+     * @brief Construct the client, Init() starts the event loop.
+     * @param[in] verifyServer Whether to verify the peer certificate of https.
+     * @param[in] maxHostConnections Max connections to one host, 0 for no limit.
+     * @param[in] maxTotalConnections Max connections in total, also the size of the keep-alive cache, 0 for no limit.
+     */
+    explicit CurlMultiHttpClient(bool verifyServer = true, long maxHostConnections = 0, long maxTotalConnections = 0);
+
+    /**
+     * @brief Stop the event loop, the transfers still in flight complete with an error.
+     */
+    ~CurlMultiHttpClient() override;
+
+    /**
+     * @brief Create the multi handle and start the event loop thread.
+     * @return Status of the call.
+     */
+    Status Init();
+
+    /**
+     * @brief Stop the event loop and fail the transfers still in flight.
+     */
+    void Shutdown();
+
+    /**
+     * @brief Start a request and return at once.
+     * @param[in] request Message of http request.
+     * @param[in] response Message of http response, its body receives the response body.
+     * @param[in] callback Called once when the transfer ends, only if this call succeeds.
+     * @return Status of the call.
+     */
+    Status SendAsync(const std::shared_ptr<HttpRequest> &request, const std::shared_ptr<HttpResponse> &response,
+                     Callback callback);
+
+    /**
+     * @brief Send a request through the event loop and wait for it. Must not be called from a Callback.
+     * @param[in] request Message of http request.
+     * @param[out] response Message of http response.
+     * @return Status of the call.
+     */
+    Status Send(const std::shared_ptr<HttpRequest> &request, std::shared_ptr<HttpResponse> &response) override;
+
+    /**
+     * @brief Get the number of the transfers started and not completed yet.
+     * @return The number of the transfers in flight.
+     */
+    size_t InflightCount() const
+    {
+        return inflight_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Transfer {
+        CURL *handle{ nullptr };
+        curl_slist *headers{ nullptr };
+        std::shared_ptr<HttpRequest> request;
+        std::shared_ptr<HttpResponse> response;
+        Callback callback;
+        char errBuf[CURL_ERROR_SIZE] = { 0 };
+        PerfPoint point{ PerfKey::CURL_MULTI_HTTP };
+    };
+
+    /**
+     * @brief CURLMOPT_SOCKETFUNCTION, keeps the epoll set in line with the sockets libcurl waits on.
+     */
+    static int SocketCallback(CURL *easy, curl_socket_t sock, int what, void *userp, void *socketp);
+
+    /**
+     * @brief CURLMOPT_TIMERFUNCTION, keeps the deadline of the next libcurl timeout.
+     */
+    static int TimerCallback(CURLM *multi, long timeoutMs, void *userp);
+
+    /**
+     * @brief The event loop, runs until Shutdown().
+     */
+    void Loop();
+
+    /**
+     * @brief Get the epoll wait time until the next libcurl timeout.
+     * @return The wait time in milliseconds.
+     */
+    int NextWaitMs() const;
+
+    /**
+     * @brief Add the transfers submitted since the last call to the multi handle.
+     */
+    void AddSubmitted();
+
+    /**
+     * @brief Complete the transfers libcurl has finished.
+     */
+    void CompleteFinished();
+
+    /**
+     * @brief Release the resources of a transfer and call its callback.
+     * @param[in] transfer The transfer, removed from the multi handle.
+     * @param[in] res The result of the transfer.
+     */
+    void Complete(std::unique_ptr<Transfer> transfer, CURLcode res);
+
+    /**
+     * @brief Take an idle easy handle or create one.
+     * @return The handle, nullptr if curl_easy_init fails.
+     */
+    CURL *AcquireHandle();
+
+    /**
+     * @brief Give an easy handle back for reuse.
+     * @param[in] handle The handle.
+     * @param[in] cleanUp Whether to drop the handle instead, for the handle of a failed transfer.
+     */
+    void ReleaseHandle(CURL *handle, bool cleanUp);
+
+    const long maxHostConnections_;
+    const long maxTotalConnections_;
+    CURLM *multi_{ nullptr };
+    int epollFd_{ -1 };
+    int wakeFd_{ -1 };
+    std::atomic<bool> stop_{ false };
+    std::unique_ptr<Thread> loopThread_{ nullptr };
+    std::atomic<size_t> inflight_{ 0 };
+
+    // Loop thread only.
+    bool timerSet_{ false };
+    std::chrono::steady_clock::time_point timerDeadline_;
+    std::unordered_map<CURL *, std::unique_ptr<Transfer>> running_;
+
+    std::mutex submitMutex_;  // Protects submitted_.
+    std::deque<std::unique_ptr<Transfer>> submitted_;
+    std::mutex handleMutex_;  // Protects idleHandles_.
+    std::vector<CURL *> idleHandles_;
+};
+}  // namespace datasystem
+
+#endif  // DATASYSTEM_COMMON_HTTPCLIENT_CURL_MULTI_HTTP_CLIENT_H
@@ -214,6 +214,7 @@ std::string MemberServiceInfo::ToProto() const
     info.set_state(statePb);
     info.set_host_id(hostId);
     info.set_compatibility_version(compatibilityVersion);
+    info.set_capacity_mb(capacityMb);
     return info.SerializeAsString();
 }
 
@@ -226,6 +227,7 @@ Status MemberServiceInfo::FromProto(const std::string &str, MemberServiceInfo &v
     RETURN_IF_NOT_OK(ProtoToMemberLifecycleState(info.state(), value.state));
     value.hostId = info.host_id();
     value.compatibilityVersion = info.compatibility_version();
+    value.capacityMb = info.capacity_mb();
     return Status::OK();
 }
 }  // namespace datasystem::cluster
@@ -34,6 +34,7 @@ struct MemberServiceInfo {
     MemberLifecycleState state = MemberLifecycleState::UNKNOWN;
     std::string hostId;
     std::string compatibilityVersion;
+    uint64_t capacityMb = 0;  // Only carried by the proto encoding.
 
     std::string ToString() const;
     static Status FromString(const std::string &str, MemberServiceInfo &value);
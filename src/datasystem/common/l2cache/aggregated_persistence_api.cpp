@@ -66,6 +66,33 @@ Status AggregatedPersistenceApi::Get(const std::string &objectKey, uint64_t vers
     return rc;
 }
 
+Status AggregatedPersistenceApi::GetRange(const std::string &objectKey, uint64_t version, uint64_t offset,
+                                          uint64_t size, int64_t timeoutMs,
+                                          std::shared_ptr<std::stringstream> &content)
+{
+    auto rc = storageClient_->GetRange(objectKey, version, offset, size, timeoutMs, content);
+    if (rc.GetCode() != StatusCode::K_NOT_FOUND && rc.GetCode() != StatusCode::K_NOT_FOUND_IN_L2CACHE) {
+        return rc;
+    }
+    // The exact version is gone, fall back to the latest version like Get does.
+    auto whole = std::make_shared<std::stringstream>();
+    RETURN_IF_NOT_OK(GetWithoutVersion(objectKey, timeoutMs, 0, whole));
+    const std::string data = whole->str();
+    content = std::make_shared<std::stringstream>(offset < data.size() ? data.substr(offset, size) : std::string());
+    return Status::OK();
+}
+
+Status AggregatedPersistenceApi::GetToBuffer(const std::string &objectKey, uint64_t version, uint64_t offset,
+                                             uint64_t size, int64_t timeoutMs, void *dest, uint64_t &objectSize)
+{
+    auto rc = storageClient_->GetToBuffer(objectKey, version, offset, size, timeoutMs, dest, objectSize);
+    if (rc.GetCode() != StatusCode::K_NOT_FOUND && rc.GetCode() != StatusCode::K_NOT_FOUND_IN_L2CACHE) {
+        return rc;
+    }
+    // The exact version is gone, the range of the latest version is copied in.
+    return PersistenceApi::GetToBuffer(objectKey, version, offset, size, timeoutMs, dest, objectSize);
+}
+
 Status AggregatedPersistenceApi::GetWithoutVersion(const std::string &objectKey, int64_t timeoutMs, uint64_t minVersion,
                                                    std::shared_ptr<std::stringstream> &content)
 {
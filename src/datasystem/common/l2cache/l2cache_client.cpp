@@ -23,8 +23,59 @@
 #include <sstream>
 
 #include "datasystem/common/perf/perf_manager.h"
+#include "datasystem/common/util/memory.h"
 
 namespace datasystem {
+Status L2CacheClient::DownloadRange(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                                    std::shared_ptr<std::stringstream> &content)
+{
+    // Backends without ranged reads get the whole object and keep the range.
+    auto whole = std::make_shared<std::stringstream>();
+    RETURN_IF_NOT_OK(Download(objectPath, timeoutMs, whole));
+    const std::string data = whole->str();
+    content = std::make_shared<std::stringstream>(offset < data.size() ? data.substr(offset, size) : std::string());
+    return Status::OK();
+}
+
+Status L2CacheClient::DownloadToBuffer(const std::string &objectPath, int64_t timeoutMs, uint64_t offset,
+                                       uint64_t size, void *dest, uint64_t &objectSize)
+{
+    std::shared_ptr<std::stringstream> content;
+    RETURN_IF_NOT_OK(Download(objectPath, timeoutMs, content));
+    const std::string data = content->str();
+    objectSize = data.size();
+    CHECK_FAIL_RETURN_STATUS(offset <= data.size() && size <= data.size() - offset, K_OUT_OF_RANGE,
+                             FormatString("Range [%lu, %lu) is past the end of object %s", offset, offset + size,
+                                          objectPath));
+    RETURN_OK_IF_TRUE(size == 0);
+    return HugeMemoryCopy(static_cast<uint8_t *>(dest), size, reinterpret_cast<const uint8_t *>(data.data()) + offset,
+                          size);
+}
+
+Status L2CacheClient::UploadAsync(const std::string &objectPath, int64_t timeoutMs,
+                                  const std::shared_ptr<std::iostream> &body, UploadCallback done)
+{
+    done(Upload(objectPath, timeoutMs, body));
+    return Status::OK();
+}
+
+Status L2CacheClient::DownloadAsync(const std::string &objectPath, int64_t timeoutMs, DownloadCallback done)
+{
+    std::shared_ptr<std::stringstream> content;
+    Status rc = Download(objectPath, timeoutMs, content);
+    done(rc, content);
+    return Status::OK();
+}
+
+Status L2CacheClient::DownloadRangeAsync(const std::string &objectPath, int64_t timeoutMs, uint64_t offset,
+                                         uint64_t size, DownloadCallback done)
+{
+    std::shared_ptr<std::stringstream> content;
+    Status rc = DownloadRange(objectPath, timeoutMs, offset, size, content);
+    done(rc, content);
+    return Status::OK();
+}
+
 Status L2CacheClient::SendObsRequest(const std::shared_ptr<HttpClient> httpClient,
                                      const std::shared_ptr<HttpRequest> &request, int64_t timeoutMs,
                                      std::shared_ptr<HttpResponse> &response)
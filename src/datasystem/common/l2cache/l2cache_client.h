@@ -21,6 +21,7 @@
 #ifndef DATASYSTEM_COMMON_L2CACHE_L2CACHE_CLIENT_H
 #define DATASYSTEM_COMMON_L2CACHE_L2CACHE_CLIENT_H
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -34,6 +35,9 @@ class GetObjectInfoListResp;
 const std::string L2CACHE_PERCENT_SIGN_ENCODE = "%EF%BF%A5";
 class L2CacheClient {
 public:
+    using UploadCallback = std::function<void(const Status &rc)>;
+    using DownloadCallback = std::function<void(const Status &rc, const std::shared_ptr<std::stringstream> &content)>;
+
     /**
      * @brief init the L2CacheClient
      * @return Status of the call
@@ -72,6 +76,66 @@ public:
     virtual Status Download(const std::string &objectPath, int64_t timeoutMs,
                             std::shared_ptr<std::stringstream> &content) = 0;
 
+    /**
+     * @brief get the bytes [offset, offset + size) of the object from l2 cache
+     * @param[in] objectPath the object path in l2 cache bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get, fewer are returned if the object ends before
+     * @param[out] content the object content in the range
+     * @return Status of the call
+     */
+    virtual Status DownloadRange(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                                 std::shared_ptr<std::stringstream> &content);
+
+    /**
+     * @brief get the bytes [offset, offset + size) of the object from l2 cache straight into the caller's buffer
+     * @param[in] objectPath the object path in l2 cache bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get
+     * @param[out] dest the buffer of at least size bytes
+     * @param[out] objectSize the size of the whole object, 0 if the backend does not tell
+     * @return K_OUT_OF_RANGE if the object ends before offset + size
+     */
+    virtual Status DownloadToBuffer(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                                    void *dest, uint64_t &objectSize);
+
+    /**
+     * @brief Start Upload() and return without waiting for it. Backends without asynchronous requests upload before
+     * returning and call done on the calling thread. The others call done on a thread of their own, never on their
+     * event loop, so done may block and may call the synchronous methods of the client.
+     * @param[in] objectPath the object path in l2 cache bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] body the object content, kept until done is called
+     * @param[in] done called once with the result of the upload, only if this call succeeds
+     * @return Status of the call
+     */
+    virtual Status UploadAsync(const std::string &objectPath, int64_t timeoutMs,
+                               const std::shared_ptr<std::iostream> &body, UploadCallback done);
+
+    /**
+     * @brief Start Download() and return without waiting for it. done runs on the same threads as for UploadAsync().
+     * @param[in] objectPath the object path in l2 cache bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] done called once with the result and the object content, only if this call succeeds
+     * @return Status of the call
+     */
+    virtual Status DownloadAsync(const std::string &objectPath, int64_t timeoutMs, DownloadCallback done);
+
+    /**
+     * @brief Start DownloadRange() and return without waiting for it. done runs on the same threads as for
+     * UploadAsync().
+     * @param[in] objectPath the object path in l2 cache bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get, fewer are returned if the object ends before
+     * @param[in] done called once with the result and the object content in the range, only if this call succeeds
+     * @return Status of the call
+     */
+    virtual Status DownloadRangeAsync(const std::string &objectPath, int64_t timeoutMs, uint64_t offset,
+                                      uint64_t size, DownloadCallback done);
+
     /**
      * @brief delete the l2 cache object.
      * @param[in] objects the whole path of the object, not support prefix
@@ -115,6 +115,64 @@ Status ObjectPersistenceApi::Get(const std::string &objectKey, uint64_t version,
     return GetWithoutVersion(objectKey, timeoutMs - timer.ElapsedMilliSecond(), 0, content);
 }
 
+Status ObjectPersistenceApi::GetRange(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                                      int64_t timeoutMs, std::shared_ptr<std::stringstream> &content)
+{
+    Timer timer;
+    LOG(INFO) << FormatString("invoke get range [%llu, %llu) of object from persistence. objectKey: %s, version: %llu",
+                              offset, offset + size, objectKey, version);
+
+    std::string encodeKey;
+    RETURN_IF_NOT_OK(PersistenceApi::UrlEncode(objectKey, encodeKey));
+
+    std::string objectPath;
+    objectPath.append(encodeKey).append("/").append(std::to_string(version));
+    Status res = client_->DownloadRange(objectPath, timeoutMs, offset, size, content);
+    if (res.GetCode() != StatusCode::K_NOT_FOUND) {
+        return res;
+    }
+
+    std::vector<L2CacheObjectInfo> objInfoList;
+    uint64_t existMaxVersion = 0;
+    RETURN_IF_NOT_OK(ListAllVersion(encodeKey + "/", timeoutMs - static_cast<int64_t>(timer.ElapsedMilliSecond()),
+                                    objInfoList, existMaxVersion));
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(!objInfoList.empty(), StatusCode::K_NOT_FOUND_IN_L2CACHE,
+                                         "The object is not exist in persistence.");
+    objectPath.clear();
+    objectPath.append(encodeKey).append("/").append(std::to_string(existMaxVersion));
+    return client_->DownloadRange(objectPath, timeoutMs - static_cast<int64_t>(timer.ElapsedMilliSecond()), offset,
+                                  size, content);
+}
+
+Status ObjectPersistenceApi::GetToBuffer(const std::string &objectKey, uint64_t version, uint64_t offset,
+                                         uint64_t size, int64_t timeoutMs, void *dest, uint64_t &objectSize)
+{
+    Timer timer;
+    LOG(INFO) << FormatString("invoke get [%llu, %llu) of object to buffer from persistence. objectKey: %s, "
+                              "version: %llu", offset, offset + size, objectKey, version);
+
+    std::string encodeKey;
+    RETURN_IF_NOT_OK(PersistenceApi::UrlEncode(objectKey, encodeKey));
+
+    std::string objectPath;
+    objectPath.append(encodeKey).append("/").append(std::to_string(version));
+    Status res = client_->DownloadToBuffer(objectPath, timeoutMs, offset, size, dest, objectSize);
+    if (res.GetCode() != StatusCode::K_NOT_FOUND) {
+        return res;
+    }
+
+    std::vector<L2CacheObjectInfo> objInfoList;
+    uint64_t existMaxVersion = 0;
+    RETURN_IF_NOT_OK(ListAllVersion(encodeKey + "/", timeoutMs - static_cast<int64_t>(timer.ElapsedMilliSecond()),
+                                    objInfoList, existMaxVersion));
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(!objInfoList.empty(), StatusCode::K_NOT_FOUND_IN_L2CACHE,
+                                         "The object is not exist in persistence.");
+    objectPath.clear();
+    objectPath.append(encodeKey).append("/").append(std::to_string(existMaxVersion));
+    return client_->DownloadToBuffer(objectPath, timeoutMs - static_cast<int64_t>(timer.ElapsedMilliSecond()),
+                                     offset, size, dest, objectSize);
+}
+
 Status ObjectPersistenceApi::GetWithoutVersion(const std::string &objectKey, int64_t timeoutMs, uint64_t minVersion,
                                                std::shared_ptr<std::stringstream> &content)
 {
@@ -40,6 +40,10 @@ public:
                 WriteMode writeMode = WriteMode::NONE_L2_CACHE, uint32_t ttlSecond = 0) override;
     Status Get(const std::string &objectKey, uint64_t version, int64_t timeoutMs,
                std::shared_ptr<std::stringstream> &content) override;
+    Status GetRange(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                    int64_t timeoutMs, std::shared_ptr<std::stringstream> &content) override;
+    Status GetToBuffer(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                       int64_t timeoutMs, void *dest, uint64_t &objectSize) override;
     Status GetWithoutVersion(const std::string &objectKey, int64_t timeoutMs, uint64_t minVersion,
                              std::shared_ptr<std::stringstream> &content) override;
     Status Del(const std::string &objectKey, uint64_t maxVerToDelete, bool deleteAllVersion, uint64_t asyncElapse = 0,
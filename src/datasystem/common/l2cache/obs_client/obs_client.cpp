@@ -20,10 +20,16 @@
 
 #include "datasystem/common/l2cache/obs_client/obs_client.h"
 
+#include <strings.h>
+
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <fstream>
+#include <future>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 #include <securec.h>
@@ -43,6 +49,7 @@
 #include "datasystem/common/util/raii.h"
 #include "datasystem/common/util/timer.h"
 #include "datasystem/common/util/validator.h"
+#include "datasystem/common/util/wait_post.h"
 #include "datasystem/utils/status.h"
 
 DS_DEFINE_string(obs_access_key, "", "The access key for obs AK/SK authentication.");
@@ -54,6 +61,17 @@ DS_DEFINE_bool(enable_cloud_service_token_rotation, false,
                "token and connect to OBS again.");
 DS_DEFINE_bool(obs_https_enabled, false,
                "Whether to enable the https in obs. false: use HTTP (default), true: use HTTPS");
+DS_DEFINE_int32(obs_max_host_connections, 256,
+                "Max keep-alive connections of the obs client to one host, the requests above wait in the client.");
+DS_DEFINE_validator(obs_max_host_connections, [](const char *flagName, int32_t value) {
+    (void)flagName;
+    return value > 0;
+});
+DS_DEFINE_int32(obs_max_total_connections, 1024, "Max connections of the obs client in total.");
+DS_DEFINE_validator(obs_max_total_connections, [](const char *flagName, int32_t value) {
+    (void)flagName;
+    return value > 0;
+});
 DS_DECLARE_string(encrypt_kit);
 
 const std::string CSMS_TOKEN_PATH = "/var/run/secrets/tokens/csms-token";
@@ -63,9 +81,131 @@ const size_t MIN_OBS_TOKEN_TIMEOUT_SEC = 900;    // 15 minutes.
 const size_t ROTATION_DEFAULT_INTERVAL = 43200;  // 12 hours.
 const size_t CONFIG_VALID_STRING_LEN = 128;
 const int64_t OBS_DEFAULT_TIMEOUT_MS = 30000;    // 30 seconds default timeout for OBS requests.
+const uint64_t DOWNLOAD_PART_SIZE = 8 * 1024 * 1024;  // 8MB, ranges larger than this are downloaded in parts.
+const size_t MULTIPART_UPLOAD_THRESHOLD = 100 * 1024 * 1024;  // 100MB, objects larger than this are uploaded in parts.
+const int HTTP_STATUS_PARTIAL_CONTENT = 206;
+const int HTTP_STATUS_RANGE_NOT_SATISFIABLE = 416;
 
 namespace datasystem {
 namespace {
+// The total size in a "Content-Range: bytes first-last/total" response header, 0 if missing or unknown.
+uint64_t ParseContentRangeTotal(const std::map<std::string, std::string> &headers)
+{
+    for (const auto &header : headers) {
+        if (strcasecmp(header.first.c_str(), "Content-Range") != 0) {
+            continue;
+        }
+        auto pos = header.second.rfind('/');
+        if (pos == std::string::npos) {
+            return 0;
+        }
+        const char *begin = header.second.c_str() + pos + 1;
+        char *end = nullptr;
+        uint64_t total = std::strtoull(begin, &end, 10);
+        return end != begin && *end == '\0' ? total : 0;
+    }
+    return 0;
+}
+
+// Response body of a Range request written straight into a caller's buffer. The status line is known before the
+// first body byte: a 206 carries the range itself, a 200 the whole object that the range is cut out of, and any other
+// reply is an error body that is kept aside so that it never lands in the buffer.
+class RangeBodyStream : public std::iostream {
+public:
+    RangeBodyStream(const HttpResponse *response, uint8_t *dest, uint64_t offset, uint64_t size, uint64_t destSize)
+        : std::iostream(&buf_), buf_(response, dest, offset, size, destSize)
+    {
+    }
+
+    uint64_t Received() const
+    {
+        return buf_.received;
+    }
+
+    uint64_t Copied() const
+    {
+        return buf_.copied;
+    }
+
+    const std::string &ErrorBody() const
+    {
+        return buf_.errorBody;
+    }
+
+private:
+    struct Buf : public std::streambuf {
+        Buf(const HttpResponse *response, uint8_t *dest, uint64_t offset, uint64_t size, uint64_t destSize)
+            : response(response), dest(dest), offset(offset), size(size), destSize(destSize)
+        {
+        }
+
+        std::streamsize xsputn(const char *s, std::streamsize n) override
+        {
+            Consume(s, static_cast<uint64_t>(n));
+            return n;
+        }
+
+        int_type overflow(int_type c) override
+        {
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                char ch = traits_type::to_char_type(c);
+                Consume(&ch, 1);
+            }
+            return traits_type::not_eof(c);
+        }
+
+        void Consume(const char *s, uint64_t n)
+        {
+            const int status = response->GetStatus();
+            uint64_t first = received;
+            received += n;
+            if (status == HTTP_STATUS_PARTIAL_CONTENT) {
+                Copy(s, n, first, size);
+            } else if (status == HttpResponse::HTTP_STATUS_CODE_OK) {
+                // The server ignored the range, skip the bytes in front of it.
+                if (received > offset) {
+                    uint64_t skip = first < offset ? offset - first : 0;
+                    Copy(s + skip, n - skip, first + skip - offset, destSize);
+                }
+            } else if (errorBody.size() < ERROR_BODY_LIMIT) {
+                errorBody.append(s, std::min<uint64_t>(n, ERROR_BODY_LIMIT - errorBody.size()));
+            }
+        }
+
+        void Copy(const char *s, uint64_t n, uint64_t pos, uint64_t limit)
+        {
+            if (pos >= limit) {
+                return;
+            }
+            uint64_t count = std::min(n, limit - pos);
+            std::copy(s, s + count, reinterpret_cast<char *>(dest) + pos);
+            copied += count;
+        }
+
+        static constexpr uint64_t ERROR_BODY_LIMIT = 64 * 1024;
+        const HttpResponse *response;
+        uint8_t *dest;
+        uint64_t offset;
+        uint64_t size;
+        uint64_t destSize;
+        uint64_t received = 0;
+        uint64_t copied = 0;
+        std::string errorBody;
+    };
+    Buf buf_;
+};
+
+std::string BuildObsErrorSummary(const std::string &text)
+{
+    std::string errCode;
+    std::string errMsg;
+    ObsXmlUtil::ParseErrorResponse(text, errCode, errMsg);
+    if (errCode.empty()) {
+        errCode = "UNKNOW";
+    }
+    return FormatString("errorCode=%s, errorMessage=%s", errCode, errMsg);
+}
+
 std::string BuildObsErrorResponseSummary(const std::shared_ptr<HttpResponse> &response)
 {
     if (response == nullptr) {
@@ -79,14 +219,26 @@ std::string BuildObsErrorResponseSummary(const std::shared_ptr<HttpResponse> &re
     if (stream == nullptr) {
         return "";
     }
-    std::string text = stream->str();
-    std::string errCode;
-    std::string errMsg;
-    ObsXmlUtil::ParseErrorResponse(text, errCode, errMsg);
-    if (errCode.empty()) {
-        errCode = "UNKNOW";
+    return BuildObsErrorSummary(stream->str());
+}
+
+// Append len bytes of from, starting at skip, to the end of to. Fewer if from ends before.
+void AppendStreamRange(std::stringstream &from, uint64_t skip, uint64_t len, std::stringstream &to)
+{
+    const size_t chunkSize = 64 * 1024;
+    char chunk[chunkSize];
+    auto *buf = from.rdbuf();
+    if (buf->pubseekpos(static_cast<std::streamoff>(skip), std::ios_base::in) != std::streampos(skip)) {
+        return;
+    }
+    while (len > 0) {
+        auto n = buf->sgetn(chunk, static_cast<std::streamsize>(std::min<uint64_t>(len, chunkSize)));
+        if (n <= 0) {
+            return;
+        }
+        to.write(chunk, n);
+        len -= static_cast<uint64_t>(n);
     }
-    return FormatString("errorCode=%s, errorMessage=%s", errCode, errMsg);
 }
 }  // namespace
 
@@ -157,6 +309,12 @@ inline Status VerifyJsonConfig(const nlohmann::json &jsonConfig, CCMSTokenConf &
 
 ObsClient::~ObsClient()
 {
+    // The callbacks in flight use the client, fail them before the members go.
+    if (asyncHttpClient_ != nullptr) {
+        asyncHttpClient_->Shutdown();
+    }
+    // Run the callbacks queued by the failed transfers.
+    callbackPool_.reset();
     if (isTokenRotationStarting_.load()) {
         isTokenRotationStarting_.store(false);
         rotationCv_.notify_all();
@@ -171,7 +329,12 @@ Status ObsClient::Init()
     if (initialized_.load()) {
         return Status::OK();
     }
+    // The synchronous requests keep their own blocking client, so that they never wait on the event loop.
     httpClient_ = std::make_shared<CurlHttpClient>(false);
+    asyncHttpClient_ = std::make_shared<CurlMultiHttpClient>(false, FLAGS_obs_max_host_connections,
+                                                             FLAGS_obs_max_total_connections);
+    RETURN_IF_NOT_OK(asyncHttpClient_->Init());
+    callbackPool_ = std::make_unique<ThreadPool>(1, NUM_THREAD, "ObsCallback");
     Status status;
     if (FLAGS_enable_cloud_service_token_rotation) {
         status = ObsClientInitByToken();
@@ -342,11 +505,10 @@ Status ObsClient::UpdateTempObsToken()
 Status ObsClient::Upload(const std::string &objectPath, int64_t timeoutMs, const std::shared_ptr<std::iostream> &body,
                          uint64_t asyncElapse)
 {
-    (void)asyncElapse;                                                 // not used in ObsClient
-    static const size_t multipartUploadThreshold = 100 * 1024 * 1024;  // 100MB
+    (void)asyncElapse;  // not used in ObsClient
     size_t sz = static_cast<size_t>(GetSize(body.get()));
     Timer timer(timeoutMs);
-    if (sz <= multipartUploadThreshold) {
+    if (sz <= MULTIPART_UPLOAD_THRESHOLD) {
         RETURN_IF_NOT_OK(StreamingUpload(body, sz, objectPath, timer));
     } else {
         static const size_t partitionSize = 10 * 1024 * 1024;  // 10MB
@@ -359,7 +521,176 @@ Status ObsClient::Download(const std::string &objectPath, int64_t timeoutMs,
                            std::shared_ptr<std::stringstream> &content)
 {
     Timer timer(timeoutMs);
-    return GetObject(objectPath, content, timer);
+    // The first part tells the object size, the rest of a large object is then downloaded in parallel.
+    std::string head;
+    uint64_t objectSize = 0;
+    bool wholeObject = false;
+    Status rc = GetObjectRange(objectPath, 0, DOWNLOAD_PART_SIZE, timer, head, objectSize, wholeObject);
+    if (rc.GetCode() == K_OUT_OF_RANGE) {
+        // An empty object has no satisfiable range.
+        return GetObject(objectPath, content, timer);
+    }
+    RETURN_IF_NOT_OK(rc);
+    if (!wholeObject && objectSize == 0 && head.size() >= DOWNLOAD_PART_SIZE) {
+        // The first part is full but the server did not tell the total size, so the rest can not be split into parts.
+        LOG(WARNING) << FormatString("No object size in the range response of %s, download it with one request.",
+                                     objectPath);
+        return GetObject(objectPath, content, timer);
+    }
+    const uint64_t headSize = head.size();
+    content = std::make_shared<std::stringstream>(std::move(head));
+    if (!wholeObject && objectSize > headSize) {
+        content->seekp(0, std::ios_base::end);
+        Status partsRc = GetObjectParts(objectPath, headSize, objectSize - headSize, objectSize, timer, content);
+        if (partsRc.IsError()) {
+            content = nullptr;
+            return partsRc;
+        }
+    }
+    return Status::OK();
+}
+
+Status ObsClient::DownloadRange(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                                std::shared_ptr<std::stringstream> &content)
+{
+    Timer timer(timeoutMs);
+    content = std::make_shared<std::stringstream>();
+    Status rc = GetObjectParts(objectPath, offset, size, 0, timer, content);
+    if (rc.GetCode() == K_OUT_OF_RANGE) {
+        content = std::make_shared<std::stringstream>();
+        return Status::OK();
+    }
+    if (rc.IsError()) {
+        content = nullptr;
+    }
+    return rc;
+}
+
+Status ObsClient::DownloadToBuffer(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                                   void *dest, uint64_t &objectSize)
+{
+    objectSize = 0;
+    RETURN_OK_IF_TRUE(size == 0);
+    Timer timer(timeoutMs);
+    auto *buffer = static_cast<uint8_t *>(dest);
+    // The first part tells whether the server honors ranges, a whole object reply fills the buffer at once.
+    bool wholeObject = false;
+    RETURN_IF_NOT_OK(GetObjectRangeToBuffer(objectPath, offset, std::min(DOWNLOAD_PART_SIZE, size), size, timer,
+                                            buffer, objectSize, wholeObject));
+    const uint64_t partNum = (size + DOWNLOAD_PART_SIZE - 1) / DOWNLOAD_PART_SIZE;
+    RETURN_OK_IF_TRUE(wholeObject || partNum <= 1);
+    std::vector<uint64_t> partObjectSizes(partNum - 1, 0);
+    auto job = [this, &objectPath, &timer, &partObjectSizes, offset, size, buffer](uint64_t i) {
+        uint64_t partOffset = (i + 1) * DOWNLOAD_PART_SIZE;
+        uint64_t partSize = std::min(DOWNLOAD_PART_SIZE, size - partOffset);
+        bool partWholeObject = false;
+        return GetObjectRangeToBuffer(objectPath, offset + partOffset, partSize, partSize, timer, buffer + partOffset,
+                                      partObjectSizes[i], partWholeObject);
+    };
+    RETURN_IF_NOT_OK(RunDownloadParts(partNum - 1, job));
+    for (auto partObjectSize : partObjectSizes) {
+        CHECK_FAIL_RETURN_STATUS(partObjectSize == objectSize, K_RUNTIME_ERROR,
+                                 FormatString("Object %s changed from %lu to %lu bytes during the download",
+                                              objectPath, objectSize, partObjectSize));
+    }
+    return Status::OK();
+}
+
+Status ObsClient::UploadAsync(const std::string &objectPath, int64_t timeoutMs,
+                              const std::shared_ptr<std::iostream> &body, UploadCallback done)
+{
+    size_t sz = static_cast<size_t>(GetSize(body.get()));
+    if (sz > MULTIPART_UPLOAD_THRESHOLD) {
+        // The multipart upload waits for each of its steps, so it takes a pool thread rather than the event loop.
+        callbackPool_->Execute([this, objectPath, timeoutMs, body, done]() { done(Upload(objectPath, timeoutMs, body)); });
+        return Status::OK();
+    }
+    CHECK_FAIL_RETURN_STATUS(timeoutMs > 0, K_RPC_DEADLINE_EXCEEDED,
+                             "The request process timeout before send request to l2cache.");
+    ObsCredential credential = credentialManager_.GetCredential();
+    auto request = BuildRequest(HttpMethod::PUT, objectPath, timeoutMs);
+    request->AddHeader("Content-Type", "application/octet-stream");
+    request->SetBody(body);
+    RETURN_IF_NOT_OK(SignRequest(credential, request, "", {}));
+
+    auto response = std::make_shared<HttpResponse>();
+    response->SetBody(std::make_shared<std::stringstream>());
+    return asyncHttpClient_->SendAsync(
+        request, response,
+        [this, objectPath, sz, done = std::move(done)](const Status &rc, const std::shared_ptr<HttpResponse> &rsp) {
+            Status putRc = rc;
+            if (putRc.IsOk()) {
+                int httpStatus = rsp->GetStatus();
+                successRateVec_.BlockingEmplaceBackCode(httpStatus);
+                if (httpStatus < 200 || httpStatus >= 300) {
+                    LOG(ERROR) << FormatString("OBS PUT request failed. objectPath=%s, httpStatus=%d, %s", objectPath,
+                                               httpStatus, BuildObsErrorResponseSummary(rsp));
+                    putRc = Status(K_RUNTIME_ERROR,
+                                   FormatString("Failed to put object: %s, buffer size: %zu, http status: %d",
+                                                objectPath, sz, httpStatus));
+                }
+            }
+            RunCallback([done, putRc]() { done(putRc); });
+        });
+}
+
+Status ObsClient::DownloadAsync(const std::string &objectPath, int64_t timeoutMs, DownloadCallback done)
+{
+    Timer timer(timeoutMs);
+    // The first part tells the object size, the rest of a large object is then downloaded in parallel.
+    auto onHead = [this, objectPath, timer, done](const Status &rc, const std::shared_ptr<std::stringstream> &head,
+                                                  uint64_t objectSize, bool wholeObject) mutable {
+        if (rc.GetCode() == K_OUT_OF_RANGE) {
+            // An empty object has no satisfiable range.
+            RunCallback([done]() { done(Status::OK(), std::make_shared<std::stringstream>()); });
+            return;
+        }
+        if (rc.IsError()) {
+            RunCallback([done, rc]() { done(rc, nullptr); });
+            return;
+        }
+        const uint64_t headSize = static_cast<uint64_t>(GetSize(head.get()));
+        if (!wholeObject && objectSize == 0 && headSize >= DOWNLOAD_PART_SIZE) {
+            // The first part is full but the server did not tell the total size, so the rest can not be split into
+            // parts. The plain GET blocks, so it takes a callback pool thread rather than the event loop.
+            LOG(WARNING) << FormatString("No object size in the range response of %s, download it with one request.",
+                                         objectPath);
+            RunCallback([this, objectPath, timer, done]() mutable {
+                std::shared_ptr<std::stringstream> content;
+                Status getRc = GetObject(objectPath, content, timer);
+                done(getRc, getRc.IsOk() ? content : nullptr);
+            });
+            return;
+        }
+        if (wholeObject || objectSize <= headSize) {
+            RunCallback([done, head]() { done(Status::OK(), head); });
+            return;
+        }
+        head->seekp(0, std::ios_base::end);
+        auto onParts = [this, head, done](const Status &partsRc) {
+            RunCallback([done, head, partsRc]() { done(partsRc, partsRc.IsOk() ? head : nullptr); });
+        };
+        Status partsRc = GetObjectPartsAsync(objectPath, headSize, objectSize - headSize, objectSize,
+                                             timer.GetRemainingTimeMs(), head, std::move(onParts));
+        if (partsRc.IsError()) {
+            RunCallback([done, partsRc]() { done(partsRc, nullptr); });
+        }
+    };
+    return GetObjectRangeAsync(objectPath, 0, DOWNLOAD_PART_SIZE, timeoutMs, std::move(onHead));
+}
+
+Status ObsClient::DownloadRangeAsync(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                                     DownloadCallback done)
+{
+    auto content = std::make_shared<std::stringstream>();
+    return GetObjectPartsAsync(
+        objectPath, offset, size, 0, timeoutMs, content, [this, content, done = std::move(done)](const Status &rc) {
+            if (rc.GetCode() == K_OUT_OF_RANGE) {
+                RunCallback([done]() { done(Status::OK(), std::make_shared<std::stringstream>()); });
+                return;
+            }
+            RunCallback([done, content, rc]() { done(rc, rc.IsOk() ? content : nullptr); });
+        });
 }
 
 Status ObsClient::Delete(const std::vector<std::string> &objectPaths, uint64_t asyncElapse)
@@ -757,6 +1088,259 @@ Status ObsClient::GetObject(const std::string &objPath, std::shared_ptr<std::str
     return Status::OK();
 }
 
+Status ObsClient::GetObjectRange(const std::string &objPath, uint64_t offset, uint64_t size, Timer &timer,
+                                 std::string &data, uint64_t &objectSize, bool &wholeObject)
+{
+    CHECK_FAIL_RETURN_STATUS(size > 0, K_INVALID, "The range to get is empty");
+    VLOG(1) << FormatString("GetObjectRange starts. Object path: %s, range: [%lu, %lu)", objPath, offset,
+                            offset + size);
+    ObsCredential credential = credentialManager_.GetCredential();
+    int64_t remaining = timer.GetRemainingTimeMs();
+    auto request = BuildRequest(HttpMethod::GET, objPath, remaining);
+    request->AddHeader("Content-Type", "application/octet-stream");
+    request->AddHeader("Range", FormatString("bytes=%lu-%lu", offset, offset + size - 1));
+
+    RETURN_IF_NOT_OK(SignRequest(credential, request, "", {}));
+
+    std::shared_ptr<HttpResponse> response;
+    RETURN_IF_NOT_OK(SendObsRequest(httpClient_, request, remaining, response));
+    int httpStatus = response->GetStatus();
+    successRateVec_.BlockingEmplaceBackCode(httpStatus);
+    RETURN_IF_NOT_OK(CheckGetStatus(objPath, offset, httpStatus));
+    std::stringstream body;
+    auto &respBody = response->GetBody();
+    if (respBody != nullptr) {
+        body << respBody->rdbuf();
+    }
+    data = body.str();
+    // The server may ignore the range and send the whole object, which the caller then has no need to fetch again.
+    wholeObject = httpStatus != HTTP_STATUS_PARTIAL_CONTENT;
+    objectSize = wholeObject ? data.size() : ParseContentRangeTotal(response->Headers());
+    return Status::OK();
+}
+
+Status ObsClient::CheckGetStatus(const std::string &objPath, uint64_t offset, int httpStatus)
+{
+    if (httpStatus == 404) {
+        RETURN_STATUS_LOG_ERROR(K_NOT_FOUND, FormatString("Failed to get object: %s, http status: %d", objPath,
+                                                           httpStatus));
+    }
+    if (httpStatus == HTTP_STATUS_RANGE_NOT_SATISFIABLE) {
+        RETURN_STATUS(K_OUT_OF_RANGE, FormatString("Offset %lu is past the end of object %s", offset, objPath));
+    }
+    if (httpStatus < 200 || httpStatus >= 300) {
+        RETURN_STATUS_LOG_ERROR(K_RUNTIME_ERROR, FormatString("Failed to get object: %s, http status: %d", objPath,
+                                                               httpStatus));
+    }
+    return Status::OK();
+}
+
+Status ObsClient::GetObjectRangeAsync(const std::string &objPath, uint64_t offset, uint64_t size, int64_t timeoutMs,
+                                      RangeCallback done)
+{
+    CHECK_FAIL_RETURN_STATUS(size > 0, K_INVALID, "The range to get is empty");
+    CHECK_FAIL_RETURN_STATUS(timeoutMs > 0, K_RPC_DEADLINE_EXCEEDED,
+                             "The request process timeout before send request to l2cache.");
+    ObsCredential credential = credentialManager_.GetCredential();
+    auto request = BuildRequest(HttpMethod::GET, objPath, timeoutMs);
+    request->AddHeader("Content-Type", "application/octet-stream");
+    request->AddHeader("Range", FormatString("bytes=%lu-%lu", offset, offset + size - 1));
+    RETURN_IF_NOT_OK(SignRequest(credential, request, "", {}));
+
+    auto body = std::make_shared<std::stringstream>();
+    auto response = std::make_shared<HttpResponse>();
+    response->SetBody(body);
+    return asyncHttpClient_->SendAsync(
+        request, response,
+        [this, objPath, offset, body, done = std::move(done)](const Status &rc,
+                                                              const std::shared_ptr<HttpResponse> &rsp) {
+            if (rc.IsError()) {
+                done(rc, nullptr, 0, false);
+                return;
+            }
+            int httpStatus = rsp->GetStatus();
+            successRateVec_.BlockingEmplaceBackCode(httpStatus);
+            Status getRc = CheckGetStatus(objPath, offset, httpStatus);
+            if (getRc.IsError()) {
+                done(Status(getRc.GetCode(), FormatString("%s, %s", getRc.GetMsg(), BuildObsErrorSummary(body->str()))),
+                     nullptr, 0, false);
+                return;
+            }
+            // The server may ignore the range and send the whole object, which the caller then has no need to fetch
+            // again.
+            bool wholeObject = httpStatus != HTTP_STATUS_PARTIAL_CONTENT;
+            uint64_t objectSize = wholeObject ? static_cast<uint64_t>(GetSize(body.get()))
+                                              : ParseContentRangeTotal(rsp->Headers());
+            done(Status::OK(), body, objectSize, wholeObject);
+        });
+}
+
+Status ObsClient::GetObjectPartsAsync(const std::string &objPath, uint64_t offset, uint64_t size, uint64_t objectSize,
+                                      int64_t timeoutMs, const std::shared_ptr<std::stringstream> &content,
+                                      PartsCallback done)
+{
+    // A part that arrived before the parts in front of it, waiting to be appended.
+    struct Piece {
+        std::shared_ptr<std::stringstream> body;
+        uint64_t skip{ 0 };
+        uint64_t len{ 0 };
+    };
+    struct PartsState {
+        std::mutex mutex;
+        uint64_t left{ 0 };
+        uint64_t next{ 0 };  // The first part not appended yet.
+        uint64_t objectSize{ 0 };
+        bool ended{ false };  // A part was short, the object ends there.
+        Status lastRc;
+        std::vector<Piece> pieces;
+        std::vector<bool> arrived;
+        std::shared_ptr<std::stringstream> content;
+        PartsCallback done;
+    };
+    const uint64_t partNum = (size + DOWNLOAD_PART_SIZE - 1) / DOWNLOAD_PART_SIZE;
+    if (partNum == 0) {
+        done(Status::OK());
+        return Status::OK();
+    }
+    auto state = std::make_shared<PartsState>();
+    state->left = partNum;
+    state->objectSize = objectSize;
+    state->pieces.resize(partNum);
+    state->arrived.assign(partNum, false);
+    state->content = content;
+    state->done = std::move(done);
+    auto finishPart = [state, objPath](uint64_t i, const Status &rc, Piece piece, uint64_t partObjectSize) {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        // Only the first part may start past the end of the object, the others are empty then.
+        if (rc.IsError() && (rc.GetCode() != K_OUT_OF_RANGE || i == 0)) {
+            state->lastRc = rc;
+        } else if (rc.IsOk() && partObjectSize != 0) {
+            if (state->objectSize == 0) {
+                state->objectSize = partObjectSize;
+            } else if (partObjectSize != state->objectSize) {
+                state->lastRc = Status(K_RUNTIME_ERROR,
+                                       FormatString("Object %s changed from %lu to %lu bytes during the download",
+                                                    objPath, state->objectSize, partObjectSize));
+            }
+        }
+        state->pieces[i] = std::move(piece);
+        state->arrived[i] = true;
+        // Append the parts that are now in order and drop them, so that the range is held only once.
+        while (state->next < state->pieces.size() && state->arrived[state->next]) {
+            auto &next = state->pieces[state->next];
+            if (state->lastRc.IsOk() && !state->ended && next.body != nullptr) {
+                auto before = state->content->tellp();
+                AppendStreamRange(*next.body, next.skip, next.len, *state->content);
+                // A part shorter than asked means the object ends there, the parts behind it are empty.
+                state->ended = static_cast<uint64_t>(state->content->tellp() - before) < next.len;
+            }
+            next = Piece();
+            ++state->next;
+        }
+        if (--state->left > 0) {
+            return;
+        }
+        lock.unlock();
+        state->done(state->lastRc);
+    };
+    if (partNum > 1) {
+        LOG(INFO) << FormatString("Download %lu bytes of object %s in %lu parts.", size, objPath, partNum);
+    }
+    for (uint64_t i = 0; i < partNum; ++i) {
+        uint64_t partOffset = i * DOWNLOAD_PART_SIZE;
+        uint64_t partSize = std::min(DOWNLOAD_PART_SIZE, size - partOffset);
+        auto onPart = [finishPart, i, partSize, rangeOffset = offset + partOffset](
+                          const Status &partRc, const std::shared_ptr<std::stringstream> &body, uint64_t partObjectSize,
+                          bool wholeObject) {
+            // A whole object reply carries the part somewhere inside it.
+            Piece piece{ body, wholeObject ? rangeOffset : 0, partSize };
+            finishPart(i, partRc, partRc.IsOk() ? std::move(piece) : Piece(), partObjectSize);
+        };
+        Status rc = GetObjectRangeAsync(objPath, offset + partOffset, partSize, timeoutMs, std::move(onPart));
+        if (rc.IsError()) {
+            finishPart(i, rc, Piece(), 0);
+        }
+    }
+    return Status::OK();
+}
+
+Status ObsClient::GetObjectParts(const std::string &objPath, uint64_t offset, uint64_t size, uint64_t objectSize,
+                                 Timer &timer, const std::shared_ptr<std::stringstream> &content)
+{
+    // All the parts are in flight at once on the event loop, whatever the size of the thread pool.
+    WaitPost finished;
+    Status rc;
+    RETURN_IF_NOT_OK(GetObjectPartsAsync(objPath, offset, size, objectSize, timer.GetRemainingTimeMs(), content,
+                                         [&finished, &rc](const Status &partsRc) {
+                                             rc = partsRc;
+                                             finished.Set();
+                                         }));
+    finished.Wait();
+    return rc;
+}
+
+void ObsClient::RunCallback(std::function<void()> callback)
+{
+    callbackPool_->Execute(std::move(callback));
+}
+
+Status ObsClient::GetObjectRangeToBuffer(const std::string &objPath, uint64_t offset, uint64_t size,
+                                         uint64_t destSize, Timer &timer, uint8_t *dest, uint64_t &objectSize,
+                                         bool &wholeObject)
+{
+    VLOG(1) << FormatString("GetObjectRangeToBuffer starts. Object path: %s, range: [%lu, %lu)", objPath, offset,
+                            offset + size);
+    ObsCredential credential = credentialManager_.GetCredential();
+    int64_t remaining = timer.GetRemainingTimeMs();
+    auto request = BuildRequest(HttpMethod::GET, objPath, remaining);
+    request->AddHeader("Content-Type", "application/octet-stream");
+    request->AddHeader("Range", FormatString("bytes=%lu-%lu", offset, offset + size - 1));
+
+    RETURN_IF_NOT_OK(SignRequest(credential, request, "", {}));
+
+    auto response = std::make_shared<HttpResponse>();
+    auto body = std::make_shared<RangeBodyStream>(response.get(), dest, offset, size, destSize);
+    response->SetBody(body);
+    RETURN_IF_NOT_OK(SendObsRequest(httpClient_, request, remaining, response));
+    int httpStatus = response->GetStatus();
+    successRateVec_.BlockingEmplaceBackCode(httpStatus);
+    if (httpStatus != HTTP_STATUS_PARTIAL_CONTENT && httpStatus != HttpResponse::HTTP_STATUS_CODE_OK) {
+        // The error body was kept out of the buffer, it only explains the failure.
+        Status rc = CheckGetStatus(objPath, offset, httpStatus);
+        if (rc.IsOk()) {
+            rc = Status(K_RUNTIME_ERROR, FormatString("Failed to get object: %s, http status: %d", objPath, httpStatus));
+        }
+        return Status(rc.GetCode(), FormatString("%s, %s", rc.GetMsg(), BuildObsErrorSummary(body->ErrorBody())));
+    }
+    // A server that ignores the range sends the whole object, which fills the rest of the buffer as well.
+    wholeObject = httpStatus == HttpResponse::HTTP_STATUS_CODE_OK;
+    objectSize = wholeObject ? body->Received() : ParseContentRangeTotal(response->Headers());
+    CHECK_FAIL_RETURN_STATUS(body->Copied() >= (wholeObject ? destSize : size), K_OUT_OF_RANGE,
+                             FormatString("Range [%lu, %lu) is past the end of object %s", offset, offset + size,
+                                          objPath));
+    return Status::OK();
+}
+
+Status ObsClient::RunDownloadParts(uint64_t partNum, const std::function<Status(uint64_t)> &job)
+{
+    if (partNum <= 1) {
+        return partNum == 0 ? Status::OK() : job(0);
+    }
+    std::vector<std::future<Status>> results;
+    results.reserve(partNum);
+    for (uint64_t i = 0; i < partNum; ++i) {
+        results.emplace_back(threadPool_->Submit(job, i));
+    }
+    Status lastRc;
+    for (auto &result : results) {
+        Status rc = result.get();
+        if (rc.IsError()) {
+            lastRc = rc;
+        }
+    }
+    return lastRc;
+}
+
 Status ObsClient::SendListObjectsRequest(const std::string &objectPrefix, const std::string &marker,
                                          uint16_t maxKeys, int64_t timeoutMs, const ObsCredential &credential,
                                          std::string &respBody)
@@ -23,11 +23,13 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 
 #include "datasystem/common/ak_sk/ak_sk_manager.h"
+#include "datasystem/common/httpclient/curl_multi_http_client.h"
 #include "datasystem/common/httpclient/http_client.h"
 #include "datasystem/common/httpclient/http_request.h"
 #include "datasystem/common/httpclient/http_response.h"
@@ -170,6 +172,67 @@ public:
     Status Download(const std::string &objectPath, int64_t timeoutMs,
                     std::shared_ptr<std::stringstream> &content) override;
 
+    /**
+     * @brief get the bytes [offset, offset + size) of the object with HTTP Range requests, large ranges are split
+     * into parts downloaded concurrently.
+     * @param[in] objectPath the object path in obs bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get, fewer are returned if the object ends before
+     * @param[out] content the object content in the range
+     * @return Status of the call
+     */
+    Status DownloadRange(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                         std::shared_ptr<std::stringstream> &content) override;
+
+    /**
+     * @brief get the bytes [offset, offset + size) of the object with HTTP Range requests, the response bodies are
+     * written by curl straight into the caller's buffer and large ranges are split into parts downloaded concurrently.
+     * @param[in] objectPath the object path in obs bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get
+     * @param[out] dest the buffer of at least size bytes
+     * @param[out] objectSize the size of the whole object, 0 if the server does not tell
+     * @return K_OUT_OF_RANGE if the object ends before offset + size
+     */
+    Status DownloadToBuffer(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                            void *dest, uint64_t &objectSize) override;
+
+    /**
+     * @brief Start the PUT of the object on the event loop and return, an object above the multipart threshold is
+     * uploaded on the thread pool instead.
+     * @param[in] objectPath the object path in obs bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] body the object content
+     * @param[in] done called once with the result of the upload, on a callback pool thread
+     * @return Status of the call
+     */
+    Status UploadAsync(const std::string &objectPath, int64_t timeoutMs, const std::shared_ptr<std::iostream> &body,
+                       UploadCallback done) override;
+
+    /**
+     * @brief Start the Range GETs of the object on the event loop and return. The parts are appended to the content
+     * in order as they arrive, so the object is held once.
+     * @param[in] objectPath the object path in obs bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] done called once with the result and the object content, on a callback pool thread
+     * @return Status of the call
+     */
+    Status DownloadAsync(const std::string &objectPath, int64_t timeoutMs, DownloadCallback done) override;
+
+    /**
+     * @brief Start the Range GETs of [offset, offset + size) of the object on the event loop and return.
+     * @param[in] objectPath the object path in obs bucket
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get, fewer are returned if the object ends before
+     * @param[in] done called once with the result and the object content in the range, on a callback pool thread
+     * @return Status of the call
+     */
+    Status DownloadRangeAsync(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                              DownloadCallback done) override;
+
     /**
      * @brief delete the obs object.
      * @param[in] objectPaths the whole path of the object, not support prefix
@@ -403,6 +466,107 @@ private:
      */
     Status GetObject(const std::string &objPath, std::shared_ptr<std::stringstream> &buf, Timer &timer);
 
+    /**
+     * @brief Get a range of an object from obs with one HTTP Range request.
+     * @param[in] objPath the object path in obs bucket
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get
+     * @param[in] timer timer recording elapsed time for timeout limit
+     * @param[out] data the bytes of the range, fewer than size if the object ends before. The whole object if
+     * the server ignored the range
+     * @param[out] objectSize the size of the whole object, 0 if the server does not tell
+     * @param[out] wholeObject true if the server ignored the range and answered 200 with the whole object
+     * @return Status of the call, K_OUT_OF_RANGE if the offset is past the end of the object
+     */
+    Status GetObjectRange(const std::string &objPath, uint64_t offset, uint64_t size, Timer &timer,
+                          std::string &data, uint64_t &objectSize, bool &wholeObject);
+
+    /**
+     * @brief Get a range of an object from obs in parts downloaded concurrently.
+     * @param[in] objPath the object path in obs bucket
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get
+     * @param[in] objectSize the size of the whole object, 0 if not known yet
+     * @param[in] timer timer recording elapsed time for timeout limit
+     * @param[in] content the stream the bytes of the range are appended to
+     * @return Status of the call, K_RUNTIME_ERROR if the object changes during the download
+     */
+    Status GetObjectParts(const std::string &objPath, uint64_t offset, uint64_t size, uint64_t objectSize,
+                          Timer &timer, const std::shared_ptr<std::stringstream> &content);
+
+    using RangeCallback = std::function<void(const Status &rc, const std::shared_ptr<std::stringstream> &body,
+                                             uint64_t objectSize, bool wholeObject)>;
+    using PartsCallback = std::function<void(const Status &rc)>;
+
+    /**
+     * @brief Start one HTTP Range request on the event loop, the asynchronous GetObjectRange().
+     * @param[in] objPath the object path in obs bucket
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] done called once on the event loop with the result, the response body, the size of the whole
+     * object (0 if the server does not tell) and whether the server ignored the range and sent the whole object
+     * @return Status of the call
+     */
+    Status GetObjectRangeAsync(const std::string &objPath, uint64_t offset, uint64_t size, int64_t timeoutMs,
+                               RangeCallback done);
+
+    /**
+     * @brief Start the Range requests of all the parts of a range at once, the asynchronous GetObjectParts(). Each
+     * part is appended to the content as soon as the parts before it are, and dropped then.
+     * @param[in] objPath the object path in obs bucket
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get
+     * @param[in] objectSize the size of the whole object, 0 if not known yet
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[in] content the stream the bytes of the range are appended to, not touched by others until done
+     * @param[in] done called once on the event loop when all the parts end, with the last error
+     * @return Status of the call
+     */
+    Status GetObjectPartsAsync(const std::string &objPath, uint64_t offset, uint64_t size, uint64_t objectSize,
+                               int64_t timeoutMs, const std::shared_ptr<std::stringstream> &content,
+                               PartsCallback done);
+
+    /**
+     * @brief Run a callback of the asynchronous API on the callback pool, so that it may block or call the
+     * synchronous API without stalling the event loop.
+     * @param[in] callback the callback bound to its arguments
+     */
+    void RunCallback(std::function<void()> callback);
+
+    /**
+     * @brief Map the http status of a GET to the status of the call.
+     * @param[in] objPath the object path in obs bucket
+     * @param[in] offset the first byte asked
+     * @param[in] httpStatus the http status
+     * @return K_NOT_FOUND, K_OUT_OF_RANGE or K_RUNTIME_ERROR for the failed statuses
+     */
+    Status CheckGetStatus(const std::string &objPath, uint64_t offset, int httpStatus);
+
+    /**
+     * @brief Get a range of an object from obs with one HTTP Range request into a buffer. Only a 206 or 200 body is
+     * written into the buffer, a 200 is the whole object and fills the buffer up to destSize from offset on.
+     * @param[in] objPath the object path in obs bucket
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get
+     * @param[in] destSize the size of the buffer, at least size
+     * @param[in] timer timer recording elapsed time for timeout limit
+     * @param[out] dest the buffer of destSize bytes
+     * @param[out] objectSize the size of the whole object, 0 if the server does not tell
+     * @param[out] wholeObject true if the server ignored the range and answered 200 with the whole object
+     * @return Status of the call, K_OUT_OF_RANGE if the object ends before offset + size
+     */
+    Status GetObjectRangeToBuffer(const std::string &objPath, uint64_t offset, uint64_t size, uint64_t destSize,
+                                  Timer &timer, uint8_t *dest, uint64_t &objectSize, bool &wholeObject);
+
+    /**
+     * @brief Run the download of the parts of a range, concurrently on the thread pool if there are several.
+     * @param[in] partNum the number of parts
+     * @param[in] job downloads the part of the index
+     * @return The last error of the parts
+     */
+    Status RunDownloadParts(uint64_t partNum, const std::function<Status(uint64_t)> &job);
+
     /**
      * @brief List objects using prefix.
      * @param[in] objectPrefix prefix of object path in obs bucket
@@ -485,7 +649,7 @@ private:
     Status UpdateTempObsToken();
 
     const int NUM_THREAD = 10;
-    std::unique_ptr<ThreadPool> threadPool_{ nullptr };  // Used for concurrent multipart upload.
+    std::unique_ptr<ThreadPool> threadPool_{ nullptr };  // Used for concurrent multipart upload and download.
     std::mutex multiPartUploadMx_;
     CredentialInfo obsTempCredentialInfo_;
     std::atomic<bool> isTokenRotationStarting_{ false };
@@ -496,7 +660,9 @@ private:
     std::string endPoint_;  // OBS host to connect to
     std::string bucketName_;
     ObsCredentialManager credentialManager_;
-    std::shared_ptr<HttpClient> httpClient_;
+    std::shared_ptr<HttpClient> httpClient_;  // Blocking client of the synchronous requests.
+    std::shared_ptr<CurlMultiHttpClient> asyncHttpClient_;
+    std::unique_ptr<ThreadPool> callbackPool_{ nullptr };  // Runs the callbacks of the asynchronous API.
     std::atomic_bool initialized_{ false };
     MetricsObsCodeVector successRateVec_;
     std::unique_ptr<ObsSignatureProvider> signatureProvider_;  // Signature provider (OBS V2 or AWS V4)
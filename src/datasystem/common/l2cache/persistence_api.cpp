@@ -27,6 +27,7 @@
 #include "datasystem/common/l2cache/object_persistence_api.h"
 #include "datasystem/common/l2cache/slot_client/slot_client.h"
 #include "datasystem/common/l2cache/slot_client/slot_file_util.h"
+#include "datasystem/common/util/memory.h"
 #include "datasystem/common/util/raii.h"
 
 DS_DECLARE_string(l2_cache_type);
@@ -44,6 +45,31 @@ std::unique_ptr<PersistenceApi> PersistenceApi::Create()
     return std::make_unique<ObjectPersistenceApi>();
 }
 
+Status PersistenceApi::GetRange(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                                int64_t timeoutMs, std::shared_ptr<std::stringstream> &content)
+{
+    auto whole = std::make_shared<std::stringstream>();
+    RETURN_IF_NOT_OK(Get(objectKey, version, timeoutMs, whole));
+    const std::string data = whole->str();
+    content = std::make_shared<std::stringstream>(offset < data.size() ? data.substr(offset, size) : std::string());
+    return Status::OK();
+}
+
+Status PersistenceApi::GetToBuffer(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                                   int64_t timeoutMs, void *dest, uint64_t &objectSize)
+{
+    auto whole = std::make_shared<std::stringstream>();
+    RETURN_IF_NOT_OK(Get(objectKey, version, timeoutMs, whole));
+    const std::string data = whole->str();
+    objectSize = data.size();
+    CHECK_FAIL_RETURN_STATUS(offset <= data.size() && size <= data.size() - offset, StatusCode::K_OUT_OF_RANGE,
+                             FormatString("Range [%lu, %lu) is past the end of object %s", offset, offset + size,
+                                          objectKey));
+    RETURN_OK_IF_TRUE(size == 0);
+    return HugeMemoryCopy(static_cast<uint8_t *>(dest), size, reinterpret_cast<const uint8_t *>(data.data()) + offset,
+                          size);
+}
+
 std::shared_ptr<PersistenceApi> PersistenceApi::CreateShared()
 {
     auto api = Create();
@@ -69,6 +69,40 @@ public:
     virtual Status Get(const std::string &objectKey, uint64_t version, int64_t timeoutMs,
                        std::shared_ptr<std::stringstream> &content) = 0;
 
+    /**
+     * @brief get the bytes [offset, offset + size) of the persistence object with the given version.
+     * if the given version is not exist, read the range of the max version exist in persistence, like Get.
+     * the default implementation gets the whole object and keeps the range.
+     *
+     * @param[in] objectKey the object key:<TenantId>/<ObjectKey>
+     * @param[in] version the object meta version
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get, fewer are returned if the object ends before
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[out] content the string stream byte of the range
+     * @return Status of call
+     */
+    virtual Status GetRange(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                            int64_t timeoutMs, std::shared_ptr<std::stringstream> &content);
+
+    /**
+     * @brief get the bytes [offset, offset + size) of the persistence object with the given version straight into
+     * the caller's buffer, e.g. the shared memory of the object, without staging them in a string stream.
+     * if the given version is not exist, read the range of the max version exist in persistence, like Get.
+     * the default implementation gets the whole object and copies the range out of it.
+     *
+     * @param[in] objectKey the object key:<TenantId>/<ObjectKey>
+     * @param[in] version the object meta version
+     * @param[in] offset the first byte to get
+     * @param[in] size the number of bytes to get
+     * @param[in] timeoutMs the connect and request timeout in million second
+     * @param[out] dest the buffer of at least size bytes
+     * @param[out] objectSize the size of the whole stored object, 0 if the backend does not tell
+     * @return K_OUT_OF_RANGE if the object ends before offset + size
+     */
+    virtual Status GetToBuffer(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                               int64_t timeoutMs, void *dest, uint64_t &objectSize);
+
     /**
      * @brief get the persistence object without any given version.
      * @param[in] objectKey the object key:<TenantId>/<ObjectKey>
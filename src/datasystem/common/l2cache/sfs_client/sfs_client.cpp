@@ -21,7 +21,9 @@
 
 #include "datasystem/common/l2cache/sfs_client/sfs_client.h"
 
+#include <algorithm>
 #include <dirent.h>
+#include <fcntl.h>
 #include <climits>
 #include <fstream>
 #include <iostream>
@@ -29,6 +31,7 @@
 #include <unistd.h>
 
 #include "datasystem/common/flags/flags.h"
+#include "datasystem/common/util/file_util.h"
 #include "datasystem/common/util/format.h"
 #include "datasystem/common/util/raii.h"
 #include "datasystem/common/util/status_helper.h"
@@ -278,6 +281,59 @@ Status SfsClient::Download(const std::string &objectPath, int64_t timeoutMs,
     return Status::OK();
 }
 
+Status SfsClient::DownloadRange(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                                std::shared_ptr<std::stringstream> &content)
+{
+    Timer timer(timeoutMs);
+    LOG(INFO) << "Downloading range [" << offset << ", " << offset + size << ") of object " << objectPath
+              << " timeoutMs: " << timeoutMs;
+    int fd = -1;
+    uint64_t fileSize = 0;
+    RETURN_IF_NOT_OK(OpenForRead(objectPath, fd, fileSize));
+    Raii closeFd([fd]() { close(fd); });
+    const uint64_t readSize = offset < fileSize ? std::min(size, fileSize - offset) : 0;
+    std::string buf(readSize, '\0');
+    RETURN_IF_NOT_OK(ReadFile(fd, buf.data(), readSize, static_cast<off_t>(offset)));
+    CHECK_FAIL_RETURN_STATUS(timer.GetRemainingTimeMs() > 0, K_RUNTIME_ERROR,
+                             "Timed out during downloading object from SFS. Read from SFS failed.");
+    content = std::make_shared<std::stringstream>(std::move(buf));
+    return Status::OK();
+}
+
+Status SfsClient::DownloadToBuffer(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                                   void *dest, uint64_t &objectSize)
+{
+    Timer timer(timeoutMs);
+    VLOG(1) << "Downloading range [" << offset << ", " << offset + size << ") of object " << objectPath
+            << " to buffer, timeoutMs: " << timeoutMs;
+    int fd = -1;
+    uint64_t fileSize = 0;
+    RETURN_IF_NOT_OK(OpenForRead(objectPath, fd, fileSize));
+    Raii closeFd([fd]() { close(fd); });
+    objectSize = fileSize;
+    CHECK_FAIL_RETURN_STATUS(offset <= fileSize && size <= fileSize - offset, K_OUT_OF_RANGE,
+                             FormatString("Range [%lu, %lu) is past the end of object %s of %lu bytes", offset,
+                                          offset + size, objectPath, fileSize));
+    RETURN_IF_NOT_OK(ReadFile(fd, dest, size, static_cast<off_t>(offset)));
+    CHECK_FAIL_RETURN_STATUS(timer.GetRemainingTimeMs() > 0, K_RUNTIME_ERROR,
+                             "Timed out during downloading object from SFS. Read from SFS failed.");
+    return Status::OK();
+}
+
+Status SfsClient::OpenForRead(const std::string &objectPath, int &fd, uint64_t &fileSize)
+{
+    RETURN_IF_NOT_OK(ValidateObjNameWithVersion(objectPath));
+    std::string fullPath;
+    RETURN_IF_NOT_OK(GenerateFullPath(objectPath, fullPath));
+    if (fullPath.empty()) {
+        RETURN_STATUS(K_RUNTIME_ERROR, FormatString("Cannot generate the full path for object: %s", objectPath));
+    }
+    RETURN_IF_NOT_OK(IfPathExists(fullPath));
+    RETURN_IF_NOT_OK(OpenFile(fullPath, O_RDONLY, &fd));
+    fileSize = FdFileSize(fd);
+    return Status::OK();
+}
+
 Status SfsClient::Delete(const std::vector<std::string> &objects, uint64_t asyncElapse)
 {
     (void)asyncElapse;
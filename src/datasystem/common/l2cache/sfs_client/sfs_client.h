@@ -98,6 +98,31 @@ public:
     Status Download(const std::string &objectPath, int64_t timeoutMs,
                     std::shared_ptr<std::stringstream> &content) override;
 
+    /**
+     * @brief Read the bytes [offset, offset + size) of an object from SFS
+     * @param[in] objectPath objectKey/versionNum
+     * @param[in] timeoutMs timeout
+     * @param[in] offset the first byte to read
+     * @param[in] size the number of bytes to read, fewer are returned if the object ends before
+     * @param[out] content a stringstream to hold the range
+     * @return Status of the call
+     */
+    Status DownloadRange(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                         std::shared_ptr<std::stringstream> &content) override;
+
+    /**
+     * @brief Read the bytes [offset, offset + size) of an object from SFS straight into the caller's buffer
+     * @param[in] objectPath objectKey/versionNum
+     * @param[in] timeoutMs timeout
+     * @param[in] offset the first byte to read
+     * @param[in] size the number of bytes to read
+     * @param[out] dest the buffer of at least size bytes
+     * @param[out] objectSize the size of the object file
+     * @return K_OUT_OF_RANGE if the object ends before offset + size
+     */
+    Status DownloadToBuffer(const std::string &objectPath, int64_t timeoutMs, uint64_t offset, uint64_t size,
+                            void *dest, uint64_t &objectSize) override;
+
     /**
      * @brief Delete object on SFS
      * @param[in] objects objects to delete
@@ -126,6 +151,7 @@ private:
     Status IsSfsUsable();
     Status DeleteOne(const std::string &objectPath);
     Status GenerateFullPath(const std::string &objectPath, std::string &outPath);
+    Status OpenForRead(const std::string &objectPath, int &fd, uint64_t &fileSize);
     Status LoopUpload(const std::shared_ptr<std::iostream> &body, const size_t chunkSize, std::ofstream &file,
                       Timer &timer);
     std::unique_ptr<char[]> GetAChunk(const std::shared_ptr<std::iostream> &body, const size_t chunkSize,
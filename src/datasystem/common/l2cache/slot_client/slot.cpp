@@ -241,6 +241,9 @@ Status Slot::EnsureRuntimeReadyLocked()
     if (runtime_.initialized && !IsRuntimeStaleLocked()) {
         return Status::OK();
     }
+    // Pending saves still write through the active data fd and publish into this runtime.
+    CHECK_FAIL_RETURN_STATUS(inflightWrites_ == 0, StatusCode::K_TRY_AGAIN,
+                             "Slot runtime is stale while saves are in flight");
     ResetRuntimeLocked();
     RETURN_IF_NOT_OK(BuildRuntimeStateLocked());
     return Status::OK();
@@ -396,40 +399,8 @@ Status Slot::WriteStreamToFd(const std::shared_ptr<std::iostream> &body, int fd,
     return Status::OK();
 }
 
-Status Slot::AppendPayloadToActiveFileLocked(const std::shared_ptr<std::iostream> &body, uint64_t payloadSize,
-                                             uint64_t &offset)
-{
-    body->clear();
-    (void)body->seekg(0, std::ios::beg);
-    std::vector<char> buffer(SLOT_IO_CHUNK_BYTES);
-    uint64_t writtenBytes = 0;
-    bool firstChunk = true;
-    while (true) {
-        body->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
-        auto bytesRead = body->gcount();
-        if (bytesRead > 0) {
-            uint64_t chunkOffset = 0;
-            RETURN_IF_NOT_OK(writer_.AppendData(buffer.data(), static_cast<size_t>(bytesRead), chunkOffset));
-            if (firstChunk) {
-                offset = chunkOffset;
-                firstChunk = false;
-            }
-            writtenBytes += static_cast<uint64_t>(bytesRead);
-        }
-        if (body->eof()) {
-            break;
-        }
-        CHECK_FAIL_RETURN_STATUS(!body->fail(), StatusCode::K_RUNTIME_ERROR, "Failed to read payload stream");
-    }
-    body->clear();
-    (void)body->seekg(0, std::ios::beg);
-    CHECK_FAIL_RETURN_STATUS(writtenBytes == payloadSize, StatusCode::K_RUNTIME_ERROR,
-                             "Active data file payload size mismatch");
-    return Status::OK();
-}
-
-Status Slot::WriteExclusivePayloadLocked(const std::shared_ptr<std::iostream> &body, uint32_t fileId,
-                                         uint64_t payloadSize) const
+Status Slot::WriteExclusivePayload(const std::shared_ptr<std::iostream> &body, uint32_t fileId,
+                                   uint64_t payloadSize) const
 {
     auto dataPath = JoinPath(slotPath_, FormatDataFileName(fileId));
     RETURN_IF_NOT_OK(EnsureFile(dataPath));
@@ -449,47 +420,88 @@ Status Slot::WriteExclusivePayloadLocked(const std::shared_ptr<std::iostream> &b
     return Status::OK();
 }
 
+Status Slot::ReserveWrite(uint64_t payloadSize, SlotPendingWrite &pending)
+{
+    std::unique_lock<std::mutex> lock(mu_);
+    RETURN_IF_NOT_OK(EnsureRuntimeReadyLocked());
+    RETURN_IF_NOT_OK(EnsureWritable(runtime_.manifest));
+    pending.exclusiveFile = payloadSize >= maxDataFileBytes_;
+    if (pending.exclusiveFile) {
+        RETURN_IF_NOT_OK(AllocateExclusiveDataFileLocked(pending.fileId));
+    } else {
+        // Rotation reopens the active files and syncs the old data file, so earlier reservations must land first.
+        if (runtime_.manifest.activeData.empty() || writer_.GetActiveDataSize() + payloadSize > maxDataFileBytes_) {
+            writeCv_.wait(lock, [this]() { return inflightWrites_ == 0; });
+        }
+        RETURN_IF_NOT_OK(RotateWritableDataFileLocked(payloadSize, pending.fileId));
+        RETURN_IF_NOT_OK(writer_.ReserveData(payloadSize, pending.offset, pending.dataFd));
+    }
+    pending.ticket = nextWriteTicket_++;
+    ++inflightWrites_;
+    return Status::OK();
+}
+
+Status Slot::WritePendingPayload(const std::shared_ptr<std::iostream> &body, uint64_t payloadSize,
+                                 const SlotPendingWrite &pending) const
+{
+    if (pending.exclusiveFile) {
+        return WriteExclusivePayload(body, pending.fileId, payloadSize);
+    }
+    uint64_t writtenBytes = 0;
+    RETURN_IF_NOT_OK(WriteStreamToFd(body, pending.dataFd, pending.offset, writtenBytes));
+    CHECK_FAIL_RETURN_STATUS(writtenBytes == payloadSize, StatusCode::K_RUNTIME_ERROR,
+                             "Active data file payload size mismatch");
+    return Status::OK();
+}
+
+Status Slot::CommitWrite(const SlotPendingWrite &pending, const SlotPutRecord &record, const Status &writeRc)
+{
+    std::unique_lock<std::mutex> lock(mu_);
+    writeCv_.wait(lock, [this, &pending]() { return nextCommitTicket_ == pending.ticket; });
+    Raii finishTicket([this]() {
+        ++nextCommitTicket_;
+        --inflightWrites_;
+        writeCv_.notify_all();
+    });
+    // A failed write leaves an unreferenced hole in the data file, compaction drops it later.
+    RETURN_IF_NOT_OK(writeRc);
+    std::string encoded;
+    RETURN_IF_NOT_OK(SlotIndexCodec::EncodePut(record, encoded));
+    RETURN_IF_NOT_OK(writer_.AppendIndexPayload(encoded));
+    writer_.RecordOperation(record.size + encoded.size());
+    runtime_.snapshot.ApplyPut(record);
+    RETURN_IF_NOT_OK(FlushRuntimeLocked(false));
+    return Status::OK();
+}
+
 Status Slot::Save(const std::string &key, uint64_t version, const std::shared_ptr<std::iostream> &body,
                   uint64_t asyncElapse, WriteMode writeMode, uint32_t ttlSecond)
 {
     (void)asyncElapse;
     VLOG(1) << "Slot save begin, slotId=" << slotId_ << ", key=" << key << ", version=" << version
             << ", writeMode=" << static_cast<uint32_t>(writeMode);
-    std::lock_guard<std::mutex> lock(mu_);
-    RETURN_IF_NOT_OK(EnsureRuntimeReadyLocked());
-    RETURN_IF_NOT_OK(EnsureWritable(runtime_.manifest));
     uint64_t payloadSize = 0;
     RETURN_IF_NOT_OK(GetPayloadSize(body, payloadSize));
-    uint32_t fileId = 0;
-    bool useExclusiveFile = payloadSize >= maxDataFileBytes_;
-    if (useExclusiveFile) {
-        RETURN_IF_NOT_OK(AllocateExclusiveDataFileLocked(fileId));
-    } else {
-        RETURN_IF_NOT_OK(RotateWritableDataFileLocked(payloadSize, fileId));
-    }
-    uint64_t offset = 0;
-    if (useExclusiveFile) {
-        RETURN_IF_NOT_OK(WriteExclusivePayloadLocked(body, fileId, payloadSize));
-    } else {
-        RETURN_IF_NOT_OK(AppendPayloadToActiveFileLocked(body, payloadSize, offset));
-    }
+    std::shared_lock<std::shared_mutex> gate(writeGate_);
+    SlotPendingWrite pending;
+    RETURN_IF_NOT_OK(ReserveWrite(payloadSize, pending));
+    // The payload goes to its reserved range without mu_, so saves hashing to one slot keep several writes queued.
+    auto writeRc = WritePendingPayload(body, payloadSize, pending);
+    // The reserved ticket must reach CommitWrite, so an injected failure is reported as a failed payload write.
+    INJECT_POINT_NO_RETURN("slotstore.Slot.Save.BeforeCommit",
+                           [&writeRc]() { writeRc = Status(StatusCode::K_RUNTIME_ERROR, "Injected write failure"); });
     SlotPutRecord record;
     record.key = key;
-    record.fileId = fileId;
-    record.offset = offset;
+    record.fileId = pending.fileId;
+    record.offset = pending.offset;
     record.size = payloadSize;
     record.version = version;
     record.writeMode = writeMode;
     record.ttlSecond = ttlSecond;
-    std::string encoded;
-    RETURN_IF_NOT_OK(SlotIndexCodec::EncodePut(record, encoded));
-    RETURN_IF_NOT_OK(writer_.AppendIndexPayload(encoded));
-    writer_.RecordOperation(payloadSize + encoded.size());
-    runtime_.snapshot.ApplyPut(record);
-    RETURN_IF_NOT_OK(FlushRuntimeLocked(false));
+    RETURN_IF_NOT_OK(CommitWrite(pending, record, writeRc));
     VLOG(1) << "Slot save end, slotId=" << slotId_ << ", key=" << key << ", version=" << version
-            << ", payloadSize=" << payloadSize << ", fileId=" << fileId << ", offset=" << offset
-            << ", exclusiveFile=" << useExclusiveFile;
+            << ", payloadSize=" << payloadSize << ", fileId=" << pending.fileId << ", offset=" << pending.offset
+            << ", exclusiveFile=" << pending.exclusiveFile;
     return Status::OK();
 }
 
@@ -508,6 +520,41 @@ Status Slot::Get(const std::string &key, uint64_t version, std::shared_ptr<std::
     return Status::OK();
 }
 
+Status Slot::GetRange(const std::string &key, uint64_t version, uint64_t offset, uint64_t size,
+                      std::shared_ptr<std::stringstream> &content)
+{
+    VLOG(1) << "Slot get range begin, slotId=" << slotId_ << ", key=" << key << ", version=" << version
+            << ", rangeOffset=" << offset << ", rangeSize=" << size;
+    SlotSnapshotValue value;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        RETURN_IF_NOT_OK(EnsureRuntimeReadyLocked());
+        RETURN_IF_NOT_OK(runtime_.snapshot.FindExact(key, version, value));
+    }
+    return ReadRecordData(value, content, offset, size);
+}
+
+Status Slot::GetToBuffer(const std::string &key, uint64_t version, uint64_t offset, uint64_t size, void *dest,
+                         uint64_t &objectSize)
+{
+    VLOG(1) << "Slot get to buffer begin, slotId=" << slotId_ << ", key=" << key << ", version=" << version
+            << ", rangeOffset=" << offset << ", rangeSize=" << size;
+    SlotSnapshotValue value;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        RETURN_IF_NOT_OK(EnsureRuntimeReadyLocked());
+        RETURN_IF_NOT_OK(runtime_.snapshot.FindExact(key, version, value));
+    }
+    objectSize = value.size;
+    CHECK_FAIL_RETURN_STATUS(offset <= value.size && size <= value.size - offset, StatusCode::K_OUT_OF_RANGE,
+                             FormatString("Range [%lu, %lu) is past the end of %s of %lu bytes", offset,
+                                          offset + size, key, value.size));
+    int fd = -1;
+    RETURN_IF_NOT_OK(OpenRecordData(value, fd));
+    Raii closeFd([fd]() { close(fd); });
+    return ReadFile(fd, dest, size, static_cast<off_t>(value.offset + offset));
+}
+
 Status Slot::GetWithoutVersion(const std::string &key, uint64_t minVersion, std::shared_ptr<std::stringstream> &content)
 {
     VLOG(1) << "Slot get-latest begin, slotId=" << slotId_ << ", key=" << key << ", minVersion=" << minVersion;
@@ -563,6 +610,7 @@ Status Slot::PreloadLocal(const SlotPreloadCallback &callback)
 
 Status Slot::ReplayIndex(SlotSnapshot &snapshot)
 {
+    std::lock_guard<std::shared_mutex> gate(writeGate_);
     std::lock_guard<std::mutex> lock(mu_);
     VLOG(1) << "Slot replay-index begin, slotId=" << slotId_ << ", slotPath=" << slotPath_;
     INJECT_POINT("slotstore.Slot.ReplayIndex.Enter", []() { return Status::OK(); });
@@ -660,6 +708,7 @@ Status Slot::BuildBootstrapManifestFromDisk(SlotManifestData &manifest)
 Status Slot::Repair()
 {
     VLOG(1) << "Slot repair begin, slotId=" << slotId_ << ", slotPath=" << slotPath_;
+    std::lock_guard<std::shared_mutex> gate(writeGate_);
     std::lock_guard<std::mutex> lock(mu_);
     RETURN_IF_NOT_OK(FlushRuntimeLocked(true));
     writer_.Close();
@@ -766,6 +815,8 @@ Status Slot::Compact()
     }
 
     {
+        // Pending saves reserved ranges in the data files that the cutover retires, let them publish first.
+        std::lock_guard<std::shared_mutex> gate(writeGate_);
         std::lock_guard<std::mutex> lock(mu_);
         RETURN_IF_NOT_OK(EnsureRuntimeReadyLocked());
         RETURN_IF_NOT_OK(CheckCompactTransferPreemptionLocked());
@@ -824,6 +875,7 @@ Status Slot::Compact()
 Status Slot::Seal(const std::string &sealReason)
 {
     (void)sealReason;
+    std::lock_guard<std::shared_mutex> gate(writeGate_);
     std::lock_guard<std::mutex> lock(mu_);
     RETURN_IF_NOT_OK(EnsureRuntimeReadyLocked());
     RETURN_IF_NOT_OK(FlushRuntimeLocked(true));
@@ -858,6 +910,7 @@ Status Slot::Takeover(const std::string &sourceSlotPath, const SlotTakeoverReque
     std::string txnId;
     std::vector<SlotPutRecord> preloadPuts;
     {
+        std::lock_guard<std::shared_mutex> gate(writeGate_);
         std::lock_guard<std::mutex> lock(mu_);
         RETURN_IF_NOT_OK(EnsureRuntimeReadyLocked());
         RETURN_IF_NOT_OK(FlushRuntimeLocked(true));
@@ -1251,22 +1304,20 @@ Status Slot::PersistManifest(const SlotManifestData &manifest)
     return Status::OK();
 }
 
-Status Slot::ReadRecordData(const SlotSnapshotValue &value, std::shared_ptr<std::stringstream> &content) const
+Status Slot::ReadRecordData(const SlotSnapshotValue &value, std::shared_ptr<std::stringstream> &content,
+                            uint64_t rangeOffset, uint64_t rangeSize) const
 {
     CHECK_FAIL_RETURN_STATUS(content != nullptr, StatusCode::K_INVALID, "content is nullptr");
     int fd = -1;
-    auto dataPath = JoinPath(slotPath_, FormatDataFileName(value.fileId));
-    RETURN_IF_NOT_OK(OpenFile(dataPath, O_RDONLY, &fd));
-    Raii closeFd([fd]() {
-        if (fd >= 0) {
-            close(fd);
-        }
-    });
+    RETURN_IF_NOT_OK(OpenRecordData(value, fd));
+    Raii closeFd([fd]() { close(fd); });
     content->str("");
     content->clear();
-    std::vector<char> buffer(std::min<uint64_t>(value.size, SLOT_IO_CHUNK_BYTES));
-    uint64_t remaining = value.size;
-    uint64_t offset = value.offset;
+    // Only the requested range of the record is read from the data file.
+    const uint64_t skip = std::min(rangeOffset, value.size);
+    uint64_t remaining = std::min(rangeSize, value.size - skip);
+    uint64_t offset = value.offset + skip;
+    std::vector<char> buffer(std::min<uint64_t>(remaining, SLOT_IO_CHUNK_BYTES));
     while (remaining > 0) {
         auto bytesToRead = static_cast<size_t>(std::min<uint64_t>(remaining, buffer.size()));
         RETURN_IF_NOT_OK(ReadFile(fd, buffer.data(), bytesToRead, static_cast<off_t>(offset)));
@@ -1277,6 +1328,12 @@ Status Slot::ReadRecordData(const SlotSnapshotValue &value, std::shared_ptr<std:
     return Status::OK();
 }
 
+Status Slot::OpenRecordData(const SlotSnapshotValue &value, int &fd) const
+{
+    auto dataPath = JoinPath(slotPath_, FormatDataFileName(value.fileId));
+    return OpenFile(dataPath, O_RDONLY, &fd);
+}
+
 Status Slot::EnsureWritable(const SlotManifestData &manifest) const
 {
     CHECK_FAIL_RETURN_STATUS(IsNormalManifest(manifest), StatusCode::K_TRY_AGAIN,
@@ -19,9 +19,11 @@
 #define DATASYSTEM_COMMON_L2CACHE_SLOT_CLIENT_SLOT_H
 
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -58,6 +60,17 @@ struct SlotRuntimeState {
     }
 };
 
+/**
+ * @brief One PUT whose data range is reserved but whose index record is not published yet.
+ */
+struct SlotPendingWrite {
+    uint64_t ticket{ 0 };
+    uint32_t fileId{ 0 };
+    uint64_t offset{ 0 };
+    int dataFd{ -1 };
+    bool exclusiveFile{ false };
+};
+
 /**
  * @brief Persist and query objects inside one local slot directory.
  */
@@ -75,6 +88,7 @@ public:
 
     /**
      * @brief Append object data and a PUT record into this slot.
+     * Concurrent saves write their payloads in parallel, the PUT records are published in reservation order.
      * @param[in] key The object key.
      * @param[in] version The object version.
      * @param[in] body The object content stream.
@@ -93,6 +107,31 @@ public:
      */
     Status Get(const std::string &key, uint64_t version, std::shared_ptr<std::stringstream> &content);
 
+    /**
+     * @brief Read the bytes [offset, offset + size) of one exact version from this slot.
+     * @param[in] key The object key.
+     * @param[in] version The exact object version to read.
+     * @param[in] offset The first byte to read.
+     * @param[in] size The number of bytes to read, fewer are returned if the object ends before.
+     * @param[out] content The returned range of the object content.
+     * @return Status of the call.
+     */
+    Status GetRange(const std::string &key, uint64_t version, uint64_t offset, uint64_t size,
+                    std::shared_ptr<std::stringstream> &content);
+
+    /**
+     * @brief Read the bytes [offset, offset + size) of one exact version from this slot into the caller's buffer.
+     * @param[in] key The object key.
+     * @param[in] version The exact object version to read.
+     * @param[in] offset The first byte to read.
+     * @param[in] size The number of bytes to read.
+     * @param[out] dest The buffer of at least size bytes.
+     * @param[out] objectSize The size of the whole object version.
+     * @return K_OUT_OF_RANGE if the object ends before offset + size.
+     */
+    Status GetToBuffer(const std::string &key, uint64_t version, uint64_t offset, uint64_t size, void *dest,
+                       uint64_t &objectSize);
+
     /**
      * @brief Read the latest visible version from this slot.
      * @param[in] key The object key.
@@ -189,10 +228,12 @@ private:
     Status GetPayloadSize(const std::shared_ptr<std::iostream> &body, uint64_t &payloadSize) const;
     Status WriteStreamToFd(const std::shared_ptr<std::iostream> &body, int fd, uint64_t startOffset,
                            uint64_t &writtenBytes) const;
-    Status AppendPayloadToActiveFileLocked(const std::shared_ptr<std::iostream> &body, uint64_t payloadSize,
-                                           uint64_t &offset);
-    Status WriteExclusivePayloadLocked(const std::shared_ptr<std::iostream> &body, uint32_t fileId,
-                                       uint64_t payloadSize) const;
+    Status ReserveWrite(uint64_t payloadSize, SlotPendingWrite &pending);
+    Status WritePendingPayload(const std::shared_ptr<std::iostream> &body, uint64_t payloadSize,
+                               const SlotPendingWrite &pending) const;
+    Status CommitWrite(const SlotPendingWrite &pending, const SlotPutRecord &record, const Status &writeRc);
+    Status WriteExclusivePayload(const std::shared_ptr<std::iostream> &body, uint32_t fileId,
+                                 uint64_t payloadSize) const;
     Status BuildBootstrapManifestFromDisk(SlotManifestData &manifest);
     Status RecoverManifestIfNeeded(SlotManifestData &manifest);
     Status RecoverCompactCommitting(SlotManifestData &manifest);
@@ -206,7 +247,9 @@ private:
     Status LoadManifest(SlotManifestData &manifest);
     Status EnsureActiveFiles(const SlotManifestData &manifest);
     Status PersistManifest(const SlotManifestData &manifest);
-    Status ReadRecordData(const SlotSnapshotValue &value, std::shared_ptr<std::stringstream> &content) const;
+    Status ReadRecordData(const SlotSnapshotValue &value, std::shared_ptr<std::stringstream> &content,
+                          uint64_t rangeOffset = 0, uint64_t rangeSize = UINT64_MAX) const;
+    Status OpenRecordData(const SlotSnapshotValue &value, int &fd) const;
     Status EnsureWritable(const SlotManifestData &manifest) const;
     Status SyncActiveFiles(const SlotManifestData &manifest) const;
     Status CollectPreloadPuts(const SlotTakeoverPlan &plan, const SlotTakeoverRequest &request,
@@ -236,6 +279,13 @@ private:
     std::atomic<bool> transferIntentActive_{ false };
     // Protects runtime state, writer state, manifest creation, file rotation and recovery for this slot.
     std::mutex mu_;
+    // Signals pending write commits and drains, protected by mu_.
+    std::condition_variable writeCv_;
+    uint64_t nextWriteTicket_{ 0 };
+    uint64_t nextCommitTicket_{ 0 };
+    uint64_t inflightWrites_{ 0 };
+    // Held shared by Save from reservation to commit, operations that swap the file set take it exclusively first.
+    std::shared_mutex writeGate_;
 };
 }  // namespace datasystem
 
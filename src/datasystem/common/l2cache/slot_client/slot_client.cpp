@@ -202,6 +202,22 @@ Status SlotClient::Get(const std::string &objectKey, uint64_t version, int64_t t
     return GetSlot(GetSlotId(objectKey)).Get(objectKey, version, content);
 }
 
+Status SlotClient::GetRange(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                            int64_t timeoutMs, std::shared_ptr<std::stringstream> &content)
+{
+    RETURN_IF_NOT_OK(EnsureActive());
+    (void)timeoutMs;
+    return GetSlot(GetSlotId(objectKey)).GetRange(objectKey, version, offset, size, content);
+}
+
+Status SlotClient::GetToBuffer(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                               int64_t timeoutMs, void *dest, uint64_t &objectSize)
+{
+    RETURN_IF_NOT_OK(EnsureActive());
+    (void)timeoutMs;
+    return GetSlot(GetSlotId(objectKey)).GetToBuffer(objectKey, version, offset, size, dest, objectSize);
+}
+
 Status SlotClient::GetWithoutVersion(const std::string &objectKey, int64_t timeoutMs, uint64_t minVersion,
                                      std::shared_ptr<std::stringstream> &content)
 {
@@ -91,6 +91,33 @@ public:
     Status Get(const std::string &objectKey, uint64_t version, int64_t timeoutMs,
                std::shared_ptr<std::stringstream> &content) override;
 
+    /**
+     * @brief Read a range of one exact object version from its slot.
+     * @param[in] objectKey The object key used to select the target slot.
+     * @param[in] version The exact object version to read.
+     * @param[in] offset The first byte to read.
+     * @param[in] size The number of bytes to read.
+     * @param[in] timeoutMs The request timeout in millisecond.
+     * @param[out] content The returned range of the object content.
+     * @return Status of the call.
+     */
+    Status GetRange(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                    int64_t timeoutMs, std::shared_ptr<std::stringstream> &content) override;
+
+    /**
+     * @brief Read a range of one exact object version from its slot straight into the caller's buffer.
+     * @param[in] objectKey The object key used to select the target slot.
+     * @param[in] version The exact object version to read.
+     * @param[in] offset The first byte to read.
+     * @param[in] size The number of bytes to read.
+     * @param[in] timeoutMs The request timeout in millisecond.
+     * @param[out] dest The buffer of at least size bytes.
+     * @param[out] objectSize The size of the whole object version.
+     * @return K_OUT_OF_RANGE if the object ends before offset + size.
+     */
+    Status GetToBuffer(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                       int64_t timeoutMs, void *dest, uint64_t &objectSize) override;
+
     /**
      * @brief Read the latest visible object version from its slot.
      * @param[in] objectKey The object key used to select the target slot.
@@ -98,6 +98,15 @@ Status SlotWriter::AppendData(const char *buffer, size_t len, uint64_t &offset)
     return Status::OK();
 }
 
+Status SlotWriter::ReserveData(uint64_t len, uint64_t &offset, int &fd)
+{
+    CHECK_FAIL_RETURN_STATUS(activeDataFd_ >= 0, StatusCode::K_RUNTIME_ERROR, "Active data fd is not initialized");
+    offset = activeDataSize_;
+    fd = activeDataFd_;
+    activeDataSize_ += len;
+    return Status::OK();
+}
+
 Status SlotWriter::AppendIndexPayload(const std::string &payload)
 {
     CHECK_FAIL_RETURN_STATUS(activeIndexFd_ >= 0, StatusCode::K_RUNTIME_ERROR, "Active index fd is not initialized");
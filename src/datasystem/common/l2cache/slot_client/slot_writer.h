@@ -67,6 +67,16 @@ public:
      */
     Status AppendData(const char *buffer, size_t len, uint64_t &offset);
 
+    /**
+     * @brief Reserve a range at the tail of the active data file for a positioned write by the caller.
+     * The fd stays valid until the writer is re-initialized or closed.
+     * @param[in] len The payload length.
+     * @param[out] offset The reserved offset inside the active data file.
+     * @param[out] fd The active data file descriptor.
+     * @return Status of the call.
+     */
+    Status ReserveData(uint64_t len, uint64_t &offset, int &fd);
+
     /**
      * @brief Append one pre-encoded index payload to the active index file.
      * @param[in] payload The encoded index bytes to append.
@@ -43,6 +43,12 @@ public:
     virtual Status Get(const std::string &objectKey, uint64_t version, int64_t timeoutMs,
                        std::shared_ptr<std::stringstream> &content) = 0;
 
+    virtual Status GetRange(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                            int64_t timeoutMs, std::shared_ptr<std::stringstream> &content) = 0;
+
+    virtual Status GetToBuffer(const std::string &objectKey, uint64_t version, uint64_t offset, uint64_t size,
+                               int64_t timeoutMs, void *dest, uint64_t &objectSize) = 0;
+
     virtual Status GetWithoutVersion(const std::string &objectKey, int64_t timeoutMs, uint64_t minVersion,
                                      std::shared_ptr<std::stringstream> &content) = 0;
 
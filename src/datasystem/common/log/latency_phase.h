@@ -67,6 +67,10 @@ LatencyTraceConfig GetClientLatencyTraceConfig();
 
 inline bool ShouldCollectLatencyTrace(const LatencyTraceConfig &config)
 {
+    // The trace timeline samples its own requests, whatever the slow log thresholds and the access log sampling.
+    if (Trace::Instance().IsTimelineSampled()) {
+        return true;
+    }
     if (!config.LatencyTraceEnabled()) {
         return false;
     }
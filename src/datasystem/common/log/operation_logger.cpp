@@ -135,6 +135,8 @@ const std::unordered_set<std::string> &ClientUsedFlagNames()
         "monitor_config_file",
         // ---- client slow-log thresholds (GetClientLatencyTraceConfig on client path) ----
         "client_slow_log_process_slower_than", "client_slow_log_rpc_slower_than",
+        // ---- sampled request timeline (Trace::AddLatencyTick, exported on client shut down) ----
+        "trace_timeline_sample_rate", "trace_timeline_ring_size", "trace_timeline_export_dir",
         // ---- RPC backend selection (every client RPC / startup path) ----
         "use_brpc",
         // ---- URMA data-plane (client UB transport + failover) ----
@@ -25,6 +25,7 @@
 #include "datasystem/common/log/log.h"
 #include "datasystem/common/log/log_sampler.h"
 #include "datasystem/common/log/latency_phase.h"
+#include "datasystem/common/log/trace_timeline.h"
 #include "datasystem/common/util/format.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/common/util/uuid_generator.h"
@@ -263,15 +264,29 @@ void Trace::Invalidate()
 
 void Trace::AddLatencyTick(LatencyTickKey key)
 {
+    uint64_t tick = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
     if (latencyTickCount_ < LATENCY_TICK_MAX_NUM) {
         latencyTicks_[latencyTickCount_].key = key;
-        latencyTicks_[latencyTickCount_].tick =
-            std::chrono::duration_cast<std::chrono::nanoseconds>(
-                std::chrono::steady_clock::now().time_since_epoch()).count();
+        latencyTicks_[latencyTickCount_].tick = tick;
         latencyTickCount_++;
     } else {
         latencyTickDroppedCount_++;
     }
+    if (IsTimelineSampled()) {
+        size_t len = subPosition_ >= 0 ? static_cast<size_t>(subPosition_) : strlen(traceID_);
+        TraceTimeline::Instance().Record(traceID_, len, key, tick);
+    }
+}
+
+bool Trace::IsTimelineSampled() const
+{
+    if (!TraceTimeline::IsEnabled()) {
+        return false;
+    }
+    // Sample on the request trace id so that the sub requests follow their request.
+    size_t len = subPosition_ >= 0 ? static_cast<size_t>(subPosition_) : strlen(traceID_);
+    return TraceTimeline::IsSampled(traceID_, len);
 }
 
 void Trace::ClearLatencyTicks()
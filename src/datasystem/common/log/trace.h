@@ -319,6 +319,12 @@ public:
      */
     void AddLatencyTick(LatencyTickKey key);
 
+    /**
+     * @brief Whether the trace timeline keeps the ticks of the current request.
+     * @return True if trace_timeline_sample_rate is positive and the request trace id is sampled.
+     */
+    bool IsTimelineSampled() const;
+
     /**
      * @brief Reset all latency ticks (count and dropped count to zero).
      */
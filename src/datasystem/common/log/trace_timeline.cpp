@@ -0,0 +1,384 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Sampled request timeline.
+ */
+#include "datasystem/common/log/trace_timeline.h"
+
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <sstream>
+
+#include "datasystem/common/flags/flags.h"
+#include "datasystem/common/util/file_util.h"
+#include "datasystem/common/util/format.h"
+#include "datasystem/common/util/status_helper.h"
+
+DS_DEFINE_double_dynamic(trace_timeline_sample_rate, 0,
+                         "Fraction of the requests whose latency ticks are kept for the timeline export, in [0, 1]. "
+                         "Every process of the cluster should use the same rate. 0 to disable.");
+DS_DEFINE_uint32(trace_timeline_ring_size, 4096, "Number of latency ticks kept per thread for the timeline export.");
+DS_DEFINE_string(trace_timeline_export_dir, "",
+                 "Directory a client writes its timeline to on shut down, as trace_timeline_<pid>.json. Workers export "
+                 "through the perf service instead. Empty to disable.");
+
+namespace datasystem {
+namespace {
+constexpr uint64_t SAMPLE_SCALE = 1'000'000;
+constexpr uint64_t NANO_PER_MICRO = 1'000;
+constexpr int TIMELINE_FILE_MODE = 0640;
+const std::string START_SUFFIX = "_START";
+const std::string END_SUFFIX = "_END";
+
+uint64_t HashTraceID(const char *traceID, size_t len)
+{
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < len; ++i) {
+        h ^= static_cast<uint8_t>(traceID[i]);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+uint64_t GetThreadID()
+{
+    static thread_local uint64_t tid = static_cast<uint64_t>(syscall(SYS_gettid));
+    return tid;
+}
+
+bool EndsWith(const std::string &s, const std::string &suffix)
+{
+    return s.size() > suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+void AppendJsonString(std::ostringstream &os, const std::string &s)
+{
+    os << '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            os << FormatString("\\u%04x", static_cast<int>(c));
+        } else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+class ChromeTraceWriter {
+public:
+    ChromeTraceWriter()
+    {
+        // Steady clock ticks are only comparable inside one host, shift them to the wall clock.
+        auto wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::system_clock::now().time_since_epoch())
+                          .count();
+        auto steadyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+        offsetNs_ = wallNs - steadyNs;
+        pid_ = getpid();
+        os_ << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        os_ << FormatString("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":", pid_);
+        AppendJsonString(os_, program_invocation_short_name);
+        os_ << "}}";
+    }
+
+    void AddComplete(const std::string &name, const TraceTimeline::Event &start, uint64_t endTick)
+    {
+        AddEvent(name, start, "X");
+        os_ << FormatString(",\"dur\":%.3f", static_cast<double>(endTick - start.tick) / NANO_PER_MICRO);
+        EndEvent(start);
+    }
+
+    void AddInstant(const std::string &name, const TraceTimeline::Event &event)
+    {
+        AddEvent(name, event, "i");
+        os_ << ",\"s\":\"t\"";
+        EndEvent(event);
+    }
+
+    std::string Finish()
+    {
+        os_ << "]}";
+        return os_.str();
+    }
+
+private:
+    void AddEvent(const std::string &name, const TraceTimeline::Event &event, const char *phase)
+    {
+        os_ << ",\n{\"name\":";
+        AppendJsonString(os_, name);
+        os_ << FormatString(",\"cat\":\"latency\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":%d,\"tid\":%lu", phase,
+                            static_cast<double>(static_cast<int64_t>(event.tick) + offsetNs_) / NANO_PER_MICRO, pid_,
+                            event.tid);
+    }
+
+    void EndEvent(const TraceTimeline::Event &event)
+    {
+        os_ << ",\"args\":{\"trace_id\":";
+        AppendJsonString(os_, event.traceID);
+        os_ << "}}";
+    }
+
+    std::ostringstream os_;
+    int64_t offsetNs_ = 0;
+    int pid_ = 0;
+};
+}  // namespace
+
+#define LATENCY_TICK_KEY_NAME(k) \
+    case LatencyTickKey::k:      \
+        return #k
+
+const char *LatencyTickKeyName(LatencyTickKey key)
+{
+    switch (key) {
+        LATENCY_TICK_KEY_NAME(CLIENT_GET_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_GET_RPC_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_GET_RPC_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_GET_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_SET_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_CREATE_RPC_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_CREATE_RPC_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_MEMORY_COPY_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_MEMORY_COPY_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_UB_TRANSFER_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_UB_TRANSFER_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_PUBLISH_RPC_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_PUBLISH_RPC_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_SET_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_CREATE_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_CREATE_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_EXIST_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_EXIST_RPC_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_EXIST_RPC_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_EXIST_END);
+        LATENCY_TICK_KEY_NAME(WORKER_GET_START);
+        LATENCY_TICK_KEY_NAME(WORKER_QUERYMETA_START);
+        LATENCY_TICK_KEY_NAME(WORKER_QUERYMETA_END);
+        LATENCY_TICK_KEY_NAME(WORKER_REMOTEGET_START);
+        LATENCY_TICK_KEY_NAME(WORKER_REMOTEGET_END);
+        LATENCY_TICK_KEY_NAME(WORKER_URMA_START);
+        LATENCY_TICK_KEY_NAME(WORKER_URMA_END);
+        LATENCY_TICK_KEY_NAME(WORKER_L2CACHE_READ_START);
+        LATENCY_TICK_KEY_NAME(WORKER_L2CACHE_READ_END);
+        LATENCY_TICK_KEY_NAME(WORKER_GET_END);
+        LATENCY_TICK_KEY_NAME(WORKER_CREATE_START);
+        LATENCY_TICK_KEY_NAME(WORKER_CREATE_END);
+        LATENCY_TICK_KEY_NAME(WORKER_PUBLISH_START);
+        LATENCY_TICK_KEY_NAME(WORKER_CREATE_META_RPC_START);
+        LATENCY_TICK_KEY_NAME(WORKER_CREATE_META_RPC_END);
+        LATENCY_TICK_KEY_NAME(WORKER_UPDATE_META_RPC_START);
+        LATENCY_TICK_KEY_NAME(WORKER_UPDATE_META_RPC_END);
+        LATENCY_TICK_KEY_NAME(WORKER_PUBLISH_END);
+        LATENCY_TICK_KEY_NAME(WORKER_EXIST_START);
+        LATENCY_TICK_KEY_NAME(WORKER_EXIST_QUERYMETA_START);
+        LATENCY_TICK_KEY_NAME(WORKER_EXIST_QUERYMETA_END);
+        LATENCY_TICK_KEY_NAME(WORKER_EXIST_END);
+        LATENCY_TICK_KEY_NAME(META_QUERYMETA_START);
+        LATENCY_TICK_KEY_NAME(META_QUERYMETA_END);
+        LATENCY_TICK_KEY_NAME(META_CREATE_META_START);
+        LATENCY_TICK_KEY_NAME(META_CREATE_META_END);
+        LATENCY_TICK_KEY_NAME(META_UPDATE_META_START);
+        LATENCY_TICK_KEY_NAME(META_UPDATE_META_END);
+        LATENCY_TICK_KEY_NAME(DATA_REMOTEGET_START);
+        LATENCY_TICK_KEY_NAME(DATA_REMOTEGET_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_DIRECT_ROUTE_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_DIRECT_ROUTE_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_DIRECT_QUERY_AND_GET_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_DIRECT_QUERY_AND_GET_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_DIRECT_GET_DATA_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_DIRECT_GET_DATA_END);
+        LATENCY_TICK_KEY_NAME(CLIENT_DIRECT_MATERIALIZE_START);
+        LATENCY_TICK_KEY_NAME(CLIENT_DIRECT_MATERIALIZE_END);
+        default:
+            return "UNKNOWN";
+    }
+}
+
+#undef LATENCY_TICK_KEY_NAME
+
+struct TraceTimeline::RingHolder {
+    ~RingHolder()
+    {
+        if (ring != nullptr) {
+            // Hand the ring and the events in it over to the next new thread.
+            ring->owned.store(false, std::memory_order_release);
+        }
+    }
+    std::shared_ptr<Ring> ring;
+};
+
+TraceTimeline &TraceTimeline::Instance()
+{
+    // Never destroyed, threads may still record during process teardown.
+    static TraceTimeline *instance = new TraceTimeline();
+    return *instance;
+}
+
+bool TraceTimeline::IsEnabled()
+{
+    return FLAGS_trace_timeline_sample_rate > 0;
+}
+
+bool TraceTimeline::IsSampled(const char *traceID, size_t len)
+{
+    double rate = FLAGS_trace_timeline_sample_rate;
+    if (rate <= 0 || len == 0) {
+        return false;
+    }
+    if (rate >= 1) {
+        return true;
+    }
+    return HashTraceID(traceID, len) % SAMPLE_SCALE < static_cast<uint64_t>(rate * SAMPLE_SCALE);
+}
+
+TraceTimeline::Ring *TraceTimeline::GetThreadRing()
+{
+    static thread_local RingHolder holder;
+    if (holder.ring != nullptr) {
+        return holder.ring.get();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &ring : rings_) {
+        bool owned = false;
+        if (ring->owned.compare_exchange_strong(owned, true)) {
+            holder.ring = ring;
+            return ring.get();
+        }
+    }
+    holder.ring = std::make_shared<Ring>(std::max<uint32_t>(FLAGS_trace_timeline_ring_size, 1));
+    rings_.emplace_back(holder.ring);
+    return holder.ring.get();
+}
+
+void TraceTimeline::Record(const char *traceID, size_t len, LatencyTickKey key, uint64_t tick)
+{
+    Ring *ring = GetThreadRing();
+    auto pos = ring->head.load(std::memory_order_relaxed);
+    auto &slot = ring->slots[pos % ring->slots.size()];
+    auto seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    len = std::min<size_t>(len, Trace::TRACEID_MAX_SIZE);
+    std::copy_n(traceID, len, slot.event.traceID);
+    slot.event.traceID[len] = '\0';
+    slot.event.key = key;
+    slot.event.tick = tick;
+    slot.event.tid = GetThreadID();
+    slot.seq.store(seq + 2, std::memory_order_release);
+    ring->head.store(pos + 1, std::memory_order_release);
+}
+
+std::vector<TraceTimeline::Event> TraceTimeline::Collect(const std::string &traceID) const
+{
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings = rings_;
+    }
+    auto clearedTick = clearedTick_.load(std::memory_order_acquire);
+    std::vector<Event> events;
+    for (const auto &ring : rings) {
+        auto head = ring->head.load(std::memory_order_acquire);
+        auto capacity = ring->slots.size();
+        for (auto pos = head > capacity ? head - capacity : 0; pos < head; ++pos) {
+            const auto &slot = ring->slots[pos % capacity];
+            auto seq = slot.seq.load(std::memory_order_acquire);
+            if (seq % 2 != 0) {
+                continue;
+            }
+            Event event = slot.event;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != seq || event.tick <= clearedTick) {
+                continue;
+            }
+            if (traceID.empty() || traceID == event.traceID) {
+                events.emplace_back(event);
+            }
+        }
+    }
+    std::sort(events.begin(), events.end(), [](const Event &a, const Event &b) { return a.tick < b.tick; });
+    return events;
+}
+
+std::string TraceTimeline::ExportChromeTrace(const std::string &traceID) const
+{
+    ChromeTraceWriter writer;
+    // The START ticks still waiting for their END tick, per trace id and step.
+    std::map<std::pair<std::string, std::string>, std::vector<Event>> open;
+    for (const auto &event : Collect(traceID)) {
+        std::string name = LatencyTickKeyName(event.key);
+        if (EndsWith(name, START_SUFFIX)) {
+            open[{ event.traceID, name.substr(0, name.size() - START_SUFFIX.size()) }].emplace_back(event);
+            continue;
+        }
+        if (EndsWith(name, END_SUFFIX)) {
+            auto step = name.substr(0, name.size() - END_SUFFIX.size());
+            auto iter = open.find({ event.traceID, step });
+            if (iter != open.end() && !iter->second.empty()) {
+                writer.AddComplete(step, iter->second.back(), event.tick);
+                iter->second.pop_back();
+                continue;
+            }
+        }
+        writer.AddInstant(name, event);
+    }
+    for (const auto &entry : open) {
+        for (const auto &event : entry.second) {
+            writer.AddInstant(LatencyTickKeyName(event.key), event);
+        }
+    }
+    return writer.Finish();
+}
+
+Status TraceTimeline::ExportToFile(const std::string &path, const std::string &traceID) const
+{
+    auto json = ExportChromeTrace(traceID);
+    int fd = -1;
+    RETURN_IF_NOT_OK(OpenFile(path, O_WRONLY | O_CREAT | O_TRUNC, TIMELINE_FILE_MODE, &fd));
+    Status rc = WriteFile(fd, json.data(), json.size(), 0);
+    RETRY_ON_EINTR(close(fd));
+    return rc;
+}
+
+Status TraceTimeline::ExportToConfiguredDir() const
+{
+    std::string dir = FLAGS_trace_timeline_export_dir;
+    if (dir.empty() || !IsEnabled()) {
+        return Status::OK();
+    }
+    return ExportToFile(FormatString("%s/trace_timeline_%d.json", dir, getpid()));
+}
+
+void TraceTimeline::Clear()
+{
+    auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+                   .count();
+    clearedTick_.store(static_cast<uint64_t>(now), std::memory_order_release);
+}
+}  // namespace datasystem
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Sampled request timeline, keeps the latency ticks of a fraction of the requests and exports them in
+ * the Chrome trace event format, which Perfetto and chrome://tracing open.
+ */
+#ifndef DATASYSTEM_COMMON_LOG_TRACE_TIMELINE_H
+#define DATASYSTEM_COMMON_LOG_TRACE_TIMELINE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "datasystem/common/log/trace.h"
+#include "datasystem/utils/status.h"
+
+namespace datasystem {
+/**
+ * @brief Get the name of a latency tick key.
+ * @param[in] key The tick key.
+ * @return Enumerator name, "UNKNOWN" for an unnamed key.
+ */
+const char *LatencyTickKeyName(LatencyTickKey key);
+
+/**
+ * The sampling decision is a hash of the trace id, so the client, the workers and the master all keep the same
+ * requests without passing the decision around. Each thread writes into its own ring, the exporter reads the rings
+ * without stopping the writers and skips the slots being overwritten.
+ */
+class TraceTimeline {
+public:
+    struct Event {
+        char traceID[Trace::TRACEID_MAX_SIZE + 1] = { 0 };
+        LatencyTickKey key = LatencyTickKey::UNKNOWN;
+        uint64_t tick = 0;
+        uint64_t tid = 0;
+    };
+
+    ~TraceTimeline() = default;
+
+    /**
+     * @brief Get the process wide timeline.
+     * @return The timeline.
+     */
+    static TraceTimeline &Instance();
+
+    /**
+     * @brief Whether any request is sampled, the fast check before Record().
+     * @return True if trace_timeline_sample_rate is positive.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Whether the request with the trace id is sampled.
+     * @param[in] traceID The trace id, without the sub trace id.
+     * @param[in] len The length of the trace id.
+     * @return True if the request is kept.
+     */
+    static bool IsSampled(const char *traceID, size_t len);
+
+    /**
+     * @brief Keep a tick of a sampled request in the ring of the calling thread.
+     * @param[in] traceID The trace id, without the sub trace id.
+     * @param[in] len The length of the trace id.
+     * @param[in] key The tick key.
+     * @param[in] tick The steady clock time of the tick in nanoseconds.
+     */
+    void Record(const char *traceID, size_t len, LatencyTickKey key, uint64_t tick);
+
+    /**
+     * @brief Take the events kept in all rings, oldest first.
+     * @param[in] traceID Only the events of this trace id, all if empty.
+     * @return The events.
+     */
+    std::vector<Event> Collect(const std::string &traceID = "") const;
+
+    /**
+     * @brief Export the events in the Chrome trace event format. A START tick and the END tick of the same step make
+     * one complete event, the other ticks are instant events. Timestamps are wall clock microseconds, so the exports
+     * of several processes line up when they are opened together.
+     * @param[in] traceID Only the events of this trace id, all if empty.
+     * @return The json document.
+     */
+    std::string ExportChromeTrace(const std::string &traceID = "") const;
+
+    /**
+     * @brief Write ExportChromeTrace() to a file.
+     * @param[in] path The file path.
+     * @param[in] traceID Only the events of this trace id, all if empty.
+     * @return Status of the call.
+     */
+    Status ExportToFile(const std::string &path, const std::string &traceID = "") const;
+
+    /**
+     * @brief Write all events to trace_timeline_<pid>.json under trace_timeline_export_dir. Clients call this when
+     * they shut down since they have no perf service to export through. A no-op if the timeline is disabled or the
+     * directory is not set.
+     * @return Status of the call.
+     */
+    Status ExportToConfiguredDir() const;
+
+    /**
+     * @brief Drop all kept events, Collect() skips the events before this call.
+     */
+    void Clear();
+
+private:
+    struct Slot {
+        // Odd while the owner thread writes the slot.
+        std::atomic<uint64_t> seq{ 0 };
+        Event event;
+    };
+
+    struct Ring {
+        explicit Ring(size_t capacity) : slots(capacity)
+        {
+        }
+        std::vector<Slot> slots;
+        std::atomic<uint64_t> head{ 0 };
+        std::atomic<bool> owned{ true };
+    };
+
+    struct RingHolder;
+
+    TraceTimeline() = default;
+
+    /**
+     * @brief Get the ring of the calling thread, reuse the ring of an exited thread if any.
+     * @return The ring.
+     */
+    Ring *GetThreadRing();
+
+    mutable std::mutex mutex_;  // Protects rings_.
+    std::vector<std::shared_ptr<Ring>> rings_;
+    std::atomic<uint64_t> clearedTick_{ 0 };
+};
+}  // namespace datasystem
+#endif  // DATASYSTEM_COMMON_LOG_TRACE_TIMELINE_H
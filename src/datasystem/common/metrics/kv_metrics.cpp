@@ -167,6 +167,8 @@ constexpr MetricDesc KV_METRIC_DESCS[] = {
     { 138, "coordinator_watch_notification_inflight_bytes", MetricType::GAUGE, "bytes" },
     { 139, "coordinator_watch_probe_inflight_requests", MetricType::GAUGE, "count" },
     { 140, "coordinator_watch_probe_inflight_bytes", MetricType::GAUGE, "bytes" },
+    { 141, "worker_spill_load_latency", MetricType::HISTOGRAM, "us" },
+    { 142, "worker_spill_batch_load_latency", MetricType::HISTOGRAM, "us" },
 };
 static_assert(sizeof(KV_METRIC_DESCS) / sizeof(KV_METRIC_DESCS[0]) == static_cast<size_t>(KvMetricId::KV_METRIC_END));
 
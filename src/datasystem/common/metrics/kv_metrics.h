@@ -191,6 +191,9 @@ enum class KvMetricId : uint16_t {
     COORDINATOR_WATCH_NOTIFICATION_INFLIGHT_BYTES,
     COORDINATOR_WATCH_PROBE_INFLIGHT_REQUESTS,
     COORDINATOR_WATCH_PROBE_INFLIGHT_BYTES,
+    // One merged read of a batch load from the spill files, and the whole batch load.
+    WORKER_SPILL_LOAD_LATENCY,
+    WORKER_SPILL_BATCH_LOAD_LATENCY,
     KV_METRIC_END
 };
 
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <cctype>
 #include <cstring>
 #include <memory>
 #include <mutex>
@@ -153,6 +154,56 @@ void UpdateMax(std::atomic<uint64_t> &target, uint64_t value)
     }
 }
 
+// Metric names may only hold [a-zA-Z0-9_:].
+std::string OpenMetricsName(const std::string &name)
+{
+    std::string out = "datasystem_" + name;
+    std::replace_if(
+        out.begin(), out.end(), [](char c) { return !std::isalnum(static_cast<unsigned char>(c)) && c != ':'; },
+        '_');
+    return out;
+}
+
+void RenderOpenMetricsSlot(MetricSlot &slot, std::ostringstream &os)
+{
+    auto name = OpenMetricsName(slot.name);
+    if (slot.type == MetricType::COUNTER) {
+        // The _total suffix belongs to the sample, not to the family.
+        const std::string total = "_total";
+        if (name.size() > total.size() && name.compare(name.size() - total.size(), total.size(), total) == 0) {
+            name.resize(name.size() - total.size());
+        }
+        os << "# TYPE " << name << " counter\n"
+           << name << "_total " << slot.u64Value.load(std::memory_order_relaxed) << '\n';
+        return;
+    }
+    if (slot.type == MetricType::GAUGE) {
+        os << "# TYPE " << name << " gauge\n" << name << ' ' << slot.i64Value.load(std::memory_order_relaxed) << '\n';
+        return;
+    }
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    HistBuckets buckets{};
+    {
+        std::lock_guard<std::mutex> histLock(slot.histMutex);
+        count = slot.u64Value.load(std::memory_order_relaxed);
+        sum = slot.sum.load(std::memory_order_relaxed);
+        buckets = slot.histBuckets;
+    }
+    os << "# TYPE " << name << " histogram\n";
+    if (!slot.suffix.empty()) {
+        os << "# HELP " << name << " Unit: " << slot.suffix << '\n';
+    }
+    // The last bucket also takes the values above its bound, so it is reported as +Inf only.
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i + 1 < HIST_BUCKET_NUM; ++i) {
+        cumulative += buckets[i];
+        os << name << "_bucket{le=\"" << HIST_BUCKET_UPPER[i] << "\"} " << cumulative << '\n';
+    }
+    os << name << "_bucket{le=\"+Inf\"} " << count << '\n' << name << "_sum " << sum << '\n'
+       << name << "_count " << count << '\n';
+}
+
 std::string RenderJsonSummary(
     uint64_t cycle, int intervalMs, size_t partIndex, size_t partCount, const std::string &body)
 {
@@ -475,6 +526,19 @@ ScopedTimer::~ScopedTimer()
     GetHistogram(id_).Observe(static_cast<uint64_t>(elapsed.count()));
 }
 
+std::string RenderOpenMetrics()
+{
+    std::lock_guard<std::mutex> lock(g_stateMutex);
+    if (!g_inited.load(std::memory_order_acquire)) {
+        return "";
+    }
+    std::ostringstream os;
+    for (auto id : g_ids) {
+        RenderOpenMetricsSlot(g_slots[id], os);
+    }
+    return os.str();
+}
+
 std::vector<std::string> DumpSummariesForTest(int intervalMs)
 {
     return BuildSummary(intervalMs);
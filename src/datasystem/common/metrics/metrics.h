@@ -114,6 +114,10 @@ private:
     std::chrono::steady_clock::time_point start_;
 };
 
+// Renders the totals of every registered metric in the OpenMetrics text format, without the "# EOF" line.
+// Unlike the summary it keeps no per-interval state, so scrapes do not disturb the periodic log.
+std::string RenderOpenMetrics();
+
 // Returns every metrics_summary line for this tick (same split as LogSummary).
 std::vector<std::string> DumpSummariesForTest(int intervalMs = 10000);
 std::string DumpSummaryForTest(int intervalMs = 10000);
@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Embedded http endpoint which serves the process metrics in the OpenMetrics text format.
+ */
+#include "datasystem/common/metrics/open_metrics_server.h"
+
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <sstream>
+
+#include "datasystem/common/flags/flags.h"
+#include "datasystem/common/log/log.h"
+#include "datasystem/common/metrics/metrics.h"
+#include "datasystem/common/metrics/res_metric_collector.h"
+#include "datasystem/common/perf/perf_manager.h"
+#include "datasystem/common/util/format.h"
+#include "datasystem/common/util/net_util.h"
+#include "datasystem/common/util/status_helper.h"
+#include "datasystem/common/util/strings_util.h"
+
+DS_DEFINE_string(metrics_http_address, "",
+                 "Address (host:port) of the embedded http endpoint which serves the metrics in the OpenMetrics "
+                 "text format on /metrics. Empty to disable.");
+
+namespace datasystem {
+namespace {
+constexpr int POLL_INTERVAL_MS = 200;
+constexpr int LISTEN_BACKLOG = 16;
+constexpr int IO_TIMEOUT_S = 2;
+constexpr size_t MAX_REQUEST_HEADER_SIZE = 8192;
+const std::string METRICS_PATH = "/metrics";
+const std::string CONTENT_TYPE = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+void RenderPerfPoints(std::ostringstream &os)
+{
+    std::vector<std::pair<std::string, PerfInfo>> perfInfoList;
+    PerfManager::Instance()->GetPerfInfoList(perfInfoList);
+    if (perfInfoList.empty()) {
+        return;
+    }
+    os << "# TYPE datasystem_perf_calls counter\n";
+    for (const auto &info : perfInfoList) {
+        os << "datasystem_perf_calls_total{key=\"" << info.first << "\"} " << info.second.count << '\n';
+    }
+    os << "# TYPE datasystem_perf_time_nanoseconds counter\n";
+    for (const auto &info : perfInfoList) {
+        os << "datasystem_perf_time_nanoseconds_total{key=\"" << info.first << "\"} " << info.second.totalTime
+           << '\n';
+    }
+    os << "# TYPE datasystem_perf_max_time_nanoseconds gauge\n";
+    for (const auto &info : perfInfoList) {
+        os << "datasystem_perf_max_time_nanoseconds{key=\"" << info.first << "\"} " << info.second.maxTime << '\n';
+    }
+}
+
+Status SendAll(int fd, const std::string &data)
+{
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        CHECK_FAIL_RETURN_STATUS(n > 0, K_RUNTIME_ERROR, FormatString("Send metrics failed: %s", StrErr(errno)));
+        sent += static_cast<size_t>(n);
+    }
+    return Status::OK();
+}
+
+std::string HttpResponse(const std::string &status, const std::string &contentType, const std::string &body)
+{
+    return FormatString("HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n", status,
+                        contentType, body.size())
+           + body;
+}
+}  // namespace
+
+OpenMetricsServer &OpenMetricsServer::Instance()
+{
+    static OpenMetricsServer instance;
+    return instance;
+}
+
+OpenMetricsServer::~OpenMetricsServer()
+{
+    Stop();
+}
+
+Status OpenMetricsServer::Start()
+{
+    RETURN_OK_IF_TRUE(FLAGS_metrics_http_address.empty() || thread_ != nullptr);
+    HostPort address;
+    RETURN_IF_NOT_OK(address.ParseString(FLAGS_metrics_http_address));
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE | AI_NUMERICSERV;
+    addrinfo *res = nullptr;
+    int ret = getaddrinfo(address.Host().c_str(), std::to_string(address.Port()).c_str(), &hints, &res);
+    CHECK_FAIL_RETURN_STATUS(ret == 0 && res != nullptr, K_INVALID,
+                             FormatString("Resolve metrics_http_address %s failed: %s", FLAGS_metrics_http_address,
+                                          gai_strerror(ret)));
+    std::unique_ptr<addrinfo, decltype(&freeaddrinfo)> resGuard(res, freeaddrinfo);
+    int fd = socket(res->ai_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    CHECK_FAIL_RETURN_STATUS(fd >= 0, K_RUNTIME_ERROR, FormatString("Create metrics socket failed: %s", StrErr(errno)));
+    int one = 1;
+    (void)setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(fd, res->ai_addr, res->ai_addrlen) != 0 || listen(fd, LISTEN_BACKLOG) != 0) {
+        auto err = errno;
+        RETRY_ON_EINTR(close(fd));
+        RETURN_STATUS_LOG_ERROR(K_RUNTIME_ERROR, FormatString("Listen on metrics_http_address %s failed: %s",
+                                                              FLAGS_metrics_http_address, StrErr(err)));
+    }
+    listenFd_ = fd;
+    exitFlag_ = false;
+    thread_ = std::make_unique<Thread>([this]() { Serve(); });
+    thread_->set_name("OpenMetrics");
+    LOG(INFO) << "Serve OpenMetrics on http://" << FLAGS_metrics_http_address << METRICS_PATH;
+    return Status::OK();
+}
+
+void OpenMetricsServer::Stop()
+{
+    exitFlag_ = true;
+    if (thread_ != nullptr) {
+        thread_->join();
+        thread_.reset();
+    }
+    if (listenFd_ >= 0) {
+        RETRY_ON_EINTR(close(listenFd_));
+        listenFd_ = -1;
+    }
+}
+
+void OpenMetricsServer::RegisterSource(std::function<std::string()> source)
+{
+    std::lock_guard<std::mutex> lock(sourcesMutex_);
+    sources_.emplace_back(std::move(source));
+}
+
+std::string OpenMetricsServer::Render() const
+{
+    std::ostringstream os;
+    os << metrics::RenderOpenMetrics() << ResMetricCollector::Instance().RenderOpenMetrics();
+    RenderPerfPoints(os);
+    {
+        std::lock_guard<std::mutex> lock(sourcesMutex_);
+        for (const auto &source : sources_) {
+            os << source();
+        }
+    }
+    os << "# EOF\n";
+    return os.str();
+}
+
+void OpenMetricsServer::Serve()
+{
+    while (!exitFlag_) {
+        pollfd item = { .fd = listenFd_, .events = POLLIN, .revents = 0 };
+        if (poll(&item, 1, POLL_INTERVAL_MS) <= 0) {
+            continue;
+        }
+        int fd = accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0) {
+            continue;
+        }
+        // A scraper which stops talking must not hold the endpoint.
+        timeval timeout{ IO_TIMEOUT_S, 0 };
+        (void)setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        (void)setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        HandleConnection(fd);
+        RETRY_ON_EINTR(close(fd));
+    }
+}
+
+void OpenMetricsServer::HandleConnection(int fd) const
+{
+    std::string request;
+    char buf[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_HEADER_SIZE) {
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return;
+        }
+        request.append(buf, static_cast<size_t>(n));
+    }
+    std::string response;
+    auto lineEnd = request.find("\r\n");
+    std::istringstream requestLine(request.substr(0, lineEnd));
+    std::string method;
+    std::string target;
+    requestLine >> method >> target;
+    if (method != "GET") {
+        response = HttpResponse("405 Method Not Allowed", "text/plain", "");
+    } else if (target != METRICS_PATH && target.rfind(METRICS_PATH + "?", 0) != 0) {
+        response = HttpResponse("404 Not Found", "text/plain", "");
+    } else {
+        response = HttpResponse("200 OK", CONTENT_TYPE, Render());
+    }
+    LOG_IF_ERROR(SendAll(fd, response), "Answer metrics scrape failed");
+}
+}  // namespace datasystem
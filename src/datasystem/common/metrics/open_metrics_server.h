@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Embedded http endpoint which serves the process metrics in the OpenMetrics text format.
+ */
+#ifndef DATASYSTEM_COMMON_METRICS_OPEN_METRICS_SERVER_H
+#define DATASYSTEM_COMMON_METRICS_OPEN_METRICS_SERVER_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "datasystem/common/util/thread.h"
+#include "datasystem/utils/status.h"
+
+namespace datasystem {
+/**
+ * Serves GET /metrics on metrics_http_address. A single thread sleeps in poll() until a scraper connects, and the
+ * page is rendered from the live counters on each scrape, so an idle endpoint costs nothing on the request path.
+ */
+class OpenMetricsServer {
+public:
+    ~OpenMetricsServer();
+
+    /**
+     * @brief Get the process wide endpoint.
+     * @return The endpoint.
+     */
+    static OpenMetricsServer &Instance();
+
+    /**
+     * @brief Listen on metrics_http_address, does nothing if it is empty.
+     * @return Status of the call.
+     */
+    Status Start();
+
+    /**
+     * @brief Stop serving and close the listening socket.
+     */
+    void Stop();
+
+    /**
+     * @brief Add the metrics of a component which are not in the metrics registry.
+     * @param[in] source Returns OpenMetrics text lines, without the "# EOF" line.
+     */
+    void RegisterSource(std::function<std::string()> source);
+
+    /**
+     * @brief Render the registry, the resource snapshot, the perf points and the registered sources.
+     * @return The OpenMetrics document.
+     */
+    std::string Render() const;
+
+private:
+    OpenMetricsServer() = default;
+
+    /**
+     * @brief Accept and answer the scrapes until Stop().
+     */
+    void Serve();
+
+    /**
+     * @brief Answer one http request.
+     * @param[in] fd The accepted connection.
+     */
+    void HandleConnection(int fd) const;
+
+    int listenFd_ = -1;
+    std::atomic<bool> exitFlag_{ false };
+    std::unique_ptr<Thread> thread_{ nullptr };
+    mutable std::mutex sourcesMutex_;  // Protects sources_.
+    std::vector<std::function<std::string()>> sources_;
+};
+}  // namespace datasystem
+#endif  // DATASYSTEM_COMMON_METRICS_OPEN_METRICS_SERVER_H
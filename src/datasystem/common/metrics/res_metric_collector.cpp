@@ -19,7 +19,9 @@
  */
 
 #include "datasystem/common/metrics/res_metric_collector.h"
+#include <cctype>
 #include <chrono>
+#include <cstdlib>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
@@ -186,6 +188,10 @@ void ResMetricCollector::CollectMetrics()
                     std::string jsonLine = BuildResourceJson(handlerResults, timestamp);
                     jsonExporter_->WriteJsonLine(jsonLine);
                 }
+                {
+                    std::lock_guard<std::mutex> lock(lastResultsMutex_);
+                    lastResults_ = std::move(handlerResults);
+                }
             }
             INJECT_POINT("worker.CollectMetrics", [this](int interval) { msInterval_ = interval; });
             auto waitTimeMs = 100;
@@ -220,6 +226,42 @@ std::string ResMetricCollector::BuildResourceJson(const std::vector<std::string>
     return WrapJsonWithPodCluster(os.str(), jsonExporter_->PodName(), jsonExporter_->ClusterName(), timestamp);
 }
 
+std::string ResMetricCollector::RenderOpenMetrics() const
+{
+    std::vector<std::string> results;
+    {
+        std::lock_guard<std::mutex> lock(lastResultsMutex_);
+        results = lastResults_;
+    }
+    std::ostringstream os;
+    std::vector<std::string> tokens;
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto &desc = GetResourceFieldDesc(static_cast<ResMetricName>(i));
+        if (!desc.recordGroup || results[i].empty()) {
+            continue;
+        }
+        tokens.clear();
+        SplitResourceFields(results[i], desc.sep, tokens);
+        if (tokens.size() != desc.fieldNames.size()) {
+            continue;
+        }
+        for (size_t k = 0; k < tokens.size(); ++k) {
+            // Keep the handler text as the value, it is already a plain decimal number.
+            char *end = nullptr;
+            (void)std::strtod(tokens[k].c_str(), &end);
+            if (!desc.recordMask[k] || end == tokens[k].c_str() || *end != '\0' || !std::isdigit(tokens[k].back())) {
+                continue;
+            }
+            std::string name = std::string("datasystem_resource_") + desc.groupName;
+            if (desc.fieldNames.size() > 1 || name.find(desc.fieldNames[k]) == std::string::npos) {
+                name = name + "_" + desc.fieldNames[k];
+            }
+            os << "# TYPE " << name << " gauge\n" << name << ' ' << tokens[k] << '\n';
+        }
+    }
+    return os.str();
+}
+
 void ResMetricCollector::RegisterCollectHandler(ResMetricName metricName, std::function<std::string()> collectHandler)
 {
     if (exporter_ == nullptr && jsonExporter_ == nullptr) {
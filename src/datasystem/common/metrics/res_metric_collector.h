@@ -22,6 +22,7 @@
 #define DATASYSTEM_COMMON_METRICS_RES_METRICS_COLLECTOR_H
 
 #include <atomic>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 #include <functional>
@@ -83,6 +84,13 @@ public:
      */
     void Stop();
 
+    /**
+     * @brief Render the numeric fields of the last collected resource groups as OpenMetrics gauges. The handlers are
+     * not called here, some of them reset interval counters.
+     * @return The OpenMetrics text, empty before the first collection.
+     */
+    std::string RenderOpenMetrics() const;
+
 private:
     /**
      * @brief Start logging Res message in the thread.
@@ -104,6 +112,8 @@ private:
     std::unique_ptr<Thread> collectorThread_{ nullptr };
     std::unordered_map<int, std::function<std::string()>> collectHandler_;
     bool isInit_ = false;
+    mutable std::mutex lastResultsMutex_;  // Protects lastResults_.
+    std::vector<std::string> lastResults_;
 };
 }  // namespace datasystem
 #endif  // DATASYSTEM_COMMON_METRICS_RES_METRICS_COLLECTOR_H
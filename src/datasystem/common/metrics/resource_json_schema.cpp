@@ -81,6 +81,8 @@ const std::array<ResourceFieldDesc, DESC_COUNT> DESC_TABLE = {
         "current_hour_spill_evict_count", "current_hour_spill_evict_bytes" },
         { true, true, true, true, true, true, true, true, true, true, true, true, true, true },
         '/', true, "spill_io_stats" },
+    ResourceFieldDesc{ { "huge_page_size", "huge_tlb_bytes", "thp_bytes", "coverage_rate" },
+        { true, true, true, true }, '/', true, "shared_memory_huge_page" },
 };
 
 const ResourceFieldDesc NULL_DESC{ {}, {}, '\0', false, "" };
@@ -166,6 +166,12 @@ public:
         return false;
     }
 
+    void SetPayloadDirectThreshold(int64_t threshold)
+    {
+        // The payload comes in the response attachment.
+        (void)threshold;
+    }
+
 private:
     Status DoRead(R &pb)
     {
@@ -214,6 +214,11 @@ ThreadPool::ThreadPoolUsage RpcServer::GetRpcServicesSnapshot(const std::string
     return std::visit([&serviceName](auto &pimpl) { return pimpl->GetRpcServicesSnapshot(serviceName); }, pimpl_);
 }
 
+std::vector<uint64_t> RpcServer::GetFrontendShardRequests() const
+{
+    return std::visit([](auto &pimpl) { return pimpl->GetFrontendShardRequests(); }, pimpl_);
+}
+
 Status RpcServer::Builder::Init(std::unique_ptr<RpcServer> &server) const
 {
     auto key = Token();
@@ -298,6 +298,12 @@ public:
 
     ThreadPool::ThreadPoolUsage GetRpcServicesSnapshot(const std::string &serviceName) const;
 
+    /**
+     * @brief Get the number of rpc requests each frontend shard has received.
+     * @return The counts indexed by shard.
+     */
+    std::vector<uint64_t> GetFrontendShardRequests() const;
+
 private:
     friend class RpcServer::Builder;
 
@@ -105,6 +105,16 @@ public:
         return std::visit([](auto &pimpl) { return pimpl->IsV2Client(); }, pimpl_);
     }
 
+    /**
+     * @brief Ask the server to park reply payloads larger than the threshold, so they can be received directly into
+     * user provided memory with ReceivePayload(dest, sz). Must be called before Write().
+     * @param[in] threshold Payload size in bytes, 0 leaves it to the server.
+     */
+    void SetPayloadDirectThreshold(int64_t threshold)
+    {
+        std::visit([threshold](auto &pimpl) { pimpl->SetPayloadDirectThreshold(threshold); }, pimpl_);
+    }
+
 private:
     std::variant<std::unique_ptr<ClientUnaryWriterReaderImpl<W, R>>,
                  std::unique_ptr<BrpcClientUnaryWriterReader<W, R>>> pimpl_;
@@ -20,11 +20,16 @@
 #include "datasystem/common/rpc/unix_sock_fd.h"
 
 #include <algorithm>
+#include <linux/errqueue.h>
 #include <netdb.h>
 #include <netinet/tcp.h>
 #include <poll.h>
-#include <sys/types.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <mutex>
+#include <unordered_map>
 #include <google/protobuf/descriptor.h>
 #include "datasystem/common/flags/flags.h"
 #include "datasystem/common/rpc/rpc_channel.h"
@@ -170,6 +175,181 @@ Status UnixSockFd::SendNoTimeout(MemView &buf) const
     return Status::OK();
 }
 
+namespace {
+// Zero copy bookkeeping of a socket. The kernel numbers the MSG_ZEROCOPY sends of a socket from 0 and reports their
+// completions as ranges of these numbers on the error queue.
+struct ZeroCopyState {
+    ino_t inode = 0;
+    bool enabled = false;
+    uint32_t nextSeq = 0;
+    // The last sequence number of each buffer in flight, with the reference that keeps the buffer alive.
+    std::deque<std::pair<uint32_t, std::shared_ptr<void>>> pending;
+};
+
+struct ZeroCopyStates {
+    std::mutex mutex;
+    std::unordered_map<int, ZeroCopyState> states;
+};
+
+ZeroCopyStates &GetZeroCopyStates()
+{
+    static ZeroCopyStates zeroCopyStates;
+    return zeroCopyStates;
+}
+}  // namespace
+
+void UnixSockFd::Close()
+{
+    if (IsValid()) {
+        DropZeroCopyState(fd_);
+        shutdown(fd_, SHUT_RDWR);
+        RETRY_ON_EINTR(close(fd_));
+        fd_ = RPC_NO_FILE_FD;
+    }
+}
+
+bool UnixSockFd::EnableZeroCopy() const
+{
+    struct stat st {};
+    if (fstat(fd_, &st) != 0) {
+        return false;
+    }
+    auto &zeroCopyStates = GetZeroCopyStates();
+    ZeroCopyState stale;
+    std::lock_guard<std::mutex> lock(zeroCopyStates.mutex);
+    auto &state = zeroCopyStates.states[fd_];
+    if (state.inode != st.st_ino) {
+        // First zero copy send on this socket, the fd number may have belonged to a closed socket before.
+        stale = std::move(state);
+        state = ZeroCopyState();
+        state.inode = st.st_ino;
+        int one = 1;
+        // Unix domain sockets and old kernels reject SO_ZEROCOPY.
+        state.enabled = setsockopt(fd_, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == 0;
+    }
+    return state.enabled;
+}
+
+void UnixSockFd::DropZeroCopyState(int fd)
+{
+    ZeroCopyState dropped;
+    auto &zeroCopyStates = GetZeroCopyStates();
+    std::lock_guard<std::mutex> lock(zeroCopyStates.mutex);
+    auto it = zeroCopyStates.states.find(fd);
+    if (it != zeroCopyStates.states.end()) {
+        dropped = std::move(it->second);
+        zeroCopyStates.states.erase(it);
+    }
+}
+
+Status UnixSockFd::SendZeroCopy(MemView &buf, std::shared_ptr<void> keepAlive) const
+{
+    if (timeoutEnabled_ || !EnableZeroCopy()) {
+        return Send(buf);
+    }
+    PerfPoint point(PerfKey::ZMQ_SOCKET_FD_SEND);
+    Status rc;
+    uint32_t numSends = 0;
+    auto sizeRemain = static_cast<ssize_t>(buf.Size());
+    while (sizeRemain > 0) {
+        ssize_t bytesSend;
+        RW_RETRY_ON_EINTR(bytesSend, send(fd_, buf.Data(), buf.Size(), MSG_NOSIGNAL | MSG_ZEROCOPY));
+        if (bytesSend == -1) {
+            if (errno == ENOBUFS) {
+                // Out of pinned page budget, copy the rest.
+                rc = SendNoTimeout(buf);
+                break;
+            }
+            rc = ErrnoToStatus(errno, fd_);
+            if (rc.GetCode() == K_TRY_AGAIN) {
+                rc = Poll(POLLOUT, RPC_POLL_TIME);
+            }
+            if (rc.IsOk() || rc.GetCode() == K_TRY_AGAIN) {
+                continue;
+            }
+            break;
+        }
+        ++numSends;
+        buf += bytesSend;
+        sizeRemain -= bytesSend;
+    }
+    if (numSends > 0) {
+        // The pages stay pinned until the completions come back, even if the send failed half way, so the buffer is
+        // kept until then instead of waiting for them here.
+        auto &zeroCopyStates = GetZeroCopyStates();
+        std::lock_guard<std::mutex> lock(zeroCopyStates.mutex);
+        auto &state = zeroCopyStates.states[fd_];
+        state.nextSeq += numSends;
+        state.pending.emplace_back(state.nextSeq - 1, std::move(keepAlive));
+    }
+    // Release the buffers of the earlier sends that are done by now.
+    (void)ReapZeroCopyCompletions();
+    if (rc.IsError()) {
+        VLOG(RPC_KEY_LOG_LEVEL) << "zero copy send failed with rc: " << rc.ToString();
+        return rc;
+    }
+    point.Record();
+    return Status::OK();
+}
+
+bool UnixSockFd::ReapZeroCopyCompletions() const
+{
+    struct stat st {};
+    if (fstat(fd_, &st) != 0) {
+        return false;
+    }
+    std::vector<std::shared_ptr<void>> released;
+    auto &zeroCopyStates = GetZeroCopyStates();
+    {
+        std::lock_guard<std::mutex> lock(zeroCopyStates.mutex);
+        auto it = zeroCopyStates.states.find(fd_);
+        if (it == zeroCopyStates.states.end() || !it->second.enabled || it->second.inode != st.st_ino) {
+            return false;
+        }
+        auto &state = it->second;
+        while (true) {
+            char control[CMSG_SPACE(sizeof(sock_extended_err)) * 2];
+            msghdr msg{};
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+            // Never blocks, an empty error queue is EAGAIN.
+            if (recvmsg(fd_, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) == -1) {
+                break;
+            }
+            for (cmsghdr *cm = CMSG_FIRSTHDR(&msg); cm != nullptr; cm = CMSG_NXTHDR(&msg, cm)) {
+                bool isRecvErr = (cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR)
+                                 || (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR);
+                if (!isRecvErr) {
+                    continue;
+                }
+                auto *err = reinterpret_cast<sock_extended_err *>(CMSG_DATA(cm));
+                if (err->ee_errno != 0 || err->ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+                    continue;
+                }
+                // Tcp completes the sends in order, ee_data is the last one of the range.
+                while (!state.pending.empty()
+                       && static_cast<int32_t>(err->ee_data - state.pending.front().first) >= 0) {
+                    released.emplace_back(std::move(state.pending.front().second));
+                    state.pending.pop_front();
+                }
+            }
+        }
+    }
+    // A zero copy socket raises EPOLLERR for the completions alone, a real error is left in SO_ERROR.
+    int sockErr = 0;
+    socklen_t len = sizeof(sockErr);
+    return getsockopt(fd_, SOL_SOCKET, SO_ERROR, &sockErr, &len) == 0 && sockErr == 0;
+}
+
+bool UnixSockFd::FilterZeroCopyEvents(uint32_t &events) const
+{
+    if ((events & EPOLLERR) == 0 || (events & (EPOLLHUP | EPOLLRDHUP)) != 0 || !ReapZeroCopyCompletions()) {
+        return false;
+    }
+    events &= ~static_cast<uint32_t>(EPOLLERR);
+    return true;
+}
+
 Status UnixSockFd::Recv32(uint32_t &out, bool blocking) const
 {
     PerfPoint point(PerfKey::ZMQ_SOCKET_FD_RECV_32);
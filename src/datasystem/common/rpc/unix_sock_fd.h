@@ -75,14 +75,7 @@ public:
     /**
      * @brief Shutdown read and write capabilities of fd.
      */
-    void Close()
-    {
-        if (IsValid()) {
-            shutdown(fd_, SHUT_RDWR);
-            RETRY_ON_EINTR(close(fd_));
-            fd_ = RPC_NO_FILE_FD;
-        }
-    }
+    void Close();
 
     /**
      * @brief Receive a raw buffer.
@@ -100,6 +93,32 @@ public:
      */
     Status Send(MemView &buf) const;
 
+    /**
+     * @brief Send a raw buffer with MSG_ZEROCOPY, the kernel pins the pages instead of copying them. Returns once the
+     * data is queued, keepAlive holds the buffer until the kernel reports the completion, which is reaped by the later
+     * zero copy sends and by ReapZeroCopyCompletions(). SO_ZEROCOPY is enabled on the first call for the socket. Falls
+     * back to Send() if the socket does not support it.
+     * @param[in] buf Zmq immutable buffer.
+     * @param[in] keepAlive The owner of the buffer.
+     * @return Status of call.
+     */
+    Status SendZeroCopy(MemView &buf, std::shared_ptr<void> keepAlive) const;
+
+    /**
+     * @brief Release the buffers of the zero copy sends the kernel has completed, without waiting. The pending
+     * completions raise EPOLLERR on the socket, so the event loops call it before taking EPOLLERR for a failure.
+     * @return True if the socket sends with zero copy and has no error of its own.
+     */
+    bool ReapZeroCopyCompletions() const;
+
+    /**
+     * @brief Drop EPOLLERR from the epoll events of the socket if it only tells about zero copy completions, which
+     * are reaped then.
+     * @param[in,out] events The epoll events.
+     * @return True if EPOLLERR was dropped.
+     */
+    bool FilterZeroCopyEvents(uint32_t &events) const;
+
     /**
      * Receive a 32 bit integer.
      * @param[in] blocking. For non-blocking fd, force non-blocking if true.
@@ -399,6 +418,18 @@ private:
      */
     Status SendWithTimeout(MemView &buf) const;
 
+    /**
+     * @brief Turn on SO_ZEROCOPY the first time a socket sends with zero copy.
+     * @return True if the socket supports it.
+     */
+    bool EnableZeroCopy() const;
+
+    /**
+     * @brief Forget the zero copy sends of a socket being closed and release their buffers.
+     * @param[in] fd The socket descriptor.
+     */
+    static void DropZeroCopyState(int fd);
+
     /**
      * @brief Compute how much time has elapsed and the determine if the timeout has been exceeded.
      * @param[in] startTime The start time to compare with
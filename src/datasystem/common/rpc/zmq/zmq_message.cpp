@@ -49,6 +49,7 @@ ZmqMessage::~ZmqMessage()
 Status ZmqMessage::AllocMem(size_t size)
 {
     int rc = zmq_msg_init_size(&msg_, size);
+    borrowed_ = false;
     CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
         rc == 0, K_RUNTIME_ERROR, FormatString("Unable to create msg_t of size %zu: %s", size, zmq_strerror(errno)));
     return Status::OK();
@@ -57,6 +58,7 @@ Status ZmqMessage::AllocMem(size_t size)
 Status ZmqMessage::TransferOwnership(void *data, size_t size, zmq_free_fn *ffn, void *hint)
 {
     int rc = zmq_msg_init_data(&msg_, data, size, ffn, hint);
+    borrowed_ = ffn == nullptr;
     CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(rc == 0, K_RUNTIME_ERROR,
                                          FormatString("Unable to create msg_t: %s", zmq_strerror(errno)));
     return Status::OK();
@@ -76,6 +78,7 @@ Status ZmqMessage::CopyBuffer(const void *data, size_t size)
 Status ZmqMessage::Move(ZmqMessage &src)
 {
     int rc = zmq_msg_move(&msg_, &src.msg_);
+    borrowed_ = src.borrowed_;
     CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(rc == 0, K_RUNTIME_ERROR,
                                          FormatString("Unable to move into msg_t: %s", zmq_strerror(errno)));
     return Status::OK();
@@ -84,6 +87,7 @@ Status ZmqMessage::Move(ZmqMessage &src)
 Status ZmqMessage::Copy(ZmqMessage &src)
 {
     int rc = zmq_msg_copy(&msg_, &src.msg_);
+    borrowed_ = src.borrowed_;
     CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(rc == 0, K_RUNTIME_ERROR,
                                          FormatString("Unable to copy into msg_t: %s", zmq_strerror(errno)));
     return Status::OK();
@@ -39,8 +39,9 @@ public:
     ZmqMessage(const ZmqMessage &rhs) = delete;
     ZmqMessage &operator=(const ZmqMessage &rhs) = delete;
     // Move constructors
-    ZmqMessage(ZmqMessage &&rhs) noexcept : flag_(rhs.flag_), msg_(rhs.msg_)
+    ZmqMessage(ZmqMessage &&rhs) noexcept : flag_(rhs.flag_), msg_(rhs.msg_), borrowed_(rhs.borrowed_)
     {
+        rhs.borrowed_ = false;
         int rc = zmq_msg_init(&rhs.msg_);
         if (rc != 0) {
             std::terminate();
@@ -52,6 +53,7 @@ public:
         if (this != &rhs) {
             std::swap(flag_, rhs.flag_);
             std::swap(msg_, rhs.msg_);
+            std::swap(borrowed_, rhs.borrowed_);
         }
         return *this;
     }
@@ -188,9 +190,19 @@ public:
         return flag_;
     }
 
+    /**
+     * @brief Tell whether a copy of the message keeps its data alive, which is not the case for a ZeroCopyBuffer().
+     * @return True if the message owns its data.
+     */
+    bool OwnsData() const
+    {
+        return !borrowed_;
+    }
+
 private:
     ZmqMsgType flag_;
     zmq_msg_t msg_{};
+    bool borrowed_{ false };
     Status Close();
     std::string DebugString() const;
 };
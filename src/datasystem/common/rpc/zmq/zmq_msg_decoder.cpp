@@ -24,6 +24,7 @@
 #include <map>
 
 #include "datasystem/common/rpc/zmq/zmq_msg_decoder.h"
+#include "datasystem/common/flags/common_flags.h"
 #include "datasystem/common/util/raii.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/common/util/strings_util.h"
@@ -497,7 +498,7 @@ ZmqMsgDecoder::~ZmqMsgDecoder()
 {
 }
 
-Status ZmqMsgEncoder::SendMessage(const ZmqMessage &msg, bool more) const
+Status ZmqMsgEncoder::SendMessage(ZmqMessage &msg, bool more) const
 {
     struct {
         uint8_t flag_;
@@ -525,6 +526,13 @@ Status ZmqMsgEncoder::SendMessage(const ZmqMessage &msg, bool more) const
     RETURN_IF_NOT_OK(pSockFd_->Send(buf));
     if (sz > 0) {
         buf = MemView(msg.Data(), sz);
+        if (FLAGS_zerocopy_send_threshold > 0 && static_cast<int64_t>(sz) >= FLAGS_zerocopy_send_threshold
+            && msg.OwnsData()) {
+            // The kernel reads the frame after the send returns, a reference to it is kept until the completion.
+            auto keepAlive = std::make_shared<ZmqMessage>();
+            RETURN_IF_NOT_OK(keepAlive->Copy(msg));
+            return pSockFd_->SendZeroCopy(buf, std::move(keepAlive));
+        }
         RETURN_IF_NOT_OK(pSockFd_->Send(buf));
     }
     return Status::OK();
@@ -224,7 +224,7 @@ private:
      */
     Status SendMsgFramesV2(ZmqMsgFrames &que);
 
-    Status SendMessage(const ZmqMessage &msg, bool more) const;
+    Status SendMessage(ZmqMessage &msg, bool more) const;
 };
 }  // namespace datasystem
 
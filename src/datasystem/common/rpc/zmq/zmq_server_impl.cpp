@@ -41,9 +41,26 @@
 DS_DEFINE_int32(zmq_server_io_context, 5,
                 "Optimize the performance of the customer. Default server 5. "
                 "The higher the throughput, the higher the value, but should be in range [1, 32]");
+DS_DEFINE_int32(zmq_server_frontend_shards, 1,
+                "Number of ROUTER sockets (each with its own proxy thread) the rpc server spreads the tcp clients "
+                "over. The extra shards listen on ephemeral ports which the clients learn from the heartbeat reply "
+                "and connect to on the server host, so keep 1 behind NAT or k8s port mapping. "
+                "Should be in range [1, 32]");
 DS_DECLARE_bool(enable_curve_zmq);
 
 namespace {
+static bool ValidateZmqServerFrontendShards(const char *flagname, int32_t value)
+{
+    (void)flagname;
+    const int32_t minValue = 1;
+    const int32_t maxValue = 32;
+    if ((value < minValue) || (value > maxValue)) {
+        LOG(ERROR) << "The server frontend shard number must be between " << minValue << " and " << maxValue << ".";
+        return false;
+    }
+    return true;
+}
+
 static bool ValidateZmqServerIoCtxThreads(const char *flagname, int32_t value)
 {
     (void)flagname;
@@ -57,6 +74,7 @@ static bool ValidateZmqServerIoCtxThreads(const char *flagname, int32_t value)
 }
 }  // namespace
 DS_DEFINE_validator(zmq_server_io_context, &ValidateZmqServerIoCtxThreads);
+DS_DEFINE_validator(zmq_server_frontend_shards, &ValidateZmqServerFrontendShards);
 
 namespace datasystem {
 
@@ -78,18 +96,21 @@ void ZmqServerImpl::Shutdown()
     if (ses_) {
         ses_->Stop();
     }
-    if (thrd_) {
-        LOG(WARNING) << "RPC Server shutdown in progress ...";
+    for (auto &shard : shards_) {
+        if (!shard->thrd) {
+            continue;
+        }
+        LOG(WARNING) << "RPC Server shutdown in progress ... frontend shard " << shard->index;
         try {
-            auto status = thrd_->get();
+            auto status = shard->thrd->get();
             if (status.IsError()) {
                 LOG(ERROR) << status.ToString();
             }
         } catch (const std::exception &e) {
             LOG(ERROR) << e.what();
         }
-        thrd_.reset();
-        VLOG(RPC_KEY_LOG_LEVEL) << "RPC Server shutdown successfully.";
+        shard->thrd.reset();
+        VLOG(RPC_KEY_LOG_LEVEL) << "RPC Server shutdown successfully. frontend shard " << shard->index;
     }
     // The followings are set up in the constructor.
     if (sfd_ > 0) {
@@ -98,10 +119,17 @@ void ZmqServerImpl::Shutdown()
     }
     // We must close all the ZMQ sockets. Otherwise, ZMQ context will hang on shutdown.
     // Same for the thread doing proxy work. It needs the context.
-    if (frontend_) {
-        frontend_->Close();
-        frontend_.reset();
+    for (auto &shard : shards_) {
+        if (shard->frontend) {
+            shard->frontend->Close();
+            shard->frontend.reset();
+        }
+        if (shard->replyFd > 0) {
+            RETRY_ON_EINTR(close(shard->replyFd));
+            shard->replyFd = ZMQ_NO_FILE_FD;
+        }
     }
+    shards_.clear();
     if (poller_) {
         poller_.reset();
     }
@@ -159,28 +187,30 @@ Status ParseMsgFrames(ZmqMsgFrames &frames, MetaPb &meta, int fd, const EventTyp
     return Status::OK();
 }
 
-Status ZmqServerImpl::ServiceToClient(const MetaPb &meta, ZmqMsgFrames &&frames)
+Status ZmqServerImpl::ServiceToClient(FrontendShard &shard, const MetaPb &meta, ZmqMsgFrames &&frames)
 {
     RETURN_IF_NOT_OK(PushFrontProtobufToFrames(meta, frames));
     RETURN_IF_NOT_OK(PushFrontStringToFrames(meta.client_id(), frames));
     RETURN_IF_NOT_OK(PushFrontStringToFrames(meta.gateway_id(), frames));
     VLOG(RPC_LOG_LEVEL) << FormatString("Sending reply back to gateway %s for client %s service '%s' method %d",
                                         meta.gateway_id(), meta.client_id(), meta.svc_name(), meta.method_index());
-    return frontend_->SendAllFrames(frames);
+    return shard.frontend->SendAllFrames(frames);
 }
 
-Status ZmqServerImpl::SendErrorToClient(const MetaPb &meta, const Status &status)
+Status ZmqServerImpl::SendErrorToClient(FrontendShard &shard, const MetaPb &meta, const Status &status)
 {
     ZmqMsgFrames reply;
     reply.push_back(StatusToZmqMessage(status));
-    return ServiceToClient(meta, std::move(reply));
+    return ServiceToClient(shard, meta, std::move(reply));
 }
 
-Status ZmqServerImpl::ClientToService(ZmqMsgFrames &&frames)
+Status ZmqServerImpl::ClientToService(FrontendShard &shard, ZmqMsgFrames &&frames)
 {
     MetaPb meta;
     ZmqCurveUserId userId = { .checkUserId_ = FLAGS_enable_curve_zmq };
-    Status rc = ParseMsgFrames(frames, meta, ffd_, EventType::ZMQ, userId, PerfKey::ZMQ_NETWORK_TRANSFER_SERVER_TCP);
+    // The frontend event fd tells on which shard the reply goes out.
+    Status rc =
+        ParseMsgFrames(frames, meta, shard.ffd, EventType::ZMQ, userId, PerfKey::ZMQ_NETWORK_TRANSFER_SERVER_TCP);
     if (rc.IsError()) {
         // Silently (no logging) ignore K_TRY_AGAIN because stub will probe us with an empty message
         // on first connection.
@@ -192,11 +222,15 @@ Status ZmqServerImpl::ClientToService(ZmqMsgFrames &&frames)
     if (meta.method_index() == ZMQ_HEARTBEAT_METHOD) {
         VLOG(RPC_LOG_LEVEL) << "Heartbeat";
         // Just send back anything. But we will send back the meta which
-        // records the time when we receive it.
+        // records the time when we receive it, and the ports of the other shards for the client to connect to.
+        for (auto port : shardPorts_) {
+            meta.add_frontend_shard_ports(port);
+        }
         ZmqMsgFrames reply;
         RETURN_IF_NOT_OK(PushBackProtobufToFrames(meta, reply));
-        return ServiceToClient(meta, std::move(reply));
+        return ServiceToClient(shard, meta, std::move(reply));
     }
+    shard.requests.fetch_add(1, std::memory_order_relaxed);
     ZmqService *svc = nullptr;
     auto it = svcMap_.find(meta.svc_name());
     if (it == svcMap_.end()) {
@@ -207,7 +241,7 @@ Status ZmqServerImpl::ClientToService(ZmqMsgFrames &&frames)
         Status err = Status(meta.method_index() < 0 ? StatusCode::K_NOT_FOUND : StatusCode::K_RUNTIME_ERROR,
                             FormatString("Service not found, svc_name: %s, method_index: %d", meta.svc_name(),
                                          meta.method_index()));
-        RETURN_IF_NOT_OK(SendErrorToClient(meta, err));
+        RETURN_IF_NOT_OK(SendErrorToClient(shard, meta, err));
         return err;
     }
     if (userId.checkUserId_) {
@@ -219,7 +253,7 @@ Status ZmqServerImpl::ClientToService(ZmqMsgFrames &&frames)
                 FormatString("Trust list authentication failed. Access to service %s is not allowed.", meta.svc_name());
             Status temp = Status(K_INVALID, msg);
             LOG(ERROR) << temp.ToString();
-            return SendErrorToClient(meta, temp);
+            return SendErrorToClient(shard, meta, temp);
         }
     }
     svc = it->second;
@@ -238,15 +272,49 @@ Status ZmqServerImpl::ProcessReply(ZmqService *svc)
     PerfPoint::RecordElapsed(PerfKey::ZMQ_SVC_TO_ROUTER, GetLapTime(meta, "ZMQ_SVC_TO_ROUTER"));
     RecordTick(meta, TICK_SERVER_SEND);
     RecordServerLatencyMetrics(meta);
-    return ServiceToClient(meta, std::move(frames));
+    return ServiceToClient(*shards_.front(), meta, std::move(frames));
+}
+
+Status ZmqServerImpl::PostReplyToShard(ZmqMetaMsgFrames &p, bool &posted)
+{
+    posted = false;
+    const int fd = p.first.route_fd();
+    for (size_t i = 1; i < shards_.size(); ++i) {
+        auto &shard = *shards_[i];
+        if (shard.ffd != fd) {
+            continue;
+        }
+        RETURN_IF_NOT_OK(shard.replyQueue->Put(std::move(p)));
+        eventfd_write(shard.replyFd, 1);
+        posted = true;
+        break;
+    }
+    return Status::OK();
 }
 
-Status ZmqServerImpl::ZmqFrontendToSvc()
+Status ZmqServerImpl::ProcessShardReplies(FrontendShard &shard)
+{
+    eventfd_t n = 0;
+    eventfd_read(shard.replyFd, &n);
+    for (; n > 0; --n) {
+        ZmqMetaMsgFrames p;
+        RETURN_IF_NOT_OK(shard.replyQueue->Remove(&p));
+        MetaPb &meta = p.first;
+        PerfPoint::RecordElapsed(PerfKey::ZMQ_SVC_TO_ROUTER, GetLapTime(meta, "ZMQ_SVC_TO_ROUTER"));
+        RecordTick(meta, TICK_SERVER_SEND);
+        RecordServerLatencyMetrics(meta);
+        LOG_IF_ERROR(ServiceToClient(shard, meta, std::move(p.second)),
+                     FormatString("Error in routing for frontend shard %d", shard.index));
+    }
+    return Status::OK();
+}
+
+Status ZmqServerImpl::ZmqFrontendToSvc(FrontendShard &shard)
 {
     Status rc;
     ZmqMsgFrames frames;
-    if (frontend_->GetAllFrames(frames, ZmqRecvFlags::DONTWAIT).IsOk()) {
-        rc = ClientToService(std::move(frames));
+    if (shard.frontend->GetAllFrames(frames, ZmqRecvFlags::DONTWAIT).IsOk()) {
+        rc = ClientToService(shard, std::move(frames));
         if (rc.IsError()) {
             VLOG(RPC_LOG_LEVEL) << "Info only. rc from last rpc " << rc.ToString();
         }
@@ -259,9 +327,10 @@ Status ZmqServerImpl::StartProxy()
     static const int K_FRONTEND = 0;
     static const int K_INTERRUPT = 1;
     static const int K_MIN_SZ = 2;
+    auto &shard = *shards_.front();
     auto items = std::make_unique<pollfd[]>(zmqfds_.size() + K_MIN_SZ);
     int idx = K_FRONTEND;
-    items[idx++] = { .fd = ffd_, .events = POLLIN, .revents = 0 };
+    items[idx++] = { .fd = shard.ffd, .events = POLLIN, .revents = 0 };
     items[idx++] = { .fd = sfd_, .events = POLLIN, .revents = 0 };
     for (auto &ele : zmqfds_) {
         items[idx++] = { .fd = ele.first, .events = POLLIN, .revents = 0 };
@@ -286,9 +355,9 @@ Status ZmqServerImpl::StartProxy()
         METRIC_TIMER(metrics::KvMetricId::ZMQ_SERVER_POLL_HANDLE_LATENCY);
         // revents from poll doesn't work correctly with ZMQ socket event fd.
         // We need to check the state
-        unsigned int events = static_cast<unsigned int>(frontend_->GetEvents());
+        unsigned int events = static_cast<unsigned int>(shard.frontend->GetEvents());
         if (events & ZMQ_POLLIN) {
-            LOG_IF_ERROR(ZmqFrontendToSvc(), "Error in ZmqFrontendToSvc");
+            LOG_IF_ERROR(ZmqFrontendToSvc(shard), "Error in ZmqFrontendToSvc");
             timeout = 0;
         }
 
@@ -308,6 +377,39 @@ Status ZmqServerImpl::StartProxy()
     return Status::OK();
 }
 
+Status ZmqServerImpl::StartShardProxy(FrontendShard &shard)
+{
+    static const int K_FRONTEND = 0;
+    static const int K_INTERRUPT = 1;
+    static const int K_REPLY = 2;
+    static const int K_SIZE = 3;
+    pollfd items[K_SIZE] = { { .fd = shard.ffd, .events = POLLIN, .revents = 0 },
+                             { .fd = sfd_, .events = POLLIN, .revents = 0 },
+                             { .fd = shard.replyFd, .events = POLLIN, .revents = 0 } };
+    int timeout = 0;
+    while (true) {
+        auto n = poll(items, K_SIZE, timeout);
+        if (n < 0) {
+            RETURN_STATUS_LOG_ERROR(StatusCode::K_UNKNOWN_ERROR, FormatString("Poll error. Errno = %d", errno));
+        }
+        if (IsInterrupted() || (items[K_INTERRUPT].revents & POLLIN)) {
+            VLOG(RPC_LOG_LEVEL) << "Front end shard " << shard.index << " shutdown";
+            break;
+        }
+        timeout = RPC_POLL_TIME;
+        unsigned int events = static_cast<unsigned int>(shard.frontend->GetEvents());
+        if (events & ZMQ_POLLIN) {
+            LOG_IF_ERROR(ZmqFrontendToSvc(shard), "Error in ZmqFrontendToSvc");
+            timeout = 0;
+        }
+        if (items[K_REPLY].revents & POLLIN) {
+            LOG_IF_ERROR(ProcessShardReplies(shard), "Error in ProcessShardReplies");
+            timeout = 0;
+        }
+    }
+    return Status::OK();
+}
+
 Status ZmqServerImpl::StartAllThreads()
 {
     if (RpcAuthKeyManager::Instance().HasAuthHandler()) {
@@ -323,32 +425,37 @@ Status ZmqServerImpl::Run()
 {
     CHECK_FAIL_RETURN_STATUS(!svcMap_.empty(), K_RUNTIME_ERROR, "No service is registered");
     CHECK_FAIL_RETURN_STATUS(!frontendEndPtList_.empty(), K_RUNTIME_ERROR, "No front end is defined");
-    // We need a few more threads.
-    auto numThreadsNeeded = 0;
-    ++numThreadsNeeded;  // One for proxy.
+    // We need a few more threads, one for each frontend shard.
+    auto numThreadsNeeded = shards_.size();
     // Start a thread pool for these extra threads.
     RETURN_IF_EXCEPTION_OCCURS(thrdPool_ = std::make_unique<ThreadPool>(numThreadsNeeded, 0, "ZmqProxy"));
-    auto func = [this] {
-        TraceGuard traceGuard = Trace::Instance().SetTraceNewID("ZmqProxy;" + GetStringUuid(), true);
-        if (!Thread::SetCurrentThreadNice(FLAGS_io_thread_nice)) {
-            LOG(WARNING) << "Failed to set nice for ZmqServerImpl proxy thread, nice=" << FLAGS_io_thread_nice
-                         << ", errno=" << errno;
-        }
-        RETURN_IF_NOT_OK_PRINT_ERROR_MSG(StartAllThreads(), "ZmqServer StartAllThreads failed");
-        return Status::OK();
-    };
-    thrd_ = std::make_unique<std::shared_future<Status>>(thrdPool_->Submit(func));
-    // If all goes well, the thread will not return. Wait for 0.1 second and expect a time-out.
-    auto rc = thrd_->wait_for(std::chrono::milliseconds(RPC_POLL_TIME));
+    for (auto &shard : shards_) {
+        auto func = [this, &shard] {
+            TraceGuard traceGuard = Trace::Instance().SetTraceNewID("ZmqProxy;" + GetStringUuid(), true);
+            if (!Thread::SetCurrentThreadNice(FLAGS_io_thread_nice)) {
+                LOG(WARNING) << "Failed to set nice for ZmqServerImpl proxy thread, nice=" << FLAGS_io_thread_nice
+                             << ", errno=" << errno;
+            }
+            if (shard->index > 0) {
+                RETURN_IF_NOT_OK_PRINT_ERROR_MSG(StartShardProxy(*shard), "ZmqServer StartShardProxy failed");
+                return Status::OK();
+            }
+            RETURN_IF_NOT_OK_PRINT_ERROR_MSG(StartAllThreads(), "ZmqServer StartAllThreads failed");
+            return Status::OK();
+        };
+        shard->thrd = std::make_unique<std::shared_future<Status>>(thrdPool_->Submit(func));
+    }
+    // If all goes well, the threads will not return. Wait for 0.1 second and expect a time-out.
+    auto &thrd = shards_.front()->thrd;
+    auto rc = thrd->wait_for(std::chrono::milliseconds(RPC_POLL_TIME));
     if (rc == std::future_status::ready) {
-        return thrd_->get();
+        return thrd->get();
     }
     return Status::OK();
 }
 
 ZmqServerImpl::ZmqServerImpl(const Token key, const RpcCredential &cred)
     : ctx_(std::make_shared<ZmqContext>(FLAGS_zmq_server_io_context)),
-      ffd_(ZMQ_NO_FILE_FD),
       sfd_(ZMQ_NO_FILE_FD),
       globalInterrupt_(false),
       cred_(cred),
@@ -357,19 +464,36 @@ ZmqServerImpl::ZmqServerImpl(const Token key, const RpcCredential &cred)
     (void)key;
 }
 
-Status ZmqServerImpl::Init()
+Status ZmqServerImpl::InitShard(int index)
 {
-    RETURN_IF_NOT_OK(ctx_->Init());
-    frontend_ = std::make_shared<ZmqSocket>(ctx_, ZmqSocketType::ROUTER);
-    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(frontend_->IsValid(), K_RUNTIME_ERROR,
+    auto shard = std::make_unique<FrontendShard>();
+    shard->index = index;
+    shard->frontend = std::make_shared<ZmqSocket>(ctx_, ZmqSocketType::ROUTER);
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(shard->frontend->IsValid(), K_RUNTIME_ERROR,
                                          "Cannot acquire resources to initialize server");
     // Bump up the high watermark.
     RpcOptions opt;
     opt.SetHWM(0);
-    RETURN_IF_NOT_OK(frontend_->UpdateOptions(opt));
-    RETURN_IF_NOT_OK(frontend_->Set(sockopt::ZmqBacklog, ZMQ_SOCKET_BACKLOG));
-    RETURN_IF_NOT_OK(frontend_->SetServerCredential(cred_));
-    ffd_ = frontend_->GetEventFd();
+    RETURN_IF_NOT_OK(shard->frontend->UpdateOptions(opt));
+    RETURN_IF_NOT_OK(shard->frontend->Set(sockopt::ZmqBacklog, ZMQ_SOCKET_BACKLOG));
+    RETURN_IF_NOT_OK(shard->frontend->SetServerCredential(cred_));
+    shard->ffd = shard->frontend->GetEventFd();
+    if (index > 0) {
+        shard->replyFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        CHECK_FAIL_RETURN_STATUS(shard->replyFd > 0, K_RUNTIME_ERROR,
+                                 FormatString("Event descriptor failed to created. Errno = %d", errno));
+        shard->replyQueue = std::make_unique<Queue<ZmqMetaMsgFrames>>(RPC_HWM);
+    }
+    shards_.emplace_back(std::move(shard));
+    return Status::OK();
+}
+
+Status ZmqServerImpl::Init()
+{
+    RETURN_IF_NOT_OK(ctx_->Init());
+    for (int i = 0; i < FLAGS_zmq_server_frontend_shards; ++i) {
+        RETURN_IF_NOT_OK(InitShard(i));
+    }
     sfd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
     CHECK_FAIL_RETURN_STATUS(sfd_ > 0, K_RUNTIME_ERROR,
                              FormatString("Event descriptor failed to created. Errno = %d", errno));
@@ -383,17 +507,39 @@ Status ZmqServerImpl::Init()
 Status ZmqServerImpl::Bind(const std::string &endpoint)
 {
     const std::string tcpTransport = "tcp://";
-    RETURN_IF_NOT_OK(frontend_->Bind(endpoint));
-    std::string val = frontend_->Get(sockopt::ZmqLastEndPt);
+    auto &frontend = shards_.front()->frontend;
+    RETURN_IF_NOT_OK(frontend->Bind(endpoint));
+    std::string val = frontend->Get(sockopt::ZmqLastEndPt);
     std::string tcpHostPort = ParseEndPt(endpoint, tcpTransport);
     if (!tcpHostPort.empty()) {
         auto pos = val.find_last_of(':');
         tcpListeningPorts_.push_back(val.substr(pos + 1));
+        RETURN_IF_NOT_OK(BindShards(tcpHostPort));
     }
     frontendEndPtList_.push_back(val);
     return Status::OK();
 }
 
+Status ZmqServerImpl::BindShards(const std::string &tcpHostPort)
+{
+    // The extra shards only serve the first tcp end point.
+    RETURN_OK_IF_TRUE(shards_.size() == 1 || !shardPorts_.empty());
+    auto host = tcpHostPort.substr(0, tcpHostPort.find_last_of(':'));
+    for (size_t i = 1; i < shards_.size(); ++i) {
+        auto &frontend = shards_[i]->frontend;
+        RETURN_IF_NOT_OK(frontend->Bind(FormatString("tcp://%s:*", host)));
+        std::string val = frontend->Get(sockopt::ZmqLastEndPt);
+        auto pos = val.find_last_of(':');
+        try {
+            shardPorts_.push_back(std::stoi(val.substr(pos + 1)));
+        } catch (const std::exception &e) {
+            RETURN_STATUS(K_RUNTIME_ERROR, FormatString("Unexpected end point %s: %s", val, e.what()));
+        }
+        VLOG(RPC_KEY_LOG_LEVEL) << FormatString("Frontend shard %zu binds to %s", i, val);
+    }
+    return Status::OK();
+}
+
 Status ZmqServerImpl::RegisterService(Token key, ZmqService *svc, const RpcServiceCfg &svcCfg)
 {
     (void)key;
@@ -431,6 +577,16 @@ ThreadPool::ThreadPoolUsage ZmqServerImpl::GetRpcServicesSnapshot(const std::str
     return svc->thrdPool_->GetThreadPoolUsage();
 }
 
+std::vector<uint64_t> ZmqServerImpl::GetFrontendShardRequests() const
+{
+    std::vector<uint64_t> requests;
+    requests.reserve(shards_.size());
+    for (const auto &shard : shards_) {
+        requests.push_back(shard->requests.load(std::memory_order_relaxed));
+    }
+    return requests;
+}
+
 ZmqServerImpl::~ZmqServerImpl()
 {
     Shutdown();
@@ -496,6 +652,9 @@ Status IOService::ClientToService(ZmqPollEntry *pe, EventsVal events)
         events |= EPOLLERR;
         return Status::OK();
     });
+    if (UnixSockFd(pe->fd_).FilterZeroCopyEvents(events) && (events & EPOLLIN) == 0) {
+        return Status::OK();
+    }
     if (events & (EPOLLERR | EPOLLHUP)) {
         auto fd = pe->fd_;
         VLOG(RPC_KEY_LOG_LEVEL) << "Socket " << fd << " disconnect.";
@@ -538,6 +697,9 @@ Status IOService::ServiceToClient(ZmqPollEntry *pe, EventsVal events)
         events |= EPOLLERR;
         return Status::OK();
     });
+    if (UnixSockFd(pe->fd_).FilterZeroCopyEvents(events) && (events & EPOLLOUT) == 0) {
+        return Status::OK();
+    }
     if (events & (EPOLLERR | EPOLLHUP)) {
         auto fd = pe->fd_;
         VLOG(RPC_KEY_LOG_LEVEL) << "Socket " << fd << " disconnect.";
@@ -42,6 +42,7 @@
 #include "datasystem/common/rpc/zmq/zmq_payload.h"
 #include "datasystem/common/rpc/zmq/zmq_service.h"
 #include "datasystem/common/rpc/zmq/zmq_socket.h"
+#include "datasystem/common/util/queue/queue.h"
 #include "datasystem/common/util/thread_pool.h"
 #include "datasystem/common/util/wait_post.h"
 #include "datasystem/common/util/status_helper.h"
@@ -215,6 +216,12 @@ public:
 
     ThreadPool::ThreadPoolUsage GetRpcServicesSnapshot(const std::string &serviceName);
 
+    /**
+     * @brief Get the number of rpc requests, heartbeats aside, each frontend shard has received.
+     * @return The counts indexed by shard.
+     */
+    std::vector<uint64_t> GetFrontendShardRequests() const;
+
     /**
      * @brief Report the list of end points this proxy is listen to
      */
@@ -240,15 +247,40 @@ public:
         return ses_;
     }
 
+    /**
+     * @brief Hand a reply over to the frontend shard which received the request, if it is not shard 0.
+     * @param[in/out] p The reply, moved away if a shard takes it.
+     * @param[out] posted Whether a shard takes the reply. If not, it goes through the service reply queue.
+     * @return Status of the call.
+     */
+    Status PostReplyToShard(ZmqMetaMsgFrames &p, bool &posted);
+
 private:
+    /**
+     * One ROUTER socket with its own poll loop. Shard 0 binds the configured end points and also drains the reply
+     * queues of the services. The other shards listen on ephemeral tcp ports which are advertised to the clients in
+     * the heartbeat reply, and get the replies of their own requests through their own queue. A client connects to
+     * those ports on the host it reaches the server at, so the extra shards are unreachable behind NAT or a k8s
+     * service that only maps the configured port.
+     */
+    struct FrontendShard {
+        int index{ 0 };
+        std::shared_ptr<ZmqSocket> frontend;
+        int ffd{ ZMQ_NO_FILE_FD };      // frontend event fd
+        int replyFd{ ZMQ_NO_FILE_FD };  // For replyQueue.
+        std::unique_ptr<Queue<ZmqMetaMsgFrames>> replyQueue;
+        std::unique_ptr<std::shared_future<Status>> thrd;
+        std::atomic<uint64_t> requests{ 0 };
+    };
+
     std::shared_ptr<ZmqContext> ctx_;
-    int ffd_;  // frontend_ event fd
     int sfd_;  // for interrupt
     std::unordered_map<int, ZmqService *> zmqfds_;
     std::vector<std::string> frontendEndPtList_;
     std::atomic<bool> globalInterrupt_;
     std::unique_ptr<ThreadPool> thrdPool_;
-    std::shared_ptr<ZmqSocket> frontend_;
+    std::vector<std::unique_ptr<FrontendShard>> shards_;
+    std::vector<int32_t> shardPorts_;  // The tcp ports of the shards other than shard 0.
     std::shared_ptr<ZmqEpoll> poller_;
     std::shared_ptr<SockEventService> ses_;
     RpcCredential cred_;
@@ -260,11 +292,6 @@ private:
      */
     std::unordered_map<std::string, ZmqService *> svcMap_;
 
-    /**
-     * Thread that start the proxy.
-     */
-    std::unique_ptr<std::shared_future<Status>> thrd_;
-
     /**
      * @brief Start the authentication handler thread. The thread will perform authentications for the incoming
      * connections over ZAP protocol. See ZMQ RFC 27 for more details.
@@ -273,12 +300,16 @@ private:
      */
     Status StartAllThreads();
     void StopAllServices();
-    Status ClientToService(ZmqMsgFrames &&frames);
-    Status ServiceToClient(const MetaPb &meta, ZmqMsgFrames &&frames);
+    Status InitShard(int index);
+    Status BindShards(const std::string &tcpHostPort);
+    Status ClientToService(FrontendShard &shard, ZmqMsgFrames &&frames);
+    Status ServiceToClient(FrontendShard &shard, const MetaPb &meta, ZmqMsgFrames &&frames);
     Status StartProxy();
-    Status ZmqFrontendToSvc();
-    Status SendErrorToClient(const MetaPb &meta, const Status &status);
+    Status StartShardProxy(FrontendShard &shard);
+    Status ZmqFrontendToSvc(FrontendShard &shard);
+    Status SendErrorToClient(FrontendShard &shard, const MetaPb &meta, const Status &status);
     Status ProcessReply(ZmqService *svc);
+    Status ProcessShardReplies(FrontendShard &shard);
 };
 }  // namespace datasystem
 #endif  // DATASYSTEM_COMMON_RPC_ZMQ_SERVER_IMPL_H
@@ -62,9 +62,7 @@ ZmqService::ZmqService()
         VLOG(ZMQ_PERF_LOG_LEVEL) << FormatString("Routing reply from %s to reply queue for service %s", sender,
                                                  serviceName_);
         PerfPoint::RecordElapsed(PerfKey::ZMQ_BACKEND_TO_FRONTEND, GetLapTime(meta, "ZMQ_BACKEND_TO_FRONTEND"));
-        RETURN_IF_NOT_OK(replyQueue_->Put(std::move(p)));
-        eventfd_write(outfd_, 1);
-        return Status::OK();
+        return PutReply(std::move(p));
     };
     // When multiDestinations_ is true, it can go to different places, and need to call ServiceToClient
     // which can do some locking, etc. And it can take longer
@@ -960,8 +958,13 @@ Status ZmqService::ParkPayloadIfNeeded(ZmqMetaMsgFrames &p, ZmqMsgFrames &payloa
     payload.insert(payload.end(), std::make_move_iterator(std::next(it, 1)), std::make_move_iterator(p.second.end()));
     p.second.erase(std::next(it, 1), p.second.end());
 
-    // If the size of the payload is too small, it is not worth to park it here.
-    if (sz <= FLAGS_payload_nocopy_threshold) {
+    // If the size of the payload is too small, it is not worth to park it here. A client that receives the payload
+    // in place asks for a lower threshold, since parking saves it the copy out of the zmq frames.
+    int64_t threshold = FLAGS_payload_nocopy_threshold;
+    if (meta.payload_direct_threshold() > 0) {
+        threshold = std::min(threshold, meta.payload_direct_threshold());
+    }
+    if (sz <= threshold) {
         it->SetType(ZmqMessage::ZmqMsgType::NONE);
         meta.set_payload_index(ZMQ_OFFLINE_PAYLOAD_INX);
     } else {
@@ -1003,8 +1006,7 @@ Status ZmqService::ServiceToClient(ZmqMetaMsgFrames &p)
     }
     int fd = meta.route_fd();
     if (meta.event_type() == EventType::ZMQ) {
-        RETURN_IF_NOT_OK(replyQueue_->Put(std::move(p)));
-        eventfd_write(outfd_, 1);
+        RETURN_IF_NOT_OK(PutReply(std::move(p)));
     } else {
         RETURN_IF_NOT_OK(io_->ServiceToClient(fd, p));
     }
@@ -1012,8 +1014,7 @@ Status ZmqService::ServiceToClient(ZmqMetaMsgFrames &p)
         // We will use the same route as the first part. If we pick a different route to send in
         // parallel, make sure the client is capable to receive the parts in different order
         if (rpc2.first.event_type() == EventType::ZMQ) {
-            RETURN_IF_NOT_OK(replyQueue_->Put(std::move(rpc2)));
-            eventfd_write(outfd_, 1);
+            RETURN_IF_NOT_OK(PutReply(std::move(rpc2)));
         } else {
             RETURN_IF_NOT_OK(io_->ServiceToClient(fd, rpc2));
         }
@@ -1021,6 +1022,17 @@ Status ZmqService::ServiceToClient(ZmqMetaMsgFrames &p)
     return Status::OK();
 }
 
+Status ZmqService::PutReply(ZmqMetaMsgFrames &&p)
+{
+    // A request which came in on an extra frontend shard is answered by that shard, the rest by the proxy thread.
+    bool posted = false;
+    RETURN_IF_NOT_OK(reinterpret_cast<ZmqServerImpl *>(proxy_)->PostReplyToShard(p, posted));
+    RETURN_OK_IF_TRUE(posted);
+    RETURN_IF_NOT_OK(replyQueue_->Put(std::move(p)));
+    eventfd_write(outfd_, 1);
+    return Status::OK();
+}
+
 Status ZmqService::BackendToFrontend(std::shared_ptr<ZmqServerMsgMgr> &mgr)
 {
     ZmqMetaMsgFrames p;
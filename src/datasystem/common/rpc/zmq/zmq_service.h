@@ -240,6 +240,7 @@ private:
     Status CreateWorkerCBs();
     Status CreateBackendMgr();
     Status ServiceToClient(ZmqMetaMsgFrames &frames);
+    Status PutReply(ZmqMetaMsgFrames &&p);
     Status HandleRqFromProxy();
     Status ProcessAccept(int fd);
     Status BindTcpIpPort(const std::vector<std::string> &frontendEndPtList);
@@ -121,6 +121,17 @@ Status ZmqSocket::Connect(const RpcChannel &channel)
     return sock_.Connect(channel.GetZmqEndPoint(), channel.IsIPv6());
 }
 
+Status ZmqSocket::Connect(const std::string &endPoint, bool isIPv6)
+{
+    PerfPoint point(PerfKey::ZMQ_SOCKET_CONNECT);
+    return sock_.Connect(endPoint, isIPv6);
+}
+
+Status ZmqSocket::Disconnect(const std::string &endPoint)
+{
+    return sock_.Disconnect(endPoint);
+}
+
 Status ZmqSocket::GetAllFrames(ZmqMsgFrames &queue, ZmqRecvFlags flags)
 {
     PerfPoint point(PerfKey::ZMQ_SOCKET_GET_ALL_MSG);
@@ -123,6 +123,21 @@ public:
      */
     Status Connect(const RpcChannel &channel);
 
+    /**
+     * @brief Connect to one more end point, e.g. a frontend shard of the server.
+     * @param[in] endPoint The zmq end point.
+     * @param[in] isIPv6 Whether the end point is an ipv6 address.
+     * @return Status of call.
+     */
+    Status Connect(const std::string &endPoint, bool isIPv6);
+
+    /**
+     * @brief Drop the connection to an end point given to Connect().
+     * @param[in] endPoint The zmq end point.
+     * @return Status of call.
+     */
+    Status Disconnect(const std::string &endPoint);
+
     bool IsValid() const
     {
         return sock_.IsValid();
@@ -136,6 +136,15 @@ Status ZmqSocketRef::Connect(const std::string &endPoint, bool isIPv6)
     return Status::OK();
 }
 
+Status ZmqSocketRef::Disconnect(const std::string &endPoint)
+{
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(sock_ != nullptr, K_INVALID, "Null reference pointer");
+    if (zmq_disconnect(sock_, endPoint.data()) == -1) {
+        return ZmqErrnoToStatus(errno, FormatString("ZMQ disconnect from %s unsuccessful", endPoint));
+    }
+    return Status::OK();
+}
+
 void ZmqSocketRef::Close()
 {
     if (sock_ != nullptr) {
@@ -141,6 +141,7 @@ public:
     void Close();
     Status Bind(const std::string &endPoint);
     Status Connect(const std::string &endPoint, bool isIPv6 = false);
+    Status Disconnect(const std::string &endPoint);
     Status RecvMsg(ZmqMessage &msg, ZmqRecvFlags flags);
     Status SendMsg(ZmqMessage &msg, ZmqSendFlags flags);
 
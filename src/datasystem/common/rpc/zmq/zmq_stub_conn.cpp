@@ -21,6 +21,7 @@
 #include "datasystem/common/rpc/zmq/zmq_constants.h"
 
 #include <poll.h>
+#include <algorithm>
 #include <mutex>
 #include <utility>
 
@@ -261,10 +262,50 @@ Status ZmqFrontend::ZmqSocketToBackend()
                                             receiver, meta.gateway_id(), meta.client_id(), meta.svc_name(),
                                             meta.method_index());
         RETURN_IF_NOT_OK(backendMgr_->SendMsg(receiver, p, QUE_NO_TIMEOUT));
+    } else {
+        ConnectFrontendShards(meta);
     }
     return Status::OK();
 }
 
+void ZmqFrontend::ConnectFrontendShards(const MetaPb &meta)
+{
+    // The shards listen on the host of the end point. The dealer socket spreads the requests over all the
+    // connections, and each reply comes back on the connection of its request.
+    const std::string tcpTransport = "tcp://";
+    const auto &endPoint = channel_->GetZmqEndPoint();
+    auto pos = endPoint.find_last_of(':');
+    if (ParseEndPt(endPoint, tcpTransport).empty() || pos == std::string::npos) {
+        return;
+    }
+    std::vector<std::string> shardEndPoints;
+    shardEndPoints.reserve(meta.frontend_shard_ports_size());
+    for (auto port : meta.frontend_shard_ports()) {
+        shardEndPoints.emplace_back(endPoint.substr(0, pos + 1) + std::to_string(port));
+    }
+    if (shardEndPoints == shardEndPoints_) {
+        return;
+    }
+    // Every heartbeat reply lists the shards, a restarted server may listen on other ports. A request queued on the
+    // connection to a port that is gone would never be sent.
+    for (const auto &shardEndPoint : shardEndPoints_) {
+        if (std::find(shardEndPoints.begin(), shardEndPoints.end(), shardEndPoint) == shardEndPoints.end()) {
+            LOG_IF_ERROR(frontend_->Disconnect(shardEndPoint),
+                         FormatString("Gateway %s disconnect from frontend shard %s failed", GetGatewayId(),
+                                      shardEndPoint));
+        }
+    }
+    for (const auto &shardEndPoint : shardEndPoints) {
+        if (std::find(shardEndPoints_.begin(), shardEndPoints_.end(), shardEndPoint) == shardEndPoints_.end()) {
+            LOG_IF_ERROR(frontend_->Connect(shardEndPoint, channel_->IsIPv6()),
+                         FormatString("Gateway %s connect to frontend shard %s failed", GetGatewayId(), shardEndPoint));
+        }
+    }
+    LOG(INFO) << FormatString("Gateway %s connects to %zu frontend shards of %s, was %zu", GetGatewayId(),
+                              shardEndPoints.size(), endPoint, shardEndPoints_.size());
+    shardEndPoints_ = std::move(shardEndPoints);
+}
+
 Status ZmqFrontend::SendHeartBeats()
 {
     // One more check to ensure we can send out the message without any blocking
@@ -336,6 +377,8 @@ Status ZmqFrontend::WorkerEntry()
     INJECT_POINT("ZmqFrontend.WorkerEntry.FailInit");
     initialized_ = true;
     initializeGuard.reset();
+    // The first heartbeat reply tells the frontend shards of the server, if it has any.
+    (void)SendHeartBeats();
     Timer t;
     Status rc;
     int timeout = 0;
@@ -387,6 +430,7 @@ Status ZmqFrontend::WorkerEntry()
                 std::swap(frontend_, sock);
                 ResetLiveness();
                 ffd_ = frontend_->GetEventFd();
+                shardEndPoints_.clear();
                 LOG(INFO) << FormatString("New gateway created %s", GetGatewayId());
                 METRIC_INC(metrics::KvMetricId::ZMQ_GATEWAY_RECREATE_TOTAL);
             }
@@ -1464,6 +1508,9 @@ Status SockConnEntry::AddEvent(int fd, std::shared_ptr<SockConnEntry::FdConn> fd
         auto fdPtr = std::dynamic_pointer_cast<SockConnEntry::FdConn>(fdPtrSp);
 
         auto fd = entry->fd_;
+        if (UnixSockFd(fd).FilterZeroCopyEvents(events) && (events & EPOLLIN) == 0) {
+            return Status::OK();
+        }
         events &= ~EPOLLIN;
         auto inErrorState = events & (EPOLLHUP | EPOLLERR | EPOLLRDHUP);
         Status rc;
@@ -1492,6 +1539,9 @@ Status SockConnEntry::AddEvent(int fd, std::shared_ptr<SockConnEntry::FdConn> fd
         auto fdPtr = std::dynamic_pointer_cast<SockConnEntry::FdConn>(fdPtrSp);
 
         auto fd = entry->fd_;
+        if (UnixSockFd(fd).FilterZeroCopyEvents(events) && (events & EPOLLOUT) == 0) {
+            return Status::OK();
+        }
         if (events & (EPOLLHUP | EPOLLERR | EPOLLRDHUP)) {
             // Cache is no longer valid.
             Status rc = connInfo->SetSvcFdInvalid(fd, fdPtr);
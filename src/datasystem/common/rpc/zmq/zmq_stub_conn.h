@@ -275,9 +275,11 @@ private:
     WaitPost initWp_;
     std::atomic<bool> initialized_ = { false };
     std::atomic<uint64_t> frontendQueLastHandledTimeMs_ = { 0 };
+    std::vector<std::string> shardEndPoints_;  // The frontend shards of the server frontend_ is connected to.
 
     Status RouteToZmqSocket(MetaPb &meta, ZmqMsgFrames &&p);
     Status SendHeartBeats();
+    void ConnectFrontendShards(const MetaPb &meta);
     Status ZmqSocketToBackend();
     Status HandleEvent(int timeout);
     Status BackendToFrontend();
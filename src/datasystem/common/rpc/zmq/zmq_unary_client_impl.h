@@ -238,6 +238,11 @@ public:
         return v2Server_;
     }
 
+    void SetPayloadDirectThreshold(int64_t threshold)
+    {
+        meta_.set_payload_direct_threshold(threshold);
+    }
+
 protected:
     std::shared_ptr<ZmqMsgQueRef> mQue_;
 
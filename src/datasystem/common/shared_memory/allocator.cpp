@@ -19,6 +19,7 @@
  */
 #include "datasystem/common/shared_memory/allocator.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <limits>
@@ -36,8 +37,10 @@
 #endif
 #include "datasystem/common/metrics/kv_metrics.h"
 #include "datasystem/common/shared_memory/arena_group_key.h"
+#include "datasystem/common/shared_memory/mmap/mem_mmap.h"
 #include "datasystem/common/shared_memory/resource_pool.h"
 #include "datasystem/common/util/file_util.h"
+#include "datasystem/common/util/huge_page_util.h"
 #include "datasystem/common/util/strings_util.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/common/log/log.h"
@@ -47,6 +50,8 @@ DS_DECLARE_string(shared_disk_directory);
 DS_DECLARE_uint32(eviction_reserve_mem_threshold_mb);
 DS_DECLARE_uint32(arena_per_tenant);
 DS_DECLARE_bool(enable_fallocate);
+DS_DECLARE_bool(enable_huge_tlb);
+DS_DECLARE_bool(enable_thp);
 
 namespace datasystem {
 namespace memory {
@@ -499,6 +504,33 @@ void Allocator::SubTotalPhysicalMemoryUsage(CacheType type, uint64_t size)
     (void)GetPhyResourcePoolByType(type)->SubRealUsageCAS(size);
 }
 
+std::string Allocator::GetHugePageStatistics()
+{
+    // Reading smaps walks the page tables of the whole process, so skip it when no huge page was asked for.
+    if (!FLAGS_enable_huge_tlb && !FLAGS_enable_thp) {
+        return "0/0/0/0";
+    }
+    HugePageUsage usage;
+    Status rc = ReadHugePageUsage(usage);
+    if (rc.IsError()) {
+        LOG_FIRST_N(WARNING, 1) << "Read huge page usage failed: " << rc.ToString();
+        return "0/0/0/0";
+    }
+    uint64_t pageSize = 0;
+    if (usage.hugeTlbBytes > 0) {
+        pageSize = GetConfiguredHugeTlbPageSize();
+    } else if (usage.shmemPmdMappedBytes > 0) {
+        pageSize = PMD_HUGE_PAGE_SIZE;
+    }
+    // Populated hugetlb arenas map more than the shared memory in use, so the rate is capped at 1.
+    auto physicalUsage = physicalMemoryStats_->RealUsage();
+    auto hugePageBytes = usage.hugeTlbBytes + usage.shmemPmdMappedBytes;
+    double coverageRate = physicalUsage == 0
+                              ? 0.0
+                              : std::min(1.0, hugePageBytes / static_cast<double>(physicalUsage));
+    return FormatString("%lu/%lu/%lu/%.3f", pageSize, usage.hugeTlbBytes, usage.shmemPmdMappedBytes, coverageRate);
+}
+
 std::set<int> Allocator::GetAllExpiredFds()
 {
     return arenaManager_->GetAllExpiredFds();
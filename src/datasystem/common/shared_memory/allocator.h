@@ -358,6 +358,13 @@ public:
                             streamMemoryLimit);
     }
 
+    /**
+     * @brief Get the huge page coverage of the shared memory mapped by this process.
+     * @return std::string format: "hugePageSize/hugeTlbBytes/thpBytes/coverageRate", all 0 when neither
+     *         enable_huge_tlb nor enable_thp is set.
+     */
+    std::string GetHugePageStatistics();
+
     /**
      * @brief Get the shared disk statistics.
      * @return std::string format: "usage/physicalUsage/totalLimit/rate".
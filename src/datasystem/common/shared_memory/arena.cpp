@@ -48,6 +48,7 @@
 #include "datasystem/common/shared_memory/mmap/disk_mmap.h"
 #include "datasystem/common/shared_memory/mmap/mem_mmap.h"
 #include "datasystem/common/util/format.h"
+#include "datasystem/common/util/huge_page_util.h"
 #include "datasystem/common/util/raii.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/common/util/strings_util.h"
@@ -412,13 +413,18 @@ Status ArenaManager::Init(CacheType type, AllocatorFuncRegister funcRegister)
     return Status::OK();
 }
 
-uint64_t ArenaManager::RoundUpToNextMultiple(uint64_t size)
+uint64_t ArenaManager::RoundDownToHugeTlbPage(uint64_t size)
 {
-    if (size % HUGE_PAGE_SIZE == 0) {
+    uint64_t pageSize = GetConfiguredHugeTlbPageSize();
+    pageSize = pageSize == 0 ? PMD_HUGE_PAGE_SIZE : pageSize;
+    if (size < pageSize) {
         return size;
-    } else {
-        return size + (HUGE_PAGE_SIZE - (size % HUGE_PAGE_SIZE));
     }
+    uint64_t aligned = size / pageSize * pageSize;
+    LOG_IF(INFO, aligned != size) << FormatString("Shared memory arena size %lu is rounded down to %lu, a multiple of "
+                                                  "the huge page size %lu",
+                                                  size, aligned, pageSize);
+    return aligned;
 }
 
 Status ArenaManager::CreateArenaGroup(CacheType type, uint64_t maxSize, std::shared_ptr<ArenaGroup> &arenaGroup)
@@ -466,19 +472,25 @@ Status ArenaManager::ComputeArenaParams(CacheType type, uint64_t maxSize, ArenaP
         static_cast<uint64_t>(static_cast<long double>(std::numeric_limits<uint64_t>::max()) * rate) > maxSize,
         K_RUNTIME_ERROR, "mmapSize overflow.");
     auto fakeAllocateSize = maxSize;
+    auto overhead = 0.8;
     if (populate_ || IsFastTransportEnabled() || IsRemoteH2DEnabled() || FLAGS_enable_huge_tlb
         || type == CacheType::UB_TRANSPORT) {
         // Here we ensure total allocated memory
         // does not exceed max requested by user
         rate = 1;
-        auto overhead = 0.8;
         // fakeAllocate Size is decreased to
         // account for extra Jemalloc overhead
         fakeAllocateSize = static_cast<uint64_t>(overhead * maxSize);
     }
     uint64_t mmapSize = maxSize / rate;
-    if (FLAGS_enable_huge_tlb) {
-        mmapSize = RoundUpToNextMultiple(mmapSize);
+    if (FLAGS_enable_huge_tlb && type == CacheType::MEMORY) {
+        // Rounding up to a 1 GB page could map far more than shared_memory_size_mb, also after a fallback to
+        // regular pages, so only whole huge pages within the requested size are mapped.
+        mmapSize = RoundDownToHugeTlbPage(mmapSize);
+        fakeAllocateSize = std::min(fakeAllocateSize, static_cast<uint64_t>(overhead * mmapSize));
+    } else if (FLAGS_enable_huge_tlb) {
+        // The other arenas are not backed by hugetlb, they only keep their extents on PMD boundaries.
+        mmapSize = AlignUp(mmapSize, PMD_HUGE_PAGE_SIZE);
     }
     uint32_t arenasNum = type == CacheType::MEMORY ? FLAGS_arena_per_tenant : FLAGS_shared_disk_arena_per_tenant;
     arenasNum = (type == CacheType::DEV_DEVICE || type == CacheType::DEV_HOST) ? 1 : arenasNum;
@@ -830,7 +842,9 @@ Status Arena::Init(AllocatorFuncRegister funcRegister)
             return Status(StatusCode::K_INVALID,
                           FormatString("Unkowned cache type: %d", static_cast<int32_t>(cacheType_)));
     }
-    RETURN_IF_NOT_OK(mmap_->Initialize(mmapSize_, populate_, FLAGS_enable_huge_tlb));
+    // Device memory is not mapped in the host address space, so there is no page size to choose for it.
+    bool hugepage = FLAGS_enable_huge_tlb && cacheType_ != CacheType::DEV_DEVICE;
+    RETURN_IF_NOT_OK(mmap_->Initialize(mmapSize_, populate_, hugepage));
     // Client initialization needs the requested state because URMA cannot become ready before its arena is created.
     if ((cacheType_ == CacheType::MEMORY || cacheType_ == CacheType::UB_TRANSPORT)
         && (NeedRegisterWholeArena() || ShouldBuildUbNumaRangeTable())) {
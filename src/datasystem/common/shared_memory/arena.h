@@ -326,11 +326,12 @@ public:
 
 private:
     /**
-     * @brief To align the size to an integer multiple of a page.
-     * @param[in] size mmap size .
+     * @brief Round the size down to an integer multiple of the configured huge page, so the arena never maps more
+     *        than requested. A size below one huge page is kept, such an arena is mapped with regular pages.
+     * @param[in] size mmap size.
      * @return aligned size
      */
-    uint64_t RoundUpToNextMultiple(uint64_t size);
+    uint64_t RoundDownToHugeTlbPage(uint64_t size);
 
     /**
      * @brief Create and initialize one arena.
@@ -470,7 +471,6 @@ private:
 
     // Default arena list init size, the maximum number of arena that can be allocated by Jemalloc is 4096.
     const uint64_t ARENAS_INIT_SIZE = 4096;
-    const static int HUGE_PAGE_SIZE = 2 * 1024 * 1024;
     // Record arena parameters for future arena init
     bool populate_{ false };
 
@@ -27,7 +27,10 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include "datasystem/common/perf/perf_manager.h"
+#include "datasystem/common/util/huge_page_util.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/common/util/strings_util.h"
 
@@ -54,6 +57,7 @@ Status BaseMmap::SetupFileMapping(size_t size, int flags, bool isSeal)
     pointer_ = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, fd_, 0);
     if (pointer_ == MAP_FAILED) {
         RETRY_ON_EINTR(close(fd_));
+        fd_ = -1;
         pointer_ = nullptr;
         RETURN_STATUS(StatusCode::K_RUNTIME_ERROR, FormatString("failed to mmap shared %s: %s", type_, StrErr(errno)));
     }
@@ -71,6 +75,18 @@ Status BaseMmap::SetupFileMapping(size_t size, int flags, bool isSeal)
     return Status::OK();
 }
 
+void BaseMmap::AdviseHugePage()
+{
+    if (pointer_ == nullptr || mmapSize_ == 0) {
+        return;
+    }
+    if (madvise(pointer_, mmapSize_, MADV_HUGEPAGE) != 0) {
+        LOG(WARNING) << "madvise HUGEPAGE " << type_ << " failed: " << StrErr(errno);
+        return;
+    }
+    extentAlignment_ = PMD_HUGE_PAGE_SIZE;
+}
+
 BaseMmap::~BaseMmap()
 {
     if (pointer_ != nullptr) {
@@ -95,6 +111,7 @@ void *BaseMmap::Allocate(size_t size, size_t alignment, bool *zero, bool *commit
 {
     (void)zero;
     (void)commit;
+    alignment = std::max(alignment, extentAlignment_);
     uintptr_t curr = curr_.load(std::memory_order_acquire);
     void *addr = nullptr;
     while (true) {
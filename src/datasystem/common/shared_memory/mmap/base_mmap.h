@@ -109,6 +109,15 @@ public:
      */
     Optional<Allocation> GetAllocation(void *pointer) const override;
 
+    /**
+     * @brief Return the hugetlb page size backing the mapping.
+     * @return The huge page size in bytes, 0 if the mapping uses regular or transparent huge pages.
+     */
+    uint64_t HugeTlbPageSize() const
+    {
+        return hugeTlbPageSize_;
+    }
+
 protected:
     /**
      * @brief Sets up memory mapping for a file.
@@ -119,6 +128,12 @@ protected:
      */
     Status SetupFileMapping(size_t size, int flags, bool isSeal);
 
+    /**
+     * @brief Ask the kernel to back the mapping with transparent huge pages, and align new extents to them.
+     *        Failure is only logged since the mapping stays usable with regular pages.
+     */
+    void AdviseHugePage();
+
     // Shared memory fd.
     int fd_;
 
@@ -136,6 +151,12 @@ protected:
 
     // The mmap type.
     std::string type_;
+
+    // Hugetlb page size of the mapping, 0 for regular pages.
+    uint64_t hugeTlbPageSize_{ 0 };
+
+    // Minimum alignment of extents handed to jemalloc, so each extent starts on a huge page boundary.
+    size_t extentAlignment_{ 0 };
 };
 }  // namespace memory
 }  // namespace datasystem
@@ -33,13 +33,13 @@
 #include "datasystem/utils/status.h"
 
 DS_DECLARE_string(shared_disk_directory);
+DS_DECLARE_bool(enable_thp);
 
 namespace datasystem {
 namespace memory {
 
 Status DiskMmap::Initialize(uint64_t size, bool populate, bool hugepage)
 {
-    (void)hugepage;
     errno = 0;
     // Create tmp file.
     const int permission = 0600;
@@ -73,7 +73,12 @@ Status DiskMmap::Initialize(uint64_t size, bool populate, bool hugepage)
         flags |= MAP_POPULATE;
     }
     type_ = "disk";
-    return SetupFileMapping(size, flags, false);
+    RETURN_IF_NOT_OK(SetupFileMapping(size, flags, false));
+    // Page cache of a regular file cannot use hugetlb; file systems with large folio support honor the THP advice.
+    if (hugepage || FLAGS_enable_thp) {
+        AdviseHugePage();
+    }
+    return Status::OK();
 }
 
 }  // namespace memory
@@ -37,13 +37,18 @@ FlexibleMmap::FlexibleMmap(AllocatorFuncRegister funcRegister)
 Status FlexibleMmap::Initialize(uint64_t size, bool populate, bool hugepage)
 {
     (void)populate;
-    (void)hugepage;
+    type_ = "flexible";
     auto rc = createFunc_(&pointer_, size);
     if (pointer_ != nullptr) {
         mmapSize_ = size;
         curr_ = reinterpret_cast<uintptr_t>(pointer_);
         tail_ = curr_ + static_cast<uintptr_t>(mmapSize_);
     }
+    // The memory comes from the registered allocator, so hugetlb cannot be chosen here; transparent huge pages are
+    // the closest the arena can get.
+    if (rc.IsOk() && hugepage) {
+        AdviseHugePage();
+    }
     return rc;
 }
 
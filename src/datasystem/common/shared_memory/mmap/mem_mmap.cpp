@@ -21,6 +21,7 @@
 #include "datasystem/common/shared_memory/mmap/mem_mmap.h"
 
 #include <fcntl.h>
+#include <algorithm>
 #include <optional>
 #include <sstream>
 #ifdef __linux__
@@ -34,6 +35,7 @@
 #include "datasystem/common/flags/flags.h"
 #include "datasystem/common/shared_memory/mmap/allocation.h"
 #include "datasystem/common/flags/common_flags.h"
+#include "datasystem/common/util/huge_page_util.h"
 #include "datasystem/common/util/numa_util.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/common/util/strings_util.h"
@@ -58,20 +60,29 @@ DS_DEFINE_bool(
 namespace datasystem {
 namespace memory {
 
-Status MemMmap::Initialize(uint64_t size, bool populate, bool hugepage)
+uint64_t GetConfiguredHugeTlbPageSize()
+{
+    if (FLAGS_huge_tlb_page_size_mb != 0) {
+        return static_cast<uint64_t>(FLAGS_huge_tlb_page_size_mb) * 1024 * 1024;
+    }
+    return GetDefaultHugePageSize();
+}
+
+Status MemMmap::CreateMapping(uint64_t size, bool populate, bool hugepage)
 {
     // 1. Create tmpfs file.
     std::string tmpfs = "datasystem";
     std::string hugeTlbOpenHint = "";
 
     unsigned int mfdFlag = MFD_ALLOW_SEALING;
+    uint64_t pageSize = 0;
     if (hugepage) {
-#ifdef MFD_HUGETLB
-        mfdFlag = MFD_ALLOW_SEALING | MFD_HUGETLB;
-        hugeTlbOpenHint = " huge tlb is open, this probably means you have to increase /proc/sys/vm/nr_hugepages";
-#else
-        RETURN_STATUS(StatusCode::K_RUNTIME_ERROR, "Huge tlb not support!");
-#endif
+        unsigned int hugeTlbFlag = 0;
+        pageSize = GetConfiguredHugeTlbPageSize();
+        RETURN_IF_NOT_OK(GetHugeTlbMemfdFlags(pageSize, hugeTlbFlag));
+        mfdFlag |= hugeTlbFlag;
+        hugeTlbOpenHint = " huge tlb is open, this probably means you have to increase the huge page pool in "
+                          "/sys/kernel/mm/hugepages";
     }
 
     // memfd_create is not defined in EulerOS, use syscall instead for compatibility purposes.
@@ -82,17 +93,48 @@ Status MemMmap::Initialize(uint64_t size, bool populate, bool hugepage)
     unsigned int flags = MAP_SHARED;
     if (hugepage) {
         flags = MAP_SHARED | MAP_HUGETLB;
+        // The kernel is the authority on the page size it picked; the file size must be a multiple of it.
+        uint64_t filePageSize = GetHugeTlbPageSize(fd_);
+        pageSize = filePageSize == 0 ? (pageSize == 0 ? PMD_HUGE_PAGE_SIZE : pageSize) : filePageSize;
+        // Growing a small arena to a whole huge page would map more than it asked for, it gets regular pages instead.
+        if (size < pageSize) {
+            RETRY_ON_EINTR(close(fd_));
+            fd_ = -1;
+            RETURN_STATUS(StatusCode::K_INVALID,
+                          FormatString("Size %lu is smaller than one huge page of %lu bytes", size, pageSize));
+        }
+        size = AlignUp(size, pageSize);
     }
     if (populate) {
         flags |= MAP_POPULATE;
     }
+    Status rc = SetupFileMapping(size, flags, true);
+    if (rc.IsError()) {
+        return Status(rc.GetCode(), rc.GetMsg() + hugeTlbOpenHint);
+    }
+    hugeTlbPageSize_ = pageSize;
+    // Extents only need to be aligned to the page size the kernel maps with a single PMD entry; a larger alignment
+    // would waste the tail of a 1 GB page mapping.
+    extentAlignment_ = std::min(pageSize, PMD_HUGE_PAGE_SIZE);
+    return Status::OK();
+}
+
+Status MemMmap::Initialize(uint64_t size, bool populate, bool hugepage)
+{
     type_ = "memory";
-    RETURN_IF_NOT_OK(SetupFileMapping(size, flags, true));
-    if (FLAGS_enable_thp && !hugepage) {
-        int ret = madvise(pointer_, mmapSize_, MADV_HUGEPAGE);
-        if (ret != 0) {
-            LOG(WARNING) << "madvise HUGEPAGE " << type_ << " failed: " << StrErr(errno);
-        }
+    bool mapped = false;
+    if (hugepage) {
+        Status rc = CreateMapping(size, populate, true);
+        mapped = rc.IsOk();
+        // An empty or too small huge page pool must not stop the worker; clients detect the page size from the fd.
+        LOG_IF(WARNING, !mapped) << "Huge tlb shared memory is unavailable, falling back to regular pages: "
+                                 << rc.ToString();
+    }
+    if (!mapped) {
+        RETURN_IF_NOT_OK(CreateMapping(size, populate, false));
+    }
+    if (FLAGS_enable_thp && hugeTlbPageSize_ == 0) {
+        AdviseHugePage();
     }
     const std::string &policy = FLAGS_shared_memory_distribution_policy;
     if (IsUrmaEnabled() && IsRegisterWholeArenaEnabled()
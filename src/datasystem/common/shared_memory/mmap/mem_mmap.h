@@ -26,6 +26,12 @@
 
 namespace datasystem {
 namespace memory {
+/**
+ * @brief Get the huge page size requested for hugetlb shared memory.
+ * @return huge_tlb_page_size_mb in bytes if set, otherwise the system default; 0 if the system has none.
+ */
+uint64_t GetConfiguredHugeTlbPageSize();
+
 class MemMmap : public BaseMmap {
 public:
     MemMmap() = default;
@@ -65,6 +71,15 @@ public:
     bool Decommit(void *addr, size_t offset, size_t length) override;
 
 private:
+    /**
+     * @brief Create the memfd and map it.
+     * @param[in] size Mmap max size, rounded up to the huge page size for a hugetlb mapping.
+     * @param[in] populate Indicate whether pre-populate or not.
+     * @param[in] hugepage Indicate whether to back the memfd with hugetlb pages.
+     * @return K_OK on success; the error code otherwise.
+     */
+    Status CreateMapping(uint64_t size, bool populate, bool hugepage);
+
     bool InRange(void *pointer, ptrdiff_t &offset);
 };
 }  // namespace memory
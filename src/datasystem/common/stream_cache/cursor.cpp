@@ -216,6 +216,30 @@ Status Cursor::SetLastLockedPage(const ShmView &shm, uint64_t timeoutMs)
     return SetPage(lastLockedShmView_, shm, timeoutMs);
 }
 
+void Cursor::SetAppendClaim(uint64_t claim)
+{
+    if (appendClaim_ != nullptr) {
+        __atomic_store_n(appendClaim_, claim, __ATOMIC_SEQ_CST);
+    }
+}
+
+uint64_t Cursor::GetAppendClaim() const
+{
+    return appendClaim_ == nullptr ? 0 : __atomic_load_n(appendClaim_, __ATOMIC_SEQ_CST);
+}
+
+void Cursor::SetLockFreeAppend(bool enable)
+{
+    if (lockFreeAppend_ != nullptr) {
+        __atomic_store_n(lockFreeAppend_, enable ? 1u : 0u, __ATOMIC_SEQ_CST);
+    }
+}
+
+bool Cursor::LockFreeAppend() const
+{
+    return lockFreeAppend_ != nullptr && __atomic_load_n(lockFreeAppend_, __ATOMIC_SEQ_CST) != 0;
+}
+
 void Cursor::InitFutexArea()
 {
     __atomic_store_n(futexWord_, AckVal::NONE, __ATOMIC_RELAXED);
@@ -414,6 +438,8 @@ Status Cursor::Init(std::shared_ptr<client::IMmapTableEntry> mmapEntry)
     CURSOR_INIT_FIELD(ptr_, data, eyeCatcher_);
     CURSOR_INIT_FIELD(ptr_, data, waitCount_);
     CURSOR_INIT_FIELD(ptr_, data, lastLockedPage_);
+    CURSOR_INIT_FIELD(ptr_, data, appendClaim_);
+    CURSOR_INIT_FIELD(ptr_, data, lockFreeAppend_);
     // Initialize the shm view
     lastLockedShmView_ = std::make_shared<SharedMemViewImpl>(lastLockedPage_, sizeof(*lastLockedPage_), lockId_);
     RETURN_IF_NOT_OK(lastLockedShmView_->Init(false));
@@ -149,7 +149,10 @@ timespec inline MilliSecondsToTimeSpec(uint64_t timeoutMs)
 // (i) Next 4 bytes is for alignment and can be combined with futex area (c) above as a wait count area
 //     and call the static function PageLock::FutexWake and PageLock::FutexWait to improve performance
 // (j) Next 32 bytes is used to store ShmView of the last page locked by the producer
-// (j) 24 bytes is left for future use.
+// (k) Next 8 bytes is the append claim of a V3 producer, i.e. the slots it is appending to the last locked page,
+//     so that the worker can repair exactly those slots if the producer crashes. See AppendClaim.
+// (l) Next 4 bytes is set by the worker when a V3 producer may append to data pages without the page lock
+// (m) 12 bytes is left for future use.
 class Cursor {
 public:
     // V1 of Cursor area has a size of 64 bytes
@@ -160,6 +163,8 @@ public:
     const uint32_t CLIENT_EYECATCHER_MASK = static_cast<uint32_t>(0x0000FFFF);
     const uint32_t WORKER_EYECATCHER_MASK = static_cast<uint32_t>(0xFFFF0000);
     // Client EyeCatcher V2 is K_CURSOR_SIZE_V2.
+    // Client EyeCatcher V3 also keeps the append claim (k) and honors the lock free append flag (l).
+    constexpr static uint32_t K_CLIENT_EYECATCHER_V3 = static_cast<uint32_t>(0x00000180);
     constexpr static uint32_t K_WORKER_EYECATCHER_V1 = static_cast<uint32_t>(0x00010000);
     enum AckVal : uint32_t { NONE = 0, DONE = 1 };
     constexpr static uint32_t SHIFT = 1;
@@ -339,6 +344,30 @@ public:
 
     Status ForceUnLock(uint32_t lockId, const std::string &msg);
 
+    /**
+     * @brief Record the slots the producer is appending to the last locked page.
+     * @param[in] claim The encoded AppendClaim, 0 if the producer is not appending.
+     */
+    void SetAppendClaim(uint64_t claim);
+
+    /**
+     * @brief Get the slots the producer is appending to the last locked page.
+     * @return The encoded AppendClaim, always 0 for a V1 work area.
+     */
+    uint64_t GetAppendClaim() const;
+
+    /**
+     * @brief Allow or forbid the producer to append to data pages without the page lock.
+     * @note Set by the worker, and only allowed when every client of the stream is V3.
+     */
+    void SetLockFreeAppend(bool enable);
+
+    /**
+     * @brief Check if the producer can append to data pages without the page lock.
+     * @return Always false for a V1 work area.
+     */
+    bool LockFreeAppend() const;
+
 private:
     uint8_t *ptr_;
     uint64_t *lastAckCursor_{ nullptr };
@@ -350,6 +379,8 @@ private:
     uint32_t *eyeCatcher_{ nullptr };
     uint32_t *waitCount_{ nullptr };
     SharedMemView *lastLockedPage_{ nullptr };
+    uint64_t *appendClaim_{ nullptr };
+    uint32_t *lockFreeAppend_{ nullptr };
     const size_t sz_;
     const uint32_t lockId_;
     std::shared_ptr<SharedMemViewImpl> lastPageShmView_;
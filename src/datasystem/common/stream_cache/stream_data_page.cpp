@@ -389,8 +389,9 @@ Status StreamDataPage::ResetToEmpty()
     } while (true);
     auto totalFreeSpace = PagePayloadSize();
     __atomic_store_n(&pageHeader_->totalFreeSpace_, totalFreeSpace, __ATOMIC_RELAXED);
-    // Slot count back to 0.
+    // Slot count back to 0, and slot 0 becomes the last slot again.
     __atomic_store_n(&pageHeader_->slotCount_, 0, __ATOMIC_RELAXED);
+    ReleaseNextSlot(0);
     // begCursor is 0 so function like Insert can detect the page has been recycled.
     __atomic_store_n(&pageHeader_->begCursor_, 0, __ATOMIC_RELAXED);
     // Clear the next pointer
@@ -446,7 +447,16 @@ Status StreamDataPage::InitEmptyPage()
 
 Status StreamDataPage::Lock(uint64_t timeoutMs)
 {
-    return pageLock_->Lock(timeoutMs);
+    Timer timer;
+    RETURN_IF_NOT_OK(pageLock_->Lock(timeoutMs));
+    // Producers appending without the lock check the lock after they reserve the next slot and back off,
+    // so only the one that reserved it before we got the lock can still be filling in the slot directory.
+    auto useTimeMs = static_cast<uint64_t>(timer.ElapsedMilliSecond());
+    Status rc = WaitForNextSlotReleased(timeoutMs > useTimeMs ? timeoutMs - useTimeMs : 0);
+    if (rc.IsError()) {
+        pageLock_->Unlock();
+    }
+    return rc;
 }
 
 void StreamDataPage::Unlock()
@@ -454,6 +464,124 @@ void StreamDataPage::Unlock()
     pageLock_->Unlock();
 }
 
+bool StreamDataPage::PageLocked() const
+{
+    return __atomic_load_n(&pageHeader_->lockArea_, __ATOMIC_SEQ_CST) & PageLock::WRITE_LOCK_NUM;
+}
+
+Status StreamDataPage::WaitForNextSlotReleased(uint64_t timeoutMs)
+{
+    Timer timer;
+    while (TESTFLAG(GetSlotAddr(GetSlotCount())->LoadFlag(isSharedPage_), NEXT_SLOT_RESERVED_BIT)) {
+        auto useTimeMs = static_cast<uint64_t>(timer.ElapsedMilliSecond());
+        CHECK_FAIL_RETURN_STATUS(useTimeMs < timeoutMs, K_TRY_AGAIN,
+                                 FormatString("[%s:%s] Timeout after %zu ms", __FUNCTION__, __LINE__, timeoutMs));
+        std::this_thread::yield();
+    }
+    return Status::OK();
+}
+
+void StreamDataPage::SetAppendClaim(AppendClaimState state, uint32_t firstSlot, uint32_t numSlots)
+{
+    if (appendCursor_ != nullptr) {
+        appendCursor_->SetAppendClaim(AppendClaim{ state, firstSlot, numSlots }.Encode());
+    }
+}
+
+Status StreamDataPage::BeginAppend(uint64_t timeoutMs, uint32_t &numElement, bool &lockFree)
+{
+    Timer timer;
+    lockFree = false;
+    // Shared pages are appended by the worker on behalf of many streams, and a producer without a V3 cursor
+    // can't tell if all the consumers understand the reservation bit. Both always take the page lock.
+    if (appendCursor_ != nullptr && !isSharedPage_) {
+        // Announce the attempt before we check the gate, so that the worker closing the gate waits for us.
+        SetAppendClaim(AppendClaimState::RESERVING, 0, 0);
+        Status rc = ReserveNextSlot(timeoutMs, numElement, lockFree);
+        if (rc.IsError() || !lockFree) {
+            SetAppendClaim(AppendClaimState::IDLE, 0, 0);
+            RETURN_IF_NOT_OK(rc);
+        }
+    }
+    if (!lockFree) {
+        auto useTimeMs = static_cast<uint64_t>(timer.ElapsedMilliSecond());
+        RETURN_IF_NOT_OK(Lock(timeoutMs > useTimeMs ? timeoutMs - useTimeMs : 0));
+        numElement = GetSlotCount();
+    }
+    SetAppendClaim(AppendClaimState::RESERVED, numElement + 1, 0);
+    return Status::OK();
+}
+
+void StreamDataPage::PublishAppend(uint32_t numElement, uint32_t count, bool lockFree)
+{
+    if (lockFree) {
+        // The new last slot can be reserved by others, the old one must not keep the bit.
+        ReleaseNextSlot(numElement);
+    } else {
+        Unlock();
+    }
+    SetAppendClaim(AppendClaimState::PUBLISHED, numElement + 1, count);
+}
+
+void StreamDataPage::AbortAppend(uint32_t numElement, bool lockFree)
+{
+    if (lockFree) {
+        ReleaseNextSlot(numElement);
+    } else {
+        Unlock();
+    }
+}
+
+bool StreamDataPage::TryReserveNextSlot(uint32_t &numElement)
+{
+    numElement = GetSlotCount();
+    if (!GetSlotAddr(numElement)->TryReserveNextSlot()) {
+        return false;
+    }
+    // Only the owner of the reservation can move the slot count. If it moved before we got the
+    // reservation, the slot we reserved is no longer the last one. The page lock holder on the
+    // other hand waits for us to release the reservation, see Lock().
+    if (GetSlotCount() != numElement || PageLocked()) {
+        ReleaseNextSlot(numElement);
+        return false;
+    }
+    return true;
+}
+
+Status StreamDataPage::ReserveNextSlot(uint64_t timeoutMs, uint32_t &numElement, bool &reserved)
+{
+    const uint64_t minTimeoutMs = 5;
+    timeoutMs = std::max(minTimeoutMs, timeoutMs);
+    PerfPoint point(PerfKey::PAGE_INSERT_RESERVE_SLOT);
+    Timer timer;
+    // Producers only keep the reservation to fill in one slot, so spin. Anyone holding the page lock
+    // can keep it much longer, back off to sleep after the threshold.
+    const uint64_t sleepThresholdMs = 10;
+    reserved = false;
+    while (appendCursor_->LockFreeAppend()) {
+        if (TryReserveNextSlot(numElement)) {
+            reserved = true;
+            return Status::OK();
+        }
+        CHECK_FAIL_RETURN_STATUS(!HasNextPage(), K_SC_END_OF_PAGE, "Check next page for new elements");
+        auto useTimeMs = static_cast<uint64_t>(timer.ElapsedMilliSecond());
+        CHECK_FAIL_RETURN_STATUS(useTimeMs < timeoutMs, K_TRY_AGAIN,
+                                 FormatString("[%s:%s] Timeout after %zu ms", __FUNCTION__, __LINE__, timeoutMs));
+        if (useTimeMs < sleepThresholdMs) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    // The worker turned lock free append off, e.g. an older client joined the stream.
+    return Status::OK();
+}
+
+void StreamDataPage::ReleaseNextSlot(uint32_t slot)
+{
+    GetSlotAddr(slot)->ClearFlagBit(NEXT_SLOT_RESERVED_BIT);
+}
+
 void StreamDataPage::TryUnlockByLockId(uint32_t lockId)
 {
     if (pageLock_->TryUnlockByLockId(lockId)) {
@@ -491,6 +619,72 @@ void StreamDataPage::TryUnlockByLockId(uint32_t lockId)
     }
 }
 
+Status StreamDataPage::RecoverAppend(uint32_t lockId, uint64_t claim, uint64_t timeoutMs)
+{
+    auto appendClaim = AppendClaim::Decode(claim);
+    if (pageLock_->TryUnlockByLockId(lockId)) {
+        // The producer crashed holding the page lock, we now own the lock. Decrement the reference count.
+        (void)ReleasePage(FormatString("%s:%s", __FUNCTION__, __LINE__));
+    } else if (appendClaim.state == AppendClaimState::IDLE) {
+        return Status::OK();
+    } else {
+        // The producer was appending without the page lock. Live producers are held off by the caller,
+        // so the reservation bit left behind can't be waited for, take the raw lock.
+        RETURN_IF_NOT_OK(pageLock_->Lock(timeoutMs));
+    }
+    Raii unlock([this]() { pageLock_->Unlock(); });
+    RepairAbandonedAppend(appendClaim);
+    return Status::OK();
+}
+
+void StreamDataPage::RepairAbandonedAppend(const AppendClaim &claim)
+{
+    // The claim tells which slots belong to the crashed producer, everything else on the page is
+    // appended by live producers and must be kept even if it is not consistent yet.
+    auto pendingSlotCount = GetSlotCount();
+    uint32_t slotCount = pendingSlotCount;
+    if (claim.firstSlot > 0 && claim.numSlots > 0) {
+        auto lastSlot = claim.firstSlot + claim.numSlots - 1;
+        bool consistent = true;
+        for (uint32_t slot = claim.firstSlot; slot <= std::min(lastSlot, pendingSlotCount); ++slot) {
+            consistent = consistent && TESTFLAG(GetSlotFlag(slot), ELEMENT_DATA_CONSISTENT);
+        }
+        if (!consistent && lastSlot == pendingSlotCount) {
+            // Nobody appended after the crashed producer, the slots can be given back.
+            slotCount = claim.firstSlot - 1;
+        } else if (!consistent) {
+            LOG(WARNING) << FormatString(
+                "[Page:%s] Slots %zu-%zu of a crashed producer are followed by other elements and are left as is",
+                GetPageId(), claim.firstSlot, lastSlot);
+        }
+    }
+    // Keep in mind the slot directory grow forward but elements grow backward.
+    auto totalFreeSpace = PagePayloadSize() - slotCount * GetMetaSize(isSharedPage_)
+                          - (GetSlotOffset(0) - GetSlotOffset(slotCount));
+    __atomic_store_n(&pageHeader_->slotCount_, slotCount, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&pageHeader_->totalFreeSpace_, totalFreeSpace, __ATOMIC_SEQ_CST);
+    // No live producer holds a reservation now, drop the one the crashed producer left behind.
+    for (uint32_t slot = 0; slot <= pendingSlotCount; ++slot) {
+        ReleaseNextSlot(slot);
+    }
+    auto begCursor = pageHeader_->begCursor_;
+    LOG(INFO) << FormatString(
+        "[Page:%s] Page recover success. begCursor = %zu, slot count = %zu -> %zu, freeSpace = %zu", GetPageId(),
+        begCursor, pendingSlotCount, slotCount, totalFreeSpace);
+}
+
+uint32_t StreamDataPage::GetInFlightSlot()
+{
+    auto slotCount = GetSlotCount();
+    for (uint32_t slot = 1; slot <= slotCount; ++slot) {
+        if (!TESTFLAG(GetSlotFlag(slot), ELEMENT_DATA_CONSISTENT)) {
+            return slot;
+        }
+    }
+    auto lastFlag = GetSlotAddr(slotCount)->LoadFlag(isSharedPage_);
+    return TESTFLAG(lastFlag, NEXT_SLOT_RESERVED_BIT) ? slotCount + 1 : 0;
+}
+
 uint64_t StreamDataPage::GetBegCursor() const
 {
     auto begCursor = __atomic_load_n(&pageHeader_->begCursor_, __ATOMIC_RELAXED);
@@ -612,9 +806,7 @@ void StreamDataPage::SetPageHasBigElement()
     // a big element row. To optimize the work, we are going to steal
     // the high bits of slot0 which is never use until now. If the
     // bit is set, there exists at one big element
-    SlotFlagOffset offset = __atomic_load_n(slotDir_, __ATOMIC_ACQUIRE);
-    offset |= BIG_ELEMENT_BIT;
-    __atomic_store_n(slotDir_, offset, __ATOMIC_RELEASE);
+    GetSlotAddr(0)->SetFlagBit(BIG_ELEMENT_BIT);
 }
 
 void StreamDataPage::UnsetPageHasBigElement()
@@ -623,9 +815,7 @@ void StreamDataPage::UnsetPageHasBigElement()
     // a big element row. To optimize the work, we are going to steal
     // the high bits of slot0 which is never use until now. If the
     // bit is set, there exists at one big element
-    SlotFlagOffset offset = __atomic_load_n(slotDir_, __ATOMIC_ACQUIRE);
-    offset &= ~BIG_ELEMENT_BIT;
-    __atomic_store_n(slotDir_, offset, __ATOMIC_RELEASE);
+    GetSlotAddr(0)->ClearFlagBit(BIG_ELEMENT_BIT);
 }
 
 bool StreamDataPage::PageHasBigElement()
@@ -702,7 +892,7 @@ Status StreamDataPage::ExtractBigElementsUpTo(uint64_t ackCursor, std::vector<st
         }
         auto slotAddr = GetSlotAddr(i + 1);
         DataElement ele;
-        ele.attr_ = slotAddr->LoadFlag(isSharedPage_);
+        ele.attr_ = slotAddr->LoadFlag(isSharedPage_) & ~NEXT_SLOT_RESERVED_BIT;
         // Like Receive, if the data is not ready, break out from the loop. We will resume again next time.
         if (!ele.DataIsReady()) {
             break;
@@ -737,49 +927,47 @@ Status StreamDataPage::Insert(const HeaderAndData &element, uint64_t timeoutMs,
     auto *slotCount_ = &pageHeader_->slotCount_;
     size_t finalElementSize = element.TotalSize();
     size_t spaceNeeded = GetMetaSize(isSharedPage_) + finalElementSize;
-    // Make sure this element is not exceeding the maximum free space. There is no way
-    // any page can hold the big element. We need to account a new slot for Element.
-    // Slot 0 is in use. Space for slot 1 is pre-allocated,
-    // and so we can allow element of max stream element size.
-    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
-        finalElementSize <= static_cast<size_t>(maxElementSize_), K_INVALID,
-        FormatString("Element size %zu (plus internal overhead) is exceeding the maximum free space %zu",
-                     finalElementSize, maxElementSize_));
-    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(element.size > 0, K_INVALID, "Element size should be greater than 0");
-    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(element.ptr != nullptr, K_INVALID, "Element ptr should not be a nullptr");
-    // The maximum length we can support is 30 bits
-    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
-        (finalElementSize & ~(static_cast<uint64_t>(SLOT_VALUE_MASK))) == 0, K_INVALID,
-        FormatString("Element size %zu is exceeding the maximum length", finalElementSize));
-    StreamPageLock pageLock(shared_from_this());
-    // A few shortcuts before we try to hold the lock for insert.
+    RETURN_IF_NOT_OK(CheckElement(element));
+    // A few shortcuts before we try to reserve the next slot for insert.
     // These methods involve looking at some atomic fields.
-    // (a) If the totalFreeSpace is too small, don't bother to get the lock
+    // (a) If the totalFreeSpace is too small, don't bother to reserve
     auto totalFreeSpace = __atomic_load_n(totalFreeSpace_, __ATOMIC_RELAXED);
     CHECK_FAIL_RETURN_STATUS(spaceNeeded <= totalFreeSpace, K_NO_SPACE, "Not enough space");
     // (b) If this page has a next pointer. If there is one, just follow the pointer.
     CHECK_FAIL_RETURN_STATUS(!HasNextPage(), K_SC_END_OF_PAGE, "Check next page for new elements");
-    // Now we lock the page for insert because this page is shared by producers.
-    // Consumers on the other hand traverse the page without any lock.
-    if (!TESTFLAG(flags, InsertFlags::SKIP_LOCK)) {
-        RETURN_IF_NOT_OK(pageLock.Lock(timeoutMs));
+    // This page is shared by producers, so we get the right to append the next slot. That is the page lock,
+    // or when every client of the stream supports it, a reservation of the next slot with a CAS on the last
+    // slot. Consumers on the other hand traverse the page without any lock.
+    uint32_t numElement = 0;
+    bool lockFree = false;
+    bool appending = !TESTFLAG(flags, InsertFlags::SKIP_LOCK);
+    if (appending) {
+        RETURN_IF_NOT_OK(BeginAppend(timeoutMs, numElement, lockFree));
+    } else {
+        numElement = GetSlotCount();
     }
+    Raii endAppend([this, &appending, &lockFree, numElement]() {
+        if (appending) {
+            AbortAppend(numElement, lockFree);
+        }
+        SetAppendClaim(AppendClaimState::IDLE, 0, 0);
+    });
     INJECT_POINT("producer_obtained_lock");
     // There is a racing condition that a page can be cycled and put into the free list.
     // One way to detect this page is on a free list is check the begCursor_.
     auto begCursor = __atomic_load_n(&pageHeader_->begCursor_, __ATOMIC_RELAXED);
     CHECK_FAIL_RETURN_STATUS(begCursor > 0, K_TRY_AGAIN, "Page is already recycled");
-    // After we get the lock, do the same check again
+    // After we get the right to append, do the same check again
     CHECK_FAIL_RETURN_STATUS(!HasNextPage(), K_SC_END_OF_PAGE, "Check next page for new elements.");
     totalFreeSpace = __atomic_load_n(totalFreeSpace_, __ATOMIC_RELAXED);
     CHECK_FAIL_RETURN_STATUS(spaceNeeded <= totalFreeSpace, K_NO_SPACE, "Not enough space");
+    SetAppendClaim(AppendClaimState::RESERVED, numElement + 1, 1);
     totalFreeSpace = __atomic_sub_fetch(totalFreeSpace_, spaceNeeded, __ATOMIC_RELAXED);
     INJECT_POINT("producer_update_free_space");
-    auto numElement = __atomic_load_n(slotCount_, __ATOMIC_ACQUIRE);
 
     SlotOffset offset = GetSlotOffset(numElement) - static_cast<SlotOffset>(finalElementSize);
     uint8_t *dest = reinterpret_cast<uint8_t *>(slotDir_) + offset;
-    // We will do asynchronous memory copy by letting go of the page lock
+    // We will do asynchronous memory copy by letting go of the right to append
     // once we know where we will write the data to.
     // Need to distinguish an inserted element is from a local producer or a remote producer.
     // If coming from a remote producer, set the high bit. Same for big element
@@ -796,8 +984,10 @@ Status StreamDataPage::Insert(const HeaderAndData &element, uint64_t timeoutMs,
     // and we should only it when free space and slot offset are set.
     __atomic_store_n(slotCount_, 1 + numElement, __ATOMIC_RELEASE);
     INJECT_POINT("producer_update_pending_slot_count_holding_lock");
-    // Let go of the lock
-    pageLock.Unlock();
+    if (appending) {
+        PublishAppend(numElement, 1, lockFree);
+        appending = false;
+    }
     INJECT_POINT("producer_update_pending_slot_count_without_lock");
     // Caution! After this point, we no longer hold any lock.
     PerfPoint perfPoint(PerfKey::PAGE_ELEMENT_MEMORY_COPY);
@@ -820,6 +1010,115 @@ Status StreamDataPage::Insert(const HeaderAndData &element, uint64_t timeoutMs,
     return Status::OK();
 }
 
+Status StreamDataPage::CheckElement(const HeaderAndData &element) const
+{
+    size_t finalElementSize = element.TotalSize();
+    // Make sure this element is not exceeding the maximum free space. There is no way
+    // any page can hold the big element. We need to account a new slot for Element.
+    // Slot 0 is in use. Space for slot 1 is pre-allocated,
+    // and so we can allow element of max stream element size.
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
+        finalElementSize <= static_cast<size_t>(maxElementSize_), K_INVALID,
+        FormatString("Element size %zu (plus internal overhead) is exceeding the maximum free space %zu",
+                     finalElementSize, maxElementSize_));
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(element.size > 0, K_INVALID, "Element size should be greater than 0");
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(element.ptr != nullptr, K_INVALID, "Element ptr should not be a nullptr");
+    // The maximum length we can support is 30 bits
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
+        (finalElementSize & ~(static_cast<uint64_t>(SLOT_VALUE_MASK))) == 0, K_INVALID,
+        FormatString("Element size %zu is exceeding the maximum length", finalElementSize));
+    return Status::OK();
+}
+
+Status StreamDataPage::Insert(const std::vector<HeaderAndData> &elements, size_t begin, size_t end, uint64_t timeoutMs,
+                              InsertFlags &flags, size_t &numInserted, const std::string &logPrefix)
+{
+    INJECT_POINT("producer_insert");
+    PerfPoint point(PerfKey::PAGE_BATCH_INSERT_ELEMENT);
+    numInserted = 0;
+    CHECK_FAIL_RETURN_STATUS(begin < end && end <= elements.size(), K_INVALID,
+                             FormatString("Invalid range [%zu, %zu) of %zu elements", begin, end, elements.size()));
+    for (size_t i = begin; i < end; ++i) {
+        RETURN_IF_NOT_OK(CheckElement(elements[i]));
+    }
+    auto *totalFreeSpace_ = &pageHeader_->totalFreeSpace_;
+    auto *slotCount_ = &pageHeader_->slotCount_;
+    const size_t metaSize = GetMetaSize(isSharedPage_);
+    // Same shortcuts as the single element insert, at least the first element has to fit.
+    auto totalFreeSpace = __atomic_load_n(totalFreeSpace_, __ATOMIC_RELAXED);
+    CHECK_FAIL_RETURN_STATUS(metaSize + elements[begin].TotalSize() <= totalFreeSpace, K_NO_SPACE,
+                             "Not enough space");
+    CHECK_FAIL_RETURN_STATUS(!HasNextPage(), K_SC_END_OF_PAGE, "Check next page for new elements");
+    // One right to append covers all the slots filled in below.
+    uint32_t numElement = 0;
+    bool lockFree = false;
+    RETURN_IF_NOT_OK(BeginAppend(timeoutMs, numElement, lockFree));
+    bool appending = true;
+    Raii endAppend([this, &appending, lockFree, numElement]() {
+        if (appending) {
+            AbortAppend(numElement, lockFree);
+        }
+        SetAppendClaim(AppendClaimState::IDLE, 0, 0);
+    });
+    INJECT_POINT("producer_obtained_lock");
+    auto begCursor = __atomic_load_n(&pageHeader_->begCursor_, __ATOMIC_RELAXED);
+    CHECK_FAIL_RETURN_STATUS(begCursor > 0, K_TRY_AGAIN, "Page is already recycled");
+    CHECK_FAIL_RETURN_STATUS(!HasNextPage(), K_SC_END_OF_PAGE, "Check next page for new elements.");
+    totalFreeSpace = __atomic_load_n(totalFreeSpace_, __ATOMIC_RELAXED);
+    size_t spaceNeeded = 0;
+    size_t count = 0;
+    for (size_t i = begin; i < end; ++i) {
+        auto sizeNeeded = metaSize + elements[i].TotalSize();
+        if (spaceNeeded + sizeNeeded > totalFreeSpace) {
+            break;
+        }
+        spaceNeeded += sizeNeeded;
+        ++count;
+    }
+    CHECK_FAIL_RETURN_STATUS(count > 0, K_NO_SPACE, "Not enough space");
+    SetAppendClaim(AppendClaimState::RESERVED, numElement + 1, count);
+    totalFreeSpace = __atomic_sub_fetch(totalFreeSpace_, spaceNeeded, __ATOMIC_RELAXED);
+    INJECT_POINT("producer_update_free_space");
+
+    SlotOffset offset = GetSlotOffset(numElement);
+    for (size_t i = 0; i < count; ++i) {
+        const auto &element = elements[begin + i];
+        offset -= static_cast<SlotOffset>(element.TotalSize());
+        auto elementFlags = flags | (element.headerSize_ > 0 ? InsertFlags::HEADER : InsertFlags::NONE);
+        SlotFlag slotFlag = 0;
+        SetAttributeBits(elementFlags, slotFlag);
+        GetSlotAddr(numElement + 1 + i)->StoreAll(isSharedPage_, slotFlag, offset, element.streamNo);
+    }
+    INJECT_POINT("producer_update_slot_directory");
+    __atomic_store_n(slotCount_, numElement + count, __ATOMIC_RELEASE);
+    INJECT_POINT("producer_update_pending_slot_count_holding_lock");
+    PublishAppend(numElement, count, lockFree);
+    appending = false;
+    INJECT_POINT("producer_update_pending_slot_count_without_lock");
+    // The slots are published, copy the payloads and mark them consistent one by one so that
+    // consumers can start on the first elements while the rest are still being copied.
+    PerfPoint perfPoint(PerfKey::PAGE_ELEMENT_MEMORY_COPY);
+    for (size_t i = 0; i < count; ++i) {
+        auto slot = numElement + 1 + i;
+        uint8_t *dest = reinterpret_cast<uint8_t *>(slotDir_) + GetSlotOffset(slot);
+        RETURN_IF_NOT_OK(elements[begin + i].MemoryCopyTo(dest));
+        UpdateSlotConsistentBit(slot);
+    }
+    perfPoint.Record();
+    if (!TESTFLAG(flags, InsertFlags::DELAY_WAKE)) {
+        RETURN_IF_NOT_OK(WakeUpConsumers());
+    }
+    numInserted = count;
+    const int logPerCount = VLOG_IS_ON(SC_INTERNAL_LOG_LEVEL) ? 1 : 1000;
+    LOG_EVERY_N(INFO, logPerCount) << FormatString(
+        "[%sCursor %zu] Add %zu elements success. slot = %zu, length = %zu, freeSpace = %zu, sharedPage = %s, "
+        "pageId = %s",
+        (!logPrefix.empty() ? logPrefix + " " : ""), pageHeader_->begCursor_ + numElement, count, numElement + 1,
+        spaceNeeded, totalFreeSpace, BoolToString(isSharedPage_), GetPageId());
+    SETFLAG(flags, InsertFlags::INSERT_SUCCESS);
+    return Status::OK();
+}
+
 Status CalcMaxAllowRows(void *buf, std::vector<size_t> &sz, const size_t totalFreeSpace, bool isSharedPage,
                         StreamMetaShm *streamMetaShm, uint8_t *&src, size_t &spaceNeeded, size_t &numInsert,
                         size_t &totalLength)
@@ -1010,7 +1309,7 @@ Status StreamDataPage::Receive(uint64_t lastRecvCursor, uint64_t timeoutMs, std:
         auto slot = i - begCursor;
         auto slotAddr = GetSlotAddr(slot + 1);
         DataElement ele;
-        ele.attr_ = slotAddr->LoadFlag(isSharedPage_, __ATOMIC_ACQUIRE);
+        ele.attr_ = slotAddr->LoadFlag(isSharedPage_, __ATOMIC_ACQUIRE) & ~NEXT_SLOT_RESERVED_BIT;
         INJECT_POINT("StreamDataPage::Receive.fake.BIG_ELEMENT", [startCursor, begCursor, &ele]() {
             LOG(INFO) << "startCursor = " << startCursor << " begCursor = " << begCursor;
             if (startCursor != begCursor) {
@@ -94,7 +94,10 @@ constexpr static uint32_t REMOTE_ELEMENT_BIT = static_cast<uint32_t>(0x80000000)
 constexpr static uint32_t ELEMENT_DATA_CONSISTENT = static_cast<uint32_t>(0x40000000);
 constexpr static uint32_t BIG_ELEMENT_BIT = static_cast<uint32_t>(0x20000000);
 constexpr static uint32_t HEADER_BIT = static_cast<uint32_t>(0x10000000);
-constexpr static uint32_t FUTURE_1_BIT = static_cast<uint32_t>(0x08000000);
+// Set on the last slot by a producer appending the next slot without the page lock. It is taken with a CAS
+// and cleared once the next slot is published. Only used when every client of the stream is V3, because
+// older consumers reject unknown attribute bits.
+constexpr static uint32_t NEXT_SLOT_RESERVED_BIT = static_cast<uint32_t>(0x08000000);
 constexpr static uint32_t FUTURE_2_BIT = static_cast<uint32_t>(0x04000000);
 constexpr static uint32_t FUTURE_3_BIT = static_cast<uint32_t>(0x02000000);
 constexpr static uint32_t FUTURE_4_BIT = static_cast<uint32_t>(0x01000000);
@@ -102,6 +105,42 @@ constexpr static uint32_t SLOT_VALUE_MASK = static_cast<uint32_t>(0x00FFFFFF);
 // Is shared page if the first bit of slot0 is set
 constexpr static uint32_t PAGE_SHARED_BIT = static_cast<uint32_t>(0x80000000);
 
+// The slots a producer is appending to its last locked page, kept in the append claim area of its cursor.
+// A slot range is only owned by one producer, so the worker can repair exactly these slots if it crashes.
+enum class AppendClaimState : uint32_t { IDLE = 0, RESERVING = 1, RESERVED = 2, PUBLISHED = 3 };
+struct AppendClaim {
+    AppendClaimState state{ AppendClaimState::IDLE };
+    uint32_t firstSlot{ 0 };
+    uint32_t numSlots{ 0 };
+
+    uint64_t Encode() const
+    {
+        return (static_cast<uint64_t>(firstSlot) << SLOT_SHIFT) | (static_cast<uint64_t>(numSlots) << STATE_BITS)
+               | static_cast<uint64_t>(state);
+    }
+
+    static AppendClaim Decode(uint64_t val)
+    {
+        AppendClaim claim;
+        claim.state = static_cast<AppendClaimState>(val & STATE_MASK);
+        claim.numSlots = static_cast<uint32_t>(val >> STATE_BITS) & NUM_SLOTS_MASK;
+        claim.firstSlot = static_cast<uint32_t>(val >> SLOT_SHIFT);
+        return claim;
+    }
+
+    // The producer may still change the page, i.e. it has or is about to have the right to append.
+    bool Appending() const
+    {
+        return state == AppendClaimState::RESERVING || state == AppendClaimState::RESERVED;
+    }
+
+private:
+    constexpr static uint32_t SLOT_SHIFT = 32;
+    constexpr static uint32_t STATE_BITS = 2;
+    constexpr static uint64_t STATE_MASK = 0x3;
+    constexpr static uint32_t NUM_SLOTS_MASK = 0x3FFFFFFF;
+};
+
 // This class extends the Element class with the additional attribute byte from above
 class DataElement : public Element {
 public:
@@ -321,18 +360,26 @@ union SlotType {
         return 0;
     }
 
+    // Flag bits of one slot can be changed by different producers at the same time, so always use atomic RMW.
     void SetFlagBit(SlotFlag addBit)
     {
-        SlotFlag slotFlag = __atomic_load_n(&flagWithOffset, __ATOMIC_ACQUIRE);
-        SETFLAG(slotFlag, addBit);
-        __atomic_store_n(&flagWithOffset, slotFlag, __ATOMIC_RELEASE);
+        (void)__atomic_fetch_or(&flagWithOffset, addBit, __ATOMIC_ACQ_REL);
     }
 
     void ClearFlagBit(SlotFlag delBit)
     {
-        SlotFlag slotFlag = __atomic_load_n(&flagWithOffset, __ATOMIC_ACQUIRE);
-        CLEARFLAG(slotFlag, delBit);
-        __atomic_store_n(&flagWithOffset, slotFlag, __ATOMIC_RELEASE);
+        (void)__atomic_fetch_and(&flagWithOffset, ~delBit, __ATOMIC_ACQ_REL);
+    }
+
+    bool TryReserveNextSlot()
+    {
+        SlotFlagOffset val = __atomic_load_n(&flagWithOffset, __ATOMIC_ACQUIRE);
+        if (TESTFLAG(val, NEXT_SLOT_RESERVED_BIT)) {
+            return false;
+        }
+        // Sequentially consistent, the page lock is checked right after, see StreamDataPage::TryReserveNextSlot.
+        return __atomic_compare_exchange_n(&flagWithOffset, &val, val | NEXT_SLOT_RESERVED_BIT, false,
+                                           __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE);
     }
 };
 // Begin memory layout of the page in order. Do NOT add anything that
@@ -381,6 +428,21 @@ public:
     Status Insert(const HeaderAndData &element, uint64_t timeoutMs, InsertFlags &flags,
                   const std::string &logPrefix = "");
 
+    /**
+     * @brief Insert elements of a local producer in order with one reservation of the slot directory,
+     * as many as the free space of the page allows.
+     * @param[in] elements header + data of the elements, the header flag is taken from each element
+     * @param[in] begin index of the first element to insert
+     * @param[in] end index past the last element to insert
+     * @param[in] timeoutMs timeout in millisecond
+     * @param[in/out] flags insert flags shared by the elements
+     * @param[out] numInserted number of elements inserted starting from begin
+     * @param[in] logPrefix
+     * @return K_OK on success; K_NO_SPACE if not even the first element fits; the error code otherwise.
+     */
+    Status Insert(const std::vector<HeaderAndData> &elements, size_t begin, size_t end, uint64_t timeoutMs,
+                  InsertFlags &flags, size_t &numInserted, const std::string &logPrefix = "");
+
     /**
      * @brief Wake up consumer waiting for new element
      */
@@ -452,7 +514,8 @@ public:
     uint32_t GetRefCount() const;
 
     /**
-     * Lock a page exclusively for producer.
+     * Lock a page exclusively for producer. Producers appending without the lock back off when
+     * the lock is held, and we wait for the one that already reserved the next slot to publish it.
      * @param timeoutMs in millisecond
      * @return Status
      * @note Consumer is not affected
@@ -470,6 +533,26 @@ public:
      */
     void TryUnlockByLockId(uint32_t lockId);
 
+    /**
+     * @brief Repair the slots a crashed V3 producer was appending, with or without the page lock.
+     * @param[in] lockId The lock id of the crashed producer.
+     * @param[in] claim The encoded AppendClaim left in the cursor of the crashed producer.
+     * @param[in] timeoutMs Timeout to lock the page if the producer did not hold the lock.
+     * @return Status of the call.
+     * @note The caller must make sure no live producer appends without the page lock, see
+     *       PageQueueHandler::HoldLockFreeAppend.
+     */
+    Status RecoverAppend(uint32_t lockId, uint64_t claim, uint64_t timeoutMs);
+
+    /**
+     * @brief Let Insert append without the page lock when the worker allows it in the cursor of the producer.
+     * @param[in] cursor The cursor of the producer, must outlive the page. Nullptr to always lock the page.
+     */
+    void SetAppendCursor(Cursor *cursor)
+    {
+        appendCursor_ = cursor;
+    }
+
     /**
      * @brief Batch insert.
      * @param[in] buf contiguous payload of the elements in reverse order
@@ -524,6 +607,15 @@ public:
 
     size_t GetTotalEleSize();
 
+    /**
+     * @brief Check if a producer is still writing to the page, i.e. a slot is reserved or not yet consistent.
+     * @return T if a slot is in flight.
+     */
+    bool HasInFlightSlot()
+    {
+        return GetInFlightSlot() != 0;
+    }
+
 private:
     friend class worker::stream_cache::ExclusivePageQueue;
     friend class client::stream_cache::ProducerImpl;
@@ -538,7 +630,20 @@ private:
     SharedMemView *tail_{ nullptr };  // Tail pointer to next page
     std::shared_ptr<SharedMemViewImpl> nextPage_;
     bool isSharedPage_{ false };
+    Cursor *appendCursor_{ nullptr };  // Cursor of the producer, to append without the page lock.
     void UpdateSlotConsistentBit(uint32_t slot);
+    Status BeginAppend(uint64_t timeoutMs, uint32_t &numElement, bool &lockFree);
+    void PublishAppend(uint32_t numElement, uint32_t count, bool lockFree);
+    void AbortAppend(uint32_t numElement, bool lockFree);
+    void SetAppendClaim(AppendClaimState state, uint32_t firstSlot, uint32_t numSlots);
+    bool TryReserveNextSlot(uint32_t &numElement);
+    Status ReserveNextSlot(uint64_t timeoutMs, uint32_t &numElement, bool &reserved);
+    void ReleaseNextSlot(uint32_t slot);
+    Status WaitForNextSlotReleased(uint64_t timeoutMs);
+    bool PageLocked() const;
+    uint32_t GetInFlightSlot();
+    void RepairAbandonedAppend(const AppendClaim &claim);
+    Status CheckElement(const HeaderAndData &element) const;
     Status WaitForNewElement(uint64_t lastRecvCursor, uint64_t timeoutMs);
     SlotOffset GetSlotOffset(size_t index);
     SlotFlag GetSlotFlag(size_t index);
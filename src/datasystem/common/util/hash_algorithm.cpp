@@ -20,6 +20,8 @@
 
 #include "datasystem/common/util/hash_algorithm.h"
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #ifdef WITH_TESTS
 #include "datasystem/common/inject/inject_point.h"
@@ -64,6 +66,44 @@ inline uint32_t GetRemain(const uint8_t *remain, uint8_t mod)
     }
     return k;
 }
+
+// Strings hashed side by side by MurmurHash3_32Batch.
+constexpr size_t HASH_LANES = 4;
+
+// Same as Rotl, without the branch so that the lanes vectorize.
+inline uint32_t RotlLane(uint32_t val, uint8_t r)
+{
+    return (val << r) | (val >> (32 - r));  // 32: std::numeric_limits<decltype(val)>::digits
+}
+
+inline uint32_t MixBlock(uint32_t result, const uint8_t *block)
+{
+    uint32_t k;
+    std::memcpy(&k, block, sizeof(k));
+    k *= C1;
+    k = RotlLane(k, R1);
+    k *= C2;
+    result ^= k;
+    result = RotlLane(result, R2);
+    return result * M + N;
+}
+
+// Mix the blocks from offset on and the remaining <=3 bytes, the avalanche is left to the caller.
+inline uint32_t MixTail(const uint8_t *data, size_t len, size_t offset, uint32_t result)
+{
+    for (; offset + sizeof(uint32_t) <= len; offset += sizeof(uint32_t)) {
+        result = MixBlock(result, data + offset);
+    }
+    const uint8_t mod = len & 3;
+    if (mod != 0) {
+        uint32_t k = GetRemain(data + offset, mod);
+        k *= C1;
+        k = RotlLane(k, R1);
+        k *= C2;
+        result ^= k;
+    }
+    return result ^ static_cast<uint32_t>(len);
+}
 }  // namespace
 
 namespace datasystem {
@@ -156,4 +196,59 @@ uint32_t MurmurHash3_32(const uint8_t *data, size_t len, uint32_t seed)
 #endif
     return Fmix(result);
 }
+
+namespace {
+#ifdef WITH_TESTS
+bool NodeRedirectInjected(const uint8_t *data, size_t len, uint32_t &hash)
+{
+    INJECT_POINT("add.node.redirect", [data, len, &hash]() {
+        hash = GetNodeRedirectForInject(data, len);
+        return true;
+    });
+    return false;
+}
+#endif
+
+inline uint32_t FinishHash(const uint8_t *data, size_t len, uint32_t result)
+{
+#ifdef WITH_TESTS
+    uint32_t redirected;
+    if (NodeRedirectInjected(data, len, redirected)) {
+        return redirected;
+    }
+    return MurmurHash3InjectOverride(data, len, result);
+#endif
+    return Fmix(result);
+}
+}  // namespace
+
+void MurmurHash3_32Batch(const std::string *keys, size_t count, uint32_t *hashes)
+{
+    size_t i = 0;
+    for (; i + HASH_LANES <= count; i += HASH_LANES) {
+        const uint8_t *data[HASH_LANES];
+        uint32_t result[HASH_LANES] = {};
+        size_t commonBlocks = std::numeric_limits<size_t>::max();
+        for (size_t lane = 0; lane < HASH_LANES; ++lane) {
+            data[lane] = reinterpret_cast<const uint8_t *>(keys[i + lane].data());
+            commonBlocks = std::min(commonBlocks, keys[i + lane].size() / sizeof(uint32_t));
+        }
+        // The lanes are independent, mixing them in lockstep keeps the multipliers busy and lets the compiler
+        // vectorize the loop. Batched keys usually share a format, so few blocks are left to mix one lane at a time.
+        for (size_t offset = 0; offset < commonBlocks * sizeof(uint32_t); offset += sizeof(uint32_t)) {
+            for (size_t lane = 0; lane < HASH_LANES; ++lane) {
+                result[lane] = MixBlock(result[lane], data[lane] + offset);
+            }
+        }
+        for (size_t lane = 0; lane < HASH_LANES; ++lane) {
+            const size_t len = keys[i + lane].size();
+            hashes[i + lane] =
+                FinishHash(data[lane], len, MixTail(data[lane], len, commonBlocks * sizeof(uint32_t), result[lane]));
+        }
+    }
+    for (; i < count; ++i) {
+        const auto *data = reinterpret_cast<const uint8_t *>(keys[i].data());
+        hashes[i] = FinishHash(data, keys[i].size(), MixTail(data, keys[i].size(), 0, 0));
+    }
+}
 }  // namespace datasystem
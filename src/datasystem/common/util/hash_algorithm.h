@@ -45,6 +45,14 @@ inline uint32_t MurmurHash3_32(const std::string &data)
     return MurmurHash3_32(reinterpret_cast<const uint8_t *>(data.data()), data.size());
 }
 
+/**
+ * @brief Get murmurhash3 results of many strings, hashing several strings side by side.
+ * @param[in] keys Strings to be hashed.
+ * @param[in] count The number of strings.
+ * @param[out] hashes Hash results, hashes[i] equals MurmurHash3_32(keys[i]).
+ */
+void MurmurHash3_32Batch(const std::string *keys, size_t count, uint32_t *hashes);
+
 }  // namespace datasystem
 
 #endif  // DATASYSTEM_COMMON_UTIL_HASH_ALGORITHM_H
\ No newline at end of file
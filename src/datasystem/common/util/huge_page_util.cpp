@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Huge page utility for shared memory mappings.
+ */
+#include "datasystem/common/util/huge_page_util.h"
+
+#ifdef __linux__
+#include <linux/memfd.h>
+#endif
+#include <sys/mman.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+
+#include "datasystem/common/log/log.h"
+#include "datasystem/common/util/strings_util.h"
+
+#ifndef HUGETLBFS_MAGIC
+#define HUGETLBFS_MAGIC 0x958458f6
+#endif
+
+namespace datasystem {
+namespace {
+constexpr uint64_t KB = 1024;
+
+bool IsPowerOfTwo(uint64_t value)
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+// Read the value of a "Key:   <n> kB" line.
+bool ParseKbField(const std::string &line, const std::string &key, uint64_t &bytes)
+{
+    if (line.compare(0, key.size(), key) != 0) {
+        return false;
+    }
+    std::istringstream in(line.substr(key.size()));
+    uint64_t kb = 0;
+    if (!(in >> kb)) {
+        return false;
+    }
+    bytes = kb * KB;
+    return true;
+}
+}  // namespace
+
+uint64_t GetDefaultHugePageSize()
+{
+    std::ifstream in("/proc/meminfo");
+    std::string line;
+    uint64_t bytes = 0;
+    while (std::getline(in, line)) {
+        if (ParseKbField(line, "Hugepagesize:", bytes)) {
+            return bytes;
+        }
+    }
+    return 0;
+}
+
+Status GetHugeTlbMemfdFlags(uint64_t pageSize, unsigned int &flags)
+{
+#ifdef MFD_HUGETLB
+    flags = MFD_HUGETLB;
+    if (pageSize == 0) {
+        return Status::OK();
+    }
+    CHECK_FAIL_RETURN_STATUS(IsPowerOfTwo(pageSize), StatusCode::K_INVALID,
+                             FormatString("Huge page size %lu is not a power of two", pageSize));
+#ifdef MFD_HUGE_SHIFT
+    // The log2 of the page size is encoded in the bits above MFD_HUGE_SHIFT.
+    flags |= static_cast<unsigned int>(__builtin_ctzll(pageSize)) << MFD_HUGE_SHIFT;
+    return Status::OK();
+#else
+    CHECK_FAIL_RETURN_STATUS(pageSize == GetDefaultHugePageSize(), StatusCode::K_RUNTIME_ERROR,
+                             FormatString("Huge page size %lu is not the system default and cannot be selected",
+                                          pageSize));
+    return Status::OK();
+#endif
+#else
+    (void)pageSize;
+    (void)flags;
+    RETURN_STATUS(StatusCode::K_RUNTIME_ERROR, "Huge tlb not support!");
+#endif
+}
+
+uint64_t GetHugeTlbPageSize(int fd)
+{
+    struct statfs fsInfo {};
+    if (fd < 0 || fstatfs(fd, &fsInfo) != 0) {
+        return 0;
+    }
+    if (static_cast<uint64_t>(fsInfo.f_type) != HUGETLBFS_MAGIC) {
+        return 0;
+    }
+    return static_cast<uint64_t>(fsInfo.f_bsize);
+}
+
+void *MmapAligned(size_t length, int prot, int flags, int fd, size_t alignment)
+{
+    const auto pageSize = static_cast<size_t>(getpagesize());
+    if (alignment <= pageSize || length < alignment) {
+        return mmap(nullptr, length, prot, flags, fd, 0);
+    }
+    // Reserve enough address space to find an aligned start, map the file over it, then give back the slack.
+    const size_t reserveLength = length + alignment;
+    void *reserved = mmap(nullptr, reserveLength, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (reserved == MAP_FAILED) {
+        return mmap(nullptr, length, prot, flags, fd, 0);
+    }
+    const auto start = reinterpret_cast<uintptr_t>(reserved);
+    const uintptr_t aligned = AlignUp(start, alignment);
+    void *pointer = mmap(reinterpret_cast<void *>(aligned), length, prot, flags | MAP_FIXED, fd, 0);
+    if (pointer == MAP_FAILED) {
+        int err = errno;
+        (void)munmap(reserved, reserveLength);
+        errno = err;
+        return MAP_FAILED;
+    }
+    if (aligned > start) {
+        (void)munmap(reserved, aligned - start);
+    }
+    const uintptr_t end = aligned + length;
+    const uintptr_t reservedEnd = start + reserveLength;
+    if (reservedEnd > end) {
+        (void)munmap(reinterpret_cast<void *>(end), reservedEnd - end);
+    }
+    return pointer;
+}
+
+void ParseHugePageUsage(const std::string &content, HugePageUsage &usage)
+{
+    usage = HugePageUsage();
+    std::istringstream in(content);
+    std::string line;
+    uint64_t bytes = 0;
+    while (std::getline(in, line)) {
+        if (ParseKbField(line, "Shared_Hugetlb:", bytes) || ParseKbField(line, "Private_Hugetlb:", bytes)) {
+            usage.hugeTlbBytes += bytes;
+        } else if (ParseKbField(line, "ShmemPmdMapped:", bytes)) {
+            usage.shmemPmdMappedBytes += bytes;
+        }
+    }
+}
+
+Status ReadHugePageUsage(HugePageUsage &usage)
+{
+    const std::string path = "/proc/self/smaps_rollup";
+    std::ifstream in(path);
+    CHECK_FAIL_RETURN_STATUS(in.is_open(), StatusCode::K_IO_ERROR,
+                             FormatString("Open %s failed: %s", path, StrErr(errno)));
+    std::ostringstream content;
+    content << in.rdbuf();
+    ParseHugePageUsage(content.str(), usage);
+    return Status::OK();
+}
+}  // namespace datasystem
@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Huge page utility for shared memory mappings.
+ */
+#ifndef DATASYSTEM_COMMON_UTIL_HUGE_PAGE_UTIL_H
+#define DATASYSTEM_COMMON_UTIL_HUGE_PAGE_UTIL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "datasystem/common/util/status_helper.h"
+
+namespace datasystem {
+// Size of a PMD-mapped page, the only size transparent huge pages are mapped with.
+constexpr uint64_t PMD_HUGE_PAGE_SIZE = 2ul * 1024 * 1024;
+
+struct HugePageUsage {
+    // Bytes of hugetlbfs pages mapped by this process.
+    uint64_t hugeTlbBytes = 0;
+    // Bytes of shmem mapped with transparent huge pages by this process.
+    uint64_t shmemPmdMappedBytes = 0;
+};
+
+/**
+ * @brief Round size up to a multiple of alignment.
+ * @param[in] size The size to round.
+ * @param[in] alignment The alignment, a power of two.
+ * @return The rounded size.
+ */
+inline uint64_t AlignUp(uint64_t size, uint64_t alignment)
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief Get the default huge page size of the system.
+ * @return The size in bytes, 0 if the system has no hugetlb support.
+ */
+uint64_t GetDefaultHugePageSize();
+
+/**
+ * @brief Build the memfd_create flags selecting a hugetlb page size.
+ * @param[in] pageSize Huge page size in bytes, 0 for the system default.
+ * @param[out] flags MFD_HUGETLB with the page size encoded.
+ * @return K_OK on success; K_INVALID if pageSize is not a power of two; K_RUNTIME_ERROR if hugetlb is not supported.
+ */
+Status GetHugeTlbMemfdFlags(uint64_t pageSize, unsigned int &flags);
+
+/**
+ * @brief Get the huge page size backing a file descriptor.
+ * @param[in] fd The file descriptor.
+ * @return The huge page size in bytes for a hugetlbfs file, 0 for any other file.
+ */
+uint64_t GetHugeTlbPageSize(int fd);
+
+/**
+ * @brief Map a file at an address aligned to alignment, so the kernel can map its huge pages with one entry each.
+ * @param[in] length The mapping length.
+ * @param[in] prot The mmap protection.
+ * @param[in] flags The mmap flags, MAP_FIXED is not allowed.
+ * @param[in] fd The file descriptor.
+ * @param[in] alignment The address alignment, a power of two.
+ * @return The mapped address, MAP_FAILED with errno set on failure.
+ */
+void *MmapAligned(size_t length, int prot, int flags, int fd, size_t alignment);
+
+/**
+ * @brief Parse the huge page fields of /proc/<pid>/smaps_rollup.
+ * @param[in] content The file content.
+ * @param[out] usage The parsed usage.
+ */
+void ParseHugePageUsage(const std::string &content, HugePageUsage &usage);
+
+/**
+ * @brief Read the huge page usage of the current process.
+ * @param[out] usage The huge page usage.
+ * @return K_OK on success; the error code otherwise.
+ */
+Status ReadHugePageUsage(HugePageUsage &usage);
+}  // namespace datasystem
+#endif
@@ -31,6 +31,7 @@
 #include "datasystem/common/log/operation_logger.h"
 #include "datasystem/common/log/trace.h"
 #include "datasystem/common/metrics/kv_metrics.h"
+#include "datasystem/common/metrics/open_metrics_server.h"
 #include "datasystem/common/signal/signal.h"
 #include "datasystem/common/util/net_util.h"
 #include "datasystem/common/util/status_helper.h"
@@ -160,6 +161,7 @@ Status CoordinatorRuntime::InitAndRunInternal(const CoordinatorOptions *options)
 
         OperationLogger::Instance().LogConfigInit(runtimeFlags_->GetAllFlagsStr());
         RETURN_IF_NOT_OK_APPEND_MSG(metrics::InitKvMetrics(), "\nCoordinator metrics initialization failed.");
+        RETURN_IF_NOT_OK_APPEND_MSG(OpenMetricsServer::Instance().Start(), "\nCoordinator metrics endpoint failed.");
 
         auto raftFlags = GetRaftFlags();
         HostPort localAddress;
@@ -194,6 +196,7 @@ Status CoordinatorRuntime::InitAndRunInternal(const CoordinatorOptions *options)
     DisableConfigUpdates();
     PreserveFirstError(firstError, InvokeOnStop(), "Coordinator lifecycle onStop");
     PreserveFirstError(firstError, ShutdownService(), "Coordinator service shutdown");
+    OpenMetricsServer::Instance().Stop();
     // Snapshot only after RPC ingress and watch dispatch are stopped, so the final delta includes drained work.
     metrics::PrintSummary();
     return firstError;
@@ -20,6 +20,7 @@
 #include "datasystem/cluster/model/topology_diagnostics.h"
 #include "datasystem/cluster/repository/topology_key_helper.h"
 #include "datasystem/cluster/repository/topology_repository_codec.h"
+#include "datasystem/common/flags/common_flags.h"
 #include "datasystem/common/inject/inject_point.h"
 #include "datasystem/common/log/log.h"
 #include "datasystem/common/util/raii.h"
@@ -665,7 +666,7 @@ Status TopologyControlHost::ReadCurrentMemberships(const std::string &clusterNam
     for (const auto &[address, bytes] : values) {
         cluster::MembershipValue value;
         RETURN_IF_NOT_OK(cluster::MembershipValueCodec::Decode(bytes, value));
-        memberships.push_back({ address, value.lifecycleState, value.timestamp, value.hostId });
+        memberships.push_back({ address, value.lifecycleState, value.timestamp, value.hostId, value.capacityMb });
     }
     return Status::OK();
 }
@@ -1005,9 +1006,11 @@ Status TopologyControlHost::StartRuntime(ClusterEntry &entry)
     runtimeOptions.janitor = cluster::TopologyTaskJanitorOptions{
         COORDINATOR_JANITOR_INTERVAL, COORDINATOR_JANITOR_SCAN_LIMIT, COORDINATOR_JANITOR_DELETE_BATCH
     };
+    const cluster::IPlanningAlgorithm *planning = nullptr;
+    RETURN_IF_NOT_OK(entry.algorithms.GetPlanning(FLAGS_cluster_placement_algorithm, planning));
     std::unique_ptr<cluster::TopologyControllerRuntime> runtime;
-    RETURN_IF_NOT_OK(cluster::TopologyControllerRuntime::Create(
-        std::move(runtimeOptions), *backend, entry.algorithm, runtime));
+    RETURN_IF_NOT_OK(
+        cluster::TopologyControllerRuntime::Create(std::move(runtimeOptions), *backend, *planning, runtime));
     entry.backend = std::move(backend);
     entry.runtime = std::move(runtime);
     INJECT_POINT_NO_RETURN("TopologyControlHost.StartRuntime.afterPublish", [](const std::string &kind) {
@@ -21,7 +21,7 @@
 #include <unordered_set>
 #include <vector>
 
-#include "datasystem/cluster/algorithm/hash_algorithm.h"
+#include "datasystem/cluster/algorithm/algorithm_catalog.h"
 #include "datasystem/cluster/control/topology_controller_runtime.h"
 #include "datasystem/cluster/membership/membership_types.h"
 #include "datasystem/cluster/model/topology_snapshot.h"
@@ -171,7 +171,7 @@ private:
         ClusterEntry &operator=(const ClusterEntry &) = delete;
 
         std::string clusterName;
-        cluster::HashAlgorithm algorithm;
+        cluster::AlgorithmCatalog algorithms;
         std::unique_ptr<CoordinatorStoreBackend> backend;
         std::unique_ptr<cluster::TopologyControllerRuntime> runtime;
         EntryState state{ EntryState::RESERVED };
@@ -21,8 +21,10 @@
 #include <jni.h>
 
 #include <string>
+#include <vector>
 
 #include "datasystem/common/log/log.h"
+#include "datasystem/common/util/raii.h"
 #include "datasystem/java_api/jni_util.h"
 #include "datasystem/stream/consumer.h"
 #include "datasystem/stream/producer.h"
@@ -108,6 +110,60 @@ JNIEXPORT void JNICALL Java_org_yuanrong_datasystem_stream_ProducerImpl_sendDire
     body = NULL;
 }
 
+JNIEXPORT void JNICALL Java_org_yuanrong_datasystem_stream_ProducerImpl_sendBatch(JNIEnv *env, jclass, jlong handle,
+                                                                              jobjectArray elementArray,
+                                                                              jlongArray lenArray, jint timeoutMs)
+{
+    VLOG(LOG_LEVEL) << "JNICALL ProducerImpl.sendBatch";
+    auto producer = reinterpret_cast<std::shared_ptr<Producer> *>(handle);
+    jsize count = env->GetArrayLength(elementArray);
+    std::vector<jlong> lens(count);
+    env->GetLongArrayRegion(lenArray, 0, count, lens.data());
+    // Every heap buffer keeps its local reference until the batch is sent, which can exceed the default
+    // capacity of local references. The JVM has thrown OutOfMemoryError if the frame can't be allocated.
+    if (env->PushLocalFrame(count + 1) != 0) {
+        return;
+    }
+    jclass byteArrayClass = env->FindClass("[B");
+    // Heap buffers are pinned until the batch is sent, they are only read so the release skips the copy back.
+    std::vector<std::pair<jbyteArray, jbyte *>> heapArrays;
+    Raii releaseHeapArrays([env, &heapArrays, byteArrayClass]() {
+        for (auto &heapArray : heapArrays) {
+            env->ReleaseByteArrayElements(heapArray.first, heapArray.second, JNI_ABORT);
+            env->DeleteLocalRef(heapArray.first);
+        }
+        env->DeleteLocalRef(byteArrayClass);
+        (void)env->PopLocalFrame(nullptr);
+    });
+    std::vector<Element> elements;
+    elements.reserve(count);
+    for (jsize i = 0; i < count; i++) {
+        jobject obj = env->GetObjectArrayElement(elementArray, i);
+        uint8_t *ptr = nullptr;
+        if (env->IsInstanceOf(obj, byteArrayClass)) {
+            auto bytes = static_cast<jbyteArray>(obj);
+            jbyte *bytekey = env->GetByteArrayElements(bytes, 0);
+            if (bytekey == nullptr) {
+                env->DeleteLocalRef(obj);
+                ThrowException(env, -1, "An empty array is passed in the Java layer.");
+                return;
+            }
+            heapArrays.emplace_back(bytes, bytekey);
+            ptr = reinterpret_cast<uint8_t *>(bytekey);
+        } else {
+            ptr = static_cast<uint8_t *>(env->GetDirectBufferAddress(obj));
+            env->DeleteLocalRef(obj);
+            if (ptr == nullptr) {
+                ThrowException(env, -1, "cannot get element address");
+                return;
+            }
+        }
+        elements.emplace_back(ptr, lens[i]);
+    }
+    auto rc = timeoutMs < 0 ? (*producer)->SendBatch(elements) : (*producer)->SendBatch(elements, timeoutMs);
+    JNI_CHECK_RESULT(env, rc, (void)0);
+}
+
 JNIEXPORT void JNICALL Java_org_yuanrong_datasystem_stream_ProducerImpl_close(JNIEnv *env, jclass, jlong handle)
 {
     TraceGuard traceGuard = Trace::Instance().SetRequestTraceUUID();
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Cluster-wide transfer planner for object-cache memory rebalance.
+ */
+
+#include "datasystem/master/memory_rebalance_planner.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace datasystem {
+namespace master {
+namespace {
+constexpr uint64_t PERCENT_BASE = 100;
+
+uint64_t SubOrZero(uint64_t lhs, uint64_t rhs)
+{
+    return lhs > rhs ? lhs - rhs : 0;
+}
+
+uint64_t AddOrMax(uint64_t lhs, uint64_t rhs)
+{
+    return lhs > std::numeric_limits<uint64_t>::max() - rhs ? std::numeric_limits<uint64_t>::max() : lhs + rhs;
+}
+
+struct PlanSlot {
+    const MemoryRebalancePlanner::NodeLoad *node = nullptr;
+    uint64_t usageRate = 0;
+    // Bytes the node may still send (source) or receive (target) in this round.
+    uint64_t budget = 0;
+};
+}  // namespace
+
+uint64_t MemoryRebalancePlanner::UsageRate(uint64_t usedMemory, uint64_t memoryLimit)
+{
+    if (memoryLimit == 0 || usedMemory > std::numeric_limits<uint64_t>::max() / PERCENT_BASE) {
+        return PERCENT_BASE;
+    }
+    return std::min<uint64_t>(PERCENT_BASE, usedMemory * PERCENT_BASE / memoryLimit);
+}
+
+std::vector<MemoryRebalancePlanner::Transfer> MemoryRebalancePlanner::Plan(const std::vector<NodeLoad> &nodes,
+                                                                          const Options &options)
+{
+    std::vector<Transfer> transfers;
+    // Every node converges toward the same usage ratio, so its fair share is limit * totalUsed / totalLimit. In-flight
+    // bytes are still part of their source's used memory, so the sum counts them exactly once.
+    long double totalUsed = 0;
+    long double totalLimit = 0;
+    for (const auto &node : nodes) {
+        if (node.memoryLimit == 0) {
+            continue;
+        }
+        totalUsed += static_cast<long double>(node.usedMemory);
+        totalLimit += static_cast<long double>(node.memoryLimit);
+    }
+    if (totalLimit == 0) {
+        return transfers;
+    }
+    const long double meanRatio = totalUsed / totalLimit;
+
+    std::vector<PlanSlot> sources;
+    std::vector<PlanSlot> targets;
+    for (const auto &node : nodes) {
+        if (node.memoryLimit == 0) {
+            continue;
+        }
+        const auto fairShare = static_cast<uint64_t>(meanRatio * static_cast<long double>(node.memoryLimit));
+        const uint64_t usageRate = UsageRate(node.usedMemory, node.memoryLimit);
+        if (node.canSend && usageRate >= options.sourceUsagePercent) {
+            uint64_t surplus = std::min(SubOrZero(node.usedMemory, fairShare), options.maxOutBytesPerRound);
+            if (surplus > 0) {
+                sources.push_back({ &node, usageRate, surplus });
+            }
+            continue;
+        }
+        if (!node.canReceive) {
+            continue;
+        }
+        const uint64_t projectedUsed = AddOrMax(node.usedMemory, node.inboundBytes);
+        const uint64_t watermarkBytes = node.memoryLimit * options.sourceUsagePercent / PERCENT_BASE;
+        const uint64_t deficit =
+            std::min({ SubOrZero(fairShare, projectedUsed), SubOrZero(watermarkBytes, projectedUsed),
+                       SubOrZero(node.availableMemory, node.inboundBytes),
+                       SubOrZero(options.maxInBytesPerRound, node.inboundBytes) });
+        if (deficit > 0) {
+            targets.push_back({ &node, usageRate, deficit });
+        }
+    }
+
+    std::sort(sources.begin(), sources.end(), [](const PlanSlot &lhs, const PlanSlot &rhs) {
+        if (lhs.usageRate != rhs.usageRate) {
+            return lhs.usageRate > rhs.usageRate;
+        }
+        return lhs.node->worker < rhs.node->worker;
+    });
+    std::sort(targets.begin(), targets.end(), [](const PlanSlot &lhs, const PlanSlot &rhs) {
+        if (lhs.usageRate != rhs.usageRate) {
+            return lhs.usageRate < rhs.usageRate;
+        }
+        return lhs.node->worker < rhs.node->worker;
+    });
+
+    // Pair the hottest remaining source with the coldest remaining target. Both lists are monotonic in usage, so
+    // once a pair misses the usage gap every later pair misses it too.
+    size_t sourceIndex = 0;
+    size_t targetIndex = 0;
+    while (sourceIndex < sources.size() && targetIndex < targets.size()) {
+        auto &source = sources[sourceIndex];
+        auto &target = targets[targetIndex];
+        if (source.usageRate < AddOrMax(target.usageRate, options.usageGapPercent)) {
+            break;
+        }
+        const uint64_t bytes = std::min(source.budget, target.budget);
+        transfers.push_back({ source.node->worker, target.node->worker, bytes });
+        source.budget -= bytes;
+        target.budget -= bytes;
+        if (source.budget == 0) {
+            ++sourceIndex;
+        }
+        if (target.budget == 0) {
+            ++targetIndex;
+        }
+    }
+    return transfers;
+}
+}  // namespace master
+}  // namespace datasystem
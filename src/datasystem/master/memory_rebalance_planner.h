@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Cluster-wide transfer planner for object-cache memory rebalance.
+ */
+#ifndef DATASYSTEM_MASTER_MEMORY_REBALANCE_PLANNER_H
+#define DATASYSTEM_MASTER_MEMORY_REBALANCE_PLANNER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace datasystem {
+namespace master {
+class MemoryRebalancePlanner {
+public:
+    struct NodeLoad {
+        std::string worker;
+        uint64_t usedMemory = 0;
+        uint64_t availableMemory = 0;
+        uint64_t memoryLimit = 0;
+        // Bytes already charged to this node as a rebalance target (active + held in-flight).
+        uint64_t inboundBytes = 0;
+        bool canSend = false;
+        bool canReceive = false;
+    };
+
+    struct Options {
+        // Usage percent at or above which a node may send; also the ceiling for a receiving node.
+        uint32_t sourceUsagePercent = 0;
+        // Minimum usage percent gap between a source and a target of one transfer.
+        uint32_t usageGapPercent = 0;
+        // Per-node bandwidth caps for one planning round.
+        uint64_t maxOutBytesPerRound = 0;
+        uint64_t maxInBytesPerRound = 0;
+    };
+
+    struct Transfer {
+        std::string source;
+        std::string target;
+        uint64_t bytes = 0;
+    };
+
+    /**
+     * @brief Compute one round of transfers that moves every node toward the cluster mean usage.
+     * @param[in] nodes Usage of all nodes that take part in rebalance; a node that can neither send nor receive
+     *                  still counts towards the mean.
+     * @param[in] options Thresholds and per-node bandwidth caps of the round.
+     * @return Transfers ordered by source usage, hottest source first. A source may feed several targets and a
+     *         target may receive from several sources, but no node exceeds its in/out cap and no target is planned
+     *         past the mean, its watermark or its available memory.
+     */
+    static std::vector<Transfer> Plan(const std::vector<NodeLoad> &nodes, const Options &options);
+
+    /**
+     * @brief Usage percent of a node, 100 when the limit is unknown.
+     */
+    static uint64_t UsageRate(uint64_t usedMemory, uint64_t memoryLimit);
+};
+}  // namespace master
+}  // namespace datasystem
+#endif
@@ -222,6 +222,7 @@ Status MemoryRebalanceScheduler::ReportResult(const master::ReportRebalanceResul
     CHECK_FAIL_RETURN_STATUS(!req.source_worker().empty(), K_INVALID, "The rebalance source worker can not be empty");
     CHECK_FAIL_RETURN_STATUS(IsTerminalStatus(req.status()), K_INVALID, "The rebalance task status is not terminal");
 
+    auto topologySnapshot = FLAGS_rebalance_global_plan ? GetTopologySnapshot() : nullptr;
     uint64_t nowMs = GetSteadyClockTimeStampMs();
     std::lock_guard<std::mutex> lock(mutex_);
     ExpireTimeoutTasksLocked(nowMs);
@@ -253,6 +254,11 @@ Status MemoryRebalanceScheduler::ReportResult(const master::ReportRebalanceResul
     RemoveTaskLocked(req.source_worker(), nowMs, succeeded, req.failure_side());
 
     ProcessFreshFeedbackLocked(prevTask, req, nowMs, rsp);
+    // A partial batch means the source ran out of candidates, so its remaining planned transfers would fail too.
+    if (FLAGS_rebalance_global_plan && succeeded && !rsp.has_next_rebalance_task()
+        && req.migrated_bytes() >= prevTask.task.max_bytes()) {
+        DispatchNextPlannedTaskLocked(req.source_worker(), req.task_id(), nowMs, topologySnapshot.get(), rsp);
+    }
     return Status::OK();
 }
 
@@ -601,6 +607,13 @@ bool MemoryRebalanceScheduler::IsSourceCandidateLocked(
            && !IsInCooldownLocked(node.nodeId, nowMs);
 }
 
+bool MemoryRebalanceScheduler::IsTargetCandidateLocked(
+    const NodeInfo &node, uint64_t nowMs, const cluster::TopologySnapshot *topologySnapshot) const
+{
+    return node.isReady && IsWorkerActiveInTopology(node.nodeId, topologySnapshot) && node.memoryLimit > 0
+           && !IsInCooldownLocked(node.nodeId, nowMs);
+}
+
 void MemoryRebalanceScheduler::CollectWorkerCandidatesLocked(const std::unordered_map<std::string, NodeInfo> &snapshot,
                                                              const std::string &sourceWorker, uint64_t nowMs,
                                                              const cluster::TopologySnapshot *topologySnapshot,
@@ -614,8 +627,7 @@ void MemoryRebalanceScheduler::CollectWorkerCandidatesLocked(const std::unordere
         if (node.nodeId == sourceWorker && IsSourceCandidateLocked(node, nowMs, topologySnapshot)) {
             sources.emplace_back(&node);
         }
-        if (node.isReady && IsWorkerActiveInTopology(node.nodeId, topologySnapshot) && node.memoryLimit > 0
-            && !IsInCooldownLocked(node.nodeId, nowMs)) {
+        if (IsTargetCandidateLocked(node, nowMs, topologySnapshot)) {
             targets.emplace_back(&node);
         }
     }
@@ -703,6 +715,9 @@ Status MemoryRebalanceScheduler::TryBuildTaskLocked(const std::unordered_map<std
 {
     CHECK_FAIL_RETURN_STATUS(snapshot.size() >= MIN_REBALANCE_WORKER_COUNT, K_NOT_FOUND,
                              "No enough workers for memory rebalance");
+    if (FLAGS_rebalance_global_plan) {
+        return TryBuildPlannedTaskLocked(snapshot, sourceWorker, nowMs, topologySnapshot, runningTask);
+    }
 
     std::vector<const NodeInfo *> sources;
     std::vector<const NodeInfo *> targets;
@@ -741,6 +756,150 @@ Status MemoryRebalanceScheduler::TryBuildTaskLocked(const std::unordered_map<std
     return Status::OK();
 }
 
+void MemoryRebalanceScheduler::RefreshPlanLocked(const std::unordered_map<std::string, NodeInfo> &snapshot,
+                                                 uint64_t nowMs, const cluster::TopologySnapshot *topologySnapshot)
+{
+    if (!plannedBySource_.empty() && nowMs - planEpochStartMs_ < REBALANCE_EPOCH_BUDGET_MS) {
+        return;
+    }
+    plannedBySource_.clear();
+    planEpochStartMs_ = nowMs;
+
+    std::vector<MemoryRebalancePlanner::NodeLoad> loads;
+    loads.reserve(snapshot.size());
+    for (const auto &[worker, node] : snapshot) {
+        (void)worker;
+        if (!node.isReady || node.memoryLimit == 0 || !IsWorkerActiveInTopology(node.nodeId, topologySnapshot)) {
+            continue;
+        }
+        MemoryRebalancePlanner::NodeLoad load;
+        load.worker = node.nodeId;
+        load.usedMemory = node.usedMemory;
+        load.availableMemory = node.availableMemory;
+        load.memoryLimit = node.memoryLimit;
+        load.inboundBytes = GetTargetInflightBytesLocked(node.nodeId);
+        load.canSend = IsSourceCandidateLocked(node, nowMs, topologySnapshot);
+        load.canReceive = IsTargetCandidateLocked(node, nowMs, topologySnapshot);
+        loads.emplace_back(std::move(load));
+    }
+    // A worker migrates at most data_migrate_rate_limit_mb per second, so one ResourceReport cycle bounds how many
+    // bytes it can send. The same cap bounds what a target absorbs, so several sources cannot pile onto one worker.
+    const uint64_t rateBytesPerSec = static_cast<uint64_t>(FLAGS_data_migrate_rate_limit_mb) * 1024 * 1024;
+    const uint64_t roundBytes = SaturatingMultiply(rateBytesPerSec, REBALANCE_EPOCH_BUDGET_MS / MS_PER_SECOND);
+    MemoryRebalancePlanner::Options options;
+    options.sourceUsagePercent = FLAGS_rebalance_source_usage_percent;
+    options.usageGapPercent = FLAGS_rebalance_usage_gap_percent;
+    options.maxOutBytesPerRound = roundBytes;
+    options.maxInBytesPerRound = roundBytes;
+    auto transfers = MemoryRebalancePlanner::Plan(loads, options);
+
+    uint64_t plannedBytes = 0;
+    for (const auto &transfer : transfers) {
+        auto targetIt = snapshot.find(transfer.target);
+        if (targetIt == snapshot.end()) {
+            continue;
+        }
+        plannedBySource_[transfer.source].push_back({ targetIt->second, transfer.bytes });
+        plannedBytes = SaturatingAdd(plannedBytes, transfer.bytes);
+    }
+    if (!plannedBySource_.empty()) {
+        LOG(INFO) << FormatString("[MemoryRebalance] plan round workers=%zu sources=%zu transfers=%zu bytes=%lu",
+                                  loads.size(), plannedBySource_.size(), transfers.size(), plannedBytes);
+    }
+}
+
+bool MemoryRebalanceScheduler::PopPlannedTaskLocked(const std::string &sourceWorker, uint64_t nowMs,
+                                                    const cluster::TopologySnapshot *topologySnapshot,
+                                                    RunningTask &runningTask)
+{
+    auto planIt = plannedBySource_.find(sourceWorker);
+    if (planIt == plannedBySource_.end()) {
+        return false;
+    }
+    if (nowMs - planEpochStartMs_ >= REBALANCE_EPOCH_BUDGET_MS) {
+        // The plan was made for an earlier cycle; the next Schedule rebuilds it from a fresh snapshot.
+        plannedBySource_.clear();
+        return false;
+    }
+    auto &queue = planIt->second;
+    bool built = false;
+    while (!queue.empty() && !built) {
+        PlannedTransfer planned = std::move(queue.front());
+        queue.pop_front();
+        const NodeInfo &target = planned.target;
+        if (!IsTargetCandidateLocked(target, nowMs, topologySnapshot)
+            || IsPairInCooldownLocked(sourceWorker, target.nodeId, nowMs)) {
+            continue;
+        }
+        // The planner already left room for the in-flight bytes seen at plan time; re-clamp with the current
+        // in-flight charge so transfers dispatched since then cannot push the target past its watermark.
+        const uint64_t targetInflightBytes = GetTargetInflightBytesLocked(target.nodeId);
+        const uint64_t watermarkBytes = target.memoryLimit * FLAGS_rebalance_source_usage_percent / PERCENT_BASE;
+        const uint64_t headroomToWatermark =
+            SubOrZero(watermarkBytes, SaturatingAdd(target.usedMemory, targetInflightBytes));
+        const uint64_t targetAvailableAfterInFlight = SubOrZero(target.availableMemory, targetInflightBytes);
+        const uint64_t budget = std::min({ planned.bytes, headroomToWatermark, targetAvailableAfterInFlight });
+        if (budget == 0) {
+            continue;
+        }
+        FillTaskProtoLocked(sourceWorker, target.nodeId, std::min(budget, REBALANCE_MAX_BYTES_PER_TASK), nowMs,
+                            runningTask.task);
+        runningTask.targetMemoryLimit = target.memoryLimit;
+        runningTask.targetMemoryCapacity = target.memoryCapacity;
+        runningTask.totalBudget = budget;
+        runningTask.cumulativeMigrated = 0;
+        runningTask.epochStartMs = nowMs;
+        built = true;
+    }
+    if (queue.empty()) {
+        plannedBySource_.erase(planIt);
+    }
+    return built;
+}
+
+Status MemoryRebalanceScheduler::TryBuildPlannedTaskLocked(const std::unordered_map<std::string, NodeInfo> &snapshot,
+                                                           const std::string &sourceWorker, uint64_t nowMs,
+                                                           const cluster::TopologySnapshot *topologySnapshot,
+                                                           RunningTask &runningTask)
+{
+    auto sourceIt = snapshot.find(sourceWorker);
+    CHECK_FAIL_RETURN_STATUS(
+        sourceIt != snapshot.end() && IsSourceCandidateLocked(sourceIt->second, nowMs, topologySnapshot),
+        K_NOT_FOUND, "The reporting worker is not a memory rebalance source");
+    RefreshPlanLocked(snapshot, nowMs, topologySnapshot);
+    CHECK_FAIL_RETURN_STATUS(PopPlannedTaskLocked(sourceWorker, nowMs, topologySnapshot, runningTask), K_NOT_FOUND,
+                             "No planned transfer is left for the memory rebalance source");
+    return Status::OK();
+}
+
+void MemoryRebalanceScheduler::DispatchNextPlannedTaskLocked(const std::string &sourceWorker,
+                                                             const std::string &predecessorTaskId, uint64_t nowMs,
+                                                             const cluster::TopologySnapshot *topologySnapshot,
+                                                             master::ReportRebalanceResultRspPb &rsp)
+{
+    if (activeTasksBySource_.find(sourceWorker) != activeTasksBySource_.end()
+        || IsInCooldownLocked(sourceWorker, nowMs)) {
+        return;
+    }
+    RunningTask runningTask;
+    if (!PopPlannedTaskLocked(sourceWorker, nowMs, topologySnapshot, runningTask)) {
+        return;
+    }
+    const auto &task = runningTask.task;
+    runningTask.dispatched = true;
+    // Same replay contract as a next batch: a retried report of the finished task gets this task again.
+    runningTask.immediatePredecessorTaskId = predecessorTaskId;
+    futureView_[task.target_worker()].inflightBytes =
+        SaturatingAdd(futureView_[task.target_worker()].inflightBytes, task.max_bytes());
+    LOG(INFO) << FormatString(
+        "[MemoryRebalance] assign planned task %s source=%s target=%s max_bytes=%lu total_budget=%lu "
+        "timeout_ms=%lu deadline_ms=%lu",
+        task.task_id(), task.source_worker(), task.target_worker(), task.max_bytes(), runningTask.totalBudget,
+        task.timeout_ms(), task.deadline_ms());
+    *rsp.mutable_next_rebalance_task() = task;
+    activeTasksBySource_.emplace(sourceWorker, std::move(runningTask));
+}
+
 bool MemoryRebalanceScheduler::ShouldStopChainEarlyLocked(const RunningTask &prevTask,
                                                           uint64_t targetRemainBytes,
                                                           uint64_t nowMs) const
@@ -21,6 +21,7 @@
 #define DATASYSTEM_MASTER_MEMORY_REBALANCE_SCHEDULER_H
 
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -31,6 +32,7 @@
 #include "datasystem/cluster/model/topology_snapshot.h"
 #include "datasystem/common/object_cache/node_info.h"
 #include "datasystem/common/util/status_helper.h"
+#include "datasystem/master/memory_rebalance_planner.h"
 #include "datasystem/protos/master_object.pb.h"
 
 namespace datasystem {
@@ -108,6 +110,13 @@ private:
         uint32_t projectedTargetUsageRate = 0;
     };
 
+    // A transfer of the current global plan (FLAGS_rebalance_global_plan) that has not been dispatched yet. The
+    // target view is captured at plan time so ReportResult can chain the source's next transfer without a snapshot.
+    struct PlannedTransfer {
+        NodeInfo target;
+        uint64_t bytes = 0;
+    };
+
     static bool IsTerminalStatus(master::RebalanceTaskStatusPb status);
     static bool IsFailedStatus(master::RebalanceTaskStatusPb status);
     static uint64_t CalculateUsageRate(uint64_t usedMemory, uint64_t memoryLimit);
@@ -154,6 +163,8 @@ private:
                                   const cluster::TopologySnapshot *topologySnapshot) const;
     bool IsSourceCandidateLocked(const NodeInfo &node, uint64_t nowMs,
                                  const cluster::TopologySnapshot *topologySnapshot) const;
+    bool IsTargetCandidateLocked(const NodeInfo &node, uint64_t nowMs,
+                                 const cluster::TopologySnapshot *topologySnapshot) const;
     void CollectWorkerCandidatesLocked(const std::unordered_map<std::string, NodeInfo> &snapshot,
                                        const std::string &sourceWorker, uint64_t nowMs,
                                        const cluster::TopologySnapshot *topologySnapshot,
@@ -169,6 +180,22 @@ private:
     Status TryBuildTaskLocked(const std::unordered_map<std::string, NodeInfo> &snapshot,
                               const std::string &sourceWorker, uint64_t nowMs,
                               const cluster::TopologySnapshot *topologySnapshot, RunningTask &runningTask);
+    // Global plan mode: rebuild the cluster-wide transfer plan from the snapshot once the previous plan is older
+    // than one ResourceReport cycle or fully dispatched. Caller must hold mutex_.
+    void RefreshPlanLocked(const std::unordered_map<std::string, NodeInfo> &snapshot, uint64_t nowMs,
+                           const cluster::TopologySnapshot *topologySnapshot);
+    // Global plan mode: turn the source's next still-valid planned transfer into a task. Returns false when the
+    // source has nothing left in the current plan. Caller must hold mutex_.
+    bool PopPlannedTaskLocked(const std::string &sourceWorker, uint64_t nowMs,
+                              const cluster::TopologySnapshot *topologySnapshot, RunningTask &runningTask);
+    Status TryBuildPlannedTaskLocked(const std::unordered_map<std::string, NodeInfo> &snapshot,
+                                     const std::string &sourceWorker, uint64_t nowMs,
+                                     const cluster::TopologySnapshot *topologySnapshot, RunningTask &runningTask);
+    // Global plan mode: when a source's chain to one target ends, hand it the next planned target right away
+    // instead of waiting for its next ResourceReport. Caller must hold mutex_.
+    void DispatchNextPlannedTaskLocked(const std::string &sourceWorker, const std::string &predecessorTaskId,
+                                       uint64_t nowMs, const cluster::TopologySnapshot *topologySnapshot,
+                                       master::ReportRebalanceResultRspPb &rsp);
     // Build the next 300MB batch task for the same source->target pair from the fixed total
     // budget (set at Schedule) and the fresh per-batch target_remain_bytes. Returns true and
     // fills nextTask when another batch is needed (budget not exhausted and target below the
@@ -213,6 +240,10 @@ private:
         uint64_t holdSinceMs = 0;
     };
     std::unordered_map<std::string, FutureDelta> futureView_;
+    // Global plan mode: undispatched transfers of the current plan per source, and the plan's creation time
+    // (steady-clock ms). Entries older than one ResourceReport cycle are dropped instead of dispatched.
+    std::unordered_map<std::string, std::deque<PlannedTransfer>> plannedBySource_;
+    uint64_t planEpochStartMs_ = 0;
 
 #ifdef WITH_TESTS
     friend class ::datasystem::ut::MemoryRebalanceSchedulerTest;
@@ -660,6 +660,7 @@ Status MasterOCServiceImpl::GIncreaseMasterAppRef(const GIncreaseReqPb &req, GIn
 Status MasterOCServiceImpl::GIncreaseRef(const GIncreaseReqPb &req, GIncreaseRspPb &resp)
 {
     ScopedRequestContext ctx;
+    PerfPoint point(PerfKey::MASTER_GINCREASE_REF);
     Timer timer;
     RETURN_IF_NOT_OK_PRINT_ERROR_MSG(akSkManager_->VerifySignatureAndTimestamp(req), "AK/SK failed.");
     LOG(INFO) << "[Ref] Master received GIncreaseRef request, address:" << req.address()
@@ -687,6 +688,7 @@ Status MasterOCServiceImpl::GDecreaseRef(
     std::shared_ptr<ServerUnaryWriterReader<GDecreaseRspPb, GDecreaseReqPb>> serverApi)
 {
     ScopedRequestContext ctx;
+    PerfPoint point(PerfKey::MASTER_GDECREASE_REF);
     GDecreaseReqPb req;
     RETURN_IF_NOT_OK(serverApi->Read(req));
     RETURN_IF_NOT_OK_PRINT_ERROR_MSG(akSkManager_->VerifySignatureAndTimestamp(req), "AK/SK failed.");
@@ -706,6 +708,7 @@ Status MasterOCServiceImpl::GDecreaseRef(
 Status MasterOCServiceImpl::GDecreaseRef(const GDecreaseReqPb &req, GDecreaseRspPb &resp)
 {
     ScopedRequestContext ctx;
+    PerfPoint point(PerfKey::MASTER_GDECREASE_REF);
     Timer timer;
     RETURN_IF_NOT_OK_PRINT_ERROR_MSG(akSkManager_->VerifySignatureAndTimestamp(req), "AK/SK failed.");
     LOG(INFO) << "[Ref] Master received GDecreaseRef request, address:" << req.address()
@@ -1080,6 +1083,16 @@ Status MasterOCServiceImpl::Expire(const ExpireReqPb &req, ExpireRspPb &rsp)
     return ocMetadataManager->Expire(req, rsp);
 }
 
+Status MasterOCServiceImpl::AcquireFillLease(const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &rsp)
+{
+    ScopedRequestContext ctx;
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(akSkManager_->VerifySignatureAndTimestamp(req), "AK/SK failed.");
+    std::shared_ptr<master::OCMetadataManager> ocMetadataManager;
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(metadataManagerHolder_->GetOcMetadataManager(ocMetadataManager),
+                                     "GetOcMetadataManager failed");
+    return ocMetadataManager->AcquireFillLease(req, rsp);
+}
+
 Status MasterOCServiceImpl::LivenessCheck(const LivenessCheckReqPb &req, LivenessCheckRspPb &rsp)
 {
     ScopedRequestContext ctx;
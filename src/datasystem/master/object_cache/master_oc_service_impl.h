@@ -472,6 +472,14 @@ public:
      */
     Status Expire(const ExpireReqPb &req, ExpireRspPb &rsp) override;
 
+    /**
+     * @brief Acquire the fill lease of a missing object for GetOrCreate.
+     * @param[in] req The rpc req protobuf.
+     * @param[in] rsp The rpc rsp protobuf.
+     * @return K_OK on success; the error code otherwise.
+     */
+    Status AcquireFillLease(const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &rsp) override;
+
     /**
      * @brief Liveness check.
      * @param[in] req The rpc req protobuf.
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Tracks fill leases of missing objects so only one producer computes each missing value.
+ */
+#include "datasystem/master/object_cache/oc_fill_lease_manager.h"
+
+#include <vector>
+
+namespace datasystem {
+namespace master {
+FillLeaseAcquireResult OCFillLeaseManager::Acquire(const std::string &objectKey, const std::string &address,
+                                                   const std::string &clientId, const std::string &token,
+                                                   uint64_t leaseMs, uint64_t nowMs, uint64_t &remainingMs)
+{
+    TbbFillLeaseTable::accessor accessor;
+    bool inserted = leases_.insert(accessor, objectKey);
+    auto &lease = accessor->second;
+    if (inserted || lease.deadlineMs <= nowMs) {
+        lease.address = address;
+        lease.clientId = clientId;
+        lease.token = token;
+        lease.deadlineMs = nowMs + leaseMs;
+        remainingMs = leaseMs;
+        return FillLeaseAcquireResult::GRANTED;
+    }
+    remainingMs = lease.deadlineMs - nowMs;
+    return FillLeaseAcquireResult::BEING_FILLED;
+}
+
+bool OCFillLeaseManager::Release(const std::string &objectKey)
+{
+    return leases_.erase(objectKey);
+}
+
+bool OCFillLeaseManager::ReleaseIfHeldBy(const std::string &objectKey, const std::string &token)
+{
+    TbbFillLeaseTable::accessor accessor;
+    if (!leases_.find(accessor, objectKey) || accessor->second.token != token) {
+        return false;
+    }
+    return leases_.erase(accessor);
+}
+
+size_t OCFillLeaseManager::ReleaseByAddress(const std::string &address)
+{
+    std::vector<std::string> objectKeys;
+    for (const auto &kv : leases_) {
+        if (kv.second.address == address) {
+            objectKeys.emplace_back(kv.first);
+        }
+    }
+    size_t count = 0;
+    for (const auto &objectKey : objectKeys) {
+        TbbFillLeaseTable::accessor accessor;
+        if (leases_.find(accessor, objectKey) && accessor->second.address == address) {
+            count += leases_.erase(accessor) ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+size_t OCFillLeaseManager::EraseExpired(uint64_t nowMs)
+{
+    std::vector<std::string> objectKeys;
+    for (const auto &kv : leases_) {
+        if (kv.second.deadlineMs <= nowMs) {
+            objectKeys.emplace_back(kv.first);
+        }
+    }
+    size_t count = 0;
+    for (const auto &objectKey : objectKeys) {
+        TbbFillLeaseTable::accessor accessor;
+        if (leases_.find(accessor, objectKey) && accessor->second.deadlineMs <= nowMs) {
+            count += leases_.erase(accessor) ? 1 : 0;
+        }
+    }
+    return count;
+}
+}  // namespace master
+}  // namespace datasystem
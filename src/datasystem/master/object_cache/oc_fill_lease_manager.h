@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Tracks fill leases of missing objects so only one producer computes each missing value.
+ */
+#ifndef DATASYSTEM_MASTER_OC_FILL_LEASE_MANAGER_H
+#define DATASYSTEM_MASTER_OC_FILL_LEASE_MANAGER_H
+
+#include <cstdint>
+#include <string>
+
+#include <tbb/concurrent_hash_map.h>
+
+namespace datasystem {
+namespace master {
+/*
+ * A fill lease is granted to the first GetOrCreate caller that misses an object. While the lease is alive, other
+ * callers are told the object is being filled and wait for it to be published. The holder is identified by a token
+ * unique to its GetOrCreate call, so concurrent calls from one client never share a lease. The lease ends when:
+ *   1) the holder publishes the object (CreateMeta succeeds),
+ *   2) the worker of the holder times out,
+ *   3) the lease deadline passes, after which the next caller takes it over.
+ */
+enum class FillLeaseAcquireResult : int {
+    GRANTED = 0,       // The caller owns the lease (new or taken over after expiry).
+    BEING_FILLED = 1,  // Another caller owns a live lease.
+};
+
+class OCFillLeaseManager {
+public:
+    OCFillLeaseManager() = default;
+
+    ~OCFillLeaseManager() = default;
+
+    /**
+     * @brief Try to acquire the fill lease of an object. A live lease is never granted again, not even to a caller
+     * presenting the holder's token.
+     * @param[in] objectKey The object key.
+     * @param[in] address The worker address of the caller.
+     * @param[in] clientId The client id of the caller.
+     * @param[in] token The token of the GetOrCreate call.
+     * @param[in] leaseMs The lease duration in milliseconds.
+     * @param[in] nowMs The current steady clock time in milliseconds.
+     * @param[out] remainingMs The remaining lease time of the current holder.
+     * @return GRANTED if the lease was free or expired and now belongs to the caller; BEING_FILLED otherwise.
+     */
+    FillLeaseAcquireResult Acquire(const std::string &objectKey, const std::string &address,
+                                   const std::string &clientId, const std::string &token, uint64_t leaseMs,
+                                   uint64_t nowMs, uint64_t &remainingMs);
+
+    /**
+     * @brief Release the fill lease of an object no matter who holds it, called once the object is published.
+     * @param[in] objectKey The object key.
+     * @return True if a lease was removed.
+     */
+    bool Release(const std::string &objectKey);
+
+    /**
+     * @brief Release the fill lease of an object only if the given call still holds it.
+     * @param[in] objectKey The object key.
+     * @param[in] token The token of the GetOrCreate call.
+     * @return True if the lease was removed.
+     */
+    bool ReleaseIfHeldBy(const std::string &objectKey, const std::string &token);
+
+    /**
+     * @brief Release all fill leases held through a worker, called when the worker times out.
+     * @param[in] address The worker address.
+     * @return The number of released leases.
+     */
+    size_t ReleaseByAddress(const std::string &address);
+
+    /**
+     * @brief Remove the leases whose deadline has passed.
+     * @param[in] nowMs The current steady clock time in milliseconds.
+     * @return The number of removed leases.
+     */
+    size_t EraseExpired(uint64_t nowMs);
+
+    /**
+     * @brief Get the number of tracked leases.
+     * @return The number of leases.
+     */
+    size_t Size() const
+    {
+        return leases_.size();
+    }
+
+private:
+    struct FillLease {
+        std::string address;
+        std::string clientId;
+        std::string token;
+        uint64_t deadlineMs = 0;
+    };
+    using TbbFillLeaseTable = tbb::concurrent_hash_map<std::string, FillLease>;
+
+    TbbFillLeaseTable leases_;
+};
+}  // namespace master
+}  // namespace datasystem
+#endif  // DATASYSTEM_MASTER_OC_FILL_LEASE_MANAGER_H
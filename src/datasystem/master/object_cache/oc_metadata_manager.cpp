@@ -194,6 +194,7 @@ Status OCMetadataManager::Init()
     RETURN_IF_NOT_OK(globalCacheDeleteManager_->Init());
     expiredObjectManager_ = std::make_unique<ExpiredObjectManager>(masterAddress_, this);
     expiredObjectManager_->Init();
+    fillLeaseManager_ = std::make_unique<OCFillLeaseManager>();
     RETURN_IF_NOT_OK(LoadMeta(skipRecoveryFromEtcd));
     RETURN_IF_NOT_OK_PRINT_ERROR_MSG(notifyWorkerManager_->RecoverCacheInvalidAndRemoveMeta(true),
                                      "Recover cache invalid for rocksdb failed.");
@@ -222,6 +223,8 @@ void OCMetadataManager::StartMetaMonitor()
                 continue;
             }
             timer.Reset();
+            const size_t expiredFillLeases =
+                fillLeaseManager_->EraseExpired(static_cast<uint64_t>(GetSteadyClockTimeStampMs()));
             size_t metaTableTotalSize = 0;
             for (const auto &shard : metaShards_) {
                 metaTableTotalSize += shard.table.size();
@@ -234,9 +237,11 @@ void OCMetadataManager::StartMetaMonitor()
             const size_t objectRefTableSize = globalRefTable_->GetObjectRefCount();
             const size_t remoteClientIdTableSize = globalRefTable_->GetRemoteClientCount();
             const size_t deletingObjectCount = globalCacheDeleteManager_->GetDeletingObjectCount();
+            const size_t fillLeaseSize = fillLeaseManager_->Size();
             if (metaTableTotalSize == 0 && request2SubMetaSize == 0 && objKey2ReqIdSize == 0
                 && migratingObjectKeySize == 0 && clientIdRefTableSize == 0 && clientRefTableSize == 0
-                && objectRefTableSize == 0 && remoteClientIdTableSize == 0 && deletingObjectCount == 0) {
+                && objectRefTableSize == 0 && remoteClientIdTableSize == 0 && deletingObjectCount == 0
+                && fillLeaseSize == 0 && expiredFillLeases == 0) {
                 continue;
             }
             std::stringstream ss;
@@ -250,6 +255,7 @@ void OCMetadataManager::StartMetaMonitor()
             ss << ", objectRefTable:" << objectRefTableSize;
             ss << ", remoteClientIdTable:" << remoteClientIdTableSize;
             ss << ", globalCacheDeleteManager:" << deletingObjectCount;
+            ss << ", fillLeases:" << fillLeaseSize << "(expired " << expiredFillLeases << ")";
             ss << "}";
             LOG(INFO) << ss.str();
         }
@@ -1026,6 +1032,7 @@ Status OCMetadataManager::CreateMeta(const CreateMetaReqPb &request, CreateMetaR
         return status;
     }
     RETURN_IF_NOT_OK(status);
+    (void)fillLeaseManager_->Release(objectKey);
     response.set_version(version);
     return Status::OK();
 }
@@ -2614,6 +2621,8 @@ Status OCMetadataManager::AddSubscribeCache(const std::shared_ptr<SubscribeMeta>
 void OCMetadataManager::UpdateSubscribeCache(const std::string &objectKey, const ObjectMeta &objectMeta)
 {
     VLOG(1) << "Update subscribe cache with key: " << objectKey;
+    // The object is readable now, the GetOrCreate fill lease of it is done.
+    (void)fillLeaseManager_->Release(objectKey);
     struct NotifyItem {
         std::string address;
         uint64_t timeoutMs;
@@ -3794,6 +3803,8 @@ Status OCMetadataManager::ProcessWorkerTimeout(const std::string &workerAddr, bo
     LOG(WARNING) << "ProcessWorkerTimeout start. lost worker : " << workerAddr
                  << ", isDead:" << removeFailWorkerMetaData;
     notifyWorkerManager_->SetFaultWorker(workerAddr, removeFailWorkerMetaData);
+    size_t releasedLeases = fillLeaseManager_->ReleaseByAddress(workerAddr);
+    LOG_IF(INFO, releasedLeases > 0) << "Release " << releasedLeases << " fill leases of lost worker " << workerAddr;
     if (removeFailWorkerMetaData) {
         RETURN_IF_NOT_OK_PRINT_ERROR_MSG(notifyWorkerManager_->ClearAsyncWorkerOp(workerAddr),
                                          "ClearAsyncWorkerOp failed in ProcessWorkerTimeout");
@@ -4916,6 +4927,17 @@ Status OCMetadataManager::PureQueryMeta(const PureQueryMetaReqPb &req, PureQuery
                 queryMeta->set_single_copy(
                     accessor->second.IsPrimaryWithoutCopy(accessor->second.meta.primary_address()));
             }
+            if (req.with_locations()) {
+                // Same readability rule as SelectObjectLocation, without excluding the source worker.
+                for (const auto &location : accessor->second.locations) {
+                    if (location.second == AckState::ACK
+                        && !notifyWorkerManager_->CheckExistAsyncWorkerOp(
+                            location.first, objectKey,
+                            NotifyWorkerOpType::CACHE_INVALID | NotifyWorkerOpType::PRIMARY_COPY_INVALID)) {
+                        queryMeta->add_locations(location.first);
+                    }
+                }
+            }
         } else {
             LOG(WARNING) << FormatString("QueryMeta and not found: %s", objectKey);
         }
@@ -5068,6 +5090,60 @@ Status OCMetadataManager::Expire(const ExpireReqPb &req, ExpireRspPb &rsp)
     return Status::OK();
 }
 
+Status OCMetadataManager::AcquireFillLease(const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &rsp)
+{
+    const std::string &objectKey = req.object_key();
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(!objectKey.empty() && !req.address().empty() && !req.lease_token().empty(),
+                                         K_INVALID, "AcquireFillLease: Empty objectKey, worker address or token.");
+    bool redirect = req.redirect();
+    RETURN_IF_NOT_OK(FillObjectRedirectResponse(rsp, objectKey, redirect));
+    RETURN_OK_IF_TRUE(redirect);
+    if (CheckFillLeaseMeta(objectKey, rsp)) {
+        return Status::OK();
+    }
+    uint64_t remainingMs = 0;
+    auto result = fillLeaseManager_->Acquire(objectKey, req.address(), req.client_id(), req.lease_token(),
+                                             req.lease_ms(), static_cast<uint64_t>(GetSteadyClockTimeStampMs()),
+                                             remainingMs);
+    // A Create or Publish may land between the check above and the grant. Its lease release ran before the grant,
+    // so look at the meta again and hand the lease back if the object showed up.
+    if (result == FillLeaseAcquireResult::GRANTED && CheckFillLeaseMeta(objectKey, rsp)) {
+        (void)fillLeaseManager_->ReleaseIfHeldBy(objectKey, req.lease_token());
+        VLOG(1) << FormatString("[ObjectKey %s] AcquireFillLease from %s/%s raced with a publish, state: %s",
+                                objectKey, req.address(), req.client_id(), FillLeaseStatePb_Name(rsp.state()));
+        return Status::OK();
+    }
+    rsp.set_state(result == FillLeaseAcquireResult::GRANTED ? FillLeaseStatePb::FILL_LEASE_GRANTED
+                                                            : FillLeaseStatePb::FILL_LEASE_BEING_FILLED);
+    rsp.set_remaining_ms(remainingMs);
+    VLOG(1) << FormatString("[ObjectKey %s] AcquireFillLease from %s/%s, state: %s, remaining %lu ms", objectKey,
+                            req.address(), req.client_id(), FillLeaseStatePb_Name(rsp.state()), remainingMs);
+    return Status::OK();
+}
+
+bool OCMetadataManager::CheckFillLeaseMeta(const std::string &objectKey, AcquireFillLeaseRspPb &rsp)
+{
+    size_t shardIdx = GetShardIndex(objectKey);
+    bthread::RWLockRdGuard lck(metaShards_[shardIdx].mutex);
+    TbbMetaTable::const_accessor accessor;
+    if (!metaShards_[shardIdx].table.find(accessor, objectKey)) {
+        return false;
+    }
+    const auto &meta = accessor->second;
+    if (meta.multiSetState != IDLE) {
+        // A MSet of this object is in progress, treat it as being filled.
+        rsp.set_state(FillLeaseStatePb::FILL_LEASE_BEING_FILLED);
+        return true;
+    }
+    bool noL2CacheAndNoCopy =
+        meta.locations.empty() && WriteMode(meta.meta.config().write_mode()) == WriteMode::NONE_L2_CACHE;
+    if (!noL2CacheAndNoCopy) {
+        rsp.set_state(FillLeaseStatePb::FILL_LEASE_EXISTS);
+        return true;
+    }
+    return false;
+}
+
 Status OCMetadataManager::LivenessCheck()
 {
     return objectStore_->LivenessCheckRocksdb();
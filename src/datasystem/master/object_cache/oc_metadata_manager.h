@@ -53,6 +53,7 @@
 #include "datasystem/master/metadata_redirect_helper.h"
 #include "datasystem/master/object_cache/expired_object_manager.h"
 #include "datasystem/master/object_cache/master_worker_oc_api.h"
+#include "datasystem/master/object_cache/oc_fill_lease_manager.h"
 #include "datasystem/master/object_cache/oc_global_cache_delete_manager.h"
 #include "datasystem/master/object_cache/oc_nested_manager.h"
 #include "datasystem/master/object_cache/delete_object_mediator.h"
@@ -1482,6 +1483,15 @@ public:
      */
     Status Expire(const ExpireReqPb &req, ExpireRspPb &rsp);
 
+    /**
+     * @brief Acquire the fill lease of a missing object for GetOrCreate.
+     * @param[in] req The request of AcquireFillLease.
+     * @param[out] rsp The response of AcquireFillLease, carries whether the object exists, the lease is granted to
+     * the caller or another caller is filling it.
+     * @return Status of the call.
+     */
+    Status AcquireFillLease(const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &rsp);
+
     /**
      * @brief Liveness check.
      * @return Status of the call.
@@ -1510,6 +1520,14 @@ protected:
 private:
     using PrimaryChangeMap = std::unordered_map<std::string, std::unordered_set<std::string>>;
 
+    /**
+     * @brief Check whether the meta of an object makes a fill lease unnecessary.
+     * @param[in] objectKey The object key.
+     * @param[out] rsp Receives EXISTS or BEING_FILLED when no lease should be granted.
+     * @return True if rsp is filled and no lease should be granted.
+     */
+    bool CheckFillLeaseMeta(const std::string &objectKey, AcquireFillLeaseRspPb &rsp);
+
     /**
      * @brief Apply one restarted-worker effect after batch metadata removal.
      * @param[in] workerAddr Restarted Worker address.
@@ -2189,6 +2207,7 @@ private:
     std::unique_ptr<OCNotifyWorkerManager> notifyWorkerManager_{ nullptr };
     std::unique_ptr<OCGlobalCacheDeleteManager> globalCacheDeleteManager_{ nullptr };
     std::unique_ptr<ExpiredObjectManager> expiredObjectManager_{ nullptr };
+    std::unique_ptr<OCFillLeaseManager> fillLeaseManager_{ nullptr };
     std::shared_ptr<MasterDevOcManager> masterDevOcManager_{ nullptr };
     std::unique_ptr<ThreadPool> asyncTaskPool_{ nullptr };
 
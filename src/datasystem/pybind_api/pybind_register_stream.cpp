@@ -138,6 +138,20 @@ PybindDefineRegisterer g_pybind_define_f_Producer("Producer", PRIORITY_LOW, [](c
                  Element element(static_cast<uint8_t *>(info.ptr), info.size);
                  return producer.Send(element);
              })
+        .def("SendBatch",
+             [](Producer &producer, const std::vector<py::buffer> &bufs, const int timeoutMs) {
+                 TraceGuard traceGuard = Trace::Instance().SetRequestTraceUUID();
+                 // The buffer infos hold the views of the buffers until the batch is sent.
+                 std::vector<py::buffer_info> infos;
+                 std::vector<Element> elements;
+                 infos.reserve(bufs.size());
+                 elements.reserve(bufs.size());
+                 for (const auto &buf : bufs) {
+                     infos.emplace_back(buf.request());
+                     elements.emplace_back(static_cast<uint8_t *>(infos.back().ptr), infos.back().size);
+                 }
+                 return timeoutMs < 0 ? producer.SendBatch(elements) : producer.SendBatch(elements, timeoutMs);
+             })
         .def("Close", [](Producer &producer) {
             TraceGuard traceGuard = Trace::Instance().SetRequestTraceUUID();
             return producer.Close();
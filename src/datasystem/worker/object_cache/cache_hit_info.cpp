@@ -53,5 +53,17 @@ std::string CacheHitInfo::GetHitInfo()
     });
     return res;
 }
+
+std::string CacheHitInfo::RenderOpenMetrics() const
+{
+    return FormatString(
+        "# TYPE datasystem_worker_get_hit counter\n"
+        "datasystem_worker_get_hit_total{tier=\"mem\"} %lu\n"
+        "datasystem_worker_get_hit_total{tier=\"disk\"} %lu\n"
+        "datasystem_worker_get_hit_total{tier=\"l2\"} %lu\n"
+        "datasystem_worker_get_hit_total{tier=\"remote\"} %lu\n"
+        "datasystem_worker_get_hit_total{tier=\"miss\"} %lu\n",
+        memHitNum_.load(), diskHitNum_.load(), l2HitNum_.load(), remoteHitNum_.load(), missNum_.load());
+}
 }  // namespace object_cache
 }  // namespace datasystem
\ No newline at end of file
@@ -60,6 +60,12 @@ public:
      */
     std::string GetHitInfo();
 
+    /**
+     * @brief Render the hit counters as the OpenMetrics counter family datasystem_worker_get_hit.
+     * @return The OpenMetrics text lines, one sample per tier.
+     */
+    std::string RenderOpenMetrics() const;
+
 private:
     std::atomic<uint64_t> memHitNum_ = 0;
     std::atomic<uint64_t> diskHitNum_ = 0;
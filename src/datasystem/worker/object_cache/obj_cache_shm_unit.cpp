@@ -347,14 +347,13 @@ Status AllocateNewShmUnit(const std::string &objectKey, uint64_t dataSize, uint6
     return Status::OK();
 }
 
-Status LoadSpilledObjectToMemory(ReadObjectKV &objectKV, std::shared_ptr<WorkerOcEvictionManager> evictionManager)
+namespace {
+// Make sure the entry has a shm unit to load the spilled data into, newShmUnit is set if it is allocated here.
+Status PrepareSpilledObjectLoad(ReadObjectKV &objectKV, const std::shared_ptr<WorkerOcEvictionManager> &evictionManager,
+                                std::shared_ptr<ShmUnit> &newShmUnit, void *&pointer)
 {
     const auto &objectKey = objectKV.GetObjKey();
     SafeObjType &entry = objectKV.GetObjEntry();
-    // We do not expect that there is already a pointer assigned for a spilled object
-    if (entry->IsShmUnitExistsAndComplete()) {
-        return Status::OK();
-    }
     const uint64_t dataSize = entry->GetDataSize();
     const uint64_t metaSize = entry->GetMetadataSize();
     const uint64_t needSize = dataSize + metaSize;
@@ -362,7 +361,6 @@ Status LoadSpilledObjectToMemory(ReadObjectKV &objectKV, std::shared_ptr<WorkerO
     uint64_t readSize = objectKV.GetReadSize();
     RETURN_IF_NOT_OK_PRINT_ERROR_MSG(objectKV.CheckReadOffset(), "Read offset verify failed.");
     // reuse the incomplete shm unit.
-    std::shared_ptr<ShmUnit> newShmUnit;
     if (entry->GetShmUnit() == nullptr) {
         auto objShmUnit = SafeObjType::GetDerived<ObjCacheShmUnit>(entry);
         RETURN_RUNTIME_ERROR_IF_NULL(objShmUnit);
@@ -385,9 +383,16 @@ Status LoadSpilledObjectToMemory(ReadObjectKV &objectKV, std::shared_ptr<WorkerO
         objectKey, metaSize, dataSize,
         (newShmUnit == nullptr ? std::string() : FormatString("allocate memory size %zu, ", needSize)), isOffsetRead,
         readOffset, readSize);
-    // Load data.
-    auto pointer = static_cast<uint8_t *>(entry->GetShmUnit()->GetPointer()) + entry->GetMetadataSize() + readOffset;
-    Status status = WorkerOcSpill::Instance()->Get(objectKey, pointer, readSize, readOffset);
+    pointer = static_cast<uint8_t *>(entry->GetShmUnit()->GetPointer()) + entry->GetMetadataSize() + readOffset;
+    return Status::OK();
+}
+
+// Release the shm unit allocated for a failed load, or hand the loaded object to the eviction manager.
+Status FinishSpilledObjectLoad(ReadObjectKV &objectKV, const std::shared_ptr<WorkerOcEvictionManager> &evictionManager,
+                               const std::shared_ptr<ShmUnit> &newShmUnit, const Status &status)
+{
+    const auto &objectKey = objectKV.GetObjKey();
+    SafeObjType &entry = objectKV.GetObjEntry();
     if (status.IsError()) {
         LOG(ERROR) << FormatString("Get object %s from disk failed, %s", objectKey, status.GetMsg());
         if (newShmUnit != nullptr) {
@@ -400,6 +405,59 @@ Status LoadSpilledObjectToMemory(ReadObjectKV &objectKV, std::shared_ptr<WorkerO
     evictionManager->Add(objectKey);
     return Status::OK();
 }
+}  // namespace
+
+Status LoadSpilledObjectToMemory(ReadObjectKV &objectKV, std::shared_ptr<WorkerOcEvictionManager> evictionManager)
+{
+    // We do not expect that there is already a pointer assigned for a spilled object
+    if (objectKV.GetObjEntry()->IsShmUnitExistsAndComplete()) {
+        return Status::OK();
+    }
+    std::shared_ptr<ShmUnit> newShmUnit;
+    void *pointer = nullptr;
+    RETURN_IF_NOT_OK(PrepareSpilledObjectLoad(objectKV, evictionManager, newShmUnit, pointer));
+    Status status = WorkerOcSpill::Instance()->Get(objectKV.GetObjKey(), pointer, objectKV.GetReadSize(),
+                                                   objectKV.GetReadOffset());
+    return FinishSpilledObjectLoad(objectKV, evictionManager, newShmUnit, status);
+}
+
+Status LoadSpilledObjectsToMemory(const std::vector<ReadObjectKV *> &objectKVs,
+                                  std::shared_ptr<WorkerOcEvictionManager> evictionManager)
+{
+    std::vector<SpillLoadRequest> requests;
+    std::vector<ReadObjectKV *> loadingKVs;
+    std::vector<std::shared_ptr<ShmUnit>> newShmUnits;
+    requests.reserve(objectKVs.size());
+    loadingKVs.reserve(objectKVs.size());
+    newShmUnits.reserve(objectKVs.size());
+    for (auto *objectKV : objectKVs) {
+        if (objectKV->GetObjEntry()->IsShmUnitExistsAndComplete()) {
+            continue;
+        }
+        std::shared_ptr<ShmUnit> newShmUnit;
+        void *pointer = nullptr;
+        Status rc = PrepareSpilledObjectLoad(*objectKV, evictionManager, newShmUnit, pointer);
+        if (rc.IsError()) {
+            LOG(WARNING) << FormatString("Skip batch load of spilled object %s, %s", objectKV->GetObjKey(),
+                                         rc.ToString());
+            continue;
+        }
+        requests.emplace_back(SpillLoadRequest{ objectKV->GetObjKey(), pointer, objectKV->GetReadSize(),
+                                                objectKV->GetReadOffset(), Status::OK() });
+        loadingKVs.emplace_back(objectKV);
+        newShmUnits.emplace_back(std::move(newShmUnit));
+    }
+    if (requests.empty()) {
+        return Status::OK();
+    }
+    Status rc = WorkerOcSpill::Instance()->BatchGet(requests);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        Status status = rc.IsError() ? rc : requests[i].rc;
+        LOG_IF_ERROR(FinishSpilledObjectLoad(*loadingKVs[i], evictionManager, newShmUnits[i], status),
+                     "Batch load spilled object failed");
+    }
+    return rc;
+}
 
 /*
  * There are 3 scenarios will call this function:
@@ -256,6 +256,16 @@ Status AllocateNewShmUnit(const std::string &objectKey, uint64_t dataSize, uint6
  */
 Status LoadSpilledObjectToMemory(ReadObjectKV &objectKV, std::shared_ptr<WorkerOcEvictionManager> evictionManager);
 
+/**
+ * @brief Read a batch of objects from disk to memory with merged and concurrent reads, AllocateMemory will be occurs.
+ * The objects that fail to load are left spilled and logged, the caller may load them one by one.
+ * @param[in] objectKVs The object entries and their corresponding objectKeys, all of them must be locked.
+ * @param[in] evictionManager Eviction manager.
+ * @return Status of the call.
+ */
+Status LoadSpilledObjectsToMemory(const std::vector<ReadObjectKV *> &objectKVs,
+                                  std::shared_ptr<WorkerOcEvictionManager> evictionManager);
+
 /**
  * @brief Save the payload data to memory.
  * @param[in] objectKV The safe object shared unit and its corresponding objectKey.
@@ -16,9 +16,12 @@
 
 #include "datasystem/worker/object_cache/rebalance_candidate_provider.h"
 
+#include <algorithm>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#include "datasystem/common/flags/common_flags.h"
 #include "datasystem/common/log/log.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/worker/object_cache/eviction_list.h"
@@ -27,6 +30,10 @@ namespace datasystem {
 namespace object_cache {
 namespace {
 constexpr size_t REBALANCE_SCAN_FACTOR = 5;
+const std::string COST_AWARE_POLICY = "cost_aware";
+// Score divisors of the cost-aware policy: each live reference weighs like four recent reads.
+constexpr double REF_PENALTY = 4.0;
+constexpr double ACCESS_PENALTY = 1.0;
 }  // namespace
 
 RebalanceCandidateProvider::RebalanceCandidateProvider(std::shared_ptr<WorkerOcEvictionManager> evictionManager,
@@ -51,7 +58,17 @@ Status RebalanceCandidateProvider::Select(uint64_t targetBytes, size_t maxObject
     // non-primary, being written, already rebalancing, and so on. Scan only a bounded multiple of candidates instead
     // of the full eviction list to minimize blocking Evict.
     RETURN_IF_NOT_OK(evictionManager_->GetObjectsInfoFromOldest(maxObjectCount * REBALANCE_SCAN_FACTOR, nodes));
+    if (FLAGS_rebalance_candidate_policy == COST_AWARE_POLICY) {
+        return SelectByCost(nodes, targetBytes, maxObjectCount, candidates, skipKeys);
+    }
+    return SelectOldest(nodes, targetBytes, maxObjectCount, candidates, skipKeys);
+}
 
+Status RebalanceCandidateProvider::SelectOldest(const std::vector<EvictionList::Node> &nodes, uint64_t targetBytes,
+                                                size_t maxObjectCount,
+                                                std::unordered_map<std::string, uint64_t> &candidates,
+                                                const std::unordered_set<std::string> *skipKeys)
+{
     uint64_t selectedBytes = 0;
     for (const auto &node : nodes) {
         const std::string objectKey = node.objectKey;
@@ -80,7 +97,99 @@ Status RebalanceCandidateProvider::Select(uint64_t targetBytes, size_t maxObject
     return Status::OK();
 }
 
+Status RebalanceCandidateProvider::SelectByCost(const std::vector<EvictionList::Node> &nodes, uint64_t targetBytes,
+                                                size_t maxObjectCount,
+                                                std::unordered_map<std::string, uint64_t> &candidates,
+                                                const std::unordered_set<std::string> *skipKeys)
+{
+    // Probe the whole scan window without marking, so objects that lose the ranking stay available to eviction.
+    std::vector<CandidateInfo> infos;
+    infos.reserve(nodes.size());
+    for (const auto &node : nodes) {
+        std::string objectKey = node.objectKey;
+        if (skipKeys != nullptr && skipKeys->count(objectKey) > 0) {
+            continue;
+        }
+        CandidateInfo info;
+        uint32_t shmRefCount = 0;
+        auto rc = ProbeObject(objectKey, false, info.size, &shmRefCount);
+        if (rc.IsError()) {
+            VLOG(1) << "Skip rebalance candidate " << objectKey << ", rc: " << rc.ToString();
+            continue;
+        }
+        info.refCount = shmRefCount + evictionManager_->GetGlobalRefCount(objectKey);
+        info.accessCount = node.curCounter;
+        info.objectKey = std::move(objectKey);
+        infos.emplace_back(std::move(info));
+    }
+
+    for (auto index : PickByCost(infos, targetBytes, maxObjectCount)) {
+        const auto &objectKey = infos[index].objectKey;
+        // The object may have changed since it was probed, so validate it again while marking it.
+        uint64_t objectSize = 0;
+        auto rc = TryGetObjectSize(objectKey, objectSize);
+        if (rc.IsError()) {
+            VLOG(1) << "Skip rebalance candidate " << objectKey << ", rc: " << rc.ToString();
+            continue;
+        }
+        if (!candidates.emplace(objectKey, objectSize).second) {
+            evictionManager_->UnmarkRebalancingObject(objectKey);
+        }
+    }
+    return Status::OK();
+}
+
+std::vector<size_t> RebalanceCandidateProvider::PickByCost(const std::vector<CandidateInfo> &infos,
+                                                           uint64_t targetBytes, size_t maxObjectCount)
+{
+    // Every migrated object costs one metadata update on the master, and moving an object that clients are reading
+    // or holding makes them fall back to a remote get. Divide the bytes an object frees by both penalties.
+    std::vector<double> penalties(infos.size());
+    std::vector<double> scores(infos.size());
+    for (size_t i = 0; i < infos.size(); ++i) {
+        penalties[i] = (1.0 + REF_PENALTY * infos[i].refCount) * (1.0 + ACCESS_PENALTY * infos[i].accessCount);
+        scores[i] = static_cast<double>(infos[i].size) / penalties[i];
+    }
+    std::vector<size_t> order(infos.size());
+    std::iota(order.begin(), order.end(), 0);
+    // Stable, so equally scored objects keep their eviction order and the oldest goes first.
+    std::stable_sort(order.begin(), order.end(),
+                     [&scores](size_t lhs, size_t rhs) { return scores[lhs] > scores[rhs]; });
+
+    std::vector<size_t> picked;
+    uint64_t pickedBytes = 0;
+    // An object that covers the remaining gap is taken if it overshoots by no more than the gap itself. Larger ones
+    // are kept aside, and the least disruptive, then smallest, of them closes the gap at the end.
+    size_t closer = infos.size();
+    for (auto index : order) {
+        if (pickedBytes >= targetBytes || picked.size() >= maxObjectCount) {
+            break;
+        }
+        const uint64_t size = infos[index].size;
+        const uint64_t gap = targetBytes - pickedBytes;
+        if (size > gap && size - gap > gap) {
+            if (closer == infos.size() || penalties[index] < penalties[closer]
+                || (penalties[index] == penalties[closer] && size < infos[closer].size)) {
+                closer = index;
+            }
+            continue;
+        }
+        picked.emplace_back(index);
+        pickedBytes += size;
+    }
+    if (pickedBytes < targetBytes && picked.size() < maxObjectCount && closer != infos.size()) {
+        picked.emplace_back(closer);
+    }
+    return picked;
+}
+
 Status RebalanceCandidateProvider::TryGetObjectSize(const std::string &objectKey, uint64_t &objectSize)
+{
+    return ProbeObject(objectKey, true, objectSize);
+}
+
+Status RebalanceCandidateProvider::ProbeObject(const std::string &objectKey, bool mark, uint64_t &objectSize,
+                                               uint32_t *shmRefCount)
 {
     std::shared_ptr<SafeObjType> entry;
     RETURN_IF_NOT_OK(objectTable_->Get(objectKey, entry));
@@ -103,7 +212,9 @@ Status RebalanceCandidateProvider::TryGetObjectSize(const std::string &objectKey
     // Pair with EvictionTask's mark check under the object write lock. If this read lock is acquired first, the mark is
     // visible before eviction can get the write lock; if eviction gets the write lock first, this validation waits and
     // observes the post-eviction object state.
-    if (!evictionManager_->TryMarkRebalancingObject(objectKey)) {
+    const bool marked = mark ? evictionManager_->TryMarkRebalancingObject(objectKey)
+                             : !evictionManager_->IsObjectBeingRebalanced(objectKey);
+    if (!marked) {
         entry->RUnlock();
         RETURN_STATUS(K_NOT_FOUND, "Skip object that is being rebalanced");
     }
@@ -113,10 +224,15 @@ Status RebalanceCandidateProvider::TryGetObjectSize(const std::string &objectKey
     auto shmUnit = object->GetShmUnit();
     objectSize = (shmUnit == nullptr) ? 0 : shmUnit->GetMigratableSize();
     if (objectSize == 0) {
-        evictionManager_->UnmarkRebalancingObject(objectKey);
+        if (mark) {
+            evictionManager_->UnmarkRebalancingObject(objectKey);
+        }
         entry->RUnlock();
         RETURN_STATUS(K_NOT_FOUND, "Skip empty object");
     }
+    if (shmRefCount != nullptr) {
+        *shmRefCount = static_cast<uint32_t>(std::max(shmUnit->GetRefCount(), 0));
+    }
     entry->RUnlock();
     return Status::OK();
 }
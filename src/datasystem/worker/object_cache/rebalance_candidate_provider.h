@@ -25,7 +25,9 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include "datasystem/worker/object_cache/eviction_list.h"
 #include "datasystem/worker/object_cache/object_kv.h"
 #include "datasystem/worker/object_cache/worker_oc_eviction_manager.h"
 #include "datasystem/utils/status.h"
@@ -51,7 +53,37 @@ public:
     Status Select(uint64_t targetBytes, size_t maxObjectCount, std::unordered_map<std::string, uint64_t> &candidates,
                   const std::unordered_set<std::string> *skipKeys = nullptr);
 
+    struct CandidateInfo {
+        std::string objectKey;
+        uint64_t size = 0;
+        // Live references: clients holding the shared memory plus global references.
+        uint32_t refCount = 0;
+        // Eviction-list clock counter: raised on each re-access, lowered each time the eviction hand passes.
+        uint8_t accessCount = 0;
+    };
+
+    /**
+     * @brief Pick a cost-aware batch from probed candidates.
+     * @param[in] infos Candidates in eviction order, oldest first.
+     * @param[in] targetBytes The bytes expected in this batch.
+     * @param[in] maxObjectCount The maximum object count of this batch.
+     * @return Indexes into infos of the picked candidates, in the order they were picked. Candidates are taken by
+     *         size over read and reference penalties, so the batch reaches targetBytes with few objects that clients
+     *         are not using. A batch overshoots targetBytes by at most the gap left before its last object, unless
+     *         only larger objects remain.
+     */
+    static std::vector<size_t> PickByCost(const std::vector<CandidateInfo> &infos, uint64_t targetBytes,
+                                          size_t maxObjectCount);
+
 private:
+    Status SelectOldest(const std::vector<EvictionList::Node> &nodes, uint64_t targetBytes, size_t maxObjectCount,
+                        std::unordered_map<std::string, uint64_t> &candidates,
+                        const std::unordered_set<std::string> *skipKeys);
+    Status SelectByCost(const std::vector<EvictionList::Node> &nodes, uint64_t targetBytes, size_t maxObjectCount,
+                        std::unordered_map<std::string, uint64_t> &candidates,
+                        const std::unordered_set<std::string> *skipKeys);
+    // Validate one object and read its size; with mark set, also mark it as rebalancing.
+    Status ProbeObject(const std::string &objectKey, bool mark, uint64_t &objectSize, uint32_t *shmRefCount = nullptr);
     Status TryGetObjectSize(const std::string &objectKey, uint64_t &objectSize);
 
     std::shared_ptr<WorkerOcEvictionManager> evictionManager_;
@@ -73,6 +73,7 @@
 #include "datasystem/worker/object_cache/delayed_release_shm_manager.h"
 #include "datasystem/worker/object_cache/object_kv.h"
 #include "datasystem/worker/object_cache/service/service_execution_policy.h"
+#include "datasystem/worker/object_cache/worker_oc_spill.h"
 #include "datasystem/worker/object_cache/worker_request_manager.h"
 #include "datasystem/worker/object_cache/worker_worker_oc_api.h"
 #include "datasystem/worker/object_cache/worker_worker_oc_gather_layout.h"
@@ -86,6 +87,11 @@ DS_DECLARE_bool(authorization_enable);
 DS_DECLARE_bool(enable_data_replication);
 DS_DECLARE_uint32(data_migrate_rate_limit_mb);
 DS_DEFINE_bool(enable_l2_cache_fallback, true, "Control whether enable fallback to L2 cache when worker failed.");
+DS_DEFINE_int64(remote_get_direct_recv_threshold, 0,
+                "Remote get payloads larger than this are received straight into the pre-allocated shared memory "
+                "instead of being copied out of the rpc frames. A parked payload costs an extra round trip and a "
+                "request on the zmq path, so it pays off only for large objects. 0 leaves it to "
+                "payload_nocopy_threshold.");
 using namespace datasystem::worker;
 using namespace datasystem::master;
 namespace datasystem {
@@ -102,6 +108,11 @@ static constexpr char URMA_WARMUP_KEY_PREFIX[] = "_urma_";
 static constexpr double US_PER_MS = 1000.0;
 
 namespace {
+constexpr uint32_t MAX_FILL_LEASE_MS = 10 * 60 * 1000;  // 10 min.
+// MatchPrefix resolves the chain in doubling chunks, a short cached prefix costs a single small query.
+constexpr size_t MATCH_PREFIX_FIRST_CHUNK = 16;
+constexpr size_t MATCH_PREFIX_MAX_CHUNK = 1024;
+
 Status ValidateRemoteGetResult(bool workerConnected, const Status &status, SafeObjType &entry,
     const std::string &objectKey, const std::string &address)
 {
@@ -519,6 +530,7 @@ Status WorkerOcServiceGetImpl::TryGetObjectFromLocal(std::shared_ptr<GetRequest>
     Status lastRc;
     auto &uniqueObjectMap = request->GetObjects();
     PerfPoint point(PerfKey::WORKER_PROCESS_GET_FROM_LOCAL_BATCH);
+    BatchLoadSpilledObjects(request);
     std::vector<std::string> needEvictKeys;
     auto func = [this, &request](const std::string &objectKey, GetObjInfo &objectInfo,
                                  std::set<ReadKey> &remoteObjectKeys, std::vector<std::string> &needEvictKeys) {
@@ -763,7 +775,9 @@ Status WorkerOcServiceGetImpl::PreProcessGetObject(const ReadKey &readKey, GetOb
     });
     if (objIsValidInMem) {
         // if not add readkey to remoteObjectKeys, mem hit
-        if (remoteObjectKeys.size() == preSize) {
+        if (remoteObjectKeys.size() == preSize && info.loadedFromDisk) {
+            CacheHitInfo::Instance().IncDiskHit(1);
+        } else if (remoteObjectKeys.size() == preSize) {
             CacheHitInfo::Instance().IncMemHit(1);
         }
         return memGetRes;
@@ -826,6 +840,52 @@ Status WorkerOcServiceGetImpl::PreProcessGetObject(const ReadKey &readKey, GetOb
     return Status::OK();
 }
 
+void WorkerOcServiceGetImpl::BatchLoadSpilledObjects(std::shared_ptr<GetRequest> &request)
+{
+    auto &uniqueObjectMap = request->GetObjects();
+    const size_t minBatchSize = 2;
+    if (uniqueObjectMap.size() < minBatchSize || !WorkerOcSpill::Instance()->IsEnabled()) {
+        return;
+    }
+    std::vector<std::shared_ptr<SafeObjType>> lockedEntries;
+    std::vector<std::unique_ptr<ReadObjectKV>> objectKVs;
+    std::vector<GetObjInfo *> objectInfos;
+    Raii unlock([&lockedEntries]() {
+        for (auto &entry : lockedEntries) {
+            entry->WUnlock();
+        }
+    });
+    for (auto &[objectKey, objectInfo] : uniqueObjectMap) {
+        std::shared_ptr<SafeObjType> entry;
+        // Never wait for a busy object here, the per object path below handles it.
+        if (objectInfo.isRollBack || objectTable_->Get(objectKey, entry).IsError() || entry->TryWLock().IsError()) {
+            continue;
+        }
+        auto objectKV = std::make_unique<ReadObjectKV>(ReadKey(objectKey, objectInfo.offsetInfo), *entry);
+        auto &obj = *entry;
+        if (!obj->IsBinary() || !(obj->IsSealed() || obj->IsPublished()) || obj->stateInfo.IsCacheInvalid()
+            || !obj->IsSpilled() || obj->IsShmUnitExistsAndComplete() || objectKV->IsOffsetRead()
+            || objectKV->CheckReadOffset().IsError()) {
+            entry->WUnlock();
+            continue;
+        }
+        lockedEntries.emplace_back(std::move(entry));
+        objectKVs.emplace_back(std::move(objectKV));
+        objectInfos.emplace_back(&objectInfo);
+    }
+    if (objectKVs.size() < minBatchSize) {
+        return;
+    }
+    std::vector<ReadObjectKV *> loadKVs;
+    loadKVs.reserve(objectKVs.size());
+    std::transform(objectKVs.begin(), objectKVs.end(), std::back_inserter(loadKVs),
+                   [](const std::unique_ptr<ReadObjectKV> &objectKV) { return objectKV.get(); });
+    LOG_IF_ERROR(LoadSpilledObjectsToMemory(loadKVs, evictionManager_), "Batch load spilled objects failed");
+    for (size_t i = 0; i < objectKVs.size(); ++i) {
+        objectInfos[i]->loadedFromDisk = objectKVs[i]->GetObjEntry()->IsShmUnitExistsAndComplete();
+    }
+}
+
 Status WorkerOcServiceGetImpl::RLockGetObjectFromMem(const ReadKey &readKey, GetObjInfo &info,
                                                      std::set<ReadKey> &remoteObjectKeys, bool &objIsValidInMem)
 {
@@ -1510,6 +1570,8 @@ Status WorkerOcServiceGetImpl::PullObjectDataFromRemoteWorker(const std::string
             timeoutMs,
             [&workerStub, &reqPb, &rspPb, &clientApi, &address, this](int32_t) {
                 RETURN_IF_NOT_OK(workerStub->GetObjectRemote(&clientApi));
+                // The shm unit is allocated from the metadata size, let the payload land there directly.
+                clientApi->SetPayloadDirectThreshold(FLAGS_remote_get_direct_recv_threshold);
                 RETURN_IF_NOT_OK(workerStub->GetObjectRemoteWrite(clientApi, reqPb));
 
                 auto rc = clientApi->Read(rspPb);
@@ -2464,17 +2526,11 @@ void WorkerOcServiceGetImpl::TryGetFromL2CacheWhenNotFoundInWorker(const ObjectM
                                                                    bool ifWorkerConnected, ObjectKV &objectKV,
                                                                    Status &status, bool traceEnabled)
 {
-    if (!FLAGS_enable_l2_cache_fallback) {
-        status = Status(K_NOT_FOUND_IN_L2CACHE, status.GetMsg());
-        return;
-    }
-    const ConfigPb &configPb = meta.config();
-    bool writeToL2Storage = IsL2BackedWriteMode(WriteMode(configPb.write_mode()));
     // If a copy exists and the worker where the copy is located is disconnected, the data will not be cached locally
     // (the data obtained from L2 cache may be inconsistent with the copy, avoiding consistency issues).
     bool isQueryWithoutCopy = !address.empty() && !ifWorkerConnected;
     // No worker holds the object or got error when pulling from remote worker, pull object from persistence api.
-    if (writeToL2Storage && IsSupportL2Storage(supportL2Storage_)) {
+    if (CanGetFromL2Cache(meta, status)) {
         if (traceEnabled) {
             Trace::Instance().AddLatencyTick(LatencyTickKey::WORKER_L2CACHE_READ_START);
         }
@@ -2489,6 +2545,101 @@ void WorkerOcServiceGetImpl::TryGetFromL2CacheWhenNotFoundInWorker(const ObjectM
     }
 }
 
+void WorkerOcServiceGetImpl::TryGetFromL2CacheWhenNotFoundInWorker(const ObjectMetaPb &meta, const std::string &address,
+                                                                   bool ifWorkerConnected, ReadObjectKV &objectKV,
+                                                                   Status &status, bool traceEnabled)
+{
+    if (!objectKV.IsOffsetRead()) {
+        TryGetFromL2CacheWhenNotFoundInWorker(meta, address, ifWorkerConnected, static_cast<ObjectKV &>(objectKV),
+                                              status, traceEnabled);
+        return;
+    }
+    if (CanGetFromL2Cache(meta, status)) {
+        if (traceEnabled) {
+            Trace::Instance().AddLatencyTick(LatencyTickKey::WORKER_L2CACHE_READ_START);
+        }
+        status = GetObjectRangeFromPersistenceAndDump(objectKV);
+        if (traceEnabled) {
+            Trace::Instance().AddLatencyTick(LatencyTickKey::WORKER_L2CACHE_READ_END);
+        }
+    }
+}
+
+bool WorkerOcServiceGetImpl::CanGetFromL2Cache(const ObjectMetaPb &meta, Status &status)
+{
+    if (!FLAGS_enable_l2_cache_fallback) {
+        status = Status(K_NOT_FOUND_IN_L2CACHE, status.GetMsg());
+        return false;
+    }
+    return IsL2BackedWriteMode(WriteMode(meta.config().write_mode())) && IsSupportL2Storage(supportL2Storage_);
+}
+
+Status WorkerOcServiceGetImpl::GetObjectRangeFromPersistenceAndDump(ReadObjectKV &objectKV)
+{
+    const auto &objectKey = objectKV.GetObjKey();
+    SafeObjType &entry = objectKV.GetObjEntry();
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(objectKV.CheckReadOffset(), "Read offset verify failed");
+    const uint64_t readOffset = objectKV.GetReadOffset();
+    const uint64_t remaining = entry->GetDataSize() - readOffset;
+    const uint64_t readSize = objectKV.GetReadSize() == 0 ? remaining : std::min(objectKV.GetReadSize(), remaining);
+    LOG(INFO) << FormatString("Get range [%zu, %zu) of object from L2 storage, object key is : %s", readOffset,
+                              readOffset + readSize, objectKey);
+
+    int64_t remainingTime = GetRequestContext()->reqTimeoutDuration.CalcRemainingTime();
+    CHECK_FAIL_RETURN_STATUS(remainingTime > 0, K_RPC_DEADLINE_EXCEEDED,
+                             FormatString("Request timeout (%ld ms).", -remainingTime));
+    CHECK_FAIL_RETURN_STATUS(persistenceApi_ != nullptr, K_RUNTIME_ERROR, "persistenceApi is nullptr");
+
+    // The memory holds the whole object so that a later read of another range fills the same unit.
+    uint64_t objectSize = 0;
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(
+        GetObjectFromPersistenceToShm(objectKV, readOffset, readSize, remainingTime, objectSize),
+        FormatString("Call get object range from L2 storage failed. objectKey:%s", objectKey));
+    entry->stateInfo.SetIncompleted(true);
+    evictionManager_->Add(objectKey);
+    entry->stateInfo.SetNeedToDelete(true);
+    return Status::OK();
+}
+
+Status WorkerOcServiceGetImpl::GetObjectFromPersistenceToShm(ObjectKV &objectKV, uint64_t offset, uint64_t size,
+                                                             int64_t timeoutMs, uint64_t &objectSize)
+{
+    const auto &objectKey = objectKV.GetObjKey();
+    SafeObjType &entry = objectKV.GetObjEntry();
+    auto metaSz = entry->GetMetadataSize();
+    auto shmUnit = entry->GetShmUnit();
+    bool allocated = false;
+    if (shmUnit == nullptr || shmUnit->size != entry->GetDataSize() + metaSz) {
+        shmUnit = std::make_shared<ShmUnit>();
+        RETURN_IF_NOT_OK(AllocateMemoryForObject(objectKey, entry->GetDataSize(), metaSz, false, evictionManager_,
+                                                 *shmUnit, entry->modeInfo.GetCacheType()));
+        shmUnit->id = ShmKey::Intern(GetStringUuid());
+        allocated = true;
+    }
+    // The client can't access the memory this moment, so the storage backend writes into it directly.
+    PerfPoint point(PerfKey::WORKER_GET_L2_CACHE);
+    auto *dest = static_cast<uint8_t *>(shmUnit->GetPointer()) + metaSz + offset;
+    objectSize = 0;
+    Status rc =
+        persistenceApi_->GetToBuffer(objectKey, entry->GetCreateTime(), offset, size, timeoutMs, dest, objectSize);
+    point.Record();
+    if (rc.IsOk() && objectSize != 0 && objectSize != entry->GetDataSize()) {
+        rc = Status(K_OUT_OF_RANGE, FormatString("The stored object %s has %lu bytes but the meta records %lu",
+                                                 objectKey, objectSize, entry->GetDataSize()));
+    }
+    if (rc.IsError()) {
+        if (allocated) {
+            shmUnit->SetHardFreeMemory();
+            shmUnit->FreeMemory();
+        }
+        return rc;
+    }
+    if (allocated) {
+        entry->SetShmUnit(shmUnit);
+    }
+    return Status::OK();
+}
+
 Status WorkerOcServiceGetImpl::GetObjectFromPersistenceAndDumpWithoutCopyMeta(ObjectKV &objectKV,
                                                                               bool noVersionAvailable, bool needDelete,
                                                                               uint64_t minVersion)
@@ -2502,6 +2653,26 @@ Status WorkerOcServiceGetImpl::GetObjectFromPersistenceAndDumpWithoutCopyMeta(Ob
                              FormatString("Request timeout (%ld ms).", -remainingTime));
     CHECK_FAIL_RETURN_STATUS(persistenceApi_ != nullptr, K_RUNTIME_ERROR, "persistenceApi is nullptr");
 
+    if (!noVersionAvailable && entry->GetDataSize() > 0) {
+        // The size is known from the meta, the data is read straight into the shared memory of the object.
+        uint64_t objectSize = 0;
+        Status rc = GetObjectFromPersistenceToShm(objectKV, 0, entry->GetDataSize(), remainingTime, objectSize);
+        if (rc.IsOk() && objectSize == entry->GetDataSize()) {
+            evictionManager_->Add(objectKey);
+            entry->stateInfo.SetNeedToDelete(needDelete);
+            return Status::OK();
+        }
+        // The stored version differs in size from the meta or the backend can't tell its size, get it as a whole
+        // below.
+        RETURN_IF_NOT_OK_PRINT_ERROR_MSG(rc.IsOk() || rc.GetCode() == K_OUT_OF_RANGE ? Status::OK() : rc,
+                                         FormatString("Call get object from L2 storage failed. objectKey:%s",
+                                                      objectKey));
+        LOG(WARNING) << FormatString("Object %s can't be read into shared memory by the meta size %lu: %s", objectKey,
+                                     entry->GetDataSize(),
+                                     rc.IsOk() ? "the size of the stored object is unknown" : rc.GetMsg());
+        remainingTime = GetRequestContext()->reqTimeoutDuration.CalcRemainingTime();
+    }
+
     std::shared_ptr<std::stringstream> buffer = std::make_shared<std::stringstream>();
 
     PerfPoint point(PerfKey::WORKER_GET_L2_CACHE);
@@ -3057,7 +3228,8 @@ Status WorkerOcServiceGetImpl::QueryObjectLocations(
 
 Status WorkerOcServiceGetImpl::QueryPureMetadataGroup(const HostPort &masterAddress,
                                                       const std::vector<std::string> &objectKeys,
-                                                      std::vector<master::QueryMetaInfoPb> &queryMetas)
+                                                      std::vector<master::QueryMetaInfoPb> &queryMetas,
+                                                      bool withLocations)
 {
     auto workerMasterApi = workerMasterApiManager_->GetWorkerMasterApi(masterAddress);
     CHECK_FAIL_RETURN_STATUS(workerMasterApi != nullptr, K_RUNTIME_ERROR,
@@ -3065,6 +3237,7 @@ Status WorkerOcServiceGetImpl::QueryPureMetadataGroup(const HostPort &masterAddr
     master::PureQueryMetaReqPb request;
     request.set_redirect(true);
     request.set_address(localAddress_.ToString());
+    request.set_with_locations(withLocations);
     request.mutable_object_keys()->Add(objectKeys.begin(), objectKeys.end());
     master::PureQueryMetaRspPb response;
     std::function<Status(master::PureQueryMetaReqPb &, master::PureQueryMetaRspPb &)> query =
@@ -3076,12 +3249,12 @@ Status WorkerOcServiceGetImpl::QueryPureMetadataGroup(const HostPort &masterAddr
     RETURN_IF_NOT_OK(RedirectRetryWhenMetasMoving(request, response, query));
     queryMetas.insert(queryMetas.end(), response.mutable_query_metas()->begin(),
                       response.mutable_query_metas()->end());
-    return QueryPureMetadataRedirects(response.info(), queryMetas);
+    return QueryPureMetadataRedirects(response.info(), queryMetas, withLocations);
 }
 
 Status WorkerOcServiceGetImpl::QueryPureMetadataRedirects(
     const google::protobuf::RepeatedPtrField<RedirectMetaInfo> &redirects,
-    std::vector<master::QueryMetaInfoPb> &queryMetas)
+    std::vector<master::QueryMetaInfoPb> &queryMetas, bool withLocations)
 {
     for (const auto &redirect : redirects) {
         HostPort masterAddress;
@@ -3092,6 +3265,7 @@ Status WorkerOcServiceGetImpl::QueryPureMetadataRedirects(
         master::PureQueryMetaReqPb request;
         request.set_redirect(false);
         request.set_address(localAddress_.ToString());
+        request.set_with_locations(withLocations);
         request.mutable_object_keys()->Add(redirect.change_meta_ids().begin(), redirect.change_meta_ids().end());
         master::PureQueryMetaRspPb response;
         std::function<Status(master::PureQueryMetaReqPb &, master::PureQueryMetaRspPb &)> query =
@@ -3158,6 +3332,128 @@ Status WorkerOcServiceGetImpl::QuerySize(const QuerySizeReqPb &req, QuerySizeRsp
     return Status::OK();
 }
 
+Status WorkerOcServiceGetImpl::AcquireFillLease(const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &rsp)
+{
+    ScopedRequestContext ctx;
+    std::string tenantId;
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(worker::Authenticate(akSkManager_, req, tenantId), "Authenticate failed.");
+    CHECK_FAIL_RETURN_STATUS(req.lease_ms() > 0 && req.lease_ms() <= MAX_FILL_LEASE_MS, K_INVALID,
+                             FormatString("The fill lease should be in (0, %u] ms", MAX_FILL_LEASE_MS));
+    CHECK_FAIL_RETURN_STATUS(!req.lease_token().empty(), K_INVALID, "The fill lease token is empty");
+    auto objectKey = TenantAuthManager::ConstructNamespaceUriWithTenantId(tenantId, req.object_key());
+    // Fast path: a local sealed copy means there is nothing to fill, no need to bother the metadata owner.
+    if (IsLocalObject(objectKey)) {
+        rsp.set_state(FillLeaseStatePb::FILL_LEASE_EXISTS);
+        return Status::OK();
+    }
+    CHECK_FAIL_RETURN_STATUS(metadataRouteResolver_ != nullptr, K_NOT_READY, "Metadata route resolver is unavailable");
+    HostPort masterAddr;
+    RETURN_IF_NOT_OK(metadataRouteResolver_->ResolveOwner(objectKey, masterAddr));
+    auto workerMasterApi = workerMasterApiManager_->GetWorkerMasterApi(masterAddr);
+    CHECK_FAIL_RETURN_STATUS(workerMasterApi != nullptr, K_RUNTIME_ERROR,
+                             "hash master get failed, AcquireFillLease failed");
+    master::AcquireFillLeaseReqPb masterReq;
+    master::AcquireFillLeaseRspPb masterRsp;
+    masterReq.set_object_key(objectKey);
+    masterReq.set_address(localAddress_.ToString());
+    masterReq.set_client_id(req.client_id());
+    masterReq.set_lease_token(req.lease_token());
+    masterReq.set_lease_ms(req.lease_ms());
+    masterReq.set_redirect(true);
+    std::function<Status(master::AcquireFillLeaseReqPb &, master::AcquireFillLeaseRspPb &)> func =
+        [&workerMasterApi](master::AcquireFillLeaseReqPb &req, master::AcquireFillLeaseRspPb &rsp) {
+            return workerMasterApi->AcquireFillLease(req, rsp);
+        };
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(RedirectRetryWhenMetaMoving(masterReq, masterRsp, workerMasterApi, func),
+                                     FormatString("AcquireFillLease of %s failed", objectKey));
+    rsp.set_state(masterRsp.state());
+    rsp.set_remaining_ms(masterRsp.remaining_ms());
+    VLOG(1) << FormatString("AcquireFillLease of %s from client %s: %s", objectKey, req.client_id(),
+                            FillLeaseStatePb_Name(rsp.state()));
+    return Status::OK();
+}
+
+Status WorkerOcServiceGetImpl::QueryPrefixLocations(
+    const std::vector<std::string> &objectKeys, std::unordered_map<std::string, std::vector<std::string>> &locations)
+{
+    CHECK_FAIL_RETURN_STATUS(metadataRouteResolver_ != nullptr, K_NOT_READY, "Metadata route resolver is unavailable");
+    auto grouped = metadataRouteResolver_->GroupOwners(objectKeys);
+    if (!grouped.failures.empty()) {
+        return grouped.failures.begin()->second;
+    }
+    std::vector<master::QueryMetaInfoPb> queryMetas;
+    queryMetas.reserve(objectKeys.size());
+    for (const auto &[masterAddress, keys] : grouped.groups) {
+        RETURN_IF_NOT_OK(QueryPureMetadataGroup(masterAddress, keys, queryMetas, true));
+    }
+    for (auto &queryMeta : queryMetas) {
+        if (queryMeta.locations().empty()) {
+            continue;
+        }
+        auto &holders = locations[queryMeta.meta().object_key()];
+        holders.assign(queryMeta.mutable_locations()->begin(), queryMeta.mutable_locations()->end());
+    }
+    return Status::OK();
+}
+
+Status WorkerOcServiceGetImpl::MatchPrefix(const MatchPrefixReqPb &req, MatchPrefixRspPb &rsp)
+{
+    ScopedRequestContext ctx;
+    std::string tenantId;
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(worker::Authenticate(akSkManager_, req, tenantId), "Authenticate failed.");
+    CHECK_FAIL_RETURN_STATUS(Validator::IsExistBatchSizeUnderLimit(req.object_keys_size()), K_INVALID,
+                             "invalid object size");
+    auto keys = TenantAuthManager::ConstructNamespaceUriWithTenantId(tenantId, req.object_keys());
+    const auto localAddress = localAddress_.ToString();
+    // Workers still holding every key so far, by the length of the prefix they hold.
+    std::unordered_map<std::string, uint32_t> holders;
+    uint32_t matched = 0;
+    size_t chunkSize = MATCH_PREFIX_FIRST_CHUNK;
+    bool missed = false;
+    while (!missed && matched < keys.size()) {
+        std::vector<std::string> chunk(keys.begin() + matched,
+                                       keys.begin() + std::min(keys.size(), matched + chunkSize));
+        std::unordered_map<std::string, std::vector<std::string>> locations;
+        RETURN_IF_NOT_OK_PRINT_ERROR_MSG(QueryPrefixLocations(chunk, locations), "MatchPrefix query meta failed");
+        for (const auto &key : chunk) {
+            auto &keyHolders = locations[key];
+            if (IsLocalObject(key)
+                && std::find(keyHolders.begin(), keyHolders.end(), localAddress) == keyHolders.end()) {
+                keyHolders.emplace_back(localAddress);
+            }
+            if (keyHolders.empty()) {
+                missed = true;
+                break;
+            }
+            for (const auto &address : keyHolders) {
+                if (matched == 0) {
+                    holders.emplace(address, 1);
+                    continue;
+                }
+                auto it = holders.find(address);
+                if (it != holders.end() && it->second == matched) {
+                    ++it->second;
+                }
+            }
+            ++matched;
+        }
+        chunkSize = std::min(chunkSize * 2, MATCH_PREFIX_MAX_CHUNK);
+    }
+    rsp.set_matched_count(matched);
+    std::vector<std::pair<std::string, uint32_t>> sorted(holders.begin(), holders.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto &left, const auto &right) {
+        return left.second != right.second ? left.second > right.second : left.first < right.first;
+    });
+    for (const auto &[address, length] : sorted) {
+        auto *holder = rsp.add_holders();
+        holder->set_address(address);
+        holder->set_length(length);
+    }
+    VLOG(1) << FormatString("MatchPrefix of %zu keys from client %s: matched %u, %zu holders", keys.size(),
+                            req.client_id(), matched, sorted.size());
+    return Status::OK();
+}
+
 Status WorkerOcServiceGetImpl::QueryExistMetadataViaPureQueryMeta(const std::vector<std::string> &objectKeys,
                                                                   std::vector<master::QueryMetaInfoPb> &queryMetas)
 {
@@ -174,6 +174,22 @@ public:
      */
     Status Exist(const ExistReqPb &req, ExistRspPb &rsp);
 
+    /**
+     * @brief Acquire the GetOrCreate fill lease of an object from its metadata owner.
+     * @param[in] req The acquire fill lease request protobuf.
+     * @param[out] rsp The acquire fill lease response protobuf.
+     * @return K_OK on success; the error code otherwise.
+     */
+    Status AcquireFillLease(const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &rsp);
+
+    /**
+     * @brief Match the longest cached prefix of a chain of keys, and how much of it each worker holds.
+     * @param[in] req The match prefix request protobuf.
+     * @param[out] rsp The match prefix response protobuf.
+     * @return K_OK on success; the error code otherwise.
+     */
+    Status MatchPrefix(const MatchPrefixReqPb &req, MatchPrefixRspPb &rsp);
+
     /**
      * @brief Get device meta info of the keys.
      * @param[in] req The exist request protobuf.
@@ -392,6 +408,14 @@ private:
      */
     Status PreProcessGetObject(const ReadKey &readKey, GetObjInfo &info, std::set<ReadKey> &remoteObjectKeys);
 
+    /**
+     * @brief Load the spilled objects of a get request into memory with one batch load, so that the objects are
+     * read from disk with merged and concurrent reads instead of one by one. The objects that are busy, partially
+     * read or fail to load are left to the per object path.
+     * @param[in] request The get request.
+     */
+    void BatchLoadSpilledObjects(std::shared_ptr<GetRequest> &request);
+
     /**
      * @brief Preprocess for get one object from memory, in this case, we only hold RLock instead of WLock, because the
      * WLock maybe block by other business process, for example, in WriteBack mode, the async thread send data to
@@ -545,9 +569,18 @@ private:
     Status QueryExistMetadataViaPureQueryMeta(const std::vector<std::string> &objectKeys,
                                               std::vector<master::QueryMetaInfoPb> &queryMetas);
     Status QueryPureMetadataGroup(const HostPort &masterAddress, const std::vector<std::string> &objectKeys,
-                                  std::vector<master::QueryMetaInfoPb> &queryMetas);
+                                  std::vector<master::QueryMetaInfoPb> &queryMetas, bool withLocations = false);
     Status QueryPureMetadataRedirects(const google::protobuf::RepeatedPtrField<RedirectMetaInfo> &redirects,
-                                      std::vector<master::QueryMetaInfoPb> &queryMetas);
+                                      std::vector<master::QueryMetaInfoPb> &queryMetas, bool withLocations = false);
+
+    /**
+     * @brief Collect the readable locations of a chunk of keys, one PureQueryMeta per metadata owner.
+     * @param[in] objectKeys The namespaced keys.
+     * @param[out] locations The workers holding a readable copy, by key. Keys without any copy are absent.
+     * @return K_OK on success; the error code otherwise.
+     */
+    Status QueryPrefixLocations(const std::vector<std::string> &objectKeys,
+                                std::unordered_map<std::string, std::vector<std::string>> &locations);
 
     /**
      * @brief Query the metadata of the specified objects in the redirect master.
@@ -934,6 +967,48 @@ private:
                                                bool ifWorkerConnected, ObjectKV &objectKV, Status &status,
                                                bool traceEnabled);
 
+    /**
+     * @brief Try to get object from L2 cache when object not found in other worker, only the range of an offset read
+     * is got from L2 cache.
+     * @param[in] meta The object meta info contains remote address and data size.
+     * @param[in] address The remote worker address.
+     * @param[in] isWorkerConnected Whether create meta data depend on this parameter.
+     * @param[out] objectKV The reserved and locked safe object with the range to read.
+     * @param[out] status Status of the call.
+     */
+    void TryGetFromL2CacheWhenNotFoundInWorker(const ObjectMetaPb &meta, const std::string &address,
+                                               bool ifWorkerConnected, ReadObjectKV &objectKV, Status &status,
+                                               bool traceEnabled);
+
+    /**
+     * @brief Check whether an object missing in the workers can be got from L2 cache.
+     * @param[in] meta The object meta info.
+     * @param[in,out] status Set to K_NOT_FOUND_IN_L2CACHE if the L2 cache fallback is disabled.
+     * @return True if the object is backed by a supported L2 cache.
+     */
+    bool CanGetFromL2Cache(const ObjectMetaPb &meta, Status &status);
+
+    /**
+     * @brief Get the range of an offset read from persistence api into the object memory, the rest of the object is
+     * left unfilled and the object is marked incomplete, like an offset read from a remote worker.
+     * @param[in] objectKV The safe object to update with the range to read.
+     * @return Status of the call.
+     */
+    Status GetObjectRangeFromPersistenceAndDump(ReadObjectKV &objectKV);
+
+    /**
+     * @brief Read the bytes [offset, offset + size) of the object from persistence api straight into its shared
+     * memory, which is allocated at the object size if the entry has none of that size.
+     * @param[in] objectKV The safe object with the data size from the meta.
+     * @param[in] offset The first byte to read.
+     * @param[in] size The number of bytes to read.
+     * @param[in] timeoutMs The remaining time of the request.
+     * @param[out] objectSize The size of the stored object, 0 if the backend does not tell.
+     * @return K_OUT_OF_RANGE if the size of the stored object differs from the meta.
+     */
+    Status GetObjectFromPersistenceToShm(ObjectKV &objectKV, uint64_t offset, uint64_t size, int64_t timeoutMs,
+                                         uint64_t &objectSize);
+
     /**
      * @brief Get object data from persistence api without creating copy meta.
      * @param[in] objectKV The safe object to update and its corresponding objectKey.
@@ -1214,6 +1214,23 @@ Status WorkerRemoteMasterOCApi::Expire(master::ExpireReqPb &req, master::ExpireR
     return WithRpcDiag(rc, "Expire", localHostPort_, hostPort_);
 }
 
+Status WorkerRemoteMasterOCApi::AcquireFillLease(master::AcquireFillLeaseReqPb &req,
+                                                 master::AcquireFillLeaseRspPb &rsp)
+{
+    int64_t remainingTime = GetRequestContext()->reqTimeoutDuration.CalcRealRemainingTime();
+    if (remainingTime <= 0) {
+        return WithRpcDiag(Status(K_RPC_DEADLINE_EXCEEDED, __LINE__, __FILE__,
+                                  FormatString("Request timeout (%ld ms).", -remainingTime)),
+                           "AcquireFillLease", localHostPort_, hostPort_);
+    }
+    RpcOptions opts;
+    opts.SetTimeout(remainingTime);
+    RETURN_IF_NOT_OK(akSkManager_->GenerateSignature(req));
+    auto rc = (brpcSession_ ? brpcSession_->AcquireFillLease(opts, req, rsp)
+                            : rpcSession_->AcquireFillLease(opts, req, rsp));
+    return WithRpcDiag(rc, "AcquireFillLease", localHostPort_, hostPort_);
+}
+
 Status WorkerRemoteMasterOCApi::GetMetaInfo(GetMetaInfoReqPb &req, GetMetaInfoRspPb &rsp)
 {
     int64_t remainingTime = GetRequestContext()->reqTimeoutDuration.CalcRealRemainingTime();
@@ -1735,6 +1752,13 @@ Status WorkerLocalMasterOCApi::Expire(master::ExpireReqPb &req, master::ExpireRs
     RETURN_IF_NOT_OK(akSkManager_->GenerateSignature(req));
     return masterOC_->Expire(req, rsp);
 }
+
+Status WorkerLocalMasterOCApi::AcquireFillLease(master::AcquireFillLeaseReqPb &req,
+                                                master::AcquireFillLeaseRspPb &rsp)
+{
+    RETURN_IF_NOT_OK(akSkManager_->GenerateSignature(req));
+    return masterOC_->AcquireFillLease(req, rsp);
+}
 Status WorkerLocalMasterOCApi::GetMetaInfo(GetMetaInfoReqPb &req, GetMetaInfoRspPb &rsp)
 {
     RETURN_IF_NOT_OK(akSkManager_->GenerateSignature(req));
@@ -232,6 +232,14 @@ public:
      */
     virtual Status Expire(master::ExpireReqPb &req, master::ExpireRspPb &rsp) = 0;
 
+    /**
+     * @brief Send request of acquiring the GetOrCreate fill lease of an object.
+     * @param[in] req The acquire fill lease request protobuf.
+     * @param[out] rsp The acquire fill lease response protobuf.
+     * @return Status of the call.
+     */
+    virtual Status AcquireFillLease(master::AcquireFillLeaseReqPb &req, master::AcquireFillLeaseRspPb &rsp) = 0;
+
     /**
      * @brief A factory method to instantiate the correct derived version of the api. Remote masters will use an
      * rpc-based api, whereas local masters can be optimized for in-process pointer based api.
@@ -480,6 +488,7 @@ public:
                                    master::CheckObjectDataLocationRspPb &rsp) override;
     Status RollbackMultiMeta(master::RollbackMultiMetaReqPb &req, master::RollbackMultiMetaRspPb &rsp) override;
     Status Expire(master::ExpireReqPb &req, master::ExpireRspPb &rsp) override;
+    Status AcquireFillLease(master::AcquireFillLeaseReqPb &req, master::AcquireFillLeaseRspPb &rsp) override;
     Status GetMetaInfo(GetMetaInfoReqPb &req, GetMetaInfoRspPb &rsp) override;
 
 private:
@@ -549,6 +558,7 @@ public:
     Status ReconcileMembershipChange(master::ReconciliationQueryPb &req, master::ReconciliationRspPb &rsp) override;
     std::string GetHostPort() override;
     Status Expire(master::ExpireReqPb &req, master::ExpireRspPb &rsp) override;
+    Status AcquireFillLease(master::AcquireFillLeaseReqPb &req, master::AcquireFillLeaseRspPb &rsp) override;
     Status GetMetaInfo(GetMetaInfoReqPb &req, GetMetaInfoRspPb &rsp) override;
 
     Status PutP2PMeta(PutP2PMetaReqPb &req, PutP2PMetaRspPb &resp) override;
@@ -286,6 +286,11 @@ bool WorkerOcEvictionManager::IsObjectBeingRebalanced(const std::string &objectK
     return rebalancingObjects_.find(objectKey) != rebalancingObjects_.end();
 }
 
+uint32_t WorkerOcEvictionManager::GetGlobalRefCount(const std::string &objectKey) const
+{
+    return gRefTable_ == nullptr ? 0 : gRefTable_->GetRefWorkerCount(objectKey);
+}
+
 void WorkerOcEvictionManager::Add(const std::string &objectKey)
 {
     VLOG(DEBUG_LOG_LEVEL) << FormatString("[ObjectKey %s] EvictionManager add start.", objectKey);
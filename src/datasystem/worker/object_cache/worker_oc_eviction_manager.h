@@ -199,6 +199,13 @@ public:
      */
     bool IsObjectBeingRebalanced(const std::string &objectKey) const;
 
+    /**
+     * @brief Get the number of global references held on an object.
+     * @param[in] objectKey The object key.
+     * @return The global reference count, 0 if the table is not initialized.
+     */
+    uint32_t GetGlobalRefCount(const std::string &objectKey) const;
+
 #ifdef WITH_TESTS
     void EvictionTaskForTest(uint64_t needSize, CacheType cacheType = CacheType::MEMORY)
     {
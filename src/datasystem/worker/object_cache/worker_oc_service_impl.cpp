@@ -3180,6 +3180,26 @@ Status WorkerOCServiceImpl::Expire(const ExpireReqPb &req, ExpireRspPb &rsp)
     return expireProc_->Expire(req, rsp);
 }
 
+Status WorkerOCServiceImpl::AcquireFillLease(const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &rsp)
+{
+    ScopedRequestContext ctx;
+    BthreadReadGuard noReconciliation;
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(
+        ValidateWorkerState(noReconciliation, GetRequestContext()->reqTimeoutDuration.CalcRemainingTime()),
+        "validate worker state failed");
+    return getProc_->AcquireFillLease(req, rsp);
+}
+
+Status WorkerOCServiceImpl::MatchPrefix(const MatchPrefixReqPb &req, MatchPrefixRspPb &rsp)
+{
+    ScopedRequestContext ctx;
+    BthreadReadGuard noReconciliation;
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(
+        ValidateWorkerState(noReconciliation, GetRequestContext()->reqTimeoutDuration.CalcRemainingTime()),
+        "validate worker state failed");
+    return getProc_->MatchPrefix(req, rsp);
+}
+
 Status WorkerOCServiceImpl::GetMetaInfo(const GetMetaInfoReqPb &req, GetMetaInfoRspPb &rsp)
 {
     BthreadReadGuard noReconciliation;
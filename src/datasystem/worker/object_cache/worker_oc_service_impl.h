@@ -892,6 +892,22 @@ public:
      */
     Status Expire(const ExpireReqPb &req, ExpireRspPb &rsp) override;
 
+    /**
+     * @brief Acquire the GetOrCreate fill lease of an object.
+     * @param[in] req The acquire fill lease request protobuf.
+     * @param[out] rsp The acquire fill lease response protobuf.
+     * @return Status of the call.
+     */
+    Status AcquireFillLease(const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &rsp) override;
+
+    /**
+     * @brief Match the longest cached prefix of a chain of keys.
+     * @param[in] req The match prefix request protobuf.
+     * @param[out] rsp The match prefix response protobuf.
+     * @return Status of the call.
+     */
+    Status MatchPrefix(const MatchPrefixReqPb &req, MatchPrefixRspPb &rsp) override;
+
     /**
      * @brief Get device meta info of the keys.
      * @param[in] req The exist request protobuf.
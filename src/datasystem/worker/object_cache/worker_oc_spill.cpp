@@ -19,6 +19,9 @@
  */
 #include "datasystem/worker/object_cache/worker_oc_spill.h"
 
+#include <algorithm>
+#include <climits>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <shared_mutex>
@@ -33,6 +36,7 @@
 #include "datasystem/common/log/log.h"
 #include "datasystem/common/iam/tenant_auth_manager.h"
 #include "datasystem/common/inject/inject_point.h"
+#include "datasystem/common/metrics/kv_metrics.h"
 #include "datasystem/common/perf/perf_manager.h"
 #include "datasystem/common/constants.h"
 #include "datasystem/common/util/file_util.h"
@@ -77,6 +81,10 @@ DS_DEFINE_uint64_dynamic(
 DS_DEFINE_validator(spill_file_open_limit, &Validator::ValidateSpillOpenFileLimit);
 DS_DEFINE_bool(spill_enable_readahead, true,
                "Disable readahead can mitigate the read amplification problem for offset read, default is true");
+DS_DEFINE_uint32(spill_load_queue_depth, 16,
+                 "The maximum number of spill file reads issued concurrently when a batch get loads spilled objects. "
+                 "Objects that lie close to each other in a spill file are merged into one read.");
+DS_DEFINE_validator(spill_load_queue_depth, &Validator::ValidateThreadNum);
 
 namespace datasystem {
 namespace object_cache {
@@ -86,11 +94,57 @@ constexpr int MAX_OPEN_RETRY = 10;
 constexpr int BACKOFF_TIME_MS = 200;
 constexpr int INVALID_FD = -1;
 constexpr int PERMISSION = 0700;
+// Merge two ranges of a batch load into one read if the hole between them is no larger than this.
+constexpr uint64_t LOAD_MERGE_MAX_GAP = 16 * 1024;
+// Stop merging ranges into a read once it is this large or covers this many objects.
+constexpr uint64_t LOAD_MERGE_MAX_SIZE = 8 * MB;
+constexpr size_t LOAD_MERGE_MAX_RANGES = 512;
 
 // Total spill file disk size
 std::atomic<uint64_t> totalSpillFileDiskSize{ 0 };
 std::atomic<int64_t> openFdCount{ 0 };
 
+namespace {
+Status CheckLoadRange(size_t size, size_t offset, uint64_t objectSize)
+{
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(SIZE_MAX - size >= offset, K_RUNTIME_ERROR,
+                                         FormatString("size: %zu + offset: %zu > SIZE_MAX", size, offset));
+    CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
+        size + offset <= objectSize && size > 0, K_RUNTIME_ERROR,
+        FormatString("Invalid size: %zu, offset: %zu, objectSize: %zu", size, offset, objectSize));
+    return Status::OK();
+}
+
+// A merged read of a batch load, it covers ranges [begin, end) of the sorted ranges.
+struct SpillLoadRead {
+    size_t begin = 0;
+    size_t end = 0;
+    uint64_t length = 0;
+};
+
+std::vector<SpillLoadRead> MergeLoadRanges(const std::vector<SpillLoadRange> &ranges)
+{
+    std::vector<SpillLoadRead> reads;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        const auto &range = ranges[i];
+        if (!reads.empty()) {
+            auto &last = reads.back();
+            const auto &first = ranges[last.begin];
+            uint64_t lastEnd = first.fileOffset + last.length;
+            if (range.file == first.file && range.fileOffset >= lastEnd
+                && range.fileOffset - lastEnd <= LOAD_MERGE_MAX_GAP && last.length < LOAD_MERGE_MAX_SIZE
+                && last.end - last.begin < LOAD_MERGE_MAX_RANGES) {
+                last.end = i + 1;
+                last.length = range.fileOffset + range.request->size - first.fileOffset;
+                continue;
+            }
+        }
+        reads.emplace_back(SpillLoadRead{ i, i + 1, range.request->size });
+    }
+    return reads;
+}
+}  // namespace
+
 SpillBuffer::SpillBuffer()
 {
     data_.reserve(SpillFileManager::LARGE_OBJ_SIZE_THRESHOLD);
@@ -206,6 +260,40 @@ Status ActiveSpillFile::Read(void *buffer, size_t count, off_t offset)
     return ReadFile(fd_, buffer, count, offset);
 }
 
+Status ActiveSpillFile::ReadV(std::vector<iovec> iov, off_t offset)
+{
+    CHECK_FAIL_RETURN_STATUS(offset >= 0, K_INVALID, FormatString("offset %ld < 0", offset));
+    size_t index = 0;
+    while (index < iov.size()) {
+        if (iov[index].iov_len == 0) {
+            ++index;
+            continue;
+        }
+        int count = static_cast<int>(std::min<size_t>(iov.size() - index, IOV_MAX));
+        ssize_t bytesRead = preadv(fd_, iov.data() + index, count, offset);
+        if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        }
+        CHECK_FAIL_RETURN_STATUS(bytesRead > 0, K_IO_ERROR,
+                                 FormatString("preadv failed, fd: %d, offset: %ld, return: %ld, errno: %d, errmsg: %s",
+                                              fd_, offset, bytesRead, errno, StrErr(errno)));
+        offset += bytesRead;
+        // Skip the buffers filled, a short read resumes from the middle of a buffer.
+        auto left = static_cast<size_t>(bytesRead);
+        while (left > 0) {
+            if (left >= iov[index].iov_len) {
+                left -= iov[index].iov_len;
+                ++index;
+                continue;
+            }
+            iov[index].iov_base = static_cast<char *>(iov[index].iov_base) + left;
+            iov[index].iov_len -= left;
+            left = 0;
+        }
+    }
+    return Status::OK();
+}
+
 Status ActiveSpillFile::ReadToRpcMessage(size_t size, size_t offset, std::vector<RpcMessage> &messages)
 {
     const size_t maxInt = std::numeric_limits<int32_t>::max();
@@ -643,11 +731,7 @@ Status SpillFileManager::LoadFromDisk(const std::string &objectKey, void *buffer
     };
     auto readFileFunc = [buffer, offset, size](std::shared_ptr<ActiveSpillFile> &file, uint64_t objectOffset,
                                                uint64_t objectSize) {
-        CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(SIZE_MAX - size >= offset, K_RUNTIME_ERROR,
-                                             FormatString("size: %zu + offset: %zu > SIZE_MAX", size, offset));
-        CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
-            size + offset <= objectSize && size > 0, K_RUNTIME_ERROR,
-            FormatString("Invalid size: %zu, offset: %zu, objectSize: %zu", size, offset, objectSize));
+        RETURN_IF_NOT_OK(CheckLoadRange(size, offset, objectSize));
         return file->Read(buffer, size, objectOffset + offset);
     };
     return LoadFromDiskImpl(objectKey, size, readBufferFunc, readFileFunc);
@@ -662,16 +746,84 @@ Status SpillFileManager::LoadFromDisk(const std::string &objectKey, std::vector<
     };
     auto readFileFunc = [&messages, size, offset](std::shared_ptr<ActiveSpillFile> &file, uint64_t objectOffset,
                                                   uint64_t objectSize) {
-        CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(SIZE_MAX - size >= offset, K_RUNTIME_ERROR,
-                                             FormatString("size: %zu + offset: %zu > SIZE_MAX", size, offset));
-        CHECK_FAIL_RETURN_STATUS_PRINT_ERROR(
-            size + offset <= objectSize && size > 0, K_RUNTIME_ERROR,
-            FormatString("Invalid size: %zu, offset: %zu, objectSize: %zu", size, offset, objectSize));
+        RETURN_IF_NOT_OK(CheckLoadRange(size, offset, objectSize));
         return file->ReadToRpcMessage(size, objectOffset + offset, messages);
     };
     return LoadFromDiskImpl(objectKey, size, readBufferFunc, readFileFunc);
 }
 
+void SpillFileManager::ResolveLoadRanges(const std::vector<SpillLoadRequest *> &requests,
+                                         std::vector<SpillLoadRange> &ranges,
+                                         std::vector<std::pair<std::string, std::string>> &reopened)
+{
+    std::vector<SpillLoadRequest *> closedFileRequests;
+    {
+        std::shared_lock<std::shared_timed_mutex> rLock(fileInfoMutex_);
+        for (auto *request : requests) {
+            uint64_t objectSize = 0;
+            if (buffer_.Exist(request->objectKey, objectSize)) {
+                request->rc = buffer_.CopyTo(request->objectKey, static_cast<const char *>(request->buffer),
+                                             request->size, request->offset);
+                continue;
+            }
+            ObjectLocation loc;
+            FileInfo *fileInfo = nullptr;
+            request->rc = GetObjectFileLocation(request->objectKey, loc);
+            if (request->rc.IsOk()) {
+                request->rc = CheckLoadRange(request->size, request->offset, loc.size);
+            }
+            if (request->rc.IsOk()) {
+                request->rc = GetFileInfoPtr(request->objectKey, loc.path, fileInfo);
+            }
+            if (request->rc.IsError()) {
+                continue;
+            }
+            if (fileInfo->file == nullptr) {
+                closedFileRequests.emplace_back(request);
+                continue;
+            }
+            ranges.emplace_back(SpillLoadRange{ fileInfo->file, loc.offset + request->offset, request });
+        }
+    }
+    if (closedFileRequests.empty()) {
+        return;
+    }
+    std::lock_guard<std::shared_timed_mutex> wLock(fileInfoMutex_);
+    for (auto *request : closedFileRequests) {
+        ObjectLocation loc;
+        FileInfo *fileInfo = nullptr;
+        bool isReopen = false;
+        request->rc = GetObjectFileLocation(request->objectKey, loc);
+        if (request->rc.IsOk()) {
+            request->rc = CheckLoadRange(request->size, request->offset, loc.size);
+        }
+        if (request->rc.IsOk()) {
+            request->rc = GetFileInfoAndReopenFile(request->objectKey, loc.path, fileInfo, isReopen);
+        }
+        if (request->rc.IsError()) {
+            continue;
+        }
+        if (isReopen) {
+            reopened.emplace_back(request->objectKey, loc.path);
+        }
+        ranges.emplace_back(SpillLoadRange{ fileInfo->file, loc.offset + request->offset, request });
+    }
+}
+
+void SpillFileManager::FinishLoadRanges(const std::vector<std::pair<std::string, std::string>> &reopened)
+{
+    if (reopened.empty() || !FdCountExceedLimit()) {
+        return;
+    }
+    std::lock_guard<std::shared_timed_mutex> wLock(fileInfoMutex_);
+    for (const auto &kv : reopened) {
+        FileInfo *fileInfo = nullptr;
+        if (GetFileInfoPtr(kv.first, kv.second, fileInfo).IsOk()) {
+            CloseFileIfExceedLimit(fileInfo);
+        }
+    }
+}
+
 Status SpillFileManager::DeleteFromDisk(const std::string &objectKey, uint64_t &decSize, bool isEviction)
 {
     PerfPoint point(PerfKey::WORKER_SPILL_DELETE);
@@ -1023,6 +1175,10 @@ Status WorkerOcSpill::Init()
         LOG(INFO) << FormatString("[SPill] spill_size_limit automatically set to %llu bytes.",
                                   initial95SpillFreeSpace_);
     }
+    if (loadPool_ == nullptr) {
+        RETURN_IF_EXCEPTION_OCCURS(loadPool_ =
+                                       std::make_unique<ThreadPool>(0, FLAGS_spill_load_queue_depth, "SpillLoad"));
+    }
     for (uint32_t i = 0; i < FLAGS_spill_thread_num; i++) {
         auto tmpMgr = std::make_unique<SpillFileManager>(i, spillIoCounters_);
         tmpMgr->Init(realSpillDirectory);
@@ -1119,6 +1275,98 @@ Status WorkerOcSpill::Get(const std::string &objectKey, std::vector<RpcMessage>
     return status;
 }
 
+Status WorkerOcSpill::BatchGet(std::vector<SpillLoadRequest> &requests)
+{
+    CHECK_FAIL_RETURN_STATUS(!fileMgr_.empty(), K_NOT_READY, "The Spill File Manager is not initialized.");
+    Timer timer;
+    std::vector<std::vector<SpillLoadRequest *>> mgrRequests(fileMgr_.size());
+    for (auto &request : requests) {
+        mgrRequests[GetMgrIndex(request.objectKey)].emplace_back(&request);
+    }
+    std::vector<SpillLoadRange> ranges;
+    std::vector<std::vector<std::pair<std::string, std::string>>> reopened(fileMgr_.size());
+    for (size_t i = 0; i < mgrRequests.size(); ++i) {
+        if (!mgrRequests[i].empty()) {
+            fileMgr_[i]->ResolveLoadRanges(mgrRequests[i], ranges, reopened[i]);
+        }
+    }
+    ReadLoadRanges(ranges);
+    for (size_t i = 0; i < reopened.size(); ++i) {
+        fileMgr_[i]->FinishLoadRanges(reopened[i]);
+    }
+
+    size_t failedCount = 0;
+    for (auto &request : requests) {
+        if (request.rc.IsError()) {
+            ++failedCount;
+            continue;
+        }
+        if (spillEvictionList_.Exist(request.objectKey)) {
+            spillEvictionList_.Add(request.objectKey, Q1);
+        }
+    }
+    auto elapsedUs = static_cast<uint64_t>(timer.ElapsedMicroSecond());
+    metrics::GetHistogram(static_cast<uint16_t>(metrics::KvMetricId::WORKER_SPILL_BATCH_LOAD_LATENCY))
+        .Observe(elapsedUs);
+    LOG(INFO) << FormatString("Batch load %zu objects from spill, file ranges: %zu, failed: %zu, cost: %luus",
+                              requests.size(), ranges.size(), failedCount, elapsedUs);
+    return Status::OK();
+}
+
+void WorkerOcSpill::ReadLoadRanges(std::vector<SpillLoadRange> &ranges)
+{
+    if (ranges.empty()) {
+        return;
+    }
+    std::sort(ranges.begin(), ranges.end(), [](const SpillLoadRange &lhs, const SpillLoadRange &rhs) {
+        return lhs.file != rhs.file ? lhs.file < rhs.file : lhs.fileOffset < rhs.fileOffset;
+    });
+    auto reads = MergeLoadRanges(ranges);
+    auto readOne = [this, &ranges](const SpillLoadRead &read) {
+        PerfPoint point(PerfKey::WORKER_SPILL_READ_FILE);
+        // The holes between the merged ranges are all read into one scratch buffer and dropped.
+        std::vector<char> hole(read.end - read.begin > 1 ? LOAD_MERGE_MAX_GAP : 0);
+        std::vector<iovec> iov;
+        iov.reserve((read.end - read.begin) * 2);
+        uint64_t readEnd = ranges[read.begin].fileOffset;
+        for (size_t i = read.begin; i < read.end; ++i) {
+            const auto &range = ranges[i];
+            if (range.fileOffset > readEnd) {
+                iov.emplace_back(iovec{ hole.data(), range.fileOffset - readEnd });
+            }
+            iov.emplace_back(iovec{ range.request->buffer, range.request->size });
+            readEnd = range.fileOffset + range.request->size;
+        }
+        Timer timer;
+        Status rc = ranges[read.begin].file->ReadV(std::move(iov), ranges[read.begin].fileOffset);
+        metrics::GetHistogram(static_cast<uint16_t>(metrics::KvMetricId::WORKER_SPILL_LOAD_LATENCY))
+            .Observe(static_cast<uint64_t>(timer.ElapsedMicroSecond()));
+        uint64_t bytes = 0;
+        for (size_t i = read.begin; i < read.end; ++i) {
+            ranges[i].request->rc = rc;
+            bytes += ranges[i].request->size;
+        }
+        if (rc.IsOk()) {
+            spillIoCounters_.spillOutCount.fetch_add(read.end - read.begin, std::memory_order_relaxed);
+            spillIoCounters_.spillOutBytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+    };
+    if (reads.size() == 1 || loadPool_ == nullptr) {
+        std::for_each(reads.begin(), reads.end(), readOne);
+        return;
+    }
+    // The calling thread takes the first read, the rest are issued to the pool.
+    std::vector<std::future<void>> futures;
+    futures.reserve(reads.size() - 1);
+    for (size_t i = 1; i < reads.size(); ++i) {
+        futures.emplace_back(loadPool_->Submit(readOne, reads[i]));
+    }
+    readOne(reads[0]);
+    for (auto &future : futures) {
+        future.get();
+    }
+}
+
 Status WorkerOcSpill::Delete(const std::string &objectKey, bool isEviction)
 {
     size_t mgrIndex = GetMgrIndex(objectKey);
@@ -31,9 +31,12 @@
 #include <unordered_set>
 #include <vector>
 
+#include <sys/uio.h>
+
 #include "datasystem/common/perf/perf_manager.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/common/util/thread.h"
+#include "datasystem/common/util/thread_pool.h"
 #include "datasystem/common/util/timer.h"
 #include "datasystem/common/util/wait_post.h"
 #include "datasystem/worker/object_cache/eviction_list.h"
@@ -76,6 +79,14 @@ public:
      */
     Status Read(void *buffer, size_t count, off_t offset);
 
+    /**
+     * @brief Reads a contiguous range of the file into the buffers provided, in order.
+     * @param[in] iov The destination buffers, their total length is the number of bytes to read.
+     * @param[in] offset The offset in the file to read from.
+     * @return Status of the call.
+     */
+    Status ReadV(std::vector<iovec> iov, off_t offset);
+
     /**
      * @brief Read data from file to RpcMessage.
      * @param[in] size The size of the data to be loaded from the file.
@@ -127,6 +138,23 @@ struct HoleFileInfo {
     FileInfo *fileinfo;
 };
 
+// One object of a batch load, the result of the object is returned in rc.
+struct SpillLoadRequest {
+    std::string objectKey;
+    // The destination buffer, usually the shm unit of the object.
+    void *buffer = nullptr;
+    size_t size = 0;
+    size_t offset = 0;
+    Status rc;
+};
+
+// The byte range of a batch load request in its spill file.
+struct SpillLoadRange {
+    std::shared_ptr<ActiveSpillFile> file;
+    uint64_t fileOffset = 0;
+    SpillLoadRequest *request = nullptr;
+};
+
 // Worker-owned physical SSD spill IO counters shared with its file managers.
 struct SpillIoCounters {
     std::atomic<uint64_t> spillInCount{ 0 };
@@ -344,6 +372,22 @@ public:
     Status LoadFromDisk(const std::string &objectKey, std::vector<RpcMessage> &messages, size_t size,
                         size_t offset = 0);
 
+    /**
+     * @brief Resolve the requests of a batch load to their ranges in the spill files. The requests of objects still in
+     * the spill buffer are copied at once, the requests that fail here get their error in rc.
+     * @param[in] requests The requests of the objects managed by this manager.
+     * @param[out] ranges The file ranges that remain to be read.
+     * @param[out] reopened The {objectKey, path} of the files reopened for the batch.
+     */
+    void ResolveLoadRanges(const std::vector<SpillLoadRequest *> &requests, std::vector<SpillLoadRange> &ranges,
+                           std::vector<std::pair<std::string, std::string>> &reopened);
+
+    /**
+     * @brief Close the files reopened by ResolveLoadRanges once the batch is read, if too many files are open.
+     * @param[in] reopened The {objectKey, path} of the files reopened for the batch.
+     */
+    void FinishLoadRanges(const std::vector<std::pair<std::string, std::string>> &reopened);
+
     /**
      * @brief Remove the spilled data from the file.
      * @param[in] objectKey The ID of the object that data to be deleted.
@@ -673,6 +717,14 @@ public:
      */
     Status Get(const std::string &objectKey, std::vector<RpcMessage> &messages, size_t size, size_t offset = 0);
 
+    /**
+     * @brief Get the spilled data of a batch of objects. The objects close to each other in a spill file are merged
+     * into one read, and the reads are issued concurrently at most spill_load_queue_depth at a time.
+     * @param[in,out] requests The objects to be loaded, the result of each object is returned in its rc.
+     * @return Status of the call.
+     */
+    Status BatchGet(std::vector<SpillLoadRequest> &requests);
+
     /**
      * @brief Init procedure of this request handler.
      * @return Status of the call.
@@ -836,6 +888,12 @@ private:
      */
     void Compact();
 
+    /**
+     * @brief Read the resolved ranges of a batch load, the result of each range is set to its request.
+     * @param[in] ranges The ranges to be read.
+     */
+    void ReadLoadRanges(std::vector<SpillLoadRange> &ranges);
+
     // The flag whether to stop compaction
     std::atomic<bool> stopCompaction_{ false };
     WaitPost waitPost_;
@@ -846,6 +904,8 @@ private:
 
     // Pointer to the SpillFileManager instance.
     std::vector<std::unique_ptr<SpillFileManager>> fileMgr_;
+    // Issues the merged reads of BatchGet.
+    std::unique_ptr<ThreadPool> loadPool_;
     // The size of all active spilled object data that has not been deleted from file and is still in use
     std::atomic<uint64_t> totalActiveSpilledSize_{ 0 };
 
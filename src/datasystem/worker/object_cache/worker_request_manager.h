@@ -102,6 +102,8 @@ struct GetObjInfo {
     std::shared_ptr<ProviderUbFailureDetailPb> remoteProviderUbFailureDetail;
     Status rc;
     bool isRollBack = false;
+    // The object was loaded from the spill files by the batch load before the local get.
+    bool loadedFromDisk = false;
     bool NotFound() const
     {
         return params == nullptr && rc.IsOk();
@@ -20,6 +20,7 @@
 
 #include "datasystem/common/ak_sk/ak_sk_manager.h"
 #include "datasystem/common/log/log.h"
+#include "datasystem/common/log/trace_timeline.h"
 #include "datasystem/common/perf/perf_manager.h"
 #include "datasystem/common/util/status_helper.h"
 #include "datasystem/protos/perf_posix.pb.h"
@@ -65,4 +66,17 @@ Status PerfServiceImpl::ResetPerfLog(const datasystem::ResetPerfLogReqPb &req, d
     return Status::OK();
 }
 
+Status PerfServiceImpl::GetTraceTimeline(const datasystem::GetTraceTimelineReqPb &req,
+                                         datasystem::GetTraceTimelineRspPb &rsp)
+{
+    if (akSkManager_->SystemAuthEnabled()) {
+        CHECK_FAIL_RETURN_STATUS(!req.signature().empty(), K_NOT_AUTHORIZED, "AK/SK not provide");
+        RETURN_IF_NOT_OK_PRINT_ERROR_MSG(akSkManager_->VerifySignatureAndTimestamp(req), "AK/SK failed");
+    }
+    CHECK_FAIL_RETURN_STATUS(TraceTimeline::IsEnabled(), K_NOT_READY,
+                             "Trace timeline is disabled, set trace_timeline_sample_rate first");
+    rsp.set_chrome_trace_json(TraceTimeline::Instance().ExportChromeTrace(req.trace_id()));
+    return Status::OK();
+}
+
 }  // namespace datasystem
\ No newline at end of file
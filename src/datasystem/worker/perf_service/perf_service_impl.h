@@ -40,6 +40,7 @@ public:
 
     Status GetPerfLog(const datasystem::GetPerfLogReqPb &req, datasystem::GetPerfLogRspPb &rsp);
     Status ResetPerfLog(const datasystem::ResetPerfLogReqPb &req, datasystem::ResetPerfLogRspPb &rsp);
+    Status GetTraceTimeline(const datasystem::GetTraceTimelineReqPb &req, datasystem::GetTraceTimelineRspPb &rsp);
 
 private:
     std::shared_ptr<AkSkManager> akSkManager_{ nullptr };
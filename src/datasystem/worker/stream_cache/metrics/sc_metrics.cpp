@@ -45,6 +45,11 @@ std::vector<StreamMetric> SCStreamMetrics::streamMetrics_ = {
     StreamMetric::NumRemoteProducersBlocked,
     StreamMetric::NumRemoteConsumersBlocking,
 
+    StreamMetric::NumPagesSpilled,
+    StreamMetric::NumPagesReadBack,
+    StreamMetric::SpillWriteBandwidth,
+    StreamMetric::SpillReadBandwidth,
+
     StreamMetric::RetainDataState,
     StreamMetric::StreamState
 };
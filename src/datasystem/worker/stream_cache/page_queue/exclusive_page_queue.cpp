@@ -74,6 +74,9 @@ Status ExclusivePageQueue::GetDataPage(
     const auto timeoutMs = static_cast<uint64_t>(req.timeout_ms());
     VLOG(SC_NORMAL_LOG_LEVEL) << FormatString("[%s] Locate page. lastRecvCursor %zu. Timeout %u", LogPrefix(),
                                               lastRecvCursor, timeoutMs);
+    // A local consumer follows the next pointers from the page we return, so every spilled page after
+    // lastRecvCursor has to be back in shared memory, not just the first one.
+    RETURN_IF_NOT_OK(ReadBackSpilledPages(lastRecvCursor, true));
     std::shared_ptr<StreamDataPage> page;
     Status rc = LocatePage(lastRecvCursor, page);
     if (rc.GetCode() == K_NOT_FOUND && timeoutMs > 0) {
@@ -527,6 +530,10 @@ Status ExclusivePageQueue::Reset()
     usedMemBytes_ = 0;
     lastAckCursor_ = 0;
     nextCursor_ = 1;
+    readBackPages_.clear();
+    if (pageSpill_ != nullptr) {
+        pageSpill_->Reset();
+    }
     reserveState_.pageZeroCreated = false;
     reserveState_.freeListCreated = false;
     // Set release metrics equal to create metrics
@@ -559,6 +566,9 @@ ExclusivePageQueue::ExclusivePageQueue(StreamManager *mgr, Optional<StreamFields
     if (cfg) {
         streamFields_ = cfg.value();
     }
+    if (StreamPageSpill::IsEnabled()) {
+        pageSpill_ = std::make_unique<StreamPageSpill>(streamName_);
+    }
 }
 
 bool ExclusivePageQueue::IsEncryptStream(const std::string &streamName) const
@@ -175,6 +175,38 @@ public:
         return scMetricBigPagesReleased_.load(std::memory_order_relaxed);
     }
 
+    /**
+     * @brief Gets the number of pages spilled to disk
+     */
+    uint64_t GetNumPagesSpilled() const
+    {
+        return pageSpill_ == nullptr ? 0 : pageSpill_->GetNumPagesSpilled();
+    }
+
+    /**
+     * @brief Gets the number of pages read back from disk
+     */
+    uint64_t GetNumPagesReadBack() const
+    {
+        return pageSpill_ == nullptr ? 0 : pageSpill_->GetNumPagesReadBack();
+    }
+
+    /**
+     * @brief Gets the bytes spilled to disk
+     */
+    uint64_t GetSpilledBytes() const
+    {
+        return pageSpill_ == nullptr ? 0 : pageSpill_->GetSpilledBytes();
+    }
+
+    /**
+     * @brief Gets the bytes read back from disk
+     */
+    uint64_t GetReadBackBytes() const
+    {
+        return pageSpill_ == nullptr ? 0 : pageSpill_->GetReadBackBytes();
+    }
+
     /**
      * @brief Batch insert.
      * @param[in] buf contiguous payload of the elements in reverse order
@@ -25,6 +25,7 @@
 
 #include "datasystem/common/constants.h"
 #include "datasystem/common/util/lock_helper.h"
+#include "datasystem/common/util/raii.h"
 #include "datasystem/common/util/request_counter.h"
 #include "datasystem/common/util/rpc_util.h"
 #include "datasystem/stream/stream_config.h"
@@ -378,7 +379,7 @@ void PageQueueBase::AddListToAckChain(std::list<PageShmUnit> &freeList)
     }
 }
 
-Status PageQueueBase::Ack(uint64_t cursor, StreamMetaShm *streamMetaShm)
+Status PageQueueBase::Ack(uint64_t cursor, StreamMetaShm *streamMetaShm, uint64_t spillCursor)
 {
     static auto last = std::chrono::steady_clock::now();
     INJECT_POINT("ExclusivePageQueue.Ack.Start");
@@ -392,6 +393,14 @@ Status PageQueueBase::Ack(uint64_t cursor, StreamMetaShm *streamMetaShm)
     std::vector<Status> status;
     Status rc = AckImpl(cursor, freeList, bigElementPage, streamMetaShm);
     status.emplace_back(rc);
+    if (pageSpill_ != nullptr) {
+        pageSpill_->Ack(cursor);
+        if (spillCursor > cursor) {
+            // The spilled pages are recycled the same way as the acked ones.
+            rc = SpillPages(spillCursor, freeList, streamMetaShm);
+            status.emplace_back(rc);
+        }
+    }
     if (freeList.empty() && bigElementPage.empty()) {
         // If nothing to reclaim. Periodically dump the pool stat. But not too much to flood the log
         const int dumpInterval = 10;
@@ -466,11 +475,12 @@ Status PageQueueBase::AckImpl(uint64_t cursor, std::list<PageShmUnit> &freeList,
             // move it backward.
             auto lastAckCursor = lastAckCursor_.load(std::memory_order_relaxed);
             lastAckCursor_.store(std::max(lastCursor, lastAckCursor), std::memory_order_relaxed);
-            // Cache the free page
+            // Cache the free page. The usage of a page read back from disk was given back when it was spilled.
             auto size = page->GetTotalEleSize();
+            bool readBack = readBackPages_.erase(it->first) > 0;
             freeList.emplace_back(std::move(*it));
             it = idxChain_.erase(it);
-            if (streamMetaShm) {
+            if (streamMetaShm && !readBack) {
                 LOG_IF_ERROR(streamMetaShm->TryDecUsage(size), "TryDecUsage failed");
             }
             LogCursors();
@@ -985,6 +995,177 @@ Status PageQueueBase::FreePendingList()
     return Status::OK();
 }
 
+Status PageQueueBase::SpillPages(uint64_t spillCursor, std::list<PageShmUnit> &freeList,
+                                 StreamMetaShm *streamMetaShm)
+{
+    // Only spill when the producers are going to block on memory.
+    RETURN_OK_IF_TRUE(CheckHadEnoughMem(GetPageSize()).IsOk());
+    PerfPoint point(PerfKey::PAGE_SPILL);
+    std::vector<SpilledPage> pages;
+    RETURN_IF_NOT_OK(PickPagesToSpill(spillCursor, pages));
+    // Write the copies without holding idxMutex_, the remote push and the producers are not held up by the disk.
+    Status rc;
+    for (auto &spilled : pages) {
+        rc = pageSpill_->Spill(spilled.unit.first, spilled.lastCursor, spilled.image.data(), spilled.image.size());
+        if (rc.IsError()) {
+            break;
+        }
+        spilled.spilled = true;
+        spilled.image.clear();
+        spilled.image.shrink_to_fit();
+    }
+    ReleaseSpilledPages(pages, freeList, streamMetaShm);
+    return rc;
+}
+
+Status PageQueueBase::PickPagesToSpill(uint64_t spillCursor, std::vector<SpilledPage> &pages)
+{
+    WriteLockHelper xlock2(STREAM_COMMON_LOCK_ARGS(idxMutex_));
+    {
+        ReadLockHelper rlock3(STREAM_COMMON_LOCK_ARGS(ackMutex_));
+        RETURN_OK_IF_TRUE(!ackChain_.empty());
+    }
+    // Spill enough pages to refill the free page cache in one go.
+    const size_t maxPagesToSpill = std::max<size_t>(FLAGS_sc_cache_pages, 1);
+    for (auto it = idxChain_.begin(); it != idxChain_.end() && pages.size() < maxPagesToSpill; ++it) {
+        auto &page = it->second;
+        auto slotCount = page->GetSlotCount();
+        auto lastCursor = it->first + slotCount;
+        // Local consumers are done with the pages before spillCursor, only the remote consumers still need them.
+        // The last page is never spilled.
+        if (lastCursor >= spillCursor || std::next(it) == idxChain_.end()) {
+            break;
+        }
+        // Skip the pages still being sent to the remote workers, still being written by a producer, holding
+        // BigElements, read back for the remote consumers, or being spilled by another ack.
+        std::vector<std::pair<uint64_t, ShmView>> bigId;
+        RETURN_IF_NOT_OK(page->ExtractBigElementsUpTo(lastCursor, bigId, false));
+        if (page->Empty() || page->GetRefCount() != 1 || page->HasInFlightSlot() || !bigId.empty()
+            || readBackPages_.count(it->first) > 0 || spillingPages_.count(it->first) > 0) {
+            continue;
+        }
+        // Copy the page while nobody else holds it, so the image carries the ref count of an idle page.
+        SpilledPage spilled;
+        spilled.unit = *it;
+        spilled.slotCount = slotCount;
+        spilled.lastCursor = lastCursor;
+        spilled.image.assign(static_cast<const char *>(page->GetPointer()), GetPageSize());
+        spillingPages_.emplace(it->first);
+        pages.emplace_back(std::move(spilled));
+    }
+    return Status::OK();
+}
+
+void PageQueueBase::ReleaseSpilledPages(std::vector<SpilledPage> &pages, std::list<PageShmUnit> &freeList,
+                                        StreamMetaShm *streamMetaShm)
+{
+    if (pages.empty()) {
+        return;
+    }
+    WriteLockHelper xlock2(STREAM_COMMON_LOCK_ARGS(idxMutex_));
+    for (auto &spilled : pages) {
+        auto endCursor = spilled.unit.first;
+        auto &page = spilled.unit.second;
+        spillingPages_.erase(endCursor);
+        if (!spilled.spilled) {
+            continue;
+        }
+        auto it = std::find_if(idxChain_.begin(), idxChain_.end(),
+                               [endCursor](const PageShmUnit &ele) { return ele.first == endCursor; });
+        // The page was picked up by a remote push or acked while it was written. Keep the copy in memory.
+        if (it == idxChain_.end() || it->second != page || page->GetRefCount() != 1
+            || page->GetSlotCount() != spilled.slotCount) {
+            pageSpill_->Drop(endCursor);
+            continue;
+        }
+        auto size = page->GetTotalEleSize();
+        if (streamMetaShm) {
+            LOG_IF_ERROR(streamMetaShm->TryDecUsage(size), "TryDecUsage failed");
+        }
+        VLOG(SC_NORMAL_LOG_LEVEL) << FormatString("[%s] Spill page<%s> [%zu, %zu] success.", LogPrefix(),
+                                                  page->GetPageId(), endCursor + 1, spilled.lastCursor);
+        freeList.emplace_back(std::move(*it));
+        idxChain_.erase(it);
+    }
+}
+
+Status PageQueueBase::ReadBackSpilledPages(uint64_t lastAppendCursor, bool toEnd)
+{
+    RETURN_OK_IF_TRUE(pageSpill_ == nullptr || pageSpill_->Empty());
+    std::vector<uint64_t> endCursors;
+    {
+        WriteLockHelper xlock2(STREAM_COMMON_LOCK_ARGS(idxMutex_));
+        std::vector<uint64_t> spilled;
+        pageSpill_->Find(lastAppendCursor, toEnd, spilled);
+        for (auto endCursor : spilled) {
+            // A page being spilled is still in the index chain.
+            if (spillingPages_.count(endCursor) > 0) {
+                continue;
+            }
+            CHECK_FAIL_RETURN_STATUS(readingBackPages_.count(endCursor) == 0, K_TRY_AGAIN,
+                                     FormatString("[%s] The page after cursor %zu is being read back", LogPrefix(),
+                                                  endCursor));
+            endCursors.emplace_back(endCursor);
+        }
+        readingBackPages_.insert(endCursors.begin(), endCursors.end());
+    }
+    Raii unmark([this, &endCursors]() {
+        WriteLockHelper xlock2(STREAM_COMMON_LOCK_ARGS(idxMutex_));
+        for (auto endCursor : endCursors) {
+            readingBackPages_.erase(endCursor);
+        }
+    });
+    for (auto endCursor : endCursors) {
+        RETURN_IF_NOT_OK(ReadBackPageNotLocked(endCursor));
+    }
+    return Status::OK();
+}
+
+Status PageQueueBase::ReadBackPageNotLocked(uint64_t endCursor)
+{
+    PerfPoint point(PerfKey::PAGE_READ_BACK);
+    std::shared_ptr<StreamDataPage> page;
+    Status rc = CreateNewPage(page, false);
+    if (rc.GetCode() == K_OUT_OF_MEMORY) {
+        // Come back when more pages are acked or spilled.
+        RETURN_STATUS(K_TRY_AGAIN, FormatString("[%s] No memory to read back the page after cursor %zu: %s",
+                                                LogPrefix(), endCursor, rc.GetMsg()));
+    }
+    RETURN_IF_NOT_OK(rc);
+    rc = pageSpill_->ReadBack(endCursor, page->GetPointer(), GetPageSize());
+    if (rc.IsError()) {
+        WriteLockHelper xlock3(STREAM_COMMON_LOCK_ARGS(ackMutex_));
+        std::list<PageShmUnit> freeList;
+        freeList.emplace_back(0, std::move(page));
+        LOG_IF_ERROR(MoveFreeListToPendFree(endCursor, freeList), "Return page failed");
+        return rc;
+    }
+    WriteLockHelper xlock2(STREAM_COMMON_LOCK_ARGS(idxMutex_));
+    auto it = std::find_if(idxChain_.begin(), idxChain_.end(),
+                           [endCursor](const PageShmUnit &ele) { return ele.first > endCursor; });
+    it = idxChain_.emplace(it, endCursor, page);
+    readBackPages_.emplace(endCursor);
+    // The next pointers around a spilled page are stale. Relink the page with its neighbours, or clear the pointer
+    // when the neighbour is still on disk. A page somebody still holds keeps its pointer so it stays sealed.
+    if (it != idxChain_.begin()) {
+        auto &prev = std::prev(it)->second;
+        if (std::prev(it)->first + prev->GetSlotCount() == endCursor) {
+            prev->SetNextPage(page->GetShmView());
+        } else if (prev->GetRefCount() == 1) {
+            prev->SetNextPage(ShmView());
+        }
+    }
+    auto nextIt = std::next(it);
+    if (nextIt != idxChain_.end() && nextIt->first == page->GetLastCursor()) {
+        page->SetNextPage(nextIt->second->GetShmView());
+    } else {
+        page->SetNextPage(ShmView());
+    }
+    VLOG(SC_NORMAL_LOG_LEVEL) << FormatString("[%s] Read back page<%s> [%zu, %zu] success.", LogPrefix(),
+                                              page->GetPageId(), endCursor + 1, page->GetLastCursor());
+    return Status::OK();
+}
+
 Status PageQueueBase::LocatePage(const ShmView &v, std::shared_ptr<StreamDataPage> &out)
 {
     std::shared_ptr<ShmUnitInfo> pageInfo;
@@ -1006,6 +1187,7 @@ ShmView PageQueueBase::GetLastPageShmView()
 
 Status PageQueueBase::LocatePage(uint64_t lastAppendCursor, std::shared_ptr<StreamDataPage> &out, bool incRef)
 {
+    RETURN_IF_NOT_OK(ReadBackSpilledPages(lastAppendCursor, false));
     // We are going to lock both chains in the correct order to avoid deadlock.
     ReadLockHelper rlock2(STREAM_COMMON_LOCK_ARGS(idxMutex_));
     ReadLockHelper rlock3(STREAM_COMMON_LOCK_ARGS(ackMutex_));
@@ -24,10 +24,14 @@
 #include <chrono>
 #include <list>
 #include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 #include "datasystem/common/flags/flags.h"
 #include "datasystem/common/stream_cache/stream_data_page.h"
 #include "datasystem/common/string_intern/string_ref.h"
+#include "datasystem/worker/stream_cache/page_queue/stream_page_spill.h"
 
 DS_DECLARE_uint32(sc_cache_pages);
 
@@ -74,9 +78,11 @@ public:
      * @brief Ack to see if any streamPageView already consumed by all and can be erased.
      * @param[in] cursor advanced ack cursor.
      * @param[in] streamMetaShm The pointer to streamMetaShm
+     * @param[in] spillCursor The ack cursor of the local consumers. If the stream is out of memory, pages before it
+     *            that only remote consumers still need are spilled to disk. 0 to disable.
      * @return K_OK on success; the error code otherwise.
      */
-    Status Ack(uint64_t cursor, StreamMetaShm *streamMetaShm = nullptr);
+    Status Ack(uint64_t cursor, StreamMetaShm *streamMetaShm = nullptr, uint64_t spillCursor = 0);
 
     /**
      * @brief Locate a page that contains lastAppendCursor + 1
@@ -269,6 +275,20 @@ protected:
                      StreamMetaShm *streamMetaShm = nullptr);
     Status FreePendingList();
     Status MoveFreeListToPendFree(uint64_t cursor, std::list<PageShmUnit> &freeList);
+    // A page picked for spilling, with a copy of the page taken under idxMutex_.
+    struct SpilledPage {
+        PageShmUnit unit;
+        uint32_t slotCount{ 0 };
+        uint64_t lastCursor{ 0 };
+        std::string image;
+        bool spilled{ false };
+    };
+    Status SpillPages(uint64_t spillCursor, std::list<PageShmUnit> &freeList, StreamMetaShm *streamMetaShm);
+    Status PickPagesToSpill(uint64_t spillCursor, std::vector<SpilledPage> &pages);
+    void ReleaseSpilledPages(std::vector<SpilledPage> &pages, std::list<PageShmUnit> &freeList,
+                             StreamMetaShm *streamMetaShm);
+    Status ReadBackSpilledPages(uint64_t lastAppendCursor, bool toEnd);
+    Status ReadBackPageNotLocked(uint64_t endCursor);
 
     mutable std::shared_timed_mutex ackMutex_;       // protect ackChain_/pendingFreePages_
     mutable std::shared_timed_mutex idxMutex_;       // protect idxChain_
@@ -298,6 +318,12 @@ protected:
     std::atomic<uint64_t> scMetricBigPagesReleased_{ 0 };
 
     bool isSharedPage_{ false };
+
+    // Disk overflow tier, only for the exclusive page queue with spill enabled.
+    std::unique_ptr<StreamPageSpill> pageSpill_;
+    std::set<uint64_t> readBackPages_;     // Keys of the pages read back from disk. Protected by idxMutex_
+    std::set<uint64_t> spillingPages_;     // Keys of the pages being written to disk. Protected by idxMutex_
+    std::set<uint64_t> readingBackPages_;  // Keys of the pages being read from disk. Protected by idxMutex_
 };
 }  // namespace stream_cache
 }  // namespace worker
@@ -28,7 +28,9 @@
 #include "datasystem/common/util/lock_helper.h"
 #include "datasystem/common/log/log.h"
 #include "datasystem/common/util/locks.h"
+#include "datasystem/common/util/raii.h"
 #include "datasystem/common/util/status_helper.h"
+#include "datasystem/common/util/timer.h"
 #include "datasystem/utils/status.h"
 #include "datasystem/worker/stream_cache/page_queue/exclusive_page_queue.h"
 #include "datasystem/worker/stream_cache/stream_manager.h"
@@ -71,6 +73,8 @@ Status PageQueueHandler::CreateOrGetLastDataPage(uint64_t timeoutMs, const ShmVi
             return sharedPageQueue_->CreateOrGetLastDataPage(timeoutMs, lastView, lastPage, retryOnOOM);
         }
     }
+    // Clients report their version after the cursor is added, a good time to pick it up.
+    RefreshLockFreeAppend();
     return exclusivePageQueue_->CreateOrGetLastDataPage(timeoutMs, lastView, lastPage, retryOnOOM);
 }
 
@@ -87,6 +91,10 @@ std::string PageQueueHandler::LogPrefix() const
 
 Status PageQueueHandler::AddCursor(const std::string &id, bool isProducer, std::shared_ptr<Cursor> &out, ShmView &view)
 {
+    // The new client may not understand the slots reserved by lock free append, so no producer
+    // can be in the middle of one when it gets the cursor.
+    RETURN_IF_NOT_OK(HoldLockFreeAppend());
+    Raii releaseAppend([this]() { ReleaseLockFreeAppend(); });
     auto lastPageShmView = exclusivePageQueue_->GetLastPageShmView();
     WriteLockHelper xlock(STREAM_COMMON_LOCK_ARGS(cursorMutex_));
     INJECT_POINT("worker.AddCursor.afterLockCursorMutex");
@@ -167,6 +175,7 @@ Status PageQueueHandler::DeleteCursor(const std::string &id)
                                          FormatString("[%s] cursor for %s not found", streamName_, id));
     std::unique_ptr<CursorInfo> cInfo = std::move(iter->second);
     cursorMap_.erase(iter);
+    RefreshLockFreeAppendNotLocked();
     if (cacheCursor_.size() < maxCache) {
         cacheCursor_.emplace_back(std::move(cInfo->shmUnit));
     }
@@ -192,35 +201,58 @@ void PageQueueHandler::ForceUnlockByCursor(const std::string &cursorId, bool isP
 
 Status PageQueueHandler::ForceUnlockByCursorImpl(const std::string &cursorId, uint32_t lockId, bool &fallback)
 {
-    WriteLockHelper xlock(STREAM_COMMON_LOCK_ARGS(cursorMutex_));
-    auto iter = cursorMap_.find(cursorId);
-    if (iter == cursorMap_.end() || iter->second == nullptr) {
-        return Status::OK();
-    }
+    ShmView view;
+    uint32_t clientVersion;
+    uint64_t appendClaim;
+    {
+        WriteLockHelper xlock(STREAM_COMMON_LOCK_ARGS(cursorMutex_));
+        auto iter = cursorMap_.find(cursorId);
+        if (iter == cursorMap_.end() || iter->second == nullptr) {
+            return Status::OK();
+        }
 
-    // Only V2 client will update the last locked page field. If it is a V1 client, then
-    // we will fall back to the old method.
-    auto &cursor = iter->second->cursor;
-    if (cursor->GetClientVersion() < Cursor::K_CURSOR_SIZE_V2) {
-        fallback = true;
-        return Status::OK();
-    }
+        // Only V2 client will update the last locked page field. If it is a V1 client, then
+        // we will fall back to the old method.
+        auto &cursor = iter->second->cursor;
+        clientVersion = cursor->GetClientVersion();
+        if (clientVersion < Cursor::K_CURSOR_SIZE_V2) {
+            fallback = true;
+            return Status::OK();
+        }
 
-    LOG(INFO) << FormatString("[%s, cursorId:%s] V2 client detected.", LogPrefix(), cursorId);
-    auto unlock = [this, &cursor, lockId, &cursorId]() {
+        LOG(INFO) << FormatString("[%s, cursorId:%s] V2 client detected.", LogPrefix(), cursorId);
         // unlock SharedMemView in Cursor
-        auto msg = FormatString("%s cursorId:%s", LogPrefix(), cursorId);
         LOG_IF_ERROR(cursor->ForceUnLock(lockId, LogPrefix()), "Cursor ForceUnLock failed");
         // Get the last page (potentially) locked by this producer.
-        ShmView view;
-        RETURN_IF_NOT_OK(cursor->GetLastLockedPageView(view, DEFAULT_TIMEOUT_MS));
+        Status rc = cursor->GetLastLockedPageView(view, DEFAULT_TIMEOUT_MS);
+        if (rc.IsError()) {
+            fallback = true;
+            return rc;
+        }
+        appendClaim = cursor->GetAppendClaim();
+    }
+    // The page is repaired without the cursor lock, it may have to wait for other producers.
+    auto unlock = [this, &view, clientVersion, appendClaim, lockId, &cursorId]() {
         LOG(INFO) << FormatString("[%s, cursorId:%s] Last locked page<%s>", LogPrefix(), cursorId, view.ToStr());
         RETURN_OK_IF_TRUE(view == ShmView());  // No page is locked
         // Get the page
         std::shared_ptr<StreamDataPage> page;
         RETURN_IF_NOT_OK(LocatePage(view, page));
         LOG(INFO) << FormatString("[%s, cursorId:%s] Unlock page<%s>", LogPrefix(), cursorId, page->GetPageId());
-        page->TryUnlockByLockId(lockId);
+        if (clientVersion < Cursor::K_CLIENT_EYECATCHER_V3) {
+            page->TryUnlockByLockId(lockId);
+            return Status::OK();
+        }
+        // A V3 producer may have crashed appending without the page lock. Its append claim tells which
+        // slots it owns, repair them once no live producer is appending without the lock.
+        RETURN_IF_NOT_OK(HoldLockFreeAppend(cursorId));
+        Raii releaseAppend([this]() { ReleaseLockFreeAppend(); });
+        RETURN_IF_NOT_OK(page->RecoverAppend(lockId, appendClaim, DEFAULT_TIMEOUT_MS));
+        WriteLockHelper xlock(STREAM_COMMON_LOCK_ARGS(cursorMutex_));
+        auto iter = cursorMap_.find(cursorId);
+        if (iter != cursorMap_.end() && iter->second != nullptr) {
+            iter->second->cursor->SetAppendClaim(0);
+        }
         return Status::OK();
     };
     auto status = unlock();
@@ -228,6 +260,70 @@ Status PageQueueHandler::ForceUnlockByCursorImpl(const std::string &cursorId, ui
     return status;
 }
 
+Status PageQueueHandler::HoldLockFreeAppend(const std::string &skipId)
+{
+    {
+        WriteLockHelper xlock(STREAM_COMMON_LOCK_ARGS(cursorMutex_));
+        ++lockFreeAppendHolds_;
+        RefreshLockFreeAppendNotLocked();
+    }
+    // Producers check the flag after they announce an append in their claim, so after the flag is off we
+    // only have to wait for the appends already announced. Those are short, unless the producer is dead.
+    Timer timer;
+    while (true) {
+        {
+            ReadLockHelper rlock(STREAM_COMMON_LOCK_ARGS(cursorMutex_));
+            if (!AnyLockFreeAppendNotLocked(skipId)) {
+                return Status::OK();
+            }
+        }
+        if (static_cast<uint64_t>(timer.ElapsedMilliSecond()) >= DEFAULT_TIMEOUT_MS) {
+            ReleaseLockFreeAppend();
+            RETURN_STATUS_LOG_ERROR(K_TRY_AGAIN,
+                                    FormatString("[%s] Timeout waiting for producers to finish appending", LogPrefix()));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void PageQueueHandler::ReleaseLockFreeAppend()
+{
+    WriteLockHelper xlock(STREAM_COMMON_LOCK_ARGS(cursorMutex_));
+    if (lockFreeAppendHolds_ > 0) {
+        --lockFreeAppendHolds_;
+    }
+    RefreshLockFreeAppendNotLocked();
+}
+
+void PageQueueHandler::RefreshLockFreeAppend()
+{
+    WriteLockHelper xlock(STREAM_COMMON_LOCK_ARGS(cursorMutex_));
+    RefreshLockFreeAppendNotLocked();
+}
+
+void PageQueueHandler::RefreshLockFreeAppendNotLocked()
+{
+    // Consumers of older clients reject the reservation bit of lock free append, and producers of older
+    // clients only know the page lock. Shared pages are always appended with the lock.
+    bool enable = !enableSharedPage_ && lockFreeAppendHolds_ == 0;
+    for (auto &ele : cursorMap_) {
+        enable = enable && ele.second->cursor->GetClientVersion() >= Cursor::K_CLIENT_EYECATCHER_V3;
+    }
+    for (auto &ele : cursorMap_) {
+        ele.second->cursor->SetLockFreeAppend(enable);
+    }
+}
+
+bool PageQueueHandler::AnyLockFreeAppendNotLocked(const std::string &skipId) const
+{
+    for (auto &ele : cursorMap_) {
+        if (ele.first != skipId && AppendClaim::Decode(ele.second->cursor->GetAppendClaim()).Appending()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void PageQueueHandler::TryUnlockByLockId(uint32_t lockId)
 {
     {
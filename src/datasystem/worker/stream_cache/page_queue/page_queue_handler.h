@@ -159,10 +159,30 @@ public:
      */
     Status UpdateStreamFields(const StreamFields &streamFields);
 
+    /**
+     * @brief Turn off lock free append for all producers of this stream, and wait until no producer
+     * other than skipId is in the middle of an append. Must be paired with ReleaseLockFreeAppend.
+     * @param[in] skipId The cursor to not wait for, e.g. a crashed producer.
+     * @return Status of the call.
+     */
+    Status HoldLockFreeAppend(const std::string &skipId = "");
+
+    /**
+     * @brief Undo HoldLockFreeAppend, lock free append is back on if every client of the stream supports it.
+     */
+    void ReleaseLockFreeAppend();
+
+    /**
+     * @brief Turn lock free append on for producers of this stream if every client of the stream supports it.
+     */
+    void RefreshLockFreeAppend();
+
 private:
     std::string LogPrefix() const;
     Status LocatePage(const ShmView &v, std::shared_ptr<StreamDataPage> &out);
     Status UpdateLocalCursorLastDataPage(const ShmView &shmView);
+    void RefreshLockFreeAppendNotLocked();
+    bool AnyLockFreeAppendNotLocked(const std::string &skipId) const;
 
     std::string streamName_;
     std::atomic<bool> enableSharedPage_;
@@ -184,6 +204,8 @@ private:
         std::shared_ptr<SharedMemViewImpl> lastPageRefShmViewImpl;
     };
     std::unordered_map<std::string, std::unique_ptr<CursorInfo>> cursorMap_;
+    // Number of HoldLockFreeAppend in progress. Protected by cursorMutex_.
+    uint32_t lockFreeAppendHolds_{ 0 };
     std::deque<std::unique_ptr<ShmUnit>> cacheCursor_;
     std::deque<std::unique_ptr<ShmUnit>> cacheLastPageRef_;
 };
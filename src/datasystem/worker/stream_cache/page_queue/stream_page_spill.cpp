@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Disk overflow tier of the stream data pages.
+ */
+#include "datasystem/worker/stream_cache/page_queue/stream_page_spill.h"
+
+#include <fcntl.h>
+#include <linux/falloc.h>
+#include <unistd.h>
+
+#include "datasystem/common/constants.h"
+#include "datasystem/common/inject/inject_point.h"
+#include "datasystem/common/log/log.h"
+#include "datasystem/common/util/file_util.h"
+#include "datasystem/common/util/format.h"
+#include "datasystem/common/util/net_util.h"
+#include "datasystem/common/util/status_helper.h"
+#include "datasystem/common/util/uuid_generator.h"
+#include "datasystem/stream/stream_config.h"
+
+DS_DEFINE_bool(sc_spill_pages, false,
+               "Spill the stream pages which only remote consumers still need to spill_directory when the stream "
+               "runs out of memory, and read them back when the remote consumers catch up. Default to false");
+DS_DECLARE_string(spill_directory);
+
+namespace datasystem {
+namespace worker {
+namespace stream_cache {
+namespace {
+const std::string STREAM_SPILL_PATH_PREFIX = "/datasystem_stream_spill_data";
+constexpr int SPILL_FILE_MODE = 0600;
+constexpr int PERMISSION = 0700;
+
+std::string GetSpillDirectory()
+{
+    // Only the first directory is used, the others are left to the object spill.
+    return Split(FLAGS_spill_directory, ",")[0] + STREAM_SPILL_PATH_PREFIX;
+}
+
+Status PrepareSpillDirectory()
+{
+    // Files left by the previous run of the worker are useless.
+    static std::once_flag flag;
+    static Status rc;
+    std::call_once(flag, []() {
+        auto dir = GetSpillDirectory();
+        rc = RemoveAll(dir);
+        if (rc.IsOk()) {
+            rc = CreateDir(dir, true, PERMISSION);
+        }
+    });
+    return rc;
+}
+}  // namespace
+
+StreamPageSpill::StreamPageSpill(std::string streamName) : streamName_(std::move(streamName))
+{
+}
+
+StreamPageSpill::~StreamPageSpill()
+{
+    Reset();
+}
+
+bool StreamPageSpill::IsEnabled()
+{
+    return FLAGS_sc_spill_pages && !FLAGS_spill_directory.empty();
+}
+
+Status StreamPageSpill::OpenIfNotExist()
+{
+    RETURN_OK_IF_TRUE(fd_ >= 0);
+    RETURN_IF_NOT_OK_PRINT_ERROR_MSG(PrepareSpillDirectory(), "[Spill] create stream spill directory failed");
+    // The stream name is not necessarily a valid file name.
+    path_ = GetSpillDirectory() + "/" + GetStringUuid();
+    RETURN_IF_NOT_OK(OpenFile(path_, O_RDWR | O_CREAT | O_TRUNC, SPILL_FILE_MODE, &fd_));
+    writeOffset_ = 0;
+    LOG(INFO) << FormatString("[S:%s] Spill pages to %s", streamName_, path_);
+    return Status::OK();
+}
+
+Status StreamPageSpill::Spill(uint64_t endCursor, uint64_t lastCursor, const void *buf, size_t sz)
+{
+    INJECT_POINT("StreamPageSpill.Spill");
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_IF_NOT_OK(OpenIfNotExist());
+    RETURN_IF_NOT_OK(WriteFile(fd_, buf, sz, writeOffset_));
+    segments_.emplace(endCursor, Segment{ lastCursor, writeOffset_, sz });
+    writeOffset_ += static_cast<off_t>(sz);
+    numPagesSpilled_.fetch_add(1, std::memory_order_relaxed);
+    spilledBytes_.fetch_add(sz, std::memory_order_relaxed);
+    VLOG(SC_NORMAL_LOG_LEVEL) << FormatString("[S:%s] Spill page [%zu, %zu] to offset %zu", streamName_,
+                                              endCursor + 1, lastCursor, writeOffset_ - sz);
+    return Status::OK();
+}
+
+void StreamPageSpill::Find(uint64_t lastAppendCursor, bool toEnd, std::vector<uint64_t> &endCursors) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Step back from the first page whose begin cursor is past lastAppendCursor + 1.
+    auto it = segments_.upper_bound(lastAppendCursor);
+    if (it != segments_.begin() && lastAppendCursor < std::prev(it)->second.lastCursor) {
+        --it;
+    } else if (!toEnd) {
+        return;
+    }
+    for (; it != segments_.end(); ++it) {
+        endCursors.emplace_back(it->first);
+        if (!toEnd) {
+            break;
+        }
+    }
+}
+
+Status StreamPageSpill::ReadBack(uint64_t endCursor, void *buf, size_t sz)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = segments_.find(endCursor);
+    CHECK_FAIL_RETURN_STATUS(it != segments_.end(), K_NOT_FOUND,
+                             FormatString("[S:%s] Page after cursor %zu is not spilled", streamName_, endCursor));
+    CHECK_FAIL_RETURN_STATUS(sz == it->second.size, K_INVALID,
+                             FormatString("[S:%s] Spilled page size %zu mismatch %zu", streamName_, it->second.size,
+                                          sz));
+    RETURN_IF_NOT_OK(ReadFile(fd_, buf, sz, it->second.offset));
+    numPagesReadBack_.fetch_add(1, std::memory_order_relaxed);
+    readBackBytes_.fetch_add(sz, std::memory_order_relaxed);
+    ReleaseSegmentLocked(it->second);
+    segments_.erase(it);
+    return Status::OK();
+}
+
+void StreamPageSpill::Ack(uint64_t cursor)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = segments_.begin();
+    while (it != segments_.end() && it->second.lastCursor < cursor) {
+        ReleaseSegmentLocked(it->second);
+        it = segments_.erase(it);
+    }
+}
+
+void StreamPageSpill::Drop(uint64_t endCursor)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = segments_.find(endCursor);
+    if (it != segments_.end()) {
+        ReleaseSegmentLocked(it->second);
+        segments_.erase(it);
+    }
+}
+
+void StreamPageSpill::ReleaseSegmentLocked(const Segment &segment)
+{
+    if (segments_.size() == 1) {
+        // Last one out, start over from the beginning of the file.
+        if (ftruncate(fd_, 0) != 0) {
+            LOG(WARNING) << FormatString("[S:%s] Truncate spill file failed, errno %d", streamName_, errno);
+        }
+        writeOffset_ = 0;
+        return;
+    }
+    // Give the disk space back but keep the offsets of the other segments.
+    if (fallocate(fd_, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, segment.offset, segment.size) != 0) {
+        LOG(WARNING) << FormatString("[S:%s] Punch hole in spill file failed, errno %d", streamName_, errno);
+    }
+}
+
+void StreamPageSpill::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    segments_.clear();
+    if (fd_ >= 0) {
+        RETRY_ON_EINTR(close(fd_));
+        fd_ = -1;
+        LOG_IF_ERROR(DeleteFile(path_), "[Spill] delete stream spill file failed");
+    }
+    writeOffset_ = 0;
+}
+
+bool StreamPageSpill::Empty() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return segments_.empty();
+}
+}  // namespace stream_cache
+}  // namespace worker
+}  // namespace datasystem
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Disk overflow tier of the stream data pages.
+ */
+#ifndef DATASYSTEM_WORKER_STREAM_CACHE_STREAM_PAGE_SPILL_H
+#define DATASYSTEM_WORKER_STREAM_CACHE_STREAM_PAGE_SPILL_H
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "datasystem/common/flags/flags.h"
+#include "datasystem/utils/status.h"
+
+DS_DECLARE_bool(sc_spill_pages);
+
+namespace datasystem {
+namespace worker {
+namespace stream_cache {
+/**
+ * The spilled pages of one stream. Each page is written as a page sized segment appended to one file of the
+ * stream, so spilling is sequential writes. Segments are keyed like the index chain of the page queue, by the
+ * cursor of the last slot of the previous page.
+ */
+class StreamPageSpill {
+public:
+    explicit StreamPageSpill(std::string streamName);
+    ~StreamPageSpill();
+
+    /**
+     * @brief Check if the spill tier is enabled, i.e. sc_spill_pages is on and spill_directory is set.
+     * @return T if enabled.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Append a page image to the spill file.
+     * @param[in] endCursor The cursor of the last slot of the previous page.
+     * @param[in] lastCursor The cursor of the last slot of this page.
+     * @param[in] buf The page image.
+     * @param[in] sz The size of the page image.
+     * @return K_OK on success; K_IO_ERROR if the file cannot be written.
+     */
+    Status Spill(uint64_t endCursor, uint64_t lastCursor, const void *buf, size_t sz);
+
+    /**
+     * @brief Find the spilled page that contains lastAppendCursor + 1, and optionally all the spilled pages after it.
+     * @param[in] lastAppendCursor The cursor before the one to read.
+     * @param[in] toEnd Also find the spilled pages after the one containing lastAppendCursor + 1.
+     * @param[out] endCursors The keys of the spilled pages in cursor order.
+     */
+    void Find(uint64_t lastAppendCursor, bool toEnd, std::vector<uint64_t> &endCursors) const;
+
+    /**
+     * @brief Read back a spilled page and drop it from the spill file.
+     * @param[in] endCursor The key of the spilled page.
+     * @param[out] buf The buffer to hold the page image.
+     * @param[in] sz The size of the buffer.
+     * @return K_OK on success; K_NOT_FOUND if the page is not spilled; K_IO_ERROR if the file cannot be read.
+     */
+    Status ReadBack(uint64_t endCursor, void *buf, size_t sz);
+
+    /**
+     * @brief Drop the spilled pages whose elements have all been acked.
+     * @param[in] cursor The ack cursor of the stream.
+     */
+    void Ack(uint64_t cursor);
+
+    /**
+     * @brief Drop a spilled page that is kept in memory after all.
+     * @param[in] endCursor The key of the spilled page.
+     */
+    void Drop(uint64_t endCursor);
+
+    /**
+     * @brief Drop all spilled pages.
+     */
+    void Reset();
+
+    bool Empty() const;
+
+    uint64_t GetNumPagesSpilled() const
+    {
+        return numPagesSpilled_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetNumPagesReadBack() const
+    {
+        return numPagesReadBack_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetSpilledBytes() const
+    {
+        return spilledBytes_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetReadBackBytes() const
+    {
+        return readBackBytes_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Segment {
+        uint64_t lastCursor;
+        off_t offset;
+        size_t size;
+    };
+
+    Status OpenIfNotExist();
+    void ReleaseSegmentLocked(const Segment &segment);
+
+    const std::string streamName_;
+    mutable std::mutex mutex_;  // protect the fields below
+    std::string path_;
+    int fd_{ -1 };
+    off_t writeOffset_{ 0 };
+    std::map<uint64_t, Segment> segments_;
+
+    std::atomic<uint64_t> numPagesSpilled_{ 0 };
+    std::atomic<uint64_t> numPagesReadBack_{ 0 };
+    std::atomic<uint64_t> spilledBytes_{ 0 };
+    std::atomic<uint64_t> readBackBytes_{ 0 };
+};
+}  // namespace stream_cache
+}  // namespace worker
+}  // namespace datasystem
+#endif
@@ -744,7 +744,7 @@ void StreamManager::TryWakeUpPendingReceive()
     }
 }
 
-uint64_t StreamManager::UpdateLastAckCursorUnlocked(uint64_t minSubsAckCursor)
+uint64_t StreamManager::UpdateLastAckCursorUnlocked(uint64_t minSubsAckCursor, uint64_t *localAckCursor)
 {
     if (pageQueueHandler_ == nullptr || IsRetainData()) {
         return 0;
@@ -759,6 +759,9 @@ uint64_t StreamManager::UpdateLastAckCursorUnlocked(uint64_t minSubsAckCursor)
                                                       sub.first, lastSubAck);
             minSubsAckCursor = std::min(minSubsAckCursor, lastSubAck);
         }
+        if (localAckCursor != nullptr) {
+            *localAckCursor = minSubsAckCursor;
+        }
         // Also go through all remote consumers. We may in the process of sending elements
         // to the remote worker.
         if (!remoteSubWorkerDict_.empty() || remoteWorkerManager_->HasRemoteConsumers(streamName_)) {
@@ -792,7 +795,9 @@ Status StreamManager::RemoteAck()
         newAckCursor = UpdateLastAckCursorUnlocked(lastAppendCursor);
         // Early release of the lock since StreamManager::mutex_ is mostly to protect pubs and subs structures.
     }
-    RETURN_IF_NOT_OK(GetExclusivePageQueue()->Ack(newAckCursor));
+    // No local consumer, the pages are only kept for the remote consumers unless retained for the late ones.
+    auto spillCursor = IsRetainData() ? 0 : lastAppendCursor;
+    RETURN_IF_NOT_OK(GetExclusivePageQueue()->Ack(newAckCursor, nullptr, spillCursor));
     EarlyReclaim(true, lastAppendCursor, newAckCursor);
     return Status::OK();
 }
@@ -806,12 +811,13 @@ Status StreamManager::AckCursors()
     VLOG(SC_INTERNAL_LOG_LEVEL) << FormatString("[%s] GC starts", LogPrefix());
     auto lastAppendCursor = GetLastAppendCursor();
     uint64_t newAckCursor;
+    uint64_t localAckCursor = 0;
     {
         ReadLockHelper rlock(STREAM_COMMON_LOCK_ARGS(mutex_));
         INJECT_POINT("StreamManager.AckCursors.delay");
-        newAckCursor = UpdateLastAckCursorUnlocked(lastAppendCursor);
+        newAckCursor = UpdateLastAckCursorUnlocked(lastAppendCursor, &localAckCursor);
     }
-    RETURN_IF_NOT_OK(GetExclusivePageQueue()->Ack(newAckCursor, GetStreamMetaShm()));
+    RETURN_IF_NOT_OK(GetExclusivePageQueue()->Ack(newAckCursor, GetStreamMetaShm(), localAckCursor));
     VLOG(SC_INTERNAL_LOG_LEVEL) << FormatString("[%s] GC ends", LogPrefix());
     return Status::OK();
 }
@@ -1663,6 +1669,22 @@ void StreamManager::UpdateStreamMetrics()
             scStreamMetrics_->LogMetric(StreamMetric::NumPagesCached, pageQueue->GetNumPagesCached());
             scStreamMetrics_->LogMetric(StreamMetric::NumBigPagesCreated, pageQueue->GetNumBigPagesCreated());
             scStreamMetrics_->LogMetric(StreamMetric::NumBigPagesReleased, pageQueue->GetNumBigPagesReleased());
+            scStreamMetrics_->LogMetric(StreamMetric::NumPagesSpilled, pageQueue->GetNumPagesSpilled());
+            scStreamMetrics_->LogMetric(StreamMetric::NumPagesReadBack, pageQueue->GetNumPagesReadBack());
+            auto now = std::chrono::steady_clock::now();
+            auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastSpillMetricsTime_).count();
+            if (elapsedMs > 0) {
+                const uint64_t msPerSecond = 1000;
+                auto spilledBytes = pageQueue->GetSpilledBytes();
+                auto readBackBytes = pageQueue->GetReadBackBytes();
+                scStreamMetrics_->LogMetric(StreamMetric::SpillWriteBandwidth,
+                                            (spilledBytes - lastSpilledBytes_) * msPerSecond / elapsedMs);
+                scStreamMetrics_->LogMetric(StreamMetric::SpillReadBandwidth,
+                                            (readBackBytes - lastReadBackBytes_) * msPerSecond / elapsedMs);
+                lastSpilledBytes_ = spilledBytes;
+                lastReadBackBytes_ = readBackBytes;
+                lastSpillMetricsTime_ = now;
+            }
         }
     }
 }
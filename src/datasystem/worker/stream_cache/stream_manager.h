@@ -870,9 +870,11 @@ protected:
 
     /**
      * @brief Get the min ack cursor of all subscriptions.
+     * @param[in] lastAppendCursor The last append cursor of the stream.
+     * @param[out] localAckCursor The min ack cursor of the local subscriptions, optional.
      * @return The min ack cursor of all subscriptions.
      */
-    uint64_t UpdateLastAckCursorUnlocked(uint64_t lastAppendCursor);
+    uint64_t UpdateLastAckCursorUnlocked(uint64_t lastAppendCursor, uint64_t *localAckCursor = nullptr);
 
 private:
     /**
@@ -973,6 +975,10 @@ private:
     std::atomic<bool> pendingLastProducerClose_{ false };
     std::atomic<bool> pendingLastProducerForceClose_{ false };
     std::shared_ptr<SCStreamMetrics> scStreamMetrics_{ nullptr };
+    // Spill counters at the last metrics update, used to derive the spill bandwidth.
+    std::chrono::steady_clock::time_point lastSpillMetricsTime_{ std::chrono::steady_clock::now() };
+    uint64_t lastSpilledBytes_{ 0 };
+    uint64_t lastReadBackBytes_{ 0 };
     mutable std::shared_timed_mutex reclaimMutex_;
     WaitPost reclaimWp_;
     // +1 everytime a new producer is added to pubs_.
@@ -166,6 +166,16 @@ Status WorkerOCExpire(void *obj, const ExpireReqPb &req, ExpireRspPb &resp)
     return static_cast<datasystem::object_cache::WorkerOCServiceImpl *>(obj)->Expire(req, resp);
 }
 
+Status WorkerOCAcquireFillLease(void *obj, const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &resp)
+{
+    return static_cast<datasystem::object_cache::WorkerOCServiceImpl *>(obj)->AcquireFillLease(req, resp);
+}
+
+Status WorkerOCMatchPrefix(void *obj, const MatchPrefixReqPb &req, MatchPrefixRspPb &resp)
+{
+    return static_cast<datasystem::object_cache::WorkerOCServiceImpl *>(obj)->MatchPrefix(req, resp);
+}
+
 Status WorkerOCGetMetaInfo(void *obj, const GetMetaInfoReqPb &req, GetMetaInfoRspPb &resp)
 {
     return static_cast<datasystem::object_cache::WorkerOCServiceImpl *>(obj)->GetMetaInfo(req, resp);
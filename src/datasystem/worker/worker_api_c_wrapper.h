@@ -255,6 +255,22 @@ Status WorkerOCExist(void *obj, const ExistReqPb &req, ExistRspPb &resp);
  */
 Status WorkerOCExpire(void *obj, const ExpireReqPb &req, ExpireRspPb &resp);
 
+/**
+ * @brief AcquireFillLease.
+ * @param[in] obj WorkerOCServiceImpl.
+ * @param[in] req AcquireFillLeaseReqPb.
+ * @param[in] resp AcquireFillLeaseRspPb.
+ */
+Status WorkerOCAcquireFillLease(void *obj, const AcquireFillLeaseReqPb &req, AcquireFillLeaseRspPb &resp);
+
+/**
+ * @brief MatchPrefix.
+ * @param[in] obj WorkerOCServiceImpl.
+ * @param[in] req MatchPrefixReqPb.
+ * @param[in] resp MatchPrefixRspPb.
+ */
+Status WorkerOCMatchPrefix(void *obj, const MatchPrefixReqPb &req, MatchPrefixRspPb &resp);
+
 /**
  * @brief GetMetaInfo.
  * @param[in] obj WorkerOCServiceImpl.
@@ -54,6 +54,7 @@
 #include "datasystem/common/log/log.h"
 #include "datasystem/common/log/log_helper.h"
 #include "datasystem/common/metrics/kv_metrics.h"
+#include "datasystem/common/metrics/open_metrics_server.h"
 #include "datasystem/common/metrics/res_metric_collector.h"
 #include "datasystem/common/object_cache/object_base.h"
 #include "datasystem/common/object_cache/safe_table.h"
@@ -87,6 +88,7 @@
 #include "datasystem/utils/status.h"
 #include "datasystem/worker/client_manager/client_manager.h"
 #include "datasystem/worker/cluster_event_type.h"
+#include "datasystem/worker/object_cache/cache_hit_info.h"
 #include "datasystem/worker/object_cache/data_migrator/strategy/node_selector.h"
 #include "datasystem/worker/object_cache/worker_worker_oc_api.h"
 #include "datasystem/worker/object_cache/worker_worker_peer_state_codec.h"
@@ -1535,6 +1537,7 @@ Status WorkerOCServer::ConstructTopologyRuntime()
         .SetLocalIsolationTimeout(std::chrono::seconds(FLAGS_node_dead_timeout_s))
         .SetScaleInCollectWindow(std::chrono::milliseconds(FLAGS_scale_in_collect_window_ms))
         .SetMembershipRestartHandler(membershipRestartHandler)
+        .SetAdvertisedCapacity(FLAGS_shared_memory_size_mb)
         .SetSnapshotPublishedHandler([this](std::shared_ptr<const cluster::TopologySnapshot> snapshot) {
             if (EnableOCService() && objCacheClientWorkerSvc_ != nullptr) {
                 LOG_IF_ERROR(objCacheClientWorkerSvc_->GiveUpReconciliation(),
@@ -2190,6 +2193,9 @@ void WorkerOCServer::RegisteringWorkerCallbackFunc()
     // The usage of share memory
     instance.RegisterCollectHandler(ResMetricName::SHARED_MEMORY,
                                     []() { return memory::Allocator::Instance()->GetMemoryStatistics(); });
+    // The huge page coverage of share memory
+    instance.RegisterCollectHandler(ResMetricName::SHARED_MEMORY_HUGE_PAGE,
+                                    []() { return memory::Allocator::Instance()->GetHugePageStatistics(); });
     // The usage of share disk
     instance.RegisterCollectHandler(ResMetricName::SHARED_DISK,
                                     []() { return memory::Allocator::Instance()->GetSharedDiskStatistics(); });
@@ -2965,6 +2971,9 @@ Status WorkerOCServer::Start()
     RETURN_IF_NOT_OK(ResMetricCollector::Instance().Init());
     RegisteringAllResourceCollectionCallbackFunc();
     ResMetricCollector::Instance().Start();
+    OpenMetricsServer::Instance().RegisterSource(
+        []() { return object_cache::CacheHitInfo::Instance().RenderOpenMetrics(); });
+    RETURN_IF_NOT_OK_APPEND_MSG(OpenMetricsServer::Instance().Start(), "\nWorker Start failed: metrics endpoint.");
     return Status::OK();
 }
 
@@ -3238,6 +3247,7 @@ Status WorkerOCServer::Shutdown()
     // Stop the background resource collector to prevent the background resource collector from invoking the background
     // resource collector when some objects of the worker exit.
     ResMetricCollector::Instance().Stop();
+    OpenMetricsServer::Instance().Stop();
     // Stop NodeSelector background thread before CommonServer::Shutdown() shuts down
     // the brpc server. NodeSelector::WorkerThread periodically issues CollectClusterInfo
     // RPCs to embedded master; if those RPCs are in flight when brpcServer_->Stop(0)+Join()
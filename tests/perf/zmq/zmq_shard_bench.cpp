@@ -0,0 +1,288 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: RPC throughput of the zmq server against the number of frontend shards.
+ */
+#include <getopt.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "datasystem/common/flags/flags.h"
+#include "datasystem/common/log/logging.h"
+#include "datasystem/common/rpc/rpc_channel.h"
+#include "datasystem/common/rpc/rpc_server.h"
+#include "datasystem/common/rpc/zmq/zmq_common.h"
+#include "datasystem/common/rpc/zmq/zmq_constants.h"
+#include "datasystem/protos/zmq_perf.stub.rpc.pb.h"
+#include "zmq_perf_server.h"
+
+DS_DECLARE_string(log_filename);
+DS_DECLARE_int32(zmq_server_frontend_shards);
+
+namespace datasystem {
+namespace st {
+namespace {
+constexpr int kShardsOpt = 1004;   // no short form for --shards
+constexpr int kSecondsOpt = 1005;  // no short form for --seconds
+constexpr int kWindowOpt = 1006;   // no short form for --window
+constexpr int kServerThreads = 16;
+constexpr int kConnectWaitMs = 500;
+
+struct BenchConfig {
+    std::vector<int> shards{ 1, 2, 4, 8 };
+    int clients = 8;
+    int threads = 4;
+    int window = 16;
+    int seconds = 5;
+};
+
+void PrintHelp()
+{
+    std::cout << "Options:\n"
+                 "    -h,--help               This help message.\n"
+                 "    --shards                Comma separated frontend shard counts to run. Default 1,2,4,8\n"
+                 "    -c,--clients            Number of client processes, each has its own gateway. Default 8\n"
+                 "    -t,--threads            Number of threads in each client process. Default 4\n"
+                 "    --window                Number of requests each thread keeps in flight. Default 16\n"
+                 "    --seconds               Duration of each run. Default 5\n";
+}
+
+int ProcessArgs(int argc, char **argv, BenchConfig &cfg)
+{
+    const option longOpts[] = { { "shards", required_argument, nullptr, kShardsOpt },
+                                { "clients", required_argument, nullptr, 'c' },
+                                { "threads", required_argument, nullptr, 't' },
+                                { "window", required_argument, nullptr, kWindowOpt },
+                                { "seconds", required_argument, nullptr, kSecondsOpt },
+                                { "help", no_argument, nullptr, 'h' },
+                                { nullptr, no_argument, nullptr, 0 } };
+    try {
+        int opt;
+        while ((opt = getopt_long(argc, argv, "c:t:h", longOpts, nullptr)) != -1) {
+            switch (opt) {
+                case kShardsOpt: {
+                    cfg.shards.clear();
+                    std::stringstream ss(optarg);
+                    std::string item;
+                    while (std::getline(ss, item, ',')) {
+                        cfg.shards.push_back(std::stoi(item));
+                    }
+                    break;
+                }
+                case 'c':
+                    cfg.clients = std::stoi(optarg);
+                    break;
+                case 't':
+                    cfg.threads = std::stoi(optarg);
+                    break;
+                case kWindowOpt:
+                    cfg.window = std::stoi(optarg);
+                    break;
+                case kSecondsOpt:
+                    cfg.seconds = std::stoi(optarg);
+                    break;
+                default:
+                    PrintHelp();
+                    return -1;
+            }
+        }
+    } catch (const std::exception &e) {
+        PrintHelp();
+        return -1;
+    }
+    if (cfg.shards.empty() || cfg.clients <= 0 || cfg.threads <= 0 || cfg.window <= 0 || cfg.seconds <= 0) {
+        PrintHelp();
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Server process. Reports the listening port on the pipe and runs until the parent closes the other pipe.
+ */
+void RunServer(int shards, int portFd, int stopFd)
+{
+    FLAGS_log_filename = "zmq_shard_bench_server";
+    Logging::GetInstance()->Start(FLAGS_log_filename, LogProcessRole::WORKER);
+    FLAGS_zmq_server_frontend_shards = shards;
+    HostPort serverAddr(kDefaultHost, 0);
+    PerfServiceImpl service(serverAddr);
+    RpcServiceCfg cfg;
+    cfg.numRegularSockets_ = kServerThreads;
+    cfg.numStreamSockets_ = kServerThreads;
+    std::unique_ptr<RpcServer> server;
+    auto bld = RpcServer::Builder();
+    bld.AddEndPoint(FormatString("tcp://%s:*", kDefaultHost)).AddService(&service, cfg);
+    auto rc = bld.InitAndStart(server);
+    int port = rc.IsOk() ? std::stoi(server->GetListeningPorts().front()) : -1;
+    if (write(portFd, &port, sizeof(port)) != sizeof(port) || port < 0) {
+        std::cerr << rc.ToString() << std::endl;
+        _exit(1);
+    }
+    char c;
+    while (read(stopFd, &c, 1) > 0) {
+    }
+    server->Shutdown();
+    _exit(0);
+}
+
+/**
+ * @brief Client process. Each thread keeps a window of requests in flight and the total completed count is written
+ * to the pipe.
+ */
+void RunClient(const BenchConfig &cfg, int port, int resultFd)
+{
+    FLAGS_log_filename = "zmq_shard_bench_client";
+    Logging::GetInstance()->Start(FLAGS_log_filename, LogProcessRole::CLIENT);
+    auto channel = std::make_shared<RpcChannel>(HostPort(kDefaultHost, port), RpcCredential());
+    // The stubs of the threads share the gateway of this one. Let the first heartbeat reply connect it to the shards.
+    auto gatewayStub = std::make_shared<PerfService_Stub>(channel);
+    std::this_thread::sleep_for(std::chrono::milliseconds(kConnectWaitMs));
+    std::atomic<uint64_t> completed{ 0 };
+    std::atomic<bool> failed{ false };
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(cfg.seconds);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < cfg.threads; ++t) {
+        threads.emplace_back([&]() {
+            auto stub = std::make_shared<PerfService_Stub>(channel);
+            std::deque<int64_t> tags;
+            MetaPb rq;
+            while (!failed && std::chrono::steady_clock::now() < deadline) {
+                while (static_cast<int>(tags.size()) < cfg.window) {
+                    int64_t tag;
+                    StartTheClock(rq);
+                    if (stub->SimpleGreetingAsyncWrite(rq, tag).IsError()) {
+                        failed = true;
+                        return;
+                    }
+                    tags.push_back(tag);
+                    rq.Clear();
+                }
+                MetaPb rsp;
+                if (stub->SimpleGreetingAsyncRead(tags.front(), rsp).IsError()) {
+                    failed = true;
+                    return;
+                }
+                tags.pop_front();
+                completed.fetch_add(1, std::memory_order_relaxed);
+            }
+            for (auto tag : tags) {
+                MetaPb rsp;
+                (void)stub->SimpleGreetingAsyncRead(tag, rsp);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    uint64_t result = failed ? 0 : completed.load();
+    (void)write(resultFd, &result, sizeof(result));
+    _exit(failed ? 1 : 0);
+}
+
+/**
+ * @brief Run one round against a server with the given number of shards.
+ * @return The rpc per second, negative on failure.
+ */
+double RunRound(const BenchConfig &cfg, int shards)
+{
+    int portPipe[2];
+    int stopPipe[2];
+    int resultPipe[2];
+    if (pipe(portPipe) != 0 || pipe(stopPipe) != 0 || pipe(resultPipe) != 0) {
+        return -1;
+    }
+    pid_t server = fork();
+    if (server == 0) {
+        close(stopPipe[1]);
+        RunServer(shards, portPipe[1], stopPipe[0]);
+    }
+    close(stopPipe[0]);
+    int port = -1;
+    if (server < 0 || read(portPipe[0], &port, sizeof(port)) != sizeof(port) || port < 0) {
+        close(stopPipe[1]);
+        return -1;
+    }
+    std::vector<pid_t> clients;
+    for (int i = 0; i < cfg.clients; ++i) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            close(stopPipe[1]);
+            RunClient(cfg, port, resultPipe[1]);
+        }
+        clients.push_back(pid);
+    }
+    // A client which dies without a result shows up as the end of the pipe.
+    close(resultPipe[1]);
+    uint64_t total = 0;
+    bool ok = true;
+    for (auto pid : clients) {
+        uint64_t count = 0;
+        ok = ok && pid > 0 && read(resultPipe[0], &count, sizeof(count)) == sizeof(count);
+        total += count;
+        int status = 0;
+        (void)waitpid(pid, &status, 0);
+        ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    close(stopPipe[1]);
+    (void)waitpid(server, nullptr, 0);
+    for (int fd : { portPipe[0], portPipe[1], resultPipe[0] }) {
+        close(fd);
+    }
+    return ok ? static_cast<double>(total) / cfg.seconds : -1;
+}
+}  // namespace
+}  // namespace st
+}  // namespace datasystem
+
+/**
+ * Forks a zmq server for each shard count and a few client processes against it, and prints the rpc throughput.
+ * The parent process does not touch zmq nor start the logging, so every child starts with a clean state.
+ */
+int main(int argc, char **argv)
+{
+    using namespace datasystem::st;
+    BenchConfig cfg;
+    if (ProcessArgs(argc, argv, cfg) != 0) {
+        return -1;
+    }
+    std::cout << "Clients: " << cfg.clients << " x " << cfg.threads << " threads, window " << cfg.window << ", "
+              << cfg.seconds << "s per run\n";
+    std::cout << std::setw(8) << "shards" << std::setw(16) << "rpc/s" << std::setw(12) << "speedup" << "\n";
+    double base = 0;
+    for (auto shards : cfg.shards) {
+        double rate = RunRound(cfg, shards);
+        if (rate < 0) {
+            std::cerr << "Run with " << shards << " shards failed" << std::endl;
+            return -1;
+        }
+        base = base > 0 ? base : rate;
+        std::cout << std::setw(8) << shards << std::setw(16) << std::fixed << std::setprecision(0) << rate
+                  << std::setw(11) << std::setprecision(2) << rate / base << "x" << std::endl;
+    }
+    return 0;
+}
@@ -143,6 +143,28 @@ class TestScClientMethods(unittest.TestCase):
         producer_srd.close()
         consumer_srd.close()
 
+    @staticmethod
+    def test_client_send_batch_receive_data_success():
+        """client send a batch and receive data test"""
+        elements = [b'10101010', bytearray(b'2020'), memoryview(b'303030303030')]
+        stream_name = "stream_sr_batch"
+        ip = TestScClientMethods.work_addr.split(":")
+        client_srd = StreamClient(ip[0], int(ip[1]))
+        client_srd.init()
+        producer_srd = client_srd.create_producer(stream_name)
+
+        consumer_srd = client_srd.subscribe(stream_name, "sub_name_s", SubconfigType.STREAM.value)
+        producer_srd.send_batch(elements, 1000)
+
+        element_list = consumer_srd.receive(len(elements), 1000)
+        assert len(element_list) == len(elements)
+        for element, expected in zip(element_list, elements):
+            assert memoryview(element).tobytes() == bytes(expected)
+        consumer_srd.ack(element_list[-1].get_id())
+
+        producer_srd.close()
+        consumer_srd.close()
+
     @staticmethod
     def test_client_send_with_blocking_support_receive_without_expected_num_data():
         """client send and receive data test"""
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: test KVClient::GetOrCreate with concurrent callers.
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "common.h"
+#include "datasystem/common/util/status_helper.h"
+#include "client/object_cache/oc_client_common.h"
+
+namespace datasystem {
+namespace st {
+constexpr uint8_t WORKER_NUM = 3;
+class KVClientGetOrCreateTest : public OCClientCommon {
+public:
+    void SetClusterSetupOptions(ExternalClusterOptions &opts) override
+    {
+        opts.numWorkers = WORKER_NUM;
+        opts.numEtcd = 1;
+        opts.workerGflagParams = "-node_timeout_s=5 -shared_memory_size_mb=1024";
+    }
+
+    void SetUp() override
+    {
+        ExternalClusterTest::SetUp();
+        clients_.resize(WORKER_NUM);
+        for (uint32_t i = 0; i < WORKER_NUM; i++) {
+            InitTestKVClient(i, clients_[i]);
+        }
+    }
+
+    void TearDown() override
+    {
+        clients_.clear();
+        ExternalClusterTest::TearDown();
+    }
+
+protected:
+    // Every caller runs GetOrCreate on the same key; the one that is granted the lease fills and sets the value.
+    void RunConcurrentGetOrCreate(const std::string &key, const std::string &value, int callersPerClient,
+                                  std::atomic<int> &createdCount, std::atomic<int> &readCount)
+    {
+        const int32_t subTimeoutMs = 20'000;
+        SetParam param{ .writeMode = WriteMode::NONE_L2_CACHE };
+        std::atomic<bool> start{ false };
+        std::vector<std::thread> threads;
+        for (const auto &client : clients_) {
+            for (int n = 0; n < callersPerClient; n++) {
+                threads.emplace_back([&, client]() {
+                    while (!start.load()) {
+                        std::this_thread::yield();
+                    }
+                    std::shared_ptr<Buffer> buffer;
+                    bool created = false;
+                    DS_ASSERT_OK(client->GetOrCreate(key, value.size(), param, buffer, created, subTimeoutMs));
+                    ASSERT_NE(buffer, nullptr);
+                    if (created) {
+                        createdCount++;
+                        DS_ASSERT_OK(buffer->MemoryCopy(value.data(), value.size()));
+                        DS_ASSERT_OK(client->Set(buffer));
+                        return;
+                    }
+                    ASSERT_EQ(buffer->GetSize(), static_cast<int64_t>(value.size()));
+                    ASSERT_EQ(std::string(static_cast<const char *>(buffer->ImmutableData()), value.size()), value);
+                    readCount++;
+                });
+            }
+        }
+        start = true;
+        for (auto &t : threads) {
+            t.join();
+        }
+    }
+
+    std::vector<std::shared_ptr<KVClient>> clients_;
+};
+
+TEST_F(KVClientGetOrCreateTest, OnlyOneConcurrentCallerFills)
+{
+    const int callersPerClient = 4;
+    const int rounds = 5;
+    for (int round = 0; round < rounds; round++) {
+        std::string key = "get_or_create_" + std::to_string(round);
+        std::string value = "value_" + std::to_string(round);
+        std::atomic<int> createdCount{ 0 };
+        std::atomic<int> readCount{ 0 };
+        RunConcurrentGetOrCreate(key, value, callersPerClient, createdCount, readCount);
+        ASSERT_EQ(createdCount.load(), 1) << key;
+        ASSERT_EQ(readCount.load(), callersPerClient * WORKER_NUM - 1) << key;
+        std::string valToGet;
+        DS_ASSERT_OK(clients_[round % WORKER_NUM]->Get(key, valToGet));
+        ASSERT_EQ(valToGet, value);
+    }
+}
+
+TEST_F(KVClientGetOrCreateTest, RacingSetIsNotFilledAgain)
+{
+    // A plain Set racing the GetOrCreate callers: nobody may be granted a lease after the value is visible.
+    const int callersPerClient = 2;
+    const int rounds = 5;
+    for (int round = 0; round < rounds; round++) {
+        std::string key = "get_or_create_race_" + std::to_string(round);
+        std::string value = "value_" + std::to_string(round);
+        std::atomic<int> createdCount{ 0 };
+        std::atomic<int> readCount{ 0 };
+        std::thread setter([&]() { DS_ASSERT_OK(clients_[0]->Set(key, value)); });
+        RunConcurrentGetOrCreate(key, value, callersPerClient, createdCount, readCount);
+        setter.join();
+        ASSERT_LE(createdCount.load(), 1) << key;
+        ASSERT_EQ(createdCount.load() + readCount.load(), callersPerClient * WORKER_NUM) << key;
+        std::shared_ptr<Buffer> buffer;
+        bool created = true;
+        DS_ASSERT_OK(clients_[1]->GetOrCreate(key, value.size(), SetParam{}, buffer, created));
+        ASSERT_FALSE(created);
+    }
+}
+}  // namespace st
+}  // namespace datasystem
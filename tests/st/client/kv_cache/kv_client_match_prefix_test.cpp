@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: test KVClient::MatchPrefix across workers.
+ */
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common.h"
+#include "datasystem/common/util/status_helper.h"
+#include "client/object_cache/oc_client_common.h"
+
+namespace datasystem {
+namespace st {
+constexpr uint8_t WORKER_NUM = 3;
+class KVClientMatchPrefixTest : public OCClientCommon {
+public:
+    void SetClusterSetupOptions(ExternalClusterOptions &opts) override
+    {
+        opts.numWorkers = WORKER_NUM;
+        opts.numEtcd = 1;
+        opts.workerGflagParams = "-node_timeout_s=5 -shared_memory_size_mb=256";
+    }
+
+    void SetUp() override
+    {
+        ExternalClusterTest::SetUp();
+        clients_.resize(WORKER_NUM);
+        for (uint32_t i = 0; i < WORKER_NUM; i++) {
+            InitTestKVClient(i, clients_[i]);
+        }
+    }
+
+    void TearDown() override
+    {
+        clients_.clear();
+        ExternalClusterTest::TearDown();
+    }
+
+protected:
+    static std::vector<std::string> MakeChain(const std::string &prefix, size_t length)
+    {
+        std::vector<std::string> chain;
+        chain.reserve(length);
+        for (size_t i = 0; i < length; i++) {
+            chain.emplace_back(prefix + "_" + std::to_string(i));
+        }
+        return chain;
+    }
+
+    std::string WorkerAddress(uint32_t index)
+    {
+        HostPort address;
+        DS_EXPECT_OK(cluster_->GetWorkerAddr(index, address));
+        return address.ToString();
+    }
+
+    std::vector<std::shared_ptr<KVClient>> clients_;
+};
+
+TEST_F(KVClientMatchPrefixTest, EmptyResultWhenNothingIsCached)
+{
+    auto chain = MakeChain("match_prefix_miss", 8);
+    for (const auto &client : clients_) {
+        size_t matchedCount = 1;
+        std::vector<std::pair<std::string, size_t>> workerPrefixes{ { "stale", 1 } };
+        DS_ASSERT_OK(client->MatchPrefix(chain, matchedCount, workerPrefixes));
+        ASSERT_EQ(matchedCount, 0ul);
+        ASSERT_TRUE(workerPrefixes.empty());
+    }
+
+    size_t matchedCount = 0;
+    std::vector<std::pair<std::string, size_t>> workerPrefixes;
+    ASSERT_EQ(clients_[0]->MatchPrefix({}, matchedCount, workerPrefixes).GetCode(), K_INVALID);
+}
+
+TEST_F(KVClientMatchPrefixTest, StopsAtFirstMissAcrossChunks)
+{
+    // Longer than the first lookup chunk, so the match has to carry over into the next one.
+    const size_t cachedLength = 20;
+    auto chain = MakeChain("match_prefix_chain", 40);
+    SetParam param{ .writeMode = WriteMode::NONE_L2_CACHE };
+    for (size_t i = 0; i < cachedLength; i++) {
+        DS_ASSERT_OK(clients_[0]->Set(chain[i], "value_" + std::to_string(i), param));
+    }
+    // A key cached past the gap must not extend the match.
+    DS_ASSERT_OK(clients_[0]->Set(chain[cachedLength + 1], "after_gap", param));
+
+    for (const auto &client : clients_) {
+        size_t matchedCount = 0;
+        std::vector<std::pair<std::string, size_t>> workerPrefixes;
+        DS_ASSERT_OK(client->MatchPrefix(chain, matchedCount, workerPrefixes));
+        ASSERT_EQ(matchedCount, cachedLength);
+        ASSERT_EQ(workerPrefixes.size(), 1ul);
+        ASSERT_EQ(workerPrefixes[0].first, WorkerAddress(0));
+        ASSERT_EQ(workerPrefixes[0].second, cachedLength);
+    }
+}
+
+TEST_F(KVClientMatchPrefixTest, ReportsPrefixOfEveryHoldingWorker)
+{
+    const size_t cachedLength = 6;
+    const size_t copiedLength = 3;
+    auto chain = MakeChain("match_prefix_locations", 10);
+    SetParam param{ .writeMode = WriteMode::NONE_L2_CACHE };
+    for (size_t i = 0; i < cachedLength; i++) {
+        DS_ASSERT_OK(clients_[0]->Set(chain[i], "value_" + std::to_string(i), param));
+    }
+    // Reading through worker 1 leaves it a copy of the leading keys only.
+    for (size_t i = 0; i < copiedLength; i++) {
+        std::string value;
+        DS_ASSERT_OK(clients_[1]->Get(chain[i], value));
+        ASSERT_EQ(value, "value_" + std::to_string(i));
+    }
+
+    size_t matchedCount = 0;
+    std::vector<std::pair<std::string, size_t>> workerPrefixes;
+    DS_ASSERT_OK(clients_[2]->MatchPrefix(chain, matchedCount, workerPrefixes));
+    ASSERT_EQ(matchedCount, cachedLength);
+    ASSERT_EQ(workerPrefixes.size(), 2ul);
+    EXPECT_EQ(workerPrefixes[0], std::make_pair(WorkerAddress(0), cachedLength));
+    EXPECT_EQ(workerPrefixes[1], std::make_pair(WorkerAddress(1), copiedLength));
+
+    // A chain that diverges after the copied keys matches only up to the divergence.
+    auto diverged = chain;
+    diverged[copiedLength] = "match_prefix_locations_other";
+    DS_ASSERT_OK(clients_[2]->MatchPrefix(diverged, matchedCount, workerPrefixes));
+    ASSERT_EQ(matchedCount, copiedLength);
+    ASSERT_EQ(workerPrefixes.size(), 2ul);
+    EXPECT_EQ(workerPrefixes[0].second, copiedLength);
+    EXPECT_EQ(workerPrefixes[1].second, copiedLength);
+}
+}  // namespace st
+}  // namespace datasystem
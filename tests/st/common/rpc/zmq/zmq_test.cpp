@@ -17,6 +17,8 @@
 /**
  * Description: Test ZMQ pluggin
  */
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <random>
 
@@ -40,6 +42,7 @@
 #include "datasystem/common/rpc/unix_sock_fd.h"
 #include "datasystem/common/flags/common_flags.h"
 #include "datasystem/common/util/file_util.h"
+#include "datasystem/common/util/raii.h"
 #include "datasystem/common/util/random_data.h"
 #include "datasystem/common/util/uuid_generator.h"
 #include "datasystem/common/util/status_helper.h"
@@ -51,6 +54,7 @@ DS_DECLARE_bool(log_async);
 DS_DECLARE_string(unix_domain_socket_dir);
 DS_DECLARE_string(encrypt_kit);
 DS_DECLARE_string(log_dir);
+DS_DECLARE_int32(zmq_server_frontend_shards);
 
 namespace datasystem {
 namespace st {
@@ -221,6 +225,24 @@ public:
 private:
 };
 
+class ZmqShardTest : public ZmqTcpTest {
+public:
+    void SetUp() override
+    {
+        FLAGS_zmq_server_frontend_shards = numShards_;
+        ZmqTcpTest::SetUp();
+    }
+
+    void TearDown() override
+    {
+        ZmqTcpTest::TearDown();
+        FLAGS_zmq_server_frontend_shards = 1;
+    }
+
+protected:
+    const int numShards_ = 4;
+};
+
 class ZmqFallBackTest : public CommonTest {
 public:
     void SetUp() override
@@ -1311,6 +1333,62 @@ TEST_F(ZmqTcpTest, LargePayload)
     ASSERT_EQ(crc32.crc32(), checksum);
 }
 
+TEST_F(ZmqShardTest, RepliesComeBackThroughEveryShard)
+{
+    auto sayHello = [this](const std::string &msg) {
+        arbitrary::workspace::SayHelloPb hi;
+        hi.set_msg(msg);
+        int64_t tag;
+        RETURN_IF_NOT_OK(stub->SimpleGreetingAsyncWrite(hi, tag));
+        arbitrary::workspace::ReplyHelloPb reply;
+        RETURN_IF_NOT_OK(stub->SimpleGreetingAsyncRead(tag, reply));
+        CHECK_FAIL_RETURN_STATUS(reply.reply() == hi.msg(), K_RUNTIME_ERROR, "Reply of another request");
+        return Status::OK();
+    };
+    auto everyShardReached = [this]() {
+        auto requests = rpc->GetFrontendShardRequests();
+        return requests.size() == static_cast<size_t>(numShards_)
+               && std::all_of(requests.begin(), requests.end(), [](uint64_t n) { return n > 0; });
+    };
+    // The gateway learns the shards from its first heartbeat reply. Once every shard has seen a request, the gateway
+    // is connected to all of them.
+    const auto readyDeadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    const int pollMs = 10;
+    while (!everyShardReached() && std::chrono::steady_clock::now() < readyDeadline) {
+        DS_ASSERT_OK(sayHello("ready"));
+        std::this_thread::sleep_for(std::chrono::milliseconds(pollMs));
+    }
+    ASSERT_TRUE(everyShardReached());
+
+    auto before = rpc->GetFrontendShardRequests();
+    const int numThreads = 8;
+    const int numRequests = 200;
+    ThreadPool pool(numThreads);
+    std::vector<std::future<Status>> futures;
+    for (int t = 0; t < numThreads; ++t) {
+        futures.emplace_back(pool.Submit([&sayHello, t]() {
+            for (int i = 0; i < numRequests; ++i) {
+                RETURN_IF_NOT_OK(sayHello(FormatString("%d-%d", t, i)));
+            }
+            return Status::OK();
+        }));
+    }
+    for (auto &f : futures) {
+        DS_ASSERT_OK(f.get());
+    }
+    auto after = rpc->GetFrontendShardRequests();
+    ASSERT_EQ(after.size(), before.size());
+    // The dealer socket of the gateway sends the requests round robin over its connections to the shards.
+    const uint64_t total = numThreads * numRequests;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < after.size(); ++i) {
+        uint64_t received = after[i] - before[i];
+        sum += received;
+        EXPECT_GE(received, total / numShards_ / 2) << "shard " << i;
+    }
+    ASSERT_EQ(sum, total);
+}
+
 TEST_F(ZmqFallBackTest, UdsFallBack)
 {
     arbitrary::workspace::SayHelloPb hi;
@@ -1406,6 +1484,36 @@ TEST_F(ZmqMTPTest, TestAsyncPayload)
     ASSERT_EQ(checksum1, checksum2);
 }
 
+TEST_F(ZmqMTPTest, TestParkedPayloadIntoBuffer)
+{
+    // Below payload_nocopy_threshold, the payload is parked only because the client asks for it.
+    const size_t sz = 2 * 1024 * 1024;
+    const int64_t directThreshold = 1024 * 1024;
+    // The parked payload goes out with MSG_ZEROCOPY, its completions must not be taken for a broken connection.
+    FLAGS_zerocopy_send_threshold = directThreshold;
+    Raii resetFlag([]() { FLAGS_zerocopy_send_threshold = 0; });
+    RandomData randomData;
+    std::string data = randomData.GetRandomString(sz);
+    const int rounds = 5;
+    for (int i = 0; i < rounds; ++i) {
+        std::unique_ptr<ClientUnaryWriterReader<arbitrary::workspace::SayHelloPb, arbitrary::workspace::ReplyHelloPb>>
+            clientApi;
+        DS_ASSERT_OK(stub->HelloWorld4(RpcOptions(), &clientApi));
+        clientApi->SetPayloadDirectThreshold(directThreshold);
+        arbitrary::workspace::SayHelloPb rq;
+        arbitrary::workspace::ReplyHelloPb reply;
+        rq.set_msg(arbitrary::workspace::MTPServiceImpl::TAG_PAYLOAD_MSG);
+        DS_ASSERT_OK(clientApi->Write(rq));
+        DS_ASSERT_OK(clientApi->SendPayload({ MemView(data.data(), data.size()) }));
+        DS_ASSERT_OK(clientApi->Read(reply));
+        ASSERT_EQ(rq.msg(), reply.reply());
+        // Only a parked payload can be received into a buffer of the caller.
+        std::string received(sz, '\0');
+        DS_ASSERT_OK(clientApi->ReceivePayload(received.data(), received.size()));
+        ASSERT_TRUE(received == data) << "round " << i;
+    }
+}
+
 TEST_F(ZmqMTPTest, TestEmptyPayload)
 {
     std::unique_ptr<ClientUnaryWriterReader<arbitrary::workspace::SayHelloPb, arbitrary::workspace::ReplyHelloPb>>
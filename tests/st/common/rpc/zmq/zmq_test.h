@@ -63,6 +63,7 @@ public:
 class MTPServiceImpl final : public MTPService {
 public:
     constexpr int static TWO = 2;
+    constexpr static const char *TAG_PAYLOAD_MSG = "TagPayload";
     Status HelloWorld3(
         std::shared_ptr<::datasystem::ServerUnaryWriterReader<ReplyHelloPb, SayHelloPb>> serverApi) override
     {
@@ -109,7 +110,9 @@ public:
         if (rc.IsError()) {
             return rc;
         }
-        rc = serverApi->SendAndTagPayload(payload, (val++) % TWO == 0);
+        // A tagged payload may be parked for the client to fetch.
+        bool tagPayload = rq.msg() == TAG_PAYLOAD_MSG || (val++) % TWO == 0;
+        rc = serverApi->SendAndTagPayload(payload, tagPayload);
         if (rc.IsError()) {
             return rc;
         }
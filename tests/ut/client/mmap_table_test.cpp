@@ -107,6 +107,25 @@ TEST_F(MmapTableTest, TestMmapTableEntryInvalidParameter)
     ASSERT_EQ(status.GetCode(), StatusCode::K_RUNTIME_ERROR);
 }
 
+TEST_F(MmapTableTest, TestMmapTableEntryFallbackArenaWithHugeTlb)
+{
+    // A worker whose huge page pool is short hands out a regular memfd even with enable_huge_tlb set, mapping it
+    // with MAP_HUGETLB would fail with EINVAL.
+    const int32_t size = 4096;
+    int32_t fd = CreateFd(size);
+    ASSERT_GE(fd, 0);
+    int32_t probeFd = dup(fd);
+    ASSERT_GE(probeFd, 0);
+    auto entry = std::make_unique<ShmMmapTableEntry>(fd, size);
+    DS_ASSERT_OK(entry->Init(true, ""));
+    ASSERT_NE(entry->Pointer(), nullptr);
+    const_cast<uint8_t *>(entry->Pointer())[size - 1] = 'z';
+    char last = 0;
+    ASSERT_EQ(pread(probeFd, &last, 1, size - 1), 1);
+    ASSERT_EQ(last, 'z');
+    close(probeFd);
+}
+
 TEST_F(MmapTableTest, TestGetMmapEntry)
 {
     LOG(INFO) << "Test mmap table decrease mmap ref.";
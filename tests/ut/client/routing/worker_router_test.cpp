@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <atomic>
 #include <limits>
 #include <memory>
@@ -30,6 +31,7 @@
 #include "datasystem/client/routing/routing.h"
 #include "datasystem/client/routing/state_filter.h"
 #include "datasystem/client/routing/worker_router.h"
+#include "datasystem/common/util/hash_algorithm.h"
 #include "datasystem/common/util/net_util.h"
 #include "datasystem/common/util/rpc_util.h"
 #include "datasystem/protos/cluster_topology.pb.h"
@@ -145,6 +147,32 @@ TEST_F(RoutingTest, TestSelectWorkersBatch)
     EXPECT_EQ(totalKeys, keys.size());
 }
 
+TEST_F(RoutingTest, TestSelectWorkerIndexesMatchesKeyGroups)
+{
+    auto router = CreateRouter();
+    router->UpdateHashRing(BuildRing(), BuildHostIdMap());
+
+    std::vector<std::string> keys = { "k1", "k2", "k3", "k4", "k5", "k1" };
+    std::unordered_map<HostPort, std::vector<std::string>> groups;
+    DS_ASSERT_OK(router->SelectWorkers(keys, client::DataPlacementPolicy::PREFERRED_META_OWNER, groups));
+    std::unordered_map<HostPort, std::vector<size_t>> indexGroups;
+    DS_ASSERT_OK(router->SelectWorkerIndexes(keys, client::DataPlacementPolicy::PREFERRED_META_OWNER, indexGroups));
+
+    ASSERT_EQ(indexGroups.size(), groups.size());
+    size_t totalKeys = 0;
+    for (const auto &g : indexGroups) {
+        EXPECT_TRUE(std::is_sorted(g.second.begin(), g.second.end()));
+        std::vector<std::string> groupKeys;
+        for (auto index : g.second) {
+            ASSERT_LT(index, keys.size());
+            groupKeys.push_back(keys[index]);
+        }
+        EXPECT_EQ(groupKeys, groups.at(g.first));
+        totalKeys += g.second.size();
+    }
+    EXPECT_EQ(totalKeys, keys.size());
+}
+
 TEST_F(RoutingTest, TestSelectWorkersFailureDoesNotMutateOutput)
 {
     auto router = std::make_shared<client::WorkerRouter>(
@@ -496,6 +524,46 @@ TEST_F(RoutingTest, U7RoutesWithFiveThousandWorkerSnapshot)
     EXPECT_EQ(selectedKeyCount, keyCount);
 }
 
+TEST_F(RoutingTest, BatchSelectionMatchesSingleKeySelection)
+{
+    constexpr int workerCount = 64;
+    constexpr int tokensPerWorker = 4;
+    constexpr int portBase = 12'000;
+    auto ring = std::make_shared<ClusterTopologyPb>();
+    auto hostIdMap = std::make_shared<std::unordered_map<std::string, std::string>>();
+    for (int i = 0; i < workerCount; ++i) {
+        const std::string address = "127.0.0.1:" + std::to_string(portBase + i);
+        auto &worker = (*ring->mutable_members())[address];
+        worker.set_state(MembershipPb::ACTIVE);
+        for (int token = 0; token < tokensPerWorker; ++token) {
+            worker.add_tokens(MurmurHash3_32(address + "#" + std::to_string(token)));
+        }
+        (*hostIdMap)[address] = i % 16 == 0 ? "host-a" : "host-" + std::to_string(i);
+    }
+    auto router = CreateRouter("host-a");
+    router->UpdateHashRing(ring, hostIdMap);
+    MarkWorkerBroken(*router, HostPort("127.0.0.1", portBase));
+    MarkWorkerBroken(*router, HostPort("127.0.0.1", portBase + 1));
+    const std::vector<HostPort> exclude{ HostPort("127.0.0.1", portBase + 2), HostPort("127.0.0.1", portBase + 16) };
+
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < 10'000; ++i) {
+        keys.emplace_back("batch-route-key-" + std::to_string(i));
+    }
+    for (auto policy : { client::DataPlacementPolicy::PREFERRED_META_OWNER,
+                         client::DataPlacementPolicy::PREFERRED_SAME_NODE }) {
+        std::unordered_map<HostPort, std::vector<std::string>> groups;
+        DS_ASSERT_OK(router->SelectWorkers(keys, policy, groups, exclude));
+        std::unordered_map<HostPort, std::vector<std::string>> expected;
+        for (const auto &key : keys) {
+            HostPort worker;
+            DS_ASSERT_OK(router->SelectWorker(key, policy, worker, exclude));
+            expected[worker].push_back(key);
+        }
+        EXPECT_EQ(groups, expected);
+    }
+}
+
 TEST_F(RoutingTest, U7BatchSelectionNeverMixesConcurrentSnapshots)
 {
     constexpr int generationAPortBase = 11'000;
@@ -635,6 +635,53 @@ TEST(TopologyControllerTest, BootstrapsAllReadyInitialMembers)
     DS_ASSERT_OK(controller.Stop(std::chrono::steady_clock::now() + std::chrono::seconds(1)));
 }
 
+TEST(TopologyControllerTest, FreezesOnTopologyPlacedByAnotherAlgorithm)
+{
+    FakeCoordinationBackend backend;
+    std::unique_ptr<TopologyKeyHelper> keys;
+    DS_ASSERT_OK(TopologyKeyHelper::Create("placement", keys));
+    TopologyRepository repository(backend, *keys);
+    HashAlgorithm algorithm;
+    CoordinationEventDispatcher dispatcher(32);
+    TopologyControllerOptions options;
+    options.reconcileTick = std::chrono::milliseconds(1);
+    options.scaleOutCollectWindow = std::chrono::milliseconds(0);
+    options.scaleInCollectWindow = std::chrono::milliseconds(0);
+    TopologyState latest;
+    latest.version = 1;
+    backend.PutRaw(keys->TopologyTable(), TopologyKeyHelper::TopologyKey(), latest);
+    PutMembership(backend, *keys, "127.0.0.1:1", MemberLifecycleState::READY);
+    {
+        TopologyController controller(backend, repository, *keys, algorithm, dispatcher, options);
+        DS_ASSERT_OK(controller.Start());
+        EXPECT_TRUE(WaitForTopology(repository, std::chrono::steady_clock::now() + std::chrono::seconds(1),
+                                    [](const auto &state) {
+                                        return state.clusterHasInit && state.members.size() == 1
+                                               && state.members.front().state == MemberState::ACTIVE;
+                                    }));
+        DS_ASSERT_OK(controller.Stop(std::chrono::steady_clock::now() + std::chrono::seconds(1)));
+    }
+    int64_t revision = 0;
+    DS_ASSERT_OK(repository.ReadTopology(CONTROLLER_TEST_READ_TIMEOUT_MS, latest, revision));
+    EXPECT_EQ(latest.placementAlgorithm, algorithm.GetId());
+
+    // Another planner placed the ring. This one must not plan the new member on top of it.
+    latest.placementAlgorithm = "weighted_hash";
+    backend.PutRaw(keys->TopologyTable(), TopologyKeyHelper::TopologyKey(), latest);
+    PutMembership(backend, *keys, "127.0.0.1:2", MemberLifecycleState::READY);
+    TopologyController controller(backend, repository, *keys, algorithm, dispatcher, options);
+    DS_ASSERT_OK(controller.Start());
+    EXPECT_TRUE(WaitForCondition([&] {
+        auto diagnostics = controller.GetDiagnostics();
+        return diagnostics.controlFrozen && diagnostics.lastError.find("weighted_hash") != std::string::npos;
+    }));
+    DS_ASSERT_OK(controller.Stop(std::chrono::steady_clock::now() + std::chrono::seconds(1)));
+    TopologyState unchanged;
+    DS_ASSERT_OK(repository.ReadTopology(CONTROLLER_TEST_READ_TIMEOUT_MS, unchanged, revision));
+    EXPECT_EQ(unchanged.version, latest.version);
+    EXPECT_EQ(unchanged.members.size(), 1ul);
+}
+
 TEST(TopologyControllerTest, BootstrapCollectWindowCoalescesStaggeredReadyMembers)
 {
     constexpr size_t bootstrapMemberCount = 500;
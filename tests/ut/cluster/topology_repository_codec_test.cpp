@@ -55,6 +55,7 @@ TEST(TopologyRepositoryCodecTest, TopologyRoundTripIsCanonical)
     input.members = { Member{ { std::string(16, 'b'), "127.0.0.1:2" }, MemberState::JOINING, { 30, 40 } },
                       Member{ { std::string(16, 'a'), "127.0.0.1:1" }, MemberState::ACTIVE, { 10, 20 } } };
     input.activeBatch = ActiveBatch{ TopologyChangeType::SCALE_OUT, 9 };
+    input.placementAlgorithm = "weighted_hash";
     std::string first;
     DS_ASSERT_OK(TopologyRepositoryCodec::EncodeTopology(input, first));
     TopologyState decoded;
@@ -63,6 +64,7 @@ TEST(TopologyRepositoryCodecTest, TopologyRoundTripIsCanonical)
     DS_ASSERT_OK(TopologyRepositoryCodec::EncodeTopology(decoded, second));
     EXPECT_EQ(first, second);
     EXPECT_EQ(decoded.members[0].identity.address, "127.0.0.1:1");
+    EXPECT_EQ(decoded.placementAlgorithm, "weighted_hash");
 }
 
 TEST(TopologyRepositoryCodecTest, TaskRoundTripDerivesSingleExecutor)
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ */
+
+/**
+ * Description: Capacity-weighted cluster hash planning algorithm tests.
+ */
+#include "datasystem/cluster/algorithm/weighted_hash_algorithm.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+
+#include "datasystem/cluster/algorithm/algorithm_catalog.h"
+#include "gtest/gtest.h"
+#include "ut/common.h"
+
+namespace datasystem::cluster {
+namespace {
+
+constexpr uint32_t TOKENS_PER_MEMBER = 16;
+constexpr uint64_t REFERENCE_CAPACITY = 1'024;
+constexpr uint64_t RING_SIZE = uint64_t{ std::numeric_limits<uint32_t>::max() } + 1;
+
+MemberIdentity MakeIdentity(char id, uint32_t port)
+{
+    return { std::string(16, id), "127.0.0.1:" + std::to_string(port) };
+}
+
+ScaleOutPlanInput MakeBootstrapInput(uint32_t memberCount)
+{
+    ScaleOutPlanInput input;
+    input.tokensPerMember = TOKENS_PER_MEMBER;
+    input.referenceCapacity = REFERENCE_CAPACITY;
+    for (uint32_t index = 0; index < memberCount; ++index) {
+        input.joining.emplace_back(MakeIdentity(static_cast<char>('a' + index), index + 1));
+        input.capacities.emplace(input.joining.back().address, REFERENCE_CAPACITY);
+    }
+    return input;
+}
+
+// Share of the ring owned by each member, a token owns the arc after its predecessor up to itself.
+std::map<std::string, uint64_t> RingShares(const std::vector<Member> &members)
+{
+    std::map<uint32_t, std::string> ring;
+    for (const auto &member : members) {
+        for (auto token : member.tokens) {
+            ring.emplace(token, member.identity.address);
+        }
+    }
+    std::map<std::string, uint64_t> shares;
+    uint32_t predecessor = ring.rbegin()->first;
+    for (const auto &[token, address] : ring) {
+        shares[address] += ring.size() == 1 ? RING_SIZE : static_cast<uint32_t>(token - predecessor);
+        predecessor = token;
+    }
+    return shares;
+}
+
+uint64_t RangeSize(const TokenRange &range)
+{
+    return uint64_t{ range.end } - range.from + 1;
+}
+
+TEST(WeightedHashAlgorithmTest, CatalogResolvesBuiltInAlgorithmsById)
+{
+    AlgorithmCatalog catalog;
+    const IPlanningAlgorithm *planning = nullptr;
+    const IRoutingAlgorithm *routing = nullptr;
+    DS_ASSERT_OK(catalog.GetPlanning("weighted_hash", planning));
+    EXPECT_EQ(planning->GetId(), "weighted_hash");
+    DS_ASSERT_OK(catalog.GetRouting("weighted_hash", routing));
+    DS_ASSERT_OK(catalog.GetPlanning("hash", planning));
+    EXPECT_EQ(planning->GetId(), "hash");
+    EXPECT_EQ(catalog.GetPlanning("unknown", planning).GetCode(), K_NOT_FOUND);
+    EXPECT_EQ(catalog.GetRouting("unknown", routing).GetCode(), K_NOT_FOUND);
+}
+
+TEST(WeightedHashAlgorithmTest, TokenCountFollowsAdvertisedCapacity)
+{
+    ScaleOutPlanInput input = MakeBootstrapInput(0);
+    const auto big = MakeIdentity('a', 1);
+    const auto small = MakeIdentity('b', 2);
+    const auto unknown = MakeIdentity('c', 3);
+    input.capacities = { { big.address, 4 * REFERENCE_CAPACITY }, { small.address, 1 } };
+    EXPECT_EQ(WeightedHashAlgorithm::WeightedTokenCount(big, input), 4 * TOKENS_PER_MEMBER);
+    EXPECT_EQ(WeightedHashAlgorithm::WeightedTokenCount(small, input), 1);
+    EXPECT_EQ(WeightedHashAlgorithm::WeightedTokenCount(unknown, input), TOKENS_PER_MEMBER);
+    input.referenceCapacity = 0;
+    EXPECT_EQ(WeightedHashAlgorithm::WeightedTokenCount(big, input), TOKENS_PER_MEMBER);
+}
+
+TEST(WeightedHashAlgorithmTest, BootstrapIsDeterministicAndUnique)
+{
+    WeightedHashAlgorithm algorithm;
+    ScaleOutPlanInput input = MakeBootstrapInput(3);
+    input.capacities[input.joining.front().address] = 2 * REFERENCE_CAPACITY;
+    TopologyPlan first;
+    TopologyPlan second;
+    DS_ASSERT_OK(algorithm.BuildInitialPlacement(input, first));
+    DS_ASSERT_OK(algorithm.BuildInitialPlacement(input, second));
+    ASSERT_EQ(first.next.members.size(), 3);
+    std::set<uint32_t> tokens;
+    size_t total = 0;
+    for (size_t index = 0; index < first.next.members.size(); ++index) {
+        const auto &member = first.next.members[index];
+        EXPECT_EQ(member.tokens, second.next.members[index].tokens);
+        EXPECT_TRUE(std::is_sorted(member.tokens.begin(), member.tokens.end()));
+        const uint32_t expected =
+            member.identity == input.joining.front() ? 2 * TOKENS_PER_MEMBER : TOKENS_PER_MEMBER;
+        EXPECT_EQ(member.tokens.size(), expected);
+        tokens.insert(member.tokens.begin(), member.tokens.end());
+        total += member.tokens.size();
+    }
+    EXPECT_EQ(tokens.size(), total);
+}
+
+TEST(WeightedHashAlgorithmTest, ScaleOutOnlyMovesTheWeightedShareToJoiningMembers)
+{
+    WeightedHashAlgorithm algorithm;
+    ScaleOutPlanInput bootstrap = MakeBootstrapInput(4);
+    TopologyPlan initial;
+    DS_ASSERT_OK(algorithm.BuildInitialPlacement(bootstrap, initial));
+
+    ScaleOutPlanInput input = MakeBootstrapInput(0);
+    input.current = initial.next;
+    input.current.clusterHasInit = true;
+    for (auto &member : input.current.members) {
+        member.state = MemberState::ACTIVE;
+    }
+    const auto joining = MakeIdentity('z', 26);
+    input.joining = { joining };
+    input.capacities = { { joining.address, 4 * REFERENCE_CAPACITY } };
+    TopologyPlan plan;
+    DS_ASSERT_OK(algorithm.PlanScaleOut(input, plan));
+
+    uint64_t moved = 0;
+    for (const auto &change : plan.ownerChanges) {
+        EXPECT_EQ(change.target, joining);
+        for (const auto &range : change.ranges) {
+            moved += RangeSize(range);
+        }
+    }
+    for (size_t index = 0; index < input.current.members.size(); ++index) {
+        EXPECT_EQ(plan.next.members[index].tokens, input.current.members[index].tokens);
+    }
+    // The new member weighs as much as the four others together, it should take about half of the ring.
+    const auto shares = RingShares(plan.next.members);
+    EXPECT_EQ(shares.at(joining.address), moved);
+    EXPECT_GT(moved, RING_SIZE * 3 / 10);
+    EXPECT_LT(moved, RING_SIZE * 7 / 10);
+}
+
+TEST(WeightedHashAlgorithmTest, BalancedTokensBoundTheLargestShare)
+{
+    constexpr uint32_t memberCount = 16;
+    WeightedHashAlgorithm weighted;
+    HashAlgorithm plain;
+    ScaleOutPlanInput input = MakeBootstrapInput(memberCount);
+    TopologyPlan weightedPlan;
+    TopologyPlan plainPlan;
+    DS_ASSERT_OK(weighted.BuildInitialPlacement(input, weightedPlan));
+    DS_ASSERT_OK(plain.BuildInitialPlacement(input, plainPlan));
+    auto maxShare = [](const std::map<std::string, uint64_t> &shares) {
+        return std::max_element(shares.begin(), shares.end(),
+                                [](const auto &left, const auto &right) { return left.second < right.second; })
+            ->second;
+    };
+    const auto weightedMax = maxShare(RingShares(weightedPlan.next.members));
+    EXPECT_LE(weightedMax, maxShare(RingShares(plainPlan.next.members)));
+    EXPECT_LT(weightedMax, RING_SIZE / memberCount * 3 / 2);
+}
+
+TEST(WeightedHashAlgorithmTest, ScaleInOnlyMovesRangesOfTheLeavingMember)
+{
+    WeightedHashAlgorithm algorithm;
+    TopologyPlan initial;
+    DS_ASSERT_OK(algorithm.BuildInitialPlacement(MakeBootstrapInput(3), initial));
+    TopologyState current = initial.next;
+    current.clusterHasInit = true;
+    for (auto &member : current.members) {
+        member.state = MemberState::ACTIVE;
+    }
+    TopologyPlan plan;
+    DS_ASSERT_OK(algorithm.PlanScaleIn({ current, { current.members.front().identity } }, plan));
+    ASSERT_FALSE(plan.ownerChanges.empty());
+    for (const auto &change : plan.ownerChanges) {
+        ASSERT_TRUE(change.source.has_value());
+        EXPECT_EQ(*change.source, current.members.front().identity);
+    }
+}
+
+}  // namespace
+}  // namespace datasystem::cluster
@@ -0,0 +1,412 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: curl multi http client test, against a local keep-alive http server with injected latency.
+ */
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "ut/common.h"
+#include "datasystem/common/httpclient/curl_multi_http_client.h"
+#include "datasystem/common/log/logging.h"
+#include "datasystem/common/util/wait_post.h"
+
+namespace datasystem {
+namespace ut {
+namespace {
+/**
+ * Answers every request with 200 and a fixed body after a delay, one thread per keep-alive connection. With a gate,
+ * no request is answered before that many of them are in flight at once.
+ */
+class MockHttpServer {
+public:
+    MockHttpServer(int latencyMs, std::string body, size_t gate = 0)
+        : latencyMs_(latencyMs), body_(std::move(body)), gate_(gate)
+    {
+    }
+
+    ~MockHttpServer()
+    {
+        Stop();
+    }
+
+    bool Start()
+    {
+        listenFd_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(addr);
+        const int backlog = 1024;
+        if (listenFd_ < 0 || bind(listenFd_, reinterpret_cast<sockaddr *>(&addr), len) != 0
+            || listen(listenFd_, backlog) != 0 || getsockname(listenFd_, reinterpret_cast<sockaddr *>(&addr), &len) != 0) {
+            return false;
+        }
+        port_ = ntohs(addr.sin_port);
+        acceptThread_ = std::thread([this]() { AcceptLoop(); });
+        return true;
+    }
+
+    void Stop()
+    {
+        if (listenFd_ < 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(inflightMutex_);
+            stop_ = true;
+        }
+        inflightCv_.notify_all();
+        shutdown(listenFd_, SHUT_RDWR);
+        acceptThread_.join();
+        close(listenFd_);
+        listenFd_ = -1;
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int fd : connFds_) {
+            shutdown(fd, SHUT_RDWR);
+        }
+        for (auto &thread : connThreads_) {
+            thread.join();
+        }
+        for (int fd : connFds_) {
+            close(fd);
+        }
+    }
+
+    std::string Url(const std::string &path = "/obj") const
+    {
+        return "http://127.0.0.1:" + std::to_string(port_) + path;
+    }
+
+    size_t Connections() const
+    {
+        return connections_;
+    }
+
+    // The most requests that were received and not answered yet at the same time.
+    size_t PeakInflight()
+    {
+        std::lock_guard<std::mutex> lock(inflightMutex_);
+        return peakInflight_;
+    }
+
+private:
+    void AcceptLoop()
+    {
+        while (!stop_) {
+            int fd = accept(listenFd_, nullptr, nullptr);
+            if (fd < 0) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++connections_;
+            connFds_.push_back(fd);
+            connThreads_.emplace_back([this, fd]() { Serve(fd); });
+        }
+    }
+
+    void Serve(int fd)
+    {
+        std::string buffer;
+        char chunk[4096];
+        while (!stop_) {
+            auto headerEnd = buffer.find("\r\n\r\n");
+            if (headerEnd == std::string::npos) {
+                ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+                if (n <= 0) {
+                    return;
+                }
+                buffer.append(chunk, n);
+                continue;
+            }
+            size_t bodyLen = 0;
+            auto lengthPos = buffer.find("Content-Length:");
+            if (lengthPos != std::string::npos && lengthPos < headerEnd) {
+                bodyLen = std::stoul(buffer.substr(lengthPos + strlen("Content-Length:")));
+            }
+            while (buffer.size() < headerEnd + 4 + bodyLen) {
+                ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+                if (n <= 0) {
+                    return;
+                }
+                buffer.append(chunk, n);
+            }
+            buffer.erase(0, headerEnd + 4 + bodyLen);
+            EnterRequest();
+            std::this_thread::sleep_for(std::chrono::milliseconds(latencyMs_));
+            std::string response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body_.size()) + "\r\n\r\n"
+                                   + body_;
+            bool sent = send(fd, response.data(), response.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(response.size());
+            {
+                std::lock_guard<std::mutex> lock(inflightMutex_);
+                --inflight_;
+            }
+            if (!sent) {
+                return;
+            }
+        }
+    }
+
+    void EnterRequest()
+    {
+        const auto gateTimeout = std::chrono::seconds(30);
+        std::unique_lock<std::mutex> lock(inflightMutex_);
+        peakInflight_ = std::max(peakInflight_, ++inflight_);
+        gateOpen_ = gateOpen_ || inflight_ >= gate_;
+        inflightCv_.notify_all();
+        // A client that can not reach the gate fails the test on the peak instead of hanging it.
+        (void)inflightCv_.wait_for(lock, gateTimeout, [this]() { return stop_ || gateOpen_; });
+    }
+
+    const int latencyMs_;
+    const std::string body_;
+    const size_t gate_;
+    int listenFd_{ -1 };
+    int port_{ 0 };
+    std::atomic<bool> stop_{ false };
+    std::atomic<size_t> connections_{ 0 };
+    std::thread acceptThread_;
+    std::mutex mutex_;
+    std::vector<int> connFds_;
+    std::vector<std::thread> connThreads_;
+    std::mutex inflightMutex_;  // Protects the in flight counters and the gate.
+    std::condition_variable inflightCv_;
+    size_t inflight_{ 0 };
+    size_t peakInflight_{ 0 };
+    bool gateOpen_{ false };
+};
+
+std::shared_ptr<HttpRequest> MakeRequest(std::string url, HttpMethod method = HttpMethod::GET)
+{
+    const int64_t timeoutMs = 10'000;
+    auto request = std::make_shared<HttpRequest>();
+    request->SetUrl(std::move(url));
+    request->SetMethod(std::move(method));
+    request->SetRequestTimeoutMs(timeoutMs);
+    request->SetConnectTimeoutMs(timeoutMs);
+    return request;
+}
+
+std::shared_ptr<HttpResponse> MakeResponse()
+{
+    auto response = std::make_shared<HttpResponse>();
+    response->SetBody(std::make_shared<std::stringstream>());
+    return response;
+}
+
+/**
+ * @brief Send requests asynchronously and wait for all of them.
+ * @return The number of the requests answered with 200 and the body.
+ */
+size_t SendAll(CurlMultiHttpClient &client, const std::string &url, size_t count, const std::string &body)
+{
+    std::atomic<size_t> ok{ 0 };
+    std::atomic<size_t> left{ count };
+    WaitPost done;
+    for (size_t i = 0; i < count; ++i) {
+        auto response = MakeResponse();
+        auto rc = client.SendAsync(MakeRequest(url), response,
+                                   [&](const Status &status, const std::shared_ptr<HttpResponse> &rsp) {
+                                       auto *stream = static_cast<std::stringstream *>(rsp->GetBody().get());
+                                       if (status.IsOk() && rsp->GetStatus() == 200 && stream->str() == body) {
+                                           ok.fetch_add(1);
+                                       }
+                                       if (left.fetch_sub(1) == 1) {
+                                           done.Set();
+                                       }
+                                   });
+        if (rc.IsError() && left.fetch_sub(1) == 1) {
+            done.Set();
+        }
+    }
+    done.Wait();
+    return ok;
+}
+}  // namespace
+
+class CurlMultiHttpClientTest : public CommonTest {
+public:
+    void SetUp() override
+    {
+        Logging::GetInstance()->Start("ds_llt", LogProcessRole::CLIENT, 1);
+    }
+};
+
+TEST_F(CurlMultiHttpClientTest, SyncSend)
+{
+    MockHttpServer server(0, "hello");
+    ASSERT_TRUE(server.Start());
+    CurlMultiHttpClient client(false);
+    DS_ASSERT_OK(client.Init());
+    std::shared_ptr<HttpResponse> response;
+    DS_ASSERT_OK(client.Send(MakeRequest(server.Url()), response));
+    ASSERT_EQ(response->GetStatus(), 200);
+    ASSERT_EQ(static_cast<std::stringstream *>(response->GetBody().get())->str(), "hello");
+
+    auto put = MakeRequest(server.Url(), HttpMethod::PUT);
+    put->SetBody(std::make_shared<std::stringstream>(std::string(100'000, 'x')));
+    response = nullptr;
+    DS_ASSERT_OK(client.Send(put, response));
+    ASSERT_EQ(response->GetStatus(), 200);
+}
+
+TEST_F(CurlMultiHttpClientTest, ManyInflightOnBoundedConnections)
+{
+    const int latencyMs = 20;
+    const long maxHostConnections = 8;
+    const size_t requestNum = 400;
+    MockHttpServer server(latencyMs, "body");
+    ASSERT_TRUE(server.Start());
+    CurlMultiHttpClient client(false, maxHostConnections, maxHostConnections);
+    DS_ASSERT_OK(client.Init());
+    ASSERT_EQ(SendAll(client, server.Url(), requestNum, "body"), requestNum);
+    ASSERT_EQ(client.InflightCount(), 0ul);
+    // The requests above the limit wait for a kept-alive connection instead of opening new ones.
+    ASSERT_LE(server.Connections(), static_cast<size_t>(maxHostConnections));
+}
+
+TEST_F(CurlMultiHttpClientTest, TransportErrorCompletesWithError)
+{
+    MockHttpServer server(0, "");
+    ASSERT_TRUE(server.Start());
+    auto url = server.Url();
+    server.Stop();
+    CurlMultiHttpClient client(false);
+    DS_ASSERT_OK(client.Init());
+    std::shared_ptr<HttpResponse> response;
+    DS_ASSERT_NOT_OK(client.Send(MakeRequest(url), response));
+}
+
+TEST_F(CurlMultiHttpClientTest, ShutdownFailsInflight)
+{
+    const int latencyMs = 5000;
+    MockHttpServer server(latencyMs, "late");
+    ASSERT_TRUE(server.Start());
+    CurlMultiHttpClient client(false);
+    DS_ASSERT_OK(client.Init());
+    WaitPost done;
+    DS_ASSERT_OK(client.SendAsync(MakeRequest(server.Url()), MakeResponse(),
+                                  [&done](const Status &rc, const std::shared_ptr<HttpResponse> &) {
+                                      done.SetWithStatus(rc.IsError() ? Status::OK() : Status(K_RUNTIME_ERROR, ""));
+                                  }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    client.Shutdown();
+    DS_ASSERT_OK(done.WaitAndGetStatus());
+    DS_ASSERT_NOT_OK(client.SendAsync(MakeRequest(server.Url()), MakeResponse(), nullptr));
+}
+
+/**
+ * A blocking client needs one thread per outstanding request, the event loop keeps them all in flight on one thread.
+ * The server answers none of them before all are in flight, so the requests only complete if they really overlap.
+ */
+TEST_F(CurlMultiHttpClientTest, AllRequestsInFlightAtOnce)
+{
+    const size_t requestNum = 64;
+    const long maxHostConnections = 64;
+    MockHttpServer server(0, "body", requestNum);
+    ASSERT_TRUE(server.Start());
+    CurlMultiHttpClient client(false, maxHostConnections, maxHostConnections);
+    DS_ASSERT_OK(client.Init());
+    ASSERT_EQ(SendAll(client, server.Url(), requestNum, "body"), requestNum);
+    ASSERT_EQ(server.PeakInflight(), requestNum);
+    ASSERT_EQ(client.InflightCount(), 0ul);
+
+    // The blocking client has one request in flight per calling thread.
+    const size_t blockingThreads = 4;
+    MockHttpServer blockingServer(1, "body");
+    ASSERT_TRUE(blockingServer.Start());
+    CurlHttpClient blocking(false);
+    std::atomic<size_t> blockingOk{ 0 };
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < blockingThreads; ++t) {
+        threads.emplace_back([&]() {
+            for (size_t i = 0; i < requestNum / blockingThreads; ++i) {
+                auto response = MakeResponse();
+                if (blocking.Send(MakeRequest(blockingServer.Url()), response).IsOk() && response->GetStatus() == 200) {
+                    blockingOk.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(blockingOk, requestNum);
+    ASSERT_LE(blockingServer.PeakInflight(), blockingThreads);
+}
+
+TEST_F(CurlMultiHttpClientTest, LEVEL1_ThroughputAgainstBlockingClient)
+{
+    const int latencyMs = 10;
+    const size_t requestNum = 2000;
+    const long maxHostConnections = 64;
+    const size_t blockingThreads = 8;
+    auto requestsPerSec = [requestNum](std::chrono::steady_clock::time_point start) {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return requestNum / elapsed.count();
+    };
+
+    MockHttpServer server(latencyMs, "body");
+    ASSERT_TRUE(server.Start());
+    CurlMultiHttpClient client(false, maxHostConnections, maxHostConnections);
+    DS_ASSERT_OK(client.Init());
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(SendAll(client, server.Url(), requestNum, "body"), requestNum);
+    double multiRps = requestsPerSec(start);
+
+    MockHttpServer blockingServer(latencyMs, "body");
+    ASSERT_TRUE(blockingServer.Start());
+    CurlHttpClient blocking(false);
+    std::atomic<size_t> blockingOk{ 0 };
+    std::vector<std::thread> threads;
+    start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < blockingThreads; ++t) {
+        threads.emplace_back([&]() {
+            for (size_t i = 0; i < requestNum / blockingThreads; ++i) {
+                auto response = MakeResponse();
+                if (blocking.Send(MakeRequest(blockingServer.Url()), response).IsOk() && response->GetStatus() == 200) {
+                    blockingOk.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    double blockingRps = requestsPerSec(start);
+    ASSERT_EQ(blockingOk, requestNum);
+
+    std::cout << "latency " << latencyMs << "ms, " << requestNum << " requests" << std::endl;
+    std::cout << "multi client, 1 thread, " << maxHostConnections << " connections: " << multiRps << " requests/s"
+              << std::endl;
+    std::cout << "blocking client, " << blockingThreads << " threads: " << blockingRps << " requests/s" << std::endl;
+    EXPECT_GT(multiRps, blockingRps);
+}
+}  // namespace ut
+}  // namespace datasystem
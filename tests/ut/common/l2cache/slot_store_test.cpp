@@ -18,8 +18,10 @@
  * Description: White-box tests for slot storage.
  */
 
+#include <atomic>
 #include <functional>
 #include <future>
+#include <iostream>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -638,6 +640,33 @@ TEST_F(SlotStoreTest, PersistenceApiAggregateSaveGetDelete)
     ASSERT_EQ(ReadAll(newest), "value_v2");
 }
 
+TEST_F(SlotStoreTest, PersistenceApiAggregateGetRangeAndToBuffer)
+{
+    auto api = PersistenceApi::Create();
+    ASSERT_TRUE(api->Init().IsOk());
+
+    auto body = std::make_shared<std::stringstream>();
+    *body << "value_v1";
+    ASSERT_TRUE(api->Save("tenant/keyR", 1, 1000, body).IsOk());
+
+    auto range = std::make_shared<std::stringstream>();
+    ASSERT_TRUE(api->GetRange("tenant/keyR", 1, 2, 100, 1000, range).IsOk());
+    ASSERT_EQ(ReadAll(range), "lue_v1");
+
+    std::string buffer(5, '\0');
+    uint64_t objectSize = 0;
+    ASSERT_TRUE(api->GetToBuffer("tenant/keyR", 1, 2, buffer.size(), 1000, buffer.data(), objectSize).IsOk());
+    ASSERT_EQ(buffer, "lue_v");
+    ASSERT_EQ(objectSize, 8ul);
+    ASSERT_EQ(api->GetToBuffer("tenant/keyR", 1, 4, buffer.size(), 1000, buffer.data(), objectSize).GetCode(),
+              StatusCode::K_OUT_OF_RANGE);
+
+    // A missing version falls back to the latest one.
+    ASSERT_TRUE(api->GetToBuffer("tenant/keyR", 3, 0, buffer.size(), 1000, buffer.data(), objectSize).IsOk());
+    ASSERT_EQ(buffer, "value");
+    ASSERT_EQ(objectSize, 8ul);
+}
+
 TEST_F(SlotStoreTest, PersistenceApiAggregateSavePreservesWriteMode)
 {
     auto api = PersistenceApi::Create();
@@ -1036,6 +1065,146 @@ TEST_F(SlotStoreTest, SlotSaveUsesExclusiveDataFileForLargeObject)
     (void)RemoveAll(slotPath.substr(0, slotPath.find("/slot_large_object")));
 }
 
+TEST_F(SlotStoreTest, SlotSaveHidesUncommittedRecordAndPublishesInOrder)
+{
+    auto slotPath = MakeTempDir() + "/slot_ordered_commit";
+    Slot manager(15, slotPath, 1024 * 1024);
+    const auto payloadA = MakeSizedPayload(64 * 1024, 'A');
+    const auto payloadB = MakeSizedPayload(4 * 1024, 'B');
+
+    // The first save sleeps after its payload landed and before its record is published.
+    ASSERT_TRUE(inject::Set("slotstore.Slot.Save.BeforeCommit", "1*sleep(500)").IsOk());
+    auto saveA = std::async(std::launch::async, [&manager, &payloadA]() {
+        return manager.Save("tenant/keyOrderA", 1, MakeBody(payloadA));
+    });
+    while (inject::GetExecuteCount("slotstore.Slot.Save.BeforeCommit") == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto content = std::make_shared<std::stringstream>();
+    ASSERT_EQ(manager.Get("tenant/keyOrderA", 1, content).GetCode(), StatusCode::K_NOT_FOUND_IN_L2CACHE);
+
+    // The later reservation is written in parallel but only published after the earlier one.
+    ASSERT_TRUE(manager.Save("tenant/keyOrderB", 1, MakeBody(payloadB)).IsOk());
+    ExpectSlotValue(manager, "tenant/keyOrderA", 1, payloadA);
+    ExpectSlotValue(manager, "tenant/keyOrderB", 1, payloadB);
+    ASSERT_TRUE(saveA.get().IsOk());
+    ASSERT_TRUE(inject::Clear("slotstore.Slot.Save.BeforeCommit").IsOk());
+
+    SlotManifestData manifest;
+    ASSERT_TRUE(SlotManifest::Load(slotPath, manifest).IsOk());
+    std::vector<SlotRecord> records;
+    size_t validBytes = 0;
+    ASSERT_TRUE(SlotIndexCodec::ReadAllRecords(JoinPath(slotPath, manifest.activeIndex), records, validBytes).IsOk());
+    ASSERT_EQ(records.size(), 2u);
+    ASSERT_EQ(records[0].put.key, "tenant/keyOrderA");
+    ASSERT_EQ(records[1].put.key, "tenant/keyOrderB");
+    ASSERT_EQ(records[1].put.offset, records[0].put.offset + payloadA.size());
+    (void)RemoveAll(slotPath.substr(0, slotPath.find("/slot_ordered_commit")));
+}
+
+TEST_F(SlotStoreTest, SlotSaveFailedBeforeCommitReleasesTicket)
+{
+    auto slotPath = MakeTempDir() + "/slot_failed_commit";
+    Slot manager(15, slotPath, 1024 * 1024);
+    const auto payload = MakeSizedPayload(4 * 1024, 'F');
+
+    ASSERT_TRUE(inject::Set("slotstore.Slot.Save.BeforeCommit", "1*call()").IsOk());
+    ASSERT_EQ(manager.Save("tenant/keyFailed", 1, MakeBody(payload)).GetCode(), StatusCode::K_RUNTIME_ERROR);
+    ASSERT_TRUE(inject::Clear("slotstore.Slot.Save.BeforeCommit").IsOk());
+    auto content = std::make_shared<std::stringstream>();
+    ASSERT_EQ(manager.Get("tenant/keyFailed", 1, content).GetCode(), StatusCode::K_NOT_FOUND_IN_L2CACHE);
+
+    // The failed save gave its commit turn back, so the next one is not left waiting for it.
+    auto save = std::async(std::launch::async, [&manager, &payload]() {
+        return manager.Save("tenant/keyAfterFailed", 1, MakeBody(payload));
+    });
+    ASSERT_EQ(save.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    ASSERT_TRUE(save.get().IsOk());
+    ExpectSlotValue(manager, "tenant/keyAfterFailed", 1, payload);
+    (void)RemoveAll(slotPath.substr(0, slotPath.find("/slot_failed_commit")));
+}
+
+TEST_F(SlotStoreTest, SlotConcurrentSavesAcrossRotation)
+{
+    auto slotPath = MakeTempDir() + "/slot_concurrent_save";
+    constexpr size_t threadNum = 8;
+    constexpr size_t objectsPerThread = 64;
+    Slot manager(16, slotPath, 64 * 1024);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadNum; ++t) {
+        threads.emplace_back([&manager, t]() {
+            for (size_t i = 0; i < objectsPerThread; ++i) {
+                // Mix small appends with objects that need an exclusive data file.
+                auto size = i % 16 == 0 ? 96 * 1024 : 1024 + i * 37;
+                auto payload = MakeSizedPayload(size, static_cast<char>('a' + (t + i) % 26));
+                ASSERT_TRUE(manager.Save("tenant/key_" + std::to_string(t) + "_" + std::to_string(i), 1,
+                                         MakeBody(payload))
+                                .IsOk());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    SlotManifestData manifest;
+    ASSERT_TRUE(SlotManifest::Load(slotPath, manifest).IsOk());
+    ASSERT_GT(manifest.activeData.size(), 2u);
+    SlotSnapshot snapshot;
+    ASSERT_TRUE(manager.ReplayIndex(snapshot).IsOk());
+    for (size_t t = 0; t < threadNum; ++t) {
+        for (size_t i = 0; i < objectsPerThread; ++i) {
+            auto size = i % 16 == 0 ? 96 * 1024 : 1024 + i * 37;
+            ExpectSlotValue(manager, "tenant/key_" + std::to_string(t) + "_" + std::to_string(i), 1,
+                            MakeSizedPayload(size, static_cast<char>('a' + (t + i) % 26)));
+            SlotSnapshotValue value;
+            ASSERT_TRUE(
+                snapshot.FindExact("tenant/key_" + std::to_string(t) + "_" + std::to_string(i), 1, value).IsOk());
+        }
+    }
+    (void)RemoveAll(slotPath.substr(0, slotPath.find("/slot_concurrent_save")));
+}
+
+TEST_F(SlotStoreTest, LEVEL1_SlotMultiWriterSaveThroughput)
+{
+    const auto oldSyncIntervalMs = FLAGS_distributed_disk_sync_interval_ms;
+    const auto oldSyncBatchBytes = FLAGS_distributed_disk_sync_batch_bytes;
+    FLAGS_distributed_disk_sync_interval_ms = 1000;
+    FLAGS_distributed_disk_sync_batch_bytes = 32ul * 1024 * 1024;
+    constexpr size_t payloadSize = 256 * 1024;
+    constexpr size_t totalObjects = 1024;
+    const auto payload = MakeSizedPayload(payloadSize, 'T');
+    auto baseDir = MakeTempDir();
+
+    for (size_t writers : { 1ul, 2ul, 4ul, 8ul }) {
+        auto slotPath = baseDir + "/slot_writers_" + std::to_string(writers);
+        Slot manager(17, slotPath, 64ul * 1024 * 1024);
+        std::atomic<size_t> nextObject{ 0 };
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < writers; ++t) {
+            threads.emplace_back([&manager, &nextObject, &payload]() {
+                for (auto i = nextObject.fetch_add(1); i < totalObjects; i = nextObject.fetch_add(1)) {
+                    ASSERT_TRUE(manager.Save("tenant/bench_" + std::to_string(i), 1, MakeBody(payload)).IsOk());
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        ASSERT_TRUE(manager.Seal("bench").IsOk());
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "slot save, writers=" << writers << ": " << totalObjects / seconds << " ops/s, "
+                  << static_cast<double>(totalObjects * payloadSize) / seconds / (1024.0 * 1024) << " MiB/s"
+                  << std::endl;
+        ExpectSlotValue(manager, "tenant/bench_" + std::to_string(totalObjects - 1), 1, payload);
+    }
+
+    FLAGS_distributed_disk_sync_interval_ms = oldSyncIntervalMs;
+    FLAGS_distributed_disk_sync_batch_bytes = oldSyncBatchBytes;
+    (void)RemoveAll(baseDir);
+}
+
 TEST_F(SlotStoreTest, SlotSaveRejectsNullBody)
 {
     auto slotPath = MakeTempDir() + "/slot_null_body";
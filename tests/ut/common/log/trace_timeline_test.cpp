@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Test the sampled request timeline.
+ */
+#include "datasystem/common/log/trace_timeline.h"
+
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "ut/common.h"
+#include "datasystem/common/flags/flags.h"
+#include "datasystem/common/log/latency_phase.h"
+#include "datasystem/common/util/format.h"
+
+DS_DECLARE_double(trace_timeline_sample_rate);
+DS_DECLARE_string(trace_timeline_export_dir);
+
+namespace datasystem {
+namespace ut {
+class TraceTimelineTest : public CommonTest {
+protected:
+    void SetUp() override
+    {
+        CommonTest::SetUp();
+        Trace::Instance().Invalidate();
+        TraceTimeline::Instance().Clear();
+        FLAGS_trace_timeline_sample_rate = 1;
+    }
+
+    void TearDown() override
+    {
+        FLAGS_trace_timeline_sample_rate = 0;
+        Trace::Instance().Invalidate();
+        CommonTest::TearDown();
+    }
+};
+
+TEST_F(TraceTimelineTest, TestSampledTicksExportAsSpans)
+{
+    auto guard = Trace::Instance().SetTraceNewID("timeline-trace-1");
+    Trace::Instance().AddLatencyTick(LatencyTickKey::CLIENT_GET_START);
+    Trace::Instance().AddLatencyTick(LatencyTickKey::CLIENT_GET_RPC_START);
+    {
+        // Ticks of the sub requests belong to the request.
+        auto subGuard = Trace::Instance().SetSubTraceID("-sub");
+        Trace::Instance().AddLatencyTick(LatencyTickKey::WORKER_QUERYMETA_START);
+    }
+    std::thread([]() {
+        auto guard = Trace::Instance().SetTraceNewID("timeline-trace-1");
+        Trace::Instance().AddLatencyTick(LatencyTickKey::WORKER_QUERYMETA_END);
+    }).join();
+    Trace::Instance().AddLatencyTick(LatencyTickKey::CLIENT_GET_RPC_END);
+    Trace::Instance().AddLatencyTick(LatencyTickKey::CLIENT_GET_START);
+
+    auto events = TraceTimeline::Instance().Collect("timeline-trace-1");
+    ASSERT_EQ(events.size(), 6ul);
+    for (size_t i = 1; i < events.size(); ++i) {
+        ASSERT_GE(events[i].tick, events[i - 1].tick);
+    }
+    auto json = TraceTimeline::Instance().ExportChromeTrace("timeline-trace-1");
+    ASSERT_NE(json.find("\"name\":\"CLIENT_GET_RPC\",\"cat\":\"latency\",\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"WORKER_QUERYMETA\",\"cat\":\"latency\",\"ph\":\"X\""), std::string::npos);
+    // The two get starts have no end.
+    ASSERT_NE(json.find("\"name\":\"CLIENT_GET_START\",\"cat\":\"latency\",\"ph\":\"i\""), std::string::npos);
+    ASSERT_NE(json.find("\"trace_id\":\"timeline-trace-1\""), std::string::npos);
+    ASSERT_EQ(json.find("-sub"), std::string::npos);
+    ASSERT_TRUE(TraceTimeline::Instance().Collect("timeline-trace-2").empty());
+
+    TraceTimeline::Instance().Clear();
+    ASSERT_TRUE(TraceTimeline::Instance().Collect("timeline-trace-1").empty());
+}
+
+TEST_F(TraceTimelineTest, TestSamplingFollowsTraceID)
+{
+    FLAGS_trace_timeline_sample_rate = 0.5;
+    size_t sampled = 0;
+    const size_t total = 1000;
+    for (size_t i = 0; i < total; ++i) {
+        auto traceID = "trace-" + std::to_string(i);
+        bool first = TraceTimeline::IsSampled(traceID.data(), traceID.size());
+        ASSERT_EQ(first, TraceTimeline::IsSampled(traceID.data(), traceID.size()));
+        sampled += first ? 1 : 0;
+    }
+    ASSERT_GT(sampled, total / 4);
+    ASSERT_LT(sampled, total * 3 / 4);
+
+    FLAGS_trace_timeline_sample_rate = 0;
+    ASSERT_FALSE(TraceTimeline::IsEnabled());
+    auto guard = Trace::Instance().SetTraceNewID("timeline-trace-off");
+    Trace::Instance().AddLatencyTick(LatencyTickKey::CLIENT_GET_START);
+    ASSERT_TRUE(TraceTimeline::Instance().Collect("timeline-trace-off").empty());
+}
+
+TEST_F(TraceTimelineTest, TestSampledRequestIgnoresSlowLogGate)
+{
+    // Neither a slow log threshold nor the access log asks for the ticks, the timeline still does.
+    LatencyTraceConfig config;
+    Trace::Instance().SetAccessShouldRecord(false);
+    auto guard = Trace::Instance().SetTraceNewID("timeline-trace-gate");
+    ASSERT_TRUE(Trace::Instance().IsTimelineSampled());
+    ASSERT_TRUE(ShouldCollectLatencyTrace(config));
+
+    FLAGS_trace_timeline_sample_rate = 0;
+    ASSERT_FALSE(Trace::Instance().IsTimelineSampled());
+    ASSERT_FALSE(ShouldCollectLatencyTrace(config));
+    Trace::Instance().SetAccessShouldRecord(true);
+}
+
+TEST_F(TraceTimelineTest, TestExportToConfiguredDir)
+{
+    const std::string path = FormatString("%s/trace_timeline_%d.json", GetTestCaseDataDir(), getpid());
+    auto guard = Trace::Instance().SetTraceNewID("timeline-trace-export");
+    Trace::Instance().AddLatencyTick(LatencyTickKey::CLIENT_GET_START);
+    Trace::Instance().AddLatencyTick(LatencyTickKey::CLIENT_GET_END);
+
+    // Nothing is written until the directory is set.
+    DS_ASSERT_OK(TraceTimeline::Instance().ExportToConfiguredDir());
+    ASSERT_FALSE(std::ifstream(path).good());
+
+    FLAGS_trace_timeline_export_dir = GetTestCaseDataDir();
+    DS_ASSERT_OK(TraceTimeline::Instance().ExportToConfiguredDir());
+    FLAGS_trace_timeline_export_dir = "";
+    std::ifstream file(path);
+    ASSERT_TRUE(file.good());
+    std::stringstream content;
+    content << file.rdbuf();
+    ASSERT_NE(content.str().find("\"trace_id\":\"timeline-trace-export\""), std::string::npos);
+    ASSERT_NE(content.str().find("\"name\":\"CLIENT_GET\",\"cat\":\"latency\",\"ph\":\"X\""),
+              std::string::npos);
+}
+}  // namespace ut
+}  // namespace datasystem
@@ -17,6 +17,12 @@
 #include "datasystem/common/metrics/json_lines_exporter.h"
 #include "datasystem/common/metrics/metrics.h"
 #include "datasystem/common/metrics/kv_metrics.h"
+#include "datasystem/common/metrics/open_metrics_server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #include <algorithm>
 #include <atomic>
@@ -41,6 +47,7 @@ DS_DECLARE_bool(log_monitor);
 DS_DECLARE_bool(json_log_monitor);
 DS_DECLARE_int32(log_monitor_interval_ms);
 DS_DECLARE_string(log_dir);
+DS_DECLARE_string(metrics_http_address);
 
 namespace datasystem {
 namespace ut {
@@ -155,10 +162,55 @@ std::string HistogramMetricJson(const std::string &name, uint64_t totalCount, ui
     return os.str();
 }
 
+int GetFreePort()
+{
+    int sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (sock < 0) {
+        return 0;
+    }
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    int port = 0;
+    if (bind(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0
+        && getsockname(sock, reinterpret_cast<sockaddr *>(&addr), &len) == 0) {
+        port = ntohs(addr.sin_port);
+    }
+    close(sock);
+    return port;
+}
+
+// Send one raw request to the metrics endpoint and read the response until the server closes the connection.
+std::string HttpExchange(int port, const std::string &request)
+{
+    int sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (sock < 0) {
+        return "";
+    }
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    std::string response;
+    if (connect(sock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0
+        && send(sock, request.data(), request.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(request.size())) {
+        char buf[4096];
+        ssize_t n;
+        while ((n = recv(sock, buf, sizeof(buf), 0)) > 0) {
+            response.append(buf, static_cast<size_t>(n));
+        }
+    }
+    close(sock);
+    return response;
+}
+
 class MetricsTest : public CommonTest {
 public:
     void TearDown() override
     {
+        OpenMetricsServer::Instance().Stop();
+        FLAGS_metrics_http_address = "";
         metrics::ResetKvMetricsForTest();
         metrics::ResetForTest();
         FLAGS_log_monitor = true;
@@ -1514,5 +1566,76 @@ TEST_F(MetricsTest, worker_create_allocated_bytes_counter_test)
     EXPECT_NE(metrics::DumpSummaryForTest().find(ScalarMetricJson("worker_create_allocated_bytes", 2048, 2048)),
               std::string::npos);
 }
+
+TEST_F(MetricsTest, open_metrics_render_test)
+{
+    InitMetrics();
+    metrics::GetCounter(COUNTER_ID).Inc(3);
+    metrics::GetGauge(GAUGE_ID).Set(-4);
+    metrics::GetHistogram(HISTOGRAM_ID).Observe(10);
+    metrics::GetHistogram(HISTOGRAM_ID).Observe(30);
+    auto text = metrics::RenderOpenMetrics();
+    EXPECT_NE(text.find("# TYPE datasystem_test_counter counter\ndatasystem_test_counter_total 3\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("# TYPE datasystem_test_gauge gauge\ndatasystem_test_gauge -4\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE datasystem_test_histogram histogram\n"), std::string::npos);
+    EXPECT_NE(text.find("datasystem_test_histogram_bucket{le=\"+Inf\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("datasystem_test_histogram_sum 40\n"), std::string::npos);
+    EXPECT_NE(text.find("datasystem_test_histogram_count 2\n"), std::string::npos);
+}
+
+TEST_F(MetricsTest, open_metrics_counter_suffix_test)
+{
+    InitKvMetricsForTest();
+    METRIC_INC(metrics::KvMetricId::CLIENT_CREATE_REQUEST_TOTAL);
+    auto text = OpenMetricsServer::Instance().Render();
+    EXPECT_NE(text.find("# TYPE datasystem_client_create_request counter\n"
+                        "datasystem_client_create_request_total 1\n"),
+              std::string::npos);
+    EXPECT_EQ(text.find("_total_total"), std::string::npos);
+    ASSERT_GE(text.size(), 6ul);
+    EXPECT_EQ(text.substr(text.size() - 6), "# EOF\n");
+}
+
+TEST_F(MetricsTest, open_metrics_http_scrape_test)
+{
+    InitKvMetricsForTest();
+    METRIC_INC(metrics::KvMetricId::CLIENT_CREATE_REQUEST_TOTAL);
+    int port = GetFreePort();
+    ASSERT_GT(port, 0);
+    FLAGS_metrics_http_address = "127.0.0.1:" + std::to_string(port);
+    DS_ASSERT_OK(OpenMetricsServer::Instance().Start());
+
+    auto response = HttpExchange(port, "GET /metrics HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n");
+    auto headerEnd = response.find("\r\n\r\n");
+    ASSERT_NE(headerEnd, std::string::npos) << response;
+    auto headers = response.substr(0, headerEnd + 2);
+    auto body = response.substr(headerEnd + 4);
+    EXPECT_EQ(headers.rfind("HTTP/1.1 200 OK\r\n", 0), 0ul) << headers;
+    EXPECT_NE(headers.find("\r\nContent-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"),
+              std::string::npos)
+        << headers;
+    EXPECT_NE(headers.find("\r\nContent-Length: " + std::to_string(body.size()) + "\r\n"), std::string::npos)
+        << headers;
+    EXPECT_NE(body.find("# TYPE datasystem_client_create_request counter\n"
+                        "datasystem_client_create_request_total 1\n"),
+              std::string::npos);
+    ASSERT_GE(body.size(), 6ul);
+    EXPECT_EQ(body.substr(body.size() - 6), "# EOF\n");
+    // Every line is a comment or a sample, each terminated by a newline.
+    std::istringstream lines(body);
+    std::string line;
+    while (std::getline(lines, line)) {
+        ASSERT_FALSE(line.empty());
+        if (line[0] != '#') {
+            EXPECT_NE(line.find(' '), std::string::npos) << line;
+        }
+    }
+
+    response = HttpExchange(port, "GET /other HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n");
+    EXPECT_EQ(response.rfind("HTTP/1.1 404 Not Found\r\n", 0), 0ul) << response;
+    response = HttpExchange(port, "POST /metrics HTTP/1.1\r\nHost: 127.0.0.1\r\nContent-Length: 0\r\n\r\n");
+    EXPECT_EQ(response.rfind("HTTP/1.1 405 Method Not Allowed\r\n", 0), 0ul) << response;
+}
 }  // namespace ut
 }  // namespace datasystem
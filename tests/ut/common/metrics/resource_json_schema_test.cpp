@@ -145,5 +145,15 @@ TEST_F(ResourceJsonSchemaTest, DeferredCleanupQueueSizeGroup)
     EXPECT_EQ(desc.fieldNames[0], std::string("queue_size"));
     EXPECT_TRUE(desc.recordGroup);
 }
+
+TEST_F(ResourceJsonSchemaTest, SharedMemoryHugePageFields)
+{
+    const auto &desc = GetResourceFieldDesc(ResMetricName::SHARED_MEMORY_HUGE_PAGE);
+    EXPECT_EQ(desc.groupName, std::string("shared_memory_huge_page"));
+    ASSERT_EQ(desc.fieldNames.size(), static_cast<size_t>(4));
+    EXPECT_EQ(desc.fieldNames[0], std::string("huge_page_size"));
+    EXPECT_EQ(desc.fieldNames[3], std::string("coverage_rate"));
+    EXPECT_TRUE(desc.recordGroup);
+}
 }  // namespace ut
 }  // namespace datasystem
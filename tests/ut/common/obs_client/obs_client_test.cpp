@@ -18,7 +18,17 @@
  * Description: OBS client test.
  */
 
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
 #include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "ut/common.h"
 #include "datasystem/common/encrypt/secret_manager.h"
@@ -29,11 +39,15 @@
 #include "datasystem/common/util/format.h"
 #include "datasystem/common/util/validator.h"
 #include "datasystem/common/util/random_data.h"
+#include "datasystem/common/util/wait_post.h"
 
 
 DS_DECLARE_string(encrypt_kit);
 DS_DECLARE_bool(enable_cloud_service_token_rotation);
 DS_DECLARE_string(log_dir);
+DS_DECLARE_string(obs_access_key);
+DS_DECLARE_string(obs_secret_key);
+DS_DECLARE_bool(obs_https_enabled);
 
 const int DEFAULT_TTL_SECOND = 86400;
 const std::string DEFAULT_PROJECT_ID = "mock_projectID";
@@ -46,6 +60,435 @@ namespace ut {
 class ObsClientTest : public CommonTest {
 };
 
+namespace {
+/**
+ * Serves one object over plain http on a keep-alive connection per thread, answering Range requests the way the
+ * chosen server flavour does. Any other path is answered with 404.
+ */
+class MockObsServer {
+public:
+    enum class RangeMode {
+        HONOR,             // 206 with Content-Range, 416 past the end.
+        IGNORE,            // 200 with the whole object.
+        NO_CONTENT_RANGE,  // 206 without Content-Range.
+        FAIL,              // 500 with an error document.
+    };
+
+    MockObsServer(std::string path, std::string object, RangeMode mode)
+        : path_(std::move(path)), object_(std::move(object)), mode_(mode)
+    {
+    }
+
+    ~MockObsServer()
+    {
+        Stop();
+    }
+
+    bool Start()
+    {
+        listenFd_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(addr);
+        const int backlog = 128;
+        if (listenFd_ < 0 || bind(listenFd_, reinterpret_cast<sockaddr *>(&addr), len) != 0
+            || listen(listenFd_, backlog) != 0 || getsockname(listenFd_, reinterpret_cast<sockaddr *>(&addr), &len) != 0) {
+            return false;
+        }
+        port_ = ntohs(addr.sin_port);
+        acceptThread_ = std::thread([this]() { AcceptLoop(); });
+        return true;
+    }
+
+    void Stop()
+    {
+        if (listenFd_ < 0) {
+            return;
+        }
+        stop_ = true;
+        shutdown(listenFd_, SHUT_RDWR);
+        acceptThread_.join();
+        close(listenFd_);
+        listenFd_ = -1;
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int fd : connFds_) {
+            shutdown(fd, SHUT_RDWR);
+        }
+        for (auto &thread : connThreads_) {
+            thread.join();
+        }
+        for (int fd : connFds_) {
+            close(fd);
+        }
+    }
+
+    std::string Endpoint() const
+    {
+        return "127.0.0.1:" + std::to_string(port_);
+    }
+
+    // GET requests of the object with a Range header.
+    size_t RangeGets() const
+    {
+        return rangeGets_;
+    }
+
+    // GET requests of the object without a Range header.
+    size_t PlainGets() const
+    {
+        return plainGets_;
+    }
+
+private:
+    void AcceptLoop()
+    {
+        while (!stop_) {
+            int fd = accept(listenFd_, nullptr, nullptr);
+            if (fd < 0) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            connFds_.push_back(fd);
+            connThreads_.emplace_back([this, fd]() { Serve(fd); });
+        }
+    }
+
+    static bool SendAll(int fd, const std::string &data)
+    {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                return false;
+            }
+            sent += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    // Finds "Range: bytes=first-last" in the request head.
+    static bool ParseRange(const std::string &head, uint64_t &first, uint64_t &last)
+    {
+        const std::string prefix = "\r\nrange: bytes=";
+        for (size_t pos = head.find("\r\n"); pos != std::string::npos; pos = head.find("\r\n", pos + 2)) {
+            if (strncasecmp(head.c_str() + pos, prefix.c_str(), prefix.size()) == 0) {
+                return sscanf(head.c_str() + pos + prefix.size(), "%lu-%lu", &first, &last) == 2;
+            }
+        }
+        return false;
+    }
+
+    std::string Respond(const std::string &head)
+    {
+        auto pathBegin = head.find(' ') + 1;
+        auto pathEnd = head.find(' ', pathBegin);
+        std::string path = head.substr(pathBegin, pathEnd - pathBegin);
+        if (head.compare(0, pathBegin, "GET ") != 0 || path != path_) {
+            return "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+        }
+        uint64_t first = 0;
+        uint64_t last = 0;
+        if (!ParseRange(head, first, last)) {
+            ++plainGets_;
+            return "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(object_.size()) + "\r\n\r\n" + object_;
+        }
+        ++rangeGets_;
+        if (mode_ == RangeMode::FAIL) {
+            const std::string error = "<Error><Code>InternalError</Code><Message>mock failure</Message></Error>";
+            return "HTTP/1.1 500 Internal Server Error\r\nContent-Length: " + std::to_string(error.size()) + "\r\n\r\n"
+                   + error;
+        }
+        if (mode_ == RangeMode::IGNORE) {
+            return "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(object_.size()) + "\r\n\r\n" + object_;
+        }
+        if (first >= object_.size()) {
+            return "HTTP/1.1 416 Range Not Satisfiable\r\nContent-Length: 0\r\n\r\n";
+        }
+        last = std::min<uint64_t>(last, object_.size() - 1);
+        std::string body = object_.substr(first, last - first + 1);
+        std::string response = "HTTP/1.1 206 Partial Content\r\nContent-Length: " + std::to_string(body.size()) + "\r\n";
+        if (mode_ == RangeMode::HONOR) {
+            response += FormatString("Content-Range: bytes %lu-%lu/%zu\r\n", first, last, object_.size());
+        }
+        return response + "\r\n" + body;
+    }
+
+    void Serve(int fd)
+    {
+        std::string buffer;
+        char chunk[4096];
+        while (!stop_) {
+            auto headEnd = buffer.find("\r\n\r\n");
+            if (headEnd == std::string::npos) {
+                ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+                if (n <= 0) {
+                    return;
+                }
+                buffer.append(chunk, n);
+                continue;
+            }
+            std::string head = buffer.substr(0, headEnd);
+            buffer.erase(0, headEnd + strlen("\r\n\r\n"));
+            if (!SendAll(fd, Respond(head))) {
+                return;
+            }
+        }
+    }
+
+    const std::string path_;
+    const std::string object_;
+    const RangeMode mode_;
+    int listenFd_{ -1 };
+    int port_{ 0 };
+    std::atomic<bool> stop_{ false };
+    std::atomic<size_t> rangeGets_{ 0 };
+    std::atomic<size_t> plainGets_{ 0 };
+    std::thread acceptThread_;
+    std::mutex mutex_;
+    std::vector<int> connFds_;
+    std::vector<std::thread> connThreads_;
+};
+}  // namespace
+
+class ObsClientDownloadTest : public CommonTest {
+public:
+    void SetUp() override
+    {
+        CommonTest::SetUp();
+        FLAGS_enable_cloud_service_token_rotation = false;
+        FLAGS_obs_https_enabled = false;
+        FLAGS_encrypt_kit = ENCRYPT_KIT_PLAINTEXT;
+        FLAGS_obs_access_key = "mock_access_key";
+        FLAGS_obs_secret_key = "mock_secret_key";
+    }
+
+    void TearDown() override
+    {
+        FLAGS_obs_access_key.clear();
+        FLAGS_obs_secret_key.clear();
+        CommonTest::TearDown();
+    }
+
+protected:
+    // An object of three full download parts and a short tail.
+    static std::string MakeObject(uint64_t size = 3 * PART_SIZE + 123)
+    {
+        std::string object(size, '\0');
+        for (uint64_t i = 0; i < size; ++i) {
+            object[i] = static_cast<char>('a' + i % 26);
+        }
+        return object;
+    }
+
+    std::string Download(MockObsServer &server)
+    {
+        ObsClient client(server.Endpoint(), BUCKET);
+        DS_EXPECT_OK(client.Init());
+        std::shared_ptr<std::stringstream> content;
+        DS_EXPECT_OK(client.Download(OBJECT, TIMEOUT_MS, content));
+        return content == nullptr ? std::string() : content->str();
+    }
+
+    Status DownloadToBuffer(MockObsServer &server, const std::string &object, uint64_t offset, std::string &buffer,
+                            uint64_t &objectSize)
+    {
+        ObsClient client(server.Endpoint(), BUCKET);
+        RETURN_IF_NOT_OK(client.Init());
+        return client.DownloadToBuffer(object, TIMEOUT_MS, offset, buffer.size(), buffer.data(), objectSize);
+    }
+
+    // Download the object with DownloadAsync(), or a range of it with DownloadRangeAsync() if size is not 0.
+    Status DownloadAsync(MockObsServer &server, std::string &content, uint64_t offset = 0, uint64_t size = 0)
+    {
+        ObsClient client(server.Endpoint(), BUCKET);
+        RETURN_IF_NOT_OK(client.Init());
+        WaitPost done;
+        Status rc;
+        auto callback = [&](const Status &downloadRc, const std::shared_ptr<std::stringstream> &stream) {
+            rc = downloadRc;
+            content = stream == nullptr ? std::string() : stream->str();
+            done.Set();
+        };
+        if (size == 0) {
+            RETURN_IF_NOT_OK(client.DownloadAsync(OBJECT, TIMEOUT_MS, callback));
+        } else {
+            RETURN_IF_NOT_OK(client.DownloadRangeAsync(OBJECT, TIMEOUT_MS, offset, size, callback));
+        }
+        done.Wait();
+        return rc;
+    }
+
+    static constexpr uint64_t PART_SIZE = 8 * 1024 * 1024;
+    static constexpr int64_t TIMEOUT_MS = 30'000;
+    const std::string BUCKET = "test";
+    const std::string OBJECT = "obj";
+    const std::string PATH = "/test/obj";
+};
+
+TEST_F(ObsClientDownloadTest, DownloadInParts)
+{
+    auto object = MakeObject();
+    MockObsServer server(PATH, object, MockObsServer::RangeMode::HONOR);
+    ASSERT_TRUE(server.Start());
+    ASSERT_EQ(Download(server), object);
+    EXPECT_EQ(server.RangeGets(), 4ul);
+    EXPECT_EQ(server.PlainGets(), 0ul);
+}
+
+TEST_F(ObsClientDownloadTest, DownloadUsesWholeObjectOfIgnoredRange)
+{
+    auto object = MakeObject();
+    MockObsServer server(PATH, object, MockObsServer::RangeMode::IGNORE);
+    ASSERT_TRUE(server.Start());
+    ASSERT_EQ(Download(server), object);
+    // The 200 reply already carries the object, no part is fetched again.
+    EXPECT_EQ(server.RangeGets(), 1ul);
+    EXPECT_EQ(server.PlainGets(), 0ul);
+}
+
+TEST_F(ObsClientDownloadTest, DownloadFallsBackWithoutContentRange)
+{
+    auto object = MakeObject();
+    MockObsServer server(PATH, object, MockObsServer::RangeMode::NO_CONTENT_RANGE);
+    ASSERT_TRUE(server.Start());
+    // Without the total size the first part must not be taken for the whole object.
+    ASSERT_EQ(Download(server), object);
+    EXPECT_EQ(server.RangeGets(), 1ul);
+    EXPECT_EQ(server.PlainGets(), 1ul);
+
+    auto small = MakeObject(PART_SIZE / 2);
+    MockObsServer smallServer(PATH, small, MockObsServer::RangeMode::NO_CONTENT_RANGE);
+    ASSERT_TRUE(smallServer.Start());
+    // A short first part ends the object, there is nothing left to fetch.
+    ASSERT_EQ(Download(smallServer), small);
+    EXPECT_EQ(smallServer.RangeGets(), 1ul);
+    EXPECT_EQ(smallServer.PlainGets(), 0ul);
+}
+
+TEST_F(ObsClientDownloadTest, DownloadToBufferInParts)
+{
+    auto object = MakeObject();
+    MockObsServer server(PATH, object, MockObsServer::RangeMode::HONOR);
+    ASSERT_TRUE(server.Start());
+    const uint64_t offset = 100;
+    std::string buffer(2 * PART_SIZE + 50, '\0');
+    uint64_t objectSize = 0;
+    DS_ASSERT_OK(DownloadToBuffer(server, OBJECT, offset, buffer, objectSize));
+    ASSERT_TRUE(buffer == object.substr(offset, buffer.size()));
+    EXPECT_EQ(objectSize, object.size());
+    EXPECT_EQ(server.RangeGets(), 3ul);
+
+    buffer.assign(object.size() - offset + 1, '\0');
+    ASSERT_EQ(DownloadToBuffer(server, OBJECT, offset, buffer, objectSize).GetCode(), K_OUT_OF_RANGE);
+}
+
+TEST_F(ObsClientDownloadTest, DownloadToBufferCutsRangeOutOfWholeObject)
+{
+    auto object = MakeObject();
+    MockObsServer server(PATH, object, MockObsServer::RangeMode::IGNORE);
+    ASSERT_TRUE(server.Start());
+    // The range starts in the second part and spans two parts, the 200 reply fills all of it.
+    const uint64_t offset = PART_SIZE + 7;
+    std::string buffer(PART_SIZE + 20, '\0');
+    uint64_t objectSize = 0;
+    DS_ASSERT_OK(DownloadToBuffer(server, OBJECT, offset, buffer, objectSize));
+    ASSERT_TRUE(buffer == object.substr(offset, buffer.size()));
+    EXPECT_EQ(objectSize, object.size());
+    EXPECT_EQ(server.RangeGets(), 1ul);
+    EXPECT_EQ(server.PlainGets(), 0ul);
+}
+
+TEST_F(ObsClientDownloadTest, DownloadToBufferKeepsErrorBodyOut)
+{
+    auto object = MakeObject(PART_SIZE / 2);
+    MockObsServer server(PATH, object, MockObsServer::RangeMode::FAIL);
+    ASSERT_TRUE(server.Start());
+    const std::string untouched(1024, 'x');
+    std::string buffer = untouched;
+    uint64_t objectSize = 0;
+    ASSERT_EQ(DownloadToBuffer(server, OBJECT, 0, buffer, objectSize).GetCode(), K_RUNTIME_ERROR);
+    ASSERT_EQ(buffer, untouched);
+
+    ASSERT_EQ(DownloadToBuffer(server, "missing", 0, buffer, objectSize).GetCode(), K_NOT_FOUND);
+    ASSERT_EQ(buffer, untouched);
+    EXPECT_EQ(objectSize, 0ul);
+}
+
+TEST_F(ObsClientDownloadTest, DownloadAsyncHandlesEveryRangeFlavour)
+{
+    auto object = MakeObject();
+    std::string content;
+    MockObsServer server(PATH, object, MockObsServer::RangeMode::HONOR);
+    ASSERT_TRUE(server.Start());
+    DS_ASSERT_OK(DownloadAsync(server, content));
+    ASSERT_TRUE(content == object);
+    EXPECT_EQ(server.RangeGets(), 4ul);
+
+    MockObsServer ignoreServer(PATH, object, MockObsServer::RangeMode::IGNORE);
+    ASSERT_TRUE(ignoreServer.Start());
+    DS_ASSERT_OK(DownloadAsync(ignoreServer, content));
+    ASSERT_TRUE(content == object);
+    EXPECT_EQ(ignoreServer.RangeGets(), 1ul);
+    EXPECT_EQ(ignoreServer.PlainGets(), 0ul);
+
+    MockObsServer noRangeServer(PATH, object, MockObsServer::RangeMode::NO_CONTENT_RANGE);
+    ASSERT_TRUE(noRangeServer.Start());
+    DS_ASSERT_OK(DownloadAsync(noRangeServer, content));
+    ASSERT_TRUE(content == object);
+    EXPECT_EQ(noRangeServer.RangeGets(), 1ul);
+    EXPECT_EQ(noRangeServer.PlainGets(), 1ul);
+
+    MockObsServer failServer(PATH, object, MockObsServer::RangeMode::FAIL);
+    ASSERT_TRUE(failServer.Start());
+    ASSERT_EQ(DownloadAsync(failServer, content).GetCode(), K_RUNTIME_ERROR);
+}
+
+TEST_F(ObsClientDownloadTest, DownloadRangeAsyncAcrossParts)
+{
+    auto object = MakeObject();
+    const uint64_t offset = PART_SIZE - 5;
+    const uint64_t size = PART_SIZE + 10;
+    std::string content;
+    MockObsServer server(PATH, object, MockObsServer::RangeMode::HONOR);
+    ASSERT_TRUE(server.Start());
+    DS_ASSERT_OK(DownloadAsync(server, content, offset, size));
+    ASSERT_TRUE(content == object.substr(offset, size));
+    // The range runs past the end of the object, the parts behind the end are empty.
+    DS_ASSERT_OK(DownloadAsync(server, content, 2 * PART_SIZE, 3 * PART_SIZE));
+    ASSERT_TRUE(content == object.substr(2 * PART_SIZE));
+
+    MockObsServer ignoreServer(PATH, object, MockObsServer::RangeMode::IGNORE);
+    ASSERT_TRUE(ignoreServer.Start());
+    DS_ASSERT_OK(DownloadAsync(ignoreServer, content, offset, size));
+    ASSERT_TRUE(content == object.substr(offset, size));
+}
+
+TEST_F(ObsClientDownloadTest, DownloadAsyncCallbackMayCallSyncApi)
+{
+    auto object = MakeObject();
+    MockObsServer server(PATH, object, MockObsServer::RangeMode::HONOR);
+    ASSERT_TRUE(server.Start());
+    ObsClient client(server.Endpoint(), BUCKET);
+    DS_ASSERT_OK(client.Init());
+    WaitPost done;
+    Status rc;
+    DS_ASSERT_OK(client.DownloadAsync(OBJECT, TIMEOUT_MS,
+                                      [&](const Status &downloadRc, const std::shared_ptr<std::stringstream> &) {
+                                          // The callback is off the event loop, so the synchronous download of the
+                                          // parts on that loop can not wait for itself.
+                                          std::shared_ptr<std::stringstream> content;
+                                          rc = downloadRc.IsError() ? downloadRc
+                                                                    : client.Download(OBJECT, TIMEOUT_MS, content);
+                                          if (rc.IsOk() && content->str() != object) {
+                                              rc = Status(K_RUNTIME_ERROR, "content differs");
+                                          }
+                                          done.Set();
+                                      }));
+    done.Wait();
+    DS_ASSERT_OK(rc);
+}
+
 class ObsClientTokenRotationTest : public CommonTest {
 public:
     void SetUp() override;
@@ -1,4 +1,11 @@
 #include <cerrno>
+#include <chrono>
+#include <memory>
+#include <netinet/in.h>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -29,4 +36,75 @@ TEST(UnixSockFdStatusTest, EpipeMapsToRpcUnavailableWithPrefix)
     EXPECT_NE(status.GetMsg().find("[TCP_CONNECT_RESET]"), std::string::npos);
 }
 
+namespace {
+// Receive size bytes from the peer of the zero copy sender.
+std::string RecvAll(const UnixSockFd &fd, size_t size)
+{
+    std::string out(size, 0);
+    EXPECT_TRUE(fd.Recv(out.data(), out.size(), true).IsOk());
+    return out;
+}
+}  // namespace
+
+TEST(UnixSockFdStatusTest, ZeroCopySendFallsBackOnUnixSocket)
+{
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+    UnixSockFd sender(fds[0]);
+    UnixSockFd receiver(fds[1]);
+    const std::string data(4096, 'z');
+    std::thread reader([&receiver, &data]() { EXPECT_EQ(RecvAll(receiver, data.size()), data); });
+    MemView buf(data.data(), data.size());
+    EXPECT_TRUE(sender.SendZeroCopy(buf, nullptr).IsOk());
+    reader.join();
+    // An EPOLLERR of a socket without zero copy is a real error.
+    uint32_t events = EPOLLERR;
+    EXPECT_FALSE(sender.FilterZeroCopyEvents(events));
+    EXPECT_EQ(events, static_cast<uint32_t>(EPOLLERR));
+    sender.Close();
+    receiver.Close();
+}
+
+TEST(UnixSockFdStatusTest, ZeroCopySendReleasesBufferOnCompletion)
+{
+    int listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(listenFd, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    ASSERT_EQ(bind(listenFd, reinterpret_cast<sockaddr *>(&addr), len), 0);
+    ASSERT_EQ(listen(listenFd, 1), 0);
+    ASSERT_EQ(getsockname(listenFd, reinterpret_cast<sockaddr *>(&addr), &len), 0);
+    int clientFd = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_EQ(connect(clientFd, reinterpret_cast<sockaddr *>(&addr), len), 0);
+    UnixSockFd sender(clientFd);
+    UnixSockFd receiver(accept(listenFd, nullptr, nullptr));
+    const size_t size = 8 * 1024 * 1024;
+    const int rounds = 2;
+    std::weak_ptr<std::string> sent;
+    for (int i = 0; i < rounds; ++i) {
+        auto data = std::make_shared<std::string>(size, static_cast<char>('q' + i));
+        sent = data;
+        std::thread reader([&receiver, expected = *data]() { EXPECT_EQ(RecvAll(receiver, expected.size()), expected); });
+        MemView buf(data->data(), data->size());
+        // The send does not wait for the completions, the buffer is held until they are reaped.
+        EXPECT_TRUE(sender.SendZeroCopy(buf, data).IsOk());
+        data.reset();
+        reader.join();
+    }
+    const int maxWaitMs = 5'000;
+    for (int waitedMs = 0; !sent.expired() && waitedMs < maxWaitMs; ++waitedMs) {
+        uint32_t events = EPOLLERR;
+        if (sender.FilterZeroCopyEvents(events)) {
+            EXPECT_EQ(events, 0u);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(sent.expired());
+    sender.Close();
+    receiver.Close();
+    close(listenFd);
+}
+
 }  // namespace datasystem
@@ -173,6 +173,36 @@ TEST_F(SfsClientTest, TestBigObject)
     ASSERT_EQ(info.size(), 0u);
 }
 
+TEST_F(SfsClientTest, TestDownloadRange)
+{
+    auto client = std::make_unique<SfsClient>(FLAGS_sfs_path);
+    DS_ASSERT_OK(client->Init());
+    int timeoutMs = 60000;
+    std::string objName = "object0/0";
+    size_t objectSize = 1024u * 1024u + 1u;
+    std::shared_ptr<std::stringstream> body = std::make_shared<std::stringstream>();
+    *body << rd_.GetRandomString(objectSize);
+    DS_ASSERT_OK(client->Upload(objName, timeoutMs, body));
+    const std::string data = body->str();
+
+    std::shared_ptr<std::stringstream> content = std::make_shared<std::stringstream>();
+    uint64_t offset = 4096;
+    uint64_t size = 65536;
+    DS_ASSERT_OK(client->DownloadRange(objName, timeoutMs, offset, size, content));
+    ASSERT_EQ(data.substr(offset, size), content->str());
+
+    // The range past the end of the object is cut.
+    offset = objectSize - 1;
+    DS_ASSERT_OK(client->DownloadRange(objName, timeoutMs, offset, size, content));
+    ASSERT_EQ(data.substr(offset), content->str());
+
+    DS_ASSERT_OK(client->DownloadRange(objName, timeoutMs, objectSize, size, content));
+    ASSERT_TRUE(content->str().empty());
+
+    std::vector<std::string> toDelete{ objName };
+    DS_ASSERT_OK(client->Delete(toDelete));
+}
+
 TEST_F(SfsClientTest, TestTimeOut)
 {
     auto client = std::make_unique<SfsClient>(FLAGS_sfs_path);
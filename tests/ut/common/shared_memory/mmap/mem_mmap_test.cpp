@@ -19,10 +19,13 @@
  */
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include "ut/common.h"
+#include "datasystem/common/flags/common_flags.h"
 #include "datasystem/common/shared_memory/mmap/allocation.h"
 #include "datasystem/common/shared_memory/mmap/mem_mmap.h"
+#include "datasystem/common/util/huge_page_util.h"
 #include "../../../../common/binmock/binmock.h"
 
 using namespace ::testing;
@@ -30,6 +33,12 @@ using namespace ::testing;
 namespace datasystem {
 namespace ut {
 class MemMmapTest : public CommonTest {
+public:
+    static uint64_t FileSize(int fd)
+    {
+        struct stat st {};
+        return fstat(fd, &st) == 0 ? static_cast<uint64_t>(st.st_size) : 0;
+    }
 };
 
 TEST_F(MemMmapTest, InitFailed)
@@ -39,8 +48,12 @@ TEST_F(MemMmapTest, InitFailed)
     }
     memory::MemMmap m;
     size_t sz = 1024;
-    // init with huge
-    DS_ASSERT_NOT_OK(m.Initialize(sz, true, true));
+    // init with huge, a size below one huge page is mapped with regular pages and is not grown to a whole page
+    memory::MemMmap hugeMmap;
+    DS_ASSERT_OK(hugeMmap.Initialize(sz, true, true));
+    ASSERT_EQ(hugeMmap.HugeTlbPageSize(), 0ul);
+    ASSERT_EQ(GetHugeTlbPageSize(hugeMmap.Fd()), 0ul);
+    ASSERT_EQ(FileSize(hugeMmap.Fd()), sz);
     BINEXPECT_CALL(&ftruncate, (_, _)).WillOnce(Return(-1));
     DS_ASSERT_NOT_OK(m.Initialize(sz));
     RELEASE_STUBS
@@ -52,6 +65,30 @@ TEST_F(MemMmapTest, InitFailed)
     (void)alloc;
 }
 
+TEST_F(MemMmapTest, HugeTlbFallbackKeepsRequestedSize)
+{
+    if (IsArmArchitecture()) {
+        GTEST_SKIP() << "Skipped on ARM architecture";
+    }
+    const uint32_t savedPageSizeMb = FLAGS_huge_tlb_page_size_mb;
+    const size_t sz = 4 * PMD_HUGE_PAGE_SIZE;
+    // x86 has no 512 MB huge pages, and the arena would be smaller than one anyway, so it falls back.
+    FLAGS_huge_tlb_page_size_mb = 512;
+    memory::MemMmap fallback;
+    DS_EXPECT_OK(fallback.Initialize(sz, false, true));
+    EXPECT_EQ(fallback.HugeTlbPageSize(), 0ul);
+    EXPECT_EQ(GetHugeTlbPageSize(fallback.Fd()), 0ul);
+    EXPECT_EQ(FileSize(fallback.Fd()), sz);
+
+    // With the system default page the arena is either backed by huge pages of exactly its size or falls back.
+    FLAGS_huge_tlb_page_size_mb = 0;
+    memory::MemMmap hugeMmap;
+    DS_EXPECT_OK(hugeMmap.Initialize(sz, false, true));
+    EXPECT_EQ(hugeMmap.HugeTlbPageSize(), GetHugeTlbPageSize(hugeMmap.Fd()));
+    EXPECT_EQ(FileSize(hugeMmap.Fd()), sz);
+    FLAGS_huge_tlb_page_size_mb = savedPageSizeMb;
+}
+
 TEST_F(MemMmapTest, CommitFailed)
 {
     if (IsArmArchitecture()) {
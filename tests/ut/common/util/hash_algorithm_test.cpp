@@ -36,6 +36,27 @@ TEST_F(HashAlgorithmTest, ExampleHash)
     EXPECT_EQ(MurmurHash3_32(reinterpret_cast<const uint8_t *>(data.data()), data.size(), 1234), 3628035857u);
 }
 
+TEST_F(HashAlgorithmTest, BatchHashMatchesScalarHash)
+{
+    const size_t maxLen = 41;
+    std::vector<std::string> keys;
+    for (size_t len = 0; len < maxLen; ++len) {
+        // Mix lengths so that the lanes of a group stop at different blocks.
+        keys.emplace_back(len, static_cast<char>('a' + len % 26));
+        keys.emplace_back("kv-cache-layer-" + std::to_string(len * 7919));
+    }
+    std::vector<uint32_t> hashes(keys.size());
+    for (size_t count : { keys.size(), size_t{ 3 }, size_t{ 0 } }) {
+        MurmurHash3_32Batch(keys.data(), count, hashes.data());
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(hashes[i], MurmurHash3_32(keys[i])) << keys[i];
+        }
+    }
+    std::string data = "string-of-any-length";
+    MurmurHash3_32Batch(&data, 1, hashes.data());
+    EXPECT_EQ(hashes[0], 3643825436u);
+}
+
 TEST_F(HashAlgorithmTest, RedirectInject)
 {
     const uint32_t node0_redirect = 116852666;
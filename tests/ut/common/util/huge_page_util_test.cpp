@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Test huge page utility.
+ */
+#include "datasystem/common/util/huge_page_util.h"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "ut/common.h"
+
+namespace datasystem {
+namespace ut {
+class HugePageUtilTest : public CommonTest {};
+
+TEST_F(HugePageUtilTest, ParseSmapsRollup)
+{
+    const std::string content =
+        "00400000-7fffffffffff ---p 00000000 00:00 0                [rollup]\n"
+        "Rss:              204800 kB\n"
+        "ShmemPmdMapped:    40960 kB\n"
+        "Shared_Hugetlb:    65536 kB\n"
+        "Private_Hugetlb:    2048 kB\n";
+    HugePageUsage usage;
+    ParseHugePageUsage(content, usage);
+    ASSERT_EQ(usage.hugeTlbBytes, (65536ul + 2048ul) * 1024);
+    ASSERT_EQ(usage.shmemPmdMappedBytes, 40960ul * 1024);
+
+    ParseHugePageUsage("Rss: 4 kB\n", usage);
+    ASSERT_EQ(usage.hugeTlbBytes, 0ul);
+    ASSERT_EQ(usage.shmemPmdMappedBytes, 0ul);
+}
+
+TEST_F(HugePageUtilTest, MemfdFlags)
+{
+    const uint64_t oneGb = 1024ul * 1024 * 1024;
+    unsigned int flags = 0;
+    ASSERT_EQ(GetHugeTlbMemfdFlags(3 * PMD_HUGE_PAGE_SIZE, flags).GetCode(), StatusCode::K_INVALID);
+#if defined(MFD_HUGETLB) && defined(MFD_HUGE_SHIFT)
+    DS_ASSERT_OK(GetHugeTlbMemfdFlags(0, flags));
+    ASSERT_EQ(flags, static_cast<unsigned int>(MFD_HUGETLB));
+    DS_ASSERT_OK(GetHugeTlbMemfdFlags(PMD_HUGE_PAGE_SIZE, flags));
+    ASSERT_EQ(flags, static_cast<unsigned int>(MFD_HUGETLB | MFD_HUGE_2MB));
+    DS_ASSERT_OK(GetHugeTlbMemfdFlags(oneGb, flags));
+    ASSERT_EQ(flags, static_cast<unsigned int>(MFD_HUGETLB | MFD_HUGE_1GB));
+#else
+    (void)oneGb;
+#endif
+}
+
+TEST_F(HugePageUtilTest, MapRegularFdAligned)
+{
+    ASSERT_EQ(AlignUp(1, PMD_HUGE_PAGE_SIZE), PMD_HUGE_PAGE_SIZE);
+    ASSERT_EQ(AlignUp(PMD_HUGE_PAGE_SIZE, PMD_HUGE_PAGE_SIZE), PMD_HUGE_PAGE_SIZE);
+
+    int fd = static_cast<int>(syscall(__NR_memfd_create, "huge_page_util_test", 0));
+    ASSERT_GE(fd, 0);
+    const size_t length = 2 * PMD_HUGE_PAGE_SIZE;
+    ASSERT_EQ(ftruncate(fd, length), 0);
+    // A regular shmem file is not hugetlbfs, so a client must not map it with MAP_HUGETLB.
+    ASSERT_EQ(GetHugeTlbPageSize(fd), 0ul);
+    ASSERT_EQ(GetHugeTlbPageSize(-1), 0ul);
+
+    void *pointer = MmapAligned(length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, PMD_HUGE_PAGE_SIZE);
+    ASSERT_NE(pointer, MAP_FAILED);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(pointer) % PMD_HUGE_PAGE_SIZE, 0ul);
+    static_cast<char *>(pointer)[length - 1] = 'a';
+    ASSERT_EQ(munmap(pointer, length), 0);
+    close(fd);
+}
+}  // namespace ut
+}  // namespace datasystem
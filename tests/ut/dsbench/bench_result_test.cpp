@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Test the json result, merge and compare of dsbench.
+ */
+#include "bench_result.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+namespace datasystem {
+namespace bench {
+namespace {
+BenchResult MakeResult(double opsPerSec, uint64_t latencyUs, uint64_t count = 100)
+{
+    BenchResult result;
+    result.command = "kv";
+    result.action = "get";
+    result.clientNum = 1;
+    result.threadNum = 2;
+    result.opCount = count;
+    result.durationSec = 1.5;
+    result.opsPerSec = opsPerSec;
+    result.latency.Record(latencyUs, count);
+    return result;
+}
+}  // namespace
+
+class BenchResultTest : public ::testing::Test {
+protected:
+    void TearDown() override
+    {
+        for (const auto &path : paths_) {
+            (void)unlink(path.c_str());
+        }
+    }
+
+    std::string Write(const BenchResult &result)
+    {
+        std::string path = "/tmp/bench_result_test_" + std::to_string(getpid()) + "_" + std::to_string(paths_.size())
+                           + ".json";
+        EXPECT_TRUE(WriteBenchResult(path, result).IsOk());
+        paths_.emplace_back(path);
+        return path;
+    }
+
+    std::vector<std::string> paths_;
+};
+
+TEST_F(BenchResultTest, WriteAndLoad)
+{
+    auto path = Write(MakeResult(1000, 200));
+    BenchResult loaded;
+    ASSERT_TRUE(LoadBenchResults(path, loaded).IsOk());
+    EXPECT_EQ(loaded.command, "kv");
+    EXPECT_EQ(loaded.action, "get");
+    EXPECT_EQ(loaded.threadNum, 2ul);
+    EXPECT_EQ(loaded.opCount, 100ul);
+    EXPECT_DOUBLE_EQ(loaded.opsPerSec, 1000);
+    EXPECT_EQ(loaded.latency.Count(), 100ul);
+    EXPECT_EQ(loaded.latency.ValueAtPercentile(50), 200ul);
+}
+
+TEST_F(BenchResultTest, MergeAddsThroughputAndHistograms)
+{
+    auto first = Write(MakeResult(1000, 100, 90));
+    auto second = MakeResult(500, 5000, 10);
+    second.durationSec = 3;
+    auto secondPath = Write(second);
+    BenchResult merged;
+    ASSERT_TRUE(LoadBenchResults(first + "," + secondPath + ",", merged).IsOk());
+    EXPECT_DOUBLE_EQ(merged.opsPerSec, 1500);
+    EXPECT_EQ(merged.threadNum, 4ul);
+    EXPECT_EQ(merged.opCount, 100ul);
+    EXPECT_DOUBLE_EQ(merged.durationSec, 3);
+    EXPECT_EQ(merged.latency.Count(), 100ul);
+    EXPECT_EQ(merged.latency.ValueAtPercentile(90), 100ul);
+    // Values above 2048 keep three significant digits, so 5000 reads back within its bucket.
+    EXPECT_NEAR(merged.latency.ValueAtPercentile(95), 5000, 5);
+
+    auto other = MakeResult(1, 1);
+    other.action = "set";
+    BenchResult mismatched;
+    EXPECT_EQ(LoadBenchResults(first + "," + Write(other), mismatched).GetCode(), K_INVALID);
+    EXPECT_EQ(LoadBenchResults(",", mismatched).GetCode(), K_INVALID);
+    EXPECT_EQ(LoadBenchResults("/nonexistent/result.json", mismatched).GetCode(), K_INVALID);
+}
+
+TEST_F(BenchResultTest, CompareFlagsRegressionBeyondThreshold)
+{
+    auto base = MakeResult(1000, 1000);
+    // Within 10%: throughput -5%, latency +5%.
+    EXPECT_TRUE(CompareBenchResults(base, MakeResult(950, 1050), 10).IsOk());
+    // Throughput drop beyond the threshold.
+    EXPECT_EQ(CompareBenchResults(base, MakeResult(800, 1000), 10).GetCode(), K_RUNTIME_ERROR);
+    // Latency growth beyond the threshold.
+    EXPECT_EQ(CompareBenchResults(base, MakeResult(1000, 1500), 10).GetCode(), K_RUNTIME_ERROR);
+    // Improvements and a zero threshold never fail.
+    EXPECT_TRUE(CompareBenchResults(base, MakeResult(2000, 500), 10).IsOk());
+    EXPECT_TRUE(CompareBenchResults(base, MakeResult(100, 9000), 0).IsOk());
+}
+}  // namespace bench
+}  // namespace datasystem
@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Test the key distributions and the access trace loading of the dsbench kv workload.
+ */
+#include "kv/kv_workload.h"
+
+#include <unistd.h>
+
+#include <cmath>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+namespace datasystem {
+namespace bench {
+namespace {
+constexpr uint64_t KEY_NUM = 1000;
+constexpr size_t SAMPLE_NUM = 200'000;
+constexpr double ZIPF_THETA = 0.99;
+
+std::vector<size_t> Sample(const KeyChooser &chooser, uint64_t keyNum)
+{
+    std::mt19937_64 rng(20260101);
+    std::vector<size_t> counts(keyNum, 0);
+    for (size_t i = 0; i < SAMPLE_NUM; i++) {
+        auto index = chooser.Next(rng);
+        EXPECT_LT(index, keyNum);
+        if (index < keyNum) {
+            counts[index]++;
+        }
+    }
+    return counts;
+}
+
+double Share(const std::vector<size_t> &counts, size_t begin, size_t end)
+{
+    size_t sum = 0;
+    for (size_t i = begin; i < end; i++) {
+        sum += counts[i];
+    }
+    return static_cast<double>(sum) / SAMPLE_NUM;
+}
+
+// Probability mass of the ranks [begin, end) of a zipfian over keyNum keys.
+double ZipfShare(uint64_t keyNum, double theta, uint64_t begin, uint64_t end)
+{
+    double zetaN = 0;
+    double part = 0;
+    for (uint64_t i = 0; i < keyNum; i++) {
+        double p = 1.0 / std::pow(static_cast<double>(i + 1), theta);
+        zetaN += p;
+        if (i >= begin && i < end) {
+            part += p;
+        }
+    }
+    return part / zetaN;
+}
+
+class TraceFile {
+public:
+    explicit TraceFile(const std::vector<std::string> &lines)
+        : path_(::testing::TempDir() + "dsbench_trace_" + std::to_string(getpid()) + ".log")
+    {
+        std::ofstream out(path_);
+        for (const auto &line : lines) {
+            out << line << "\n";
+        }
+    }
+
+    ~TraceFile()
+    {
+        (void)unlink(path_.c_str());
+    }
+
+    const std::string &Path() const
+    {
+        return path_;
+    }
+
+private:
+    std::string path_;
+};
+
+// An access log line of a kv client request, completed at second 10 plus completeUs.
+std::string TraceLine(uint64_t completeUs, const std::string &handle, const std::string &elapsedUs,
+                      const std::string &dataSize, const std::string &keys)
+{
+    char timestamp[64];
+    (void)snprintf(timestamp, sizeof(timestamp), "2026-01-01T08:00:%02lu.%06lu", 10 + completeUs / 1'000'000,
+                   completeUs % 1'000'000);
+    return std::string(timestamp) + " | I | client.cpp:10 | pod | 1 | 0 | " + handle + " | " + elapsedUs + " | "
+           + dataSize + " | {Object_key:" + keys + "} | ";
+}
+}  // namespace
+
+TEST(KvWorkloadTest, CreateRejectsInvalidParams)
+{
+    std::unique_ptr<KeyChooser> chooser;
+    EXPECT_EQ(KeyChooser::Create("uniform", 0, ZIPF_THETA, 0.2, 0.8, chooser).GetCode(), K_INVALID);
+    EXPECT_EQ(KeyChooser::Create("zipfian", KEY_NUM, 0, 0.2, 0.8, chooser).GetCode(), K_INVALID);
+    EXPECT_EQ(KeyChooser::Create("latest", KEY_NUM, 1, 0.2, 0.8, chooser).GetCode(), K_INVALID);
+    EXPECT_EQ(KeyChooser::Create("hotspot", KEY_NUM, ZIPF_THETA, 0, 0.8, chooser).GetCode(), K_INVALID);
+    EXPECT_EQ(KeyChooser::Create("hotspot", KEY_NUM, ZIPF_THETA, 0.2, 1.5, chooser).GetCode(), K_INVALID);
+    EXPECT_EQ(KeyChooser::Create("gaussian", KEY_NUM, ZIPF_THETA, 0.2, 0.8, chooser).GetCode(), K_INVALID);
+}
+
+TEST(KvWorkloadTest, UniformSpreadsEvenly)
+{
+    std::unique_ptr<KeyChooser> chooser;
+    ASSERT_TRUE(KeyChooser::Create("uniform", KEY_NUM, ZIPF_THETA, 0.2, 0.8, chooser).IsOk());
+    auto counts = Sample(*chooser, KEY_NUM);
+    const double tolerance = 0.01;
+    for (size_t tenth = 0; tenth < 10; tenth++) {
+        EXPECT_NEAR(Share(counts, tenth * KEY_NUM / 10, (tenth + 1) * KEY_NUM / 10), 0.1, tolerance) << tenth;
+    }
+}
+
+TEST(KvWorkloadTest, ZipfianFollowsRankPower)
+{
+    std::unique_ptr<KeyChooser> chooser;
+    ASSERT_TRUE(KeyChooser::Create("zipfian", KEY_NUM, ZIPF_THETA, 0.2, 0.8, chooser).IsOk());
+    auto counts = Sample(*chooser, KEY_NUM);
+    // The two hottest ranks are drawn exactly, the tail through the Gray et al. approximation.
+    const double tolerance = 0.01;
+    EXPECT_NEAR(Share(counts, 0, 1), ZipfShare(KEY_NUM, ZIPF_THETA, 0, 1), tolerance);
+    EXPECT_NEAR(Share(counts, 1, 2), ZipfShare(KEY_NUM, ZIPF_THETA, 1, 2), tolerance);
+    EXPECT_NEAR(Share(counts, 0, 10), ZipfShare(KEY_NUM, ZIPF_THETA, 0, 10), 2 * tolerance);
+    EXPECT_NEAR(Share(counts, 0, 100), ZipfShare(KEY_NUM, ZIPF_THETA, 0, 100), 2 * tolerance);
+    EXPECT_NEAR(Share(counts, KEY_NUM / 2, KEY_NUM), ZipfShare(KEY_NUM, ZIPF_THETA, KEY_NUM / 2, KEY_NUM),
+                2 * tolerance);
+    EXPECT_GT(counts[0], counts[1]);
+    EXPECT_GT(counts[1], counts[10]);
+    EXPECT_GT(Share(counts, 10, 20), Share(counts, KEY_NUM - 10, KEY_NUM));
+}
+
+TEST(KvWorkloadTest, LatestFavorsNewestKeys)
+{
+    std::unique_ptr<KeyChooser> chooser;
+    ASSERT_TRUE(KeyChooser::Create("latest", KEY_NUM, ZIPF_THETA, 0.2, 0.8, chooser).IsOk());
+    auto counts = Sample(*chooser, KEY_NUM);
+    // The zipfian mirrored: the last written key is the hottest.
+    const double tolerance = 0.01;
+    EXPECT_NEAR(Share(counts, KEY_NUM - 1, KEY_NUM), ZipfShare(KEY_NUM, ZIPF_THETA, 0, 1), tolerance);
+    EXPECT_NEAR(Share(counts, KEY_NUM - 10, KEY_NUM), ZipfShare(KEY_NUM, ZIPF_THETA, 0, 10), 2 * tolerance);
+    EXPECT_EQ(std::max_element(counts.begin(), counts.end()) - counts.begin(), static_cast<long>(KEY_NUM - 1));
+    EXPECT_GT(Share(counts, KEY_NUM / 2, KEY_NUM), 2 * Share(counts, 0, KEY_NUM / 2));
+}
+
+TEST(KvWorkloadTest, HotspotKeepsHotFraction)
+{
+    const double hotKeyRatio = 0.2;
+    const double hotOpRatio = 0.8;
+    const uint64_t hotKeyNum = KEY_NUM * hotKeyRatio;
+    std::unique_ptr<KeyChooser> chooser;
+    ASSERT_TRUE(KeyChooser::Create("hotspot", KEY_NUM, ZIPF_THETA, hotKeyRatio, hotOpRatio, chooser).IsOk());
+    auto counts = Sample(*chooser, KEY_NUM);
+    const double tolerance = 0.01;
+    EXPECT_NEAR(Share(counts, 0, hotKeyNum), hotOpRatio, tolerance);
+    // Uniform inside each set.
+    EXPECT_NEAR(Share(counts, 0, hotKeyNum / 2), hotOpRatio / 2, tolerance);
+    EXPECT_NEAR(Share(counts, hotKeyNum, (hotKeyNum + KEY_NUM) / 2), (1 - hotOpRatio) / 2, tolerance);
+
+    // Every operation on the hot set, and a hot set of all keys.
+    ASSERT_TRUE(KeyChooser::Create("hotspot", KEY_NUM, ZIPF_THETA, hotKeyRatio, 1, chooser).IsOk());
+    EXPECT_DOUBLE_EQ(Share(Sample(*chooser, KEY_NUM), 0, hotKeyNum), 1);
+    ASSERT_TRUE(KeyChooser::Create("hotspot", KEY_NUM, ZIPF_THETA, 1, 0, chooser).IsOk());
+    EXPECT_NEAR(Share(Sample(*chooser, KEY_NUM), 0, KEY_NUM / 2), 0.5, tolerance);
+}
+
+TEST(KvWorkloadTest, LoadAccessTraceOrdersByIssueTime)
+{
+    TraceFile trace({
+        TraceLine(5000, "DS_KV_CLIENT_GET", "1000", "100", "key_b"),
+        TraceLine(2000, "DS_KV_CLIENT_SET", "500", "100", "key_a"),
+        TraceLine(9000, "DS_KV_CLIENT_MSET", "2000", "300", "[key_c,key_d,key_e,total:3]"),
+        TraceLine(9500, "DS_KV_CLIENT_DELETE", "100", "0", "key_a"),
+        TraceLine(9600, "DS_KV_CLIENT_EXIST", "100", "0", "[key_b,total:1]"),
+    });
+    std::vector<TraceOp> ops;
+    uint64_t truncatedNum = 1;
+    ASSERT_TRUE(LoadAccessTrace(trace.Path(), ops, truncatedNum).IsOk());
+    EXPECT_EQ(truncatedNum, 0ul);
+    ASSERT_EQ(ops.size(), 5ul);
+    // Issued at completion minus elapsed: 1500, 4000, 7000, 9400, 9500.
+    EXPECT_EQ(ops[0].type, TraceOpType::SET);
+    EXPECT_EQ(ops[0].offsetUs, 0ul);
+    EXPECT_EQ(ops[0].keys, std::vector<std::string>{ "key_a" });
+    EXPECT_EQ(ops[0].valueSize, 100ul);
+    EXPECT_EQ(ops[1].type, TraceOpType::GET);
+    EXPECT_EQ(ops[1].offsetUs, 2500ul);
+    EXPECT_EQ(ops[2].type, TraceOpType::SET);
+    EXPECT_EQ(ops[2].offsetUs, 5500ul);
+    EXPECT_EQ(ops[2].keys, (std::vector<std::string>{ "key_c", "key_d", "key_e" }));
+    EXPECT_EQ(ops[2].valueSize, 100ul);
+    EXPECT_EQ(ops[3].type, TraceOpType::DEL);
+    EXPECT_EQ(ops[3].offsetUs, 7900ul);
+    EXPECT_EQ(ops[4].type, TraceOpType::EXIST);
+    EXPECT_EQ(ops[4].keys, std::vector<std::string>{ "key_b" });
+}
+
+TEST(KvWorkloadTest, LoadAccessTraceSkipsMalformedLines)
+{
+    TraceFile trace({
+        "",
+        "not an access log line",
+        // Another client type.
+        TraceLine(1000, "DS_OBJECT_CLIENT_GET", "100", "10", "key_x"),
+        // Bad timestamp, elapsed time and key params.
+        "2026-01-01 08:00:10 | I | client.cpp:10 | pod | 1 | 0 | DS_KV_CLIENT_GET | 100 | 10 | {Object_key:key_x} | ",
+        TraceLine(1000, "DS_KV_CLIENT_GET", "slow", "10", "key_x"),
+        TraceLine(1000, "DS_KV_CLIENT_GET", "100", "10", ""),
+        TraceLine(1000, "DS_KV_CLIENT_MSET", "100", "10", "[key_x,key_y"),
+        // The handle name is the last field, nothing follows it.
+        "2026-01-01T08:00:10.000000 | DS_KV_CLIENT_GET",
+        // The recorder logged a few keys of a large batch, replaying them would change the request.
+        TraceLine(1000, "DS_KV_CLIENT_MSET", "100", "500", "[key_1,key_2,***,total:5]"),
+        TraceLine(3000, "DS_KV_CLIENT_GET", "200", "10", "key_ok"),
+    });
+    std::vector<TraceOp> ops;
+    uint64_t truncatedNum = 0;
+    ASSERT_TRUE(LoadAccessTrace(trace.Path(), ops, truncatedNum).IsOk());
+    EXPECT_EQ(truncatedNum, 1ul);
+    ASSERT_EQ(ops.size(), 1ul);
+    EXPECT_EQ(ops[0].keys, std::vector<std::string>{ "key_ok" });
+    EXPECT_EQ(ops[0].offsetUs, 0ul);
+}
+
+TEST(KvWorkloadTest, LoadAccessTraceWithoutReplayableRequestFails)
+{
+    std::vector<TraceOp> ops;
+    uint64_t truncatedNum = 0;
+    {
+        TraceFile trace({ TraceLine(1000, "DS_KV_CLIENT_MSET", "100", "500", "[key_1,***,total:3]") });
+        auto rc = LoadAccessTrace(trace.Path(), ops, truncatedNum);
+        EXPECT_EQ(rc.GetCode(), K_INVALID);
+        EXPECT_EQ(truncatedNum, 1ul);
+    }
+    EXPECT_EQ(LoadAccessTrace(::testing::TempDir() + "dsbench_no_such_trace.log", ops, truncatedNum).GetCode(),
+              K_INVALID);
+}
+}  // namespace bench
+}  // namespace datasystem
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Test the HDR style latency histogram of dsbench.
+ */
+#include "latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+namespace datasystem {
+namespace bench {
+namespace {
+// With 3 significant digits a recorded value may be reported up to 0.1% higher.
+void ExpectEquivalent(uint64_t actual, uint64_t expected)
+{
+    const double precision = 0.001;
+    EXPECT_GE(actual, expected);
+    EXPECT_LE(actual, expected + static_cast<uint64_t>(expected * precision) + 1);
+}
+}  // namespace
+
+TEST(LatencyHistogramTest, EmptyHistogram)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.Count(), 0ul);
+    EXPECT_EQ(histogram.ValueAtPercentile(50), 0ul);
+    EXPECT_EQ(histogram.Min(), 0ul);
+    EXPECT_EQ(histogram.Max(), 0ul);
+    EXPECT_EQ(histogram.Mean(), 0);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact)
+{
+    LatencyHistogram histogram;
+    const uint64_t valueNum = 1000;
+    for (uint64_t value = 1; value <= valueNum; value++) {
+        histogram.Record(value);
+    }
+    EXPECT_EQ(histogram.Count(), valueNum);
+    EXPECT_EQ(histogram.Min(), 1ul);
+    EXPECT_EQ(histogram.Max(), valueNum);
+    EXPECT_EQ(histogram.ValueAtPercentile(50), 500ul);
+    EXPECT_EQ(histogram.ValueAtPercentile(99), 990ul);
+    EXPECT_EQ(histogram.ValueAtPercentile(100), valueNum);
+    EXPECT_DOUBLE_EQ(histogram.Mean(), 500.5);
+}
+
+TEST(LatencyHistogramTest, LargeValuesKeepThreeDigits)
+{
+    LatencyHistogram histogram;
+    const uint64_t fast = 1'234;
+    const uint64_t slow = 98'765'432;
+    histogram.Record(fast, 99);
+    histogram.Record(slow);
+    ExpectEquivalent(histogram.ValueAtPercentile(99), fast);
+    ExpectEquivalent(histogram.ValueAtPercentile(99.9), slow);
+    ExpectEquivalent(histogram.Max(), slow);
+    // Values above one hour are clamped rather than dropped.
+    histogram.Record(UINT64_MAX);
+    EXPECT_EQ(histogram.Count(), 101ul);
+    ExpectEquivalent(histogram.Max(), 3600ul * 1000 * 1000);
+}
+
+TEST(LatencyHistogramTest, CorrectionBackFillsStalledSamples)
+{
+    LatencyHistogram histogram;
+    const uint64_t intervalUs = 100;
+    histogram.RecordCorrected(50, intervalUs);
+    EXPECT_EQ(histogram.Count(), 1ul);
+    // A 1000us stall hides the 9 requests that should have started every 100us.
+    histogram.RecordCorrected(1000, intervalUs);
+    EXPECT_EQ(histogram.Count(), 11ul);
+    EXPECT_EQ(histogram.Min(), 50ul);
+    EXPECT_EQ(histogram.ValueAtPercentile(20), 100ul);
+    // No correction without an interval.
+    histogram.RecordCorrected(1000, 0);
+    EXPECT_EQ(histogram.Count(), 12ul);
+}
+
+TEST(LatencyHistogramTest, MergeAndJsonRoundTrip)
+{
+    LatencyHistogram first;
+    LatencyHistogram second;
+    first.Record(10, 3);
+    second.Record(20'000, 2);
+    first.Merge(second);
+    EXPECT_EQ(first.Count(), 5ul);
+    EXPECT_EQ(first.ValueAtPercentile(60), 10ul);
+    ExpectEquivalent(first.ValueAtPercentile(80), 20'000);
+
+    LatencyHistogram loaded;
+    ASSERT_TRUE(LatencyHistogram::FromJson(first.ToJson(), loaded).IsOk());
+    EXPECT_EQ(loaded.Count(), first.Count());
+    EXPECT_EQ(loaded.ValueAtPercentile(80), first.ValueAtPercentile(80));
+    EXPECT_DOUBLE_EQ(loaded.Mean(), first.Mean());
+
+    auto json = first.ToJson();
+    json["significant_digits"] = 2;
+    EXPECT_EQ(LatencyHistogram::FromJson(json, loaded).GetCode(), K_INVALID);
+    json = first.ToJson();
+    json["counts"].push_back({ 1ul << 30, 1 });
+    EXPECT_EQ(LatencyHistogram::FromJson(json, loaded).GetCode(), K_INVALID);
+    EXPECT_EQ(LatencyHistogram::FromJson(nlohmann::json::object(), loaded).GetCode(), K_INVALID);
+}
+
+TEST(LatencyHistogramTest, PercentileDistributionEndsWithTotal)
+{
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 100; value++) {
+        histogram.Record(value * 1000);
+    }
+    auto text = histogram.PercentileDistribution(1000.0);
+    EXPECT_NE(text.find("1.000000000000        100"), std::string::npos) << text;
+    EXPECT_NE(text.find("Total count    =          100"), std::string::npos) << text;
+}
+}  // namespace bench
+}  // namespace datasystem
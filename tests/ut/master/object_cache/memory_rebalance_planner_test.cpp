@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Test the cluster-wide memory rebalance planner with round-based simulations.
+ */
+
+#include "datasystem/master/memory_rebalance_planner.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ut/common.h"
+
+using namespace datasystem::master;
+
+namespace datasystem {
+namespace ut {
+namespace {
+constexpr uint64_t NODE_LIMIT = 1'000;
+constexpr uint32_t SOURCE_USAGE_PERCENT = 80;
+constexpr uint32_t USAGE_GAP_PERCENT = 20;
+constexpr uint64_t ROUND_CAP = 100;
+constexpr size_t MAX_SIMULATION_ROUNDS = 100;
+
+MemoryRebalancePlanner::NodeLoad MakeLoad(const std::string &worker, uint64_t used, uint64_t limit = NODE_LIMIT)
+{
+    MemoryRebalancePlanner::NodeLoad load;
+    load.worker = worker;
+    load.usedMemory = used;
+    load.availableMemory = limit - used;
+    load.memoryLimit = limit;
+    load.canSend = true;
+    load.canReceive = true;
+    return load;
+}
+
+MemoryRebalancePlanner::Options MakeOptions(uint64_t roundCap = ROUND_CAP)
+{
+    MemoryRebalancePlanner::Options options;
+    options.sourceUsagePercent = SOURCE_USAGE_PERCENT;
+    options.usageGapPercent = USAGE_GAP_PERCENT;
+    options.maxOutBytesPerRound = roundCap;
+    options.maxInBytesPerRound = roundCap;
+    return options;
+}
+
+struct SimulationResult {
+    size_t rounds = 0;
+    uint64_t bytesMoved = 0;
+    size_t transfers = 0;
+    size_t maxTargetsPerRound = 0;
+    std::unordered_set<std::string> senders;
+    std::unordered_set<std::string> receivers;
+};
+
+uint64_t CeilDiv(uint64_t lhs, uint64_t rhs)
+{
+    return (lhs + rhs - 1) / rhs;
+}
+
+// Plan a round, check its per-node caps, then apply it as if every task finished before the next resource
+// report. Stops when the planner has nothing left to move.
+SimulationResult Simulate(std::vector<MemoryRebalancePlanner::NodeLoad> &nodes,
+                          const MemoryRebalancePlanner::Options &options)
+{
+    SimulationResult result;
+    for (size_t round = 0; round < MAX_SIMULATION_ROUNDS; ++round) {
+        auto transfers = MemoryRebalancePlanner::Plan(nodes, options);
+        if (transfers.empty()) {
+            return result;
+        }
+        ++result.rounds;
+        std::unordered_map<std::string, uint64_t> outBytes;
+        std::unordered_map<std::string, uint64_t> inBytes;
+        std::unordered_set<std::string> targets;
+        for (const auto &transfer : transfers) {
+            EXPECT_GT(transfer.bytes, 0ul);
+            EXPECT_NE(transfer.source, transfer.target);
+            outBytes[transfer.source] += transfer.bytes;
+            inBytes[transfer.target] += transfer.bytes;
+            targets.emplace(transfer.target);
+            result.senders.emplace(transfer.source);
+            result.receivers.emplace(transfer.target);
+            result.bytesMoved += transfer.bytes;
+        }
+        result.transfers += transfers.size();
+        result.maxTargetsPerRound = std::max(result.maxTargetsPerRound, targets.size());
+        for (auto &node : nodes) {
+            EXPECT_LE(outBytes[node.worker], options.maxOutBytesPerRound) << node.worker;
+            EXPECT_LE(inBytes[node.worker], options.maxInBytesPerRound) << node.worker;
+            node.usedMemory = node.usedMemory - outBytes[node.worker] + inBytes[node.worker];
+            node.availableMemory = node.memoryLimit - node.usedMemory;
+        }
+    }
+    ADD_FAILURE() << "Rebalance did not converge in " << MAX_SIMULATION_ROUNDS << " rounds";
+    return result;
+}
+
+uint64_t TotalUsed(const std::vector<MemoryRebalancePlanner::NodeLoad> &nodes)
+{
+    uint64_t total = 0;
+    for (const auto &node : nodes) {
+        total += node.usedMemory;
+    }
+    return total;
+}
+}  // namespace
+
+class MemoryRebalancePlannerTest : public CommonTest {};
+
+TEST_F(MemoryRebalancePlannerTest, ScaleOutDrainsEverySourceInBoundedRounds)
+{
+    // Eight full workers and eight new empty ones: the mean is 45%, and every source must drop below the
+    // source watermark by sending at most ROUND_CAP per round.
+    const size_t hotCount = 8;
+    const uint64_t hotUsed = 900;
+    std::vector<MemoryRebalancePlanner::NodeLoad> nodes;
+    for (size_t i = 0; i < hotCount; ++i) {
+        nodes.emplace_back(MakeLoad("hot-" + std::to_string(i), hotUsed));
+        nodes.emplace_back(MakeLoad("new-" + std::to_string(i), 0));
+    }
+    const uint64_t totalBefore = TotalUsed(nodes);
+    auto result = Simulate(nodes, MakeOptions());
+
+    const uint64_t watermark = NODE_LIMIT * SOURCE_USAGE_PERCENT / 100;
+    // A source stops once it is below the watermark, so each one sends just enough rounds to cross it.
+    const uint64_t roundsToCross = CeilDiv(hotUsed - watermark + 1, ROUND_CAP);
+    EXPECT_LE(result.rounds, roundsToCross);
+    EXPECT_EQ(result.bytesMoved, hotCount * roundsToCross * ROUND_CAP);
+    // All sources move in parallel rather than one source per round.
+    EXPECT_EQ(result.maxTargetsPerRound, hotCount);
+    EXPECT_EQ(TotalUsed(nodes), totalBefore);
+    for (const auto &node : nodes) {
+        EXPECT_LT(node.usedMemory, watermark) << node.worker;
+    }
+    LOG(INFO) << "scale-out rounds=" << result.rounds << " bytes_moved=" << result.bytesMoved
+              << " transfers=" << result.transfers;
+}
+
+TEST_F(MemoryRebalancePlannerTest, HotTenantBurstFansOutToManyTargets)
+{
+    // One worker fills up while the others sit at 30%. The hot worker spreads its surplus over several targets in
+    // the same round, each target capped by its own inbound budget.
+    std::vector<MemoryRebalancePlanner::NodeLoad> nodes{ MakeLoad("hot", 980) };
+    const size_t coldCount = 9;
+    for (size_t i = 0; i < coldCount; ++i) {
+        nodes.emplace_back(MakeLoad("cold-" + std::to_string(i), 300));
+    }
+    const uint64_t outCap = 400;
+    const uint64_t inCap = 50;
+    auto options = MakeOptions();
+    options.maxOutBytesPerRound = outCap;
+    options.maxInBytesPerRound = inCap;
+
+    auto transfers = MemoryRebalancePlanner::Plan(nodes, options);
+    ASSERT_EQ(transfers.size(), outCap / inCap);
+    for (const auto &transfer : transfers) {
+        EXPECT_EQ(transfer.source, "hot");
+        EXPECT_EQ(transfer.bytes, inCap);
+    }
+
+    auto result = Simulate(nodes, options);
+    EXPECT_EQ(result.senders, std::unordered_set<std::string>{ "hot" });
+    EXPECT_LT(nodes.front().usedMemory, NODE_LIMIT * SOURCE_USAGE_PERCENT / 100);
+    EXPECT_LE(result.rounds, 1ul);
+    LOG(INFO) << "hot-tenant rounds=" << result.rounds << " bytes_moved=" << result.bytesMoved
+              << " transfers=" << result.transfers;
+}
+
+TEST_F(MemoryRebalancePlannerTest, SkewedClusterNeverOvershootsTheMean)
+{
+    // A skewed cluster of heterogeneous workers. Nodes never swap roles, so the bytes moved stay below the total
+    // surplus over the fair share and no byte is moved twice.
+    std::vector<MemoryRebalancePlanner::NodeLoad> nodes{
+        MakeLoad("a", 1900, 2000), MakeLoad("b", 950), MakeLoad("c", 850),  MakeLoad("d", 820),
+        MakeLoad("e", 100),        MakeLoad("f", 50),  MakeLoad("g", 0, 500), MakeLoad("h", 400, 4000),
+    };
+    uint64_t totalLimit = 0;
+    for (const auto &node : nodes) {
+        totalLimit += node.memoryLimit;
+    }
+    const uint64_t totalUsed = TotalUsed(nodes);
+    uint64_t surplusOverMean = 0;
+    for (const auto &node : nodes) {
+        const uint64_t fairShare = node.memoryLimit * totalUsed / totalLimit;
+        surplusOverMean += node.usedMemory > fairShare ? node.usedMemory - fairShare : 0;
+    }
+
+    auto result = Simulate(nodes, MakeOptions(200));
+    EXPECT_GT(result.rounds, 0ul);
+    EXPECT_LE(result.bytesMoved, surplusOverMean);
+    for (const auto &sender : result.senders) {
+        EXPECT_EQ(result.receivers.count(sender), 0ul) << sender;
+    }
+    for (const auto &node : nodes) {
+        EXPECT_LT(MemoryRebalancePlanner::UsageRate(node.usedMemory, node.memoryLimit), SOURCE_USAGE_PERCENT)
+            << node.worker;
+    }
+    EXPECT_EQ(TotalUsed(nodes), totalUsed);
+    LOG(INFO) << "skewed rounds=" << result.rounds << " bytes_moved=" << result.bytesMoved
+              << " surplus_over_mean=" << surplusOverMean;
+}
+
+TEST_F(MemoryRebalancePlannerTest, RespectsInboundInflightAndEligibility)
+{
+    auto busySource = MakeLoad("busy-source", 950);
+    busySource.canSend = false;
+    auto source = MakeLoad("source", 950);
+    auto cooling = MakeLoad("cooling", 0);
+    cooling.canReceive = false;
+    auto target = MakeLoad("target", 300);
+    target.inboundBytes = 80;
+    std::vector<MemoryRebalancePlanner::NodeLoad> nodes{ busySource, source, cooling, target };
+
+    // mean = 2200 / 4000 = 55%; target may take 550 - 300 - 80 = 170, but only ROUND_CAP - 80 = 20 this round.
+    auto transfers = MemoryRebalancePlanner::Plan(nodes, MakeOptions());
+    ASSERT_EQ(transfers.size(), 1ul);
+    EXPECT_EQ(transfers[0].source, "source");
+    EXPECT_EQ(transfers[0].target, "target");
+    EXPECT_EQ(transfers[0].bytes, ROUND_CAP - target.inboundBytes);
+}
+
+TEST_F(MemoryRebalancePlannerTest, NoTransferBelowUsageGap)
+{
+    std::vector<MemoryRebalancePlanner::NodeLoad> nodes{ MakeLoad("a", 850), MakeLoad("b", 700),
+                                                         MakeLoad("c", 660) };
+    EXPECT_TRUE(MemoryRebalancePlanner::Plan(nodes, MakeOptions()).empty());
+    EXPECT_TRUE(MemoryRebalancePlanner::Plan({}, MakeOptions()).empty());
+}
+}  // namespace ut
+}  // namespace datasystem
@@ -43,6 +43,7 @@ DS_DECLARE_uint32(rebalance_usage_gap_percent);
 DS_DECLARE_uint32(rebalance_task_report_grace_ms);
 DS_DECLARE_uint32(data_migrate_rate_limit_mb);
 DS_DECLARE_uint32(node_dead_timeout_s);
+DS_DECLARE_bool(rebalance_global_plan);
 
 using namespace datasystem::master;
 
@@ -172,6 +173,7 @@ public:
         oldTaskTimeoutS_ = FLAGS_rebalance_task_report_grace_ms;
         oldDataMigrateRate_ = FLAGS_data_migrate_rate_limit_mb;
         oldNodeDeadTimeoutS_ = FLAGS_node_dead_timeout_s;
+        oldGlobalPlan_ = FLAGS_rebalance_global_plan;
 
         FLAGS_enable_memory_rebalance = true;
         FLAGS_rebalance_source_usage_percent = 80;
@@ -189,6 +191,7 @@ public:
         FLAGS_rebalance_task_report_grace_ms = oldTaskTimeoutS_;
         FLAGS_data_migrate_rate_limit_mb = oldDataMigrateRate_;
         FLAGS_node_dead_timeout_s = oldNodeDeadTimeoutS_;
+        FLAGS_rebalance_global_plan = oldGlobalPlan_;
         CommonTest::TearDown();
     }
 
@@ -276,6 +279,7 @@ private:
     uint32_t oldTaskTimeoutS_ = 0;
     uint32_t oldDataMigrateRate_ = 0;
     uint32_t oldNodeDeadTimeoutS_ = 0;
+    bool oldGlobalPlan_ = false;
 };
 
 // Contract test: the fixture's SetUp overrides FLAGS_rebalance_source_usage_percent to 80, so the
@@ -1454,5 +1458,72 @@ TEST_F(MemoryRebalanceSchedulerTest, FreshRemainAboveCapacityStopsChain)
         << "held must be kept when chain ends on capacity-guard stop for #685 protection";
 }
 
+// Global plan mode: two hot sources share two cold targets in one plan. Both sources get a task on their own
+// report, and a source whose first planned target is done is chained to its next planned target in ReportResult.
+TEST_F(MemoryRebalanceSchedulerTest, GlobalPlanPairsManySourcesWithManyTargets)
+{
+    FLAGS_rebalance_global_plan = true;
+    MemoryRebalanceScheduler scheduler;
+    const std::string source1 = "127.0.0.1:9000";
+    const std::string source2 = "127.0.0.1:8800";
+    const std::string target1 = "127.0.0.1:1000";
+    const std::string target2 = "127.0.0.1:1500";
+    auto snapshot = MakeSnapshot({
+        MakeNode(source1, 900, 100),
+        MakeNode(source2, 880, 120),
+        MakeNode(target1, 100, 900),
+        MakeNode(target2, 150, 850),
+    });
+    // mean = 2030 / 4000, fair share = 507: source1 sends 393 to target1, which leaves room for 14 from source2;
+    // source2 sends the rest of what target2 can take (357) to target2.
+    auto rsp1 = ScheduleAndGetRsp(scheduler, source1, snapshot);
+    ASSERT_TRUE(rsp1.has_rebalance_task());
+    EXPECT_EQ(rsp1.rebalance_task().target_worker(), target1);
+    EXPECT_EQ(rsp1.rebalance_task().max_bytes(), 393ul);
+
+    auto rsp2 = ScheduleAndGetRsp(scheduler, source2, snapshot);
+    ASSERT_TRUE(rsp2.has_rebalance_task());
+    EXPECT_EQ(rsp2.rebalance_task().target_worker(), target1);
+    EXPECT_EQ(rsp2.rebalance_task().max_bytes(), 14ul);
+
+    master::ReportRebalanceResultRspPb reportRsp;
+    DS_ASSERT_OK(scheduler.ReportResult(MakeFreshResultReq(rsp2.rebalance_task(), 400), reportRsp));
+    ASSERT_TRUE(reportRsp.has_next_rebalance_task());
+    const auto &nextTask = reportRsp.next_rebalance_task();
+    EXPECT_EQ(nextTask.source_worker(), source2);
+    EXPECT_EQ(nextTask.target_worker(), target2);
+    EXPECT_EQ(nextTask.max_bytes(), 357ul);
+
+    // The chained task ends the source's plan; no further task once it is done.
+    master::ReportRebalanceResultRspPb lastRsp;
+    DS_ASSERT_OK(scheduler.ReportResult(MakeFreshResultReq(nextTask, 400), lastRsp));
+    EXPECT_FALSE(lastRsp.has_next_rebalance_task());
+}
+
+// Global plan mode keeps the per-round inbound cap: with a tiny migration rate a target gets at most one cycle's
+// worth of bytes, and a rebuilt plan counts the bytes already in flight to it.
+TEST_F(MemoryRebalanceSchedulerTest, GlobalPlanRespectsPerWorkerRoundCap)
+{
+    FLAGS_rebalance_global_plan = true;
+    FLAGS_data_migrate_rate_limit_mb = 1;
+    constexpr uint64_t mb = 1024 * 1024;
+    constexpr uint64_t gb = 1024 * mb;
+    constexpr uint64_t roundCap = 30 * mb;  // 1 MiB/s for one 30s resource report cycle
+    MemoryRebalanceScheduler scheduler;
+    const std::string source1 = "127.0.0.1:9000";
+    const std::string source2 = "127.0.0.1:8800";
+    const std::string target = "127.0.0.1:1000";
+    auto snapshot = MakeSnapshot({
+        MakeNode(source1, 900 * mb, 124 * mb, true, gb, gb),
+        MakeNode(source2, 880 * mb, 144 * mb, true, gb, gb),
+        MakeNode(target, 0, gb, true, gb, gb),
+    });
+    auto rsp1 = ScheduleAndGetRsp(scheduler, source1, snapshot);
+    ASSERT_TRUE(rsp1.has_rebalance_task());
+    EXPECT_EQ(rsp1.rebalance_task().max_bytes(), roundCap);
+    auto rsp2 = ScheduleAndGetRsp(scheduler, source2, snapshot);
+    EXPECT_FALSE(rsp2.has_rebalance_task());
+}
+
 }  // namespace ut
 }  // namespace datasystem
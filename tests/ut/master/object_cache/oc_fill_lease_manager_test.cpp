@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Test fill lease manager class.
+ */
+#include "datasystem/master/object_cache/oc_fill_lease_manager.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ut/common.h"
+
+using namespace datasystem::master;
+namespace datasystem {
+namespace ut {
+class OCFillLeaseManagerTest : public CommonTest {};
+
+TEST_F(OCFillLeaseManagerTest, TestOnlyFirstCallerGranted)
+{
+    OCFillLeaseManager manager;
+    const std::string objectKey = "missing-object";
+    uint64_t remainingMs = 0;
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:1", "client-a", "token-a", 1000, 0, remainingMs),
+              FillLeaseAcquireResult::GRANTED);
+    ASSERT_EQ(remainingMs, 1000ul);
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:2", "client-b", "token-b", 1000, 400, remainingMs),
+              FillLeaseAcquireResult::BEING_FILLED);
+    ASSERT_EQ(remainingMs, 600ul);
+    // A live lease is not extended, not even for the call that holds it.
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:1", "client-a", "token-a", 1000, 500, remainingMs),
+              FillLeaseAcquireResult::BEING_FILLED);
+    ASSERT_EQ(remainingMs, 500ul);
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:2", "client-b", "token-b", 1000, 1000, remainingMs),
+              FillLeaseAcquireResult::GRANTED);
+}
+
+TEST_F(OCFillLeaseManagerTest, TestCallsOfOneClientDoNotShareLease)
+{
+    // Concurrent GetOrCreate calls of one client come through the same worker with the same client id.
+    OCFillLeaseManager manager;
+    const std::string objectKey = "missing-object";
+    uint64_t remainingMs = 0;
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:1", "client-a", "call-1", 1000, 0, remainingMs),
+              FillLeaseAcquireResult::GRANTED);
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:1", "client-a", "call-2", 1000, 10, remainingMs),
+              FillLeaseAcquireResult::BEING_FILLED);
+    ASSERT_EQ(remainingMs, 990ul);
+    ASSERT_FALSE(manager.ReleaseIfHeldBy(objectKey, "call-2"));
+    ASSERT_EQ(manager.Size(), 1ul);
+}
+
+TEST_F(OCFillLeaseManagerTest, TestTakeOverAfterExpired)
+{
+    OCFillLeaseManager manager;
+    const std::string objectKey = "missing-object";
+    uint64_t remainingMs = 0;
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:1", "client-a", "token-a", 100, 0, remainingMs),
+              FillLeaseAcquireResult::GRANTED);
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:2", "client-b", "token-b", 100, 100, remainingMs),
+              FillLeaseAcquireResult::GRANTED);
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:1", "client-a", "token-a", 100, 150, remainingMs),
+              FillLeaseAcquireResult::BEING_FILLED);
+    ASSERT_EQ(manager.EraseExpired(150), 0ul);
+    ASSERT_EQ(manager.EraseExpired(200), 1ul);
+    ASSERT_EQ(manager.Size(), 0ul);
+}
+
+TEST_F(OCFillLeaseManagerTest, TestRelease)
+{
+    OCFillLeaseManager manager;
+    uint64_t remainingMs = 0;
+    const int objectCount = 10;
+    for (int i = 0; i < objectCount; i++) {
+        auto address = i % 2 == 0 ? "127.0.0.1:1" : "127.0.0.1:2";
+        (void)manager.Acquire("object-" + std::to_string(i), address, "client", "token-" + std::to_string(i), 1000,
+                              0, remainingMs);
+    }
+    ASSERT_TRUE(manager.Release("object-1"));
+    ASSERT_FALSE(manager.Release("object-1"));
+    ASSERT_EQ(manager.ReleaseByAddress("127.0.0.1:1"), 5ul);
+    ASSERT_EQ(manager.Size(), 4ul);
+    ASSERT_EQ(manager.Acquire("object-0", "127.0.0.1:2", "client-b", "token-b", 1000, 0, remainingMs),
+              FillLeaseAcquireResult::GRANTED);
+}
+
+TEST_F(OCFillLeaseManagerTest, TestReleaseIfHeldBy)
+{
+    OCFillLeaseManager manager;
+    const std::string objectKey = "missing-object";
+    uint64_t remainingMs = 0;
+    ASSERT_EQ(manager.Acquire(objectKey, "127.0.0.1:1", "client-a", "token-a", 100, 0, remainingMs),
+              FillLeaseAcquireResult::GRANTED);
+    // A stale caller must not drop the lease somebody else took over.
+    ASSERT_FALSE(manager.ReleaseIfHeldBy(objectKey, "token-b"));
+    ASSERT_TRUE(manager.ReleaseIfHeldBy(objectKey, "token-a"));
+    ASSERT_FALSE(manager.ReleaseIfHeldBy(objectKey, "token-a"));
+    ASSERT_EQ(manager.Size(), 0ul);
+}
+
+TEST_F(OCFillLeaseManagerTest, TestParallelAcquire)
+{
+    OCFillLeaseManager manager;
+    const int threadCount = 8;
+    std::atomic<int> granted{ 0 };
+    std::vector<std::thread> threads;
+    for (int n = 0; n < threadCount; n++) {
+        threads.emplace_back([&manager, &granted, n]() {
+            uint64_t remainingMs = 0;
+            // Same worker and client, one token per call.
+            if (manager.Acquire("hot-object", "127.0.0.1:1", "client", "call-" + std::to_string(n), 1000, 0,
+                                remainingMs)
+                == FillLeaseAcquireResult::GRANTED) {
+                granted++;
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    ASSERT_EQ(granted.load(), 1);
+}
+}  // namespace ut
+}  // namespace datasystem
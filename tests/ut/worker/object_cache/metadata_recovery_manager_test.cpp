@@ -125,6 +125,7 @@ public:
 
     RETURN_UNSUPPORTED_MASTER_API(RollbackSeal, const std::string &, uint32_t)
     RETURN_UNSUPPORTED_MASTER_API(Expire, master::ExpireReqPb &, master::ExpireRspPb &)
+    RETURN_UNSUPPORTED_MASTER_API(AcquireFillLease, master::AcquireFillLeaseReqPb &, master::AcquireFillLeaseRspPb &)
     RETURN_UNSUPPORTED_MASTER_API(ReconcileMembershipChange, master::ReconciliationQueryPb &,
                                   master::ReconciliationRspPb &)
 
@@ -152,6 +152,7 @@ public:
                                   master::PushMetaToMasterRspPb &)
     RETURN_UNSUPPORTED_MASTER_API(RollbackSeal, const std::string &, uint32_t)
     RETURN_UNSUPPORTED_MASTER_API(Expire, master::ExpireReqPb &, master::ExpireRspPb &)
+    RETURN_UNSUPPORTED_MASTER_API(AcquireFillLease, master::AcquireFillLeaseReqPb &, master::AcquireFillLeaseRspPb &)
     RETURN_UNSUPPORTED_MASTER_API(ReconcileMembershipChange, master::ReconciliationQueryPb &,
                                   master::ReconciliationRspPb &)
 
@@ -18,10 +18,14 @@
  * Description: Test worker-side memory rebalance components.
  */
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
+#include <numeric>
+#include <random>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -32,6 +36,7 @@
 #include <gtest/gtest.h>
 
 #include "datasystem/common/ak_sk/ak_sk_manager.h"
+#include "datasystem/common/flags/flags.h"
 #include "datasystem/common/immutable_string/immutable_string.h"
 #include "datasystem/common/log/trace.h"
 #include "datasystem/common/shared_memory/allocator.h"
@@ -46,6 +51,8 @@
 #include "ut/common.h"
 #include "tests/ut/worker/object_cache/test_metadata_route.h"
 
+DS_DECLARE_string(rebalance_candidate_policy);
+
 using namespace datasystem::object_cache;
 using namespace datasystem::worker;
 
@@ -74,6 +81,39 @@ master::RebalanceTaskPb MakeTask(const std::string &taskId, uint64_t maxBytes)
     task.set_deadline_ms(nowMs + TASK_TIMEOUT_MS);
     return task;
 }
+
+using CandidateInfo = RebalanceCandidateProvider::CandidateInfo;
+
+CandidateInfo MakeCandidate(size_t index, uint64_t size, uint8_t accessCount = 0, uint32_t refCount = 0)
+{
+    CandidateInfo info;
+    info.objectKey = "object_" + std::to_string(index);
+    info.size = size;
+    info.accessCount = accessCount;
+    info.refCount = refCount;
+    return info;
+}
+
+// The legacy policy: take candidates in eviction order until the target or the object cap is reached.
+std::vector<size_t> PickOldest(const std::vector<CandidateInfo> &infos, uint64_t targetBytes, size_t maxObjectCount)
+{
+    std::vector<size_t> picked;
+    uint64_t pickedBytes = 0;
+    for (size_t i = 0; i < infos.size() && pickedBytes < targetBytes && picked.size() < maxObjectCount; ++i) {
+        picked.emplace_back(i);
+        pickedBytes += infos[i].size;
+    }
+    return picked;
+}
+
+uint64_t SumBytes(const std::vector<CandidateInfo> &infos, const std::vector<size_t> &picked)
+{
+    uint64_t bytes = 0;
+    for (auto index : picked) {
+        bytes += infos[index].size;
+    }
+    return bytes;
+}
 }  // namespace
 
 class RebalanceCandidateProviderTest : public CommonTest, public EvictionManagerCommon {
@@ -260,6 +300,111 @@ TEST_F(RebalanceCandidateProviderTest, SelectDoesNotSeeStaleEntryAfterRelease)
     EXPECT_FALSE(migratedStillPresent) << "stale eviction-list entry for migrated object must be purged at source";
 }
 
+// Synthetic size mix: 95% small objects and 5% large ones spread over the scan window. The cost-aware pick reaches the
+// target with a handful of large objects where eviction order needs hundreds of metadata updates.
+TEST_F(RebalanceCandidateProviderTest, CostAwarePickNeedsFewerObjectsOnMixedSizes)
+{
+    constexpr size_t windowSize = 2560;
+    constexpr size_t maxObjectCount = 512;
+    constexpr uint64_t smallSize = 64 * 1024;
+    constexpr uint64_t largeSize = 8 * MB;
+    constexpr uint64_t targetBytes = 64 * MB;
+    std::mt19937 rng(7);
+    std::bernoulli_distribution isLarge(0.05);
+    std::vector<CandidateInfo> infos;
+    for (size_t i = 0; i < windowSize; ++i) {
+        infos.emplace_back(MakeCandidate(i, isLarge(rng) ? largeSize : smallSize));
+    }
+
+    auto oldest = PickOldest(infos, targetBytes, maxObjectCount);
+    auto costAware = RebalanceCandidateProvider::PickByCost(infos, targetBytes, maxObjectCount);
+    EXPECT_GE(SumBytes(infos, costAware), targetBytes);
+    EXPECT_LE(SumBytes(infos, costAware), targetBytes + smallSize);
+    EXPECT_EQ(costAware.size(), targetBytes / largeSize);
+    EXPECT_GT(oldest.size(), costAware.size() * 10);
+    LOG(INFO) << "mixed sizes: oldest objects=" << oldest.size() << " bytes=" << SumBytes(infos, oldest)
+              << ", cost_aware objects=" << costAware.size() << " bytes=" << SumBytes(infos, costAware);
+}
+
+// Synthetic Zipf-like popularity over equally sized objects: a few objects are read constantly and some are held by
+// clients. The cost-aware pick leaves all of them in place while cold bytes remain.
+TEST_F(RebalanceCandidateProviderTest, CostAwarePickSkipsHotAndReferencedObjects)
+{
+    constexpr size_t windowSize = 1000;
+    constexpr size_t maxObjectCount = 512;
+    constexpr uint64_t objectSize = MB;
+    constexpr uint64_t targetBytes = 300 * MB;
+    constexpr double zipfExponent = 1.1;
+    constexpr size_t referencedEvery = 7;
+    std::vector<size_t> ranks(windowSize);
+    std::iota(ranks.begin(), ranks.end(), 1);
+    std::mt19937 rng(11);
+    std::shuffle(ranks.begin(), ranks.end(), rng);
+    std::vector<CandidateInfo> infos;
+    for (size_t i = 0; i < windowSize; ++i) {
+        // Reads per eviction-hand pass fall with the popularity rank; the clock counter saturates at READD_COUNTER.
+        const double reads = 50.0 / std::pow(static_cast<double>(ranks[i]), zipfExponent);
+        const auto accessCount = static_cast<uint8_t>(std::min<double>(reads, READD_COUNTER));
+        infos.emplace_back(MakeCandidate(i, objectSize, accessCount, i % referencedEvery == 0 ? 1 : 0));
+    }
+    auto disruption = [&infos](const std::vector<size_t> &picked) {
+        size_t hot = 0;
+        size_t referenced = 0;
+        for (auto index : picked) {
+            hot += infos[index].accessCount > 0 ? 1 : 0;
+            referenced += infos[index].refCount > 0 ? 1 : 0;
+        }
+        return std::make_pair(hot, referenced);
+    };
+
+    auto oldest = PickOldest(infos, targetBytes, maxObjectCount);
+    auto costAware = RebalanceCandidateProvider::PickByCost(infos, targetBytes, maxObjectCount);
+    EXPECT_EQ(SumBytes(infos, costAware), targetBytes);
+    auto [oldestHot, oldestReferenced] = disruption(oldest);
+    auto [hot, referenced] = disruption(costAware);
+    EXPECT_EQ(hot, 0ul);
+    EXPECT_EQ(referenced, 0ul);
+    EXPECT_GT(oldestHot, 0ul);
+    EXPECT_GT(oldestReferenced, 0ul);
+    LOG(INFO) << "zipf popularity: oldest hot=" << oldestHot << " referenced=" << oldestReferenced
+              << ", cost_aware hot=" << hot << " referenced=" << referenced;
+}
+
+// The last gap of a batch is closed by the smallest object that overshoots it, not by the first one seen.
+TEST_F(RebalanceCandidateProviderTest, CostAwarePickClosesGapWithSmallestOvershoot)
+{
+    std::vector<CandidateInfo> infos{ MakeCandidate(0, 60), MakeCandidate(1, 100), MakeCandidate(2, 50),
+                                      MakeCandidate(3, 70, 1) };
+    auto picked = RebalanceCandidateProvider::PickByCost(infos, 120, 10);
+    ASSERT_EQ(picked.size(), 2ul);
+    EXPECT_EQ(picked[0], 1ul);
+    EXPECT_EQ(picked[1], 2ul);
+    EXPECT_TRUE(RebalanceCandidateProvider::PickByCost(infos, 120, 0).empty());
+    EXPECT_TRUE(RebalanceCandidateProvider::PickByCost({}, 120, 10).empty());
+}
+
+// End to end through Select: with the cost-aware policy a large object behind several small ones is taken first, and
+// only the picked objects are marked as rebalancing.
+TEST_F(RebalanceCandidateProviderTest, CostAwarePolicySelectsLargeObjectFirst)
+{
+    auto oldPolicy = FLAGS_rebalance_candidate_policy;
+    Raii restorePolicy([&oldPolicy]() { FLAGS_rebalance_candidate_policy = oldPolicy; });
+    FLAGS_rebalance_candidate_policy = "cost_aware";
+    CreateAndAdd("small_0", 1 * MB);
+    CreateAndAdd("small_1", 1 * MB);
+    CreateAndAdd("small_2", 1 * MB);
+    CreateAndAdd("large", 20 * MB);
+
+    RebalanceCandidateProvider provider(evictionManager_, objectTable_);
+    std::unordered_map<std::string, uint64_t> candidates;
+    DS_ASSERT_OK(provider.Select(20 * MB, 10, candidates));
+
+    ASSERT_EQ(candidates.size(), size_t(1));
+    EXPECT_GE(candidates["large"], 20 * MB);
+    EXPECT_TRUE(evictionManager_->IsObjectBeingRebalanced("large"));
+    EXPECT_FALSE(evictionManager_->IsObjectBeingRebalanced("small_0"));
+}
+
 class RebalanceExecutorTest : public CommonTest {
 public:
     void SetUp() override
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <dirent.h>
 #include <functional>
+#include <iostream>
 #include <limits.h>
 #include <sstream>
 #include <unistd.h>
@@ -34,6 +35,7 @@
 #include "datasystem/common/util/file_util.h"
 #include "datasystem/common/util/random_data.h"
 #include "datasystem/common/util/thread_pool.h"
+#include "datasystem/common/util/timer.h"
 #include "datasystem/worker/object_cache/obj_cache_shm_unit.h"
 
 DS_DECLARE_string(spill_directory);
@@ -1409,6 +1411,115 @@ TEST_F(SpillRequestHandlerTest, TestSpillIoCounters_Concurrent)
     LOG(INFO) << "Concurrent test: spilled=" << spilledBytes.load()
               << " got=" << gotBytes.load() << " deleted=" << deletedBytes.load();
 }
+TEST_F(SpillRequestHandlerTest, TestBatchGetMergesAndLoadsObjects)
+{
+    // Objects of several sizes spread over the spill files, one still in the spill buffer and one missing.
+    const std::vector<size_t> sizes = { 64 * 1024, 200 * 1024, 12 * 1024, 2 * 1024 * 1024, 300 * 1024, 48 * 1024 };
+    std::vector<std::string> keys;
+    std::vector<std::string> datas;
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        keys.emplace_back("test_batch_get_" + std::to_string(i));
+        datas.emplace_back(RandomData().GetRandomString(sizes[i]));
+        DS_ASSERT_OK(handler->Spill(keys.back(), datas.back().data(), datas.back().size()));
+    }
+    std::string bufferedKey = "test_batch_get_buffered";
+    std::string bufferedData = RandomData().GetRandomString(512);
+    DS_ASSERT_OK(handler->Spill(bufferedKey, bufferedData.data(), bufferedData.size()));
+    ASSERT_EQ(handler->GetObjectLocation(bufferedKey), SPILL_BUFFER);
+
+    std::vector<std::string> loads;
+    std::vector<SpillLoadRequest> requests;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        loads.emplace_back(sizes[i], '\0');
+    }
+    // A partial read of the large object and a read of the same object in another range of the batch.
+    const size_t partialOffset = 4096;
+    const size_t partialSize = 100 * 1024;
+    loads.emplace_back(partialSize, '\0');
+    loads.emplace_back(bufferedData.size(), '\0');
+    loads.emplace_back(16, '\0');
+    for (size_t i = 0; i < keys.size(); ++i) {
+        requests.emplace_back(SpillLoadRequest{ keys[i], loads[i].data(), sizes[i], 0, Status::OK() });
+    }
+    requests.emplace_back(SpillLoadRequest{ keys[3], loads[keys.size()].data(), partialSize, partialOffset,
+                                            Status::OK() });
+    requests.emplace_back(
+        SpillLoadRequest{ bufferedKey, loads[keys.size() + 1].data(), bufferedData.size(), 0, Status::OK() });
+    requests.emplace_back(
+        SpillLoadRequest{ "test_batch_get_missing", loads[keys.size() + 2].data(), 16, 0, Status::OK() });
+
+    auto before = ParseSpillIoStats(handler->GetSpillIoStats());
+    DS_ASSERT_OK(handler->BatchGet(requests));
+    auto after = ParseSpillIoStats(handler->GetSpillIoStats());
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        DS_ASSERT_OK(requests[i].rc);
+        ASSERT_EQ(loads[i], datas[i]) << keys[i];
+    }
+    DS_ASSERT_OK(requests[keys.size()].rc);
+    ASSERT_EQ(loads[keys.size()], datas[3].substr(partialOffset, partialSize));
+    DS_ASSERT_OK(requests[keys.size() + 1].rc);
+    ASSERT_EQ(loads[keys.size() + 1], bufferedData);
+    ASSERT_EQ(requests[keys.size() + 2].rc.GetCode(), K_NOT_FOUND);
+
+    // Only the objects read from the files are counted as physical reads.
+    size_t fileBytes = partialSize;
+    for (auto size : sizes) {
+        fileBytes += size;
+    }
+    ASSERT_EQ(after[3], before[3] + keys.size() + 1);
+    ASSERT_EQ(after[4], before[4] + fileBytes);
+
+    // A read out of the object range fails alone.
+    std::string tooLong(sizes[0] + 1, '\0');
+    std::vector<SpillLoadRequest> badRequests{ { keys[0], tooLong.data(), tooLong.size(), 0, Status::OK() },
+                                               { keys[1], loads[1].data(), sizes[1], 0, Status::OK() } };
+    DS_ASSERT_OK(handler->BatchGet(badRequests));
+    ASSERT_TRUE(badRequests[0].rc.IsError());
+    DS_ASSERT_OK(badRequests[1].rc);
+    ASSERT_EQ(loads[1], datas[1]);
+    for (const auto &key : keys) {
+        DS_EXPECT_OK(handler->Delete(key));
+    }
+    DS_EXPECT_OK(handler->Delete(bufferedKey));
+}
+
+TEST_F(SpillRequestHandlerTest, LEVEL1_BatchGetThroughput)
+{
+    const size_t objectCount = 1000;
+    const size_t objectSize = 64 * 1024;
+    std::string data = RandomData().GetRandomString(objectSize);
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < objectCount; ++i) {
+        keys.emplace_back("test_batch_get_perf_" + std::to_string(i));
+        DS_ASSERT_OK(handler->Spill(keys.back(), data.data(), data.size()));
+    }
+    std::vector<std::string> loads(objectCount, std::string(objectSize, '\0'));
+
+    Timer timer;
+    for (size_t i = 0; i < objectCount; ++i) {
+        DS_ASSERT_OK(handler->Get(keys[i], loads[i].data(), objectSize));
+    }
+    double singleMs = timer.ElapsedMilliSecond();
+
+    std::vector<SpillLoadRequest> requests;
+    for (size_t i = 0; i < objectCount; ++i) {
+        requests.emplace_back(SpillLoadRequest{ keys[i], loads[i].data(), objectSize, 0, Status::OK() });
+    }
+    timer.Reset();
+    DS_ASSERT_OK(handler->BatchGet(requests));
+    double batchMs = timer.ElapsedMilliSecond();
+    for (size_t i = 0; i < objectCount; ++i) {
+        DS_ASSERT_OK(requests[i].rc);
+        ASSERT_EQ(loads[i], data);
+    }
+    std::cout << "Load " << objectCount << " spilled objects of " << objectSize << " bytes, one by one: " << singleMs
+              << "ms, batch: " << batchMs << "ms" << std::endl;
+    for (const auto &key : keys) {
+        DS_EXPECT_OK(handler->Delete(key));
+    }
+}
+
 TEST_F(SpillRequestHandlerTest, TestSpillIoCounters_NoPhysicalIoForBufferOnly)
 {
     // Verify small objects in SpillBuffer do NOT trigger physical SSD IO counters.
@@ -18,11 +18,17 @@
  * Description: Test StreamPage StreamPageOwner classes.
  */
 
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include "ut/common.h"
+#include "datasystem/common/inject/inject_point.h"
 #include "datasystem/common/perf/perf_manager.h"
 #include "datasystem/common/shared_memory/allocator.h"
 #include "datasystem/common/stream_cache/stream_data_page.h"
 #include "datasystem/common/util/random_data.h"
+#include "datasystem/common/util/timer.h"
 #include "datasystem/stream/stream_config.h"
 #include "datasystem/worker/stream_cache/buffer_pool.h"
 
@@ -46,6 +52,10 @@ protected:
                                std::vector<std::string> &out);
     Status ReceiveUntilTimeout(std::shared_ptr<ShmUnit> &pageUnit, uint64_t &lastRecvCursor, uint32_t lockId,
                                uint64_t timeoutMs, std::vector<Element> &out);
+    static Status CreateProducerCursor(uint32_t lockId, std::shared_ptr<ShmUnit> &cursorUnit,
+                                       std::shared_ptr<Cursor> &cursor);
+    static Status InsertString(std::shared_ptr<StreamDataPage> &page, std::string str, uint64_t timeoutMs);
+    void CrashInInsert(uint32_t lockId, std::shared_ptr<Cursor> &cursor, const std::string &injectName);
     static std::string ShmUnitInfoToStr(std::shared_ptr<ShmUnitInfo> &shm)
     {
         ShmView v = { .fd = shm->fd, .mmapSz = shm->mmapSize, .off = shm->offset, .sz = shm->size };
@@ -126,6 +136,50 @@ Status StreamDataPageTest::ReceiveUntilTimeout(std::shared_ptr<ShmUnit> &pageUni
     return rc;
 }
 
+Status StreamDataPageTest::CreateProducerCursor(uint32_t lockId, std::shared_ptr<ShmUnit> &cursorUnit,
+                                                std::shared_ptr<Cursor> &cursor)
+{
+    // The work area of a V3 producer, with lock free append turned on like the worker does.
+    cursorUnit = std::make_shared<ShmUnit>();
+    RETURN_IF_NOT_OK(cursorUnit->AllocateMemory("", Cursor::K_CURSOR_SIZE_V2, false));
+    auto rc = memset_s(cursorUnit->GetPointer(), Cursor::K_CURSOR_SIZE_V2, 0, Cursor::K_CURSOR_SIZE_V2);
+    CHECK_FAIL_RETURN_STATUS(rc == 0, K_RUNTIME_ERROR, FormatString("memset_s fails. Errno = %d", rc));
+    cursor = std::make_shared<Cursor>(cursorUnit->GetPointer(), Cursor::K_CURSOR_SIZE_V2, lockId);
+    RETURN_IF_NOT_OK(cursor->Init());
+    RETURN_IF_NOT_OK(cursor->SetClientVersion(Cursor::K_CLIENT_EYECATCHER_V3));
+    cursor->SetLockFreeAppend(true);
+    return Status::OK();
+}
+
+Status StreamDataPageTest::InsertString(std::shared_ptr<StreamDataPage> &page, std::string str, uint64_t timeoutMs)
+{
+    HeaderAndData ele(reinterpret_cast<uint8_t *>(str.data()), str.length(), 0);
+    auto flag = InsertFlags::NONE;
+    return page->Insert(ele, timeoutMs, flag);
+}
+
+void StreamDataPageTest::CrashInInsert(uint32_t lockId, std::shared_ptr<Cursor> &cursor,
+                                       const std::string &injectName)
+{
+    pid_t pid = fork();
+    if (pid == 0) {
+        // The producer process aborts in the middle of the insert, don't leave a core behind.
+        struct rlimit noCore = { 0, 0 };
+        (void)setrlimit(RLIMIT_CORE, &noCore);
+        (void)inject::Set(injectName, "abort");
+        auto page = std::make_shared<datasystem::StreamDataPage>(pageUnit_, lockId, true);
+        if (page->Init().IsOk()) {
+            page->SetAppendCursor(cursor.get());
+            (void)InsertString(page, "crash", 0);
+        }
+        _exit(0);
+    }
+    ASSERT_GT(pid, 0);
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFSIGNALED(status));
+}
+
 TEST_F(StreamDataPageTest, TestCreateDataPageSuccess)
 {
     ASSERT_EQ(page_->InitEmptyPage(), Status::OK());
@@ -161,6 +215,36 @@ TEST_F(StreamDataPageTest, TestMultiElementsRW)
     }
 }
 
+TEST_F(StreamDataPageTest, TestBatchInsertUntilPageFull)
+{
+    ASSERT_EQ(page_->InitEmptyPage(), Status::OK());
+    // More elements than the page holds, the batch insert takes a prefix.
+    const size_t batchSize = 512;
+    std::vector<std::string> strs;
+    std::vector<HeaderAndData> elements;
+    strs.reserve(batchSize);
+    elements.reserve(batchSize);
+    for (size_t i = 0; i < batchSize; ++i) {
+        strs.emplace_back(GetRandomString());
+        elements.emplace_back(reinterpret_cast<uint8_t *>(strs.back().data()), strs.back().length(), 0);
+    }
+    auto flag = InsertFlags::NONE;
+    size_t numInserted = 0;
+    DS_ASSERT_OK(page_->Insert(elements, 0, batchSize, 0, flag, numInserted));
+    ASSERT_GT(numInserted, 0u);
+    ASSERT_LT(numInserted, batchSize);
+    // The rest does not fit, not even the next element.
+    size_t numMore = 0;
+    ASSERT_EQ(page_->Insert(elements, numInserted, batchSize, 0, flag, numMore).GetCode(), K_NO_SPACE);
+    ASSERT_EQ(numMore, 0u);
+    std::vector<DataElement> v;
+    DS_ASSERT_OK(page_->Receive(0, 0, v));
+    ASSERT_EQ(v.size(), numInserted);
+    for (size_t i = 0; i < numInserted; ++i) {
+        ASSERT_TRUE(VerifyElement(strs[i], v[i]));
+    }
+}
+
 TEST_F(StreamDataPageTest, TestMultiElementsSPSC)
 {
     // Two threads. One simulate producer and one simulate consumer.
@@ -232,5 +316,224 @@ TEST_F(StreamDataPageTest, TestMultiElementsMPSC)
     ASSERT_EQ(totalElements, v.size());
 }
 
+TEST_F(StreamDataPageTest, TestLockFreeAppendFillsPage)
+{
+    // Producers append to one page without the page lock. No element is lost or overwritten,
+    // and the page is filled up to the last byte like with the page lock.
+    const size_t pageSize = 1024 * 1024;
+    const size_t eleSize = 64;
+    const int numProducers = 4;
+    auto pageUnit = std::make_shared<ShmUnit>();
+    DS_ASSERT_OK(pageUnit->AllocateMemory("", pageSize, false));
+    auto page = std::make_shared<datasystem::StreamDataPage>(pageUnit, 0, false);
+    DS_ASSERT_OK(page->Init());
+    DS_ASSERT_OK(page->InitEmptyPage());
+    std::vector<std::shared_ptr<ShmUnit>> cursorUnits(numProducers);
+    std::vector<std::shared_ptr<Cursor>> cursors(numProducers);
+    for (auto i = 0; i < numProducers; ++i) {
+        DS_ASSERT_OK(CreateProducerCursor(i + 1, cursorUnits[i], cursors[i]));
+    }
+    auto pool = std::make_unique<datasystem::ThreadPool>(numProducers);
+    std::vector<std::future<void>> producerRes;
+    std::vector<size_t> counts(numProducers, 0);
+    for (auto i = 0; i < numProducers; ++i) {
+        producerRes.emplace_back(pool->Submit([&pageUnit, &counts, &cursors, i]() {
+            auto producerPage = std::make_shared<datasystem::StreamDataPage>(pageUnit, i + 1, true);
+            DS_ASSERT_OK(producerPage->Init());
+            producerPage->SetAppendCursor(cursors[i].get());
+            std::string str(eleSize, 'a');
+            auto *tag = reinterpret_cast<uint32_t *>(&str.front());
+            tag[0] = static_cast<uint32_t>(i);
+            auto &count = counts[i];
+            while (true) {
+                tag[1] = static_cast<uint32_t>(count);
+                auto rc = InsertString(producerPage, str, 0);
+                if (rc.GetCode() == K_NO_SPACE) {
+                    break;
+                }
+                if (rc.GetCode() == K_TRY_AGAIN) {
+                    continue;
+                }
+                DS_ASSERT_OK(rc);
+                ++count;
+            }
+        }));
+    }
+    for (auto &res : producerRes) {
+        res.get();
+    }
+    auto totalElements = std::accumulate(counts.begin(), counts.end(), 0ul);
+    const size_t spacePerElement = StreamDataPage::GetMetaSize(false) + eleSize;
+    ASSERT_EQ(totalElements, page->PagePayloadSize() / spacePerElement);
+    ASSERT_EQ(page->GetFreeSpaceSize(), page->PagePayloadSize() - totalElements * spacePerElement);
+    ASSERT_FALSE(page->HasInFlightSlot());
+    for (auto &cursor : cursors) {
+        ASSERT_EQ(cursor->GetAppendClaim(), 0ul);
+    }
+    std::vector<DataElement> v;
+    DS_ASSERT_OK(page->Receive(0, 0, v));
+    ASSERT_EQ(totalElements, v.size());
+    std::vector<uint32_t> nextSeq(numProducers, 0);
+    for (auto &ele : v) {
+        ASSERT_EQ(ele.size, eleSize);
+        auto *tag = reinterpret_cast<const uint32_t *>(ele.ptr);
+        ASSERT_LT(tag[0], static_cast<uint32_t>(numProducers));
+        ASSERT_EQ(tag[1], nextSeq[tag[0]]++);
+    }
+}
+
+TEST_F(StreamDataPageTest, LEVEL1_TestProducerScaling)
+{
+    // Measure how the insert throughput of one page scales with the number of producers, appending
+    // without the page lock against the page lock path, and check no element is lost or overwritten.
+    const size_t pageSize = 8 * 1024 * 1024;
+    const size_t eleSize = 64;
+    const std::vector<int> producerNums = { 1, 2, 4, 8 };
+    for (auto lockFree : { false, true }) {
+        for (auto numProducers : producerNums) {
+            auto pageUnit = std::make_shared<ShmUnit>();
+            DS_ASSERT_OK(pageUnit->AllocateMemory("", pageSize, false));
+            auto page = std::make_shared<datasystem::StreamDataPage>(pageUnit, 0, false);
+            DS_ASSERT_OK(page->Init());
+            DS_ASSERT_OK(page->InitEmptyPage());
+            std::vector<std::shared_ptr<ShmUnit>> cursorUnits(numProducers);
+            std::vector<std::shared_ptr<Cursor>> cursors(numProducers);
+            for (auto i = 0; i < numProducers; ++i) {
+                DS_ASSERT_OK(CreateProducerCursor(i + 1, cursorUnits[i], cursors[i]));
+                cursors[i]->SetLockFreeAppend(lockFree);
+            }
+            auto pool = std::make_unique<datasystem::ThreadPool>(numProducers);
+            std::vector<std::future<void>> producerRes;
+            std::vector<size_t> counts(numProducers, 0);
+            Timer timer;
+            for (auto i = 0; i < numProducers; ++i) {
+                producerRes.emplace_back(pool->Submit([&pageUnit, &counts, &cursors, i]() {
+                    auto producerPage = std::make_shared<datasystem::StreamDataPage>(pageUnit, i + 1, true);
+                    DS_ASSERT_OK(producerPage->Init());
+                    producerPage->SetAppendCursor(cursors[i].get());
+                    std::string str(eleSize, 'a');
+                    auto *tag = reinterpret_cast<uint32_t *>(&str.front());
+                    tag[0] = static_cast<uint32_t>(i);
+                    auto &count = counts[i];
+                    while (true) {
+                        tag[1] = static_cast<uint32_t>(count);
+                        auto rc = InsertString(producerPage, str, 0);
+                        if (rc.GetCode() == K_NO_SPACE) {
+                            break;
+                        }
+                        if (rc.GetCode() == K_TRY_AGAIN) {
+                            continue;
+                        }
+                        DS_ASSERT_OK(rc);
+                        ++count;
+                    }
+                }));
+            }
+            for (auto &res : producerRes) {
+                res.get();
+            }
+            auto elapsedMs = timer.ElapsedMilliSecond();
+            auto totalElements = std::accumulate(counts.begin(), counts.end(), 0ul);
+            LOG(INFO) << FormatString("%s, %d producers insert %zu elements in %.3f ms, %.0f elements/s",
+                                      lockFree ? "lock free" : "page lock", numProducers, totalElements, elapsedMs,
+                                      totalElements * 1000 / std::max(elapsedMs, 0.001));
+            std::vector<DataElement> v;
+            DS_ASSERT_OK(page->Receive(0, 0, v));
+            ASSERT_EQ(totalElements, v.size());
+            std::vector<uint32_t> nextSeq(numProducers, 0);
+            for (auto &ele : v) {
+                ASSERT_EQ(ele.size, eleSize);
+                auto *tag = reinterpret_cast<const uint32_t *>(ele.ptr);
+                ASSERT_LT(tag[0], static_cast<uint32_t>(numProducers));
+                ASSERT_EQ(tag[1], nextSeq[tag[0]]++);
+            }
+        }
+    }
+}
+
+TEST_F(StreamDataPageTest, TestLockFreeAppendBacksOffPageLock)
+{
+    DS_ASSERT_OK(page_->InitEmptyPage());
+    std::shared_ptr<ShmUnit> cursorUnit;
+    std::shared_ptr<Cursor> cursor;
+    DS_ASSERT_OK(CreateProducerCursor(1, cursorUnit, cursor));
+    auto producerPage = std::make_shared<datasystem::StreamDataPage>(pageUnit_, 1, true);
+    DS_ASSERT_OK(producerPage->Init());
+    producerPage->SetAppendCursor(cursor.get());
+    const uint64_t timeoutMs = 10;
+    // With or without lock free append, nobody appends while the worker holds the page lock.
+    for (auto lockFree : { true, false }) {
+        cursor->SetLockFreeAppend(lockFree);
+        DS_ASSERT_OK(page_->Lock(timeoutMs));
+        ASSERT_EQ(InsertString(producerPage, "locked", timeoutMs).GetCode(), K_TRY_AGAIN);
+        ASSERT_EQ(cursor->GetAppendClaim(), 0ul);
+        page_->Unlock();
+        DS_ASSERT_OK(InsertString(producerPage, "unlocked", timeoutMs));
+        ASSERT_FALSE(page_->HasInFlightSlot());
+    }
+    std::vector<DataElement> v;
+    DS_ASSERT_OK(page_->Receive(0, 0, v));
+    ASSERT_EQ(v.size(), 2ul);
+    for (auto &ele : v) {
+        ASSERT_TRUE(VerifyElement("unlocked", ele));
+    }
+}
+
+TEST_F(StreamDataPageTest, TestRecoverCrashedLockFreeAppend)
+{
+    // A producer crashes in the middle of a lock free append. Only its own slot is repaired, the
+    // elements appended before stay, and the other producers can append again.
+    const std::vector<std::string> injectNames = { "producer_update_free_space",
+                                                   "producer_update_pending_slot_count_without_lock" };
+    const size_t numAcked = 3;
+    const uint64_t timeoutMs = 10;
+    const size_t metaSize = StreamDataPage::GetMetaSize(false);
+    for (const auto &injectName : injectNames) {
+        DS_ASSERT_OK(page_->InitEmptyPage());
+        std::shared_ptr<ShmUnit> liveUnit;
+        std::shared_ptr<Cursor> liveCursor;
+        DS_ASSERT_OK(CreateProducerCursor(1, liveUnit, liveCursor));
+        auto livePage = std::make_shared<datasystem::StreamDataPage>(pageUnit_, 1, true);
+        DS_ASSERT_OK(livePage->Init());
+        livePage->SetAppendCursor(liveCursor.get());
+        std::vector<std::string> strs;
+        for (size_t i = 0; i < numAcked; ++i) {
+            strs.emplace_back(GetRandomString());
+            DS_ASSERT_OK(InsertString(livePage, strs.back(), timeoutMs));
+        }
+        const uint32_t crashLockId = 2;
+        std::shared_ptr<ShmUnit> crashUnit;
+        std::shared_ptr<Cursor> crashCursor;
+        DS_ASSERT_OK(CreateProducerCursor(crashLockId, crashUnit, crashCursor));
+        CrashInInsert(crashLockId, crashCursor, injectName);
+        auto claim = AppendClaim::Decode(crashCursor->GetAppendClaim());
+        ASSERT_EQ(claim.firstSlot, numAcked + 1) << injectName;
+        ASSERT_TRUE(page_->HasInFlightSlot()) << injectName;
+        if (claim.Appending()) {
+            // The crashed producer holds the reservation of the next slot.
+            ASSERT_EQ(InsertString(livePage, "stuck", timeoutMs).GetCode(), K_TRY_AGAIN) << injectName;
+        } else {
+            ASSERT_EQ(claim.state, AppendClaimState::PUBLISHED) << injectName;
+            ASSERT_EQ(page_->GetSlotCount(), numAcked + 1) << injectName;
+        }
+        DS_ASSERT_OK(page_->RecoverAppend(crashLockId, crashCursor->GetAppendClaim(), timeoutMs));
+        ASSERT_FALSE(page_->HasInFlightSlot()) << injectName;
+        ASSERT_EQ(page_->GetSlotCount(), numAcked) << injectName;
+        size_t usedSpace = 0;
+        for (const auto &str : strs) {
+            usedSpace += metaSize + str.size();
+        }
+        ASSERT_EQ(page_->GetFreeSpaceSize(), page_->PagePayloadSize() - usedSpace) << injectName;
+        strs.emplace_back(GetRandomString());
+        DS_ASSERT_OK(InsertString(livePage, strs.back(), timeoutMs));
+        std::vector<DataElement> v;
+        DS_ASSERT_OK(page_->Receive(0, 0, v));
+        ASSERT_EQ(v.size(), strs.size()) << injectName;
+        for (size_t i = 0; i < strs.size(); ++i) {
+            ASSERT_TRUE(VerifyElement(strs[i], v[i])) << injectName;
+        }
+    }
+}
+
 }  // namespace ut
 }  // namespace datasystem
@@ -0,0 +1,276 @@
+/**
+ * Copyright (c) Huawei Technologies Co., Ltd. 2026. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Description: Test the disk overflow tier of the stream data pages.
+ */
+#include "datasystem/worker/stream_cache/page_queue/stream_page_spill.h"
+
+#include "ut/common.h"
+#include "datasystem/common/shared_memory/allocator.h"
+#include "datasystem/common/util/file_util.h"
+#include "datasystem/common/util/uuid_generator.h"
+#include "datasystem/worker/stream_cache/page_queue/page_queue_base.h"
+#include "datasystem/worker/stream_cache/worker_sc_allocate_memory.h"
+
+DS_DECLARE_string(spill_directory);
+
+namespace datasystem {
+namespace ut {
+using worker::stream_cache::PageQueueBase;
+using worker::stream_cache::RemoteWorkerManager;
+using worker::stream_cache::StreamPageSpill;
+using worker::stream_cache::WorkerSCAllocateMemory;
+namespace {
+constexpr size_t PAGE_SIZE = 4096;
+constexpr uint64_t ELEMENTS_PER_PAGE = 10;
+constexpr uint64_t SHM_CAP = 128ul * 1024ul * 1024ul;
+constexpr size_t QUEUE_PAGE_SIZE = 1024ul * 1024ul;
+constexpr uint64_t TIMEOUT_MS = 3000;
+
+std::string MakePage(char c)
+{
+    return std::string(PAGE_SIZE, c);
+}
+
+// A page queue with a spill tier whose memory limit is switched by the test.
+class SpillPageQueue : public std::enable_shared_from_this<SpillPageQueue>, public PageQueueBase {
+public:
+    explicit SpillPageQueue(std::shared_ptr<WorkerSCAllocateMemory> allocate) : allocate_(std::move(allocate))
+    {
+        pageSpill_ = std::make_unique<StreamPageSpill>("SpillPageQueue");
+    }
+
+    std::string LogPrefix() const override
+    {
+        return "S:SpillPageQueue";
+    }
+
+    size_t GetPageSize() const override
+    {
+        return QUEUE_PAGE_SIZE;
+    }
+
+    Status CheckHadEnoughMem(size_t memSize) override
+    {
+        CHECK_FAIL_RETURN_STATUS(!outOfMemory_, K_OUT_OF_MEMORY,
+                                 FormatString("The stream does not have enough memory, need %zu", memSize));
+        return Status::OK();
+    }
+
+    Status AllocateMemoryImpl(size_t memSizeNeeded, ShmUnit &shmUnit, bool retryOnOOM) override
+    {
+        return allocate_->AllocateMemoryForStream("", GetStreamName(), memSizeNeeded, true, shmUnit, retryOnOOM);
+    }
+
+    Status UpdateLocalCursorLastDataPage(const ShmView &shmView) override
+    {
+        (void)shmView;
+        return Status::OK();
+    }
+
+    Status AfterAck() override
+    {
+        return Status::OK();
+    }
+
+    bool IsEncryptStream(const std::string &streamName) const override
+    {
+        (void)streamName;
+        return false;
+    }
+
+    std::string GetStreamName() const override
+    {
+        return "SpillPageQueue";
+    }
+
+    RemoteWorkerManager *GetRemoteWorkerManager() const override
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<PageQueueBase> SharedFromThis() override
+    {
+        return std::static_pointer_cast<PageQueueBase>(shared_from_this());
+    }
+
+    void SetOutOfMemory(bool outOfMemory)
+    {
+        outOfMemory_ = outOfMemory;
+    }
+
+    std::vector<uint64_t> GetIndexKeys() const
+    {
+        std::vector<uint64_t> keys;
+        for (const auto &ele : idxChain_) {
+            keys.emplace_back(ele.first);
+        }
+        return keys;
+    }
+
+    bool SpillEmpty() const
+    {
+        return pageSpill_->Empty();
+    }
+
+private:
+    std::shared_ptr<WorkerSCAllocateMemory> allocate_;
+    bool outOfMemory_{ false };
+};
+
+void ExpectElement(const std::shared_ptr<StreamDataPage> &page, const std::string &expect)
+{
+    std::vector<DataElement> out;
+    DS_ASSERT_OK(page->Receive(page->GetBegCursor() - 1, TIMEOUT_MS, out));
+    ASSERT_EQ(out.size(), 1ul);
+    ASSERT_EQ(std::string(reinterpret_cast<const char *>(out[0].ptr), out[0].size), expect);
+}
+}  // namespace
+
+class StreamPageSpillTest : public CommonTest {
+public:
+    static void SetUpTestSuite()
+    {
+        // The spill directory is prepared once per process.
+        FLAGS_spill_directory = "./stream_spill" + GetStringUuid();
+        FLAGS_sc_spill_pages = true;
+    }
+
+    static void TearDownTestSuite()
+    {
+        LOG_IF_ERROR(RemoveAll(FLAGS_spill_directory), "remove spill directory failed");
+        FLAGS_sc_spill_pages = false;
+    }
+
+protected:
+    // Spill pages [first, last), page i holds the cursors (i * 10, (i + 1) * 10].
+    void SpillPages(StreamPageSpill &spill, uint64_t first, uint64_t last)
+    {
+        for (uint64_t i = first; i < last; i++) {
+            auto page = MakePage(static_cast<char>('a' + i));
+            DS_ASSERT_OK(spill.Spill(i * ELEMENTS_PER_PAGE, (i + 1) * ELEMENTS_PER_PAGE, page.data(), page.size()));
+        }
+    }
+};
+
+TEST_F(StreamPageSpillTest, TestSpillAndReadBack)
+{
+    ASSERT_TRUE(StreamPageSpill::IsEnabled());
+    StreamPageSpill spill("TestSpillAndReadBack");
+    const uint64_t numPages = 4;
+    SpillPages(spill, 0, numPages);
+    ASSERT_EQ(spill.GetNumPagesSpilled(), numPages);
+    ASSERT_EQ(spill.GetSpilledBytes(), numPages * PAGE_SIZE);
+
+    // Cursor 25 lives in page 2.
+    std::vector<uint64_t> endCursors;
+    spill.Find(24, false, endCursors);
+    ASSERT_EQ(endCursors, std::vector<uint64_t>{ 20 });
+    std::string buf(PAGE_SIZE, 0);
+    DS_ASSERT_OK(spill.ReadBack(20, buf.data(), buf.size()));
+    ASSERT_EQ(buf, MakePage('c'));
+    ASSERT_EQ(spill.ReadBack(20, buf.data(), buf.size()).GetCode(), K_NOT_FOUND);
+    ASSERT_EQ(spill.ReadBack(30, buf.data(), PAGE_SIZE - 1).GetCode(), K_INVALID);
+
+    // The page before the first spilled cursor is still in memory.
+    endCursors.clear();
+    spill.Find(20, false, endCursors);
+    ASSERT_TRUE(endCursors.empty());
+
+    // To end returns the spilled pages after it as well.
+    endCursors.clear();
+    spill.Find(5, true, endCursors);
+    ASSERT_EQ(endCursors, (std::vector<uint64_t>{ 0, 10, 30 }));
+    DS_ASSERT_OK(spill.ReadBack(30, buf.data(), buf.size()));
+    ASSERT_EQ(buf, MakePage('d'));
+    ASSERT_EQ(spill.GetNumPagesReadBack(), 2ul);
+    ASSERT_EQ(spill.GetReadBackBytes(), 2 * PAGE_SIZE);
+}
+
+TEST_F(StreamPageSpillTest, TestAckDropsSpilledPages)
+{
+    StreamPageSpill spill("TestAckDropsSpilledPages");
+    const uint64_t numPages = 3;
+    SpillPages(spill, 0, numPages);
+    // Everything up to cursor 21 is acked, pages 0 and 1 are dropped.
+    spill.Ack(21);
+    std::vector<uint64_t> endCursors;
+    spill.Find(0, true, endCursors);
+    ASSERT_EQ(endCursors, std::vector<uint64_t>{ 20 });
+    spill.Ack(31);
+    ASSERT_TRUE(spill.Empty());
+
+    // The file restarts from the beginning once it is empty.
+    SpillPages(spill, numPages, numPages + 1);
+    std::string buf(PAGE_SIZE, 0);
+    DS_ASSERT_OK(spill.ReadBack(numPages * ELEMENTS_PER_PAGE, buf.data(), buf.size()));
+    ASSERT_EQ(buf, MakePage(static_cast<char>('a' + numPages)));
+
+    SpillPages(spill, 0, 1);
+    spill.Reset();
+    ASSERT_TRUE(spill.Empty());
+}
+
+TEST_F(StreamPageSpillTest, TestPageQueueSpillReadBackAndRelink)
+{
+    DS_ASSERT_OK(memory::Allocator::Instance()->Init(SHM_CAP));
+    auto queue = std::make_shared<SpillPageQueue>(std::make_shared<WorkerSCAllocateMemory>(nullptr));
+    // Page i holds the cursor i + 1, so it is indexed by the key i.
+    const uint64_t numPages = 5;
+    std::vector<std::shared_ptr<StreamDataPage>> pages;
+    std::shared_ptr<StreamDataPage> lastPage;
+    DS_ASSERT_OK(queue->CreateOrGetLastDataPage(TIMEOUT_MS, ShmView(), lastPage, false));
+    for (uint64_t i = 0; i < numPages; i++) {
+        std::string data = "element" + std::to_string(i);
+        HeaderAndData element(reinterpret_cast<uint8_t *>(data.data()), data.size(), 0);
+        InsertFlags flags = InsertFlags::NONE;
+        DS_ASSERT_OK(lastPage->Insert(element, TIMEOUT_MS, flags));
+        pages.emplace_back(lastPage);
+        if (i + 1 < numPages) {
+            auto lastView = lastPage->GetShmView();
+            DS_ASSERT_OK(queue->CreateOrGetLastDataPage(TIMEOUT_MS, lastView, lastPage, false));
+        }
+    }
+
+    // The remote consumer is still at cursor 1 and holds page 0, the local consumers are done up to cursor 4.
+    DS_ASSERT_OK(pages[0]->RefPage("test"));
+    queue->SetOutOfMemory(true);
+    DS_ASSERT_OK(queue->Ack(1, nullptr, 4));
+    ASSERT_EQ(queue->GetIndexKeys(), (std::vector<uint64_t>{ 0, 3, 4 }));
+    DS_ASSERT_OK(pages[0]->ReleasePage("test"));
+    queue->SetOutOfMemory(false);
+
+    // Page 2 is read back while page 1 is still on disk: the stale next pointer of page 0 is cleared.
+    std::shared_ptr<StreamDataPage> page2;
+    DS_ASSERT_OK(queue->LocatePage(2, page2));
+    ASSERT_EQ(page2->GetBegCursor(), 3ul);
+    ExpectElement(page2, "element2");
+    ASSERT_FALSE(pages[0]->HasNextPage());
+    ASSERT_TRUE(page2->GetNextPage() == pages[3]->GetShmView());
+
+    // Page 1 fills the gap and is linked on both sides.
+    std::shared_ptr<StreamDataPage> page1;
+    DS_ASSERT_OK(queue->LocatePage(1, page1));
+    ASSERT_EQ(page1->GetBegCursor(), 2ul);
+    ExpectElement(page1, "element1");
+    ASSERT_TRUE(pages[0]->GetNextPage() == page1->GetShmView());
+    ASSERT_TRUE(page1->GetNextPage() == page2->GetShmView());
+    ASSERT_EQ(queue->GetIndexKeys(), (std::vector<uint64_t>{ 0, 1, 2, 3, 4 }));
+    ASSERT_TRUE(queue->SpillEmpty());
+}
+}  // namespace ut
+}  // namespace datasystem
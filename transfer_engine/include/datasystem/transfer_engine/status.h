@@ -15,6 +15,7 @@ enum class ErrorCode : int32_t {
     kRuntimeError = 5,
     kNotReady = 8,
     kNotAuthorized = 9,
+    kInterrupted = 11,
     kNotSupported = 36,
 };
 
@@ -21,6 +21,8 @@ class SocketControlServer;
 class ConnectionManager;
 class RegisteredMemoryTable;
 class TransferEngineState;
+class ReadPipeline;
+struct PipelinedReadBatch;
 
 class TransferEngine final {
 public:
@@ -40,6 +42,22 @@ public:
                             size_t length);
     Result BatchTransferSyncRead(const std::string &targetHostname, const std::vector<uintptr_t> &buffers,
                                  const std::vector<uintptr_t> &peerBufferAddresses, const std::vector<size_t> &lengths);
+    /// Submits the batch and returns once it is queued. The batches to one target are issued in submission order
+    /// and overlap each other's transfer; at most TRANSFER_ENGINE_ASYNC_READ_WINDOW (default 8) batches per target
+    /// are outstanding and the call blocks while the window is full. The buffers must stay valid until the batch
+    /// completes.
+    Result BatchTransferAsyncRead(const std::string &targetHostname, const std::vector<uintptr_t> &buffers,
+                                  const std::vector<uintptr_t> &peerBufferAddresses,
+                                  const std::vector<size_t> &lengths, uint64_t *batchId);
+    /// Sets *completed. Once it is true the result of the batch is returned and the batchId is released. Only the
+    /// results of the last 4096 batches completed without being polled are kept, older batchIds give kNotFound.
+    Result PollTransfer(uint64_t batchId, bool *completed);
+    /// Waits for the batch, returns its result and releases the batchId. timeoutMs 0 waits without limit; on timeout
+    /// kNotReady is returned and the batch stays outstanding.
+    Result WaitTransfer(uint64_t batchId, uint64_t timeoutMs);
+    /// Cancels a batch which is not issued yet, it then completes with kInterrupted. kNotReady if it is already
+    /// issued, it has to be waited for.
+    Result CancelTransfer(uint64_t batchId);
     Result Finalize();
 
 private:
@@ -60,6 +78,22 @@ private:
     Result WaitOwnerReadyAndCache(const std::string &peerHost, uint16_t peerPort, int32_t ownerDeviceId,
                                   uint64_t *ownerMemGeneration);
     std::string CreateRootInfo() const;
+    Result PrepareReadBatch(const std::string &targetHostname, const std::vector<uintptr_t> &buffers,
+                            const std::vector<uintptr_t> &peerBufferAddresses, const std::vector<size_t> &lengths,
+                            bool syncRead, std::shared_ptr<PipelinedReadBatch> *batch);
+    Result GetReadPipeline(const PipelinedReadBatch &batch, std::shared_ptr<ReadPipeline> *pipeline);
+    Result SubmitReadBatch(const std::shared_ptr<PipelinedReadBatch> &batch);
+    Result IssueReadBatch(PipelinedReadBatch &batch);
+    Result IssueReceiverDrivenRead(PipelinedReadBatch &batch);
+    Result IssuePostSendRead(PipelinedReadBatch &batch);
+    Result CompleteReadBatch(PipelinedReadBatch &batch);
+    void AbortReadBatch(PipelinedReadBatch &batch);
+    void ReleaseReadLease(PipelinedReadBatch &batch);
+    // Sets finished and result when the batch has completed and its result is waiting to be polled.
+    std::shared_ptr<PipelinedReadBatch> FindAsyncBatch(uint64_t batchId, bool *finished, Result *result);
+    void EraseAsyncBatch(uint64_t batchId);
+    void ReapAsyncBatch(PipelinedReadBatch &batch);
+    void StopReadPipelines();
 
     std::string localHost_;
     uint16_t localPort_ = 0;
@@ -70,11 +104,13 @@ private:
     bool finalizing_ = false;
     bool backendInjected_ = false;
     uint64_t inFlightSyncReads_ = 0;
+    size_t asyncReadWindow_ = 0;
 
     std::mutex apiMutex_;
     std::condition_variable apiCv_;
     std::mutex chainMutex_;
     std::mutex endpointCacheMutex_;
+    std::mutex asyncReadMutex_;
 
     std::shared_ptr<ConnectionManager> connMgr_;
     std::shared_ptr<RegisteredMemoryTable> registeredMemory_;
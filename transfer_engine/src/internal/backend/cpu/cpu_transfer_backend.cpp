@@ -0,0 +1,897 @@
+#include "internal/backend/cpu/cpu_transfer_backend.h"
+
+#include <arpa/inet.h>
+#include <endian.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <utility>
+
+#include "internal/control_plane/socket_rpc_transport.h"
+#include "internal/log/logging.h"
+#include "datasystem/transfer_engine/status_helper.h"
+
+namespace datasystem {
+namespace {
+
+constexpr uint32_t K_DATA_MAGIC = 0x54454344;  // 'TECD'
+constexpr uint32_t K_HELLO_MAGIC = 0x54454348;  // 'TECH'
+constexpr int32_t K_DATA_OK = 0;
+constexpr int32_t K_LISTEN_BACKLOG = 128;
+constexpr int32_t K_DEFAULT_STREAMS = 4;
+constexpr int32_t K_MAX_STREAMS = 64;
+constexpr int32_t K_DEFAULT_TRANSFER_TIMEOUT_MS = 10000;
+constexpr int32_t K_MAX_TCP_PORT = 65535;
+constexpr int32_t K_DECIMAL_BASE = 10;
+constexpr int32_t K_MS_PER_SEC = 1000;
+constexpr int32_t K_US_PER_MS = 1000;
+constexpr uint32_t K_MAX_OPS_PER_REQUEST = 4096;
+// Below this size a batch stays on one stream, the setup of the other shards would cost more than it saves.
+constexpr uint64_t K_MIN_SHARD_BYTES = 1ULL << 20;
+// The kernel truncates a single process_vm_readv call near 2 GiB.
+constexpr uint64_t K_MAX_VM_READ_BYTES = 1ULL << 30;
+constexpr size_t K_MAX_VM_READ_IOVS = 1024;
+constexpr size_t K_REQUEST_HEADER_BYTES = 8;
+constexpr size_t K_REQUEST_OP_BYTES = 16;
+constexpr size_t K_RESPONSE_HEADER_BYTES = 16;
+constexpr size_t K_HELLO_BYTES = 16;
+constexpr size_t K_HELLO_ACK_BYTES = 8;
+
+std::string GetEnvOrDefault(const char *name, const std::string &defaultValue)
+{
+    const char *value = std::getenv(name);
+    return value == nullptr || value[0] == '\0' ? defaultValue : std::string(value);
+}
+
+bool ParseU64(const std::string &text, uint64_t *value)
+{
+    if (text.empty()) {
+        return false;
+    }
+    uint64_t parsed = 0;
+    for (char ch : text) {
+        if (ch < '0' || ch > '9') {
+            return false;
+        }
+        const uint64_t digit = static_cast<uint64_t>(ch - '0');
+        if (parsed > (std::numeric_limits<uint64_t>::max() - digit) / K_DECIMAL_BASE) {
+            return false;
+        }
+        parsed = parsed * K_DECIMAL_BASE + digit;
+    }
+    *value = parsed;
+    return true;
+}
+
+int32_t GetEnvI32(const char *name, int32_t defaultValue)
+{
+    uint64_t value = 0;
+    if (!ParseU64(GetEnvOrDefault(name, ""), &value) || value > static_cast<uint64_t>(INT32_MAX)) {
+        return defaultValue;
+    }
+    return static_cast<int32_t>(value);
+}
+
+std::string ReadBootId()
+{
+    std::ifstream input("/proc/sys/kernel/random/boot_id");
+    std::string bootId;
+    if (!std::getline(input, bootId)) {
+        return "";
+    }
+    bootId.erase(std::remove_if(bootId.begin(), bootId.end(), [](unsigned char ch) { return std::isspace(ch); }),
+                 bootId.end());
+    return bootId;
+}
+
+void PutU32(uint32_t value, uint8_t *buf)
+{
+    const uint32_t be = htobe32(value);
+    std::memcpy(buf, &be, sizeof(be));
+}
+
+void PutU64(uint64_t value, uint8_t *buf)
+{
+    const uint64_t be = htobe64(value);
+    std::memcpy(buf, &be, sizeof(be));
+}
+
+uint32_t GetU32(const uint8_t *buf)
+{
+    uint32_t be = 0;
+    std::memcpy(&be, buf, sizeof(be));
+    return be32toh(be);
+}
+
+uint64_t GetU64(const uint8_t *buf)
+{
+    uint64_t be = 0;
+    std::memcpy(&be, buf, sizeof(be));
+    return be64toh(be);
+}
+
+bool RecvAll(int fd, void *buf, size_t n)
+{
+    auto *p = static_cast<uint8_t *>(buf);
+    size_t off = 0;
+    while (off < n) {
+        const ssize_t rc = ::recv(fd, p + off, n - off, 0);
+        if (rc < 0 && errno == EINTR) {
+            continue;
+        }
+        if (rc <= 0) {
+            return false;
+        }
+        off += static_cast<size_t>(rc);
+    }
+    return true;
+}
+
+bool SendAll(int fd, const void *buf, size_t n, int flags = 0)
+{
+    const auto *p = static_cast<const uint8_t *>(buf);
+    size_t off = 0;
+    while (off < n) {
+        const ssize_t rc = ::send(fd, p + off, n - off, flags | MSG_NOSIGNAL);
+        if (rc < 0 && errno == EINTR) {
+            continue;
+        }
+        if (rc <= 0) {
+            return false;
+        }
+        off += static_cast<size_t>(rc);
+    }
+    return true;
+}
+
+// timeoutMs 0 means no timeout.
+void SetSocketTimeoutMs(int fd, int32_t timeoutMs, bool recv = true, bool send = true)
+{
+    timeval tv{};
+    tv.tv_sec = timeoutMs / K_MS_PER_SEC;
+    tv.tv_usec = static_cast<suseconds_t>((timeoutMs % K_MS_PER_SEC) * K_US_PER_MS);
+    if (recv) {
+        (void)setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    }
+    if (send) {
+        (void)setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+    }
+}
+
+void SetNoDelay(int fd)
+{
+    int opt = 1;
+    (void)setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt));
+}
+
+Result GetBoundPort(int fd, uint16_t *port)
+{
+    sockaddr_storage addr{};
+    socklen_t len = sizeof(addr);
+    TE_CHECK_OR_RETURN(::getsockname(fd, reinterpret_cast<sockaddr *>(&addr), &len) == 0, ErrorCode::kRuntimeError,
+                       "getsockname of cpu data server failed");
+    if (addr.ss_family == AF_INET6) {
+        *port = ntohs(reinterpret_cast<const sockaddr_in6 *>(&addr)->sin6_port);
+    } else {
+        *port = ntohs(reinterpret_cast<const sockaddr_in *>(&addr)->sin_port);
+    }
+    return Result::OK();
+}
+
+uint64_t TotalBytes(const std::vector<TransferReadOp> &ops)
+{
+    uint64_t total = 0;
+    for (const auto &op : ops) {
+        total += op.length;
+    }
+    return total;
+}
+
+// Cuts the ops into `count` runs of about the same size, a long op is split between runs.
+std::vector<std::vector<TransferReadOp>> SplitOps(const std::vector<TransferReadOp> &ops, uint64_t total, size_t count)
+{
+    std::vector<std::vector<TransferReadOp>> shards(1);
+    const uint64_t target = (total + count - 1) / count;
+    uint64_t filled = 0;
+    for (const auto &op : ops) {
+        uint64_t offset = 0;
+        while (offset < op.length) {
+            if (filled == target && shards.size() < count) {
+                shards.emplace_back();
+                filled = 0;
+            }
+            const uint64_t take = shards.size() < count ? std::min(op.length - offset, target - filled)
+                                                        : op.length - offset;
+            shards.back().push_back(TransferReadOp{ op.localAddr + offset, op.remoteAddr + offset, take });
+            offset += take;
+            filled += take;
+        }
+    }
+    return shards;
+}
+
+}  // namespace
+
+CpuTransferBackend::PeerLink::~PeerLink()
+{
+    for (auto &stream : streams) {
+        if (stream->fd >= 0) {
+            ::close(stream->fd);
+        }
+    }
+}
+
+CpuTransferBackend::CpuTransferBackend()
+{
+    internal::InitializeLogging();
+}
+
+CpuTransferBackend::~CpuTransferBackend()
+{
+    FinalizeLocal();
+}
+
+Result CpuTransferBackend::InitializeLocal(const std::string &localHost, uint16_t localPort, int32_t localDeviceId)
+{
+    (void)localDeviceId;
+    std::string transport = GetEnvOrDefault("TRANSFER_ENGINE_CPU_TRANSPORT", "auto");
+    std::transform(transport.begin(), transport.end(), transport.begin(), [](unsigned char ch) {
+        return static_cast<char>(std::tolower(ch));
+    });
+    TE_CHECK_OR_RETURN(transport == "auto" || transport == "tcp", ErrorCode::kInvalid,
+                       "TRANSFER_ENGINE_CPU_TRANSPORT should be auto or tcp");
+    const int32_t streams =
+        std::min(std::max(GetEnvI32("TRANSFER_ENGINE_CPU_TCP_STREAMS", K_DEFAULT_STREAMS), 1), K_MAX_STREAMS);
+    const int32_t dataPort = GetEnvI32("TRANSFER_ENGINE_CPU_DATA_PORT", 0);
+    TE_CHECK_OR_RETURN(dataPort <= K_MAX_TCP_PORT, ErrorCode::kInvalid, "TRANSFER_ENGINE_CPU_DATA_PORT is invalid");
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    TE_CHECK_OR_RETURN(!initialized_, ErrorCode::kInvalid, "cpu backend already initialized");
+    int fd = -1;
+    TE_RETURN_IF_ERROR(CreateListenSocket(localHost, static_cast<uint16_t>(dataPort), K_LISTEN_BACKLOG, fd));
+    Result portRc = GetBoundPort(fd, &dataPort_);
+    if (portRc.IsError()) {
+        ::close(fd);
+        return portRc;
+    }
+    listenFd_ = fd;
+    localHost_ = localHost;
+    bootId_ = ReadBootId();
+    transport_ = transport;
+    streamCount_ = static_cast<size_t>(streams);
+    transferTimeoutMs_ = GetEnvI32("TRANSFER_ENGINE_CPU_TRANSFER_TIMEOUT_MS", K_DEFAULT_TRANSFER_TIMEOUT_MS);
+    std::random_device rd;
+    probeValue_ = ((static_cast<uint64_t>(rd()) << 32) | rd()) | 1;
+    dataToken_ = ((static_cast<uint64_t>(rd()) << 32) | rd()) | 1;
+    serving_ = true;
+    acceptThread_ = std::thread([this]() { AcceptLoop(); });
+    initialized_ = true;
+    TE_LOG_INFO << "cpu backend initialized"
+                << ", local_host=" << localHost << ", local_port=" << localPort << ", data_port=" << dataPort_
+                << ", transport=" << transport_ << ", tcp_streams=" << streamCount_
+                << ", transfer_timeout_ms=" << transferTimeoutMs_;
+    return Result::OK();
+}
+
+void CpuTransferBackend::FinalizeLocal()
+{
+    if (serving_.exchange(false)) {
+        ::shutdown(listenFd_, SHUT_RDWR);
+        if (acceptThread_.joinable()) {
+            acceptThread_.join();
+        }
+        ::close(listenFd_);
+        listenFd_ = -1;
+        // The serve threads close their own fds, the nodes stay valid for them until they are joined.
+        std::list<ServeConnection> conns;
+        {
+            std::lock_guard<std::mutex> lock(serveMutex_);
+            for (auto &conn : serveConns_) {
+                if (conn.fd >= 0) {
+                    ::shutdown(conn.fd, SHUT_RDWR);
+                }
+            }
+            conns.swap(serveConns_);
+        }
+        for (auto &conn : conns) {
+            conn.thread.join();
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    peers_.clear();
+    registeredMems_.clear();
+    initialized_ = false;
+}
+
+Result CpuTransferBackend::RegisterLocalMemory(uint64_t addr, uint64_t length)
+{
+    TE_CHECK_OR_RETURN(addr > 0 && length > 0, ErrorCode::kInvalid, "invalid memory region");
+    std::lock_guard<std::mutex> lock(mutex_);
+    TE_CHECK_OR_RETURN(initialized_, ErrorCode::kNotReady, "cpu backend is not initialized");
+    auto existing = registeredMems_.find(addr);
+    if (existing != registeredMems_.end()) {
+        TE_CHECK_OR_RETURN(existing->second.length == length, ErrorCode::kInvalid,
+                           "cpu memory base already registered with different length");
+        return Result::OK();
+    }
+    registeredMems_[addr].length = length;
+    return Result::OK();
+}
+
+Result CpuTransferBackend::UnregisterLocalMemory(uint64_t addr, uint64_t length)
+{
+    TE_CHECK_OR_RETURN(addr > 0 && length > 0, ErrorCode::kInvalid, "invalid memory region");
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto iter = registeredMems_.find(addr);
+    TE_CHECK_OR_RETURN(iter != registeredMems_.end(), ErrorCode::kNotFound, "cpu memory region is not registered");
+    TE_CHECK_OR_RETURN(iter->second.length == length, ErrorCode::kInvalid, "cpu unregister memory length mismatch");
+    // The caller may free the memory once this returns, so wait out the sends from it. They are bounded by the send
+    // timeout of the data server.
+    sendingCv_.wait(lock, [this, addr]() {
+        auto one = registeredMems_.find(addr);
+        return one == registeredMems_.end() || one->second.sending == 0;
+    });
+    registeredMems_.erase(addr);
+    return Result::OK();
+}
+
+Result CpuTransferBackend::CreateRootInfo(std::string *rootInfoBytes)
+{
+    TE_CHECK_PTR_OR_RETURN(rootInfoBytes);
+    std::lock_guard<std::mutex> lock(mutex_);
+    TE_CHECK_OR_RETURN(initialized_, ErrorCode::kNotReady, "cpu backend is not initialized");
+    RootInfo info;
+    info.host = localHost_;
+    info.dataPort = dataPort_;
+    info.bootId = bootId_;
+    info.pid = static_cast<int64_t>(::getpid());
+    info.probeAddr = reinterpret_cast<uint64_t>(&probeValue_);
+    info.probeValue = probeValue_;
+    info.dataToken = dataToken_;
+    *rootInfoBytes = EncodeRootInfo(info);
+    return Result::OK();
+}
+
+Result CpuTransferBackend::InitRecv(const ConnectionSpec &spec, const std::string &rootInfoBytes)
+{
+    RootInfo rootInfo;
+    TE_RETURN_IF_ERROR(ParseRootInfo(rootInfoBytes, &rootInfo));
+    std::string transport;
+    std::string bootId;
+    size_t streamCount = 0;
+    int32_t timeoutMs = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TE_CHECK_OR_RETURN(initialized_, ErrorCode::kNotReady, "cpu backend is not initialized");
+        transport = transport_;
+        bootId = bootId_;
+        streamCount = streamCount_;
+        timeoutMs = transferTimeoutMs_;
+    }
+    auto link = std::make_shared<PeerLink>();
+    link->rootInfo = rootInfo;
+    link->sameHost = transport == "auto" && ProbeSameHost(rootInfo, bootId);
+    if (!link->sameHost) {
+        TE_RETURN_IF_ERROR(ConnectStreams(rootInfo, streamCount, timeoutMs, link.get()));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        peers_[ConnectionKey(spec)] = link;
+    }
+    TE_LOG_INFO << "cpu backend connected"
+                << ", peer=" << spec.peerHost << ":" << spec.peerPort << ", peer_device_id=" << spec.peerDeviceId
+                << ", data_endpoint=" << rootInfo.host << ":" << rootInfo.dataPort
+                << ", transport=" << (link->sameHost ? "process_vm_readv" : "tcp")
+                << ", tcp_streams=" << link->streams.size();
+    return Result::OK();
+}
+
+Result CpuTransferBackend::InitSend(const ConnectionSpec &spec, const std::string &rootInfoBytes)
+{
+    RootInfo rootInfo;
+    TE_RETURN_IF_ERROR(ParseRootInfo(rootInfoBytes, &rootInfo));
+    TE_LOG_INFO << "cpu owner accepted requester root info"
+                << ", requester=" << spec.peerHost << ":" << spec.peerPort
+                << ", requester_device_id=" << spec.peerDeviceId << ", requester_pid=" << rootInfo.pid;
+    return Result::OK();
+}
+
+Result CpuTransferBackend::PostRecv(const ConnectionSpec &spec, uint64_t localAddr, uint64_t length)
+{
+    (void)spec;
+    (void)localAddr;
+    (void)length;
+    return Result(ErrorCode::kNotSupported, "cpu backend uses receiver-driven read");
+}
+
+Result CpuTransferBackend::PostSend(const ConnectionSpec &spec, uint64_t remoteAddr, uint64_t length)
+{
+    (void)spec;
+    (void)remoteAddr;
+    (void)length;
+    return Result(ErrorCode::kNotSupported, "cpu backend uses receiver-driven read");
+}
+
+Result CpuTransferBackend::WaitRecv(const ConnectionSpec &spec, uint64_t timeoutMs)
+{
+    (void)spec;
+    (void)timeoutMs;
+    return Result(ErrorCode::kNotSupported, "cpu backend uses receiver-driven read");
+}
+
+Result CpuTransferBackend::TransferSyncRead(const ConnectionSpec &spec, const std::vector<TransferReadOp> &ops,
+                                            uint64_t timeoutMs)
+{
+    TE_CHECK_OR_RETURN(!ops.empty(), ErrorCode::kInvalid, "read ops is empty");
+    for (const auto &op : ops) {
+        TE_CHECK_OR_RETURN(op.localAddr > 0 && op.remoteAddr > 0 && op.length > 0, ErrorCode::kInvalid,
+                           "invalid cpu read op");
+    }
+    std::shared_ptr<PeerLink> link;
+    int32_t timeout = 0;
+    size_t shardLimit = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = peers_.find(ConnectionKey(spec));
+        TE_CHECK_OR_RETURN(iter != peers_.end(), ErrorCode::kNotReady, "cpu connection not found");
+        link = iter->second;
+        timeout = (timeoutMs == 0 || timeoutMs > static_cast<uint64_t>(INT32_MAX)) ? transferTimeoutMs_
+                                                                                   : static_cast<int32_t>(timeoutMs);
+        shardLimit = link->sameHost ? streamCount_ : link->streams.size();
+    }
+
+    const uint64_t total = TotalBytes(ops);
+    const size_t shardCount = static_cast<size_t>(std::min<uint64_t>(shardLimit, total / K_MIN_SHARD_BYTES));
+    Result rc;
+    if (shardCount <= 1) {
+        rc = ReadShard(*link, link->nextStream.fetch_add(1), ops, timeout);
+    } else {
+        auto shards = SplitOps(ops, total, shardCount);
+        std::vector<Result> results(shards.size());
+        std::vector<std::thread> workers;
+        workers.reserve(shards.size() - 1);
+        for (size_t i = 1; i < shards.size(); ++i) {
+            workers.emplace_back([&, i]() { results[i] = ReadShard(*link, i, shards[i], timeout); });
+        }
+        results[0] = ReadShard(*link, 0, shards[0], timeout);
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        for (auto &one : results) {
+            if (one.IsError()) {
+                rc = one;
+                break;
+            }
+        }
+    }
+    if (rc.IsError()) {
+        TE_LOG_ERROR << "cpu transfer sync read failed"
+                     << ", peer=" << spec.peerHost << ":" << spec.peerPort << ", op_count=" << ops.size()
+                     << ", total_bytes=" << total << ", same_host=" << link->sameHost
+                     << ", reason=" << rc.ToString();
+        AbortConnection(spec);
+        return rc;
+    }
+    TE_VLOG_1 << "cpu transfer sync read success"
+              << ", peer=" << spec.peerHost << ":" << spec.peerPort << ", op_count=" << ops.size()
+              << ", total_bytes=" << total << ", shard_count=" << std::max<size_t>(shardCount, 1)
+              << ", same_host=" << link->sameHost;
+    return Result::OK();
+}
+
+void CpuTransferBackend::AbortConnection(const ConnectionSpec &spec)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    peers_.erase(ConnectionKey(spec));
+}
+
+bool CpuTransferBackend::IsSameHostConnection(const ConnectionSpec &spec) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = peers_.find(ConnectionKey(spec));
+    return iter != peers_.end() && iter->second->sameHost;
+}
+
+std::string CpuTransferBackend::ConnectionKey(const ConnectionSpec &spec)
+{
+    return spec.localHost + ":" + std::to_string(spec.localPort) + ":" + std::to_string(spec.localDeviceId) + "|" +
+           spec.peerHost + ":" + std::to_string(spec.peerPort) + ":" + std::to_string(spec.peerDeviceId);
+}
+
+Result CpuTransferBackend::ParseRootInfo(const std::string &rootInfoBytes, RootInfo *rootInfo)
+{
+    TE_CHECK_PTR_OR_RETURN(rootInfo);
+    std::istringstream input(rootInfoBytes);
+    std::string line;
+    if (!std::getline(input, line) || line != "transfer_engine_cpu_root_info_v1") {
+        return TE_MAKE_STATUS(ErrorCode::kInvalid, "invalid cpu root info header");
+    }
+    uint64_t dataPort = 0;
+    uint64_t pid = 0;
+    while (std::getline(input, line)) {
+        const size_t sep = line.find('=');
+        if (sep == std::string::npos) {
+            continue;
+        }
+        const std::string key = line.substr(0, sep);
+        const std::string value = line.substr(sep + 1);
+        bool ok = true;
+        if (key == "host") {
+            rootInfo->host = value;
+        } else if (key == "data_port") {
+            ok = ParseU64(value, &dataPort);
+        } else if (key == "boot_id") {
+            rootInfo->bootId = value;
+        } else if (key == "pid") {
+            ok = ParseU64(value, &pid);
+        } else if (key == "probe_addr") {
+            ok = ParseU64(value, &rootInfo->probeAddr);
+        } else if (key == "probe_value") {
+            ok = ParseU64(value, &rootInfo->probeValue);
+        } else if (key == "data_token") {
+            ok = ParseU64(value, &rootInfo->dataToken);
+        }
+        TE_CHECK_OR_RETURN(ok, ErrorCode::kInvalid, "invalid cpu root info field: " + key);
+    }
+    TE_CHECK_OR_RETURN(!rootInfo->host.empty(), ErrorCode::kInvalid, "cpu root host is empty");
+    TE_CHECK_OR_RETURN(dataPort > 0 && dataPort <= K_MAX_TCP_PORT, ErrorCode::kInvalid,
+                       "cpu root data port is invalid");
+    TE_CHECK_OR_RETURN(pid <= static_cast<uint64_t>(INT32_MAX), ErrorCode::kInvalid, "cpu root pid is invalid");
+    rootInfo->dataPort = static_cast<uint16_t>(dataPort);
+    rootInfo->pid = static_cast<int64_t>(pid);
+    return Result::OK();
+}
+
+std::string CpuTransferBackend::EncodeRootInfo(const RootInfo &rootInfo)
+{
+    std::ostringstream out;
+    out << "transfer_engine_cpu_root_info_v1\n"
+        << "host=" << rootInfo.host << "\n"
+        << "data_port=" << rootInfo.dataPort << "\n"
+        << "boot_id=" << rootInfo.bootId << "\n"
+        << "pid=" << rootInfo.pid << "\n"
+        << "probe_addr=" << rootInfo.probeAddr << "\n"
+        << "probe_value=" << rootInfo.probeValue << "\n"
+        << "data_token=" << rootInfo.dataToken << "\n";
+    return out.str();
+}
+
+bool CpuTransferBackend::ProbeSameHost(const RootInfo &rootInfo, const std::string &localBootId)
+{
+    if (rootInfo.bootId.empty() || rootInfo.bootId != localBootId || rootInfo.pid <= 0 || rootInfo.probeAddr == 0) {
+        return false;
+    }
+    // The pid may name another process in a different pid namespace, the probe value tells them apart.
+    uint64_t value = 0;
+    iovec local{ &value, sizeof(value) };
+    iovec remote{ reinterpret_cast<void *>(rootInfo.probeAddr), sizeof(value) };
+    const ssize_t rc = ::process_vm_readv(static_cast<pid_t>(rootInfo.pid), &local, 1, &remote, 1, 0);
+    if (rc != static_cast<ssize_t>(sizeof(value)) || value != rootInfo.probeValue) {
+        TE_LOG_INFO << "cpu backend falls back to tcp for a same host peer"
+                    << ", peer_pid=" << rootInfo.pid << ", errno=" << (rc < 0 ? errno : 0);
+        return false;
+    }
+    return true;
+}
+
+Result CpuTransferBackend::ConnectStreams(const RootInfo &rootInfo, size_t streamCount, int32_t timeoutMs,
+                                          PeerLink *link)
+{
+    for (size_t i = 0; i < streamCount; ++i) {
+        int fd = -1;
+        TE_RETURN_IF_ERROR(ConnectTo(rootInfo.host, rootInfo.dataPort, &fd));
+        SetNoDelay(fd);
+        SetSocketTimeoutMs(fd, timeoutMs);
+        Result helloRc = Handshake(fd, rootInfo.dataToken);
+        if (helloRc.IsError()) {
+            ::close(fd);
+            return helloRc;
+        }
+        auto stream = std::make_unique<Stream>();
+        stream->fd = fd;
+        link->streams.push_back(std::move(stream));
+    }
+    return Result::OK();
+}
+
+Result CpuTransferBackend::Handshake(int fd, uint64_t dataToken)
+{
+    uint8_t hello[K_HELLO_BYTES] = {};
+    PutU32(K_HELLO_MAGIC, hello);
+    PutU64(dataToken, hello + sizeof(uint64_t));
+    TE_CHECK_OR_RETURN(SendAll(fd, hello, sizeof(hello)), ErrorCode::kRuntimeError,
+                       "send cpu data hello failed, errno=" + std::to_string(errno));
+    uint8_t ack[K_HELLO_ACK_BYTES];
+    TE_CHECK_OR_RETURN(RecvAll(fd, ack, sizeof(ack)) && GetU32(ack) == K_HELLO_MAGIC, ErrorCode::kRuntimeError,
+                       "recv cpu data hello ack failed, errno=" + std::to_string(errno));
+    const auto code = static_cast<int32_t>(GetU32(ack + sizeof(uint32_t)));
+    TE_CHECK_OR_RETURN(code == K_DATA_OK, static_cast<ErrorCode>(code), "cpu owner rejected the data stream");
+    return Result::OK();
+}
+
+Result CpuTransferBackend::ReadShard(PeerLink &link, size_t streamIndex, const std::vector<TransferReadOp> &ops,
+                                     int32_t timeoutMs)
+{
+    if (link.sameHost) {
+        return ReadFromProcess(static_cast<pid_t>(link.rootInfo.pid), ops);
+    }
+    return ReadFromStream(*link.streams[streamIndex % link.streams.size()], ops, timeoutMs);
+}
+
+Result CpuTransferBackend::ReadFromProcess(pid_t pid, const std::vector<TransferReadOp> &ops)
+{
+    std::vector<iovec> local;
+    std::vector<iovec> remote;
+    size_t index = 0;
+    uint64_t offset = 0;
+    while (index < ops.size()) {
+        local.clear();
+        remote.clear();
+        uint64_t batchBytes = 0;
+        for (size_t i = index; i < ops.size() && local.size() < K_MAX_VM_READ_IOVS && batchBytes < K_MAX_VM_READ_BYTES;
+             ++i) {
+            const uint64_t skip = i == index ? offset : 0;
+            const uint64_t len = std::min(ops[i].length - skip, K_MAX_VM_READ_BYTES - batchBytes);
+            local.push_back(iovec{ reinterpret_cast<void *>(ops[i].localAddr + skip), static_cast<size_t>(len) });
+            remote.push_back(iovec{ reinterpret_cast<void *>(ops[i].remoteAddr + skip), static_cast<size_t>(len) });
+            batchBytes += len;
+        }
+        const ssize_t rc = ::process_vm_readv(pid, local.data(), local.size(), remote.data(), remote.size(), 0);
+        if (rc <= 0) {
+            return TE_MAKE_STATUS(ErrorCode::kRuntimeError,
+                                  "process_vm_readv failed, errno=" + std::to_string(rc < 0 ? errno : 0));
+        }
+        // A short read stops at an iovec boundary or a fault, continue from where it stopped.
+        uint64_t done = static_cast<uint64_t>(rc);
+        while (done > 0) {
+            const uint64_t left = ops[index].length - offset;
+            if (done < left) {
+                offset += done;
+                break;
+            }
+            done -= left;
+            ++index;
+            offset = 0;
+        }
+    }
+    return Result::OK();
+}
+
+Result CpuTransferBackend::ReadFromStream(Stream &stream, const std::vector<TransferReadOp> &ops, int32_t timeoutMs)
+{
+    std::lock_guard<std::mutex> lock(stream.mutex);
+    TE_CHECK_OR_RETURN(stream.fd >= 0, ErrorCode::kNotReady, "cpu data stream is closed");
+    SetSocketTimeoutMs(stream.fd, timeoutMs);
+    auto fail = [&stream](const std::string &msg) {
+        ::close(stream.fd);
+        stream.fd = -1;
+        return TE_MAKE_STATUS(ErrorCode::kRuntimeError, msg);
+    };
+    std::vector<uint8_t> request;
+    for (size_t base = 0; base < ops.size(); base += K_MAX_OPS_PER_REQUEST) {
+        const size_t end = std::min(base + K_MAX_OPS_PER_REQUEST, ops.size());
+        request.assign(K_REQUEST_HEADER_BYTES + (end - base) * K_REQUEST_OP_BYTES, 0);
+        PutU32(K_DATA_MAGIC, request.data());
+        PutU32(static_cast<uint32_t>(end - base), request.data() + sizeof(uint32_t));
+        uint64_t expected = 0;
+        for (size_t i = base; i < end; ++i) {
+            uint8_t *slot = request.data() + K_REQUEST_HEADER_BYTES + (i - base) * K_REQUEST_OP_BYTES;
+            PutU64(ops[i].remoteAddr, slot);
+            PutU64(ops[i].length, slot + sizeof(uint64_t));
+            expected += ops[i].length;
+        }
+        if (!SendAll(stream.fd, request.data(), request.size())) {
+            return fail("send cpu read request failed, errno=" + std::to_string(errno));
+        }
+        uint8_t header[K_RESPONSE_HEADER_BYTES];
+        if (!RecvAll(stream.fd, header, sizeof(header)) || GetU32(header) != K_DATA_MAGIC) {
+            return fail("recv cpu read response failed, errno=" + std::to_string(errno));
+        }
+        const auto code = static_cast<int32_t>(GetU32(header + sizeof(uint32_t)));
+        if (code != K_DATA_OK) {
+            // The owner rejected the request before sending any data, the stream stays usable.
+            return TE_MAKE_STATUS(static_cast<ErrorCode>(code), "cpu owner rejected read request");
+        }
+        if (GetU64(header + sizeof(uint64_t)) != expected) {
+            return fail("cpu read response length mismatch");
+        }
+        for (size_t i = base; i < end; ++i) {
+            if (!RecvAll(stream.fd, reinterpret_cast<void *>(ops[i].localAddr), ops[i].length)) {
+                return fail("recv cpu read payload failed, errno=" + std::to_string(errno));
+            }
+        }
+    }
+    return Result::OK();
+}
+
+void CpuTransferBackend::AcceptLoop()
+{
+    while (serving_) {
+        const int fd = ::accept(listenFd_, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (serving_) {
+                TE_LOG_WARNING << "cpu data server accept failed, errno=" << errno;
+                continue;
+            }
+            break;
+        }
+        SetNoDelay(fd);
+        std::lock_guard<std::mutex> lock(serveMutex_);
+        if (!serving_) {
+            ::close(fd);
+            break;
+        }
+        ReapServeConnectionsLocked();
+        serveConns_.emplace_back();
+        ServeConnection *conn = &serveConns_.back();
+        conn->fd = fd;
+        conn->thread = std::thread([this, conn, fd]() {
+            ServeStream(fd);
+            std::lock_guard<std::mutex> serveLock(serveMutex_);
+            ::close(conn->fd);
+            conn->fd = -1;
+            conn->done = true;
+        });
+    }
+}
+
+void CpuTransferBackend::ReapServeConnectionsLocked()
+{
+    for (auto iter = serveConns_.begin(); iter != serveConns_.end();) {
+        if (!iter->done) {
+            ++iter;
+            continue;
+        }
+        // Done is set as the last step of the thread under serveMutex_, so the join returns at once.
+        iter->thread.join();
+        iter = serveConns_.erase(iter);
+    }
+}
+
+bool CpuTransferBackend::AcceptHandshake(int fd)
+{
+    int32_t timeoutMs = 0;
+    uint64_t dataToken = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        timeoutMs = transferTimeoutMs_;
+        dataToken = dataToken_;
+    }
+    // A peer that stays silent must not hold a serve thread, and a requester that stops reading must not hold a send
+    // ref on the registered memory, so sends keep the timeout for the life of the stream.
+    SetSocketTimeoutMs(fd, timeoutMs);
+    uint8_t hello[K_HELLO_BYTES];
+    if (!RecvAll(fd, hello, sizeof(hello)) || GetU32(hello) != K_HELLO_MAGIC) {
+        TE_LOG_WARNING << "cpu data server dropped a stream without hello, errno=" << errno;
+        return false;
+    }
+    const bool accepted = GetU64(hello + sizeof(uint64_t)) == dataToken;
+    uint8_t ack[K_HELLO_ACK_BYTES];
+    PutU32(K_HELLO_MAGIC, ack);
+    PutU32(static_cast<uint32_t>(accepted ? K_DATA_OK : static_cast<int32_t>(ErrorCode::kNotAuthorized)),
+           ack + sizeof(uint32_t));
+    if (!SendAll(fd, ack, sizeof(ack)) || !accepted) {
+        if (!accepted) {
+            TE_LOG_WARNING << "cpu data server rejected a stream with a wrong data token";
+        }
+        return false;
+    }
+    // Idle streams are kept by the requester between reads.
+    SetSocketTimeoutMs(fd, 0, true, false);
+    return true;
+}
+
+void CpuTransferBackend::ServeStream(int fd)
+{
+    if (!AcceptHandshake(fd)) {
+        return;
+    }
+    std::vector<uint8_t> request;
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    std::vector<uint64_t> bases;
+    for (;;) {
+        uint8_t header[K_REQUEST_HEADER_BYTES];
+        if (!RecvAll(fd, header, sizeof(header))) {
+            return;
+        }
+        const uint32_t opCount = GetU32(header + sizeof(uint32_t));
+        if (GetU32(header) != K_DATA_MAGIC || opCount == 0 || opCount > K_MAX_OPS_PER_REQUEST) {
+            TE_LOG_WARNING << "cpu data server dropped a malformed request, op_count=" << opCount;
+            return;
+        }
+        request.resize(static_cast<size_t>(opCount) * K_REQUEST_OP_BYTES);
+        if (!RecvAll(fd, request.data(), request.size())) {
+            return;
+        }
+        ranges.clear();
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < opCount; ++i) {
+            const uint64_t addr = GetU64(request.data() + i * K_REQUEST_OP_BYTES);
+            const uint64_t length = GetU64(request.data() + i * K_REQUEST_OP_BYTES + sizeof(uint64_t));
+            ranges.emplace_back(addr, length);
+            total += length;
+        }
+        int32_t code = K_DATA_OK;
+        // The send refs keep the regions registered, and so their memory alive, until the data is sent.
+        if (!AcquireRegisteredRanges(ranges, &bases)) {
+            code = static_cast<int32_t>(ErrorCode::kNotAuthorized);
+            total = 0;
+        }
+        uint8_t rsp[K_RESPONSE_HEADER_BYTES];
+        PutU32(K_DATA_MAGIC, rsp);
+        PutU32(static_cast<uint32_t>(code), rsp + sizeof(uint32_t));
+        PutU64(total, rsp + sizeof(uint64_t));
+        bool sent = SendAll(fd, rsp, sizeof(rsp), code == K_DATA_OK ? MSG_MORE : 0);
+        if (code != K_DATA_OK) {
+            if (!sent) {
+                return;
+            }
+            continue;
+        }
+        for (size_t i = 0; sent && i < ranges.size(); ++i) {
+            sent = SendAll(fd, reinterpret_cast<const void *>(ranges[i].first), ranges[i].second,
+                           i + 1 < ranges.size() ? MSG_MORE : 0);
+        }
+        ReleaseRegisteredRanges(bases);
+        if (!sent) {
+            return;
+        }
+    }
+}
+
+bool CpuTransferBackend::AcquireRegisteredRanges(const std::vector<std::pair<uint64_t, uint64_t>> &ranges,
+                                                 std::vector<uint64_t> *bases)
+{
+    bases->clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &range : ranges) {
+        const uint64_t addr = range.first;
+        const uint64_t length = range.second;
+        auto iter = registeredMems_.upper_bound(addr);
+        if (addr == 0 || length == 0 || addr > std::numeric_limits<uint64_t>::max() - length ||
+            iter == registeredMems_.begin() || addr + length > std::prev(iter)->first + std::prev(iter)->second.length) {
+            TE_LOG_WARNING << "cpu data server rejected an unregistered range"
+                           << ", addr=0x" << std::hex << addr << std::dec << ", length=" << length;
+            bases->clear();
+            return false;
+        }
+        bases->push_back(std::prev(iter)->first);
+    }
+    for (uint64_t base : *bases) {
+        ++registeredMems_[base].sending;
+    }
+    return true;
+}
+
+void CpuTransferBackend::ReleaseRegisteredRanges(const std::vector<uint64_t> &bases)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (uint64_t base : bases) {
+            auto iter = registeredMems_.find(base);
+            if (iter != registeredMems_.end()) {
+                --iter->second.sending;
+            }
+        }
+    }
+    sendingCv_.notify_all();
+}
+
+}  // namespace datasystem
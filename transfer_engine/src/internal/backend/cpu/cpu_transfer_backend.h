@@ -0,0 +1,133 @@
+#ifndef TRANSFER_ENGINE_INTERNAL_CPU_TRANSFER_BACKEND_H
+#define TRANSFER_ENGINE_INTERNAL_CPU_TRANSFER_BACKEND_H
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "datasystem/transfer_engine/data_plane_backend.h"
+
+namespace datasystem {
+
+// Receiver-driven reads of host memory. A peer on the same host is read with process_vm_readv, any other peer through
+// a few parallel TCP streams to the data server of the owner, which sends the registered ranges straight from memory.
+// A stream is only served after it presents the data token of the owner, which travels in the root info over the
+// control plane.
+class CpuTransferBackend final : public IDataPlaneBackend {
+public:
+    CpuTransferBackend();
+    ~CpuTransferBackend() override;
+
+    bool RequiresAclRuntime() const override { return false; }
+    std::string BackendKind() const override { return "cpu"; }
+    bool SupportsReceiverDrivenRead() const override { return true; }
+
+    Result InitializeLocal(const std::string &localHost, uint16_t localPort, int32_t localDeviceId) override;
+    void FinalizeLocal() override;
+    Result RegisterLocalMemory(uint64_t addr, uint64_t length) override;
+    Result UnregisterLocalMemory(uint64_t addr, uint64_t length) override;
+
+    Result CreateRootInfo(std::string *rootInfoBytes) override;
+    Result InitRecv(const ConnectionSpec &spec, const std::string &rootInfoBytes) override;
+    Result InitSend(const ConnectionSpec &spec, const std::string &rootInfoBytes) override;
+    Result PostRecv(const ConnectionSpec &spec, uint64_t localAddr, uint64_t length) override;
+    Result PostSend(const ConnectionSpec &spec, uint64_t remoteAddr, uint64_t length) override;
+    Result WaitRecv(const ConnectionSpec &spec, uint64_t timeoutMs) override;
+    Result TransferSyncRead(const ConnectionSpec &spec, const std::vector<TransferReadOp> &ops,
+                            uint64_t timeoutMs) override;
+    void AbortConnection(const ConnectionSpec &spec) override;
+
+    // Whether the reads of the connection bypass TCP, false when it is not connected.
+    bool IsSameHostConnection(const ConnectionSpec &spec) const;
+
+private:
+    struct RootInfo {
+        std::string host;
+        uint16_t dataPort = 0;
+        std::string bootId;
+        int64_t pid = 0;
+        uint64_t probeAddr = 0;
+        uint64_t probeValue = 0;
+        uint64_t dataToken = 0;
+    };
+    struct Stream {
+        std::mutex mutex;
+        int fd = -1;
+    };
+    struct RegisteredMem {
+        uint64_t length = 0;
+        // Ranges of the region the data server is sending, unregister waits until it drops to zero.
+        uint64_t sending = 0;
+    };
+    struct ServeConnection {
+        // Closed and set to -1 by the serve thread under serveMutex_ when it exits.
+        int fd = -1;
+        bool done = false;
+        std::thread thread;
+    };
+    struct PeerLink {
+        RootInfo rootInfo;
+        bool sameHost = false;
+        std::vector<std::unique_ptr<Stream>> streams;
+        std::atomic<size_t> nextStream{ 0 };
+        ~PeerLink();
+    };
+
+    static std::string ConnectionKey(const ConnectionSpec &spec);
+    static Result ParseRootInfo(const std::string &rootInfoBytes, RootInfo *rootInfo);
+    static std::string EncodeRootInfo(const RootInfo &rootInfo);
+
+    static bool ProbeSameHost(const RootInfo &rootInfo, const std::string &localBootId);
+    static Result ConnectStreams(const RootInfo &rootInfo, size_t streamCount, int32_t timeoutMs, PeerLink *link);
+    static Result Handshake(int fd, uint64_t dataToken);
+    static Result ReadShard(PeerLink &link, size_t streamIndex, const std::vector<TransferReadOp> &ops,
+                            int32_t timeoutMs);
+    static Result ReadFromProcess(pid_t pid, const std::vector<TransferReadOp> &ops);
+    static Result ReadFromStream(Stream &stream, const std::vector<TransferReadOp> &ops, int32_t timeoutMs);
+
+    void AcceptLoop();
+    void ReapServeConnectionsLocked();
+    void ServeStream(int fd);
+    bool AcceptHandshake(int fd);
+    // Takes a send ref on the registered region of every range, nothing is taken when one is not registered.
+    bool AcquireRegisteredRanges(const std::vector<std::pair<uint64_t, uint64_t>> &ranges,
+                                 std::vector<uint64_t> *bases);
+    void ReleaseRegisteredRanges(const std::vector<uint64_t> &bases);
+
+    mutable std::mutex mutex_;
+    bool initialized_ = false;
+    std::string localHost_;
+    std::string bootId_;
+    std::string transport_ = "auto";
+    size_t streamCount_ = 0;
+    int32_t transferTimeoutMs_ = 0;
+    // Read by a same-host requester to prove that it can reach the memory of this process.
+    uint64_t probeValue_ = 0;
+    uint64_t dataToken_ = 0;
+    std::map<uint64_t, RegisteredMem> registeredMems_;
+    std::condition_variable sendingCv_;
+    std::unordered_map<std::string, std::shared_ptr<PeerLink>> peers_;
+
+    int listenFd_ = -1;
+    uint16_t dataPort_ = 0;
+    std::atomic<bool> serving_{ false };
+    std::thread acceptThread_;
+    std::mutex serveMutex_;
+    std::list<ServeConnection> serveConns_;
+};
+
+}  // namespace datasystem
+
+#endif  // TRANSFER_ENGINE_INTERNAL_CPU_TRANSFER_BACKEND_H
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cstring>
+#include <thread>
 #include <utility>
 
 #include "datasystem/transfer_engine/status_helper.h"
@@ -45,14 +46,17 @@ Result MockDataPlaneBackend::PostRecv(const ConnectionSpec &spec, uint64_t local
     TE_CHECK_OR_RETURN(localAddr > 0 && length > 0, ErrorCode::kInvalid, "invalid recv args");
     std::lock_guard<std::mutex> lock(sharedState_->mutex);
     sharedState_->pendingRecv[RecvKey(spec)].push_back(PendingRecv{ localAddr, length, false });
+    ++sharedState_->inFlightRecv;
+    sharedState_->peakInFlightRecv = std::max(sharedState_->peakInFlightRecv, sharedState_->inFlightRecv);
+    sharedState_->cv.notify_all();
     return Result::OK();
 }
 
 Result MockDataPlaneBackend::PostSend(const ConnectionSpec &spec, uint64_t remoteAddr, uint64_t length)
 {
     TE_CHECK_OR_RETURN(remoteAddr > 0 && length > 0, ErrorCode::kInvalid, "invalid send args");
-
-    std::lock_guard<std::mutex> lock(sharedState_->mutex);
+    std::unique_lock<std::mutex> lock(sharedState_->mutex);
+    sharedState_->cv.wait(lock, [this]() { return !sharedState_->holdSends; });
     const std::string key = SendToRecvKey(spec);
     auto iter = sharedState_->pendingRecv.find(key);
     TE_CHECK_OR_RETURN(iter != sharedState_->pendingRecv.end() && !iter->second.empty(),
@@ -66,6 +70,7 @@ Result MockDataPlaneBackend::PostSend(const ConnectionSpec &spec, uint64_t remot
 
     std::memcpy(reinterpret_cast<void *>(pending.localAddr), reinterpret_cast<void *>(remoteAddr), length);
     pending.completed = true;
+    pending.readyAt = std::chrono::steady_clock::now() + std::chrono::microseconds(sharedState_->opLatencyUs);
     sharedState_->cv.notify_all();
     return Result::OK();
 }
@@ -73,18 +78,29 @@ Result MockDataPlaneBackend::PostSend(const ConnectionSpec &spec, uint64_t remot
 Result MockDataPlaneBackend::WaitRecv(const ConnectionSpec &spec, uint64_t timeoutMs)
 {
     const std::string key = RecvKey(spec);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
     std::unique_lock<std::mutex> lock(sharedState_->mutex);
     auto ready = [&]() {
         auto it = sharedState_->pendingRecv.find(key);
-        return it != sharedState_->pendingRecv.end() && !it->second.empty() && it->second.front().completed;
+        return !sharedState_->holdCompletions && it != sharedState_->pendingRecv.end() && !it->second.empty() &&
+               it->second.front().completed;
     };
 
-    if (!sharedState_->cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), ready)) {
+    if (!sharedState_->cv.wait_until(lock, deadline, ready)) {
         return TE_MAKE_STATUS(ErrorCode::kNotReady, "wait recv timeout");
     }
+    // The data is in place already, the op only counts as done once its latency has passed.
+    const auto readyAt = sharedState_->pendingRecv[key].front().readyAt;
+    if (readyAt > std::chrono::steady_clock::now()) {
+        TE_CHECK_OR_RETURN(readyAt <= deadline, ErrorCode::kNotReady, "wait recv timeout");
+        lock.unlock();
+        std::this_thread::sleep_until(readyAt);
+        lock.lock();
+    }
     auto it = sharedState_->pendingRecv.find(key);
     if (it != sharedState_->pendingRecv.end() && !it->second.empty()) {
         it->second.pop_front();
+        --sharedState_->inFlightRecv;
         if (it->second.empty()) {
             sharedState_->pendingRecv.erase(it);
         }
@@ -95,7 +111,12 @@ Result MockDataPlaneBackend::WaitRecv(const ConnectionSpec &spec, uint64_t timeo
 void MockDataPlaneBackend::AbortConnection(const ConnectionSpec &spec)
 {
     std::lock_guard<std::mutex> lock(sharedState_->mutex);
-    sharedState_->pendingRecv.erase(RecvKey(spec));
+    auto it = sharedState_->pendingRecv.find(RecvKey(spec));
+    if (it == sharedState_->pendingRecv.end()) {
+        return;
+    }
+    sharedState_->inFlightRecv -= it->second.size();
+    sharedState_->pendingRecv.erase(it);
 }
 
 std::string MockDataPlaneBackend::RecvKey(const ConnectionSpec &spec)
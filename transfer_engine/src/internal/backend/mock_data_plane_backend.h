@@ -1,6 +1,7 @@
 #ifndef TRANSFER_ENGINE_INTERNAL_MOCK_DATA_PLANE_BACKEND_H
 #define TRANSFER_ENGINE_INTERNAL_MOCK_DATA_PLANE_BACKEND_H
 
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <deque>
@@ -19,12 +20,22 @@ public:
         uint64_t localAddr = 0;
         uint64_t length = 0;
         bool completed = false;
+        std::chrono::steady_clock::time_point readyAt;
     };
 
     struct SharedState {
         std::mutex mutex;
         std::condition_variable cv;
         std::unordered_map<std::string, std::deque<PendingRecv>> pendingRecv;
+        // Time from PostSend until WaitRecv sees the recv completed, models the latency of a data plane op.
+        uint64_t opLatencyUs = 0;
+        // While set PostSend waits before it fills the recv, models a slow owner.
+        bool holdSends = false;
+        // While set WaitRecv sees no recv completed, so tests can hold batches in flight.
+        bool holdCompletions = false;
+        // Recvs posted and not yet waited for, and the most of them seen at once.
+        size_t inFlightRecv = 0;
+        size_t peakInFlightRecv = 0;
     };
 
     MockDataPlaneBackend();
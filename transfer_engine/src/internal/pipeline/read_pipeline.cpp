@@ -0,0 +1,196 @@
+#include "internal/pipeline/read_pipeline.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "internal/log/logging.h"
+#include "datasystem/transfer_engine/status_helper.h"
+
+namespace datasystem {
+
+bool PipelinedReadBatch::WaitDone(uint64_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (timeoutMs == 0) {
+        cv.wait(lock, [this]() { return done; });
+        return true;
+    }
+    return cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]() { return done; });
+}
+
+ReadPipeline::ReadPipeline(std::string name, size_t window, Steps steps)
+    : name_(std::move(name)), window_(std::max<size_t>(window, 1)), steps_(std::move(steps))
+{
+    issueThread_ = std::thread([this]() { IssueLoop(); });
+    completeThread_ = std::thread([this]() { CompleteLoop(); });
+}
+
+ReadPipeline::~ReadPipeline()
+{
+    Stop();
+}
+
+Result ReadPipeline::Submit(const std::shared_ptr<PipelinedReadBatch> &batch)
+{
+    TE_CHECK_PTR_OR_RETURN(batch);
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return stop_ || outstanding_ < window_; });
+    TE_CHECK_OR_RETURN(!stop_, ErrorCode::kNotReady, "transfer engine is finalizing");
+    ++outstanding_;
+    queued_.push_back(batch);
+    cv_.notify_all();
+    return Result::OK();
+}
+
+Result ReadPipeline::Cancel(uint64_t batchId)
+{
+    std::shared_ptr<PipelinedReadBatch> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = std::find_if(queued_.begin(), queued_.end(),
+                                 [batchId](const std::shared_ptr<PipelinedReadBatch> &one) {
+                                     return one->batchId == batchId;
+                                 });
+        TE_CHECK_OR_RETURN(iter != queued_.end(), ErrorCode::kNotReady, "batch is already issued or completed");
+        batch = *iter;
+        queued_.erase(iter);
+    }
+    Finish(*batch, TE_MAKE_STATUS(ErrorCode::kInterrupted, "batch is cancelled"));
+    return Result::OK();
+}
+
+void ReadPipeline::Stop()
+{
+    std::deque<std::shared_ptr<PipelinedReadBatch>> dropped;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        dropped.swap(queued_);
+        cv_.notify_all();
+    }
+    for (auto &batch : dropped) {
+        Finish(*batch, TE_MAKE_STATUS(ErrorCode::kNotReady, "transfer engine is finalizing"));
+    }
+    if (issueThread_.joinable()) {
+        issueThread_.join();
+    }
+    if (completeThread_.joinable()) {
+        completeThread_.join();
+    }
+}
+
+void ReadPipeline::IssueLoop()
+{
+    if (steps_.threadInit) {
+        Result initRc = steps_.threadInit();
+        if (initRc.IsError()) {
+            TE_LOG_ERROR << "read pipeline issue thread init failed, peer=" << name_ << ", reason=" << initRc.ToString();
+        }
+    }
+    for (;;) {
+        std::shared_ptr<PipelinedReadBatch> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stop_ || !queued_.empty(); });
+            if (queued_.empty()) {
+                break;
+            }
+            batch = queued_.front();
+            queued_.pop_front();
+        }
+        Result rc;
+        {
+            std::lock_guard<std::mutex> issueLock(issueMutex_);
+            rc = steps_.issue(*batch);
+        }
+        if (rc.IsOk()) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            issued_.push_back(std::move(batch));
+            cv_.notify_all();
+            continue;
+        }
+        // The earlier batches were accepted by the peer, let them land before the connection state is dropped.
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return issued_.empty(); });
+        }
+        {
+            std::lock_guard<std::mutex> issueLock(issueMutex_);
+            steps_.abort(*batch);
+        }
+        Finish(*batch, rc);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    issueExited_ = true;
+    cv_.notify_all();
+}
+
+void ReadPipeline::CompleteLoop()
+{
+    if (steps_.threadInit) {
+        Result initRc = steps_.threadInit();
+        if (initRc.IsError()) {
+            TE_LOG_ERROR << "read pipeline complete thread init failed, peer=" << name_
+                         << ", reason=" << initRc.ToString();
+        }
+    }
+    for (;;) {
+        std::shared_ptr<PipelinedReadBatch> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return issueExited_ || !issued_.empty(); });
+            if (issued_.empty()) {
+                break;
+            }
+            batch = issued_.front();
+        }
+        Result rc = steps_.complete(*batch);
+        std::deque<std::shared_ptr<PipelinedReadBatch>> later;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            issued_.pop_front();
+            if (rc.IsError()) {
+                later.swap(issued_);
+            }
+            cv_.notify_all();
+        }
+        if (rc.IsOk()) {
+            Finish(*batch, rc);
+            continue;
+        }
+        // The later batches share the broken connection, fail them rather than wait for each to time out.
+        TE_LOG_ERROR << "read pipeline batch failed, peer=" << name_ << ", batch_id=" << batch->batchId
+                     << ", failed_later_batches=" << later.size() << ", reason=" << rc.ToString();
+        {
+            std::lock_guard<std::mutex> issueLock(issueMutex_);
+            steps_.abort(*batch);
+            for (auto &one : later) {
+                steps_.abort(*one);
+            }
+        }
+        const std::string laterMsg = "earlier batch on the connection failed: " + rc.GetMsg();
+        Finish(*batch, rc);
+        for (auto &one : later) {
+            Finish(*one, TE_MAKE_STATUS(rc.GetCode(), laterMsg));
+        }
+    }
+}
+
+void ReadPipeline::Finish(PipelinedReadBatch &batch, Result rc)
+{
+    {
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        batch.result = std::move(rc);
+        batch.done = true;
+    }
+    batch.cv.notify_all();
+    if (batch.onDone) {
+        batch.onDone(batch);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    --outstanding_;
+    cv_.notify_all();
+}
+
+}  // namespace datasystem
@@ -0,0 +1,89 @@
+#ifndef TRANSFER_ENGINE_INTERNAL_READ_PIPELINE_H
+#define TRANSFER_ENGINE_INTERNAL_READ_PIPELINE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "datasystem/transfer_engine/data_plane_backend.h"
+#include "datasystem/transfer_engine/status.h"
+
+namespace datasystem {
+
+struct PipelinedReadBatch {
+    uint64_t batchId = 0;
+    uint64_t requestIdStart = 0;
+    std::vector<TransferReadOp> ops;
+    // peerDeviceId stays -1 until the issue step has built the connection.
+    ConnectionSpec spec;
+    uint64_t ownerMemGeneration = 0;
+    uint64_t readLeaseId = 0;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    Result result;
+    // Called once the batch is done, outside of any pipeline lock.
+    std::function<void(PipelinedReadBatch &batch)> onDone;
+
+    // Returns false on timeout, timeoutMs 0 waits without limit.
+    bool WaitDone(uint64_t timeoutMs);
+};
+
+// Reads of one peer connection. Batches are issued one by one in submission order by the issue thread and completed
+// in the same order by the complete thread, so the issue of the next batch overlaps the data transfer of the earlier
+// ones. At most `window` batches are outstanding, Submit blocks while the window is full.
+class ReadPipeline final {
+public:
+    struct Steps {
+        // Posts the batch to the peer, the complete step then waits for its data.
+        std::function<Result(PipelinedReadBatch &batch)> issue;
+        std::function<Result(PipelinedReadBatch &batch)> complete;
+        // Drops the data plane state of a failed batch, called after the earlier batches have completed.
+        std::function<void(PipelinedReadBatch &batch)> abort;
+        std::function<Result()> threadInit;
+    };
+
+    ReadPipeline(std::string name, size_t window, Steps steps);
+    ~ReadPipeline();
+
+    ReadPipeline(const ReadPipeline &) = delete;
+    ReadPipeline &operator=(const ReadPipeline &) = delete;
+
+    Result Submit(const std::shared_ptr<PipelinedReadBatch> &batch);
+    // Only a batch which is not issued yet can be cancelled, it completes with kInterrupted.
+    Result Cancel(uint64_t batchId);
+    // Fails the queued batches, completes the issued ones and joins the threads.
+    void Stop();
+
+private:
+    void IssueLoop();
+    void CompleteLoop();
+    void Finish(PipelinedReadBatch &batch, Result rc);
+
+    const std::string name_;
+    const size_t window_;
+    const Steps steps_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::shared_ptr<PipelinedReadBatch>> queued_;
+    std::deque<std::shared_ptr<PipelinedReadBatch>> issued_;
+    size_t outstanding_ = 0;
+    bool stop_ = false;
+    bool issueExited_ = false;
+    // Held by an issue and by the abort of a failed batch, so an abort never races with the posting of a batch.
+    std::mutex issueMutex_;
+    std::thread issueThread_;
+    std::thread completeThread_;
+};
+
+}  // namespace datasystem
+
+#endif  // TRANSFER_ENGINE_INTERNAL_READ_PIPELINE_H
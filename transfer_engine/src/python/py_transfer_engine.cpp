@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <pybind11/pybind11.h>
@@ -63,6 +64,33 @@ public:
         return engine_->BatchTransferSyncRead(targetHostname, buffers, peerBufferAddresses, lengths);
     }
 
+    std::tuple<Result, uint64_t> BatchTransferAsyncRead(const std::string &targetHostname,
+                                                        const std::vector<uintptr_t> &buffers,
+                                                        const std::vector<uintptr_t> &peerBufferAddresses,
+                                                        const std::vector<size_t> &lengths)
+    {
+        uint64_t batchId = 0;
+        Result rc = engine_->BatchTransferAsyncRead(targetHostname, buffers, peerBufferAddresses, lengths, &batchId);
+        return std::make_tuple(rc, batchId);
+    }
+
+    std::tuple<Result, bool> PollTransfer(uint64_t batchId)
+    {
+        bool completed = false;
+        Result rc = engine_->PollTransfer(batchId, &completed);
+        return std::make_tuple(rc, completed);
+    }
+
+    Result WaitTransfer(uint64_t batchId, uint64_t timeoutMs)
+    {
+        return engine_->WaitTransfer(batchId, timeoutMs);
+    }
+
+    Result CancelTransfer(uint64_t batchId)
+    {
+        return engine_->CancelTransfer(batchId);
+    }
+
     Result Finalize()
     {
         return engine_->Finalize();
@@ -86,6 +114,7 @@ PYBIND11_MODULE(_transfer_engine, m)
         .value("kRuntimeError", datasystem::ErrorCode::kRuntimeError)
         .value("kNotReady", datasystem::ErrorCode::kNotReady)
         .value("kNotAuthorized", datasystem::ErrorCode::kNotAuthorized)
+        .value("kInterrupted", datasystem::ErrorCode::kInterrupted)
         .value("kNotSupported", datasystem::ErrorCode::kNotSupported)
         .export_values();
 
@@ -117,5 +146,12 @@ PYBIND11_MODULE(_transfer_engine, m)
              py::arg("target_hostname"), py::arg("buffer"), py::arg("peer_buffer_address"), py::arg("length"))
         .def("batch_transfer_sync_read", &datasystem::PyTransferEngine::BatchTransferSyncRead,
              py::arg("target_hostname"), py::arg("buffers"), py::arg("peer_buffer_addresses"), py::arg("lengths"))
+        .def("batch_transfer_async_read", &datasystem::PyTransferEngine::BatchTransferAsyncRead,
+             py::arg("target_hostname"), py::arg("buffers"), py::arg("peer_buffer_addresses"), py::arg("lengths"),
+             py::call_guard<py::gil_scoped_release>())
+        .def("poll_transfer", &datasystem::PyTransferEngine::PollTransfer, py::arg("batch_id"))
+        .def("wait_transfer", &datasystem::PyTransferEngine::WaitTransfer, py::arg("batch_id"),
+             py::arg("timeout_ms") = 0, py::call_guard<py::gil_scoped_release>())
+        .def("cancel_transfer", &datasystem::PyTransferEngine::CancelTransfer, py::arg("batch_id"))
         .def("finalize", &datasystem::PyTransferEngine::Finalize);
 }
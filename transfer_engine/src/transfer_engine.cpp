@@ -4,6 +4,7 @@
 #include <chrono>
 #include <cctype>
 #include <cstdlib>
+#include <deque>
 #include <functional>
 #include <iomanip>
 #include <thread>
@@ -13,6 +14,7 @@
 #include "internal/connection/connection_manager.h"
 #include "internal/control_plane/control_plane.h"
 #include "internal/backend/mock_data_plane_backend.h"
+#include "internal/backend/cpu/cpu_transfer_backend.h"
 #include "internal/control_plane/transfer_control_service.h"
 #include "internal/log/logging.h"
 #include "internal/log/environment_dump.h"
@@ -24,6 +26,7 @@
 #include "internal/backend/ascend/hixl_d2d_backend.h"
 #endif
 #include "internal/memory/registered_memory_table.h"
+#include "internal/pipeline/read_pipeline.h"
 #include "datasystem/transfer_engine/status_helper.h"
 
 namespace datasystem {
@@ -37,6 +40,9 @@ constexpr int32_t kDefaultRpcThreads = 8;
 constexpr int32_t K_MAX_HIXL_GENERATION_RETRY = 2;
 constexpr uint64_t K_MAX_TCP_PORT = 65535;
 constexpr uint64_t K_DECIMAL_BASE = 10;
+constexpr size_t K_DEFAULT_ASYNC_READ_WINDOW = 8;
+constexpr size_t K_MAX_ASYNC_READ_WINDOW = 1024;
+constexpr size_t K_MAX_FINISHED_ASYNC_BATCHES = 4096;
 
 std::string ToLowerAscii(std::string value)
 {
@@ -52,6 +58,25 @@ std::string GetEnvString(const char *name)
     return value == nullptr ? std::string() : std::string(value);
 }
 
+size_t GetAsyncReadWindow()
+{
+    const std::string env = GetEnvString("TRANSFER_ENGINE_ASYNC_READ_WINDOW");
+    if (env.empty()) {
+        return K_DEFAULT_ASYNC_READ_WINDOW;
+    }
+    size_t value = 0;
+    for (char c : env) {
+        if (c < '0' || c > '9') {
+            return K_DEFAULT_ASYNC_READ_WINDOW;
+        }
+        value = value * K_DECIMAL_BASE + static_cast<size_t>(c - '0');
+        if (value > K_MAX_ASYNC_READ_WINDOW) {
+            return K_MAX_ASYNC_READ_WINDOW;
+        }
+    }
+    return value == 0 ? K_DEFAULT_ASYNC_READ_WINDOW : value;
+}
+
 class ScopeExit final {
 public:
     explicit ScopeExit(std::function<void()> fn) : fn_(std::move(fn))
@@ -76,8 +101,8 @@ Result ResolveBackendKind(const std::string &protocol, std::string &backendKind)
 {
     const std::string envBackend = ToLowerAscii(GetEnvString("TRANSFER_ENGINE_BACKEND"));
     if (!envBackend.empty()) {
-        TE_CHECK_OR_RETURN(envBackend == "p2p" || envBackend == "hixl", ErrorCode::kInvalid,
-                           "TRANSFER_ENGINE_BACKEND should be p2p or hixl");
+        TE_CHECK_OR_RETURN(envBackend == "p2p" || envBackend == "hixl" || envBackend == "cpu", ErrorCode::kInvalid,
+                           "TRANSFER_ENGINE_BACKEND should be p2p, hixl or cpu");
         backendKind = envBackend;
         return Result::OK();
     }
@@ -87,8 +112,8 @@ Result ResolveBackendKind(const std::string &protocol, std::string &backendKind)
         backendKind = "hixl";
         return Result::OK();
     }
-    if (protocolLower == "p2p") {
-        backendKind = "p2p";
+    if (protocolLower == "p2p" || protocolLower == "cpu") {
+        backendKind = protocolLower;
         return Result::OK();
     }
     return TE_MAKE_STATUS(ErrorCode::kInvalid, "unsupported transfer engine protocol: " + protocol);
@@ -104,6 +129,10 @@ Result CreateBackendByKind(const std::string &backendKind, std::shared_ptr<IData
 #endif
         return Result::OK();
     }
+    if (backendKind == "cpu") {
+        backend = std::make_shared<CpuTransferBackend>();
+        return Result::OK();
+    }
     if (backendKind == "hixl") {
 #ifdef TRANSFER_ENGINE_ENABLE_HIXL
         backend = std::make_shared<HixlD2DBackend>();
@@ -175,10 +204,11 @@ Result ParseTargetHostname(const std::string &targetHostname, std::string *peerH
 Result ParseDeviceId(const std::string &deviceName, int32_t *deviceId)
 {
     TE_CHECK_PTR_OR_RETURN(deviceId);
-    constexpr char kDevicePrefix[] = "npu:";
-    constexpr size_t kDevicePrefixLen = sizeof(kDevicePrefix) - 1;
+    // cpu:${id} names a host memory engine of the cpu backend, the id only tells the engines of a host apart.
+    constexpr size_t kDevicePrefixLen = 4;
     TE_CHECK_OR_RETURN(deviceName.size() > kDevicePrefixLen, ErrorCode::kInvalid, "device_name is invalid");
-    TE_CHECK_OR_RETURN(deviceName.compare(0, kDevicePrefixLen, kDevicePrefix) == 0,
+    TE_CHECK_OR_RETURN(deviceName.compare(0, kDevicePrefixLen, "npu:") == 0 ||
+                           deviceName.compare(0, kDevicePrefixLen, "cpu:") == 0,
                        ErrorCode::kInvalid, "device_name should match npu:${device_id}");
 
     int64_t parsedDeviceId = 0;
@@ -195,6 +225,24 @@ Result ParseDeviceId(const std::string &deviceName, int32_t *deviceId)
     return Result::OK();
 }
 
+BatchReadTriggerRequest MakeBatchReadTriggerRequest(const PipelinedReadBatch &batch)
+{
+    BatchReadTriggerRequest req;
+    req.requesterHost = batch.spec.localHost;
+    req.requesterPort = batch.spec.localPort;
+    req.requesterDeviceId = batch.spec.localDeviceId;
+    req.ownerDeviceId = batch.spec.peerDeviceId;
+    req.items.reserve(batch.ops.size());
+    for (size_t i = 0; i < batch.ops.size(); ++i) {
+        BatchReadItem one;
+        one.requestId = batch.requestIdStart + static_cast<uint64_t>(i);
+        one.remoteAddr = batch.ops[i].remoteAddr;
+        one.length = batch.ops[i].length;
+        req.items.push_back(one);
+    }
+    return req;
+}
+
 }  // namespace
 
 class TransferEngineState {
@@ -205,6 +253,13 @@ public:
     };
 
     std::unordered_map<std::string, EndpointCacheEntry> endpointOwnerDeviceCache;
+    // Guarded by asyncReadMutex_.
+    std::unordered_map<std::string, std::shared_ptr<ReadPipeline>> readPipelines;
+    std::unordered_map<uint64_t, std::shared_ptr<PipelinedReadBatch>> asyncBatches;
+    // Results of async batches that completed before they were polled, the oldest are dropped past the limit.
+    std::unordered_map<uint64_t, Result> finishedAsyncBatches;
+    std::deque<uint64_t> finishedAsyncOrder;
+    bool readPipelinesClosed = false;
 };
 
 TransferEngine::TransferEngine()
@@ -253,12 +308,17 @@ Result TransferEngine::Initialize(const std::string &localHostname, const std::s
     localPort_ = localPort;
     deviceId_ = deviceId;
     rpcThreads_ = kDefaultRpcThreads;
+    asyncReadWindow_ = GetAsyncReadWindow();
     TE_RETURN_IF_ERROR(InitializeBackendLocked(protocol));
     Result startRc = StartControlServerLocked();
     if (startRc.IsError()) {
         return startRc;
     }
 
+    {
+        std::lock_guard<std::mutex> asyncLock(asyncReadMutex_);
+        state_->readPipelinesClosed = false;
+    }
     initialized_ = true;
     TE_LOG_INFO << "transfer engine initialize success"
               << ", local_host=" << localHost_ << ", local_port=" << localPort_
@@ -427,34 +487,8 @@ Result TransferEngine::BatchTransferSyncRead(const std::string &targetHostname,
                                              const std::vector<size_t> &lengths)
 {
     internal::DumpProcessEnvironment("batch_transfer_sync_read_begin");
-    TE_CHECK_OR_RETURN(!buffers.empty(), ErrorCode::kInvalid, "buffers is empty");
-    TE_CHECK_OR_RETURN(buffers.size() == peerBufferAddresses.size() && buffers.size() == lengths.size(),
-                       ErrorCode::kInvalid, "buffers/peerBufferAddresses/lengths size mismatch");
-
-    std::string peerHost;
-    uint16_t peerPort = 0;
-    TE_RETURN_IF_ERROR(ParseTargetHostname(targetHostname, &peerHost, &peerPort));
-    for (size_t i = 0; i < buffers.size(); ++i) {
-        TE_CHECK_OR_RETURN(buffers[i] > 0, ErrorCode::kInvalid, "buffer should be positive");
-        TE_CHECK_OR_RETURN(peerBufferAddresses[i] > 0, ErrorCode::kInvalid, "peerBufferAddress should be positive");
-        TE_CHECK_OR_RETURN(lengths[i] > 0, ErrorCode::kInvalid, "length should be positive");
-    }
-
-    std::string localHostSnapshot;
-    uint16_t localPortSnapshot = 0;
-    int32_t deviceIdSnapshot = -1;
-    uint64_t requestIdStart = 0;
-    {
-        std::lock_guard<std::mutex> lock(apiMutex_);
-        TE_CHECK_OR_RETURN(initialized_, ErrorCode::kNotReady, "transfer engine not initialized");
-        TE_CHECK_OR_RETURN(!finalizing_, ErrorCode::kNotReady, "transfer engine is finalizing");
-        localHostSnapshot = localHost_;
-        localPortSnapshot = localPort_;
-        deviceIdSnapshot = deviceId_;
-        requestIdStart = nextRequestId_;
-        nextRequestId_ += static_cast<uint64_t>(buffers.size());
-        ++inFlightSyncReads_;
-    }
+    std::shared_ptr<PipelinedReadBatch> batch;
+    TE_RETURN_IF_ERROR(PrepareReadBatch(targetHostname, buffers, peerBufferAddresses, lengths, true, &batch));
     ScopeExit finishGuard([this]() {
         std::lock_guard<std::mutex> lock(apiMutex_);
         if (inFlightSyncReads_ > 0) {
@@ -467,214 +501,403 @@ Result TransferEngine::BatchTransferSyncRead(const std::string &targetHostname,
 
     TE_VLOG_1 << "batch sync read begin"
               << ", item_count=" << buffers.size() << ", target_hostname=" << targetHostname
-              << ", peer=" << peerHost << ":" << peerPort
-              << ", request_id_start=" << requestIdStart
+              << ", request_id_start=" << batch->requestIdStart
               << ", backend=" << backend_->BackendKind();
 
+    Result rc;
     if (backend_->SupportsReceiverDrivenRead()) {
-        std::vector<TransferMemoryRegion> destRegions;
-        destRegions.reserve(buffers.size());
-        for (size_t i = 0; i < buffers.size(); ++i) {
-            destRegions.push_back(TransferMemoryRegion{ static_cast<uint64_t>(buffers[i]),
-                                                         static_cast<uint64_t>(lengths[i]) });
+        // Receiver-driven reads name their ranges, so they run on the calling thread next to any other read.
+        rc = IssueReadBatch(*batch);
+        if (rc.IsOk()) {
+            rc = CompleteReadBatch(*batch);
         }
-        const uint64_t localMemGenerationBefore = backend_->MemoryGeneration();
-        Result prepareRc = backend_->PrepareReadDestinations(destRegions);
-        if (prepareRc.IsError()) {
-            return prepareRc;
+        if (rc.IsError()) {
+            AbortReadBatch(*batch);
         }
-        if (backend_->MemoryGeneration() != localMemGenerationBefore) {
-            std::lock_guard<std::mutex> lock(endpointCacheMutex_);
-            state_->endpointOwnerDeviceCache.clear();
+    } else {
+        // The owner fills the posted receives of a connection in order, so every read of it goes through its pipeline.
+        rc = SubmitReadBatch(batch);
+        if (rc.IsOk()) {
+            (void)batch->WaitDone(0);
+            std::lock_guard<std::mutex> lock(batch->mutex);
+            rc = batch->result;
         }
+    }
+    if (rc.IsOk()) {
+        TE_LOG_INFO << "batch sync read success, item_count=" << buffers.size()
+                    << ", target_hostname=" << targetHostname << ", backend=" << backend_->BackendKind();
+    }
+    return rc;
+}
 
-        for (int32_t attempt = 0; attempt < K_MAX_HIXL_GENERATION_RETRY; ++attempt) {
-            int32_t ownerDeviceId = -1;
-            uint64_t ownerMemGeneration = 0;
-            Result connRc = BuildConnectionIfNeeded(peerHost, peerPort, &ownerDeviceId, &ownerMemGeneration);
-            if (connRc.IsError()) {
-                TE_LOG_ERROR << "batch sync read build hixl connection failed, reason=" << connRc.ToString();
-                return connRc;
-            }
+Result TransferEngine::BatchTransferAsyncRead(const std::string &targetHostname, const std::vector<uintptr_t> &buffers,
+                                              const std::vector<uintptr_t> &peerBufferAddresses,
+                                              const std::vector<size_t> &lengths, uint64_t *batchId)
+{
+    TE_CHECK_PTR_OR_RETURN(batchId);
+    std::shared_ptr<PipelinedReadBatch> batch;
+    TE_RETURN_IF_ERROR(PrepareReadBatch(targetHostname, buffers, peerBufferAddresses, lengths, false, &batch));
+    batch->onDone = [this](PipelinedReadBatch &one) { ReapAsyncBatch(one); };
+    // Registered before the submit, so a finalize that starts in between fails the batch instead of losing it.
+    {
+        std::lock_guard<std::mutex> lock(asyncReadMutex_);
+        TE_CHECK_OR_RETURN(!state_->readPipelinesClosed, ErrorCode::kNotReady, "transfer engine is finalizing");
+        state_->asyncBatches[batch->batchId] = batch;
+    }
+    Result submitRc = SubmitReadBatch(batch);
+    if (submitRc.IsError()) {
+        std::lock_guard<std::mutex> lock(asyncReadMutex_);
+        state_->asyncBatches.erase(batch->batchId);
+        return submitRc;
+    }
+    *batchId = batch->batchId;
+    TE_VLOG_1 << "batch async read submitted"
+              << ", batch_id=" << batch->batchId << ", item_count=" << buffers.size()
+              << ", target_hostname=" << targetHostname;
+    return Result::OK();
+}
 
-            ConnectionSpec spec;
-            spec.localHost = localHostSnapshot;
-            spec.localPort = localPortSnapshot;
-            spec.localDeviceId = deviceIdSnapshot;
-            spec.peerHost = peerHost;
-            spec.peerPort = peerPort;
-            spec.peerDeviceId = ownerDeviceId;
-
-            BatchReadTriggerRequest req;
-            req.requesterHost = localHostSnapshot;
-            req.requesterPort = localPortSnapshot;
-            req.requesterDeviceId = deviceIdSnapshot;
-            req.ownerDeviceId = ownerDeviceId;
-            req.items.reserve(buffers.size());
-            for (size_t i = 0; i < buffers.size(); ++i) {
-                BatchReadItem one;
-                one.requestId = requestIdStart + static_cast<uint64_t>(i);
-                one.remoteAddr = static_cast<uint64_t>(peerBufferAddresses[i]);
-                one.length = static_cast<uint64_t>(lengths[i]);
-                req.items.push_back(one);
-            }
+Result TransferEngine::PollTransfer(uint64_t batchId, bool *completed)
+{
+    TE_CHECK_PTR_OR_RETURN(completed);
+    bool finished = false;
+    Result rc;
+    auto batch = FindAsyncBatch(batchId, &finished, &rc);
+    if (!finished) {
+        TE_CHECK_OR_RETURN(batch != nullptr, ErrorCode::kNotFound, "batch is not found");
+        std::lock_guard<std::mutex> lock(batch->mutex);
+        *completed = batch->done;
+        if (!batch->done) {
+            return Result::OK();
+        }
+        rc = batch->result;
+    }
+    *completed = true;
+    EraseAsyncBatch(batchId);
+    return rc;
+}
 
-            BatchReadTriggerResponse rsp;
-            Result triggerRc = controlClient_->BatchReadTrigger(peerHost, peerPort, req, &rsp);
-            if (triggerRc.IsError()) {
-                TE_LOG_ERROR << "batch sync read hixl trigger rpc failed, reason=" << triggerRc.ToString();
-                backend_->AbortConnection(spec);
-                ConnectionKey key{ deviceIdSnapshot, peerHost, peerPort, ownerDeviceId };
-                connMgr_->MarkStale(key);
-                return triggerRc;
-            }
-            Result rpcStatus = RpcCodeToStatus(rsp.code, rsp.msg);
-            if (rpcStatus.IsError()) {
-                TE_LOG_ERROR << "batch sync read hixl trigger rejected, failed_item_index=" << rsp.failedItemIndex
-                           << ", reason=" << rsp.msg;
-                backend_->AbortConnection(spec);
-                ConnectionKey key{ deviceIdSnapshot, peerHost, peerPort, ownerDeviceId };
-                connMgr_->MarkStale(key);
-                return rpcStatus;
-            }
+Result TransferEngine::WaitTransfer(uint64_t batchId, uint64_t timeoutMs)
+{
+    bool finished = false;
+    Result rc;
+    auto batch = FindAsyncBatch(batchId, &finished, &rc);
+    if (!finished) {
+        TE_CHECK_OR_RETURN(batch != nullptr, ErrorCode::kNotFound, "batch is not found");
+        TE_CHECK_OR_RETURN(batch->WaitDone(timeoutMs), ErrorCode::kNotReady, "wait batch timeout");
+        std::lock_guard<std::mutex> lock(batch->mutex);
+        rc = batch->result;
+    }
+    EraseAsyncBatch(batchId);
+    return rc;
+}
 
-            auto releaseLease = [this, &rsp, &peerHost, peerPort, &localHostSnapshot, localPortSnapshot,
-                                 deviceIdSnapshot]() {
-                if (rsp.readLeaseId == 0) {
-                    return;
-                }
-                ReleaseReadLeaseRequest releaseReq;
-                releaseReq.readLeaseId = rsp.readLeaseId;
-                releaseReq.requesterHost = localHostSnapshot;
-                releaseReq.requesterPort = localPortSnapshot;
-                releaseReq.requesterDeviceId = deviceIdSnapshot;
-                ReleaseReadLeaseResponse releaseRsp;
-                Result releaseRc = controlClient_->ReleaseReadLease(peerHost, peerPort, releaseReq, &releaseRsp);
-                if (releaseRc.IsError()) {
-                    TE_LOG_WARNING << "release hixl read lease rpc failed"
-                                 << ", read_lease_id=" << rsp.readLeaseId
-                                 << ", reason=" << releaseRc.ToString();
-                }
-            };
-
-            if (rsp.ownerMemGeneration != ownerMemGeneration) {
-                releaseLease();
-                backend_->AbortConnection(spec);
-                ConnectionKey key{ deviceIdSnapshot, peerHost, peerPort, ownerDeviceId };
-                connMgr_->MarkStale(key);
-                {
-                    std::lock_guard<std::mutex> lock(endpointCacheMutex_);
-                    state_->endpointOwnerDeviceCache.erase(peerHost + ":" + std::to_string(peerPort));
-                }
-                TE_LOG_WARNING << "hixl owner memory generation changed during read authorization"
-                             << ", cached_generation=" << ownerMemGeneration
-                             << ", trigger_generation=" << rsp.ownerMemGeneration
-                             << ", attempt=" << attempt;
-                continue;
-            }
+Result TransferEngine::CancelTransfer(uint64_t batchId)
+{
+    bool finished = false;
+    Result rc;
+    auto batch = FindAsyncBatch(batchId, &finished, &rc);
+    TE_CHECK_OR_RETURN(!finished, ErrorCode::kNotReady, "batch is already completed");
+    TE_CHECK_OR_RETURN(batch != nullptr, ErrorCode::kNotFound, "batch is not found");
+    std::shared_ptr<ReadPipeline> pipeline;
+    TE_RETURN_IF_ERROR(GetReadPipeline(*batch, &pipeline));
+    return pipeline->Cancel(batchId);
+}
 
-            std::vector<TransferReadOp> ops;
-            ops.reserve(buffers.size());
-            for (size_t i = 0; i < buffers.size(); ++i) {
-                ops.push_back(TransferReadOp{ static_cast<uint64_t>(buffers[i]),
-                                              static_cast<uint64_t>(peerBufferAddresses[i]),
-                                              static_cast<uint64_t>(lengths[i]) });
-            }
-            // Use the backend-configured HIXL transfer timeout.
-            Result readRc = backend_->TransferSyncRead(spec, ops, 0);
-            releaseLease();
-            if (readRc.IsError()) {
-                backend_->AbortConnection(spec);
-                ConnectionKey key{ deviceIdSnapshot, peerHost, peerPort, ownerDeviceId };
-                connMgr_->MarkStale(key);
-                TE_LOG_ERROR << "hixl transfer sync read failed, reason=" << readRc.ToString();
-                return readRc;
+std::shared_ptr<PipelinedReadBatch> TransferEngine::FindAsyncBatch(uint64_t batchId, bool *finished, Result *result)
+{
+    std::lock_guard<std::mutex> lock(asyncReadMutex_);
+    auto finishedIter = state_->finishedAsyncBatches.find(batchId);
+    *finished = finishedIter != state_->finishedAsyncBatches.end();
+    if (*finished) {
+        *result = finishedIter->second;
+        return nullptr;
+    }
+    auto iter = state_->asyncBatches.find(batchId);
+    return iter == state_->asyncBatches.end() ? nullptr : iter->second;
+}
+
+void TransferEngine::EraseAsyncBatch(uint64_t batchId)
+{
+    std::lock_guard<std::mutex> lock(asyncReadMutex_);
+    state_->asyncBatches.erase(batchId);
+    state_->finishedAsyncBatches.erase(batchId);
+}
+
+void TransferEngine::ReapAsyncBatch(PipelinedReadBatch &batch)
+{
+    Result rc;
+    {
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        rc = batch.result;
+    }
+    std::lock_guard<std::mutex> lock(asyncReadMutex_);
+    // Gone already when the batch was polled in the meantime or the engine is finalizing.
+    if (state_->asyncBatches.erase(batch.batchId) == 0) {
+        return;
+    }
+    // Only the result is kept, the batch with its ops is released now rather than when it is polled.
+    state_->finishedAsyncBatches.emplace(batch.batchId, std::move(rc));
+    state_->finishedAsyncOrder.push_back(batch.batchId);
+    while (state_->finishedAsyncOrder.size() > K_MAX_FINISHED_ASYNC_BATCHES) {
+        const uint64_t oldest = state_->finishedAsyncOrder.front();
+        state_->finishedAsyncOrder.pop_front();
+        if (state_->finishedAsyncBatches.erase(oldest) > 0) {
+            TE_LOG_WARNING << "async read batch is never polled, drop its result, batch_id=" << oldest;
+        }
+    }
+}
+
+Result TransferEngine::PrepareReadBatch(const std::string &targetHostname, const std::vector<uintptr_t> &buffers,
+                                        const std::vector<uintptr_t> &peerBufferAddresses,
+                                        const std::vector<size_t> &lengths, bool syncRead,
+                                        std::shared_ptr<PipelinedReadBatch> *batch)
+{
+    TE_CHECK_PTR_OR_RETURN(batch);
+    TE_CHECK_OR_RETURN(!buffers.empty(), ErrorCode::kInvalid, "buffers is empty");
+    TE_CHECK_OR_RETURN(buffers.size() == peerBufferAddresses.size() && buffers.size() == lengths.size(),
+                       ErrorCode::kInvalid, "buffers/peerBufferAddresses/lengths size mismatch");
+
+    auto one = std::make_shared<PipelinedReadBatch>();
+    TE_RETURN_IF_ERROR(ParseTargetHostname(targetHostname, &one->spec.peerHost, &one->spec.peerPort));
+    one->ops.reserve(buffers.size());
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        TE_CHECK_OR_RETURN(buffers[i] > 0, ErrorCode::kInvalid, "buffer should be positive");
+        TE_CHECK_OR_RETURN(peerBufferAddresses[i] > 0, ErrorCode::kInvalid, "peerBufferAddress should be positive");
+        TE_CHECK_OR_RETURN(lengths[i] > 0, ErrorCode::kInvalid, "length should be positive");
+        one->ops.push_back(TransferReadOp{ static_cast<uint64_t>(buffers[i]),
+                                           static_cast<uint64_t>(peerBufferAddresses[i]),
+                                           static_cast<uint64_t>(lengths[i]) });
+    }
+
+    std::lock_guard<std::mutex> lock(apiMutex_);
+    TE_CHECK_OR_RETURN(initialized_, ErrorCode::kNotReady, "transfer engine not initialized");
+    TE_CHECK_OR_RETURN(!finalizing_, ErrorCode::kNotReady, "transfer engine is finalizing");
+    one->spec.localHost = localHost_;
+    one->spec.localPort = localPort_;
+    one->spec.localDeviceId = deviceId_;
+    // The request ids of a batch are unique, the first one also names the batch.
+    one->requestIdStart = nextRequestId_;
+    one->batchId = nextRequestId_;
+    nextRequestId_ += static_cast<uint64_t>(buffers.size());
+    if (syncRead) {
+        ++inFlightSyncReads_;
+    }
+    *batch = std::move(one);
+    return Result::OK();
+}
+
+Result TransferEngine::GetReadPipeline(const PipelinedReadBatch &batch, std::shared_ptr<ReadPipeline> *pipeline)
+{
+    TE_CHECK_PTR_OR_RETURN(pipeline);
+    const std::string endpoint = batch.spec.peerHost + ":" + std::to_string(batch.spec.peerPort);
+    std::lock_guard<std::mutex> lock(asyncReadMutex_);
+    TE_CHECK_OR_RETURN(!state_->readPipelinesClosed, ErrorCode::kNotReady, "transfer engine is finalizing");
+    auto &entry = state_->readPipelines[endpoint];
+    if (entry == nullptr) {
+        ReadPipeline::Steps steps;
+        steps.issue = [this](PipelinedReadBatch &one) { return IssueReadBatch(one); };
+        steps.complete = [this](PipelinedReadBatch &one) { return CompleteReadBatch(one); };
+        steps.abort = [this](PipelinedReadBatch &one) { AbortReadBatch(one); };
+        if (backend_->RequiresAclRuntime()) {
+            const int32_t deviceId = batch.spec.localDeviceId;
+            steps.threadInit = [deviceId]() { return internal::EnsureAclSetDeviceForCurrentThread(deviceId); };
+        }
+        entry = std::make_shared<ReadPipeline>(endpoint, asyncReadWindow_, std::move(steps));
+        TE_LOG_INFO << "read pipeline created, peer=" << endpoint << ", window=" << asyncReadWindow_;
+    }
+    *pipeline = entry;
+    return Result::OK();
+}
+
+Result TransferEngine::SubmitReadBatch(const std::shared_ptr<PipelinedReadBatch> &batch)
+{
+    std::shared_ptr<ReadPipeline> pipeline;
+    TE_RETURN_IF_ERROR(GetReadPipeline(*batch, &pipeline));
+    return pipeline->Submit(batch);
+}
+
+void TransferEngine::StopReadPipelines()
+{
+    std::unordered_map<std::string, std::shared_ptr<ReadPipeline>> pipelines;
+    {
+        std::lock_guard<std::mutex> lock(asyncReadMutex_);
+        state_->readPipelinesClosed = true;
+        pipelines.swap(state_->readPipelines);
+        state_->asyncBatches.clear();
+        state_->finishedAsyncBatches.clear();
+        state_->finishedAsyncOrder.clear();
+    }
+    for (auto &entry : pipelines) {
+        entry.second->Stop();
+    }
+}
+
+Result TransferEngine::IssueReadBatch(PipelinedReadBatch &batch)
+{
+    if (backend_->SupportsReceiverDrivenRead()) {
+        return IssueReceiverDrivenRead(batch);
+    }
+    return IssuePostSendRead(batch);
+}
+
+Result TransferEngine::IssueReceiverDrivenRead(PipelinedReadBatch &batch)
+{
+    const std::string &peerHost = batch.spec.peerHost;
+    const uint16_t peerPort = batch.spec.peerPort;
+    std::vector<TransferMemoryRegion> destRegions;
+    destRegions.reserve(batch.ops.size());
+    for (const auto &op : batch.ops) {
+        destRegions.push_back(TransferMemoryRegion{ op.localAddr, op.length });
+    }
+    const uint64_t localMemGenerationBefore = backend_->MemoryGeneration();
+    TE_RETURN_IF_ERROR(backend_->PrepareReadDestinations(destRegions));
+    if (backend_->MemoryGeneration() != localMemGenerationBefore) {
+        std::lock_guard<std::mutex> lock(endpointCacheMutex_);
+        state_->endpointOwnerDeviceCache.clear();
+    }
+
+    for (int32_t attempt = 0; attempt < K_MAX_HIXL_GENERATION_RETRY; ++attempt) {
+        int32_t ownerDeviceId = -1;
+        uint64_t ownerMemGeneration = 0;
+        Result connRc = BuildConnectionIfNeeded(peerHost, peerPort, &ownerDeviceId, &ownerMemGeneration);
+        if (connRc.IsError()) {
+            TE_LOG_ERROR << "batch read build hixl connection failed, reason=" << connRc.ToString();
+            return connRc;
+        }
+        batch.spec.peerDeviceId = ownerDeviceId;
+        batch.ownerMemGeneration = ownerMemGeneration;
+
+        BatchReadTriggerRequest req = MakeBatchReadTriggerRequest(batch);
+        BatchReadTriggerResponse rsp;
+        Result triggerRc = controlClient_->BatchReadTrigger(peerHost, peerPort, req, &rsp);
+        if (triggerRc.IsError()) {
+            TE_LOG_ERROR << "batch read hixl trigger rpc failed, reason=" << triggerRc.ToString();
+            return triggerRc;
+        }
+        Result rpcStatus = RpcCodeToStatus(rsp.code, rsp.msg);
+        if (rpcStatus.IsError()) {
+            TE_LOG_ERROR << "batch read hixl trigger rejected, failed_item_index=" << rsp.failedItemIndex
+                         << ", reason=" << rsp.msg;
+            return rpcStatus;
+        }
+        batch.readLeaseId = rsp.readLeaseId;
+
+        if (rsp.ownerMemGeneration != ownerMemGeneration) {
+            AbortReadBatch(batch);
+            {
+                std::lock_guard<std::mutex> lock(endpointCacheMutex_);
+                state_->endpointOwnerDeviceCache.erase(peerHost + ":" + std::to_string(peerPort));
             }
-            TE_LOG_INFO << "hixl batch sync read success"
-                      << ", item_count=" << buffers.size()
-                      << ", target_hostname=" << targetHostname
-                      << ", owner_mem_generation=" << ownerMemGeneration;
-            return Result::OK();
+            TE_LOG_WARNING << "hixl owner memory generation changed during read authorization"
+                           << ", cached_generation=" << ownerMemGeneration
+                           << ", trigger_generation=" << rsp.ownerMemGeneration
+                           << ", attempt=" << attempt;
+            continue;
         }
-        return TE_MAKE_STATUS(ErrorCode::kNotReady, "owner memory generation keeps changing during hixl read");
+        return Result::OK();
     }
+    return TE_MAKE_STATUS(ErrorCode::kNotReady, "owner memory generation keeps changing during hixl read");
+}
 
+Result TransferEngine::IssuePostSendRead(PipelinedReadBatch &batch)
+{
+    const std::string &peerHost = batch.spec.peerHost;
+    const uint16_t peerPort = batch.spec.peerPort;
     int32_t ownerDeviceId = -1;
     uint64_t ownerMemGeneration = 0;
     Result connRc = BuildConnectionIfNeeded(peerHost, peerPort, &ownerDeviceId, &ownerMemGeneration);
     if (connRc.IsError()) {
-        TE_LOG_ERROR << "batch sync read build connection failed, reason=" << connRc.ToString();
+        TE_LOG_ERROR << "batch read build connection failed, reason=" << connRc.ToString();
         return connRc;
     }
+    batch.spec.peerDeviceId = ownerDeviceId;
+    batch.ownerMemGeneration = ownerMemGeneration;
 
-    ConnectionSpec spec;
-    spec.localHost = localHostSnapshot;
-    spec.localPort = localPortSnapshot;
-    spec.localDeviceId = deviceIdSnapshot;
-    spec.peerHost = peerHost;
-    spec.peerPort = peerPort;
-    spec.peerDeviceId = ownerDeviceId;
-
-    for (size_t i = 0; i < buffers.size(); ++i) {
-        Result postRecvRc = backend_->PostRecv(spec, static_cast<uint64_t>(buffers[i]), static_cast<uint64_t>(lengths[i]));
+    for (size_t i = 0; i < batch.ops.size(); ++i) {
+        Result postRecvRc = backend_->PostRecv(batch.spec, batch.ops[i].localAddr, batch.ops[i].length);
         if (postRecvRc.IsError()) {
-            TE_LOG_ERROR << "batch sync read post recv failed, item_index=" << i
-                       << ", reason=" << postRecvRc.ToString();
-            backend_->AbortConnection(spec);
-            ConnectionKey key{ deviceIdSnapshot, peerHost, peerPort, ownerDeviceId };
-            connMgr_->MarkStale(key);
+            TE_LOG_ERROR << "batch read post recv failed, item_index=" << i
+                         << ", reason=" << postRecvRc.ToString();
             return postRecvRc;
         }
     }
 
-    BatchReadTriggerRequest req;
-    req.requesterHost = localHostSnapshot;
-    req.requesterPort = localPortSnapshot;
-    req.requesterDeviceId = deviceIdSnapshot;
-    req.ownerDeviceId = ownerDeviceId;
-    req.items.reserve(buffers.size());
-    for (size_t i = 0; i < buffers.size(); ++i) {
-        BatchReadItem one;
-        one.requestId = requestIdStart + static_cast<uint64_t>(i);
-        one.remoteAddr = static_cast<uint64_t>(peerBufferAddresses[i]);
-        one.length = static_cast<uint64_t>(lengths[i]);
-        req.items.push_back(one);
-    }
-
+    BatchReadTriggerRequest req = MakeBatchReadTriggerRequest(batch);
     BatchReadTriggerResponse rsp;
     Result triggerRc = controlClient_->BatchReadTrigger(peerHost, peerPort, req, &rsp);
     if (triggerRc.IsError()) {
-        TE_LOG_ERROR << "batch sync read rpc failed, reason=" << triggerRc.ToString();
-        backend_->AbortConnection(spec);
-        ConnectionKey key{ deviceIdSnapshot, peerHost, peerPort, ownerDeviceId };
-        connMgr_->MarkStale(key);
+        TE_LOG_ERROR << "batch read rpc failed, reason=" << triggerRc.ToString();
         return triggerRc;
     }
     Result rpcStatus = RpcCodeToStatus(rsp.code, rsp.msg);
     if (rpcStatus.IsError()) {
-        TE_LOG_ERROR << "batch sync read rpc returned error, failed_item_index=" << rsp.failedItemIndex
-                   << ", reason=" << rsp.msg;
-        backend_->AbortConnection(spec);
-        ConnectionKey key{ deviceIdSnapshot, peerHost, peerPort, ownerDeviceId };
-        connMgr_->MarkStale(key);
+        TE_LOG_ERROR << "batch read rpc returned error, failed_item_index=" << rsp.failedItemIndex
+                     << ", reason=" << rsp.msg;
         return rpcStatus;
     }
+    return Result::OK();
+}
 
-    for (size_t i = 0; i < buffers.size(); ++i) {
-        Result waitRc = backend_->WaitRecv(spec, kDefaultRecvWaitTimeoutMs);
+Result TransferEngine::CompleteReadBatch(PipelinedReadBatch &batch)
+{
+    if (backend_->SupportsReceiverDrivenRead()) {
+        // Use the backend-configured HIXL transfer timeout.
+        Result readRc = backend_->TransferSyncRead(batch.spec, batch.ops, 0);
+        ReleaseReadLease(batch);
+        if (readRc.IsError()) {
+            TE_LOG_ERROR << "hixl transfer read failed, batch_id=" << batch.batchId
+                         << ", reason=" << readRc.ToString();
+            return readRc;
+        }
+        TE_VLOG_1 << "hixl batch read success"
+                  << ", batch_id=" << batch.batchId << ", item_count=" << batch.ops.size()
+                  << ", owner_mem_generation=" << batch.ownerMemGeneration;
+        return Result::OK();
+    }
+    for (size_t i = 0; i < batch.ops.size(); ++i) {
+        Result waitRc = backend_->WaitRecv(batch.spec, kDefaultRecvWaitTimeoutMs);
         if (waitRc.IsError()) {
-            TE_LOG_ERROR << "batch sync read wait recv failed, item_index=" << i
-                       << ", reason=" << waitRc.ToString();
-            ConnectionKey key{ deviceIdSnapshot, peerHost, peerPort, ownerDeviceId };
-            connMgr_->MarkStale(key);
+            TE_LOG_ERROR << "batch read wait recv failed, batch_id=" << batch.batchId << ", item_index=" << i
+                         << ", reason=" << waitRc.ToString();
             return waitRc;
         }
     }
-    TE_LOG_INFO << "batch sync read success, item_count=" << buffers.size()
-              << ", target_hostname=" << targetHostname;
     return Result::OK();
 }
 
+void TransferEngine::AbortReadBatch(PipelinedReadBatch &batch)
+{
+    ReleaseReadLease(batch);
+    if (batch.spec.peerDeviceId < 0) {
+        return;
+    }
+    backend_->AbortConnection(batch.spec);
+    ConnectionKey key{ batch.spec.localDeviceId, batch.spec.peerHost, batch.spec.peerPort, batch.spec.peerDeviceId };
+    connMgr_->MarkStale(key);
+}
+
+void TransferEngine::ReleaseReadLease(PipelinedReadBatch &batch)
+{
+    if (batch.readLeaseId == 0) {
+        return;
+    }
+    ReleaseReadLeaseRequest releaseReq;
+    releaseReq.readLeaseId = batch.readLeaseId;
+    releaseReq.requesterHost = batch.spec.localHost;
+    releaseReq.requesterPort = batch.spec.localPort;
+    releaseReq.requesterDeviceId = batch.spec.localDeviceId;
+    ReleaseReadLeaseResponse releaseRsp;
+    Result releaseRc =
+        controlClient_->ReleaseReadLease(batch.spec.peerHost, batch.spec.peerPort, releaseReq, &releaseRsp);
+    if (releaseRc.IsError()) {
+        TE_LOG_WARNING << "release hixl read lease rpc failed"
+                       << ", read_lease_id=" << batch.readLeaseId
+                       << ", reason=" << releaseRc.ToString();
+    }
+    batch.readLeaseId = 0;
+}
+
 Result TransferEngine::Finalize()
 {
     {
@@ -687,6 +910,11 @@ Result TransferEngine::Finalize()
                   << ", local_host=" << localHost_ << ", local_port=" << localPort_
                   << ", device_id=" << deviceId_ << ", inflight_sync_reads=" << inFlightSyncReads_;
         finalizing_ = true;
+    }
+    // Fails the queued reads and completes the issued ones, which wakes the sync readers waiting on them.
+    StopReadPipelines();
+    {
+        std::unique_lock<std::mutex> lock(apiMutex_);
         apiCv_.wait(lock, [this]() { return inFlightSyncReads_ == 0; });
     }
 
@@ -0,0 +1,450 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "internal/backend/mock_data_plane_backend.h"
+#include "datasystem/transfer_engine/transfer_engine.h"
+
+namespace datasystem {
+namespace {
+
+constexpr auto kStateWaitTimeout = std::chrono::seconds(10);
+
+class ScopedAsyncReadWindow final {
+public:
+    explicit ScopedAsyncReadWindow(size_t window)
+    {
+        setenv("TRANSFER_ENGINE_ASYNC_READ_WINDOW", std::to_string(window).c_str(), 1);
+    }
+
+    ~ScopedAsyncReadWindow()
+    {
+        unsetenv("TRANSFER_ENGINE_ASYNC_READ_WINDOW");
+    }
+};
+
+struct MockPeers {
+    std::shared_ptr<MockDataPlaneBackend::SharedState> sharedState =
+        std::make_shared<MockDataPlaneBackend::SharedState>();
+    TransferEngine owner{ std::make_shared<MockDataPlaneBackend>(sharedState) };
+    TransferEngine requester{ std::make_shared<MockDataPlaneBackend>(sharedState) };
+    std::string ownerHostname;
+
+    MockPeers(uint16_t ownerPort, uint16_t requesterPort)
+        : ownerHostname("127.0.0.1:" + std::to_string(ownerPort))
+    {
+        EXPECT_TRUE(owner.Initialize(ownerHostname, "p2p", "npu:0").IsOk());
+        EXPECT_TRUE(requester.Initialize("127.0.0.1:" + std::to_string(requesterPort), "p2p", "npu:1").IsOk());
+    }
+
+    ~MockPeers()
+    {
+        // Never leave an engine blocked on a gate, even when an assertion returned early.
+        HoldSends(false);
+        HoldCompletions(false);
+    }
+
+    void SetLatency(uint64_t opLatencyUs)
+    {
+        std::lock_guard<std::mutex> lock(sharedState->mutex);
+        sharedState->opLatencyUs = opLatencyUs;
+    }
+
+    void HoldSends(bool hold)
+    {
+        std::lock_guard<std::mutex> lock(sharedState->mutex);
+        sharedState->holdSends = hold;
+        sharedState->cv.notify_all();
+    }
+
+    void HoldCompletions(bool hold)
+    {
+        std::lock_guard<std::mutex> lock(sharedState->mutex);
+        sharedState->holdCompletions = hold;
+        sharedState->cv.notify_all();
+    }
+
+    // Waits until at least count recvs are posted and not yet completed.
+    bool WaitInFlight(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(sharedState->mutex);
+        return sharedState->cv.wait_for(lock, kStateWaitTimeout,
+                                        [this, count]() { return sharedState->inFlightRecv >= count; });
+    }
+
+    size_t InFlight()
+    {
+        std::lock_guard<std::mutex> lock(sharedState->mutex);
+        return sharedState->inFlightRecv;
+    }
+
+    size_t TakePeakInFlight()
+    {
+        std::lock_guard<std::mutex> lock(sharedState->mutex);
+        size_t peak = sharedState->peakInFlightRecv;
+        sharedState->peakInFlightRecv = sharedState->inFlightRecv;
+        return peak;
+    }
+
+    Result SubmitOne(std::vector<uint8_t> &dst, std::vector<uint8_t> &src, uint64_t *batchId)
+    {
+        return requester.BatchTransferAsyncRead(ownerHostname, { reinterpret_cast<uintptr_t>(dst.data()) },
+                                                { reinterpret_cast<uintptr_t>(src.data()) }, { dst.size() }, batchId);
+    }
+};
+
+std::vector<std::vector<uint8_t>> MakeSources(TransferEngine &owner, size_t count, size_t size)
+{
+    std::vector<std::vector<uint8_t>> sources(count, std::vector<uint8_t>(size));
+    for (size_t i = 0; i < count; ++i) {
+        std::fill(sources[i].begin(), sources[i].end(), static_cast<uint8_t>(i + 1));
+        EXPECT_TRUE(owner.RegisterMemory(reinterpret_cast<uintptr_t>(sources[i].data()), size).IsOk());
+    }
+    return sources;
+}
+
+// 中文说明：验证异步批量读取的提交、轮询与等待，完成后批次号被释放。
+TEST(TransferEngineAsyncReadTest, SubmitPollWaitMockOk)
+{
+    MockPeers peers(60051, 60052);
+    auto sources = MakeSources(peers.owner, 2, 256);
+    std::vector<uint8_t> dst0(256, 0);
+    std::vector<uint8_t> dst1(256, 0);
+
+    uint64_t batchId = 0;
+    ASSERT_TRUE(peers.requester
+                    .BatchTransferAsyncRead(peers.ownerHostname,
+                                            { reinterpret_cast<uintptr_t>(dst0.data()),
+                                              reinterpret_cast<uintptr_t>(dst1.data()) },
+                                            { reinterpret_cast<uintptr_t>(sources[0].data()),
+                                              reinterpret_cast<uintptr_t>(sources[1].data()) },
+                                            { dst0.size(), dst1.size() }, &batchId)
+                    .IsOk());
+    bool completed = false;
+    Result rc;
+    while (!completed) {
+        rc = peers.requester.PollTransfer(batchId, &completed);
+    }
+    ASSERT_TRUE(rc.IsOk()) << rc.ToString();
+    EXPECT_EQ(dst0, sources[0]);
+    EXPECT_EQ(dst1, sources[1]);
+    EXPECT_EQ(peers.requester.PollTransfer(batchId, &completed).GetCode(), ErrorCode::kNotFound);
+
+    std::fill(dst0.begin(), dst0.end(), 0);
+    ASSERT_TRUE(peers.SubmitOne(dst0, sources[1], &batchId).IsOk());
+    rc = peers.requester.WaitTransfer(batchId, 0);
+    ASSERT_TRUE(rc.IsOk()) << rc.ToString();
+    EXPECT_EQ(dst0, sources[1]);
+    EXPECT_EQ(peers.requester.WaitTransfer(batchId, 0).GetCode(), ErrorCode::kNotFound);
+}
+
+// 中文说明：验证同一连接上大量异步批次并发在途时，每个批次都读到自己的数据。
+TEST(TransferEngineAsyncReadTest, ManyOutstandingKeepOrderMockOk)
+{
+    constexpr size_t kBatchCount = 64;
+    ScopedAsyncReadWindow window(8);
+    MockPeers peers(60151, 60152);
+    peers.SetLatency(2000);
+    auto sources = MakeSources(peers.owner, kBatchCount, 512);
+    std::vector<std::vector<uint8_t>> dsts(kBatchCount, std::vector<uint8_t>(512, 0));
+
+    std::vector<uint64_t> batchIds(kBatchCount);
+    for (size_t i = 0; i < kBatchCount; ++i) {
+        ASSERT_TRUE(peers.SubmitOne(dsts[i], sources[i], &batchIds[i]).IsOk());
+    }
+    for (size_t i = 0; i < kBatchCount; ++i) {
+        Result rc = peers.requester.WaitTransfer(batchIds[i], 0);
+        ASSERT_TRUE(rc.IsOk()) << rc.ToString();
+        EXPECT_EQ(dsts[i], sources[i]) << "batch " << i;
+    }
+    EXPECT_LE(peers.TakePeakInFlight(), 8u);
+}
+
+// 中文说明：验证在途窗口已满时提交会阻塞，直到有批次完成。
+TEST(TransferEngineAsyncReadTest, FullWindowBlocksSubmit)
+{
+    ScopedAsyncReadWindow window(2);
+    MockPeers peers(60251, 60252);
+    auto sources = MakeSources(peers.owner, 3, 64);
+    std::vector<std::vector<uint8_t>> dsts(3, std::vector<uint8_t>(64, 0));
+
+    std::vector<uint64_t> batchIds(3);
+    peers.HoldCompletions(true);
+    ASSERT_TRUE(peers.SubmitOne(dsts[0], sources[0], &batchIds[0]).IsOk());
+    ASSERT_TRUE(peers.SubmitOne(dsts[1], sources[1], &batchIds[1]).IsOk());
+    ASSERT_TRUE(peers.WaitInFlight(2));
+    // Nothing can complete while completions are held, so the third submit must not return.
+    auto third = std::async(std::launch::async, [&]() { return peers.SubmitOne(dsts[2], sources[2], &batchIds[2]); });
+    EXPECT_EQ(third.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    EXPECT_EQ(peers.InFlight(), 2u);
+    peers.HoldCompletions(false);
+    ASSERT_TRUE(third.get().IsOk());
+    for (size_t i = 0; i < batchIds.size(); ++i) {
+        ASSERT_TRUE(peers.requester.WaitTransfer(batchIds[i], 0).IsOk());
+        EXPECT_EQ(dsts[i], sources[i]);
+    }
+    EXPECT_EQ(peers.TakePeakInFlight(), 2u);
+}
+
+// 中文说明：验证尚未下发的批次可以取消且不会写入目的内存，已下发的批次不可取消。
+TEST(TransferEngineAsyncReadTest, CancelQueuedBatch)
+{
+    ScopedAsyncReadWindow window(4);
+    MockPeers peers(60351, 60352);
+    auto sources = MakeSources(peers.owner, 3, 64);
+    std::vector<std::vector<uint8_t>> dsts(3, std::vector<uint8_t>(64, 0));
+
+    // The owner holds the send of the first batch, so its issue does not return and the others stay queued.
+    peers.HoldSends(true);
+    std::vector<uint64_t> batchIds(3);
+    for (size_t i = 0; i < batchIds.size(); ++i) {
+        ASSERT_TRUE(peers.SubmitOne(dsts[i], sources[i], &batchIds[i]).IsOk());
+    }
+    ASSERT_TRUE(peers.WaitInFlight(1));
+    EXPECT_EQ(peers.requester.CancelTransfer(batchIds[0]).GetCode(), ErrorCode::kNotReady);
+    ASSERT_TRUE(peers.requester.CancelTransfer(batchIds[2]).IsOk());
+    EXPECT_EQ(peers.requester.WaitTransfer(batchIds[2], 0).GetCode(), ErrorCode::kInterrupted);
+    peers.HoldSends(false);
+    ASSERT_TRUE(peers.requester.WaitTransfer(batchIds[0], 0).IsOk());
+    ASSERT_TRUE(peers.requester.WaitTransfer(batchIds[1], 0).IsOk());
+    EXPECT_EQ(dsts[0], sources[0]);
+    EXPECT_EQ(dsts[1], sources[1]);
+    EXPECT_EQ(dsts[2], std::vector<uint8_t>(64, 0));
+}
+
+// 中文说明：验证一个批次失败不影响同一连接上其后的批次，且同步读取可与异步读取混用。
+TEST(TransferEngineAsyncReadTest, FailedBatchAndMixedSyncRead)
+{
+    MockPeers peers(60451, 60452);
+    auto sources = MakeSources(peers.owner, 1, 64);
+    std::vector<uint8_t> unregistered(64, 7);
+    std::vector<uint8_t> dst0(64, 0);
+    std::vector<uint8_t> dst1(64, 0);
+
+    uint64_t failedId = 0;
+    uint64_t okId = 0;
+    ASSERT_TRUE(peers.SubmitOne(dst0, unregistered, &failedId).IsOk());
+    ASSERT_TRUE(peers.SubmitOne(dst1, sources[0], &okId).IsOk());
+    EXPECT_EQ(peers.requester.WaitTransfer(failedId, 0).GetCode(), ErrorCode::kNotAuthorized);
+    ASSERT_TRUE(peers.requester.WaitTransfer(okId, 0).IsOk());
+    EXPECT_EQ(dst1, sources[0]);
+
+    std::fill(dst0.begin(), dst0.end(), 0);
+    ASSERT_TRUE(peers.requester
+                    .TransferSyncRead(peers.ownerHostname, reinterpret_cast<uintptr_t>(dst0.data()),
+                                      reinterpret_cast<uintptr_t>(sources[0].data()), dst0.size())
+                    .IsOk());
+    EXPECT_EQ(dst0, sources[0]);
+}
+
+// 中文说明：验证多个线程对同一对端并发同步读取时，经连接流水线串行下发后结果正确。
+TEST(TransferEngineAsyncReadTest, ConcurrentSyncReadsSamePeerMockOk)
+{
+    constexpr size_t kThreads = 8;
+    constexpr size_t kReadsPerThread = 20;
+    MockPeers peers(60551, 60552);
+    peers.SetLatency(500);
+    auto sources = MakeSources(peers.owner, kThreads, 256);
+
+    std::atomic<size_t> okCount{ 0 };
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < kThreads; ++t) {
+        workers.emplace_back([&, t]() {
+            std::vector<uint8_t> dst(256, 0);
+            for (size_t i = 0; i < kReadsPerThread; ++i) {
+                std::fill(dst.begin(), dst.end(), 0);
+                Result rc = peers.requester.TransferSyncRead(peers.ownerHostname,
+                                                             reinterpret_cast<uintptr_t>(dst.data()),
+                                                             reinterpret_cast<uintptr_t>(sources[t].data()),
+                                                             dst.size());
+                if (rc.IsOk() && dst == sources[t]) {
+                    okCount.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(okCount.load(), kThreads * kReadsPerThread);
+}
+
+// 中文说明：验证已完成但未轮询的批次保留结果，轮询后释放。
+TEST(TransferEngineAsyncReadTest, CompletedBatchKeepsResultUntilPolled)
+{
+    MockPeers peers(60651, 60652);
+    auto sources = MakeSources(peers.owner, 1, 64);
+    std::vector<uint8_t> unregistered(64, 7);
+    std::vector<uint8_t> dst0(64, 0);
+    std::vector<uint8_t> dst1(64, 0);
+    std::vector<uint8_t> dst2(64, 0);
+
+    uint64_t failedId = 0;
+    uint64_t okId = 0;
+    uint64_t lastId = 0;
+    ASSERT_TRUE(peers.SubmitOne(dst0, unregistered, &failedId).IsOk());
+    ASSERT_TRUE(peers.SubmitOne(dst1, sources[0], &okId).IsOk());
+    ASSERT_TRUE(peers.SubmitOne(dst2, sources[0], &lastId).IsOk());
+    // Batches complete in submission order, so the earlier ones are done once the last one is.
+    ASSERT_TRUE(peers.requester.WaitTransfer(lastId, 0).IsOk());
+
+    EXPECT_EQ(peers.requester.CancelTransfer(okId).GetCode(), ErrorCode::kNotReady);
+    bool completed = false;
+    EXPECT_EQ(peers.requester.PollTransfer(failedId, &completed).GetCode(), ErrorCode::kNotAuthorized);
+    EXPECT_TRUE(completed);
+    completed = false;
+    ASSERT_TRUE(peers.requester.PollTransfer(okId, &completed).IsOk());
+    EXPECT_TRUE(completed);
+    EXPECT_EQ(dst1, sources[0]);
+    EXPECT_EQ(peers.requester.PollTransfer(okId, &completed).GetCode(), ErrorCode::kNotFound);
+    EXPECT_EQ(peers.requester.WaitTransfer(failedId, 0).GetCode(), ErrorCode::kNotFound);
+}
+
+// 中文说明：验证异步流水线能让整个在途窗口的批次同时在途，而逐个同步读取每次只有一个批次在途。
+TEST(TransferEngineAsyncReadTest, PipelineFillsWindowMock)
+{
+    constexpr size_t kItemsPerBatch = 4;
+    constexpr size_t kItemSize = 4096;
+    const std::vector<size_t> windows = { 1, 2, 4, 8, 16 };
+
+    auto run = [&](size_t window, uint16_t portBase) {
+        ScopedAsyncReadWindow scopedWindow(window);
+        MockPeers peers(portBase, portBase + 1);
+        peers.SetLatency(200);
+        auto sources = MakeSources(peers.owner, kItemsPerBatch, kItemSize);
+        std::vector<std::vector<uint8_t>> dsts(kItemsPerBatch, std::vector<uint8_t>(kItemSize, 0));
+        std::vector<uintptr_t> buffers;
+        std::vector<uintptr_t> peerAddrs;
+        std::vector<size_t> lengths(kItemsPerBatch, kItemSize);
+        for (size_t i = 0; i < kItemsPerBatch; ++i) {
+            buffers.push_back(reinterpret_cast<uintptr_t>(dsts[i].data()));
+            peerAddrs.push_back(reinterpret_cast<uintptr_t>(sources[i].data()));
+        }
+
+        for (size_t i = 0; i < 2 * window; ++i) {
+            ASSERT_TRUE(
+                peers.requester.BatchTransferSyncRead(peers.ownerHostname, buffers, peerAddrs, lengths).IsOk());
+        }
+        EXPECT_EQ(peers.TakePeakInFlight(), kItemsPerBatch) << "window " << window;
+
+        // With completions held a full window of batches is issued and none of them lands.
+        peers.HoldCompletions(true);
+        std::vector<uint64_t> batchIds(window);
+        for (size_t i = 0; i < window; ++i) {
+            ASSERT_TRUE(peers.requester
+                            .BatchTransferAsyncRead(peers.ownerHostname, buffers, peerAddrs, lengths, &batchIds[i])
+                            .IsOk());
+        }
+        ASSERT_TRUE(peers.WaitInFlight(window * kItemsPerBatch)) << "window " << window;
+        peers.HoldCompletions(false);
+        for (auto batchId : batchIds) {
+            ASSERT_TRUE(peers.requester.WaitTransfer(batchId, 0).IsOk());
+        }
+        EXPECT_EQ(peers.TakePeakInFlight(), window * kItemsPerBatch) << "window " << window;
+
+        // Free running, the window still bounds what is in flight.
+        batchIds.resize(4 * window);
+        for (auto &batchId : batchIds) {
+            ASSERT_TRUE(peers.requester
+                            .BatchTransferAsyncRead(peers.ownerHostname, buffers, peerAddrs, lengths, &batchId)
+                            .IsOk());
+        }
+        for (auto batchId : batchIds) {
+            ASSERT_TRUE(peers.requester.WaitTransfer(batchId, 0).IsOk());
+        }
+        EXPECT_LE(peers.TakePeakInFlight(), window * kItemsPerBatch) << "window " << window;
+        EXPECT_EQ(dsts, sources);
+    };
+
+    for (size_t i = 0; i < windows.size(); ++i) {
+        run(windows[i], static_cast<uint16_t>(60661 + 10 * i));
+    }
+}
+
+// 中文说明：性能基准，对比逐个同步读取与不同在途窗口下的异步流水线，输出每秒操作数与单批次时延。
+TEST(TransferEngineAsyncReadTest, LEVEL1_PipelineThroughputMock)
+{
+    constexpr size_t kItemsPerBatch = 4;
+    constexpr size_t kItemSize = 4096;
+    constexpr size_t kBatches = 256;
+    constexpr uint64_t kOpLatencyUs = 200;
+    using Clock = std::chrono::steady_clock;
+
+    auto report = [&](const std::string &mode, Clock::duration elapsed, Clock::duration totalLatency) {
+        const double seconds = std::chrono::duration<double>(elapsed).count();
+        const double latencyUs = std::chrono::duration<double, std::micro>(totalLatency).count() / kBatches;
+        std::cout << "mock read pipeline, " << mode << ": " << kBatches * kItemsPerBatch / seconds << " ops/s, "
+                  << kBatches / seconds << " batches/s, " << latencyUs << " us per batch" << std::endl;
+    };
+
+    // window 0 is the serial path, one sync read after the other.
+    auto run = [&](size_t window, uint16_t portBase) {
+        ScopedAsyncReadWindow scopedWindow(std::max<size_t>(window, 1));
+        MockPeers peers(portBase, portBase + 1);
+        peers.SetLatency(kOpLatencyUs);
+        auto sources = MakeSources(peers.owner, kItemsPerBatch, kItemSize);
+        std::vector<std::vector<uint8_t>> dsts(kItemsPerBatch, std::vector<uint8_t>(kItemSize, 0));
+        std::vector<uintptr_t> buffers;
+        std::vector<uintptr_t> peerAddrs;
+        std::vector<size_t> lengths(kItemsPerBatch, kItemSize);
+        for (size_t i = 0; i < kItemsPerBatch; ++i) {
+            buffers.push_back(reinterpret_cast<uintptr_t>(dsts[i].data()));
+            peerAddrs.push_back(reinterpret_cast<uintptr_t>(sources[i].data()));
+        }
+
+        Clock::duration totalLatency{};
+        const auto start = Clock::now();
+        if (window == 0) {
+            for (size_t i = 0; i < kBatches; ++i) {
+                const auto submitted = Clock::now();
+                ASSERT_TRUE(
+                    peers.requester.BatchTransferSyncRead(peers.ownerHostname, buffers, peerAddrs, lengths).IsOk());
+                totalLatency += Clock::now() - submitted;
+            }
+        } else {
+            // Keep the window full: once it is, wait for the oldest batch before submitting the next one.
+            std::deque<std::pair<uint64_t, Clock::time_point>> outstanding;
+            auto waitOldest = [&]() {
+                ASSERT_TRUE(peers.requester.WaitTransfer(outstanding.front().first, 0).IsOk());
+                totalLatency += Clock::now() - outstanding.front().second;
+                outstanding.pop_front();
+            };
+            for (size_t i = 0; i < kBatches; ++i) {
+                if (outstanding.size() == window) {
+                    waitOldest();
+                }
+                uint64_t batchId = 0;
+                const auto submitted = Clock::now();
+                ASSERT_TRUE(peers.requester
+                                .BatchTransferAsyncRead(peers.ownerHostname, buffers, peerAddrs, lengths, &batchId)
+                                .IsOk());
+                outstanding.emplace_back(batchId, submitted);
+            }
+            while (!outstanding.empty()) {
+                waitOldest();
+            }
+        }
+        report(window == 0 ? "serial sync read" : "async window " + std::to_string(window), Clock::now() - start,
+               totalLatency);
+        EXPECT_EQ(dsts, sources);
+    };
+
+    const std::vector<size_t> windows = { 0, 1, 2, 4, 8, 16 };
+    for (size_t i = 0; i < windows.size(); ++i) {
+        run(windows[i], static_cast<uint16_t>(60761 + 10 * i));
+    }
+}
+
+}  // namespace
+}  // namespace datasystem
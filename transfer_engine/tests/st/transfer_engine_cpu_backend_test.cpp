@@ -0,0 +1,323 @@
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <endian.h>
+#include <dirent.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "internal/backend/cpu/cpu_transfer_backend.h"
+#include "datasystem/transfer_engine/transfer_engine.h"
+
+namespace datasystem {
+namespace {
+
+class ScopedEnv final {
+public:
+    ScopedEnv(const char *name, const std::string &value) : name_(name)
+    {
+        setenv(name_, value.c_str(), 1);
+    }
+
+    ~ScopedEnv()
+    {
+        unsetenv(name_);
+    }
+
+private:
+    const char *name_;
+};
+
+struct CpuPeers {
+    std::shared_ptr<CpuTransferBackend> ownerBackend = std::make_shared<CpuTransferBackend>();
+    std::shared_ptr<CpuTransferBackend> requesterBackend = std::make_shared<CpuTransferBackend>();
+    TransferEngine owner{ ownerBackend };
+    TransferEngine requester{ requesterBackend };
+    uint16_t ownerPort;
+    uint16_t requesterPort;
+
+    CpuPeers(uint16_t ownerPortIn, uint16_t requesterPortIn) : ownerPort(ownerPortIn), requesterPort(requesterPortIn)
+    {
+        EXPECT_TRUE(owner.Initialize("127.0.0.1:" + std::to_string(ownerPort), "cpu", "cpu:0").IsOk());
+        EXPECT_TRUE(requester.Initialize("127.0.0.1:" + std::to_string(requesterPort), "cpu", "cpu:1").IsOk());
+    }
+
+    std::string OwnerHostname() const
+    {
+        return "127.0.0.1:" + std::to_string(ownerPort);
+    }
+
+    ConnectionSpec RequesterSpec() const
+    {
+        ConnectionSpec spec;
+        spec.localHost = "127.0.0.1";
+        spec.localPort = requesterPort;
+        spec.localDeviceId = 1;
+        spec.peerHost = "127.0.0.1";
+        spec.peerPort = ownerPort;
+        spec.peerDeviceId = 0;
+        return spec;
+    }
+};
+
+std::vector<uint8_t> MakePattern(size_t size)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>((i * 131 + (i >> 12)) & 0xFF);
+    }
+    return data;
+}
+
+ConnectionSpec MakeSpec(uint16_t requesterPort, uint16_t ownerPort)
+{
+    ConnectionSpec spec;
+    spec.localHost = "127.0.0.1";
+    spec.localPort = requesterPort;
+    spec.localDeviceId = 1;
+    spec.peerHost = "127.0.0.1";
+    spec.peerPort = ownerPort;
+    spec.peerDeviceId = 0;
+    return spec;
+}
+
+std::string RootInfoField(const std::string &rootInfo, const std::string &key)
+{
+    const std::string prefix = "\n" + key + "=";
+    const size_t begin = rootInfo.find(prefix);
+    if (begin == std::string::npos) {
+        return "";
+    }
+    const size_t valueBegin = begin + prefix.size();
+    return rootInfo.substr(valueBegin, rootInfo.find('\n', valueBegin) - valueBegin);
+}
+
+size_t CountOpenFds()
+{
+    size_t count = 0;
+    DIR *dir = opendir("/proc/self/fd");
+    if (dir == nullptr) {
+        return 0;
+    }
+    while (readdir(dir) != nullptr) {
+        ++count;
+    }
+    closedir(dir);
+    return count;
+}
+
+// Reads [offset, offset + length) pieces of src into the same offsets of dst with one batch.
+Result ReadPieces(TransferEngine &requester, const std::string &owner, std::vector<uint8_t> &dst,
+                  const std::vector<uint8_t> &src, const std::vector<std::pair<size_t, size_t>> &pieces)
+{
+    std::vector<uintptr_t> buffers;
+    std::vector<uintptr_t> peers;
+    std::vector<size_t> lengths;
+    for (const auto &piece : pieces) {
+        buffers.push_back(reinterpret_cast<uintptr_t>(dst.data() + piece.first));
+        peers.push_back(reinterpret_cast<uintptr_t>(src.data() + piece.first));
+        lengths.push_back(piece.second);
+    }
+    return requester.BatchTransferSyncRead(owner, buffers, peers, lengths);
+}
+
+// 中文说明：验证同机 cpu 后端通过 process_vm_readv 直接读取对端进程内存，批量读取结果正确。
+TEST(TransferEngineCpuBackendTest, SameHostSyncReadOk)
+{
+    CpuPeers peers(64051, 64052);
+    const size_t size = 3 * 1024 * 1024 + 17;
+    const size_t big = 2 * 1024 * 1024;
+    auto src = MakePattern(size);
+    std::vector<uint8_t> dst(size, 0);
+    ASSERT_TRUE(peers.owner.RegisterMemory(reinterpret_cast<uintptr_t>(src.data()), src.size()).IsOk());
+
+    Result rc = ReadPieces(peers.requester, peers.OwnerHostname(), dst, src,
+                           { { 0, 4096 }, { 4096, big }, { 4096 + big, size - 4096 - big } });
+    ASSERT_TRUE(rc.IsOk()) << rc.ToString();
+    EXPECT_EQ(src, dst);
+    EXPECT_TRUE(peers.requesterBackend->IsSameHostConnection(peers.RequesterSpec()));
+}
+
+// 中文说明：验证强制 tcp 传输时，大批量读取被切分到多条 TCP 流并行传输，异步读取同样可用。
+TEST(TransferEngineCpuBackendTest, TcpMultiStreamReadOk)
+{
+    ScopedEnv transport("TRANSFER_ENGINE_CPU_TRANSPORT", "tcp");
+    ScopedEnv streams("TRANSFER_ENGINE_CPU_TCP_STREAMS", "4");
+    CpuPeers peers(64061, 64062);
+    const size_t size = 16 * 1024 * 1024 + 333;
+    auto src = MakePattern(size);
+    std::vector<uint8_t> dst(size, 0);
+    ASSERT_TRUE(peers.owner.RegisterMemory(reinterpret_cast<uintptr_t>(src.data()), src.size()).IsOk());
+
+    const size_t big = 9 * 1024 * 1024 + 1;
+    Result rc = ReadPieces(peers.requester, peers.OwnerHostname(), dst, src,
+                           { { 0, 1 }, { 1, 4095 }, { 4096, big }, { 4096 + big, size - 4096 - big } });
+    ASSERT_TRUE(rc.IsOk()) << rc.ToString();
+    EXPECT_EQ(src, dst);
+    EXPECT_FALSE(peers.requesterBackend->IsSameHostConnection(peers.RequesterSpec()));
+
+    std::vector<uint8_t> again(size, 0);
+    uint64_t batchId = 0;
+    ASSERT_TRUE(peers.requester
+                    .BatchTransferAsyncRead(peers.OwnerHostname(), { reinterpret_cast<uintptr_t>(again.data()) },
+                                            { reinterpret_cast<uintptr_t>(src.data()) }, { size }, &batchId)
+                    .IsOk());
+    rc = peers.requester.WaitTransfer(batchId, 0);
+    ASSERT_TRUE(rc.IsOk()) << rc.ToString();
+    EXPECT_EQ(src, again);
+}
+
+// 中文说明：验证 owner 数据服务拒绝未注册的内存范围，读取失败后连接被丢弃，重新建链后可继续读取。
+TEST(TransferEngineCpuBackendTest, DataServerRejectsUnregisteredRange)
+{
+    ScopedEnv transport("TRANSFER_ENGINE_CPU_TRANSPORT", "tcp");
+    CpuTransferBackend owner;
+    CpuTransferBackend requester;
+    ASSERT_TRUE(owner.InitializeLocal("127.0.0.1", 64071, 0).IsOk());
+    ASSERT_TRUE(requester.InitializeLocal("127.0.0.1", 64072, 1).IsOk());
+    std::vector<uint8_t> src = MakePattern(8192);
+    std::vector<uint8_t> dst(8192, 0);
+    ASSERT_TRUE(owner.RegisterLocalMemory(reinterpret_cast<uint64_t>(src.data()), 4096).IsOk());
+
+    const ConnectionSpec spec = MakeSpec(64072, 64071);
+    std::string rootInfo;
+    ASSERT_TRUE(owner.CreateRootInfo(&rootInfo).IsOk());
+    ASSERT_TRUE(requester.InitRecv(spec, rootInfo).IsOk());
+
+    const auto srcAddr = reinterpret_cast<uint64_t>(src.data());
+    const auto dstAddr = reinterpret_cast<uint64_t>(dst.data());
+    Result rc = requester.TransferSyncRead(spec, { TransferReadOp{ dstAddr, srcAddr + 1024, 4096 } }, 0);
+    EXPECT_EQ(rc.GetCode(), ErrorCode::kNotAuthorized);
+
+    // A failed read drops the connection, the engine then rebuilds it through the control plane.
+    ASSERT_TRUE(requester.InitRecv(spec, rootInfo).IsOk());
+    rc = requester.TransferSyncRead(spec, { TransferReadOp{ dstAddr, srcAddr, 4096 } }, 0);
+    ASSERT_TRUE(rc.IsOk()) << rc.ToString();
+    EXPECT_TRUE(std::equal(src.begin(), src.begin() + 4096, dst.begin()));
+}
+
+// 中文说明：验证 owner 数据服务只为携带正确数据令牌的连接提供数据，未握手或令牌错误的连接读不到任何内存。
+TEST(TransferEngineCpuBackendTest, DataServerRejectsUnauthenticatedStream)
+{
+    ScopedEnv transport("TRANSFER_ENGINE_CPU_TRANSPORT", "tcp");
+    CpuTransferBackend owner;
+    CpuTransferBackend requester;
+    ASSERT_TRUE(owner.InitializeLocal("127.0.0.1", 64101, 0).IsOk());
+    ASSERT_TRUE(requester.InitializeLocal("127.0.0.1", 64102, 1).IsOk());
+    std::vector<uint8_t> src = MakePattern(4096);
+    ASSERT_TRUE(owner.RegisterLocalMemory(reinterpret_cast<uint64_t>(src.data()), src.size()).IsOk());
+    std::string rootInfo;
+    ASSERT_TRUE(owner.CreateRootInfo(&rootInfo).IsOk());
+    const std::string token = RootInfoField(rootInfo, "data_token");
+    ASSERT_FALSE(token.empty());
+
+    std::string forged = rootInfo;
+    forged.replace(forged.find("data_token=" + token), std::string("data_token=").size() + token.size(),
+                   "data_token=" + std::to_string(std::stoull(token) ^ 2));
+    EXPECT_EQ(requester.InitRecv(MakeSpec(64102, 64101), forged).GetCode(), ErrorCode::kNotAuthorized);
+
+    // A read request without the hello is dropped before any memory is touched.
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(std::stoul(RootInfoField(rootInfo, "data_port"))));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)), 0);
+    uint8_t request[24] = {};
+    const uint32_t magic = htonl(0x54454344);
+    const uint32_t opCount = htonl(1);
+    const uint64_t remote = htobe64(reinterpret_cast<uint64_t>(src.data()));
+    const uint64_t length = htobe64(src.size());
+    std::memcpy(request, &magic, sizeof(magic));
+    std::memcpy(request + 4, &opCount, sizeof(opCount));
+    std::memcpy(request + 8, &remote, sizeof(remote));
+    std::memcpy(request + 16, &length, sizeof(length));
+    ASSERT_EQ(::send(fd, request, sizeof(request), MSG_NOSIGNAL), static_cast<ssize_t>(sizeof(request)));
+    // The owner closes the stream, with a reset when it left part of the request unread.
+    uint8_t reply[64];
+    EXPECT_LE(::recv(fd, reply, sizeof(reply), 0), 0);
+    ::close(fd);
+
+    ASSERT_TRUE(requester.InitRecv(MakeSpec(64102, 64101), rootInfo).IsOk());
+    std::vector<uint8_t> dst(src.size(), 0);
+    Result rc = requester.TransferSyncRead(
+        MakeSpec(64102, 64101),
+        { TransferReadOp{ reinterpret_cast<uint64_t>(dst.data()), reinterpret_cast<uint64_t>(src.data()), dst.size() } },
+        0);
+    ASSERT_TRUE(rc.IsOk()) << rc.ToString();
+    EXPECT_EQ(src, dst);
+}
+
+// 中文说明：验证对端断开后 owner 关闭对应的数据连接并回收服务线程，反复建链不会累积文件描述符。
+TEST(TransferEngineCpuBackendTest, ServeStreamsAreReapedOnDisconnect)
+{
+    constexpr int kRounds = 32;
+    ScopedEnv transport("TRANSFER_ENGINE_CPU_TRANSPORT", "tcp");
+    ScopedEnv streams("TRANSFER_ENGINE_CPU_TCP_STREAMS", "4");
+    CpuTransferBackend owner;
+    CpuTransferBackend requester;
+    ASSERT_TRUE(owner.InitializeLocal("127.0.0.1", 64111, 0).IsOk());
+    ASSERT_TRUE(requester.InitializeLocal("127.0.0.1", 64112, 1).IsOk());
+    std::string rootInfo;
+    ASSERT_TRUE(owner.CreateRootInfo(&rootInfo).IsOk());
+    const ConnectionSpec spec = MakeSpec(64112, 64111);
+
+    const size_t baseline = CountOpenFds();
+    for (int i = 0; i < kRounds; ++i) {
+        ASSERT_TRUE(requester.InitRecv(spec, rootInfo).IsOk());
+        requester.AbortConnection(spec);
+    }
+    // The owner closes its side once it sees the disconnect, give it a bounded time to catch up.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (CountOpenFds() > baseline && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_LE(CountOpenFds(), baseline);
+}
+
+// 中文说明：验证同机直读与不同 TCP 流数下多轮大批量读取结果均正确。
+TEST(TransferEngineCpuBackendTest, ReadEveryTransportCpu)
+{
+    constexpr size_t kSize = 64 * 1024 * 1024;
+    constexpr size_t kOpSize = 4 * 1024 * 1024;
+    constexpr int kRounds = 2;
+    auto src = MakePattern(kSize);
+    std::vector<std::pair<size_t, size_t>> pieces;
+    for (size_t offset = 0; offset < kSize; offset += kOpSize) {
+        pieces.emplace_back(offset, kOpSize);
+    }
+
+    struct Case {
+        std::string transport;
+        std::string streams;
+    };
+    const std::vector<Case> cases = { { "auto", "4" }, { "tcp", "1" }, { "tcp", "2" }, { "tcp", "4" } };
+    uint16_t port = 64081;
+    for (const auto &one : cases) {
+        ScopedEnv transport("TRANSFER_ENGINE_CPU_TRANSPORT", one.transport);
+        ScopedEnv streams("TRANSFER_ENGINE_CPU_TCP_STREAMS", one.streams);
+        CpuPeers peers(port, port + 1);
+        port += 2;
+        ASSERT_TRUE(peers.owner.RegisterMemory(reinterpret_cast<uintptr_t>(src.data()), src.size()).IsOk());
+        for (int i = 0; i < kRounds; ++i) {
+            std::vector<uint8_t> dst(kSize, 0);
+            ASSERT_TRUE(ReadPieces(peers.requester, peers.OwnerHostname(), dst, src, pieces).IsOk())
+                << "transport=" << one.transport << ", tcp_streams=" << one.streams;
+            EXPECT_EQ(src, dst) << "transport=" << one.transport << ", tcp_streams=" << one.streams;
+        }
+    }
+}
+
+}  // namespace
+}  // namespace datasystem